@@ -424,7 +424,11 @@ proc generate {os_handle} {
 	file copy -force [file join src Source list.c] ./src
 	file copy -force [file join src Source timers.c] ./src
 	file copy -force [file join src Source event_groups.c] ./src
-	file copy -force [file join src Source portable MemMang heap_4.c] ./src
+	set heap_scheme [common::get_property CONFIG.heap_scheme $os_handle]
+	if {$heap_scheme == ""} {
+		set heap_scheme "heap_4"
+	}
+	file copy -force [file join src Source portable MemMang ${heap_scheme}.c] ./src
         set stream_buffer_enabled [common::get_property CONFIG.stream_buffer $os_handle]
         set message_buffer_enabled [common::get_property CONFIG.message_buffer $os_handle]
         if {$stream_buffer_enabled == "true" || $message_buffer_enabled == "true"} {
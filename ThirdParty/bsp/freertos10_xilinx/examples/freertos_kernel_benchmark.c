@@ -0,0 +1,232 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Kernel throughput benchmark.
+ *
+ * Each test runs for BENCH_TICKS ticks while a higher priority control task
+ * sleeps, then the control task reads the operation counter and deletes the
+ * workers.  The results are printed as operations per second, so kernel
+ * changes can be compared on the board or, with the POSIX port, on a Linux
+ * host.
+ *
+ * - Context switch: two tasks of the same priority yielding to each other.
+ * - Queue: one task sending to and one task receiving from a queue.
+ * - Stream buffer: one task sending to and one task receiving from a stream
+ *   buffer, BENCH_SB_CHUNK bytes at a time.
+ * - Timer service: one task deferring function calls to the timer task with
+ *   xTimerPendFunctionCall().
+ */
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "timers.h"
+#include "stream_buffer.h"
+#ifdef __linux__
+#include <stdio.h>
+#define xil_printf			printf
+#else
+/* Xilinx includes. */
+#include "xil_printf.h"
+#include "xparameters.h"
+#endif
+
+#define BENCH_TICKS			pdMS_TO_TICKS( 1000UL )
+#define BENCH_QUEUE_LENGTH	8
+#define BENCH_SB_SIZE		256
+#define BENCH_SB_CHUNK		16
+#define BENCH_WORKER_PRIO	( tskIDLE_PRIORITY + 1 )
+#define BENCH_CONTROL_PRIO	( configMAX_PRIORITIES - 1 )
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters );
+static void prvYieldTask( void *pvParameters );
+static void prvQueueTxTask( void *pvParameters );
+static void prvQueueRxTask( void *pvParameters );
+static void prvStreamTxTask( void *pvParameters );
+static void prvStreamRxTask( void *pvParameters );
+static void prvPendTask( void *pvParameters );
+static void prvPendedFunction( void *pvParameter1, uint32_t ulParameter2 );
+/*-----------------------------------------------------------*/
+
+static volatile uint32_t ulBenchCount;
+static QueueHandle_t xQueue;
+static StreamBufferHandle_t xStreamBuffer;
+
+int main( void )
+{
+	xil_printf( "\r\nFreeRTOS kernel benchmark\r\n" );
+
+	xTaskCreate( prvControlTask,
+				 ( const char * ) "Ctrl",
+				 configMINIMAL_STACK_SIZE,
+				 NULL,
+				 BENCH_CONTROL_PRIO,
+				 NULL );
+
+	/* Start the control task running. */
+	vTaskStartScheduler();
+
+	/* If all is well, the scheduler will now be running, and the following line
+	will never be reached on the board.  If the following line does execute,
+	then there was insufficient FreeRTOS heap memory available for the idle
+	and/or timer tasks to be created. */
+#ifdef __linux__
+	return 0;
+#else
+	for( ;; );
+#endif
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Runs the two worker tasks for BENCH_TICKS ticks and returns the number of
+ * operations per second they counted.
+ */
+static uint32_t prvRunBenchmark( TaskFunction_t pxWorker1, TaskFunction_t pxWorker2 )
+{
+	TaskHandle_t xWorker1;
+	TaskHandle_t xWorker2 = NULL;
+	uint32_t ulCount;
+
+	ulBenchCount = 0;
+
+	xTaskCreate( pxWorker1, ( const char * ) "W1", configMINIMAL_STACK_SIZE,
+				 NULL, BENCH_WORKER_PRIO, &xWorker1 );
+	if( pxWorker2 != NULL ) {
+		xTaskCreate( pxWorker2, ( const char * ) "W2", configMINIMAL_STACK_SIZE,
+					 NULL, BENCH_WORKER_PRIO, &xWorker2 );
+	}
+
+	vTaskDelay( BENCH_TICKS );
+	ulCount = ulBenchCount;
+
+	vTaskDelete( xWorker1 );
+	if( xWorker2 != NULL ) {
+		vTaskDelete( xWorker2 );
+	}
+
+	/* Let the idle task free the deleted workers. */
+	vTaskDelay( 2 );
+
+	return ( uint32_t ) ( ( ( uint64_t ) ulCount * configTICK_RATE_HZ ) / BENCH_TICKS );
+}
+
+/*-----------------------------------------------------------*/
+static void prvControlTask( void *pvParameters )
+{
+	uint32_t ulResult;
+
+	( void ) pvParameters;
+
+	ulResult = prvRunBenchmark( prvYieldTask, prvYieldTask );
+	xil_printf( "Context switch: %lu switches/s\r\n", ( unsigned long ) ulResult );
+
+	xQueue = xQueueCreate( BENCH_QUEUE_LENGTH, sizeof( uint32_t ) );
+	configASSERT( xQueue );
+	ulResult = prvRunBenchmark( prvQueueTxTask, prvQueueRxTask );
+	xil_printf( "Queue: %lu items/s\r\n", ( unsigned long ) ulResult );
+	vQueueDelete( xQueue );
+
+	xStreamBuffer = xStreamBufferCreate( BENCH_SB_SIZE, 1 );
+	configASSERT( xStreamBuffer );
+	ulResult = prvRunBenchmark( prvStreamTxTask, prvStreamRxTask );
+	xil_printf( "Stream buffer: %lu bytes/s\r\n", ( unsigned long ) ulResult );
+	vStreamBufferDelete( xStreamBuffer );
+
+	ulResult = prvRunBenchmark( prvPendTask, NULL );
+	xil_printf( "Timer service: %lu calls/s\r\n", ( unsigned long ) ulResult );
+
+	xil_printf( "FreeRTOS kernel benchmark PASSED\r\n" );
+
+#ifdef __linux__
+	vTaskEndScheduler();
+#endif
+	vTaskDelete( NULL );
+}
+
+/*-----------------------------------------------------------*/
+static void prvYieldTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; ) {
+		ulBenchCount++;
+		taskYIELD();
+	}
+}
+
+/*-----------------------------------------------------------*/
+static void prvQueueTxTask( void *pvParameters )
+{
+	uint32_t ulValue = 0;
+
+	( void ) pvParameters;
+
+	for( ;; ) {
+		xQueueSend( xQueue, &ulValue, portMAX_DELAY );
+		ulValue++;
+	}
+}
+
+/*-----------------------------------------------------------*/
+static void prvQueueRxTask( void *pvParameters )
+{
+	uint32_t ulValue;
+
+	( void ) pvParameters;
+
+	for( ;; ) {
+		if( xQueueReceive( xQueue, &ulValue, portMAX_DELAY ) == pdPASS ) {
+			ulBenchCount++;
+		}
+	}
+}
+
+/*-----------------------------------------------------------*/
+static void prvStreamTxTask( void *pvParameters )
+{
+	uint8_t ucData[ BENCH_SB_CHUNK ] = { 0 };
+
+	( void ) pvParameters;
+
+	for( ;; ) {
+		xStreamBufferSend( xStreamBuffer, ucData, sizeof( ucData ), portMAX_DELAY );
+	}
+}
+
+/*-----------------------------------------------------------*/
+static void prvStreamRxTask( void *pvParameters )
+{
+	uint8_t ucData[ BENCH_SB_CHUNK ];
+
+	( void ) pvParameters;
+
+	for( ;; ) {
+		ulBenchCount += xStreamBufferReceive( xStreamBuffer, ucData,
+											  sizeof( ucData ), portMAX_DELAY );
+	}
+}
+
+/*-----------------------------------------------------------*/
+static void prvPendTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; ) {
+		xTimerPendFunctionCall( prvPendedFunction, NULL, 0, portMAX_DELAY );
+	}
+}
+
+/*-----------------------------------------------------------*/
+static void prvPendedFunction( void *pvParameter1, uint32_t ulParameter2 )
+{
+	( void ) pvParameter1;
+	( void ) ulParameter2;
+
+	ulBenchCount++;
+}
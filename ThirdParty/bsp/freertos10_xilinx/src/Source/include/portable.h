@@ -152,6 +152,16 @@ typedef struct xHeapStats
     size_t xNumberOfSuccessfulFrees;        /* The number of calls to vPortFree() that has successfully freed a block of memory. */
 } HeapStats_t;
 
+/* Used by heap_tlsf.c to pass per size class information out of
+ * uxPortGetHeapClassStats(). */
+typedef struct xHeapClassStats
+{
+    size_t xClassMinimumSize;              /* The smallest block size, in bytes, held by the size class. */
+    size_t xNumberOfFreeBlocks;            /* The number of free blocks currently held by the size class. */
+    size_t xNumberOfSuccessfulAllocations; /* The number of calls to pvPortMalloc() that have returned a block of the size class. */
+    size_t xNumberOfSuccessfulFrees;       /* The number of calls to vPortFree() that have freed a block of the size class. */
+} HeapClassStats_t;
+
 /*
  * Used to define multiple heap regions for use by heap_5.c.  This function
  * must be called before any calls to pvPortMalloc() - not creating a task,
@@ -165,6 +175,14 @@ typedef struct xHeapStats
  */
 void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEGED_FUNCTION;
 
+/*
+ * Returns per size class counters in pxClassStats, for up to uxMaxClasses
+ * classes, and the number of classes filled in.  Only implemented by
+ * heap_tlsf.c.
+ */
+UBaseType_t uxPortGetHeapClassStats( HeapClassStats_t * pxClassStats,
+                                     UBaseType_t uxMaxClasses ) PRIVILEGED_FUNCTION;
+
 /*
  * Returns a HeapStats_t structure filled with information about the current
  * heap state.
@@ -0,0 +1,554 @@
+/*
+ * FreeRTOS Kernel V10.6.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ * Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the POSIX (Linux
+ * host) port.
+ *
+ * Each task is a pthread, and only the thread of the task selected by the
+ * kernel is allowed to run, the others wait on their own event.  A context
+ * switch signals the event of the next thread and waits on the event of the
+ * current one.
+ *
+ * The tick interrupt is simulated with SIGALRM from an interval timer.
+ * Disabling interrupts blocks the signals in the running thread.
+ *
+ * The port builds with the FreeRTOSConfig.h generated by
+ * freertos10_xilinx.cmake, so the kernel, and the libraries on top of it,
+ * can be run and profiled on a Linux host.
+ *----------------------------------------------------------*/
+
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "utils/wait_for_event.h"
+/*-----------------------------------------------------------*/
+
+/* Signal used to wake the main thread up from vPortEndScheduler(). */
+#define SIG_RESUME    SIGUSR1
+
+typedef struct THREAD
+{
+	pthread_t pthread;
+	TaskFunction_t pxCode;
+	void *pvParams;
+	BaseType_t xDying;
+	struct event *ev;
+} Thread_t;
+
+/*
+ * The additional per-thread data is stored at the beginning of the
+ * task's stack.
+ */
+static inline Thread_t *prvGetThreadFromTask( TaskHandle_t xTask )
+{
+StackType_t *pxTopOfStack = *( StackType_t ** ) xTask;
+
+	return ( Thread_t * ) ( pxTopOfStack + 1 );
+}
+/*-----------------------------------------------------------*/
+
+static pthread_once_t hSigSetupThread = PTHREAD_ONCE_INIT;
+static sigset_t xAllSignals;
+static sigset_t xSchedulerOriginalSignalMask;
+static pthread_t hMainThread;
+static volatile UBaseType_t uxCriticalNesting;
+static volatile BaseType_t xSchedulerEnd = pdFALSE;
+/*-----------------------------------------------------------*/
+
+static void prvSetupSignalsAndSchedulerPolicy( void );
+static void prvSetupTimerInterrupt( void );
+static void *prvWaitForStart( void *pvParams );
+static void prvSwitchThread( Thread_t *pxThreadToResume,
+							 Thread_t *pxThreadToSuspend );
+static void prvSuspendSelf( Thread_t *pxThread );
+static void prvResumeThread( Thread_t *pxThread );
+static void prvPortYieldFromISR( void );
+static void vPortSystemTickHandler( int iSig );
+static void vPortStartFirstTask( void );
+static void prvFatalError( const char *pcCall, int iErrno ) __attribute__( ( __noreturn__ ) );
+
+void vApplicationAssert( const char *pcFileName, uint32_t ulLine )
+		__attribute__((weak));
+void vApplicationMallocFailedHook( void ) __attribute__((weak));
+void vApplicationStackOverflowHook( TaskHandle_t xTask, char *pcTaskName )
+		__attribute__((weak));
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack,
+									StackType_t *pxEndOfStack,
+									TaskFunction_t pxCode,
+									void *pvParameters )
+{
+Thread_t *pxThread;
+pthread_attr_t xThreadAttributes;
+size_t ulStackSize;
+int iRet;
+
+	( void ) pthread_once( &hSigSetupThread, prvSetupSignalsAndSchedulerPolicy );
+
+	/* Store the additional thread data at the start of the stack. */
+	pxThread = ( Thread_t * ) ( pxTopOfStack + 1 ) - 1;
+	pxTopOfStack = ( StackType_t * ) pxThread - 1;
+	ulStackSize = ( size_t ) ( pxTopOfStack + 1 - pxEndOfStack ) * sizeof( *pxTopOfStack );
+
+	pxThread->pxCode = pxCode;
+	pxThread->pvParams = pvParameters;
+	pxThread->xDying = pdFALSE;
+
+	pthread_attr_init( &xThreadAttributes );
+
+	/* Run the thread on the task stack when it is large enough for the host
+	C library, otherwise let pthread allocate one. */
+	if( ulStackSize >= ( size_t ) PTHREAD_STACK_MIN )
+	{
+		iRet = pthread_attr_setstack( &xThreadAttributes, pxEndOfStack, ulStackSize );
+		if( iRet != 0 )
+		{
+			prvFatalError( "pthread_attr_setstack", iRet );
+		}
+	}
+
+	pxThread->ev = event_create();
+	if( pxThread->ev == NULL )
+	{
+		prvFatalError( "event_create", ENOMEM );
+	}
+
+	vPortEnterCritical();
+
+	iRet = pthread_create( &pxThread->pthread, &xThreadAttributes,
+						   prvWaitForStart, pxThread );
+	if( iRet != 0 )
+	{
+		prvFatalError( "pthread_create", iRet );
+	}
+
+	vPortExitCritical();
+
+	pthread_attr_destroy( &xThreadAttributes );
+
+	return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+static void vPortStartFirstTask( void )
+{
+Thread_t *pxFirstThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+	/* Start the first task. */
+	prvResumeThread( pxFirstThread );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+BaseType_t xPortStartScheduler( void )
+{
+int iSignal;
+sigset_t xSignals;
+
+	hMainThread = pthread_self();
+
+	/* Start the timer that generates the tick ISR (SIGALRM).  Interrupts are
+	disabled here already. */
+	prvSetupTimerInterrupt();
+
+	/* Start the first task. */
+	vPortStartFirstTask();
+
+	/* Wait until signaled by vPortEndScheduler(). */
+	sigemptyset( &xSignals );
+	sigaddset( &xSignals, SIG_RESUME );
+
+	while( xSchedulerEnd == pdFALSE )
+	{
+		( void ) sigwait( &xSignals, &iSignal );
+	}
+
+	/* Restore the original signal mask. */
+	( void ) pthread_sigmask( SIG_SETMASK, &xSchedulerOriginalSignalMask, NULL );
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+struct itimerval xITimer;
+struct sigaction xSigTick;
+Thread_t *pxCurrentThread;
+
+	/* Stop the timer and ignore any pending SIGALRMs that would end up
+	running on the main thread when it is resumed. */
+	memset( &xITimer, 0, sizeof( xITimer ) );
+	( void ) setitimer( ITIMER_REAL, &xITimer, NULL );
+
+	xSigTick.sa_flags = 0;
+	xSigTick.sa_handler = SIG_IGN;
+	sigemptyset( &xSigTick.sa_mask );
+	( void ) sigaction( SIGALRM, &xSigTick, NULL );
+
+	/* Signal the scheduler to exit its loop. */
+	xSchedulerEnd = pdTRUE;
+	( void ) pthread_kill( hMainThread, SIG_RESUME );
+
+	pxCurrentThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+	prvSuspendSelf( pxCurrentThread );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	if( uxCriticalNesting == 0 )
+	{
+		vPortDisableInterrupts();
+	}
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	uxCriticalNesting--;
+
+	/* If we have reached 0 then re-enable the interrupts. */
+	if( uxCriticalNesting == 0 )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvPortYieldFromISR( void )
+{
+Thread_t *pxThreadToSuspend;
+Thread_t *pxThreadToResume;
+
+	pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+	vTaskSwitchContext();
+
+	pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+	prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+	vPortEnterCritical();
+
+	prvPortYieldFromISR();
+
+	vPortExitCritical();
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+	( void ) pthread_sigmask( SIG_BLOCK, &xAllSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+	( void ) pthread_sigmask( SIG_UNBLOCK, &xAllSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t xPortSetInterruptMask( void )
+{
+	/* Interrupts are always disabled inside ISRs (signals handlers). */
+	return ( UBaseType_t ) 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxMask )
+{
+	( void ) uxMask;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Setup the systick timer to generate the tick interrupts at the required
+ * frequency.
+ */
+static void prvSetupTimerInterrupt( void )
+{
+struct itimerval xITimer;
+int iRet;
+
+	/* Initialise the structure with the current timer information. */
+	iRet = getitimer( ITIMER_REAL, &xITimer );
+	if( iRet == -1 )
+	{
+		prvFatalError( "getitimer", errno );
+	}
+
+	/* Set the interval between timer events. */
+	xITimer.it_interval.tv_sec = portTICK_RATE_MICROSECONDS / 1000000UL;
+	xITimer.it_interval.tv_usec = portTICK_RATE_MICROSECONDS % 1000000UL;
+
+	/* Set the current count-down. */
+	xITimer.it_value = xITimer.it_interval;
+
+	/* Set-up the timer interrupt. */
+	iRet = setitimer( ITIMER_REAL, &xITimer, NULL );
+	if( iRet == -1 )
+	{
+		prvFatalError( "setitimer", errno );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void vPortSystemTickHandler( int iSig )
+{
+Thread_t *pxThreadToSuspend;
+Thread_t *pxThreadToResume;
+
+	( void ) iSig;
+
+	/* Signals are blocked in this signal handler. */
+	uxCriticalNesting++;
+
+	pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+	if( ( xTaskIncrementTick() != pdFALSE ) && ( configUSE_PREEMPTION == 1 ) )
+	{
+		/* Select the next task. */
+		vTaskSwitchContext();
+
+		pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+		prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+	}
+
+	uxCriticalNesting--;
+}
+/*-----------------------------------------------------------*/
+
+void vPortThreadDying( void *pxTaskToDelete, volatile BaseType_t *pxPendYield )
+{
+Thread_t *pxThread = prvGetThreadFromTask( pxTaskToDelete );
+
+	( void ) pxPendYield;
+
+	/* The thread exits at its next switch out, see prvSwitchThread(). */
+	pxThread->xDying = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCancelThread( void *pxTaskToDelete )
+{
+Thread_t *pxThreadToCancel = prvGetThreadFromTask( pxTaskToDelete );
+
+	/* The thread has already been suspended so it can be safely cancelled. */
+	( void ) pthread_cancel( pxThreadToCancel->pthread );
+	( void ) pthread_join( pxThreadToCancel->pthread, NULL );
+	event_delete( pxThreadToCancel->ev );
+}
+/*-----------------------------------------------------------*/
+
+static void *prvWaitForStart( void *pvParams )
+{
+Thread_t *pxThread = pvParams;
+
+	prvSuspendSelf( pxThread );
+
+	/* Resumed for the first time, unblocks all signals. */
+	uxCriticalNesting = 0;
+	vPortEnableInterrupts();
+
+	/* Call the task's entry point. */
+	pxThread->pxCode( pxThread->pvParams );
+
+	/* A function that implements a task must not exit or attempt to return to
+	its caller as there is nothing to return to.  If a task wants to exit it
+	should instead call vTaskDelete( NULL ). */
+	configASSERT( pdFALSE );
+	vTaskDelete( NULL );
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchThread( Thread_t *pxThreadToResume,
+							 Thread_t *pxThreadToSuspend )
+{
+UBaseType_t uxSavedCriticalNesting;
+
+	if( pxThreadToSuspend != pxThreadToResume )
+	{
+		/* The critical section nesting is per task, so save it on the stack
+		of the suspending thread and restore it when switching back to this
+		task. */
+		uxSavedCriticalNesting = uxCriticalNesting;
+
+		prvResumeThread( pxThreadToResume );
+
+		if( pxThreadToSuspend->xDying == pdTRUE )
+		{
+			pthread_exit( NULL );
+		}
+
+		prvSuspendSelf( pxThreadToSuspend );
+
+		uxCriticalNesting = uxSavedCriticalNesting;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSuspendSelf( Thread_t *pxThread )
+{
+	/* Suspend this thread until it is resumed by another one. */
+	( void ) event_wait( pxThread->ev );
+}
+/*-----------------------------------------------------------*/
+
+static void prvResumeThread( Thread_t *pxThread )
+{
+	if( pthread_equal( pthread_self(), pxThread->pthread ) == 0 )
+	{
+		event_signal( pxThread->ev );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupSignalsAndSchedulerPolicy( void )
+{
+struct sigaction xSigTick;
+int iRet;
+
+	hMainThread = pthread_self();
+
+	/* Initialise common signal masks. */
+	sigfillset( &xAllSignals );
+
+	/* Don't block SIGINT so this can be used to break into GDB while in a
+	critical section. */
+	sigdelset( &xAllSignals, SIGINT );
+
+	/* Block all signals in this thread so all new threads inherit this mask.
+	When a thread is started it will unblock signals at the right time. */
+	( void ) pthread_sigmask( SIG_SETMASK, &xAllSignals,
+							  &xSchedulerOriginalSignalMask );
+
+	/* Hook up the tick signal handler. */
+	xSigTick.sa_flags = 0;
+	xSigTick.sa_handler = vPortSystemTickHandler;
+	sigfillset( &xSigTick.sa_mask );
+
+	iRet = sigaction( SIGALRM, &xSigTick, NULL );
+	if( iRet == -1 )
+	{
+		prvFatalError( "sigaction", errno );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvFatalError( const char *pcCall, int iErrno )
+{
+	fprintf( stderr, "%s: %s\n", pcCall, strerror( iErrno ) );
+	abort();
+}
+/*-----------------------------------------------------------*/
+
+/* This version of vApplicationAssert() is declared as a weak symbol to allow it
+to be overridden by a version implemented within the application that is using
+this BSP. */
+void vApplicationAssert( const char *pcFileName, uint32_t ulLine )
+{
+	fprintf( stderr, "Assert failed in file %s, line %lu\n", pcFileName,
+			 ( unsigned long ) ulLine );
+	abort();
+}
+/*-----------------------------------------------------------*/
+
+/* This default malloc failed hook does nothing and is declared as a weak symbol
+to allow the application writer to override this default by providing their own
+implementation in the application code. */
+void vApplicationMallocFailedHook( void )
+{
+	fprintf( stderr, "vApplicationMallocFailedHook() called\n" );
+}
+/*-----------------------------------------------------------*/
+
+/* This default stack overflow hook will stop the application for executing.  It
+is declared as a weak symbol to allow the application writer to override this
+default by providing their own implementation in the application code. */
+void vApplicationStackOverflowHook( TaskHandle_t xTask, char *pcTaskName )
+{
+	( void ) xTask;
+
+	fprintf( stderr, "HALT: Task %s overflowed its stack.\n", pcTaskName );
+	abort();
+}
+/*-----------------------------------------------------------*/
+
+#if( configGENERATE_RUN_TIME_STATS == 1 )
+static uint64_t ullRunTimeStartNs;
+
+static uint64_t prvGetTimeNs( void )
+{
+struct timespec xTs;
+
+	( void ) clock_gettime( CLOCK_MONOTONIC, &xTs );
+
+	return ( uint64_t ) xTs.tv_sec * 1000000000ULL + ( uint64_t ) xTs.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * For Run time stats.  The host monotonic clock is used, in microseconds.
+ */
+void xCONFIGURE_TIMER_FOR_RUN_TIME_STATS( void )
+{
+	ullRunTimeStartNs = prvGetTimeNs();
+}
+
+uint32_t xGET_RUN_TIME_COUNTER_VALUE( void )
+{
+	return ( uint32_t ) ( ( prvGetTimeNs() - ullRunTimeStartNs ) / 1000ULL );
+}
+#endif
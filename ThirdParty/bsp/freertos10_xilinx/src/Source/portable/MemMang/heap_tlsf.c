@@ -0,0 +1,839 @@
+/*
+ * FreeRTOS Kernel V10.6.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * An implementation of pvPortMalloc() and vPortFree() based on a two level
+ * segregated fit (TLSF) allocator.  Free blocks are kept in lists indexed by
+ * a first level (power of two) and a second level (linear subdivision of the
+ * power of two) size class, and two levels of bitmaps record which lists are
+ * not empty.  Finding a suitable block, splitting it, and merging a freed
+ * block with its physical neighbours are all done in constant time, whatever
+ * the fragmentation of the heap.
+ *
+ * Like heap_4.c the heap is, by default, the ucHeap array of
+ * configTOTAL_HEAP_SIZE bytes, initialised on the first allocation.  Like
+ * heap_5.c additional, non contiguous, regions can be handed over with
+ * vPortDefineHeapRegions().  Regions do not need to be passed in address
+ * order and can be added at any time.  Set configTLSF_STATIC_HEAP to 0 to
+ * omit ucHeap, vPortDefineHeapRegions() must then be called before the first
+ * call to pvPortMalloc().
+ *
+ * Per size class counters can be read with uxPortGetHeapClassStats().
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of https://www.FreeRTOS.org
+ * for more information.
+ */
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+    #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+#ifndef configHEAP_CLEAR_MEMORY_ON_FREE
+    #define configHEAP_CLEAR_MEMORY_ON_FREE    0
+#endif
+
+#ifndef configTLSF_STATIC_HEAP
+    #define configTLSF_STATIC_HEAP    1
+#endif
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE         ( ( size_t ) 8 )
+
+/* Max value that fits in a size_t type. */
+#define heapSIZE_MAX              ( ~( ( size_t ) 0 ) )
+
+/* Check if multiplying a and b will result in overflow. */
+#define heapMULTIPLY_WILL_OVERFLOW( a, b )    ( ( ( a ) > 0 ) && ( ( b ) > ( heapSIZE_MAX / ( a ) ) ) )
+
+/* Check if adding a and b will result in overflow. */
+#define heapADD_WILL_OVERFLOW( a, b )         ( ( a ) > ( heapSIZE_MAX - ( b ) ) )
+
+/* Block sizes are multiples of portBYTE_ALIGNMENT. */
+#if ( portBYTE_ALIGNMENT == 64 )
+    #define tlsfALIGN_LOG2    6
+#elif ( portBYTE_ALIGNMENT == 32 )
+    #define tlsfALIGN_LOG2    5
+#elif ( portBYTE_ALIGNMENT == 16 )
+    #define tlsfALIGN_LOG2    4
+#elif ( portBYTE_ALIGNMENT == 8 )
+    #define tlsfALIGN_LOG2    3
+#elif ( portBYTE_ALIGNMENT == 4 )
+    #define tlsfALIGN_LOG2    2
+#else
+    #error heap_tlsf.c requires a portBYTE_ALIGNMENT of at least 4
+#endif
+
+/* Each first level class is split into 2^tlsfSL_LOG2 second level classes. */
+#define tlsfSL_LOG2               4
+#define tlsfSL_COUNT              ( 1 << tlsfSL_LOG2 )
+
+/* Blocks smaller than tlsfSMALL_BLOCK_SIZE all go to first level class 0,
+ * where each second level class holds a single block size. */
+#define tlsfFL_SHIFT              ( tlsfSL_LOG2 + tlsfALIGN_LOG2 )
+#define tlsfSMALL_BLOCK_SIZE      ( ( size_t ) 1 << tlsfFL_SHIFT )
+
+/* Blocks are at most 2^( tlsfFL_INDEX_MAX + 1 ) bytes, so that the first
+ * level bitmap fits in 32 bits on both 32 and 64 bit targets. */
+#define tlsfFL_INDEX_MAX          30
+#define tlsfFL_COUNT              ( tlsfFL_INDEX_MAX - tlsfFL_SHIFT + 2 )
+#define tlsfBLOCK_SIZE_MAX        ( ( ( size_t ) 1 << ( tlsfFL_INDEX_MAX + 1 ) ) - portBYTE_ALIGNMENT )
+
+/* The low bit of xBlockSize is set while the block is in a free list.  Block
+ * sizes are multiple of portBYTE_ALIGNMENT so the bit is never part of the
+ * size itself. */
+#define tlsfBLOCK_FREE_BITMASK    ( ( size_t ) 1 )
+#define tlsfBLOCK_SIZE( pxBlock )        ( ( pxBlock )->xBlockSize & ~tlsfBLOCK_FREE_BITMASK )
+#define tlsfBLOCK_IS_FREE( pxBlock )     ( ( ( pxBlock )->xBlockSize & tlsfBLOCK_FREE_BITMASK ) != 0 )
+#define tlsfNEXT_PHYS_BLOCK( pxBlock )   ( ( TlsfBlock_t * ) ( ( ( uint8_t * ) ( pxBlock ) ) + tlsfBLOCK_SIZE( pxBlock ) ) )
+
+/*-----------------------------------------------------------*/
+
+#if ( configTLSF_STATIC_HEAP == 1 )
+
+/* Allocate the memory for the heap. */
+    #if ( configAPPLICATION_ALLOCATED_HEAP == 1 )
+
+/* The application writer has already defined the array used for the RTOS
+* heap - probably so it can be placed in a special segment or address. */
+        extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+    #else
+        PRIVILEGED_DATA static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+    #endif /* configAPPLICATION_ALLOCATED_HEAP */
+#endif /* configTLSF_STATIC_HEAP */
+
+/* Header placed at the start of every block.  Only the first two members are
+ * kept while a block is allocated, the free list links overlay the start of
+ * the memory handed to the application. */
+typedef struct A_TLSF_BLOCK
+{
+    struct A_TLSF_BLOCK * pxPrevPhysBlock; /**< The block just below this one in memory, NULL for the first block of a region. */
+    size_t xBlockSize;                     /**< The size of the block, header included, and the free flag. */
+    struct A_TLSF_BLOCK * pxNextFree;      /**< The next free block of the same size class. */
+    struct A_TLSF_BLOCK * pxPrevFree;      /**< The previous free block of the same size class. */
+} TlsfBlock_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Compute the first and second level indexes of the class holding blocks of
+ * xSize bytes.
+ */
+static void prvMappingInsert( size_t xSize,
+                              UBaseType_t * puxFl,
+                              UBaseType_t * puxSl ) PRIVILEGED_FUNCTION;
+
+/*
+ * Insert a block in, or remove a block from, the free list of its size class.
+ */
+static void prvInsertFreeBlock( TlsfBlock_t * pxBlock ) PRIVILEGED_FUNCTION;
+static void prvRemoveFreeBlock( TlsfBlock_t * pxBlock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return a free block of at least xSize bytes, or NULL if there is none.
+ */
+static TlsfBlock_t * prvFindFreeBlock( size_t xSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Hand over a memory area to the allocator.
+ */
+static void prvAddHeapRegion( uint8_t * pucStartAddress,
+                              size_t xSizeInBytes ) PRIVILEGED_FUNCTION;
+
+#if ( configTLSF_STATIC_HEAP == 1 )
+
+/*
+ * Called automatically to setup the ucHeap region on the first call to
+ * pvPortMalloc().
+ */
+    static void prvHeapInit( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* The size of the header kept in front of each allocated block.  It must be
+ * correctly byte aligned. */
+static const size_t xHeapStructSize = ( offsetof( TlsfBlock_t, pxNextFree ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Free blocks must be able to hold the complete TlsfBlock_t structure. */
+static const size_t xMinimumBlockSize = ( sizeof( TlsfBlock_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Heads of the segregated free lists, and the bitmaps of the non empty ones. */
+PRIVILEGED_DATA static TlsfBlock_t * pxFreeLists[ tlsfFL_COUNT ][ tlsfSL_COUNT ];
+PRIVILEGED_DATA static uint32_t ulFirstLevelBitmap = 0U;
+PRIVILEGED_DATA static uint32_t ulSecondLevelBitmap[ tlsfFL_COUNT ];
+
+/* Per first level size class counters. */
+PRIVILEGED_DATA static HeapClassStats_t xClassStats[ tlsfFL_COUNT ];
+
+/* Keeps track of the number of calls to allocate and free memory as well as the
+ * number of free bytes remaining, but says nothing about fragmentation. */
+PRIVILEGED_DATA static size_t xFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = 0;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = 0;
+
+/* Set once ucHeap, or the first region when configTLSF_STATIC_HEAP is 0, has
+ * been handed over to the allocator. */
+PRIVILEGED_DATA static BaseType_t xHeapHasBeenInitialised = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+/* Index of the most significant set bit, the value must not be 0. */
+static UBaseType_t prvFls( size_t xValue )
+{
+    #if defined( __GNUC__ )
+        return ( UBaseType_t ) ( ( sizeof( unsigned long ) * heapBITS_PER_BYTE ) - 1U - ( size_t ) __builtin_clzl( ( unsigned long ) xValue ) );
+    #else
+        UBaseType_t uxBit = 0;
+
+        while( ( xValue >>= 1 ) != 0U )
+        {
+            uxBit++;
+        }
+
+        return uxBit;
+    #endif
+}
+/*-----------------------------------------------------------*/
+
+/* Index of the least significant set bit, the value must not be 0. */
+static UBaseType_t prvFfs( uint32_t ulValue )
+{
+    #if defined( __GNUC__ )
+        return ( UBaseType_t ) __builtin_ctz( ulValue );
+    #else
+        UBaseType_t uxBit = 0;
+
+        while( ( ulValue & 1U ) == 0U )
+        {
+            ulValue >>= 1;
+            uxBit++;
+        }
+
+        return uxBit;
+    #endif
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingInsert( size_t xSize,
+                              UBaseType_t * puxFl,
+                              UBaseType_t * puxSl )
+{
+    UBaseType_t uxFls;
+
+    if( xSize < tlsfSMALL_BLOCK_SIZE )
+    {
+        *puxFl = 0;
+        *puxSl = ( UBaseType_t ) ( xSize >> tlsfALIGN_LOG2 );
+    }
+    else
+    {
+        uxFls = prvFls( xSize );
+        *puxSl = ( UBaseType_t ) ( ( xSize >> ( uxFls - tlsfSL_LOG2 ) ) ^ ( ( size_t ) 1 << tlsfSL_LOG2 ) );
+        *puxFl = uxFls - ( tlsfFL_SHIFT - 1 );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( TlsfBlock_t * pxBlock )
+{
+    UBaseType_t uxFl, uxSl;
+    TlsfBlock_t * pxHead;
+
+    prvMappingInsert( tlsfBLOCK_SIZE( pxBlock ), &uxFl, &uxSl );
+    configASSERT( uxFl < tlsfFL_COUNT );
+
+    pxHead = pxFreeLists[ uxFl ][ uxSl ];
+    pxBlock->pxPrevFree = NULL;
+    pxBlock->pxNextFree = pxHead;
+
+    if( pxHead != NULL )
+    {
+        pxHead->pxPrevFree = pxBlock;
+    }
+    else
+    {
+        ulFirstLevelBitmap |= ( 1UL << uxFl );
+        ulSecondLevelBitmap[ uxFl ] |= ( 1UL << uxSl );
+    }
+
+    pxFreeLists[ uxFl ][ uxSl ] = pxBlock;
+    pxBlock->xBlockSize |= tlsfBLOCK_FREE_BITMASK;
+    xClassStats[ uxFl ].xNumberOfFreeBlocks++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( TlsfBlock_t * pxBlock )
+{
+    UBaseType_t uxFl, uxSl;
+
+    prvMappingInsert( tlsfBLOCK_SIZE( pxBlock ), &uxFl, &uxSl );
+
+    if( pxBlock->pxNextFree != NULL )
+    {
+        pxBlock->pxNextFree->pxPrevFree = pxBlock->pxPrevFree;
+    }
+
+    if( pxBlock->pxPrevFree != NULL )
+    {
+        pxBlock->pxPrevFree->pxNextFree = pxBlock->pxNextFree;
+    }
+    else
+    {
+        /* The block was the head of its list. */
+        pxFreeLists[ uxFl ][ uxSl ] = pxBlock->pxNextFree;
+
+        if( pxBlock->pxNextFree == NULL )
+        {
+            ulSecondLevelBitmap[ uxFl ] &= ~( 1UL << uxSl );
+
+            if( ulSecondLevelBitmap[ uxFl ] == 0U )
+            {
+                ulFirstLevelBitmap &= ~( 1UL << uxFl );
+            }
+        }
+    }
+
+    pxBlock->xBlockSize &= ~tlsfBLOCK_FREE_BITMASK;
+    xClassStats[ uxFl ].xNumberOfFreeBlocks--;
+}
+/*-----------------------------------------------------------*/
+
+static TlsfBlock_t * prvFindFreeBlock( size_t xSize )
+{
+    UBaseType_t uxFl, uxSl;
+    uint32_t ulMap;
+
+    /* Round the size up to the next class boundary so that any block of the
+     * class found is large enough. */
+    if( xSize >= tlsfSMALL_BLOCK_SIZE )
+    {
+        xSize += ( ( size_t ) 1 << ( prvFls( xSize ) - tlsfSL_LOG2 ) ) - 1U;
+    }
+
+    prvMappingInsert( xSize, &uxFl, &uxSl );
+
+    if( uxFl >= tlsfFL_COUNT )
+    {
+        return NULL;
+    }
+
+    ulMap = ulSecondLevelBitmap[ uxFl ] & ( 0xFFFFFFFFUL << uxSl );
+
+    if( ulMap == 0U )
+    {
+        /* No block in this first level class, use the smallest non empty
+         * larger one. */
+        ulMap = ulFirstLevelBitmap & ( 0xFFFFFFFFUL << ( uxFl + 1U ) );
+
+        if( ulMap == 0U )
+        {
+            return NULL;
+        }
+
+        uxFl = prvFfs( ulMap );
+        ulMap = ulSecondLevelBitmap[ uxFl ];
+    }
+
+    uxSl = prvFfs( ulMap );
+
+    return pxFreeLists[ uxFl ][ uxSl ];
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    TlsfBlock_t * pxBlock;
+    TlsfBlock_t * pxNewBlock;
+    void * pvReturn = NULL;
+    size_t xAdditionalRequiredSize;
+    UBaseType_t uxFl, uxSl;
+
+    vTaskSuspendAll();
+    {
+        #if ( configTLSF_STATIC_HEAP == 1 )
+        {
+            /* If this is the first call to malloc then the heap will require
+             * initialisation to setup the free lists. */
+            if( xHeapHasBeenInitialised == pdFALSE )
+            {
+                prvHeapInit();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #else
+        {
+            /* The heap must be defined before the first call to
+             * pvPortMalloc(). */
+            configASSERT( xHeapHasBeenInitialised == pdTRUE );
+        }
+        #endif /* configTLSF_STATIC_HEAP */
+
+        if( xWantedSize > 0 )
+        {
+            /* The wanted size must be increased so it can contain the block
+             * header in addition to the requested amount of bytes. */
+            if( heapADD_WILL_OVERFLOW( xWantedSize, xHeapStructSize ) == 0 )
+            {
+                xWantedSize += xHeapStructSize;
+
+                /* Ensure that blocks are always aligned to the required number
+                 * of bytes. */
+                if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+                {
+                    /* Byte alignment required. */
+                    xAdditionalRequiredSize = portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK );
+
+                    if( heapADD_WILL_OVERFLOW( xWantedSize, xAdditionalRequiredSize ) == 0 )
+                    {
+                        xWantedSize += xAdditionalRequiredSize;
+                    }
+                    else
+                    {
+                        xWantedSize = 0;
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* The block must be able to hold the free list links once it
+                 * is freed. */
+                if( ( xWantedSize != 0 ) && ( xWantedSize < xMinimumBlockSize ) )
+                {
+                    xWantedSize = xMinimumBlockSize;
+                }
+            }
+            else
+            {
+                xWantedSize = 0;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) && ( xWantedSize <= tlsfBLOCK_SIZE_MAX ) )
+        {
+            pxBlock = prvFindFreeBlock( xWantedSize );
+
+            if( pxBlock != NULL )
+            {
+                prvRemoveFreeBlock( pxBlock );
+
+                /* If the block is larger than required it can be split into
+                 * two, the remainder going back to the free lists. */
+                if( ( pxBlock->xBlockSize - xWantedSize ) >= xMinimumBlockSize )
+                {
+                    pxNewBlock = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+                    pxNewBlock->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+                    pxNewBlock->pxPrevPhysBlock = pxBlock;
+                    tlsfNEXT_PHYS_BLOCK( pxNewBlock )->pxPrevPhysBlock = pxNewBlock;
+                    pxBlock->xBlockSize = xWantedSize;
+
+                    prvInsertFreeBlock( pxNewBlock );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+                if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+                {
+                    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                prvMappingInsert( pxBlock->xBlockSize, &uxFl, &uxSl );
+                xClassStats[ uxFl ].xNumberOfSuccessfulAllocations++;
+                xNumberOfSuccessfulAllocations++;
+
+                /* Return the memory space pointed to - jumping over the block
+                 * header at its start. */
+                pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceMALLOC( pvReturn, xWantedSize );
+    }
+    ( void ) xTaskResumeAll();
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+    {
+        if( pvReturn == NULL )
+        {
+            vApplicationMallocFailedHook();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
+
+    configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    uint8_t * puc = ( uint8_t * ) pv;
+    TlsfBlock_t * pxBlock;
+    TlsfBlock_t * pxNeighbour;
+    UBaseType_t uxFl, uxSl;
+
+    if( pv != NULL )
+    {
+        /* The memory being freed will have a block header immediately before
+         * it. */
+        puc -= xHeapStructSize;
+
+        /* This casting is to keep the compiler from issuing warnings. */
+        pxBlock = ( void * ) puc;
+
+        configASSERT( tlsfBLOCK_IS_FREE( pxBlock ) == 0 );
+        configASSERT( pxBlock->xBlockSize >= xMinimumBlockSize );
+
+        if( ( tlsfBLOCK_IS_FREE( pxBlock ) == 0 ) && ( pxBlock->xBlockSize >= xMinimumBlockSize ) )
+        {
+            #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+            {
+                ( void ) memset( puc + xHeapStructSize, 0, pxBlock->xBlockSize - xHeapStructSize );
+            }
+            #endif
+
+            vTaskSuspendAll();
+            {
+                xFreeBytesRemaining += pxBlock->xBlockSize;
+                traceFREE( pv, pxBlock->xBlockSize );
+
+                prvMappingInsert( pxBlock->xBlockSize, &uxFl, &uxSl );
+                xClassStats[ uxFl ].xNumberOfSuccessfulFrees++;
+
+                /* Merge with the block below if it is free. */
+                pxNeighbour = pxBlock->pxPrevPhysBlock;
+
+                if( ( pxNeighbour != NULL ) && ( tlsfBLOCK_IS_FREE( pxNeighbour ) != 0 ) )
+                {
+                    prvRemoveFreeBlock( pxNeighbour );
+                    pxNeighbour->xBlockSize += pxBlock->xBlockSize;
+                    pxBlock = pxNeighbour;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Merge with the block above if it is free.  The end marker of
+                 * a region is never free so this never crosses a region. */
+                pxNeighbour = tlsfNEXT_PHYS_BLOCK( pxBlock );
+
+                if( tlsfBLOCK_IS_FREE( pxNeighbour ) != 0 )
+                {
+                    prvRemoveFreeBlock( pxNeighbour );
+                    pxBlock->xBlockSize += pxNeighbour->xBlockSize;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                tlsfNEXT_PHYS_BLOCK( pxBlock )->pxPrevPhysBlock = pxBlock;
+                prvInsertFreeBlock( pxBlock );
+                xNumberOfSuccessfulFrees++;
+            }
+            ( void ) xTaskResumeAll();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+    return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+    return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+    /* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortCalloc( size_t xNum,
+                     size_t xSize )
+{
+    void * pv = NULL;
+
+    if( heapMULTIPLY_WILL_OVERFLOW( xNum, xSize ) == 0 )
+    {
+        pv = pvPortMalloc( xNum * xSize );
+
+        if( pv != NULL )
+        {
+            ( void ) memset( pv, 0, xNum * xSize );
+        }
+    }
+
+    return pv;
+}
+/*-----------------------------------------------------------*/
+
+static void prvAddHeapRegion( uint8_t * pucStartAddress,
+                              size_t xSizeInBytes )
+{
+    TlsfBlock_t * pxFirstBlock;
+    TlsfBlock_t * pxEndMarker;
+    portPOINTER_SIZE_TYPE uxAddress;
+    size_t xBlockSize;
+
+    /* Ensure the region starts on a correctly aligned boundary. */
+    uxAddress = ( portPOINTER_SIZE_TYPE ) pucStartAddress;
+
+    if( ( uxAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+    {
+        uxAddress += ( portBYTE_ALIGNMENT - 1 );
+        uxAddress &= ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK );
+
+        if( xSizeInBytes <= ( size_t ) ( uxAddress - ( portPOINTER_SIZE_TYPE ) pucStartAddress ) )
+        {
+            return;
+        }
+
+        xSizeInBytes -= ( size_t ) ( uxAddress - ( portPOINTER_SIZE_TYPE ) pucStartAddress );
+    }
+
+    xSizeInBytes &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+    /* Room is needed for at least one block and the end marker. */
+    if( xSizeInBytes < ( xMinimumBlockSize << 1 ) )
+    {
+        return;
+    }
+
+    /* A single free block covers the region, minus the space taken by the
+     * end marker.  Larger regions are truncated to the largest block size the
+     * size classes can describe. */
+    xBlockSize = xSizeInBytes - xMinimumBlockSize;
+
+    if( xBlockSize > tlsfBLOCK_SIZE_MAX )
+    {
+        xBlockSize = tlsfBLOCK_SIZE_MAX;
+    }
+
+    pxFirstBlock = ( TlsfBlock_t * ) uxAddress;
+    pxFirstBlock->pxPrevPhysBlock = NULL;
+    pxFirstBlock->xBlockSize = xBlockSize;
+
+    /* The end marker is a permanently allocated, zero sized, block that stops
+     * the merging of free blocks at the end of the region. */
+    pxEndMarker = tlsfNEXT_PHYS_BLOCK( pxFirstBlock );
+    pxEndMarker->pxPrevPhysBlock = pxFirstBlock;
+    pxEndMarker->xBlockSize = 0;
+
+    prvInsertFreeBlock( pxFirstBlock );
+
+    xFreeBytesRemaining += xBlockSize;
+    xMinimumEverFreeBytesRemaining += xBlockSize;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configTLSF_STATIC_HEAP == 1 )
+
+    static void prvHeapInit( void ) /* PRIVILEGED_FUNCTION */
+    {
+        prvAddHeapRegion( ucHeap, configTOTAL_HEAP_SIZE );
+        xHeapHasBeenInitialised = pdTRUE;
+    }
+
+#endif /* configTLSF_STATIC_HEAP */
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+    const HeapRegion_t * pxHeapRegion;
+
+    configASSERT( pxHeapRegions != NULL );
+
+    vTaskSuspendAll();
+    {
+        #if ( configTLSF_STATIC_HEAP == 1 )
+        {
+            if( xHeapHasBeenInitialised == pdFALSE )
+            {
+                prvHeapInit();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configTLSF_STATIC_HEAP */
+
+        for( pxHeapRegion = pxHeapRegions; pxHeapRegion->xSizeInBytes > 0; pxHeapRegion++ )
+        {
+            prvAddHeapRegion( pxHeapRegion->pucStartAddress, pxHeapRegion->xSizeInBytes );
+        }
+
+        xHeapHasBeenInitialised = pdTRUE;
+    }
+    ( void ) xTaskResumeAll();
+
+    /* Check something was actually defined before it is accessed. */
+    configASSERT( xFreeBytesRemaining != 0U );
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+{
+    TlsfBlock_t * pxBlock;
+    size_t xBlocks = 0, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+    UBaseType_t uxFl, uxSl;
+
+    vTaskSuspendAll();
+    {
+        for( uxFl = 0; uxFl < tlsfFL_COUNT; uxFl++ )
+        {
+            if( ( ulFirstLevelBitmap & ( 1UL << uxFl ) ) == 0U )
+            {
+                continue;
+            }
+
+            for( uxSl = 0; uxSl < tlsfSL_COUNT; uxSl++ )
+            {
+                for( pxBlock = pxFreeLists[ uxFl ][ uxSl ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFree )
+                {
+                    xBlocks++;
+
+                    if( tlsfBLOCK_SIZE( pxBlock ) > xMaxSize )
+                    {
+                        xMaxSize = tlsfBLOCK_SIZE( pxBlock );
+                    }
+
+                    if( tlsfBLOCK_SIZE( pxBlock ) < xMinSize )
+                    {
+                        xMinSize = tlsfBLOCK_SIZE( pxBlock );
+                    }
+                }
+            }
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+    pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+    pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+
+    taskENTER_CRITICAL();
+    {
+        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+        pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+        pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortGetHeapClassStats( HeapClassStats_t * pxClassStats,
+                                     UBaseType_t uxMaxClasses )
+{
+    UBaseType_t uxFl;
+
+    if( uxMaxClasses > tlsfFL_COUNT )
+    {
+        uxMaxClasses = tlsfFL_COUNT;
+    }
+
+    vTaskSuspendAll();
+    {
+        for( uxFl = 0; uxFl < uxMaxClasses; uxFl++ )
+        {
+            pxClassStats[ uxFl ] = xClassStats[ uxFl ];
+
+            /* Class 0 holds all the small blocks, class n holds the blocks of
+             * 2^( n + tlsfFL_SHIFT - 1 ) bytes up to twice that size. */
+            if( uxFl == 0 )
+            {
+                pxClassStats[ uxFl ].xClassMinimumSize = 0;
+            }
+            else
+            {
+                pxClassStats[ uxFl ].xClassMinimumSize = ( size_t ) 1 << ( uxFl + tlsfFL_SHIFT - 1 );
+            }
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    return uxMaxClasses;
+}
+/*-----------------------------------------------------------*/
@@ -22,6 +22,12 @@ the main FreeRTOS download.")
 set(freertos_total_heap_size 65536 CACHE STRING "Sets the amount of RAM reserved \
 for use by FreeRTOS - used when tasks, queues, semaphores and \
 event groups are created.")
+set(freertos_heap_scheme "heap_4" CACHE STRING "Memory manager providing \
+pvPortMalloc() and vPortFree(). heap_4 is a first fit allocator over the \
+configTOTAL_HEAP_SIZE array, heap_tlsf a two level segregated fit allocator \
+with constant time allocation and free, that can also take additional \
+regions through vPortDefineHeapRegions().")
+set_property(CACHE freertos_heap_scheme PROPERTY STRINGS heap_4 heap_tlsf)
 set(freertos_max_task_name 10 CACHE STRING "The maximum number of characters \
 that can be in the name of a task.")
 option(freertos_use_timeslicing "When true equal priority ready tasks will share \
@@ -218,6 +224,8 @@ elseif(("${CMAKE_SYSTEM_PROCESSOR}" STREQUAL "cortexr5") OR
        ("${CMAKE_SYSTEM_PROCESSOR}" STREQUAL "microblaze")
       )
     set(portPOINTER_SIZE_TYPE uint32_t)
+elseif("${CMAKE_SYSTEM_NAME}" STREQUAL "Linux")
+    set(portPOINTER_SIZE_TYPE size_t)
 endif()
 
 if(("${CMAKE_SYSTEM_PROCESSOR}" STREQUAL "cortexa53") OR
@@ -231,6 +239,8 @@ elseif(("${CMAKE_SYSTEM_PROCESSOR}" STREQUAL "cortexr5") OR
 	("${CMAKE_SYSTEM_PROCESSOR}" STREQUAL "cortexr52")
       )
     set(portTICK_TYPE_IS_ATOMIC 0x0)
+elseif("${CMAKE_SYSTEM_NAME}" STREQUAL "Linux")
+    set(portTICK_TYPE_IS_ATOMIC 0x1)
 endif()
 
 set(configMESSAGE_BUFFER_LENGTH_TYPE uint32_t)
@@ -11,33 +11,62 @@
 #include <metal/log.h>
 #include <metal/sys.h>
 #include <metal/softirq.h>
+#include <metal/time.h>
 #include <metal/utilities.h>
 #include <string.h>
 
 #define METAL_SOFTIRQ_NUM 64
+#define METAL_SOFTIRQ_WORDS metal_bitmap_longs(METAL_SOFTIRQ_NUM)
 
+/*
+ * Pending and enabled states are kept as word bitmaps, so that a dispatch
+ * only visits the words with enabled pending soft IRQs and walks their set
+ * bits instead of scanning every allocated soft IRQ.
+ */
 #define METAL_SOFTIRQ_ARRAY_DECLARE(num) \
 	static const int metal_softirq_num = num; \
 	static struct metal_irq metal_softirqs[num]; \
-	static atomic_char metal_softirq_pending[num]; \
-	static atomic_char metal_softirq_enabled[num];
+	static atomic_ulong metal_softirq_pending[METAL_SOFTIRQ_WORDS]; \
+	static atomic_ulong metal_softirq_enabled[METAL_SOFTIRQ_WORDS];
 
 static int metal_softirq_avail;
 METAL_SOFTIRQ_ARRAY_DECLARE(METAL_SOFTIRQ_NUM)
 
+static struct metal_softirq_stats metal_softirq_stats;
+
+static inline int metal_softirq_first_bit(unsigned long word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzl(word);
+#else
+	int bit = 0;
+
+	while ((word & 1UL) == 0UL) {
+		word >>= 1;
+		bit++;
+	}
+	return bit;
+#endif
+}
+
 static void metal_softirq_set_enable(struct metal_irq_controller *cntr,
 				     int irq, unsigned int enable)
 {
+	unsigned long mask;
+
 	if (irq < cntr->irq_base ||
 	    irq >= (cntr->irq_base + cntr->irq_num)) {
 		return;
 	}
 
 	irq -= cntr->irq_base;
+	mask = metal_bit(irq % METAL_BITS_PER_ULONG);
 	if (enable ==  METAL_IRQ_ENABLE) {
-		atomic_store(&metal_softirq_enabled[irq], 1);
+		atomic_fetch_or(&metal_softirq_enabled[irq / METAL_BITS_PER_ULONG],
+				mask);
 	} else {
-		atomic_store(&metal_softirq_enabled[irq], 0);
+		atomic_fetch_and(&metal_softirq_enabled[irq / METAL_BITS_PER_ULONG],
+				 ~mask);
 	}
 }
 
@@ -59,7 +88,8 @@ void metal_softirq_set(int irq)
 	}
 
 	irq -= cntr->irq_base;
-	atomic_store(&metal_softirq_pending[irq], 1);
+	atomic_fetch_or(&metal_softirq_pending[irq / METAL_BITS_PER_ULONG],
+			metal_bit(irq % METAL_BITS_PER_ULONG));
 }
 
 int metal_softirq_init(void)
@@ -84,18 +114,51 @@ int metal_softirq_allocate(int num)
 
 void metal_softirq_dispatch(void)
 {
+	unsigned long long start, elapsed;
+	unsigned long pending;
+	unsigned long handled = 0;
+	unsigned int w;
 	int i;
 
-	for (i = 0; i < metal_softirq_num; i++) {
-		struct metal_irq *irq;
-		char is_pending = 1;
-
-		if (atomic_load(&metal_softirq_enabled[i]) != 0 &&
-		    atomic_compare_exchange_strong(&metal_softirq_pending[i],
-						   &is_pending, 0)) {
-			irq = &metal_softirqs[i];
-			(void)metal_irq_handle(irq,
+	start = metal_get_timestamp();
+	for (w = 0; w < METAL_SOFTIRQ_WORDS; w++) {
+		pending = atomic_load(&metal_softirq_pending[w]) &
+			  atomic_load(&metal_softirq_enabled[w]);
+		if (pending == 0UL)
+			continue;
+		/*
+		 * Only claim the enabled bits, soft IRQs set while disabled
+		 * stay pending until they are enabled again.
+		 */
+		pending &= atomic_fetch_and(&metal_softirq_pending[w],
+					    ~pending);
+		while (pending != 0UL) {
+			i = metal_softirq_first_bit(pending);
+			pending &= pending - 1UL;
+			i += w * METAL_BITS_PER_ULONG;
+			(void)metal_irq_handle(&metal_softirqs[i],
 					       i + metal_softirq_cntr.irq_base);
+			handled++;
 		}
 	}
+
+	if (handled == 0UL)
+		return;
+	elapsed = metal_get_timestamp() - start;
+	metal_softirq_stats.dispatches++;
+	metal_softirq_stats.handled += handled;
+	metal_softirq_stats.total_time += elapsed;
+	if (elapsed > metal_softirq_stats.max_time)
+		metal_softirq_stats.max_time = elapsed;
+}
+
+void metal_softirq_get_stats(struct metal_softirq_stats *stats)
+{
+	if (stats)
+		*stats = metal_softirq_stats;
+}
+
+void metal_softirq_reset_stats(void)
+{
+	memset(&metal_softirq_stats, 0, sizeof(metal_softirq_stats));
 }
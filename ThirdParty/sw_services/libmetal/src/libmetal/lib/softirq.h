@@ -23,6 +23,18 @@ extern "C" {
  *  @{
  */
 
+/** Soft IRQ dispatch counters */
+struct metal_softirq_stats {
+	/** Number of dispatch passes which handled at least one soft IRQ */
+	unsigned long dispatches;
+	/** Number of soft IRQ handlers invoked */
+	unsigned long handled;
+	/** Accumulated dispatch time, in metal_get_timestamp() units */
+	unsigned long long total_time;
+	/** Longest dispatch pass, in metal_get_timestamp() units */
+	unsigned long long max_time;
+};
+
 /**
  * @brief	metal_softirq_init
  *
@@ -61,6 +73,22 @@ int metal_softirq_allocate(int num);
  */
 void metal_softirq_set(int irq);
 
+/**
+ * @brief	metal_softirq_get_stats
+ *
+ * Get the soft IRQs dispatch counters
+ *
+ * @param[out] stats pointer to copy the counters to
+ */
+void metal_softirq_get_stats(struct metal_softirq_stats *stats);
+
+/**
+ * @brief	metal_softirq_reset_stats
+ *
+ * Reset the soft IRQs dispatch counters
+ */
+void metal_softirq_reset_stats(void);
+
 /** @} */
 
 #ifdef __cplusplus
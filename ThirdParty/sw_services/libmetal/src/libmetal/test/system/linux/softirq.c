@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <metal/errno.h>
+
+#include "metal-test.h"
+#include <metal/irq.h>
+#include <metal/log.h>
+#include <metal/softirq.h>
+
+static int softirq_handler(int irq, void *priv)
+{
+	(void)irq;
+
+	(*(int *)priv)++;
+	return METAL_IRQ_HANDLED;
+}
+
+static int softirq(void)
+{
+	struct metal_softirq_stats stats;
+	int count[2] = { 0, 0 };
+	int irq_base;
+	int rc;
+
+	rc = metal_softirq_init();
+	if (rc) {
+		metal_log(METAL_LOG_ERROR, "softirq init failed\n");
+		return rc;
+	}
+	irq_base = metal_softirq_allocate(2);
+	if (irq_base < 0) {
+		metal_log(METAL_LOG_ERROR, "softirq allocate failed\n");
+		return irq_base;
+	}
+	rc = metal_irq_register(irq_base, softirq_handler, &count[0]);
+	rc |= metal_irq_register(irq_base + 1, softirq_handler, &count[1]);
+	if (rc) {
+		metal_log(METAL_LOG_ERROR, "softirq register failed\n");
+		return -EINVAL;
+	}
+	metal_irq_enable(irq_base);
+	metal_irq_enable(irq_base + 1);
+	metal_softirq_reset_stats();
+
+	metal_softirq_set(irq_base);
+	metal_softirq_set(irq_base + 1);
+	metal_softirq_dispatch();
+	metal_softirq_dispatch();
+	if (count[0] != 1 || count[1] != 1) {
+		metal_log(METAL_LOG_ERROR, "softirq dispatch failed\n");
+		rc = -EINVAL;
+		goto out;
+	}
+
+	/* A disabled soft IRQ stays pending until enabled again */
+	metal_irq_disable(irq_base + 1);
+	metal_softirq_set(irq_base + 1);
+	metal_softirq_dispatch();
+	if (count[1] != 1) {
+		metal_log(METAL_LOG_ERROR, "disabled softirq dispatched\n");
+		rc = -EINVAL;
+		goto out;
+	}
+	metal_irq_enable(irq_base + 1);
+	metal_softirq_dispatch();
+	if (count[1] != 2) {
+		metal_log(METAL_LOG_ERROR, "pending softirq lost\n");
+		rc = -EINVAL;
+		goto out;
+	}
+
+	metal_softirq_get_stats(&stats);
+	if (stats.dispatches != 2 || stats.handled != 3) {
+		metal_log(METAL_LOG_ERROR, "softirq stats mismatch\n");
+		rc = -EINVAL;
+	}
+out:
+	metal_irq_unregister(irq_base);
+	metal_irq_unregister(irq_base + 1);
+	return rc;
+}
+
+METAL_ADD_TEST(softirq);
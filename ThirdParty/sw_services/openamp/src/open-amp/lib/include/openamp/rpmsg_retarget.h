@@ -27,6 +27,9 @@ extern "C" {
 
 #define DEFAULT_PROXY_ENDPOINT  0xFFUL
 
+/* Default number of write requests kept in flight in streaming mode */
+#define RPMSG_RPC_DEFAULT_WINDOW 4
+
 struct rpmsg_rpc_data;
 
 typedef int (*rpmsg_rpc_poll)(void *arg);
@@ -54,6 +57,14 @@ struct rpmsg_rpc_data {
 	rpmsg_rpc_shutdown_cb shutdown_cb;
 	metal_mutex_t lock;
 	struct metal_spinlock buflock;
+	/* zero-copy streaming mode state, see rpmsg_rpc_set_stream_mode() */
+	unsigned int window;
+	unsigned int pending;
+	int stream_err;
+	size_t stream_done;
+	int hold_rx;
+	void *rxbuf;
+	size_t rxbuf_len;
 };
 
 /**
@@ -127,6 +138,27 @@ int rpmsg_rpc_send(struct rpmsg_rpc_data *rpc,
  */
 void rpmsg_set_default_rpc(struct rpmsg_rpc_data *rpc);
 
+/**
+ * @internal
+ *
+ * @brief Enable or disable the zero-copy streaming mode
+ *
+ * In streaming mode the _write() requests are built in place in the
+ * vring TX buffers obtained with rpmsg_get_tx_payload_buffer() and sent
+ * with rpmsg_send_nocopy(). A write larger than one buffer is split into
+ * several WRITE requests and up to window of them are kept outstanding
+ * before waiting for the proxy acknowledgments. The _read() responses
+ * are held in the RX buffer and copied once into the caller buffer.
+ *
+ * @param rpc		Pointer to remoteproc procedure call data struct
+ * @param window	Maximum number of outstanding write requests,
+ *			0 to go back to the copy mode
+ *
+ * @return 0 for success, and negative value for failure.
+ */
+int rpmsg_rpc_set_stream_mode(struct rpmsg_rpc_data *rpc,
+			      unsigned int window);
+
 #if defined __cplusplus
 }
 #endif
@@ -41,7 +41,26 @@ static int rpmsg_rpc_ept_cb(struct rpmsg_endpoint *ept, void *data, size_t len,
 						 struct rpmsg_rpc_data,
 						 ept);
 			metal_spinlock_acquire(&rpc->buflock);
-			if (rpc->respbuf && rpc->respbuf_len != 0) {
+			if (rpc->pending != 0) {
+				/* Acknowledgment of a streamed write request */
+				rpc->pending--;
+				if (syscall->id != WRITE_SYSCALL_ID)
+					rpc->stream_err = -EINVAL;
+				else if (syscall->args.int_field1 < 0)
+					rpc->stream_err =
+						syscall->args.int_field1;
+				else
+					rpc->stream_done +=
+						syscall->args.int_field1;
+				metal_spinlock_release(&rpc->buflock);
+				return RPMSG_SUCCESS;
+			}
+			if (rpc->hold_rx) {
+				/* Keep the response in the vring buffer */
+				rpmsg_hold_rx_buffer(ept, data);
+				rpc->rxbuf = data;
+				rpc->rxbuf_len = len;
+			} else if (rpc->respbuf && rpc->respbuf_len != 0) {
 				if (len > rpc->respbuf_len)
 					len = rpc->respbuf_len;
 				memcpy(rpc->respbuf, data, len);
@@ -85,6 +104,11 @@ int rpmsg_rpc_init(struct rpmsg_rpc_data *rpc,
 	rpc->ept_destroyed = 0;
 	rpc->respbuf = NULL;
 	rpc->respbuf_len = 0;
+	rpc->window = 0;
+	rpc->pending = 0;
+	rpc->hold_rx = 0;
+	rpc->rxbuf = NULL;
+	rpc->rxbuf_len = 0;
 	rpc->nacked = (atomic_flag)ATOMIC_FLAG_INIT;
 	atomic_flag_test_and_set(&rpc->nacked);
 	ret = rpmsg_create_ept(&rpc->ept, rdev,
@@ -105,12 +129,19 @@ void rpmsg_rpc_release(struct rpmsg_rpc_data *rpc)
 {
 	if (!rpc)
 		return;
+	metal_mutex_acquire(&rpc->lock);
+	if (rpc->rxbuf && rpc->ept_destroyed == 0)
+		rpmsg_release_rx_buffer(&rpc->ept, rpc->rxbuf);
+	metal_mutex_release(&rpc->lock);
 	if (rpc->ept_destroyed == 0)
 		rpmsg_destroy_ept(&rpc->ept);
 	metal_mutex_acquire(&rpc->lock);
 	metal_spinlock_acquire(&rpc->buflock);
 	rpc->respbuf = NULL;
 	rpc->respbuf_len = 0;
+	rpc->hold_rx = 0;
+	rpc->rxbuf = NULL;
+	rpc->rxbuf_len = 0;
 	metal_spinlock_release(&rpc->buflock);
 	metal_mutex_release(&rpc->lock);
 	metal_mutex_deinit(&rpc->lock);
@@ -148,6 +179,194 @@ void rpmsg_set_default_rpc(struct rpmsg_rpc_data *rpc)
 	rpmsg_default_rpc = rpc;
 }
 
+int rpmsg_rpc_set_stream_mode(struct rpmsg_rpc_data *rpc,
+			      unsigned int window)
+{
+	if (!rpc)
+		return -EINVAL;
+	metal_mutex_acquire(&rpc->lock);
+	rpc->window = window;
+	metal_mutex_release(&rpc->lock);
+	return 0;
+}
+
+static unsigned int rpmsg_rpc_get_window(struct rpmsg_rpc_data *rpc)
+{
+	unsigned int window;
+
+	metal_mutex_acquire(&rpc->lock);
+	window = rpc->window;
+	metal_mutex_release(&rpc->lock);
+	return window;
+}
+
+static unsigned int rpmsg_rpc_get_pending(struct rpmsg_rpc_data *rpc)
+{
+	unsigned int pending;
+
+	metal_spinlock_acquire(&rpc->buflock);
+	pending = rpc->pending;
+	metal_spinlock_release(&rpc->buflock);
+	return pending;
+}
+
+/* Poll until no more than max streamed requests are left unacknowledged */
+static void rpmsg_rpc_wait_pending(struct rpmsg_rpc_data *rpc,
+				   unsigned int max)
+{
+	while (rpmsg_rpc_get_pending(rpc) > max) {
+		if (rpc->ept_destroyed)
+			break;
+		if (rpc->poll)
+			rpc->poll(rpc->poll_arg);
+	}
+}
+
+/*
+ * Streaming write: each chunk is built directly in a vring TX buffer and
+ * up to window WRITE requests are left in flight. The proxy answers
+ * every request in order, the callback accumulates the written sizes.
+ */
+static int rpmsg_rpc_write_nocopy(struct rpmsg_rpc_data *rpc, int fd,
+				  const char *ptr, int len, int null_term,
+				  unsigned int window)
+{
+	struct rpmsg_rpc_syscall *syscall;
+	unsigned char *payload;
+	uint32_t buf_len;
+	int sent = 0;
+	int chunk;
+	int ret = 0;
+
+	metal_mutex_acquire(&rpc->lock);
+	metal_spinlock_acquire(&rpc->buflock);
+	rpc->stream_err = 0;
+	rpc->stream_done = 0;
+	metal_spinlock_release(&rpc->buflock);
+
+	do {
+		rpmsg_rpc_wait_pending(rpc, window - 1);
+		if (rpc->ept_destroyed) {
+			ret = -EINVAL;
+			break;
+		}
+		syscall = rpmsg_get_tx_payload_buffer(&rpc->ept, &buf_len, 1);
+		if (!syscall) {
+			ret = -ENOMEM;
+			break;
+		}
+		if (buf_len <= sizeof(*syscall) + null_term) {
+			rpmsg_release_tx_buffer(&rpc->ept, syscall);
+			ret = -EINVAL;
+			break;
+		}
+		chunk = buf_len - sizeof(*syscall) - null_term;
+		if (chunk > len - sent)
+			chunk = len - sent;
+
+		syscall->id = WRITE_SYSCALL_ID;
+		syscall->args.int_field1 = fd;
+		syscall->args.int_field2 = chunk;
+		syscall->args.data_len = chunk + null_term;
+		payload = (unsigned char *)syscall + sizeof(*syscall);
+		memcpy(payload, ptr + sent, chunk);
+		if (null_term == 1)
+			payload[chunk] = 0;
+
+		metal_spinlock_acquire(&rpc->buflock);
+		rpc->pending++;
+		metal_spinlock_release(&rpc->buflock);
+		ret = rpmsg_send_nocopy(&rpc->ept, syscall,
+					sizeof(*syscall) + chunk + null_term);
+		if (ret < 0) {
+			metal_spinlock_acquire(&rpc->buflock);
+			rpc->pending--;
+			metal_spinlock_release(&rpc->buflock);
+			rpmsg_release_tx_buffer(&rpc->ept, syscall);
+			ret = -EINVAL;
+			break;
+		}
+		sent += chunk;
+	} while (sent < len);
+
+	rpmsg_rpc_wait_pending(rpc, 0);
+	if (ret >= 0) {
+		metal_spinlock_acquire(&rpc->buflock);
+		ret = rpc->stream_err ? rpc->stream_err : (int)rpc->stream_done;
+		metal_spinlock_release(&rpc->buflock);
+	}
+	metal_mutex_release(&rpc->lock);
+
+	return ret;
+}
+
+/*
+ * Streaming read: the response stays in the held RX buffer and the
+ * payload is copied once, straight into the caller buffer.
+ */
+static int rpmsg_rpc_read_nocopy(struct rpmsg_rpc_data *rpc, int fd,
+				 char *buffer, int buflen)
+{
+	struct rpmsg_rpc_syscall syscall;
+	struct rpmsg_rpc_syscall *resp;
+	int tmplen;
+	int ret;
+
+	syscall.id = READ_SYSCALL_ID;
+	syscall.args.int_field1 = fd;
+	syscall.args.int_field2 = buflen;
+	syscall.args.data_len = 0;	/*not used */
+
+	metal_mutex_acquire(&rpc->lock);
+	metal_spinlock_acquire(&rpc->buflock);
+	rpc->hold_rx = 1;
+	rpc->rxbuf = NULL;
+	rpc->rxbuf_len = 0;
+	metal_spinlock_release(&rpc->buflock);
+
+	(void)atomic_flag_test_and_set(&rpc->nacked);
+	ret = rpmsg_send(&rpc->ept, &syscall, sizeof(syscall));
+	if (ret >= 0) {
+		while ((atomic_flag_test_and_set(&rpc->nacked))) {
+			if (rpc->poll)
+				rpc->poll(rpc->poll_arg);
+		}
+	} else {
+		ret = -EINVAL;
+	}
+
+	metal_spinlock_acquire(&rpc->buflock);
+	resp = rpc->rxbuf;
+	rpc->hold_rx = 0;
+	rpc->rxbuf = NULL;
+	metal_spinlock_release(&rpc->buflock);
+
+	if (ret >= 0) {
+		if (resp && rpc->rxbuf_len >= sizeof(*resp) &&
+		    resp->id == READ_SYSCALL_ID) {
+			if (resp->args.int_field1 > 0) {
+				tmplen = resp->args.data_len;
+				if (tmplen > buflen)
+					tmplen = buflen;
+				if (tmplen > (int)(rpc->rxbuf_len -
+						   sizeof(*resp)))
+					tmplen = rpc->rxbuf_len -
+						 sizeof(*resp);
+				memcpy(buffer, (unsigned char *)resp +
+				       sizeof(*resp), tmplen);
+			}
+			ret = resp->args.int_field1;
+		} else {
+			ret = -EINVAL;
+		}
+	}
+	if (resp && rpc->ept_destroyed == 0)
+		rpmsg_release_rx_buffer(&rpc->ept, resp);
+	metal_mutex_release(&rpc->lock);
+
+	return ret;
+}
+
 /*************************************************************************
  *
  *   FUNCTION
@@ -223,6 +442,9 @@ int _read(int fd, char *buffer, int buflen)
 	if (!rpc || !buffer || buflen == 0)
 		return -EINVAL;
 
+	if (rpmsg_rpc_get_window(rpc) != 0)
+		return rpmsg_rpc_read_nocopy(rpc, fd, buffer, buflen);
+
 	/* Construct rpc payload */
 	syscall.id = READ_SYSCALL_ID;
 	syscall.args.int_field1 = fd;
@@ -275,12 +497,17 @@ int _write(int fd, const char *ptr, int len)
 	struct rpmsg_rpc_data *rpc = rpmsg_default_rpc;
 	unsigned char tmpbuf[MAX_BUF_LEN];
 	unsigned char *tmpptr;
+	unsigned int window;
 	int null_term = 0;
 
 	if (!rpc)
 		return -EINVAL;
 	if (fd == 1)
 		null_term = 1;
+	window = rpmsg_rpc_get_window(rpc);
+	if (window != 0)
+		return rpmsg_rpc_write_nocopy(rpc, fd, ptr, len, null_term,
+					      window);
 
 	syscall = (void *)tmpbuf;
 	syscall->id = WRITE_SYSCALL_ID;
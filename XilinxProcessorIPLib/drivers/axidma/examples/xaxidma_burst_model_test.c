@@ -0,0 +1,513 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xaxidma_burst_model_test.c
+*
+* Host test and benchmark of the burst BD submit and reap APIs against a
+* register model of the scatter gather channels. It is not a target
+* example: it is built and run with the other driver model tests by
+* make -C scripts/host_model.
+*
+* The model keeps the channel registers in memory. A write to the tail
+* descriptor register is counted and lets the channel run up to that BD;
+* the test then completes a number of BDs with ModelRun(), which follows
+* the next descriptor links from the current descriptor register, checks
+* the driver cleared the completed bit, logs the TX buffers and writes the
+* completed status and length, with the end of frame for RX.
+*
+* The test submits bursts of all sizes so that they wrap around the ring,
+* completes them in uneven steps and checks that each burst did one tail
+* write and one cache flush, two when it wraps, that the reaped IDs and
+* lengths come back in submit order and that each scan invalidates the BDs
+* XAXIDMA_SCAN_WINDOW at a time. The errors must leave the ring as it was.
+* Then the host time per packet of the burst calls is compared with the
+* per BD calls for the same traffic.
+*
+* The BD ID holds 32 bits, so the buffers are mapped below 4 GB, as they
+* are on the 32-bit processors.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 9.18  kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include <sys/mman.h>
+#include "xaxidma.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#ifndef MAP_32BIT
+#define MAP_32BIT	0
+#endif
+
+#define REG_SPAN	0x100U
+#define NUM_BDS		64		/* BDs of a ring */
+#define BUF_SIZE	2048U		/* Bytes of a packet buffer */
+#define NUM_ROUNDS	40U
+#define BENCH_RING	256
+#define BENCH_BURST	32
+#define BENCH_ROUNDS	20000U
+#define SCAN_WINDOW	8U		/* XAXIDMA_SCAN_WINDOW of the driver */
+#define TX		0U
+#define RX		1U
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define REG(Off)	Regs[(Off) / 4U]
+#define RX_LEN(Len)	(((Len) * 3U) / 4U)	/* Received frame */
+#define CHAN_OFFSET(Ch)	(((Ch) == TX) ? XAXIDMA_TX_OFFSET : XAXIDMA_RX_OFFSET)
+
+/************************** Function Prototypes ******************************/
+
+static u32 ModelRun(u32 Ch, u32 MaxBds);
+static void Setup(u32 RingSize);
+static void RunBursts(u32 Ch);
+static void RunErrors(void);
+static void Bench(void);
+
+/************************** Variable Definitions *****************************/
+
+static u32 Regs[REG_SPAN / 4U];
+static u32 TailWrites[2];
+static UINTPTR CurBd[2];
+static int ChanIdle[2];
+static UINTPTR SentLog[NUM_BDS * 4];
+static u32 SentCount;
+
+static XAxiDma AxiDma;
+static XAxiDma_Config Config = {
+	.Name = "axidma",
+	.HasMm2S = 1,
+	.HasS2Mm = 1,
+	.Mm2SDataWidth = 32,
+	.S2MmDataWidth = 32,
+	.HasSg = 1,
+	.Mm2sNumChannels = 1,
+	.S2MmNumChannels = 1,
+	.AddrWidth = 32,
+	.SgLengthWidth = 23,
+};
+static u8 *BdMem[2];
+static u8 *Buffers;
+
+/*****************************************************************************/
+/*
+* Register model. A reset halts both channels, the run bit clears the
+* halted status and a tail write lets the channel run to the new tail.
+*/
+u32 Xil_In32(UINTPTR Addr)
+{
+	return REG(Addr - (UINTPTR)Regs);
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	u32 Off = (u32)(Addr - (UINTPTR)Regs);
+	u32 Ch = (Off >= XAXIDMA_RX_OFFSET) ? RX : TX;
+	u32 ChOff = Off - CHAN_OFFSET(Ch);
+
+	if ((ChOff == XAXIDMA_CR_OFFSET) &&
+	    ((Value & XAXIDMA_CR_RESET_MASK) != 0U)) {
+		REG(XAXIDMA_TX_OFFSET + XAXIDMA_CR_OFFSET) = 0U;
+		REG(XAXIDMA_RX_OFFSET + XAXIDMA_CR_OFFSET) = 0U;
+		REG(XAXIDMA_TX_OFFSET + XAXIDMA_SR_OFFSET) = XAXIDMA_HALTED_MASK;
+		REG(XAXIDMA_RX_OFFSET + XAXIDMA_SR_OFFSET) = XAXIDMA_HALTED_MASK;
+		return;
+	}
+	REG(Off) = Value;
+	if (ChOff == XAXIDMA_CR_OFFSET) {
+		REG(Off + XAXIDMA_SR_OFFSET) =
+			((Value & XAXIDMA_CR_RUNSTOP_MASK) != 0U) ?
+			0U : XAXIDMA_HALTED_MASK;
+	} else if (ChOff == XAXIDMA_CDESC_OFFSET) {
+		CurBd[Ch] = Value;
+		ChanIdle[Ch] = 0;
+	} else if (ChOff == XAXIDMA_TDESC_OFFSET) {
+		TailWrites[Ch]++;
+		ChanIdle[Ch] = 0;
+	}
+}
+
+/*****************************************************************************/
+/*
+* Completes up to MaxBds BDs of a channel, stopping after the tail BD.
+* RX BDs complete with a frame of RX_LEN() bytes of their buffer length.
+*
+* @return	Number of BDs completed.
+*/
+static u32 ModelRun(u32 Ch, u32 MaxBds)
+{
+	UINTPTR Tail = REG(CHAN_OFFSET(Ch) + XAXIDMA_TDESC_OFFSET);
+	u32 Count = 0U;
+	u32 Len;
+	u32 Sts;
+
+	while ((Count < MaxBds) && (ChanIdle[Ch] == 0)) {
+		Len = XAxiDma_BdRead(CurBd[Ch], XAXIDMA_BD_CTRL_LEN_OFFSET) &
+		      AxiDma.TxBdRing.MaxTransferLen;
+		XHOST_CHECK((XAxiDma_BdRead(CurBd[Ch], XAXIDMA_BD_STS_OFFSET) &
+			     XAXIDMA_BD_STS_COMPLETE_MASK) == 0U,
+			    "BD %lx given to hardware completed",
+			    (unsigned long)CurBd[Ch]);
+		if (Ch == TX) {
+			SentLog[SentCount % (NUM_BDS * 4)] =
+				XAxiDma_BdRead(CurBd[Ch], XAXIDMA_BD_BUFA_OFFSET);
+			SentCount++;
+			Sts = XAXIDMA_BD_STS_COMPLETE_MASK | Len;
+		} else {
+			Sts = XAXIDMA_BD_STS_COMPLETE_MASK |
+			      XAXIDMA_BD_STS_RXSOF_MASK |
+			      XAXIDMA_BD_STS_RXEOF_MASK |
+			      RX_LEN(Len);
+		}
+		XAxiDma_BdWrite(CurBd[Ch], XAXIDMA_BD_STS_OFFSET, Sts);
+		Count++;
+		if (CurBd[Ch] == Tail) {
+			ChanIdle[Ch] = 1;
+		}
+		CurBd[Ch] = XAxiDma_BdRead(CurBd[Ch], XAXIDMA_BD_NDESC_OFFSET);
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/*
+* Initializes the driver and starts both channels with rings of RingSize
+* BDs.
+*/
+static void Setup(u32 RingSize)
+{
+	XAxiDma_BdRing *RingPtr;
+	u32 Ch;
+	int Status;
+
+	memset(Regs, 0, sizeof(Regs));
+	memset(TailWrites, 0, sizeof(TailWrites));
+	Config.BaseAddr = (UINTPTR)Regs;
+	Status = XAxiDma_CfgInitialize(&AxiDma, &Config);
+	XHOST_CHECK(Status == XST_SUCCESS, "init %d", Status);
+
+	for (Ch = TX; Ch <= RX; Ch++) {
+		RingPtr = (Ch == TX) ? XAxiDma_GetTxRing(&AxiDma) :
+			  XAxiDma_GetRxRing(&AxiDma);
+		Status = (int)XAxiDma_BdRingCreate(RingPtr,
+						   (UINTPTR)BdMem[Ch],
+						   (UINTPTR)BdMem[Ch],
+						   XAXIDMA_BD_MINIMUM_ALIGNMENT,
+						   (int)RingSize);
+		XHOST_CHECK(Status == XST_SUCCESS, "ring create %d", Status);
+		Status = XAxiDma_BdRingStart(RingPtr);
+		XHOST_CHECK(Status == XST_SUCCESS, "ring start %d", Status);
+	}
+	SentCount = 0U;
+}
+
+/*****************************************************************************/
+/*
+* Bursts of 1 to NUM_BDS buffers on one channel, completed in steps of 1 to
+* 13 BDs and reaped in parts of up to 24 BDs.
+*/
+static void RunBursts(u32 Ch)
+{
+	XAxiDma_BdRing *RingPtr = (Ch == TX) ? XAxiDma_GetTxRing(&AxiDma) :
+				  XAxiDma_GetRxRing(&AxiDma);
+	UINTPTR Addr[NUM_BDS];
+	u32 Length[NUM_BDS];
+	UINTPTR Ids[NUM_BDS];
+	u32 Lens[NUM_BDS];
+	u32 Submitted = 0U;
+	u32 Reaped = 0U;
+	u32 Round;
+	u32 NumBd;
+	u32 Start;
+	u32 Index;
+	u32 Tails;
+	u32 Flushes;
+	u32 Invalidates;
+	u32 Expected;
+	u32 Buf;
+	int Got;
+	int Status;
+
+	for (Round = 0U; Round < NUM_ROUNDS; Round++) {
+		NumBd = 1U + ((Round * 37U) % (u32)NUM_BDS);
+		for (Index = 0U; Index < NumBd; Index++) {
+			Buf = (Submitted + Index) % (u32)NUM_BDS;
+			Addr[Index] = (UINTPTR)&Buffers[Buf * BUF_SIZE];
+			Length[Index] = 64U + ((Submitted + Index) % 1900U);
+		}
+		Start = Submitted % (u32)NUM_BDS;
+		Tails = TailWrites[Ch];
+		Flushes = XHostModel_FlushCount;
+		Status = XAxiDma_BdRingSubmitBurst(RingPtr, (int)NumBd, Addr,
+						   Length);
+		XHOST_CHECK(Status == XST_SUCCESS, "burst of %u: %d",
+			    (unsigned)NumBd, Status);
+		XHOST_CHECK(TailWrites[Ch] - Tails == 1U,
+			    "burst of %u: %u tail writes", (unsigned)NumBd,
+			    (unsigned)(TailWrites[Ch] - Tails));
+		Expected = ((Start + NumBd) > (u32)NUM_BDS) ? 2U : 1U;
+		XHOST_CHECK(XHostModel_FlushCount - Flushes == Expected,
+			    "burst of %u at %u: %u flushes", (unsigned)NumBd,
+			    (unsigned)Start,
+			    (unsigned)(XHostModel_FlushCount - Flushes));
+		Submitted += NumBd;
+
+		/* Complete in uneven steps, reap in parts */
+		while (Reaped < Submitted) {
+			(void)ModelRun(Ch, 1U + ((Reaped * 5U) % 13U));
+			Invalidates = XHostModel_InvalidateCount;
+			Got = XAxiDma_BdRingReapBurst(RingPtr, 24, Ids, Lens);
+			Expected = ((u32)Got + SCAN_WINDOW) / SCAN_WINDOW;
+			XHOST_CHECK(XHostModel_InvalidateCount - Invalidates <=
+				    Expected + 1U,
+				    "reap of %d: %u invalidates", Got,
+				    (unsigned)(XHostModel_InvalidateCount -
+					       Invalidates));
+			for (Index = 0U; Index < (u32)Got; Index++) {
+				Buf = (Reaped + Index) % (u32)NUM_BDS;
+				Expected = 64U + ((Reaped + Index) % 1900U);
+				if (Ch == RX) {
+					Expected = RX_LEN(Expected);
+				}
+				XHOST_CHECK(Ids[Index] ==
+					    (u32)(UINTPTR)&Buffers[Buf *
+								   BUF_SIZE],
+					    "BD %u reaped out of order",
+					    (unsigned)(Reaped + Index));
+				XHOST_CHECK(Lens[Index] == Expected,
+					    "BD %u length %u, expected %u",
+					    (unsigned)(Reaped + Index),
+					    (unsigned)Lens[Index],
+					    (unsigned)Expected);
+			}
+			Reaped += (u32)Got;
+			if (Got == 0) {
+				XHOST_CHECK(ChanIdle[Ch] == 0,
+					    "nothing to reap, %u pending",
+					    (unsigned)(Submitted - Reaped));
+				if (ChanIdle[Ch] != 0) {
+					return;
+				}
+			}
+		}
+	}
+	if (Ch == TX) {
+		for (Index = 0U; Index < (NUM_BDS * 4U); Index++) {
+			Round = SentCount - (NUM_BDS * 4U) + Index;
+			XHOST_CHECK(SentLog[Round % (NUM_BDS * 4U)] ==
+				    (u32)(UINTPTR)&Buffers[(Round % NUM_BDS) *
+							   BUF_SIZE],
+				    "TX BD %u sent out of order",
+				    (unsigned)Round);
+		}
+	}
+	XHOST_CHECK(RingPtr->FreeCnt == NUM_BDS, "%d BDs free",
+		    RingPtr->FreeCnt);
+}
+
+/*****************************************************************************/
+/*
+* Errors of the burst submission: none may consume a BD or write the tail.
+*/
+static void RunErrors(void)
+{
+	XAxiDma_BdRing *RingPtr = XAxiDma_GetTxRing(&AxiDma);
+	UINTPTR Addr[NUM_BDS + 1];
+	u32 Length[NUM_BDS + 1];
+	XAxiDma_Bd *BdPtr;
+	u32 Index;
+	u32 Tails = TailWrites[TX];
+	int Status;
+
+	for (Index = 0U; Index <= (u32)NUM_BDS; Index++) {
+		Addr[Index] = (UINTPTR)&Buffers[(Index % NUM_BDS) * BUF_SIZE];
+		Length[Index] = 128U;
+	}
+
+	Status = XAxiDma_BdRingSubmitBurst(RingPtr, NUM_BDS + 1, Addr, Length);
+	XHOST_CHECK(Status == XST_FAILURE, "burst over the ring: %d", Status);
+	Status = XAxiDma_BdRingSubmitBurst(RingPtr, 0, Addr, Length);
+	XHOST_CHECK(Status == XST_INVALID_PARAM, "empty burst: %d", Status);
+
+	Length[5] = 0U;
+	Status = XAxiDma_BdRingSubmitBurst(RingPtr, 8, Addr, Length);
+	XHOST_CHECK(Status == XST_INVALID_PARAM, "zero length: %d", Status);
+	Length[5] = 128U;
+
+	Addr[3] += 1U;
+	Status = XAxiDma_BdRingSubmitBurst(RingPtr, 8, Addr, Length);
+	XHOST_CHECK(Status == XST_INVALID_PARAM, "unaligned buffer: %d",
+		    Status);
+	Addr[3] -= 1U;
+
+	Status = XAxiDma_BdRingAlloc(RingPtr, 2, &BdPtr);
+	XHOST_CHECK(Status == XST_SUCCESS, "alloc %d", Status);
+	Status = XAxiDma_BdRingSubmitBurst(RingPtr, 4, Addr, Length);
+	XHOST_CHECK(Status == XST_DMA_SG_LIST_ERROR, "pending alloc: %d",
+		    Status);
+	(void)XAxiDma_BdRingUnAlloc(RingPtr, 2, BdPtr);
+
+	XHOST_CHECK((RingPtr->FreeCnt == NUM_BDS) && (RingPtr->PreCnt == 0) &&
+		    (TailWrites[TX] == Tails),
+		    "errors left %d BDs free, %d pending, %u tail writes",
+		    RingPtr->FreeCnt, RingPtr->PreCnt,
+		    (unsigned)(TailWrites[TX] - Tails));
+
+	/* The ring still works */
+	SentCount = 0U;
+	Status = XAxiDma_BdRingSubmitBurst(RingPtr, 8, Addr, Length);
+	XHOST_CHECK(Status == XST_SUCCESS, "burst after errors: %d", Status);
+	XHOST_CHECK((ModelRun(TX, NUM_BDS) == 8U) &&
+		    (XAxiDma_BdRingReapBurst(RingPtr, NUM_BDS, NULL, NULL) == 8),
+		    "burst after errors not completed");
+}
+
+/*****************************************************************************/
+/*
+* Host time per packet of BENCH_BURST packet bursts, with the per BD calls
+* and with the burst calls. Only the driver calls are timed.
+*/
+static void Bench(void)
+{
+	XAxiDma_BdRing *RingPtr;
+	UINTPTR Addr[BENCH_BURST];
+	u32 Length[BENCH_BURST];
+	UINTPTR Ids[BENCH_BURST];
+	XAxiDma_Bd *BdSetPtr;
+	XAxiDma_Bd *BdPtr;
+	u64 Ns[2] = { 0U, 0U };
+	u32 Flushes[2];
+	u32 Invalidates[2];
+	u32 Tails[2];
+	u64 StartNs;
+	u32 Round;
+	u32 Mode;
+	int Index;
+	int Got;
+
+	for (Index = 0; Index < BENCH_BURST; Index++) {
+		Addr[Index] = (UINTPTR)&Buffers[(u32)Index * BUF_SIZE];
+		Length[Index] = 1500U;
+	}
+	for (Mode = 0U; Mode < 2U; Mode++) {
+		Setup(BENCH_RING);
+		RingPtr = XAxiDma_GetTxRing(&AxiDma);
+		Flushes[Mode] = XHostModel_FlushCount;
+		Invalidates[Mode] = XHostModel_InvalidateCount;
+		Tails[Mode] = TailWrites[TX];
+		for (Round = 0U; Round < BENCH_ROUNDS; Round++) {
+			StartNs = XHostModel_TimeNs();
+			if (Mode == 0U) {
+				(void)XAxiDma_BdRingAlloc(RingPtr, BENCH_BURST,
+							  &BdSetPtr);
+				BdPtr = BdSetPtr;
+				for (Index = 0; Index < BENCH_BURST; Index++) {
+					(void)XAxiDma_BdSetBufAddr(BdPtr,
+								   Addr[Index]);
+					(void)XAxiDma_BdSetLength(BdPtr,
+						Length[Index],
+						RingPtr->MaxTransferLen);
+					XAxiDma_BdSetCtrl(BdPtr,
+						XAXIDMA_BD_CTRL_TXSOF_MASK |
+						XAXIDMA_BD_CTRL_TXEOF_MASK);
+					XAxiDma_BdSetId(BdPtr, Addr[Index]);
+					BdPtr = (XAxiDma_Bd *)
+						XAxiDma_BdRingNext(RingPtr,
+								   BdPtr);
+				}
+				(void)XAxiDma_BdRingToHw(RingPtr, BENCH_BURST,
+							 BdSetPtr);
+			} else {
+				(void)XAxiDma_BdRingSubmitBurst(RingPtr,
+								BENCH_BURST,
+								Addr, Length);
+			}
+			Ns[Mode] += XHostModel_TimeNs() - StartNs;
+
+			(void)ModelRun(TX, BENCH_BURST);
+
+			StartNs = XHostModel_TimeNs();
+			if (Mode == 0U) {
+				Got = XAxiDma_BdRingFromHw(RingPtr,
+							   XAXIDMA_ALL_BDS,
+							   &BdSetPtr);
+				BdPtr = BdSetPtr;
+				for (Index = 0; Index < Got; Index++) {
+					Ids[Index] = XAxiDma_BdGetId(BdPtr);
+					BdPtr = (XAxiDma_Bd *)
+						XAxiDma_BdRingNext(RingPtr,
+								   BdPtr);
+				}
+				(void)XAxiDma_BdRingFree(RingPtr, Got,
+							 BdSetPtr);
+			} else {
+				Got = XAxiDma_BdRingReapBurst(RingPtr,
+							      BENCH_BURST,
+							      Ids, NULL);
+			}
+			Ns[Mode] += XHostModel_TimeNs() - StartNs;
+			XHOST_CHECK(Got == BENCH_BURST, "round %u reaped %d",
+				    (unsigned)Round, Got);
+		}
+		Flushes[Mode] = XHostModel_FlushCount - Flushes[Mode];
+		Invalidates[Mode] = XHostModel_InvalidateCount -
+				    Invalidates[Mode];
+		Tails[Mode] = TailWrites[TX] - Tails[Mode];
+	}
+
+	printf("%u bursts of %d packets  ns/packet  flushes  invalidates  "
+	       "tail writes per burst\n", (unsigned)BENCH_ROUNDS, BENCH_BURST);
+	for (Mode = 0U; Mode < 2U; Mode++) {
+		printf("%-24s %10.1f %8.2f %12.2f %12.2f\n",
+		       (Mode == 0U) ? "per BD calls" : "burst calls",
+		       (double)Ns[Mode] / (double)(BENCH_ROUNDS * BENCH_BURST),
+		       (double)Flushes[Mode] / (double)BENCH_ROUNDS,
+		       (double)Invalidates[Mode] / (double)BENCH_ROUNDS,
+		       (double)Tails[Mode] / (double)BENCH_ROUNDS);
+	}
+}
+
+int main(void)
+{
+	u32 Ch;
+
+	for (Ch = TX; Ch <= RX; Ch++) {
+		BdMem[Ch] = mmap(NULL, BENCH_RING * sizeof(XAxiDma_Bd),
+				 PROT_READ | PROT_WRITE,
+				 MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT,
+				 -1, 0);
+	}
+	Buffers = mmap(NULL, NUM_BDS * BUF_SIZE, PROT_READ | PROT_WRITE,
+		       MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+	XHOST_CHECK((BdMem[TX] != MAP_FAILED) && (BdMem[RX] != MAP_FAILED) &&
+		    (Buffers != MAP_FAILED) &&
+		    ((u64)(UINTPTR)Buffers < 0x100000000ULL),
+		    "no memory below 4 GB");
+	if (XHostModel_Failures != 0U) {
+		return XHostModel_Report("xaxidma_burst_model_test");
+	}
+
+	Setup(NUM_BDS);
+	RunBursts(TX);
+	RunBursts(RX);
+	RunErrors();
+	Bench();
+
+	return XHostModel_Report("xaxidma_burst_model_test");
+}
@@ -177,6 +177,14 @@
 *   and no new packets to process. Note that the interrupt will only fire if
 *   at least one packet has been processed.
 *
+* Both can be set with XAxiDma_BdRingSetCoalesce(), or tuned at run time by
+* the driver after XAxiDma_BdRingSetAdaptiveCoalesce() enables the adaptive
+* mode. In adaptive mode the interrupt handler passes the channel interrupt
+* status to XAxiDma_BdRingAdaptCoalesce(). The threshold is raised while the
+* interrupts are mostly raised by the threshold, and lowered while they are
+* mostly raised by the delay timer. XAxiDma_BdRingGetCoalesceStats() returns
+* the current setting and the interrupt and BD counts of the channel.
+*
 * <b> Interrupt </b>
 *
 * Interrupts are handled by the user application. Each DMA channel has its own
@@ -256,6 +264,16 @@
 *   to receive data at any time. Otherwise, the RX channel refuses to
 *   accept any data if it has no RX BDs.
 *
+* <b> Burst Submission and Reaping </b>
+*
+* XAxiDma_BdRingSubmitBurst() allocates, fills and submits BDs for an array
+* of buffers in one call. Each buffer is a complete packet on the TX side.
+* The BDs are flushed with a single cache range operation and the tail
+* descriptor register is written once. XAxiDma_BdRingReapBurst() retrieves
+* the completed BDs, returns the buffer address and transferred length of
+* each of them, and frees the BDs. The two calls cannot be mixed with
+* BDs still pending from XAxiDma_BdRingAlloc().
+*
 * <b> Examples </b>
 *
 * We provide five examples to show how to use the driver API:
@@ -456,6 +474,8 @@
 * 9.15  sa   08/12/22 Updated the examples to use latest MIG cannoical define
 * 		       i.e XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR.
 *      adk   08/16/22 Fix syntax error in the XAxiDma_BdRingGetCurrBd() API.
+* 9.18 kt    10/18/26 Added burst BD submit and reap APIs.
+*                     Added adaptive interrupt coalescing.
 * </pre>
 *
 ******************************************************************************/
@@ -45,6 +45,11 @@
 *       rsp  01/17/18  Use virtual address for register read/write.
 *                      In _BdRingCreate() assign VA to BdaRestart CR#976392
 * 9.9   rsp  02/05/19  Fix XAxiDma_BdRingFromHw implementation for cyclic mode.
+* 9.18  kt   10/18/26  Flush the BD set with one range operation in
+*		       XAxiDma_BdRingToHw and invalidate BDs in windows in
+*		       XAxiDma_BdRingFromHw. Added XAxiDma_BdRingSubmitBurst
+*		       and XAxiDma_BdRingReapBurst.
+*		       Added adaptive interrupt coalescing.
 *
 * </pre>
 ******************************************************************************/
@@ -60,6 +65,9 @@
  */
 #define XAXIDMA_STOP_TIMEOUT	500000   /* about 100 milliseconds on 100MHz */
 
+/* Number of BDs invalidated at once while looking for completed BDs */
+#define XAXIDMA_SCAN_WINDOW	8
+
 /**************************** Type Definitions *******************************/
 
 
@@ -142,10 +150,29 @@
 		(BdPtr) = (XAxiDma_Bd*)Addr;                                  \
 	}
 
+#ifdef __aarch64__
+#define XAxiDma_BdRingCacheRange(RingPtr, BdPtr, NumBd, Flush)
+#endif
+
 /************************** Function Prototypes ******************************/
 
+#ifndef __aarch64__
+static void XAxiDma_BdRingCacheRange(XAxiDma_BdRing *RingPtr,
+				     XAxiDma_Bd *BdPtr, int NumBd, int Flush);
+#endif
+
 /************************** Variable Definitions *****************************/
 
+/* Coalescing profiles used by the adaptive mode, as {Counter, Timer} pairs.
+ * Profile 0 gives the lowest latency, the delay timer grows with the
+ * threshold so the latency stays bounded when the traffic slows down.
+ */
+static const u8 XAxiDma_CoalesceProfile[][2] = {
+	{1, 0}, {2, 1}, {4, 2}, {8, 4}, {16, 8}, {32, 16}, {64, 32}
+};
+
+#define XAXIDMA_COALESCE_LEVELS \
+	((int)(sizeof(XAxiDma_CoalesceProfile) / sizeof(XAxiDma_CoalesceProfile[0])))
 
 /*****************************************************************************/
 /**
@@ -746,6 +773,180 @@ void XAxiDma_BdRingGetCoalesce(XAxiDma_BdRing *RingPtr,
 	*TimerPtr = ((Cr & XAXIDMA_DELAY_MASK) >> XAXIDMA_DELAY_SHIFT);
 }
 
+/*****************************************************************************/
+/**
+ * Enable or disable adaptive interrupt coalescing for the given descriptor
+ * ring channel. In adaptive mode the threshold and delay timer are tuned by
+ * XAxiDma_BdRingAdaptCoalesce() from the completion interrupts observed,
+ * in the style of dynamic interrupt moderation:
+ *
+ * - When most interrupts of a window are raised by the threshold, the
+ *   traffic fills the threshold before the delay timer expires, so a higher
+ *   threshold is selected to reduce the interrupt rate.
+ * - When most interrupts of a window are raised by the delay timer, the
+ *   traffic is too sparse for the threshold, so a lower threshold and delay
+ *   are selected to reduce the latency.
+ *
+ * Enabling the mode starts from the lowest latency profile and clears the
+ * statistics. Disabling it keeps the current setting.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	Enable is non-zero to enable and zero to disable adaptive
+ *		coalescing.
+ *
+ * @return
+ *		- XST_SUCCESS if the mode has been changed
+ *		- XST_FAILURE if the coalescing setting could not be applied
+ *
+ * @note	The delay interrupt must be enabled along with the completion
+ *		interrupt for the adaptive mode to lower the setting.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSetAdaptiveCoalesce(XAxiDma_BdRing *RingPtr, int Enable)
+{
+	XAxiDma_Coalesce *CoalescePtr = &RingPtr->Coalesce;
+
+	if (!Enable) {
+		CoalescePtr->Enabled = 0;
+		return XST_SUCCESS;
+	}
+
+	memset(CoalescePtr, 0, sizeof(XAxiDma_Coalesce));
+	CoalescePtr->Enabled = 1;
+
+	return XAxiDma_BdRingSetCoalesce(RingPtr,
+					 XAxiDma_CoalesceProfile[0][0],
+					 XAxiDma_CoalesceProfile[0][1]);
+}
+
+/*****************************************************************************/
+/**
+ * Account a completion interrupt of the given descriptor ring channel in the
+ * coalescing statistics and, when the adaptive mode is enabled, retune the
+ * coalescing setting at the end of each XAXIDMA_COALESCE_WINDOW interrupts.
+ *
+ * The application calls this function from its interrupt handler with the
+ * status read by XAxiDma_BdRingGetIrq(), after XAxiDma_BdRingFromHw() has
+ * retrieved the BDs completed by that interrupt.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	IrqStatus is the pending interrupt mask of the channel.
+ *
+ * @return	None
+ *
+ * @note	This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+void XAxiDma_BdRingAdaptCoalesce(XAxiDma_BdRing *RingPtr, u32 IrqStatus)
+{
+	XAxiDma_Coalesce *CoalescePtr = &RingPtr->Coalesce;
+	int Level;
+
+	if (!(IrqStatus & (XAXIDMA_IRQ_IOC_MASK | XAXIDMA_IRQ_DELAY_MASK))) {
+		return;
+	}
+
+	CoalescePtr->Stats.IrqCount++;
+	CoalescePtr->WinIrqCount++;
+
+	if (IrqStatus & XAXIDMA_IRQ_IOC_MASK) {
+		CoalescePtr->Stats.IocIrqCount++;
+		CoalescePtr->WinIocCount++;
+	}
+
+	if (IrqStatus & XAXIDMA_IRQ_DELAY_MASK) {
+		CoalescePtr->Stats.DelayIrqCount++;
+		CoalescePtr->WinDelayCount++;
+	}
+
+	if (!CoalescePtr->Enabled ||
+	    (CoalescePtr->WinIrqCount < XAXIDMA_COALESCE_WINDOW)) {
+		return;
+	}
+
+	Level = CoalescePtr->Level;
+
+	if ((CoalescePtr->WinDelayCount * 2) > XAXIDMA_COALESCE_WINDOW) {
+		/* Sparse traffic, favor latency */
+		if (Level > 0) {
+			Level--;
+		}
+	} else if (((CoalescePtr->WinIocCount * 4) >=
+		    (XAXIDMA_COALESCE_WINDOW * 3)) &&
+		   ((Level > 0) ||
+		    ((CoalescePtr->Stats.BdCount - CoalescePtr->WinBdStart) >=
+		     (2 * XAXIDMA_COALESCE_WINDOW)))) {
+		/* Bursty traffic, favor interrupt load. Profile 0 interrupts
+		 * on every BD, so leave it only when the interrupts find at
+		 * least two BDs completed on average.
+		 */
+		if (Level < (XAXIDMA_COALESCE_LEVELS - 1)) {
+			Level++;
+		}
+	}
+
+	if (Level != CoalescePtr->Level) {
+		if (XAxiDma_BdRingSetCoalesce(RingPtr,
+					      XAxiDma_CoalesceProfile[Level][0],
+					      XAxiDma_CoalesceProfile[Level][1]) ==
+		    XST_SUCCESS) {
+			CoalescePtr->Level = Level;
+			CoalescePtr->Stats.Changes++;
+		}
+	}
+
+	CoalescePtr->WinIrqCount = 0;
+	CoalescePtr->WinIocCount = 0;
+	CoalescePtr->WinDelayCount = 0;
+	CoalescePtr->WinBdStart = CoalescePtr->Stats.BdCount;
+}
+
+/*****************************************************************************/
+/**
+ * Retrieve the interrupt coalescing statistics of the given descriptor ring
+ * channel, along with the current threshold and delay timer.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	StatsPtr points to a memory location where the statistics
+ *		will be written.
+ *
+ * @return	None
+ *
+ * @note	This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+void XAxiDma_BdRingGetCoalesceStats(XAxiDma_BdRing *RingPtr,
+				    XAxiDma_CoalesceStats *StatsPtr)
+{
+	*StatsPtr = RingPtr->Coalesce.Stats;
+	XAxiDma_BdRingGetCoalesce(RingPtr, &StatsPtr->Counter,
+				  &StatsPtr->Timer);
+}
+
+/*****************************************************************************/
+/**
+ * Clear the interrupt coalescing statistics of the given descriptor ring
+ * channel.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ *
+ * @return	None
+ *
+ * @note	This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+void XAxiDma_BdRingResetCoalesceStats(XAxiDma_BdRing *RingPtr)
+{
+	memset(&RingPtr->Coalesce.Stats, 0, sizeof(XAxiDma_CoalesceStats));
+	RingPtr->Coalesce.WinBdStart = 0;
+}
+
 /*****************************************************************************/
 /**
  * Reserve locations in the BD ring. The set of returned BDs may be modified in
@@ -1049,9 +1250,6 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing *RingPtr, int NumBd,
 		BdSts &=  ~XAXIDMA_BD_STS_COMPLETE_MASK;
 		XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, BdSts);
 
-		/* Flush the current BD so DMA core could see the updates */
-		XAXIDMA_CACHE_FLUSH(CurBdPtr);
-
 		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, CurBdPtr));
 		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
 		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
@@ -1080,8 +1278,8 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing *RingPtr, int NumBd,
 	BdSts &= ~XAXIDMA_BD_STS_COMPLETE_MASK;
 	XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, BdSts);
 
-	/* Flush the last BD so DMA core could see the updates */
-	XAXIDMA_CACHE_FLUSH(CurBdPtr);
+	/* Flush the whole set so DMA core could see the updates */
+	XAxiDma_BdRingCacheRange(RingPtr, BdSetPtr, NumBd, 1);
 
         #if !defined (__riscv)
 	    DATA_SYNC;
@@ -1216,12 +1414,14 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing *RingPtr, int BdLimit,
 	XAxiDma_Bd *CurBdPtr;
 	int BdCount;
 	int BdPartialCount;
+	int BdWindow;
 	u32 BdSts;
 	u32 BdCr;
 
 	CurBdPtr = RingPtr->HwHead;
 	BdCount = 0;
 	BdPartialCount = 0;
+	BdWindow = 0;
 	BdSts = 0;
 	BdCr = 0;
 
@@ -1245,8 +1445,19 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing *RingPtr, int BdLimit,
 	 */
 
 	while (BdCount < BdLimit) {
+		/* Invalidate the next window of BDs with one range operation
+		 * instead of one operation per BD
+		 */
+		if (BdWindow == 0) {
+			BdWindow = BdLimit - BdCount;
+			if (BdWindow > XAXIDMA_SCAN_WINDOW) {
+				BdWindow = XAXIDMA_SCAN_WINDOW;
+			}
+			XAxiDma_BdRingCacheRange(RingPtr, CurBdPtr, BdWindow, 0);
+		}
+		BdWindow--;
+
 		/* Read the status */
-		XAXIDMA_CACHE_INVALIDATE(CurBdPtr);
 		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
 		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
 
@@ -1299,6 +1510,7 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing *RingPtr, int BdLimit,
 	 */
 	if (BdCount) {
 		*BdSetPtr = RingPtr->HwHead;
+		RingPtr->Coalesce.Stats.BdCount += BdCount;
 		if (!RingPtr->Cyclic) {
 			RingPtr->HwCnt -= BdCount;
 			RingPtr->PostCnt += BdCount;
@@ -1373,6 +1585,168 @@ int XAxiDma_BdRingFree(XAxiDma_BdRing *RingPtr, int NumBd,
 	return XST_SUCCESS;
 }
 /*****************************************************************************/
+/**
+ * Allocate, fill and enqueue a burst of BDs to hardware with one call. BD i
+ * of the burst is set up with buffer BufAddr[i] and length Length[i]. The
+ * BDs are contiguous in the ring, so the whole burst is flushed with one
+ * cache range operation (two if it wraps around the end of the ring) and the
+ * tail descriptor register is written once.
+ *
+ * For a transmit channel every buffer is sent as a complete packet, the
+ * start-of-frame and end-of-frame bits are set in each BD. The ID of each BD
+ * is set to its buffer address so XAxiDma_BdRingReapBurst() can return it.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	NumBd is the number of BDs in the burst.
+ * @param	BufAddr is an array of NumBd buffer addresses.
+ * @param	Length is an array of NumBd buffer lengths in bytes.
+ *
+ * @return
+ *		- XST_SUCCESS if the burst was enqueued to hardware
+ *		- XST_INVALID_PARAM if NumBd is not positive, or a buffer
+ *		address or length is not valid for the channel
+ *		- XST_FAILURE if there are not enough free BDs in the ring
+ *		- XST_DMA_SG_LIST_ERROR if BDs allocated with
+ *		XAxiDma_BdRingAlloc() are still waiting to be enqueued
+ *
+ * @note	No BD is consumed when an error is returned.
+ *
+ *		This function should not be preempted by another XAxiDma ring
+ *		function call that modifies the BD space. It is the caller's
+ *		responsibility to provide a mutual exclusion mechanism.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSubmitBurst(XAxiDma_BdRing *RingPtr, int NumBd,
+			      const UINTPTR *BufAddr, const u32 *Length)
+{
+	XAxiDma_Bd *BdSetPtr;
+	XAxiDma_Bd *CurBdPtr;
+	u32 BdCtrl;
+	int Status;
+	int i;
+
+	if (NumBd <= 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "SubmitBurst: non-positive BD "
+			    "number %d\r\n", NumBd);
+
+		return XST_INVALID_PARAM;
+	}
+
+	/* The burst must directly follow the BDs already given to hardware */
+	if (RingPtr->PreCnt != 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "SubmitBurst: %d BDs are pending"
+			    " in the pre-work group\r\n", RingPtr->PreCnt);
+
+		return XST_DMA_SG_LIST_ERROR;
+	}
+
+	Status = XAxiDma_BdRingAlloc(RingPtr, NumBd, &BdSetPtr);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	BdCtrl = RingPtr->IsRxChannel ? 0 :
+		 (XAXIDMA_BD_CTRL_TXSOF_MASK | XAXIDMA_BD_CTRL_TXEOF_MASK);
+
+	CurBdPtr = BdSetPtr;
+	for (i = 0; i < NumBd; i++) {
+		Status = XAxiDma_BdSetBufAddr(CurBdPtr, BufAddr[i]);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+
+		Status = XAxiDma_BdSetLength(CurBdPtr, Length[i],
+					     RingPtr->MaxTransferLen);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+
+		XAxiDma_BdSetCtrl(CurBdPtr, BdCtrl);
+		XAxiDma_BdSetId(CurBdPtr, BufAddr[i]);
+
+		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, CurBdPtr));
+	}
+
+	if (Status == XST_SUCCESS) {
+		Status = XAxiDma_BdRingToHw(RingPtr, NumBd, BdSetPtr);
+	}
+
+	if (Status != XST_SUCCESS) {
+		(void)XAxiDma_BdRingUnAlloc(RingPtr, NumBd, BdSetPtr);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * Retrieve up to BdLimit BDs completed by hardware, report their IDs and
+ * transferred lengths, and return them to the free group with one call.
+ * This is the counterpart of XAxiDma_BdRingSubmitBurst(), for which the ID
+ * of a BD is its buffer address.
+ *
+ * The completed BDs are found with XAxiDma_BdRingFromHw(), which
+ * invalidates the BDs it examines XAXIDMA_SCAN_WINDOW BDs at a time.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	BdLimit is the maximum number of BDs to reap, and the number of
+ *		entries in the IdArray and LenArray arrays.
+ * @param	IdArray is an output array receiving the ID of each reaped BD.
+ *		It can be NULL.
+ * @param	LenArray is an output array receiving the number of bytes
+ *		transferred by each reaped BD. It can be NULL.
+ *
+ * @return	The number of BDs reaped. A value of 0 indicates that no BD
+ *		has been completed by hardware.
+ *
+ * @note	In cyclic mode the BDs stay with hardware and are not freed.
+ *
+ *		This function should not be preempted by another XAxiDma ring
+ *		function call that modifies the BD space. It is the caller's
+ *		responsibility to provide a mutual exclusion mechanism.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingReapBurst(XAxiDma_BdRing *RingPtr, int BdLimit,
+			    UINTPTR *IdArray, u32 *LenArray)
+{
+	XAxiDma_Bd *BdSetPtr;
+	XAxiDma_Bd *CurBdPtr;
+	int NumBd;
+	int i;
+
+	NumBd = XAxiDma_BdRingFromHw(RingPtr, BdLimit, &BdSetPtr);
+	if (NumBd == 0) {
+		return 0;
+	}
+
+	CurBdPtr = BdSetPtr;
+	for (i = 0; i < NumBd; i++) {
+		if (IdArray != NULL) {
+			IdArray[i] = (UINTPTR)XAxiDma_BdGetId(CurBdPtr);
+		}
+		if (LenArray != NULL) {
+			LenArray[i] = XAxiDma_BdGetActualLength(CurBdPtr,
+					RingPtr->MaxTransferLen);
+		}
+
+		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, CurBdPtr));
+	}
+
+	if (!RingPtr->Cyclic) {
+		(void)XAxiDma_BdRingFree(RingPtr, NumBd, BdSetPtr);
+	}
+
+	return NumBd;
+}
+/*****************************************************************************/
 /**
  * Check the internal data structures of the BD ring for the provided channel.
  * The following checks are made:
@@ -1583,4 +1957,49 @@ void XAxiDma_BdRingDumpRegs(XAxiDma_BdRing *RingPtr)
 
 	xil_printf("\r\n");
 }
+
+/*****************************************************************************/
+/*
+ * Flush or invalidate NumBd consecutive BDs starting at BdPtr. The BDs of a
+ * ring are contiguous, so this is one cache range operation, or two when the
+ * set wraps around the end of the ring.
+ *
+ * @param	RingPtr is the ring BdPtr appears in
+ * @param	BdPtr is the first BD of the set
+ * @param	NumBd is the number of BDs in the set
+ * @param	Flush is non-zero to flush the BDs and zero to invalidate them
+ *
+ * @returns	None
+ *
+ * @note	This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+#ifndef __aarch64__
+static void XAxiDma_BdRingCacheRange(XAxiDma_BdRing *RingPtr,
+				     XAxiDma_Bd *BdPtr, int NumBd, int Flush)
+{
+	UINTPTR Start = (UINTPTR)(void *)BdPtr;
+	UINTPTR End = RingPtr->LastBdAddr + RingPtr->Separation;
+	UINTPTR Len = RingPtr->Separation * (UINTPTR)NumBd;
+	UINTPTR WrapLen = 0;
+
+	if (Len > (End - Start)) {
+		WrapLen = Len - (End - Start);
+		Len = End - Start;
+	}
+
+	if (Flush) {
+		Xil_DCacheFlushRange(Start, Len);
+		if (WrapLen) {
+			Xil_DCacheFlushRange(RingPtr->FirstBdAddr, WrapLen);
+		}
+	} else {
+		Xil_DCacheInvalidateRange(Start, Len);
+		if (WrapLen) {
+			Xil_DCacheInvalidateRange(RingPtr->FirstBdAddr,
+						  WrapLen);
+		}
+	}
+}
+#endif
 /** @} */
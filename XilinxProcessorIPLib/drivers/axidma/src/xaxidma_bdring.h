@@ -45,6 +45,10 @@
 * 9.2   vak  15/04/16  Fixed the compilation warnings in axidma driver
 * 9.7   rsp  01/11/18  Use UINTPTR instead of u32 for ChanBase CR#976392
 * 9.15  adk  08/16/22  Fix syntax error in the XAxiDma_BdRingGetCurrBd() API.
+* 9.18  kt   10/18/26  Added XAxiDma_BdRingSubmitBurst() and
+*		       XAxiDma_BdRingReapBurst() APIs.
+*		       Added adaptive interrupt coalescing and coalescing
+*		       statistics APIs.
 *
 * </pre>
 *
@@ -74,8 +78,39 @@ extern "C" {
 #define XAXIDMA_NO_CHANGE		0xFFFFFFFF
 #define XAXIDMA_ALL_BDS			0x0FFFFFFF /* 268 Million */
 
+/* Number of completion interrupts between two adaptive coalescing decisions
+ */
+#define XAXIDMA_COALESCE_WINDOW		16
+
 /**************************** Type Definitions *******************************/
 
+/** Interrupt coalescing statistics of a channel, see
+ * XAxiDma_BdRingGetCoalesceStats(). The interrupt rate is IrqCount over the
+ * time since the last XAxiDma_BdRingResetCoalesceStats() call, and BdCount
+ * over IrqCount gives the average number of BDs handled per interrupt.
+ */
+typedef struct {
+	u32 Counter;		/**< Current coalescing threshold */
+	u32 Timer;		/**< Current delay timer */
+	u32 IrqCount;		/**< Number of completion interrupts */
+	u32 IocIrqCount;	/**< Interrupts raised by the threshold */
+	u32 DelayIrqCount;	/**< Interrupts raised by the delay timer */
+	u32 BdCount;		/**< Number of BDs completed */
+	u32 Changes;		/**< Number of adaptive setting changes */
+} XAxiDma_CoalesceStats;
+
+/** Adaptive interrupt coalescing state of a channel
+ */
+typedef struct {
+	int Enabled;		/**< Adaptive coalescing is enabled */
+	int Level;		/**< Current coalescing profile */
+	u32 WinIrqCount;	/**< Interrupts in the current window */
+	u32 WinIocCount;	/**< Threshold interrupts in the window */
+	u32 WinDelayCount;	/**< Delay interrupts in the window */
+	u32 WinBdStart;		/**< BdCount at the start of the window */
+	XAxiDma_CoalesceStats Stats;	/**< Statistics */
+} XAxiDma_Coalesce;
+
 /** Container structure for descriptor storage control. If address translation
  * is enabled, then all addresses and pointers excluding FirstBdPhysAddr are
  * expressed in terms of the virtual address.
@@ -111,6 +146,7 @@ typedef struct {
 	int AllCnt;		/**< Total Number of BDs for channel */
 	int RingIndex;		/**< Ring Index */
 	int Cyclic;		/**< Check for cyclic DMA Mode */
+	XAxiDma_Coalesce Coalesce;	/**< Adaptive interrupt coalescing */
 } XAxiDma_BdRing;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -540,10 +576,19 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing *RingPtr, int BdLimit,
 			 XAxiDma_Bd **BdSetPtr);
 int XAxiDma_BdRingFree(XAxiDma_BdRing *RingPtr, int NumBd,
 		       XAxiDma_Bd *BdSetPtr);
+int XAxiDma_BdRingSubmitBurst(XAxiDma_BdRing *RingPtr, int NumBd,
+			      const UINTPTR *BufAddr, const u32 *Length);
+int XAxiDma_BdRingReapBurst(XAxiDma_BdRing *RingPtr, int BdLimit,
+			    UINTPTR *IdArray, u32 *LenArray);
 int XAxiDma_BdRingStart(XAxiDma_BdRing *RingPtr);
 int XAxiDma_BdRingSetCoalesce(XAxiDma_BdRing *RingPtr, u32 Counter, u32 Timer);
 void XAxiDma_BdRingGetCoalesce(XAxiDma_BdRing *RingPtr,
 			       u32 *CounterPtr, u32 *TimerPtr);
+int XAxiDma_BdRingSetAdaptiveCoalesce(XAxiDma_BdRing *RingPtr, int Enable);
+void XAxiDma_BdRingAdaptCoalesce(XAxiDma_BdRing *RingPtr, u32 IrqStatus);
+void XAxiDma_BdRingGetCoalesceStats(XAxiDma_BdRing *RingPtr,
+				    XAxiDma_CoalesceStats *StatsPtr);
+void XAxiDma_BdRingResetCoalesceStats(XAxiDma_BdRing *RingPtr);
 
 /* The following functions are for debug only
  */
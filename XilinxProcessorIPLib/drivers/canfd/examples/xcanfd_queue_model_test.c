@@ -0,0 +1,446 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xcanfd_queue_model_test.c
+*
+* Host test of the CAN FD frame queues against a model of the TX buffers,
+* the two RX FIFOs and the bus. It is not a target example: it is built and
+* run with the other driver model tests by make -C scripts/host_model.
+*
+* Each step of the model is one frame time: the TX buffer with the lowest ID
+* competes with the frame of an external node, which has higher priority IDs
+* and takes its share of the bus first. The arbitration winner is received
+* into RX FIFO 0 or RX FIFO 1, by the low bit of its standard ID, with a
+* non-zero timestamp. The node sees its own frames as in loopback mode. The
+* interrupt handler runs once every ISR_PERIOD frame times.
+*
+* The test sends frames of all lengths with two IDs at several external
+* loads and checks that each frame is received once, with its data and its
+* timestamp, in queue order per ID, and that the RX FIFOs never overflow.
+* The same traffic is then handled with one XCanFd_Send() and one
+* XCanFd_Recv_Sequential() per interrupt, and the frames lost by both paths
+* and the register accesses per frame are printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 2.9   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xcanfd.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define MODEL_BASE		0x10000000U	/* Base address of the model */
+#define MODEL_FIFO_DEPTH	64U		/* Frames per RX FIFO */
+#define MODEL_TX_BUFS		32U		/* TX buffers of the core */
+#define ISR_PERIOD		40U		/* Frame times between interrupts */
+#define NUM_FRAMES		20000U		/* Own frames per run */
+#define OWN_ID			0x100U		/* Own frames use IDs 0x100/0x101 */
+#define EXT_ID			0x080U		/* External IDs 0x080/0x081 */
+#define EXT_TAG			0xE0000000U	/* First data word of ext frames */
+#define TX_RING_DEPTH		256U
+#define RX_RING_DEPTH		128U
+#define RECV_BATCH		64U
+
+/**************************** Type Definitions *******************************/
+
+typedef struct {
+	u32 Sent;		/* Own frames accepted by the driver */
+	u32 Received;		/* Own frames returned by the driver */
+	u32 ExtSent;		/* External frames put on the bus */
+	u32 ExtReceived;	/* External frames returned by the driver */
+	u32 Overflow;		/* Frames dropped by a full RX FIFO */
+	u64 RegAccess;		/* Register reads and writes */
+} RunStats;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define REG(Off)	Regs[(Off) / 4U]
+#define TXBUF_BASE(Buf)	(XCANFD_TXFIFO_0_BASE_ID_OFFSET + 			 ((Buf) * XCANFD_MAX_FRAME_SIZE))
+#define FIFO_BASE(Fifo)	((Fifo) != 0U ? \
+			 XCANFD_RXFIFO_1_BUFFER_0_BASE_ID_OFFSET : \
+			 XCANFD_RXFIFO_0_BASE_ID_OFFSET)
+
+/************************** Function Prototypes ******************************/
+
+static void ModelReset(void);
+static void ModelStep(u32 *ExtPending, u32 ExtSeq);
+static void MakeFrame(XCanFd_Frame *FramePtr, u32 Seq, u32 StdId);
+static void CheckFrame(const XCanFd_Frame *FramePtr, RunStats *StatsPtr);
+static void RunQueue(u32 ExtLoad, RunStats *StatsPtr);
+static void RunSingle(u32 ExtLoad, RunStats *StatsPtr);
+
+/************************** Variable Definitions *****************************/
+
+XCanFd_Config XCanFd_ConfigTable[1];
+
+static u32 Regs[0x8000U / 4U];
+static u32 Trr;
+static u32 ReadIndex[2];
+static u32 Fill[2];
+static u32 Overflow;
+static u32 TimeStamp;
+static u64 RegAccess;
+
+static u32 Seen[NUM_FRAMES];
+static s32 LastSeq[2];
+
+static XCanFd Can;
+static XCanFd_Queue Queue;
+static XCanFd_Frame TxRing[TX_RING_DEPTH];
+static XCanFd_Frame RxRing[RX_RING_DEPTH];
+static XCanFd_Frame Out[RECV_BATCH];
+
+/*****************************************************************************/
+/*
+* Register model. TRR requests are set by writes and cleared by the bus, the
+* FSR read indexes move on IRI writes and ICR clears ISR bits.
+*/
+u32 Xil_In32(UINTPTR Addr)
+{
+	u32 Off = (u32)(Addr - MODEL_BASE);
+
+	RegAccess++;
+	if (Off == XCANFD_TRR_OFFSET) {
+		return Trr;
+	}
+	if (Off == XCANFD_FSR_OFFSET) {
+		return (Fill[0] << 8U) | ReadIndex[0] |
+		       (Fill[1] << 24U) | (ReadIndex[1] << 16U);
+	}
+
+	return REG(Off);
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	u32 Off = (u32)(Addr - MODEL_BASE);
+	u32 Fifo;
+
+	RegAccess++;
+	if (Off == XCANFD_TRR_OFFSET) {
+		Trr |= Value;
+		return;
+	}
+	if (Off == XCANFD_FSR_OFFSET) {
+		for (Fifo = 0U; Fifo < 2U; Fifo++) {
+			if (((Value & (Fifo != 0U ? XCANFD_FSR_IRI_1_MASK :
+				       XCANFD_FSR_IRI_MASK)) != 0U) &&
+			    (Fill[Fifo] != 0U)) {
+				ReadIndex[Fifo] = (ReadIndex[Fifo] + 1U) %
+						  MODEL_FIFO_DEPTH;
+				Fill[Fifo]--;
+			}
+		}
+		return;
+	}
+	if (Off == XCANFD_ICR_OFFSET) {
+		REG(XCANFD_ISR_OFFSET) &= ~Value;
+		return;
+	}
+	REG(Off) = Value;
+}
+
+static void ModelReset(void)
+{
+	memset(Regs, 0, sizeof(Regs));
+	Trr = 0U;
+	ReadIndex[0] = ReadIndex[1] = 0U;
+	Fill[0] = Fill[1] = 0U;
+	Overflow = 0U;
+	TimeStamp = 0U;
+	RegAccess = 0U;
+	memset(Seen, 0, sizeof(Seen));
+	LastSeq[0] = LastSeq[1] = -1;
+
+	memset(&Can, 0, sizeof(Can));
+	Can.IsReady = XIL_COMPONENT_IS_READY;
+	Can.CanFdConfig.BaseAddress = MODEL_BASE;
+	Can.CanFdConfig.NumofTxBuf = MODEL_TX_BUFS;
+}
+
+/*****************************************************************************/
+/*
+* One frame time on the bus. The arbitration winner is stored into the RX
+* FIFO selected by its ID with a new timestamp, or dropped if it is full.
+*/
+static void ModelStep(u32 *ExtPending, u32 ExtSeq)
+{
+	u32 Frame[XCANFD_MAX_FRAME_SIZE / 4U];
+	u32 Best = MODEL_TX_BUFS;
+	u32 ExtId = XCanFd_CreateIdValue(EXT_ID | (ExtSeq & 1U), 0U, 0U, 0U, 0U);
+	u32 Buf;
+	u32 Fifo;
+	u32 Slot;
+	u32 Word;
+
+	TimeStamp = (TimeStamp % XCANFD_DLCR_TIMESTAMP_MASK) + 1U;
+	for (Buf = 0U; Buf < MODEL_TX_BUFS; Buf++) {
+		if (((Trr & (1U << Buf)) != 0U) &&
+		    ((Best == MODEL_TX_BUFS) ||
+		     (REG(TXBUF_BASE(Buf)) <
+		      REG(TXBUF_BASE(Best))))) {
+			Best = Buf;
+		}
+	}
+
+	if ((Best != MODEL_TX_BUFS) &&
+	    ((*ExtPending == 0U) || (REG(TXBUF_BASE(Best)) < ExtId))) {
+		for (Word = 0U; Word < (XCANFD_MAX_FRAME_SIZE / 4U); Word++) {
+			Frame[Word] = REG(TXBUF_BASE(Best) + (Word * 4U));
+		}
+		Trr &= ~(1U << Best);
+		REG(XCANFD_ISR_OFFSET) |= XCANFD_IXR_TXOK_MASK;
+	} else if (*ExtPending != 0U) {
+		memset(Frame, 0, sizeof(Frame));
+		Frame[0] = ExtId;
+		Frame[1] = XCanFd_CreateDlcValue(4U);
+		Frame[2] = Xil_EndianSwap32(EXT_TAG | ExtSeq);
+		*ExtPending = 0U;
+	} else {
+		return;
+	}
+
+	Fifo = (Frame[0] >> XCANFD_IDR_ID1_SHIFT) & 1U;
+	if (Fill[Fifo] == MODEL_FIFO_DEPTH) {
+		Overflow++;
+		return;
+	}
+	Slot = FIFO_BASE(Fifo) + (((ReadIndex[Fifo] + Fill[Fifo]) %
+				   MODEL_FIFO_DEPTH) * XCANFD_MAX_FRAME_SIZE);
+	for (Word = 0U; Word < (XCANFD_MAX_FRAME_SIZE / 4U); Word++) {
+		REG(Slot + (Word * 4U)) = Frame[Word];
+	}
+	REG(Slot + 4U) = (REG(Slot + 4U) & ~XCANFD_DLCR_TIMESTAMP_MASK) |
+			 TimeStamp;
+	Fill[Fifo]++;
+	REG(XCANFD_ISR_OFFSET) |= XCANFD_IXR_RXOK_MASK;
+}
+
+/*****************************************************************************/
+/*
+* Own frame Seq: every length from 1 to 64 bytes, CAN and CAN FD, with the
+* sequence number in the data words.
+*/
+static void MakeFrame(XCanFd_Frame *FramePtr, u32 Seq, u32 StdId)
+{
+	u32 Code = 1U + (Seq % 15U);
+	u32 Word;
+
+	memset(FramePtr, 0, sizeof(*FramePtr));
+	FramePtr->Id = XCanFd_CreateIdValue(StdId, 0U, 0U, 0U, 0U);
+	if ((Seq % 5U) == 0U) {
+		FramePtr->Dlc = XCanFd_CreateDlcValue((Code > 8U) ? 8U : Code);
+	} else {
+		FramePtr->Dlc = XCanFd_Create_CanFD_Dlc_BrsValue(Code);
+	}
+	for (Word = 0U; Word < XCANFD_QUEUE_DATA_WORDS; Word++) {
+		FramePtr->Data[Word] = (Seq * 100U) + Word;
+	}
+}
+
+static void CheckFrame(const XCanFd_Frame *FramePtr, RunStats *StatsPtr)
+{
+	u32 StdId = (FramePtr->Id & XCANFD_IDR_ID1_MASK) >> XCANFD_IDR_ID1_SHIFT;
+	u32 Len;
+	u32 Seq;
+	u32 Word;
+
+	XHOST_CHECK((FramePtr->Dlc & XCANFD_DLCR_TIMESTAMP_MASK) != 0U,
+		    "frame %08x without timestamp", (unsigned)FramePtr->Id);
+
+	if ((StdId & ~1U) == EXT_ID) {
+		XHOST_CHECK((FramePtr->Data[0] & 0xF0000000U) == EXT_TAG,
+			    "external frame data %08x",
+			    (unsigned)FramePtr->Data[0]);
+		StatsPtr->ExtReceived++;
+		return;
+	}
+
+	XHOST_CHECK((StdId & ~1U) == OWN_ID, "unexpected ID %03x",
+		    (unsigned)StdId);
+	Seq = FramePtr->Data[0] / 100U;
+	if (Seq >= NUM_FRAMES) {
+		XHOST_CHECK(0, "bad sequence %u", (unsigned)Seq);
+		return;
+	}
+
+	Len = (u32)XCanFd_GetDlc2len(FramePtr->Dlc & XCANFD_DLCR_DLC_MASK,
+				     FramePtr->Dlc & XCANFD_DLCR_EDL_MASK);
+	for (Word = 0U; (Word * 4U) < Len; Word++) {
+		XHOST_CHECK(FramePtr->Data[Word] == ((Seq * 100U) + Word),
+			    "frame %u word %u", (unsigned)Seq, (unsigned)Word);
+	}
+
+	/* Frames of one ID come out in the order they were queued */
+	XHOST_CHECK((s32)Seq > LastSeq[StdId & 1U], "frame %u after %d",
+		    (unsigned)Seq, (int)LastSeq[StdId & 1U]);
+	LastSeq[StdId & 1U] = (s32)Seq;
+	Seen[Seq]++;
+	StatsPtr->Received++;
+}
+
+/*****************************************************************************/
+/*
+* The application queues frames as long as the TX ring accepts them and
+* reads them back; the handler services both queues.
+*/
+static void RunQueue(u32 ExtLoad, RunStats *StatsPtr)
+{
+	XCanFd_Frame Frame;
+	u32 ExtCredit = 0U;
+	u32 ExtPending = 0U;
+	u32 Step;
+	u32 Count;
+	u32 Index;
+
+	ModelReset();
+	memset(StatsPtr, 0, sizeof(*StatsPtr));
+	XHOST_CHECK(XCanFd_QueueInitialize(&Queue, &Can, 0xFFFFFFFFU,
+					   TxRing, TX_RING_DEPTH, RxRing,
+					   RX_RING_DEPTH) == XST_SUCCESS,
+		    "queue init");
+
+	for (Step = 0U; (StatsPtr->Received < NUM_FRAMES) &&
+	     (Step < (20U * NUM_FRAMES)); Step++) {
+		while (StatsPtr->Sent < NUM_FRAMES) {
+			MakeFrame(&Frame, StatsPtr->Sent,
+				  OWN_ID | ((StatsPtr->Sent / 7U) & 1U));
+			if (XCanFd_QueueSend(&Queue, &Frame, 1U) != 1U) {
+				break;
+			}
+			StatsPtr->Sent++;
+		}
+
+		ExtCredit += ExtLoad;
+		if ((ExtPending == 0U) && (ExtCredit >= 100U)) {
+			ExtCredit -= 100U;
+			ExtPending = 1U;
+			StatsPtr->ExtSent++;
+		}
+		ModelStep(&ExtPending, StatsPtr->ExtSent);
+
+		if ((Step % ISR_PERIOD) == (ISR_PERIOD - 1U)) {
+			(void)XCanFd_QueueTxService(&Queue);
+			(void)XCanFd_QueueRxDrain(&Queue);
+		}
+
+		while ((Count = XCanFd_QueueRecv(&Queue, Out,
+						 RECV_BATCH)) != 0U) {
+			for (Index = 0U; Index < Count; Index++) {
+				CheckFrame(&Out[Index], StatsPtr);
+			}
+		}
+	}
+
+	StatsPtr->Overflow = Overflow;
+	StatsPtr->RegAccess = RegAccess;
+}
+
+/*****************************************************************************/
+/*
+* The same traffic with one send and one sequential receive per interrupt.
+*/
+static void RunSingle(u32 ExtLoad, RunStats *StatsPtr)
+{
+	XCanFd_Frame Frame;
+	u32 ExtCredit = 0U;
+	u32 ExtPending = 0U;
+	u32 Buffer;
+	u32 Step;
+
+	ModelReset();
+	memset(StatsPtr, 0, sizeof(*StatsPtr));
+
+	for (Step = 0U; Step < (NUM_FRAMES * 2U); Step++) {
+		ExtCredit += ExtLoad;
+		if ((ExtPending == 0U) && (ExtCredit >= 100U)) {
+			ExtCredit -= 100U;
+			ExtPending = 1U;
+			StatsPtr->ExtSent++;
+		}
+		ModelStep(&ExtPending, StatsPtr->ExtSent);
+
+		if ((Step % ISR_PERIOD) == (ISR_PERIOD - 1U)) {
+			if (StatsPtr->Sent < NUM_FRAMES) {
+				MakeFrame(&Frame, StatsPtr->Sent,
+					  OWN_ID | ((StatsPtr->Sent / 7U) & 1U));
+				if (XCanFd_Send(&Can, (u32 *)(void *)&Frame,
+						&Buffer) == XST_SUCCESS) {
+					StatsPtr->Sent++;
+				}
+			}
+			memset(&Frame, 0, sizeof(Frame));
+			if (XCanFd_Recv_Sequential(&Can,
+						   (u32 *)(void *)&Frame) ==
+			    XST_SUCCESS) {
+				CheckFrame(&Frame, StatsPtr);
+			}
+		}
+	}
+
+	StatsPtr->Overflow = Overflow;
+	StatsPtr->RegAccess = RegAccess;
+}
+
+int main(void)
+{
+	static const u32 Load[] = { 0U, 50U, 90U };
+	RunStats Batched;
+	RunStats Single;
+	u32 Index;
+	u32 Seq;
+
+	for (Index = 0U; Index < (sizeof(Load) / sizeof(Load[0])); Index++) {
+		RunQueue(Load[Index], &Batched);
+
+		XHOST_CHECK(Batched.Received == NUM_FRAMES,
+			    "load %u: %u/%u frames", (unsigned)Load[Index],
+			    (unsigned)Batched.Received, NUM_FRAMES);
+		for (Seq = 0U; Seq < NUM_FRAMES; Seq++) {
+			XHOST_CHECK(Seen[Seq] == 1U, "load %u: frame %u seen %u",
+				    (unsigned)Load[Index], (unsigned)Seq,
+				    (unsigned)Seen[Seq]);
+		}
+		XHOST_CHECK(Batched.Overflow == 0U, "load %u: %u overflows",
+			    (unsigned)Load[Index], (unsigned)Batched.Overflow);
+		XHOST_CHECK(Batched.ExtReceived == Batched.ExtSent,
+			    "load %u: %u/%u external frames",
+			    (unsigned)Load[Index],
+			    (unsigned)Batched.ExtReceived,
+			    (unsigned)Batched.ExtSent);
+		XHOST_CHECK(Queue.RxRingFull == 0U, "load %u: RX ring full",
+			    (unsigned)Load[Index]);
+
+		RunSingle(Load[Index], &Single);
+
+		printf("load %3u%%: queue %u frames, %u lost, %.1f reg/frame; "
+		       "single %u frames, %u lost, %.1f reg/frame\n",
+		       (unsigned)Load[Index],
+		       (unsigned)(Batched.Received + Batched.ExtReceived),
+		       (unsigned)Batched.Overflow,
+		       (double)Batched.RegAccess /
+		       (double)(Batched.Received + Batched.ExtReceived),
+		       (unsigned)(Single.Received + Single.ExtReceived),
+		       (unsigned)Single.Overflow,
+		       (Single.Received + Single.ExtReceived) != 0U ?
+		       (double)Single.RegAccess /
+		       (double)(Single.Received + Single.ExtReceived) : 0.0);
+	}
+
+	return XHostModel_Report("xcanfd_queue_model_test");
+}
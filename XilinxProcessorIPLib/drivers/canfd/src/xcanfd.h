@@ -260,6 +260,9 @@ exclusion
 * 2.8	ht   06/19/23 Added support for system device-tree flow.
 * 2.8	gm   06/22/23 Add XCanFd_stop to support release node.
 * 2.8	ht   07/18/23 Fixed GCC warnings.
+* 2.9	kt   10/18/26 Added TX and RX frame queues in xcanfd_queue.c, which
+*		      fill all free TX buffers and drain both RX FIFOs per
+*		      interrupt.
 * </pre>
 *
 ******************************************************************************/
@@ -320,6 +323,13 @@ extern "C" {
 #define XCANFD_RX_FIFO_1	         1 /**< Selection for RX Fifo 1 */
 /** @} */
 
+/** @name Frame queue
+ *  @{
+ */
+#define XCANFD_QUEUE_DATA_WORDS	((XCANFD_MAX_FRAME_SIZE / XCANFD_DW_BYTES) - 2U)
+					/**< Data words in a queued frame */
+/** @} */
+
 /** @name Callback identifiers used as parameters to XCanFd_SetHandler()
  *  @{
  */
@@ -430,6 +440,44 @@ typedef struct {
 
 } XCanFd;
 
+/*****************************************************************************/
+/**
+ * This typedef contains a CAN/CAN FD frame as it is stored in the driver
+ * queues. The layout is the same as the frame buffer used by XCanFd_Send()
+ * and XCanFd_Recv_Sequential(). For a received frame, the DLC word also
+ * holds the timestamp the core latched when the frame was received.
+ */
+typedef struct {
+	u32 Id;		/**< ID word */
+	u32 Dlc;	/**< DLC word, with the timestamp for received frames */
+	u32 Data[XCANFD_QUEUE_DATA_WORDS]; /**< Data words */
+} XCanFd_Frame;
+
+/*****************************************************************************/
+/**
+ * The XCanFd frame queue data. The TX ring is filled by the application and
+ * emptied into the TX buffers by XCanFd_QueueTxService(). The RX ring is
+ * filled from the RX FIFOs by XCanFd_QueueRxDrain() and emptied by the
+ * application. The rings are provided by the user, each has a power of two
+ * number of frames.
+ */
+typedef struct {
+	XCanFd *InstancePtr;	/**< CAN instance the queue is attached to */
+	XCanFd_Frame *TxRing;	/**< TX frame ring */
+	XCanFd_Frame *RxRing;	/**< RX frame ring */
+	u32 TxDepth;		/**< Number of frames in the TX ring */
+	u32 RxDepth;		/**< Number of frames in the RX ring */
+	volatile u32 TxHead;	/**< TX ring write index, free running */
+	volatile u32 TxTail;	/**< TX ring read index, free running */
+	volatile u32 RxHead;	/**< RX ring write index, free running */
+	volatile u32 RxTail;	/**< RX ring read index, free running */
+	u32 TxBufMask;		/**< TX buffers owned by the queue */
+	u32 TxPending;		/**< TX buffers with a request from the queue */
+	u32 TxFrames;		/**< Number of frames written to TX buffers */
+	u32 RxFrames;		/**< Number of frames read from the RX FIFOs */
+	u32 RxRingFull;		/**< Number of drains stopped by a full RX ring */
+} XCanFd_Queue;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -1100,6 +1148,17 @@ u32 XCanFd_SetRxIntrWatermarkFifo1(XCanFd *InstancePtr, s8 Threshold);
 u32 XCanFd_SetTxEventIntrWatermark(XCanFd *InstancePtr, u8 Threshold);
 u32 XCanFd_SetRxFilterPartition(XCanFd *InstancePtr, u8 FilterPartition);
 
+/* Functions in xcanfd_queue.c */
+int XCanFd_QueueInitialize(XCanFd_Queue *QueuePtr, XCanFd *InstancePtr,
+			   u32 TxBufMask, XCanFd_Frame *TxRing, u32 TxDepth,
+			   XCanFd_Frame *RxRing, u32 RxDepth);
+u32 XCanFd_QueueSend(XCanFd_Queue *QueuePtr, const XCanFd_Frame *FramePtr,
+		     u32 NumFrames);
+u32 XCanFd_QueueRecv(XCanFd_Queue *QueuePtr, XCanFd_Frame *FramePtr,
+		     u32 NumFrames);
+u32 XCanFd_QueueTxService(XCanFd_Queue *QueuePtr);
+u32 XCanFd_QueueRxDrain(XCanFd_Queue *QueuePtr);
+
 /* Diagnostic functions in xcan_selftest.c */
 int XCanFd_SelfTest(XCanFd *InstancePtr);
 
@@ -0,0 +1,502 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xcanfd_queue.c
+* @addtogroup canfd Overview
+* @{
+*
+* This file contains the TX and RX frame queues of the CAN FD driver.
+*
+* XCanFd_Send() and XCanFd_Recv_Sequential() move one frame per call, which
+* at high data phase bit rates leaves the TX buffers idle and lets the RX
+* FIFOs overflow between two calls. The queues move frames in batches:
+*
+* - XCanFd_QueueTxService() writes frames from the TX ring to all free TX
+*   buffers owned by the queue and requests their transmission with a single
+*   TRR write. It is called from the send handler, and by XCanFd_QueueSend().
+* - XCanFd_QueueRxDrain() reads all frames from both RX FIFOs into the RX
+*   ring. It is called from the receive handler, or polled.
+* - XCanFd_QueueSend() and XCanFd_QueueRecv() copy a batch of frames to and
+*   from the rings. Received frames keep the timestamp of their DLC word.
+*
+* Each ring has one producer and one consumer, so no lock is needed between
+* the application and the handlers. XCanFd_QueueSend() masks the TX
+* interrupts while it services the TX buffers itself.
+*
+* The core sends the frames of the TX buffers with the same ID in the order
+* of the buffer numbers. To keep frames in the order they were queued, the
+* queue only writes to buffers above the highest buffer still pending and
+* starts again from the lowest one once all of them are sent.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date      Changes
+* ----- ---- --------- -------------------------------------------------------
+* 2.9   kt   10/18/26  First release
+* </pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xil_io.h"
+#include "xcanfd.h"
+#if defined (versal) && defined (SDT)
+#include <string.h>
+#endif
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Variable Definitions *****************************/
+
+/************************** Function Prototypes ******************************/
+
+static void XCanFd_QueueWriteFrame(XCanFd *InstancePtr, u32 FreeTxBuffer,
+				   const XCanFd_Frame *FramePtr);
+static void XCanFd_QueueReadFrame(XCanFd *InstancePtr, u32 ReadIndex,
+				  u8 FifoNo, XCanFd_Frame *FramePtr);
+static void XCanFd_QueueSetTrr(XCanFd *InstancePtr, u32 TrrVal);
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a frame queue. The TX buffers given in TxBufMask
+* are used by the queue only, they must not be used with XCanFd_Send() or
+* XCanFd_Addto_Queue() afterwards.
+*
+* @param	QueuePtr is a pointer to the XCanFd_Queue to be initialized.
+* @param	InstancePtr is a pointer to the XCanFd instance, configured in
+*		sequential receive mode.
+* @param	TxBufMask is the mask of TX buffers owned by the queue.
+* @param	TxRing is a pointer to the TX ring of TxDepth frames.
+* @param	TxDepth is the number of frames in the TX ring, a power of two.
+* @param	RxRing is a pointer to the RX ring of RxDepth frames.
+* @param	RxDepth is the number of frames in the RX ring, a power of two.
+*
+* @return	- XST_SUCCESS.
+*
+* @note		None.
+*
+******************************************************************************/
+int XCanFd_QueueInitialize(XCanFd_Queue *QueuePtr, XCanFd *InstancePtr,
+			   u32 TxBufMask, XCanFd_Frame *TxRing, u32 TxDepth,
+			   XCanFd_Frame *RxRing, u32 RxDepth)
+{
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(InstancePtr->CanFdConfig.Rx_Mode == (u32)0);
+	Xil_AssertNonvoid(TxBufMask != (u32)0);
+	Xil_AssertNonvoid((InstancePtr->CanFdConfig.NumofTxBuf >=
+			   MAX_BUFFER_VAL) ||
+			  ((TxBufMask >> InstancePtr->CanFdConfig.NumofTxBuf)
+			   == (u32)0));
+	Xil_AssertNonvoid(TxRing != NULL);
+	Xil_AssertNonvoid(RxRing != NULL);
+	Xil_AssertNonvoid((TxDepth != (u32)0) &&
+			  ((TxDepth & (TxDepth - (u32)1)) == (u32)0));
+	Xil_AssertNonvoid((RxDepth != (u32)0) &&
+			  ((RxDepth & (RxDepth - (u32)1)) == (u32)0));
+
+	QueuePtr->InstancePtr = InstancePtr;
+	QueuePtr->TxRing = TxRing;
+	QueuePtr->RxRing = RxRing;
+	QueuePtr->TxDepth = TxDepth;
+	QueuePtr->RxDepth = RxDepth;
+	QueuePtr->TxHead = (u32)0;
+	QueuePtr->TxTail = (u32)0;
+	QueuePtr->RxHead = (u32)0;
+	QueuePtr->RxTail = (u32)0;
+	QueuePtr->TxBufMask = TxBufMask;
+	QueuePtr->TxPending = (u32)0;
+	QueuePtr->TxFrames = (u32)0;
+	QueuePtr->RxFrames = (u32)0;
+	QueuePtr->RxRingFull = (u32)0;
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues frames for transmission and starts the transmission
+* of as many of them as there are free TX buffers. The rest are sent by
+* XCanFd_QueueTxService() from the send handler, as the TX buffers complete.
+*
+* @param	QueuePtr is a pointer to the XCanFd_Queue to be worked on.
+* @param	FramePtr is a pointer to the frames to be sent.
+* @param	NumFrames is the number of frames to be sent.
+*
+* @return	Number of frames queued, less than NumFrames if the TX ring
+*		is full.
+*
+* @note		The TXOK and TX event watermark interrupts are masked while
+*		the TX buffers are serviced.
+*
+******************************************************************************/
+u32 XCanFd_QueueSend(XCanFd_Queue *QueuePtr, const XCanFd_Frame *FramePtr,
+		     u32 NumFrames)
+{
+	XCanFd *InstancePtr;
+	u32 Head;
+	u32 Count;
+	u32 IntrMask;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(FramePtr != NULL);
+
+	InstancePtr = QueuePtr->InstancePtr;
+
+	Head = QueuePtr->TxHead;
+	for (Count = (u32)0; Count < NumFrames; Count++) {
+		if ((Head - QueuePtr->TxTail) >= QueuePtr->TxDepth) {
+			break;
+		}
+		QueuePtr->TxRing[Head & (QueuePtr->TxDepth - (u32)1)] =
+			FramePtr[Count];
+		Head++;
+	}
+
+	/* Publish the frames once they are in the ring */
+	QueuePtr->TxHead = Head;
+
+	/* Do not let the send handler service the TX buffers meanwhile */
+	IntrMask = XCanFd_InterruptGetEnabled(InstancePtr) &
+		   (XCANFD_IXR_TXOK_MASK | XCANFD_IXR_TXEWMFLL_MASK);
+	if (IntrMask != (u32)0) {
+		XCanFd_InterruptDisable(InstancePtr, IntrMask);
+	}
+	(void)XCanFd_QueueTxService(QueuePtr);
+	if (IntrMask != (u32)0) {
+		XCanFd_InterruptEnable(InstancePtr, IntrMask);
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function gets received frames from the RX ring.
+*
+* @param	QueuePtr is a pointer to the XCanFd_Queue to be worked on.
+* @param	FramePtr is a pointer to the buffer to store the frames.
+* @param	NumFrames is the maximum number of frames to be stored.
+*
+* @return	Number of frames stored, 0 if the RX ring is empty.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XCanFd_QueueRecv(XCanFd_Queue *QueuePtr, XCanFd_Frame *FramePtr,
+		     u32 NumFrames)
+{
+	u32 Tail;
+	u32 Count;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(FramePtr != NULL);
+
+	Tail = QueuePtr->RxTail;
+	for (Count = (u32)0; Count < NumFrames; Count++) {
+		if (Tail == QueuePtr->RxHead) {
+			break;
+		}
+		FramePtr[Count] =
+			QueuePtr->RxRing[Tail & (QueuePtr->RxDepth - (u32)1)];
+		Tail++;
+	}
+
+	/* Hand the entries back once they are copied */
+	QueuePtr->RxTail = Tail;
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes queued frames to the free TX buffers of the queue and
+* requests their transmission. It must be called from the send handler, it
+* can also be called periodically.
+*
+* @param	QueuePtr is a pointer to the XCanFd_Queue to be worked on.
+*
+* @return	Number of frames written to TX buffers.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XCanFd_QueueTxService(XCanFd_Queue *QueuePtr)
+{
+	XCanFd *InstancePtr;
+	u32 TrrVal;
+	u32 Window;
+	u32 FreeMask;
+	u32 ReqMask = (u32)0;
+	u32 FreeTxBuffer;
+	u32 Tail;
+	u32 Count = (u32)0;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+
+	InstancePtr = QueuePtr->InstancePtr;
+
+	/* Buffers with the TRR bit cleared are sent or cancelled */
+	TrrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+				XCANFD_TRR_OFFSET);
+	QueuePtr->TxPending &= TrrVal;
+
+	/* Only use the buffers above the highest pending one */
+	Window = QueuePtr->TxPending;
+	Window |= Window >> 1;
+	Window |= Window >> 2;
+	Window |= Window >> 4;
+	Window |= Window >> 8;
+	Window |= Window >> 16;
+	FreeMask = QueuePtr->TxBufMask & (~TrrVal) & (~Window);
+
+	Tail = QueuePtr->TxTail;
+	for (FreeTxBuffer = (u32)0; (FreeTxBuffer < MAX_BUFFER_VAL) &&
+	     (FreeMask != (u32)0); FreeTxBuffer++) {
+		if (Tail == QueuePtr->TxHead) {
+			break;
+		}
+		if ((FreeMask & ((u32)1 << FreeTxBuffer)) != (u32)0) {
+			XCanFd_QueueWriteFrame(InstancePtr, FreeTxBuffer,
+					       &QueuePtr->TxRing[Tail &
+						       (QueuePtr->TxDepth - (u32)1)]);
+			FreeMask &= ~((u32)1 << FreeTxBuffer);
+			ReqMask |= (u32)1 << FreeTxBuffer;
+			Tail++;
+			Count++;
+		}
+	}
+
+	if (ReqMask != (u32)0) {
+		QueuePtr->TxTail = Tail;
+		QueuePtr->TxPending |= ReqMask;
+		QueuePtr->TxFrames += Count;
+		XCanFd_QueueSetTrr(InstancePtr, ReqMask);
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads all received frames from RX FIFO 0 and RX FIFO 1 into
+* the RX ring. It must be called from the receive handler, or polled when
+* the RX interrupts are not used.
+*
+* @param	QueuePtr is a pointer to the XCanFd_Queue to be worked on.
+*
+* @return	Number of frames read.
+*
+* @note		If the RX ring gets full, the remaining frames are left in the
+*		RX FIFOs and read by the next call.
+*
+******************************************************************************/
+u32 XCanFd_QueueRxDrain(XCanFd_Queue *QueuePtr)
+{
+	XCanFd *InstancePtr;
+	u32 FsrVal;
+	u32 ReadIndex;
+	u32 IriMask;
+	u32 Head;
+	u32 Count = (u32)0;
+	u8 FifoNo = (u8)XCANFD_RX_FIFO_1;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+
+	InstancePtr = QueuePtr->InstancePtr;
+
+	Head = QueuePtr->RxHead;
+	FsrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+				XCANFD_FSR_OFFSET);
+	while ((FsrVal & (XCANFD_FSR_FL_MASK | XCANFD_FSR_FL_1_MASK)) !=
+	       (u32)0) {
+		if ((Head - QueuePtr->RxTail) >= QueuePtr->RxDepth) {
+			QueuePtr->RxRingFull++;
+			break;
+		}
+
+		/* Take turns between the FIFOs when both hold frames */
+		if (((FsrVal & XCANFD_FSR_FL_1_MASK) == (u32)0) ||
+		    (((FsrVal & XCANFD_FSR_FL_MASK) != (u32)0) &&
+		     (FifoNo == (u8)XCANFD_RX_FIFO_1))) {
+			FifoNo = (u8)XCANFD_RX_FIFO_0;
+			ReadIndex = FsrVal & XCANFD_FSR_RI_MASK;
+			IriMask = XCANFD_FSR_IRI_MASK;
+		} else {
+			FifoNo = (u8)XCANFD_RX_FIFO_1;
+			ReadIndex = (FsrVal & XCANFD_FSR_RI_1_MASK) >>
+				    XCANFD_FSR_RI_1_SHIFT;
+			IriMask = XCANFD_FSR_IRI_1_MASK;
+		}
+
+		XCanFd_QueueReadFrame(InstancePtr, ReadIndex, FifoNo,
+				      &QueuePtr->RxRing[Head &
+					      (QueuePtr->RxDepth - (u32)1)]);
+		Head++;
+		Count++;
+
+		/* Set the IRI bit causes core to increment RI in FSR Register */
+		FsrVal &= ~(XCANFD_FSR_IRI_MASK | XCANFD_FSR_IRI_1_MASK);
+		XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+				XCANFD_FSR_OFFSET, FsrVal | IriMask);
+
+		FsrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+					XCANFD_FSR_OFFSET);
+	}
+
+	/* Publish the frames once they are in the ring */
+	QueuePtr->RxHead = Head;
+	QueuePtr->RxFrames += Count;
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes a frame to a TX buffer.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	FreeTxBuffer is the TX buffer number.
+* @param	FramePtr is a pointer to the frame.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XCanFd_QueueWriteFrame(XCanFd *InstancePtr, u32 FreeTxBuffer,
+				   const XCanFd_Frame *FramePtr)
+{
+	u32 DwIndex;
+	u32 Dlc;
+	u32 Len;
+
+	XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+			XCANFD_TXID_OFFSET(FreeTxBuffer), FramePtr->Id);
+	XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+			XCANFD_TXDLC_OFFSET(FreeTxBuffer), FramePtr->Dlc);
+
+	Dlc = (u32)XCanFd_GetDlc2len(FramePtr->Dlc & XCANFD_DLCR_DLC_MASK,
+				     (FramePtr->Dlc & XCANFD_DLCR_EDL_MASK));
+	DwIndex = (u32)0;
+	for (Len = (u32)0; Len < Dlc; Len += XCANFD_DW_BYTES) {
+		XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+				(XCANFD_TXDW_OFFSET(FreeTxBuffer) +
+				 (DwIndex * XCANFD_DW_BYTES)),
+				Xil_EndianSwap32(FramePtr->Data[DwIndex]));
+		DwIndex++;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads the frame at the read index of an RX FIFO.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	ReadIndex is the current RI(Read Index) of the FIFO.
+* @param	FifoNo is the RX FIFO number.
+* @param	FramePtr is a pointer to store the frame.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XCanFd_QueueReadFrame(XCanFd *InstancePtr, u32 ReadIndex,
+				  u8 FifoNo, XCanFd_Frame *FramePtr)
+{
+	UINTPTR IdOffset;
+	UINTPTR DlcOffset;
+	UINTPTR DwOffset;
+	u32 DwIndex;
+	u32 Dlc;
+	u32 Len;
+
+	if (FifoNo == (u8)XCANFD_RX_FIFO_0) {
+		IdOffset = XCANFD_RXID_OFFSET(ReadIndex);
+		DlcOffset = XCANFD_RXDLC_OFFSET(ReadIndex);
+		DwOffset = XCANFD_RXDW_OFFSET(ReadIndex);
+	} else {
+		IdOffset = XCANFD_FIFO_1_RXID_OFFSET(ReadIndex);
+		DlcOffset = XCANFD_FIFO_1_RXDLC_OFFSET(ReadIndex);
+		DwOffset = XCANFD_FIFO_1_RXDW_OFFSET(ReadIndex);
+	}
+
+	FramePtr->Id = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+				      IdOffset);
+	FramePtr->Dlc = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+				       DlcOffset);
+
+	Dlc = (u32)XCanFd_GetDlc2len(FramePtr->Dlc & XCANFD_DLCR_DLC_MASK,
+				     (FramePtr->Dlc & XCANFD_DLCR_EDL_MASK));
+	DwIndex = (u32)0;
+	for (Len = (u32)0; Len < Dlc; Len += XCANFD_DW_BYTES) {
+		FramePtr->Data[DwIndex] = Xil_EndianSwap32(
+			XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+				       DwOffset + (DwIndex * XCANFD_DW_BYTES)));
+		DwIndex++;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets the TRR bits of TX buffers.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	TrrVal is the mask of TX buffers to be transmitted.
+*
+* @return	None.
+*
+* @note		Like XCanFd_Send_Queue(), the bits are written one at a time
+*		on the Versal PS CANFD that requires it.
+*
+******************************************************************************/
+static void XCanFd_QueueSetTrr(XCanFd *InstancePtr, u32 TrrVal)
+{
+#ifdef versal
+	u32 BufferNumber;
+
+#ifndef SDT
+	if ((XGetPSVersion_Info() == (u32)0x10) &&
+	    (InstancePtr->CanFdConfig.IsPl == (u32)0U)) {
+#else
+	if ((XGetPSVersion_Info() == (u32)0x10) &&
+	    (!(strcmp(InstancePtr->CanFdConfig.Name, "xlnx,versal-canfd-2.0")))) {
+#endif
+		for (BufferNumber = 0; BufferNumber < MAX_BUFFER_VAL;
+		     BufferNumber++) {
+			if ((TrrVal & ((u32)1 << BufferNumber)) != (u32)0) {
+				XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+						XCANFD_TRR_OFFSET,
+						((u32)1 << BufferNumber));
+			}
+		}
+	} else
+#endif
+	{
+		XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+				XCANFD_TRR_OFFSET, TrrVal);
+	}
+}
+/** @} */
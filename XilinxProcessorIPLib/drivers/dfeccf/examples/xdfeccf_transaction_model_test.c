@@ -0,0 +1,409 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xdfeccf_transaction_model_test.c
+*
+* Host test and benchmark of XDfeCcf_CompileCCCfg() and
+* XDfeCcf_SetTransactionAndTrigger() against a libmetal register model of
+* the channel filter. It is not a target example: it is built and run with
+* the other driver model tests by make -C scripts/host_model.
+*
+* Two instances of the same core are taken through the same random sequence
+* of CC additions, removals and updates and antenna changes, one with
+* XDfeCcf_GetCurrentCCCfg() and XDfeCcf_SetNextCCCfgAndTrigger() and one
+* with a transaction compiled from the previous CC configuration. After every
+* change the register images and the lowest unused CCID of both instances
+* must be the same, and the transaction must not write a register with the
+* value it already holds.
+*
+* The time, register reads and register writes of adding and removing a CC
+* are printed for both ways, with the register model answering at once and
+* with a bus latency per access.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 1.7   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <metal/device.h>
+#include "xdfeccf.h"
+#include "xdfeccf_hw.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define REGION_SIZE	0x4000U		/* Register space of a core */
+#define NUM_CCS		4U		/* CCs added and removed */
+#define NUM_CHANGES	500U		/* Changes of the random sequence */
+#define ACCESS_NS	100U		/* Bus latency of a register access */
+#define NUM_RUNS	20000U		/* Changes timed without latency */
+#define NUM_SLOW_RUNS	200U		/* Changes timed with latency */
+#define NUM_BENCHES	2U
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define CORE(io)	((io) == &Io[0] ? 0U : 1U)
+
+/**************************** Type Definitions *******************************/
+
+typedef enum {
+	CHANGE_TOGGLE_CC = 0,
+	CHANGE_UPDATE_CC,
+	CHANGE_TOGGLE_ANTENNA,
+	CHANGE_NUM
+} Change;
+
+/************************** Function Prototypes ******************************/
+
+static void CoreInit(u32 Core);
+static void ChangeCCCfg(XDfeCcf *InstancePtr, XDfeCcf_CCCfg *CCCfg,
+			Change Kind, s32 CCID,
+			const XDfeCcf_CarrierCfg *CarrierCfg);
+static void ClearFlush(XDfeCcf_CCCfg *CCCfg);
+static void LegacyChange(Change Kind, s32 CCID,
+			 const XDfeCcf_CarrierCfg *CarrierCfg);
+static void TransactionChange(Change Kind, s32 CCID,
+			      const XDfeCcf_CarrierCfg *CarrierCfg);
+static void CompareCores(u32 Step);
+
+/************************** Variable Definitions *****************************/
+
+static u8 Regs[2][REGION_SIZE];
+static struct metal_io_region Io[2];
+static XDfeCcf Ccf[2];
+static XDfeCcf_CCCfg Curr;
+static XDfeCcf_Transaction Transaction[2];
+static u32 AccessNs;
+static u32 Reads;
+static u32 Writes;
+static u32 Logging;
+static u32 Redundant;
+
+/* Configuration table and devices of the SDT and baremetal initialization,
+ * the instances are set up by hand */
+XDfeCcf_Config XDfeCcf_ConfigTable[XDFECCF_MAX_NUM_INSTANCES] = { { NULL } };
+struct metal_device XDfeCcf_CustomDevice[XDFECCF_MAX_NUM_INSTANCES];
+metal_phys_addr_t XDfeCcf_metal_phys[XDFECCF_MAX_NUM_INSTANCES];
+
+/*****************************************************************************/
+/*
+* Register model: plain memory for each instance, with a bus latency per
+* access. A CC update trigger copies the NEXT registers to the CURRENT ones
+* and clears its enable bit. The writes to the second instance which do not
+* change a register are counted while a transaction is set.
+*/
+uint64_t metal_io_read(struct metal_io_region *io, unsigned long offset,
+		       int width)
+{
+	uint64_t Value = 0U;
+	u64 StartNs = XHostModel_TimeNs();
+
+	while ((XHostModel_TimeNs() - StartNs) < AccessNs) {
+	}
+	Reads++;
+	memcpy(&Value, &Regs[CORE(io)][offset], (size_t)width);
+	return Value;
+}
+
+void metal_io_write(struct metal_io_region *io, unsigned long offset,
+		    uint64_t value, int width)
+{
+	u8 *Core = Regs[CORE(io)];
+	u64 StartNs = XHostModel_TimeNs();
+
+	while ((XHostModel_TimeNs() - StartNs) < AccessNs) {
+	}
+	Writes++;
+	if (Logging && (CORE(io) == 1U) &&
+	    (offset != XDFECCF_TRIGGERS_CC_UPDATE_OFFSET) &&
+	    (memcmp(&Core[offset], &value, (size_t)width) == 0)) {
+		Redundant++;
+	}
+	memcpy(&Core[offset], &value, (size_t)width);
+
+	if ((offset == XDFECCF_TRIGGERS_CC_UPDATE_OFFSET) && (value & 1U)) {
+		memcpy(&Core[XDFECCF_SEQUENCE_LENGTH_CURRENT],
+		       &Core[XDFECCF_SEQUENCE_LENGTH_NEXT], sizeof(u32));
+		memcpy(&Core[XDFECCF_SEQUENCE_CURRENT],
+		       &Core[XDFECCF_SEQUENCE_NEXT],
+		       XDFECCF_SEQ_LENGTH_MAX * sizeof(u32));
+		memcpy(&Core[XDFECCF_CARRIER_CONFIGURATION_CURRENT],
+		       &Core[XDFECCF_CARRIER_CONFIGURATION_NEXT],
+		       XDFECCF_CC_NUM * sizeof(u32));
+		memcpy(&Core[XDFECCF_ANTENNA_CONFIGURATION_CURRENT],
+		       &Core[XDFECCF_ANTENNA_CONFIGURATION_NEXT], sizeof(u32));
+		Core[offset] &= ~1U;
+	}
+}
+
+/*****************************************************************************/
+/*
+* A non switchable core with 8 antennas and 16 CCs, taken through reset,
+* configuration, initialization and activation with a sequence length of 16.
+*/
+static void CoreInit(u32 Core)
+{
+	XDfeCcf_Cfg Cfg;
+	XDfeCcf_Init Init;
+	XDfeCcf *InstancePtr = &Ccf[Core];
+
+	memset(Regs[Core], 0, sizeof(Regs[Core]));
+	memset(InstancePtr, 0, sizeof(*InstancePtr));
+	metal_io_init(&Io[Core], Regs[Core], NULL, REGION_SIZE, (unsigned)(-1),
+		      0U, NULL);
+	InstancePtr->Io = &Io[Core];
+	InstancePtr->StateId = XDFECCF_STATE_READY;
+	XDfeCcf_WriteReg(InstancePtr, XDFECCF_MODEL_PARAM_OFFSET,
+			 (8U << XDFECCF_MODEL_PARAM_NUM_ANTENNA_OFFSET) |
+			 (16U << XDFECCF_MODEL_PARAM_NUM_CC_PER_ANTENNA_OFFSET) |
+			 (1U << XDFECCF_MODEL_PARAM_ANTENNA_INTERLEAVE_OFFSET));
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	memset(&Init, 0, sizeof(Init));
+	Init.Sequence.Length = XDFECCF_SEQ_LENGTH_MAX;
+	Init.GainStage = 1U;
+	XDfeCcf_Reset(InstancePtr);
+	XDfeCcf_Configure(InstancePtr, &Cfg);
+	XDfeCcf_Initialize(InstancePtr, &Init);
+	XDfeCcf_Activate(InstancePtr, false);
+	XHOST_CHECK((InstancePtr->StateId == XDFECCF_STATE_OPERATIONAL) &&
+		    (InstancePtr->Config.NumCCPerAntenna == 16U),
+		    "core %u: initialization", (unsigned)Core);
+}
+
+/*****************************************************************************/
+/*
+* One change of a CC configuration: CC CCID, on its own 4 sequence slots, is
+* added or removed, or updated with CarrierCfg if present, or antenna CCID is
+* enabled or disabled.
+*/
+static void ChangeCCCfg(XDfeCcf *InstancePtr, XDfeCcf_CCCfg *CCCfg,
+			Change Kind, s32 CCID,
+			const XDfeCcf_CarrierCfg *CarrierCfg)
+{
+	XDfeCcf_AntennaCfg AntennaCfg;
+
+	switch (Kind) {
+	case CHANGE_TOGGLE_CC:
+		if (CCCfg->CarrierCfg[CCID].Enable != 0U) {
+			XDfeCcf_RemoveCCfromCCCfg(InstancePtr, CCCfg, CCID);
+		} else {
+			XHOST_CHECK(XDfeCcf_AddCCtoCCCfg(InstancePtr, CCCfg,
+							 CCID, 0xFU << (4 * CCID),
+							 CarrierCfg) ==
+				    XST_SUCCESS, "CC %d: add", (int)CCID);
+		}
+		break;
+	case CHANGE_UPDATE_CC:
+		if (CCCfg->CarrierCfg[CCID].Enable != 0U) {
+			XDfeCcf_UpdateCCinCCCfg(InstancePtr, CCCfg, CCID,
+						CarrierCfg);
+		}
+		break;
+	default:
+		AntennaCfg = CCCfg->AntennaCfg;
+		AntennaCfg.Enable[CCID] ^= 1U;
+		XDfeCcf_SetAntennaCfgInCCCfg(InstancePtr, CCCfg, &AntennaCfg);
+		break;
+	}
+}
+
+/*****************************************************************************/
+/*
+* The CCs are flushed once, as read back by XDfeCcf_GetCurrentCCCfg().
+*/
+static void ClearFlush(XDfeCcf_CCCfg *CCCfg)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < XDFECCF_CC_NUM; Index++) {
+		CCCfg->CarrierCfg[Index].Flush = 0U;
+	}
+}
+
+/*****************************************************************************/
+/*
+* A change as done without transaction: the CC configuration is read back,
+* changed and written as a whole.
+*/
+static void LegacyChange(Change Kind, s32 CCID,
+			 const XDfeCcf_CarrierCfg *CarrierCfg)
+{
+	XDfeCcf_CCCfg CCCfg;
+
+	XDfeCcf_GetCurrentCCCfg(&Ccf[0], &CCCfg);
+	ChangeCCCfg(&Ccf[0], &CCCfg, Kind, CCID, CarrierCfg);
+	(void)XDfeCcf_SetNextCCCfgAndTrigger(&Ccf[0], &CCCfg);
+}
+
+static void TransactionChange(Change Kind, s32 CCID,
+			      const XDfeCcf_CarrierCfg *CarrierCfg)
+{
+	XDfeCcf_CCCfg Next = Curr;
+
+	ClearFlush(&Next);
+	ChangeCCCfg(&Ccf[1], &Next, Kind, CCID, CarrierCfg);
+	XDfeCcf_CompileCCCfg(&Ccf[1], &Curr, &Next, &Transaction[0]);
+	XHOST_CHECK(Transaction[0].NumWrites < XDFECCF_TRANSACTION_WRITES_MAX,
+		    "%u writes", (unsigned)Transaction[0].NumWrites);
+	Redundant = 0U;
+	Logging = 1U;
+	(void)XDfeCcf_SetTransactionAndTrigger(&Ccf[1], &Transaction[0]);
+	Logging = 0U;
+	XHOST_CHECK(Redundant == 0U, "%u redundant writes",
+		    (unsigned)Redundant);
+	Curr = Next;
+}
+
+static void CompareCores(u32 Step)
+{
+	u32 Offset;
+	u32 Value[2];
+
+	for (Offset = 0U; Offset < REGION_SIZE; Offset += 4U) {
+		memcpy(&Value[0], &Regs[0][Offset], sizeof(u32));
+		memcpy(&Value[1], &Regs[1][Offset], sizeof(u32));
+		if (Value[0] != Value[1]) {
+			XHOST_CHECK(0, "change %u: register 0x%04x is 0x%08x, "
+				    "0x%08x without transaction", (unsigned)Step,
+				    (unsigned)Offset, (unsigned)Value[1],
+				    (unsigned)Value[0]);
+			return;
+		}
+	}
+	XHOST_CHECK(Ccf[0].NotUsedCCID == Ccf[1].NotUsedCCID,
+		    "change %u: unused CCID %d, %d without transaction",
+		    (unsigned)Step, (int)Ccf[1].NotUsedCCID,
+		    (int)Ccf[0].NotUsedCCID);
+}
+
+int main(void)
+{
+	static const u32 Bench[NUM_BENCHES][2] = {
+		{ 0U, NUM_RUNS }, { ACCESS_NS, NUM_SLOW_RUNS }
+	};
+	XDfeCcf_CarrierCfg CarrierCfg;
+	XDfeCcf_AntennaCfg AntennaCfg;
+	XDfeCcf_CCCfg CCCfg;
+	XDfeCcf_CCCfg Next;
+	u64 StartNs;
+	u64 Time[2];
+	u32 Count[2][2];
+	u32 NumFull;
+	u32 Runs;
+	u32 Run;
+	u32 Index;
+	Change Kind;
+	s32 CCID;
+
+	CoreInit(0U);
+	CoreInit(1U);
+
+	/* Both instances start from all the antennas enabled and no CC */
+	for (Index = 0U; Index < XDFECCF_ANT_NUM_MAX; Index++) {
+		AntennaCfg.Enable[Index] = 1U;
+	}
+	XDfeCcf_GetEmptyCCCfg(&Ccf[0], &CCCfg);
+	XDfeCcf_SetAntennaCfgInCCCfg(&Ccf[0], &CCCfg, &AntennaCfg);
+	(void)XDfeCcf_SetNextCCCfgAndTrigger(&Ccf[0], &CCCfg);
+	Curr = CCCfg;
+	XDfeCcf_CompileCCCfg(&Ccf[1], NULL, &Curr, &Transaction[0]);
+	NumFull = Transaction[0].NumWrites;
+	XHOST_CHECK(NumFull == XDFECCF_TRANSACTION_WRITES_MAX, "%u writes",
+		    (unsigned)NumFull);
+	(void)XDfeCcf_SetTransactionAndTrigger(&Ccf[1], &Transaction[0]);
+	CompareCores(0U);
+
+	srand(1U);
+	for (Index = 1U; Index <= NUM_CHANGES; Index++) {
+		Kind = (Change)((u32)rand() % CHANGE_NUM);
+		CCID = (s32)((u32)rand() % ((Kind == CHANGE_TOGGLE_ANTENNA) ?
+					    XDFECCF_ANT_NUM_MAX : NUM_CCS));
+		CarrierCfg.Gain = (u32)rand() & 0xFFFFU;
+		CarrierCfg.ImagCoeffSet = (u32)rand() % 8U;
+		CarrierCfg.RealCoeffSet = (u32)rand() % 8U;
+		LegacyChange(Kind, CCID, &CarrierCfg);
+		TransactionChange(Kind, CCID, &CarrierCfg);
+		CompareCores(Index);
+	}
+
+	/* A pending update is refused and leaves the unused CCID */
+	metal_set_log_level(METAL_LOG_EMERGENCY);
+	Regs[1][XDFECCF_ISR] |= 1U << XDFECCF_CC_UPDATE_TRIGGERED_OFFSET;
+	Ccf[1].NotUsedCCID = -1;
+	XHOST_CHECK((XDfeCcf_SetTransactionAndTrigger(&Ccf[1],
+						       &Transaction[0]) ==
+		     XST_FAILURE) && (Ccf[1].NotUsedCCID == -1),
+		    "CC update pending");
+	metal_set_log_level(METAL_LOG_ERROR);
+	Regs[1][XDFECCF_ISR] = 0U;
+	Ccf[1].NotUsedCCID = Ccf[0].NotUsedCCID;
+	XHOST_CHECK(XHostModel_AssertCount == 0U, "%u assertions",
+		    (unsigned)XHostModel_AssertCount);
+
+	/* Add and remove the last CC, compiled once */
+	CarrierCfg.Gain = 0x4000U;
+	CarrierCfg.ImagCoeffSet = 1U;
+	CarrierCfg.RealCoeffSet = 2U;
+	Next = Curr;
+	ClearFlush(&Next);
+	ChangeCCCfg(&Ccf[1], &Next, CHANGE_TOGGLE_CC, NUM_CCS - 1U,
+		    &CarrierCfg);
+	XDfeCcf_CompileCCCfg(&Ccf[1], &Curr, &Next, &Transaction[0]);
+	XDfeCcf_CompileCCCfg(&Ccf[1], &Next, &Curr, &Transaction[1]);
+	printf("transaction writes: %u full, %u and %u to toggle CC %u\n",
+	       (unsigned)NumFull, (unsigned)Transaction[0].NumWrites,
+	       (unsigned)Transaction[1].NumWrites, (unsigned)(NUM_CCS - 1U));
+
+	/* Benchmark, without and with bus latency */
+	for (Index = 0U; Index < NUM_BENCHES; Index++) {
+		AccessNs = Bench[Index][0];
+		Runs = Bench[Index][1];
+		Reads = 0U;
+		Writes = 0U;
+		StartNs = XHostModel_TimeNs();
+		for (Run = 0U; Run < Runs; Run++) {
+			LegacyChange(CHANGE_TOGGLE_CC, NUM_CCS - 1U,
+				     &CarrierCfg);
+		}
+		Time[0] = XHostModel_TimeNs() - StartNs;
+		Count[0][0] = Reads / Runs;
+		Count[0][1] = Writes / Runs;
+		Reads = 0U;
+		Writes = 0U;
+		StartNs = XHostModel_TimeNs();
+		for (Run = 0U; Run < Runs; Run++) {
+			(void)XDfeCcf_SetTransactionAndTrigger(
+				&Ccf[1], &Transaction[Run % 2U]);
+		}
+		Time[1] = XHostModel_TimeNs() - StartNs;
+		Count[1][0] = Reads / Runs;
+		Count[1][1] = Writes / Runs;
+		printf("%3u ns per access: CC configuration %.2f us (%u reads "
+		       "%u writes), transaction %.2f us (%u reads %u writes)\n",
+		       (unsigned)AccessNs, (double)Time[0] / Runs / 1000.0,
+		       (unsigned)Count[0][0], (unsigned)Count[0][1],
+		       (double)Time[1] / Runs / 1000.0, (unsigned)Count[1][0],
+		       (unsigned)Count[1][1]);
+		XHOST_CHECK((Count[1][0] < Count[0][0]) &&
+			    (Count[1][1] < Count[0][1]),
+			    "transaction: %u reads %u writes",
+			    (unsigned)Count[1][0], (unsigned)Count[1][1]);
+	}
+
+	return XHostModel_Report("xdfeccf_transaction_model_test");
+}
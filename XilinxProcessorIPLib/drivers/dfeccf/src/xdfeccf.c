@@ -57,6 +57,7 @@
 *       dc     08/29/23 Remove immediate trigger
 * 1.7   cog    02/02/24 Yocto SDT support
 *       dc     03/01/24 Update version number in makefiles
+*       kt     10/18/26 Add precompiled CC configuration transactions
 * </pre>
 * @addtogroup dfeccf Overview
 * @{
@@ -445,82 +446,127 @@ XDfeCcf_GetInternalCarrierCfg(const XDfeCcf *InstancePtr, s32 CCID,
 /****************************************************************************/
 /**
 *
-* Sets the next CC configuration.
+* Gets one register write of a CC configuration. A CC configuration is
+* always XDFECCF_TRANSACTION_WRITES_MAX writes to the same registers in the
+* same order, so the writes of two configurations compare one by one.
 *
 * @param    InstancePtr Pointer to the Ccf instance.
-* @param    NextCCCfg Next CC configuration container.
+* @param    CCCfg CC configuration container.
+* @param    Write Write number, in the order the registers are written.
+* @param    Offset Register offset of the write.
+*
+* @return   Value to be written.
 *
 ****************************************************************************/
-static void XDfeCcf_SetNextCCCfg(const XDfeCcf *InstancePtr,
-				 const XDfeCcf_CCCfg *NextCCCfg)
+static u32 XDfeCcf_GetCCCfgWrite(const XDfeCcf *InstancePtr,
+				 const XDfeCcf_CCCfg *CCCfg, u32 Write,
+				 u32 *Offset)
 {
 	u32 AntennaCfg = 0U;
 	u32 CarrierCfg;
 	u32 Index;
-	u32 SeqLength;
-	s32 NextCCID[XDFECCF_SEQ_LENGTH_MAX];
 
-	/* Prepare NextCCID[] to be written to registers */
-	for (Index = 0U; Index < XDFECCF_CC_NUM; Index++) {
-		if ((NextCCCfg->Sequence.CCID[Index] ==
+	/* Sequence Length should remain the same, so copy the sequence length
+	   from CURRENT to NEXT, does not take from CCCfg. The reason
+	   is that CCCfg->Sequence.SeqLength can be 0 or 1 for the value 0
+	   in the CURRENT seqLength register */
+	if (Write == 0U) {
+		*Offset = XDFECCF_SEQUENCE_LENGTH_NEXT;
+		if (InstancePtr->SequenceLength == 0) {
+			return 0U;
+		}
+		return InstancePtr->SequenceLength - 1U;
+	}
+
+	/* Antenna configuration */
+	if (Write == (XDFECCF_TRANSACTION_WRITES_MAX - 1U)) {
+		for (Index = 0; Index < XDFECCF_ANT_NUM_MAX; Index++) {
+			AntennaCfg += (CCCfg->AntennaCfg.Enable[Index] << Index);
+		}
+		*Offset = XDFECCF_ANTENNA_CONFIGURATION_NEXT;
+		return AntennaCfg;
+	}
+
+	/* CCID sequence and carrier configuration of a sequence index */
+	Index = (Write - 1U) / 2U;
+	if (((Write - 1U) % 2U) == 0U) {
+		*Offset = XDFECCF_SEQUENCE_NEXT + (sizeof(u32) * Index);
+		if ((CCCfg->Sequence.CCID[Index] ==
 		     XDFECCF_SEQUENCE_ENTRY_NULL) ||
 		    (Index >= InstancePtr->SequenceLength)) {
-			NextCCID[Index] = NextCCCfg->Sequence.NotUsedCCID;
-		} else {
-			NextCCID[Index] = NextCCCfg->Sequence.CCID[Index];
+			return (u32)CCCfg->Sequence.NotUsedCCID;
 		}
+		return (u32)CCCfg->Sequence.CCID[Index];
 	}
 
-	/* Sequence Length should remain the same, so copy the sequence length
-	   from CURRENT to NEXT, does not take from NextCCCfg. The reason
-	   is that NextCCCfg->Sequence.SeqLength can be 0 or 1 for the value 0
-	   in the CURRENT seqLength register */
-	if (InstancePtr->SequenceLength == 0) {
-		SeqLength = 0U;
-	} else {
-		SeqLength = InstancePtr->SequenceLength - 1U;
-	}
-	XDfeCcf_WriteReg(InstancePtr, XDFECCF_SEQUENCE_LENGTH_NEXT, SeqLength);
+	CarrierCfg = XDfeCcf_WrBitField(XDFECCF_ENABLE_WIDTH,
+					XDFECCF_ENABLE_OFFSET, 0U,
+					CCCfg->CarrierCfg[Index].Enable);
+	CarrierCfg = XDfeCcf_WrBitField(XDFECCF_FLUSH_WIDTH,
+					XDFECCF_FLUSH_OFFSET, CarrierCfg,
+					CCCfg->CarrierCfg[Index].Flush);
+	CarrierCfg = XDfeCcf_WrBitField(XDFECCF_MAPPED_ID_WIDTH,
+					XDFECCF_MAPPED_ID_OFFSET, CarrierCfg,
+					CCCfg->CarrierCfg[Index].MappedId);
+	CarrierCfg = XDfeCcf_WrBitField(XDFECCF_GAIN_WIDTH,
+					XDFECCF_GAIN_OFFSET, CarrierCfg,
+					CCCfg->CarrierCfg[Index].Gain);
+	CarrierCfg = XDfeCcf_WrBitField(
+		XDFECCF_IM_COEFF_SET_WIDTH, XDFECCF_IM_COEFF_SET_OFFSET,
+		CarrierCfg, CCCfg->CarrierCfg[Index].ImagCoeffSet);
+	CarrierCfg = XDfeCcf_WrBitField(
+		XDFECCF_RE_COEFF_SET_WIDTH, XDFECCF_RE_COEFF_SET_OFFSET,
+		CarrierCfg, CCCfg->CarrierCfg[Index].RealCoeffSet);
+	*Offset = XDFECCF_CARRIER_CONFIGURATION_NEXT + (sizeof(u32) * Index);
+	return CarrierCfg;
+}
 
-	/* Write CCID sequence and carrier configurations */
-	for (Index = 0; Index < XDFECCF_CC_NUM; Index++) {
-		XDfeCcf_WriteReg(InstancePtr,
-				 XDFECCF_SEQUENCE_NEXT + (sizeof(u32) * Index),
-				 NextCCID[Index]);
-
-		CarrierCfg =
-			XDfeCcf_WrBitField(XDFECCF_ENABLE_WIDTH,
-					   XDFECCF_ENABLE_OFFSET, 0U,
-					   NextCCCfg->CarrierCfg[Index].Enable);
-		CarrierCfg =
-			XDfeCcf_WrBitField(XDFECCF_FLUSH_WIDTH,
-					   XDFECCF_FLUSH_OFFSET, CarrierCfg,
-					   NextCCCfg->CarrierCfg[Index].Flush);
-		CarrierCfg = XDfeCcf_WrBitField(
-			XDFECCF_MAPPED_ID_WIDTH, XDFECCF_MAPPED_ID_OFFSET,
-			CarrierCfg, NextCCCfg->CarrierCfg[Index].MappedId);
-		CarrierCfg =
-			XDfeCcf_WrBitField(XDFECCF_GAIN_WIDTH,
-					   XDFECCF_GAIN_OFFSET, CarrierCfg,
-					   NextCCCfg->CarrierCfg[Index].Gain);
-		CarrierCfg = XDfeCcf_WrBitField(
-			XDFECCF_IM_COEFF_SET_WIDTH, XDFECCF_IM_COEFF_SET_OFFSET,
-			CarrierCfg, NextCCCfg->CarrierCfg[Index].ImagCoeffSet);
-		CarrierCfg = XDfeCcf_WrBitField(
-			XDFECCF_RE_COEFF_SET_WIDTH, XDFECCF_RE_COEFF_SET_OFFSET,
-			CarrierCfg, NextCCCfg->CarrierCfg[Index].RealCoeffSet);
-		XDfeCcf_WriteReg(InstancePtr,
-				 XDFECCF_CARRIER_CONFIGURATION_NEXT +
-					 (sizeof(u32) * Index),
-				 CarrierCfg);
+/****************************************************************************/
+/**
+*
+* Gets the register writes of the next CC configuration.
+*
+* @param    InstancePtr Pointer to the Ccf instance.
+* @param    NextCCCfg Next CC configuration container.
+* @param    Transaction Transaction container, filled with all the writes.
+*
+****************************************************************************/
+static void XDfeCcf_GetNextCCCfgWrites(const XDfeCcf *InstancePtr,
+				       const XDfeCcf_CCCfg *NextCCCfg,
+				       XDfeCcf_Transaction *Transaction)
+{
+	u32 Write;
+
+	for (Write = 0U; Write < XDFECCF_TRANSACTION_WRITES_MAX; Write++) {
+		Transaction->Data[Write] = XDfeCcf_GetCCCfgWrite(
+			InstancePtr, NextCCCfg, Write,
+			&Transaction->Offset[Write]);
 	}
+	Transaction->NumWrites = XDFECCF_TRANSACTION_WRITES_MAX;
+	Transaction->NotUsedCCID = NextCCCfg->Sequence.NotUsedCCID;
+}
 
-	/* Write Antenna configuration */
-	for (Index = 0; Index < XDFECCF_ANT_NUM_MAX; Index++) {
-		AntennaCfg += (NextCCCfg->AntennaCfg.Enable[Index] << Index);
+/****************************************************************************/
+/**
+*
+* Sets the next CC configuration.
+*
+* @param    InstancePtr Pointer to the Ccf instance.
+* @param    NextCCCfg Next CC configuration container.
+*
+****************************************************************************/
+static void XDfeCcf_SetNextCCCfg(const XDfeCcf *InstancePtr,
+				 const XDfeCcf_CCCfg *NextCCCfg)
+{
+	u32 Data;
+	u32 Offset;
+	u32 Write;
+
+	for (Write = 0U; Write < XDFECCF_TRANSACTION_WRITES_MAX; Write++) {
+		Data = XDfeCcf_GetCCCfgWrite(InstancePtr, NextCCCfg, Write,
+					     &Offset);
+		XDfeCcf_WriteReg(InstancePtr, Offset, Data);
 	}
-	XDfeCcf_WriteReg(InstancePtr, XDFECCF_ANTENNA_CONFIGURATION_NEXT,
-			 AntennaCfg);
 }
 
 /****************************************************************************/
@@ -1554,6 +1600,108 @@ u32 XDfeCcf_SetNextCCCfgAndTriggerSwitchable(XDfeCcf *InstancePtr,
 	return Return;
 }
 
+/****************************************************************************/
+/**
+*
+* Compiles a CC configuration into a transaction, the register writes that
+* change the shadow (NEXT) registers from the current CC configuration to the
+* next one. Only the registers which differ between the two configurations
+* are written, no register is read. The writes of the current configuration
+* are computed one at a time while comparing, they are not stored.
+*
+* The transaction can be set with XDfeCcf_SetTransactionAndTrigger() any
+* number of times, on any Ccf instance with the same sequence length whose
+* NEXT registers hold the current CC configuration. NextCCCfg is compiled
+* as it is: clear the Flush of the CCs kept from the current configuration,
+* as XDfeCcf_GetCurrentCCCfg() does, or they are flushed again.
+*
+* @param    InstancePtr Pointer to the Ccf instance.
+* @param    CurrCCCfg Current CC configuration container, as last written to
+*           the NEXT registers. If NULL, all the registers are written.
+* @param    NextCCCfg Next CC configuration container.
+* @param    Transaction Transaction container.
+*
+* @note     Does not support switchable mode.
+*
+****************************************************************************/
+void XDfeCcf_CompileCCCfg(const XDfeCcf *InstancePtr,
+			  const XDfeCcf_CCCfg *CurrCCCfg,
+			  const XDfeCcf_CCCfg *NextCCCfg,
+			  XDfeCcf_Transaction *Transaction)
+{
+	u32 NumWrites = 0U;
+	u32 Index;
+	u32 Offset;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(NextCCCfg != NULL);
+	Xil_AssertVoid(Transaction != NULL);
+	Xil_AssertVoid(InstancePtr->Config.Switchable ==
+		       XDFECCF_SWITCHABLE_NO);
+
+	XDfeCcf_GetNextCCCfgWrites(InstancePtr, NextCCCfg, Transaction);
+	if (CurrCCCfg == NULL) {
+		return;
+	}
+
+	/* Both configurations write the same registers in the same order,
+	   drop the writes of unchanged values */
+	for (Index = 0U; Index < Transaction->NumWrites; Index++) {
+		if (Transaction->Data[Index] !=
+		    XDfeCcf_GetCCCfgWrite(InstancePtr, CurrCCCfg, Index,
+					  &Offset)) {
+			Transaction->Offset[NumWrites] =
+				Transaction->Offset[Index];
+			Transaction->Data[NumWrites] = Transaction->Data[Index];
+			NumWrites++;
+		}
+	}
+	Transaction->NumWrites = NumWrites;
+}
+
+/****************************************************************************/
+/**
+*
+* Writes a compiled transaction to the shadow (NEXT) registers and triggers
+* copying from shadow to operational (CURRENT) registers.
+*
+* @param    InstancePtr Pointer to the Ccf instance.
+* @param    Transaction Transaction container, see XDfeCcf_CompileCCCfg().
+*
+* @return
+*           - XST_SUCCESS if successful.
+*           - XST_FAILURE if error occurs.
+*
+* @note     Clear event status with XDfeCcf_ClearEventStatus() before
+*           running this API.
+*
+****************************************************************************/
+u32 XDfeCcf_SetTransactionAndTrigger(XDfeCcf *InstancePtr,
+				     const XDfeCcf_Transaction *Transaction)
+{
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Transaction != NULL);
+	Xil_AssertNonvoid(Transaction->NumWrites <=
+			  XDFECCF_TRANSACTION_WRITES_MAX);
+
+	for (Index = 0U; Index < Transaction->NumWrites; Index++) {
+		XDfeCcf_WriteReg(InstancePtr, Transaction->Offset[Index],
+				 Transaction->Data[Index]);
+	}
+
+	/* Trigger the update */
+	if (XST_SUCCESS == XDfeCcf_EnableCCUpdateTrigger(InstancePtr)) {
+		InstancePtr->NotUsedCCID = Transaction->NotUsedCCID;
+		return XST_SUCCESS;
+	}
+	metal_log(METAL_LOG_ERROR,
+		  "CC Update Trigger failed in %s. Restart the system\n",
+		  __func__);
+	return XST_FAILURE;
+}
+
 /****************************************************************************/
 /**
 *
@@ -86,6 +86,7 @@
 *       dc     11/11/22 Align AddCC to switchable UL/DL algorithm
 * 1.6   cog    07/04/23 Add support for SDT
 * 1.7   cog    02/21/24 Fixed SDT runtime issue
+*       kt     10/18/26 Add precompiled CC configuration transactions
 *
 * </pre>
 * @endcond
@@ -151,6 +152,9 @@ extern "C" {
 #define XDFECCF_ANT_NUM_MAX (8U) /**< Maximum anntena number */
 #define XDFECCF_SEQ_LENGTH_MAX (16U) /**< Maximum sequence length */
 #define XDFECCF_NUM_COEFF (128U) /**< Maximum number of coefficients */
+#define XDFECCF_TRANSACTION_WRITES_MAX                                         \
+	(2U + (2U * XDFECCF_SEQ_LENGTH_MAX)) /**< Maximum number of register
+		writes in a transaction */
 
 /**************************** Type Definitions *******************************/
 /*********** start - common code to all Logiccores ************/
@@ -361,6 +365,18 @@ typedef struct {
 	XDfeCcf_AntennaCfg AntennaCfg; /**< Antenna configuration */
 } XDfeCcf_CCCfg;
 
+/**
+ * Precompiled CC configuration, the register writes from one CC
+ * configuration to another.
+ */
+typedef struct {
+	u32 NumWrites; /**< Number of register writes */
+	u32 Offset[XDFECCF_TRANSACTION_WRITES_MAX]; /**< Register offsets */
+	u32 Data[XDFECCF_TRANSACTION_WRITES_MAX]; /**< Register values */
+	s32 NotUsedCCID; /**< Lowest CCID number not allocated in the
+		compiled CC configuration */
+} XDfeCcf_Transaction;
+
 /**
  * Channel Filter Status.
  */
@@ -480,6 +496,12 @@ u32 XDfeCcf_SetNextCCCfgAndTrigger(XDfeCcf *InstancePtr, XDfeCcf_CCCfg *CCCfg);
 u32 XDfeCcf_SetNextCCCfgAndTriggerSwitchable(XDfeCcf *InstancePtr,
 					     XDfeCcf_CCCfg *CCCfgDownlink,
 					     XDfeCcf_CCCfg *CCCfgUplink);
+void XDfeCcf_CompileCCCfg(const XDfeCcf *InstancePtr,
+			  const XDfeCcf_CCCfg *CurrCCCfg,
+			  const XDfeCcf_CCCfg *NextCCCfg,
+			  XDfeCcf_Transaction *Transaction);
+u32 XDfeCcf_SetTransactionAndTrigger(XDfeCcf *InstancePtr,
+				     const XDfeCcf_Transaction *Transaction);
 u32 XDfeCcf_AddCC(XDfeCcf *InstancePtr, s32 CCID, u32 CCSeqBitmap,
 		  const XDfeCcf_CarrierCfg *CarrierCfg);
 u32 XDfeCcf_RemoveCC(XDfeCcf *InstancePtr, s32 CCID);
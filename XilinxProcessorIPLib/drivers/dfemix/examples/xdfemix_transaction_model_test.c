@@ -0,0 +1,532 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xdfemix_transaction_model_test.c
+*
+* Host test and benchmark of XDfeMix_CompileCCCfg() and
+* XDfeMix_SetTransactionAndTrigger() against a libmetal register model of
+* the mixer. It is not a target example: it is built and run with the other
+* driver model tests by make -C scripts/host_model.
+*
+* Two instances of the same core are taken through the same random sequence
+* of CC additions, removals, NCO moves and retunes, auxiliary NCO retunes and
+* antenna changes, one with XDfeMix_GetCurrentCCCfg() and
+* XDfeMix_SetNextCCCfgAndTrigger() and one with a transaction compiled from
+* the previous CC configuration. After every change the register images and
+* the lowest unused CCID of both instances must be the same, and the
+* transaction must not write a register with the value it already holds,
+* but for the NCO update requests and the NCOs the previous configuration
+* did not use.
+*
+* The time, register reads and register writes of adding and removing a CC
+* are printed for both ways, with the register model answering at once and
+* with a bus latency per access.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 1.7   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <metal/device.h>
+#include "xdfemix.h"
+#include "xdfemix_hw.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define REGION_SIZE	0x10000U	/* Register space of a core */
+#define NUM_NCOS	8U		/* CC NCOs of the core */
+#define NUM_CCS		4U		/* CCs added and removed */
+#define NUM_CHANGES	500U		/* Changes of the random sequence */
+#define ACCESS_NS	100U		/* Bus latency of a register access */
+#define NUM_RUNS	20000U		/* Changes timed without latency */
+#define NUM_SLOW_RUNS	200U		/* Changes timed with latency */
+#define NUM_BENCHES	2U
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define CORE(io)	((io) == &Io[0] ? 0U : 1U)
+
+/**************************** Type Definitions *******************************/
+
+typedef enum {
+	CHANGE_TOGGLE_CC = 0,
+	CHANGE_UPDATE_CC,
+	CHANGE_NCO,
+	CHANGE_TOGGLE_ANTENNA,
+	CHANGE_NUM
+} Change;
+
+typedef struct {
+	Change Kind;
+	s32 Id; /* CCID, NCO of a CC or auxiliary NCO, or antenna */
+	XDfeMix_CarrierCfg CarrierCfg;
+	XDfeMix_NCO NCO;
+} Step;
+
+/************************** Function Prototypes ******************************/
+
+static void CoreInit(u32 Core);
+static void RandomNCO(XDfeMix_NCO *NCO);
+static u32 FreeNCO(const XDfeMix_CCCfg *CCCfg, u32 Start);
+static u32 UsedNCOs(const XDfeMix_CCCfg *CCCfg);
+static u32 IsNCOUpdate(u32 Offset);
+static void ChangeCCCfg(XDfeMix *InstancePtr, XDfeMix_CCCfg *CCCfg,
+			const Step *StepPtr);
+static void LegacyChange(const Step *StepPtr);
+static void TransactionChange(const Step *StepPtr);
+static void CompareCores(u32 Number);
+
+/************************** Variable Definitions *****************************/
+
+static u8 Regs[2][REGION_SIZE];
+static struct metal_io_region Io[2];
+static XDfeMix Mix[2];
+static XDfeMix_CCCfg Curr;
+static XDfeMix_Transaction Transaction[2];
+static u32 AccessNs;
+static u32 Reads;
+static u32 Writes;
+static u32 Logging;
+static u32 LoggedNCOs;
+static u32 Redundant;
+static u32 UpdatedNCOs[2];
+
+/* Configuration table and devices of the SDT and baremetal initialization,
+ * the instances are set up by hand */
+XDfeMix_Config XDfeMix_ConfigTable[XDFEMIX_MAX_NUM_INSTANCES] = { { NULL } };
+struct metal_device XDfeMix_CustomDevice[XDFEMIX_MAX_NUM_INSTANCES];
+metal_phys_addr_t XDfeMix_metal_phys[XDFEMIX_MAX_NUM_INSTANCES];
+
+/*****************************************************************************/
+/*
+* Register model: plain memory for each instance, with a bus latency per
+* access. A CC update trigger copies the NEXT registers to the CURRENT ones
+* and clears its enable bit. The writes to the second instance which do not
+* change a register are counted while a transaction is set, in the NCOs
+* of LoggedNCOs, and the NCOs with a frequency and a phase update request
+* are recorded.
+*/
+uint64_t metal_io_read(struct metal_io_region *io, unsigned long offset,
+		       int width)
+{
+	uint64_t Value = 0U;
+	u64 StartNs = XHostModel_TimeNs();
+
+	while ((XHostModel_TimeNs() - StartNs) < AccessNs) {
+	}
+	Reads++;
+	memcpy(&Value, &Regs[CORE(io)][offset], (size_t)width);
+	return Value;
+}
+
+void metal_io_write(struct metal_io_region *io, unsigned long offset,
+		    uint64_t value, int width)
+{
+	u8 *Core = Regs[CORE(io)];
+	u32 Logged = Logging && (CORE(io) == 1U) &&
+		     (offset != XDFEMIX_TRIGGERS_CC_UPDATE_OFFSET);
+	u32 NCOIdx;
+	u64 StartNs = XHostModel_TimeNs();
+
+	while ((XHostModel_TimeNs() - StartNs) < AccessNs) {
+	}
+	Writes++;
+	if (offset >= XDFEMIX_FREQ_CONTROL_WORD) {
+		NCOIdx = (offset - XDFEMIX_FREQ_CONTROL_WORD) /
+			 XDFEMIX_PHAC_CCID_ADDR_STEP;
+		if (Logged && IsNCOUpdate(offset)) {
+			UpdatedNCOs[(offset % XDFEMIX_PHAC_CCID_ADDR_STEP) ==
+				    (XDFEMIX_PHASE_UPDATE %
+				     XDFEMIX_PHAC_CCID_ADDR_STEP)] |= 1U << NCOIdx;
+		}
+		Logged = Logged && !IsNCOUpdate(offset) &&
+			 ((LoggedNCOs >> NCOIdx) & 1U);
+	}
+	if (Logged && (memcmp(&Core[offset], &value, (size_t)width) == 0)) {
+		Redundant++;
+	}
+	memcpy(&Core[offset], &value, (size_t)width);
+
+	if ((offset == XDFEMIX_TRIGGERS_CC_UPDATE_OFFSET) && (value & 1U)) {
+		memcpy(&Core[XDFEMIX_SEQUENCE_LENGTH_CURRENT],
+		       &Core[XDFEMIX_SEQUENCE_LENGTH_NEXT], sizeof(u32));
+		memcpy(&Core[XDFEMIX_SEQUENCE_CURRENT],
+		       &Core[XDFEMIX_SEQUENCE_NEXT],
+		       XDFEMIX_SEQ_LENGTH_MAX * sizeof(u32));
+		memcpy(&Core[XDFEMIX_CC_CONFIG_CURRENT],
+		       &Core[XDFEMIX_CC_CONFIG_NEXT],
+		       XDFEMIX_CC_NUM * sizeof(u32));
+		memcpy(&Core[XDFEMIX_AUXILIARY_ENABLE_CURRENT],
+		       &Core[XDFEMIX_AUXILIARY_ENABLE_NEXT],
+		       XDFEMIX_AUX_NCO_MAX * sizeof(u32));
+		memcpy(&Core[XDFEMIX_ANTENNA_GAIN_CURRENT],
+		       &Core[XDFEMIX_ANTENNA_GAIN_NEXT], sizeof(u32));
+		Core[offset] &= ~1U;
+	}
+}
+
+/*****************************************************************************/
+/*
+* A downlink core with 8 antennas, 8 CC NCOs on one lane and 4 auxiliary
+* NCOs, taken through reset, configuration, initialization and activation
+* with a sequence length of 16.
+*/
+static void CoreInit(u32 Core)
+{
+	XDfeMix_Cfg Cfg;
+	XDfeMix_Init Init;
+	XDfeMix *InstancePtr = &Mix[Core];
+
+	memset(Regs[Core], 0, sizeof(Regs[Core]));
+	memset(InstancePtr, 0, sizeof(*InstancePtr));
+	metal_io_init(&Io[Core], Regs[Core], NULL, REGION_SIZE, (unsigned)(-1),
+		      0U, NULL);
+	InstancePtr->Io = &Io[Core];
+	InstancePtr->StateId = XDFEMIX_STATE_READY;
+	XDfeMix_WriteReg(InstancePtr, XDFEMIX_MODEL_PARAM_1_OFFSET,
+			 (8U << XDFEMIX_MODEL_PARAM_1_NUM_ANTENNA_OFFSET) |
+			 (NUM_NCOS <<
+			  XDFEMIX_MODEL_PARAM_1_MAX_USEABLE_CCIDS_OFFSET) |
+			 (1U << XDFEMIX_MODEL_PARAM_1_LANES_OFFSET) |
+			 (1U << XDFEMIX_MODEL_PARAM_1_ANTENNA_INTERLEAVE_OFFSET) |
+			 (1U << XDFEMIX_MODEL_PARAM_1_MIXER_CPS_OFFSET) |
+			 (XDFEMIX_AUX_NCO_MAX <<
+			  XDFEMIX_MODEL_PARAM_1_NUM_AUXILIARY_OFFSET));
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	memset(&Init, 0, sizeof(Init));
+	Init.Sequence.Length = XDFEMIX_SEQ_LENGTH_MAX;
+	XDfeMix_Reset(InstancePtr);
+	XDfeMix_Configure(InstancePtr, &Cfg);
+	XDfeMix_Initialize(InstancePtr, &Init);
+	XDfeMix_Activate(InstancePtr, false);
+	XHOST_CHECK((InstancePtr->StateId == XDFEMIX_STATE_OPERATIONAL) &&
+		    (InstancePtr->Config.MaxUseableCcids == NUM_NCOS),
+		    "core %u: initialization", (unsigned)Core);
+}
+
+static void RandomNCO(XDfeMix_NCO *NCO)
+{
+	NCO->FrequencyCfg.FrequencyControlWord = (u32)rand();
+	NCO->FrequencyCfg.SingleModCount = (u32)rand();
+	NCO->FrequencyCfg.DualModCount = (u32)rand();
+	NCO->FrequencyCfg.PhaseOffset.PhaseOffset = (u32)rand() & 0x1FFFFU;
+	NCO->FrequencyCfg.TriggerUpdateFlag = XDFEMIX_TRIGGER_UPDATE;
+	NCO->PhaseCfg.PhaseAcc = (u32)rand();
+	NCO->PhaseCfg.DualModCount = (u32)rand();
+	NCO->PhaseCfg.DualModSel = (u32)rand() & 1U;
+	NCO->PhaseCfg.TriggerUpdateFlag = XDFEMIX_TRIGGER_UPDATE;
+	NCO->NCOGain = (u32)rand() & 3U;
+}
+
+/*****************************************************************************/
+/*
+* First CC NCO from Start on, in a circle, that no CC uses.
+*/
+static u32 FreeNCO(const XDfeMix_CCCfg *CCCfg, u32 Start)
+{
+	u32 NCOIdx = Start;
+
+	while ((UsedNCOs(CCCfg) >> NCOIdx) & 1U) {
+		NCOIdx = (NCOIdx + 1U) % NUM_NCOS;
+	}
+
+	return NCOIdx;
+}
+
+/*****************************************************************************/
+/*
+* Bitmap of the NCOs used by the active CCs and of the enabled auxiliary
+* NCOs.
+*/
+static u32 UsedNCOs(const XDfeMix_CCCfg *CCCfg)
+{
+	u32 Used = 0U;
+	u32 Index;
+
+	for (Index = 0U; Index < XDFEMIX_CC_NUM; Index++) {
+		if (CCCfg->DUCDDCCfg[Index].Rate != 0U) {
+			Used |= 1U << CCCfg->DUCDDCCfg[Index].NCOIdx;
+		}
+	}
+	for (Index = 0U; Index < XDFEMIX_AUX_NCO_MAX; Index++) {
+		if (CCCfg->AuxiliaryCfg[Index].Enable != 0U) {
+			Used |= 1U << (XDFEMIX_CC_NUM + Index);
+		}
+	}
+
+	return Used;
+}
+
+static u32 IsNCOUpdate(u32 Offset)
+{
+	u32 Reg = XDFEMIX_FREQ_CONTROL_WORD +
+		  ((Offset - XDFEMIX_FREQ_CONTROL_WORD) %
+		   XDFEMIX_PHAC_CCID_ADDR_STEP);
+
+	return (Reg == XDFEMIX_FREQ_UPDATE) || (Reg == XDFEMIX_PHASE_UPDATE);
+}
+
+/*****************************************************************************/
+/*
+* One change of a CC configuration: CC Id, on its own 4 sequence slots, is
+* added or removed, or moved to another NCO, or the NCO of CC Id or of
+* auxiliary NCO Id - NUM_CCS is retuned, or antenna Id is switched between
+* 0 and -6 dB.
+*/
+static void ChangeCCCfg(XDfeMix *InstancePtr, XDfeMix_CCCfg *CCCfg,
+			const Step *StepPtr)
+{
+	static const XDfeMix_AuxiliaryCfg AuxCfg = { 1U, 2U };
+	XDfeMix_AntennaCfg AntennaCfg;
+	s32 Id = StepPtr->Id;
+	u32 Active = (Id < (s32)NUM_CCS) && (CCCfg->DUCDDCCfg[Id].Rate != 0U);
+
+	switch (StepPtr->Kind) {
+	case CHANGE_TOGGLE_CC:
+		if (Active) {
+			XDfeMix_RemoveCCfromCCCfg(InstancePtr, CCCfg, Id);
+		} else {
+			XHOST_CHECK(XDfeMix_AddCCtoCCCfg(InstancePtr, CCCfg,
+							 Id, 0xFU << (4 * Id),
+							 &StepPtr->CarrierCfg,
+							 &StepPtr->NCO) ==
+				    XST_SUCCESS, "CC %d: add", (int)Id);
+		}
+		break;
+	case CHANGE_UPDATE_CC:
+		if (Active) {
+			XHOST_CHECK(XDfeMix_UpdateCCinCCCfg(
+					    InstancePtr, CCCfg, Id,
+					    &StepPtr->CarrierCfg) ==
+				    XST_SUCCESS, "CC %d: update", (int)Id);
+		}
+		break;
+	case CHANGE_NCO:
+		if (Active) {
+			CCCfg->NCO[CCCfg->DUCDDCCfg[Id].NCOIdx] = StepPtr->NCO;
+		} else if (Id >= (s32)NUM_CCS) {
+			XDfeMix_AddAuxNCOtoCCCfg(InstancePtr, CCCfg,
+						 Id - (s32)NUM_CCS,
+						 &StepPtr->NCO, &AuxCfg);
+		}
+		break;
+	default:
+		AntennaCfg = CCCfg->AntennaCfg;
+		AntennaCfg.Gain[Id] ^= 1U;
+		XDfeMix_SetAntennaCfgInCCCfg(InstancePtr, CCCfg, &AntennaCfg);
+		break;
+	}
+}
+
+/*****************************************************************************/
+/*
+* A change as done without transaction: the CC configuration is read back,
+* changed and written as a whole.
+*/
+static void LegacyChange(const Step *StepPtr)
+{
+	XDfeMix_CCCfg CCCfg;
+
+	memset(&CCCfg, 0, sizeof(CCCfg));
+	XDfeMix_GetCurrentCCCfg(&Mix[0], &CCCfg);
+	ChangeCCCfg(&Mix[0], &CCCfg, StepPtr);
+	(void)XDfeMix_SetNextCCCfgAndTrigger(&Mix[0], &CCCfg);
+}
+
+static void TransactionChange(const Step *StepPtr)
+{
+	XDfeMix_CCCfg Next = Curr;
+
+	ChangeCCCfg(&Mix[1], &Next, StepPtr);
+	XDfeMix_CompileCCCfg(&Mix[1], &Curr, &Next, &Transaction[0]);
+	XHOST_CHECK(Transaction[0].NumWrites < XDFEMIX_TRANSACTION_WRITES_MAX,
+		    "%u writes", (unsigned)Transaction[0].NumWrites);
+	LoggedNCOs = UsedNCOs(&Curr);
+	Redundant = 0U;
+	UpdatedNCOs[0] = 0U;
+	UpdatedNCOs[1] = 0U;
+	Logging = 1U;
+	(void)XDfeMix_SetTransactionAndTrigger(&Mix[1], &Transaction[0]);
+	Logging = 0U;
+	XHOST_CHECK(Redundant == 0U, "%u redundant writes",
+		    (unsigned)Redundant);
+	XHOST_CHECK((UpdatedNCOs[0] == UsedNCOs(&Next)) &&
+		    (UpdatedNCOs[1] == UsedNCOs(&Next)),
+		    "NCOs 0x%05x and 0x%05x updated, 0x%05x used",
+		    (unsigned)UpdatedNCOs[0], (unsigned)UpdatedNCOs[1],
+		    (unsigned)UsedNCOs(&Next));
+	Curr = Next;
+}
+
+/*****************************************************************************/
+/*
+* XDfeMix_SetNextCCCfgAndTrigger() writes the enables of all the auxiliary
+* NCOs to the first one again, and XDfeMix_GetCurrentCCCfg() does not read
+* back the NCO update requests: these registers are left out.
+*/
+static void CompareCores(u32 Number)
+{
+	u32 Offset;
+	u32 Value[2];
+
+	for (Offset = 0U; Offset < REGION_SIZE; Offset += 4U) {
+		if ((Offset == XDFEMIX_AUXILIARY_ENABLE_CURRENT) ||
+		    (Offset == XDFEMIX_AUXILIARY_ENABLE_NEXT) ||
+		    ((Offset >= XDFEMIX_FREQ_CONTROL_WORD) &&
+		     IsNCOUpdate(Offset))) {
+			continue;
+		}
+		memcpy(&Value[0], &Regs[0][Offset], sizeof(u32));
+		memcpy(&Value[1], &Regs[1][Offset], sizeof(u32));
+		if (Value[0] != Value[1]) {
+			XHOST_CHECK(0, "change %u: register 0x%04x is 0x%08x, "
+				    "0x%08x without transaction",
+				    (unsigned)Number, (unsigned)Offset,
+				    (unsigned)Value[1], (unsigned)Value[0]);
+			return;
+		}
+	}
+	XHOST_CHECK(Mix[0].NotUsedCCID == Mix[1].NotUsedCCID,
+		    "change %u: unused CCID %d, %d without transaction",
+		    (unsigned)Number, (int)Mix[1].NotUsedCCID,
+		    (int)Mix[0].NotUsedCCID);
+}
+
+int main(void)
+{
+	static const u32 Bench[NUM_BENCHES][2] = {
+		{ 0U, NUM_RUNS }, { ACCESS_NS, NUM_SLOW_RUNS }
+	};
+	static const u32 NumIds[CHANGE_NUM] = {
+		NUM_CCS, NUM_CCS, NUM_CCS + XDFEMIX_AUX_NCO_MAX,
+		XDFEMIX_ANT_NUM_MAX
+	};
+	XDfeMix_AntennaCfg AntennaCfg;
+	XDfeMix_CCCfg CCCfg;
+	XDfeMix_CCCfg Next;
+	Step Action;
+	u64 StartNs;
+	u64 Time[2];
+	u32 Count[2][2];
+	u32 NumFull;
+	u32 Runs;
+	u32 Run;
+	u32 Index;
+
+	CoreInit(0U);
+	CoreInit(1U);
+	srand(1U);
+
+	/* Both instances start from no CC and all the auxiliary NCOs enabled
+	   with the same gain, as XDfeMix_SetNextCCCfgAndTrigger() leaves the
+	   last one in the first auxiliary enable */
+	XDfeMix_GetEmptyCCCfg(&Mix[0], &CCCfg);
+	for (Index = 0U; Index < XDFEMIX_ANT_NUM_MAX; Index++) {
+		AntennaCfg.Gain[Index] = Index % 2U;
+	}
+	XDfeMix_SetAntennaCfgInCCCfg(&Mix[0], &CCCfg, &AntennaCfg);
+	memset(&Action, 0, sizeof(Action));
+	Action.Kind = CHANGE_NCO;
+	for (Index = 0U; Index < XDFEMIX_AUX_NCO_MAX; Index++) {
+		Action.Id = NUM_CCS + Index;
+		RandomNCO(&Action.NCO);
+		ChangeCCCfg(&Mix[0], &CCCfg, &Action);
+	}
+	(void)XDfeMix_SetNextCCCfgAndTrigger(&Mix[0], &CCCfg);
+	Curr = CCCfg;
+	XDfeMix_CompileCCCfg(&Mix[1], NULL, &Curr, &Transaction[0]);
+	NumFull = Transaction[0].NumWrites;
+	(void)XDfeMix_SetTransactionAndTrigger(&Mix[1], &Transaction[0]);
+	CompareCores(0U);
+
+	for (Index = 1U; Index <= NUM_CHANGES; Index++) {
+		Action.Kind = (Change)((u32)rand() % CHANGE_NUM);
+		Action.Id = (s32)((u32)rand() % NumIds[Action.Kind]);
+		Action.CarrierCfg.DUCDDCCfg.NCOIdx =
+			FreeNCO(&Curr, (u32)rand() % NUM_NCOS);
+		Action.CarrierCfg.DUCDDCCfg.CCGain = (u32)rand() % 4U;
+		RandomNCO(&Action.NCO);
+		LegacyChange(&Action);
+		TransactionChange(&Action);
+		CompareCores(Index);
+	}
+
+	/* A pending update is refused and leaves the unused CCID */
+	metal_set_log_level(METAL_LOG_EMERGENCY);
+	Regs[1][XDFEMIX_ISR] |= 1U << XDFEMIX_CC_UPDATE_TRIGGERED_OFFSET;
+	Mix[1].NotUsedCCID = -1;
+	XHOST_CHECK((XDfeMix_SetTransactionAndTrigger(&Mix[1],
+						       &Transaction[0]) ==
+		     XST_FAILURE) && (Mix[1].NotUsedCCID == -1),
+		    "CC update pending");
+	metal_set_log_level(METAL_LOG_ERROR);
+	Regs[1][XDFEMIX_ISR] = 0U;
+	Mix[1].NotUsedCCID = Mix[0].NotUsedCCID;
+	XHOST_CHECK(XHostModel_AssertCount == 0U, "%u assertions",
+		    (unsigned)XHostModel_AssertCount);
+
+	/* Add and remove the last CC, compiled once */
+	Action.Kind = CHANGE_TOGGLE_CC;
+	Action.Id = NUM_CCS - 1U;
+	Action.CarrierCfg.DUCDDCCfg.NCOIdx = FreeNCO(&Curr, 0U);
+	Next = Curr;
+	ChangeCCCfg(&Mix[1], &Next, &Action);
+	XDfeMix_CompileCCCfg(&Mix[1], &Curr, &Next, &Transaction[0]);
+	XDfeMix_CompileCCCfg(&Mix[1], &Next, &Curr, &Transaction[1]);
+	printf("transaction writes: %u full, %u and %u to toggle CC %u\n",
+	       (unsigned)NumFull, (unsigned)Transaction[0].NumWrites,
+	       (unsigned)Transaction[1].NumWrites, (unsigned)(NUM_CCS - 1U));
+
+	/* Benchmark, without and with bus latency */
+	for (Index = 0U; Index < NUM_BENCHES; Index++) {
+		AccessNs = Bench[Index][0];
+		Runs = Bench[Index][1];
+		Reads = 0U;
+		Writes = 0U;
+		StartNs = XHostModel_TimeNs();
+		for (Run = 0U; Run < Runs; Run++) {
+			LegacyChange(&Action);
+		}
+		Time[0] = XHostModel_TimeNs() - StartNs;
+		Count[0][0] = Reads / Runs;
+		Count[0][1] = Writes / Runs;
+		Reads = 0U;
+		Writes = 0U;
+		StartNs = XHostModel_TimeNs();
+		for (Run = 0U; Run < Runs; Run++) {
+			(void)XDfeMix_SetTransactionAndTrigger(
+				&Mix[1], &Transaction[Run % 2U]);
+		}
+		Time[1] = XHostModel_TimeNs() - StartNs;
+		Count[1][0] = Reads / Runs;
+		Count[1][1] = Writes / Runs;
+		printf("%3u ns per access: CC configuration %.2f us (%u reads "
+		       "%u writes), transaction %.2f us (%u reads %u writes)\n",
+		       (unsigned)AccessNs, (double)Time[0] / Runs / 1000.0,
+		       (unsigned)Count[0][0], (unsigned)Count[0][1],
+		       (double)Time[1] / Runs / 1000.0, (unsigned)Count[1][0],
+		       (unsigned)Count[1][1]);
+		XHOST_CHECK((Count[1][0] < Count[0][0]) &&
+			    (Count[1][1] < Count[0][1]),
+			    "transaction: %u reads %u writes",
+			    (unsigned)Count[1][0], (unsigned)Count[1][1]);
+	}
+
+	return XHostModel_Report("xdfemix_transaction_model_test");
+}
@@ -63,6 +63,7 @@
 *       dc     08/28/23 Remove immediate trigger
 * 1.7   cog    01/29/24 Yocto SDT support
 *       dc     03/01/24 Update version number in makefiles
+*       kt     10/18/26 Add precompiled CC configuration transactions
 * </pre>
 * @addtogroup dfemix Overview
 * @{
@@ -102,6 +103,10 @@
 	(InstancePtr->Config.MaxUseableCcids ==                                \
 	 16U) /* Arch5 mode logical statement */
 #define XDFEMIX_NCO_LOW_SUB_BLOCK_SIZE (4U) /**< NCO low sub-block size */
+#define XDFEMIX_CC_CFG_WRITES                                                  \
+	(2U + (2U * XDFEMIX_CC_NUM) + XDFEMIX_AUX_NCO_MAX) /**< Carrier
+		configuration writes of a transaction */
+#define XDFEMIX_NCO_WRITES (10U) /**< Register writes of an NCO */
 #define XDFEMIX_DOWNLINK 0U /**< Downlink flag used in switchable mode */
 #define XDFEMIX_UPLINK 1U /**< Uplink flag used in switchable mode */
 /**
@@ -1112,6 +1117,253 @@ static void XDfeMix_SetNextCCCfg(const XDfeMix *InstancePtr,
 	XDfeMix_WriteReg(InstancePtr, XDFEMIX_ANTENNA_GAIN_NEXT, AntennaCfg);
 }
 
+/****************************************************************************/
+/**
+*
+* Gets one carrier configuration register write of a CC configuration. A CC
+* configuration is always XDFEMIX_CC_CFG_WRITES writes to the same NEXT
+* registers in the same order, so the writes of two configurations compare
+* one by one.
+*
+* @param    InstancePtr Pointer to the Mixer instance.
+* @param    CCCfg CC configuration container.
+* @param    Write Write number, in the order the registers are written.
+* @param    Offset Register offset of the write.
+*
+* @return   Value to be written.
+*
+****************************************************************************/
+static u32 XDfeMix_GetCCCfgWrite(const XDfeMix *InstancePtr,
+				 const XDfeMix_CCCfg *CCCfg, u32 Write,
+				 u32 *Offset)
+{
+	u32 AntennaCfg = 0U;
+	u32 Data;
+	u32 Index;
+
+	/* Sequence Length should remain the same */
+	if (Write == 0U) {
+		*Offset = XDFEMIX_SEQUENCE_LENGTH_NEXT;
+		if (InstancePtr->SequenceLength == 0) {
+			return 0U;
+		}
+		return InstancePtr->SequenceLength - 1U;
+	}
+
+	/* Antenna configuration */
+	if (Write == (XDFEMIX_CC_CFG_WRITES - 1U)) {
+		for (Index = 0; Index < XDFEMIX_ANT_NUM_MAX; Index++) {
+			AntennaCfg += (CCCfg->AntennaCfg.Gain[Index] << Index);
+		}
+		*Offset = XDFEMIX_ANTENNA_GAIN_NEXT;
+		return AntennaCfg;
+	}
+
+	/* Auxiliary's configuration */
+	if (Write > (2U * XDFEMIX_CC_NUM)) {
+		Index = Write - (2U * XDFEMIX_CC_NUM) - 1U;
+		Data = XDfeMix_WrBitField(
+			XDFEMIX_AUXILIARY_ENABLE_ENABLE_WIDTH,
+			XDFEMIX_AUXILIARY_ENABLE_ENABLE_OFFSET, 0U,
+			CCCfg->AuxiliaryCfg[Index].Enable);
+		Data = XDfeMix_WrBitField(XDFEMIX_AUXILIARY_ENABLE_GAIN_WIDTH,
+					  XDFEMIX_AUXILIARY_ENABLE_GAIN_OFFSET,
+					  Data, CCCfg->AuxiliaryCfg[Index].AuxGain);
+		*Offset = XDFEMIX_AUXILIARY_ENABLE_NEXT + (Index * sizeof(u32));
+		return Data;
+	}
+
+	/* CCID sequence and carrier configuration of a sequence index */
+	Index = (Write - 1U) / 2U;
+	if (((Write - 1U) % 2U) == 0U) {
+		*Offset = XDFEMIX_SEQUENCE_NEXT + (sizeof(u32) * Index);
+		if ((CCCfg->Sequence.CCID[Index] ==
+		     XDFEMIX_SEQUENCE_ENTRY_NULL) ||
+		    (Index >= InstancePtr->SequenceLength)) {
+			return (u32)CCCfg->Sequence.NotUsedCCID;
+		}
+		return (u32)CCCfg->Sequence.CCID[Index];
+	}
+
+	Data = XDfeMix_WrBitField(XDFEMIX_CC_CONFIG_NCO_WIDTH,
+				  XDFEMIX_CC_CONFIG_NCO_OFFSET, 0U,
+				  CCCfg->DUCDDCCfg[Index].NCOIdx);
+	Data = XDfeMix_WrBitField(XDFEMIX_CC_CONFIG_RATE_WIDTH,
+				  XDFEMIX_CC_CONFIG_RATE_OFFSET, Data,
+				  CCCfg->DUCDDCCfg[Index].Rate);
+	Data = XDfeMix_WrBitField(XDFEMIX_CC_CONFIG_CC_GAIN_WIDTH,
+				  XDFEMIX_CC_CONFIG_CC_GAIN_OFFSET, Data,
+				  CCCfg->DUCDDCCfg[Index].CCGain);
+	*Offset = XDFEMIX_CC_CONFIG_NEXT + (Index * sizeof(u32));
+	return Data;
+}
+
+/****************************************************************************/
+/**
+*
+* Gets one register write of an NCO. The registers of an NCO are always
+* XDFEMIX_NCO_WRITES writes in the same order.
+*
+* @param    NCO NCO configuration container.
+* @param    Write Write number, in the order the registers are written.
+* @param    Offset Register offset of the write, for the first NCO.
+*
+* @return   Value to be written.
+*
+****************************************************************************/
+static u32 XDfeMix_GetNCOWrite(const XDfeMix_NCO *NCO, u32 Write, u32 *Offset)
+{
+	switch (Write) {
+	case 0U:
+		*Offset = XDFEMIX_FREQ_CONTROL_WORD;
+		return NCO->FrequencyCfg.FrequencyControlWord;
+	case 1U:
+		*Offset = XDFEMIX_FREQ_SINGLE_MOD_COUNT;
+		return NCO->FrequencyCfg.SingleModCount;
+	case 2U:
+		*Offset = XDFEMIX_FREQ_DUAL_MOD_COUNT;
+		return NCO->FrequencyCfg.DualModCount;
+	case 3U:
+		*Offset = XDFEMIX_FREQ_PHASE_OFFSET;
+		return NCO->FrequencyCfg.PhaseOffset.PhaseOffset;
+	case 4U:
+		*Offset = XDFEMIX_FREQ_UPDATE;
+		return NCO->FrequencyCfg.TriggerUpdateFlag;
+	case 5U:
+		*Offset = XDFEMIX_PHASE_UPDATE_ACC;
+		return NCO->PhaseCfg.PhaseAcc;
+	case 6U:
+		*Offset = XDFEMIX_PHASE_UPDATE_DUAL_MOD_COUNT;
+		return NCO->PhaseCfg.DualModCount;
+	case 7U:
+		*Offset = XDFEMIX_PHASE_UPDATE_DUAL_MOD_SEL;
+		return NCO->PhaseCfg.DualModSel;
+	case 8U:
+		*Offset = XDFEMIX_PHASE_UPDATE;
+		return NCO->PhaseCfg.TriggerUpdateFlag;
+	default:
+		*Offset = XDFEMIX_NCO_GAIN;
+		return NCO->NCOGain;
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Checks whether a CC configuration uses an NCO, either as the NCO of an
+* active CC or as an enabled auxiliary NCO.
+*
+* @param    InstancePtr Pointer to the Mixer instance.
+* @param    CCCfg CC configuration container.
+* @param    NCOIdx NCO index.
+*
+* @return   true if the NCO is used.
+*
+****************************************************************************/
+static bool XDfeMix_IsNCOUsed(const XDfeMix *InstancePtr,
+			      const XDfeMix_CCCfg *CCCfg, u32 NCOIdx)
+{
+	u32 Index;
+
+	if ((NCOIdx >= XDFEMIX_CC_NUM) &&
+	    (CCCfg->AuxiliaryCfg[NCOIdx - XDFEMIX_CC_NUM].Enable !=
+	     XDFEMIX_AUXILIARY_ENABLE_DISABLED)) {
+		return true;
+	}
+	if (NCOIdx >= InstancePtr->Config.MaxUseableCcids) {
+		return false;
+	}
+	for (Index = 0U; Index < XDFEMIX_CC_NUM; Index++) {
+		if ((CCCfg->DUCDDCCfg[Index].Rate !=
+		     XDFEMIX_CC_CONFIG_DISABLED) &&
+		    (CCCfg->DUCDDCCfg[Index].NCOIdx == NCOIdx)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/****************************************************************************/
+/**
+*
+* Gets the register writes of the next CC configuration, both the carrier
+* configuration NEXT registers and the registers of the NCOs it uses. The
+* NCO registers follow the carrier configuration, by NCO index.
+*
+* @param    InstancePtr Pointer to the Mixer instance.
+* @param    NextCCCfg Next CC configuration container.
+* @param    Transaction Transaction container, filled with all the writes.
+*
+****************************************************************************/
+static void XDfeMix_GetNextCCCfgWrites(const XDfeMix *InstancePtr,
+				       const XDfeMix_CCCfg *NextCCCfg,
+				       XDfeMix_Transaction *Transaction)
+{
+	u32 Index;
+	u32 NCOIdx;
+	u32 Write;
+	u32 Offset;
+
+	for (Write = 0U; Write < XDFEMIX_CC_CFG_WRITES; Write++) {
+		Transaction->Data[Write] = XDfeMix_GetCCCfgWrite(
+			InstancePtr, NextCCCfg, Write,
+			&Transaction->Offset[Write]);
+	}
+	Transaction->NumWrites = XDFEMIX_CC_CFG_WRITES;
+	Transaction->NotUsedCCID = NextCCCfg->Sequence.NotUsedCCID;
+
+	for (Index = 0U; Index < XDFEMIX_CC_NUM; Index++) {
+		if ((NextCCCfg->DUCDDCCfg[Index].Rate !=
+		     XDFEMIX_CC_CONFIG_DISABLED) &&
+		    (NextCCCfg->DUCDDCCfg[Index].NCOIdx >=
+		     InstancePtr->Config.MaxUseableCcids)) {
+			metal_log(METAL_LOG_ERROR,
+				  "NCOIdx %d is greater than %d\n",
+				  NextCCCfg->DUCDDCCfg[Index].NCOIdx,
+				  InstancePtr->Config.MaxUseableCcids);
+		}
+	}
+
+	/* Write CC and auxiliary NCO registers */
+	for (NCOIdx = 0U; NCOIdx < XDFEMIX_NCO_MAX; NCOIdx++) {
+		if (false == XDfeMix_IsNCOUsed(InstancePtr, NextCCCfg, NCOIdx)) {
+			continue;
+		}
+		for (Write = 0U; Write < XDFEMIX_NCO_WRITES; Write++) {
+			Transaction->Data[Transaction->NumWrites] =
+				XDfeMix_GetNCOWrite(&NextCCCfg->NCO[NCOIdx],
+						    Write, &Offset);
+			Transaction->Offset[Transaction->NumWrites] =
+				Offset + (NCOIdx * XDFEMIX_PHAC_CCID_ADDR_STEP);
+			Transaction->NumWrites++;
+		}
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Checks whether a register write is an NCO update request. Update requests
+* act on the write itself, so they are never left out of a transaction.
+*
+* @param    Offset Register offset.
+*
+* @return   true if the register is an NCO update request.
+*
+****************************************************************************/
+static bool XDfeMix_IsNCOUpdate(u32 Offset)
+{
+	u32 Reg;
+
+	if (Offset < XDFEMIX_FREQ_CONTROL_WORD) {
+		return false;
+	}
+	Reg = XDFEMIX_FREQ_CONTROL_WORD +
+	      ((Offset - XDFEMIX_FREQ_CONTROL_WORD) %
+	       XDFEMIX_PHAC_CCID_ADDR_STEP);
+	return ((Reg == XDFEMIX_FREQ_UPDATE) || (Reg == XDFEMIX_PHASE_UPDATE));
+}
+
 /****************************************************************************/
 /**
 *
@@ -2778,6 +3030,133 @@ u32 XDfeMix_SetNextCCCfgAndTriggerSwitchable(XDfeMix *InstancePtr,
 	return Return;
 }
 
+/****************************************************************************/
+/**
+*
+* Compiles a CC configuration into a transaction, the register writes that
+* change the shadow (NEXT) and NCO registers from the current CC
+* configuration to the next one. Only the registers which differ between the
+* two configurations are written, no register is read. The NCO update
+* requests of the active NCOs are always written. The writes of the current
+* configuration are computed one at a time while comparing, they are not
+* stored.
+*
+* The transaction can be set with XDfeMix_SetTransactionAndTrigger() any
+* number of times, on any Mixer instance with the same sequence length whose
+* registers hold the current CC configuration.
+*
+* @param    InstancePtr Pointer to the Mixer instance.
+* @param    CurrCCCfg Current CC configuration container, as last written to
+*           the registers. If NULL, all the registers are written.
+* @param    NextCCCfg Next CC configuration container.
+* @param    Transaction Transaction container.
+*
+* @note     Does not support switchable mode.
+*
+****************************************************************************/
+void XDfeMix_CompileCCCfg(const XDfeMix *InstancePtr,
+			  const XDfeMix_CCCfg *CurrCCCfg,
+			  const XDfeMix_CCCfg *NextCCCfg,
+			  XDfeMix_Transaction *Transaction)
+{
+	u32 NumWrites = 0U;
+	u32 Index;
+	u32 Write;
+	u32 NCOIdx;
+	u32 Offset;
+	bool Used = false;
+	bool Changed;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(NextCCCfg != NULL);
+	Xil_AssertVoid(Transaction != NULL);
+	Xil_AssertVoid(InstancePtr->Config.Mode !=
+		       XDFEMIX_MODEL_PARAM_1_SWITCHABLE);
+
+	XDfeMix_GetNextCCCfgWrites(InstancePtr, NextCCCfg, Transaction);
+	if (CurrCCCfg == NULL) {
+		return;
+	}
+
+	/* Drop the writes of values the registers already hold. The carrier
+	   configuration writes of both configurations compare one by one,
+	   the NCO writes compare with the same NCO of the current
+	   configuration, if it uses it */
+	for (Index = 0U; Index < Transaction->NumWrites; Index++) {
+		if (Index < XDFEMIX_CC_CFG_WRITES) {
+			Changed = (Transaction->Data[Index] !=
+				   XDfeMix_GetCCCfgWrite(InstancePtr, CurrCCCfg,
+							 Index, &Offset));
+		} else {
+			Write = (Index - XDFEMIX_CC_CFG_WRITES) %
+				XDFEMIX_NCO_WRITES;
+			NCOIdx = (Transaction->Offset[Index] -
+				  XDFEMIX_FREQ_CONTROL_WORD) /
+				 XDFEMIX_PHAC_CCID_ADDR_STEP;
+			if (Write == 0U) {
+				Used = XDfeMix_IsNCOUsed(InstancePtr, CurrCCCfg,
+							 NCOIdx);
+			}
+			Changed = ((Used == false) ||
+				   (true == XDfeMix_IsNCOUpdate(
+						    Transaction->Offset[Index])) ||
+				   (Transaction->Data[Index] !=
+				    XDfeMix_GetNCOWrite(&CurrCCCfg->NCO[NCOIdx],
+							Write, &Offset)));
+		}
+		if (Changed == true) {
+			Transaction->Offset[NumWrites] =
+				Transaction->Offset[Index];
+			Transaction->Data[NumWrites] = Transaction->Data[Index];
+			NumWrites++;
+		}
+	}
+	Transaction->NumWrites = NumWrites;
+}
+
+/****************************************************************************/
+/**
+*
+* Writes a compiled transaction to the shadow (NEXT) and NCO registers and
+* triggers copying from shadow to operational registers.
+*
+* @param    InstancePtr Pointer to the Mixer instance.
+* @param    Transaction Transaction container, see XDfeMix_CompileCCCfg().
+*
+* @return
+*           - XST_SUCCESS if successful.
+*           - XST_FAILURE if error occurs.
+*
+* @note     Clear event status with XDfeMix_ClearEventStatus() before
+*           running this API.
+*
+****************************************************************************/
+u32 XDfeMix_SetTransactionAndTrigger(XDfeMix *InstancePtr,
+				     const XDfeMix_Transaction *Transaction)
+{
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Transaction != NULL);
+	Xil_AssertNonvoid(Transaction->NumWrites <=
+			  XDFEMIX_TRANSACTION_WRITES_MAX);
+
+	for (Index = 0U; Index < Transaction->NumWrites; Index++) {
+		XDfeMix_WriteReg(InstancePtr, Transaction->Offset[Index],
+				 Transaction->Data[Index]);
+	}
+
+	/* Trigger the update */
+	if (XST_SUCCESS == XDfeMix_EnableCCUpdateTrigger(InstancePtr)) {
+		InstancePtr->NotUsedCCID = Transaction->NotUsedCCID;
+		return XST_SUCCESS;
+	}
+	metal_log(METAL_LOG_ERROR,
+		  "CC Update Trigger failed in %s. Restart the system\n",
+		  __func__);
+	return XST_FAILURE;
+}
+
 /****************************************************************************/
 /**
 *
@@ -86,6 +86,7 @@
 * 1.6   dc     06/15/23 Correct comment about gain
 *       cog    07/04/23 Add support for SDT
 * 1.7   cog    02/21/24 Fixed SDT runtime issue
+*       kt     10/18/26 Add precompiled CC configuration transactions
 *
 * </pre>
 * @endcond
@@ -161,6 +162,10 @@ extern "C" {
 #define XDFEMIX_AUX_NCO_MAX (4) /**< Maximum Fabric NCO number */
 #define XDFEMIX_NCO_MAX (20) /**< Maximum NCO number, 16 CC NCO + 4 aux NCO */
 #define XDFEMIX_CC_GAIN_MAX (3U) /**< Maximum CC gain */
+#define XDFEMIX_TRANSACTION_WRITES_MAX                                         \
+	(2U + (2U * XDFEMIX_SEQ_LENGTH_MAX) + XDFEMIX_AUX_NCO_MAX +            \
+	 (10U * XDFEMIX_NCO_MAX)) /**< Maximum number of register writes in a
+		transaction */
 
 /**************************** Type Definitions *******************************/
 /*********** start - common code to all Logiccores ************/
@@ -443,6 +448,18 @@ typedef struct {
 	XDfeMix_AntennaCfg AntennaCfg; /**< Antenna configuration */
 } XDfeMix_CCCfg;
 
+/**
+ * Precompiled CC configuration, the register writes from one CC
+ * configuration to another.
+ */
+typedef struct {
+	u32 NumWrites; /**< Number of register writes */
+	u32 Offset[XDFEMIX_TRANSACTION_WRITES_MAX]; /**< Register offsets */
+	u32 Data[XDFEMIX_TRANSACTION_WRITES_MAX]; /**< Register values */
+	s32 NotUsedCCID; /**< Lowest CCID number not allocated in the
+		compiled CC configuration */
+} XDfeMix_Transaction;
+
 /**
  * DUC/DDC status.
  */
@@ -602,6 +619,12 @@ u32 XDfeMix_SetNextCCCfgAndTrigger(XDfeMix *InstancePtr,
 u32 XDfeMix_SetNextCCCfgAndTriggerSwitchable(XDfeMix *InstancePtr,
 					     XDfeMix_CCCfg *CCCfgDownlink,
 					     XDfeMix_CCCfg *CCCfgUplink);
+void XDfeMix_CompileCCCfg(const XDfeMix *InstancePtr,
+			  const XDfeMix_CCCfg *CurrCCCfg,
+			  const XDfeMix_CCCfg *NextCCCfg,
+			  XDfeMix_Transaction *Transaction);
+u32 XDfeMix_SetTransactionAndTrigger(XDfeMix *InstancePtr,
+				     const XDfeMix_Transaction *Transaction);
 u32 XDfeMix_AddCC(XDfeMix *InstancePtr, s32 CCID, u32 CCSeqBitmap,
 		  const XDfeMix_CarrierCfg *CarrierCfg, const XDfeMix_NCO *NCO);
 u32 XDfeMix_RemoveCC(XDfeMix *InstancePtr, s32 CCID);
@@ -0,0 +1,538 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xdfeprach_transaction_model_test.c
+*
+* Host test and benchmark of XDfePrach_CompileCfg() and
+* XDfePrach_SetTransactionAndTrigger() against a libmetal register model of
+* the PRACH. It is not a target example: it is built and run with the other
+* driver model tests by make -C scripts/host_model.
+*
+* Two instances of the same two band core are taken through the same random
+* sequence of CC additions, removals and updates and of RC additions,
+* removals and updates, one with XDfePrach_GetCurrentCCCfg(),
+* XDfePrach_GetCurrentRCCfg() and XDfePrach_SetNextCfg() and one with a
+* transaction compiled from the previous configurations. After every change
+* the register images and the lowest unused CCIDs of both instances must be
+* the same, and the transaction must not write a register with the value it
+* already holds, but for the NCOs of the RACH channels the previous
+* configuration did not use.
+*
+* The time, register reads and register writes of adding and removing an RC
+* are printed for both ways, with the register model answering at once and
+* with a bus latency per access.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 1.7   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <metal/device.h>
+#include "xdfeprach.h"
+#include "xdfeprach_hw.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define REGION_SIZE	0x4000U		/* Register space of a core */
+#define NUM_BANDS	2U		/* Bands of the core */
+#define NUM_CCS		4U		/* CCs added and removed */
+#define NUM_RCS		8U		/* RCs added and removed */
+#define NUM_CHANGES	500U		/* Changes of the random sequence */
+#define ACCESS_NS	100U		/* Bus latency of a register access */
+#define NUM_RUNS	5000U		/* Changes timed without latency */
+#define NUM_SLOW_RUNS	50U		/* Changes timed with latency */
+#define NUM_BENCHES	2U
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define CORE(io)	((io) == &Io[0] ? 0U : 1U)
+#define CC_BAND(CCID)	((u32)(CCID) % NUM_BANDS)
+
+/**************************** Type Definitions *******************************/
+
+typedef enum {
+	CHANGE_TOGGLE_CC = 0,
+	CHANGE_UPDATE_CC,
+	CHANGE_TOGGLE_RC,
+	CHANGE_UPDATE_RC,
+	CHANGE_NUM
+} Change;
+
+typedef struct {
+	Change Kind;
+	u32 Id; /* CCID or RC Id */
+	s32 CCID; /* CC of an RC */
+	XDfePrach_CarrierCfg CarrierCfg;
+	XDfePrach_DDCCfg DdcCfg;
+	XDfePrach_NCO NcoCfg;
+	XDfePrach_Schedule Schedule;
+} Step;
+
+/************************** Function Prototypes ******************************/
+
+static void CoreInit(u32 Core);
+static void RandomStep(Step *StepPtr);
+static u32 UsedChannels(const XDfePrach_RCCfg *RCCfg);
+static void ChangeCfg(XDfePrach *InstancePtr, XDfePrach_CCCfg *CCCfg,
+		      XDfePrach_RCCfg *RCCfg, Step *StepPtr);
+static void LegacyChange(Step *StepPtr);
+static void TransactionChange(Step *StepPtr);
+static void CompareCores(u32 Number);
+
+/************************** Variable Definitions *****************************/
+
+static u8 Regs[2][REGION_SIZE];
+static struct metal_io_region Io[2];
+static XDfePrach Prach[2];
+static XDfePrach_CCCfg CurrCC;
+static XDfePrach_RCCfg CurrRC;
+static XDfePrach_Transaction Transaction[2];
+static u32 AccessNs;
+static u32 Reads;
+static u32 Writes;
+static u32 Logging;
+static u32 LoggedChannels;
+static u32 Redundant;
+
+/* Configuration table and devices of the SDT and baremetal initialization,
+ * the instances are set up by hand */
+XDfePrach_Config XDfePrach_ConfigTable[XDFEPRACH_MAX_NUM_INSTANCES] = {
+	{ NULL }
+};
+struct metal_device XDfePrach_CustomDevice[XDFEPRACH_MAX_NUM_INSTANCES];
+metal_phys_addr_t XDfePrach_metal_phys[XDFEPRACH_MAX_NUM_INSTANCES];
+
+/*****************************************************************************/
+/*
+* Register model: plain memory for each instance, with a bus latency per
+* access. A RACH update trigger copies the NEXT registers of all the bands
+* to the CURRENT ones and clears its enable bit. The writes to the second
+* instance which do not change a register are counted while a transaction
+* is set, in the NCOs of the RACH channels of LoggedChannels.
+*/
+uint64_t metal_io_read(struct metal_io_region *io, unsigned long offset,
+		       int width)
+{
+	uint64_t Value = 0U;
+	u64 StartNs = XHostModel_TimeNs();
+
+	while ((XHostModel_TimeNs() - StartNs) < AccessNs) {
+	}
+	Reads++;
+	memcpy(&Value, &Regs[CORE(io)][offset], (size_t)width);
+	return Value;
+}
+
+void metal_io_write(struct metal_io_region *io, unsigned long offset,
+		    uint64_t value, int width)
+{
+	u8 *Core = Regs[CORE(io)];
+	u32 Logged = Logging && (CORE(io) == 1U) &&
+		     (offset != XDFEPRACH_TRIGGERS_RACH_UPDATE_OFFSET) &&
+		     (offset != XDFEPRACH_TRIGGERS_FRAME_INIT_OFFSET(0U)) &&
+		     (offset != XDFEPRACH_TRIGGERS_FRAME_INIT_OFFSET(1U));
+	u32 BandId;
+	u64 StartNs = XHostModel_TimeNs();
+
+	while ((XHostModel_TimeNs() - StartNs) < AccessNs) {
+	}
+	Writes++;
+	if ((offset >= XDFEPRACH_FREQUENCY_CONTROL_WORD) &&
+	    (offset < (XDFEPRACH_FREQUENCY_CONTROL_WORD +
+		       (XDFEPRACH_NCO_NUM_MAX *
+			XDFEPRACH_NCO_CTRL_ADDR_STEP)))) {
+		Logged = Logged &&
+			 ((LoggedChannels >>
+			   ((offset - XDFEPRACH_FREQUENCY_CONTROL_WORD) /
+			    XDFEPRACH_NCO_CTRL_ADDR_STEP)) & 1U);
+	}
+	if (Logged && (memcmp(&Core[offset], &value, (size_t)width) == 0)) {
+		Redundant++;
+	}
+	memcpy(&Core[offset], &value, (size_t)width);
+
+	if ((offset == XDFEPRACH_TRIGGERS_RACH_UPDATE_OFFSET) && (value & 1U)) {
+		for (BandId = 0U; BandId < NUM_BANDS; BandId++) {
+			memcpy(&Core[XDFEPRACH_CC_SEQUENCE_LENGTH_CURRENT(
+				       BandId)],
+			       &Core[XDFEPRACH_CC_SEQUENCE_LENGTH_NEXT(BandId)],
+			       sizeof(u32));
+			memcpy(&Core[XDFEPRACH_CC_SEQUENCE_CURRENT(BandId, 0U)],
+			       &Core[XDFEPRACH_CC_SEQUENCE_NEXT(BandId, 0U)],
+			       XDFEPRACH_CC_NUM_MAX * sizeof(u32));
+			memcpy(&Core[XDFEPRACH_CC_MAPPING_CURRENT(BandId, 0U)],
+			       &Core[XDFEPRACH_CC_MAPPING_NEXT(BandId, 0U)],
+			       XDFEPRACH_CC_NUM_MAX * sizeof(u32));
+		}
+		memcpy(&Core[XDFEPRACH_RCID_MAPPING_CHANNEL_CURRENT],
+		       &Core[XDFEPRACH_RCID_MAPPING_CHANNEL_NEXT],
+		       XDFEPRACH_RC_NUM_MAX * sizeof(u32));
+		memcpy(&Core[XDFEPRACH_RCID_MAPPING_SOURCE_CURRENT],
+		       &Core[XDFEPRACH_RCID_MAPPING_SOURCE_NEXT],
+		       XDFEPRACH_RC_NUM_MAX * sizeof(u32));
+		memcpy(&Core[XDFEPRACH_RCID_SCHEDULE_LOCATION_CURRENT],
+		       &Core[XDFEPRACH_RCID_SCHEDULE_LOCATION_NEXT],
+		       XDFEPRACH_RC_NUM_MAX * sizeof(u32));
+		memcpy(&Core[XDFEPRACH_RCID_SCHEDULE_LENGTH_CURRENT],
+		       &Core[XDFEPRACH_RCID_SCHEDULE_LENGTH_NEXT],
+		       XDFEPRACH_RC_NUM_MAX * sizeof(u32));
+		Core[offset] &= ~1U;
+	}
+}
+
+/*****************************************************************************/
+/*
+* A core with two bands of one antenna and 16 CCs, 16 RACH channels and the
+* static schedule, taken through reset, configuration, initialization and
+* activation with a sequence length of 16 in both bands.
+*/
+static void CoreInit(u32 Core)
+{
+	XDfePrach_Cfg Cfg;
+	XDfePrach_Init Init;
+	XDfePrach *InstancePtr = &Prach[Core];
+	u32 BandId;
+
+	memset(Regs[Core], 0, sizeof(Regs[Core]));
+	memset(InstancePtr, 0, sizeof(*InstancePtr));
+	metal_io_init(&Io[Core], Regs[Core], NULL, REGION_SIZE, (unsigned)(-1),
+		      0U, NULL);
+	InstancePtr->Io = &Io[Core];
+	InstancePtr->StateId = XDFEPRACH_STATE_READY;
+	XDfePrach_WriteReg(
+		InstancePtr, XDFEPRACH_MODEL_PARAM_OFFSET,
+		(1U << XDFEPRACH_MODEL_PARAM_NUM_ANTENNA0_OFFSET) |
+		(16U << XDFEPRACH_MODEL_PARAM_NUM_CC_PER_ANTENNA0_OFFSET) |
+		(1U << XDFEPRACH_MODEL_PARAM_NUM_SLOT_CHANNELS0_OFFSET) |
+		(1U << XDFEPRACH_MODEL_PARAM_NUM_SLOTS0_OFFSET) |
+		(XDFEPRACH_RC_NUM_MAX <<
+		 XDFEPRACH_MODEL_PARAM_NUM_RACH_CHANNELS_OFFSET) |
+		(1U << XDFEPRACH_MODEL_PARAM_NUM_RACH_LANES_OFFSET) |
+		(NUM_BANDS << XDFEPRACH_MODEL_PARAM_NUM_BANDS_OFFSET));
+	XDfePrach_WriteReg(
+		InstancePtr, XDFEPRACH_MODEL_PARAM1_OFFSET,
+		(1U << XDFEPRACH_MODEL_PARAM1_NUM_ANTENNA1_OFFSET) |
+		(16U << XDFEPRACH_MODEL_PARAM1_NUM_CC_PER_ANTENNA1_OFFSET) |
+		(1U << XDFEPRACH_MODEL_PARAM1_NUM_SLOT_CHANNELS1_OFFSET) |
+		(1U << XDFEPRACH_MODEL_PARAM1_NUM_SLOTS1_OFFSET));
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	memset(&Init, 0, sizeof(Init));
+	for (BandId = 0U; BandId < NUM_BANDS; BandId++) {
+		Init.Sequence[BandId].Length = XDFEPRACH_CC_NUM_MAX;
+	}
+	Init.EnableStaticSchedule = true;
+	XDfePrach_Reset(InstancePtr);
+	XDfePrach_Configure(InstancePtr, &Cfg);
+	XDfePrach_Initialize(InstancePtr, &Init);
+	XDfePrach_Activate(InstancePtr, false);
+	XHOST_CHECK((InstancePtr->StateId == XDFEPRACH_STATE_OPERATIONAL) &&
+		    (InstancePtr->Config.NumBands == NUM_BANDS),
+		    "core %u: initialization", (unsigned)Core);
+}
+
+/*****************************************************************************/
+/*
+* Random values of a change, within the register fields they are written
+* to.
+*/
+static void RandomStep(Step *StepPtr)
+{
+	static const u32 NumIds[CHANGE_NUM] = { NUM_CCS, NUM_CCS, NUM_RCS,
+						NUM_RCS };
+	u32 Index;
+
+	StepPtr->Kind = (Change)((u32)rand() % CHANGE_NUM);
+	StepPtr->Id = (u32)rand() % NumIds[StepPtr->Kind];
+	StepPtr->CCID = (s32)((u32)rand() % NUM_CCS);
+	StepPtr->CarrierCfg.SCS = (u32)rand() % 4U;
+	StepPtr->DdcCfg.DecimationRate = (u32)rand() % 5U;
+	StepPtr->DdcCfg.UserSCS = (u32)rand() % 4U;
+	for (Index = 0U; Index < 5U; Index++) {
+		StepPtr->DdcCfg.RachGain[Index] = (u32)rand() & 1U;
+	}
+	StepPtr->DdcCfg.RachGain[5] = (u32)rand() & 3U;
+	StepPtr->NcoCfg.PhaseOffset = (u32)rand();
+	StepPtr->NcoCfg.PhaseAcc = (u32)rand();
+	StepPtr->NcoCfg.DualModCount = (u32)rand();
+	StepPtr->NcoCfg.DualModSel = (u32)rand() & 1U;
+	StepPtr->NcoCfg.UserFreq = (s32)((u32)rand() % (1U << 23)) - (1 << 22);
+	StepPtr->NcoCfg.FreqPhaseOffset = (u32)rand() & 0x3FFFFU;
+	StepPtr->NcoCfg.NcoGain = (u32)rand() & 3U;
+	StepPtr->Schedule.PatternPeriod = 1U + ((u32)rand() % 256U);
+	StepPtr->Schedule.FrameID =
+		(u32)rand() % StepPtr->Schedule.PatternPeriod;
+	StepPtr->Schedule.SubframeID = (u32)rand() % 10U;
+	StepPtr->Schedule.SlotId = (u32)rand() % 8U;
+	StepPtr->Schedule.Duration = 1U + ((u32)rand() % 4095U);
+	StepPtr->Schedule.Repeats = 1U + ((u32)rand() % 255U);
+}
+
+/*****************************************************************************/
+/*
+* Bitmap of the RACH channels used by the enabled RCs.
+*/
+static u32 UsedChannels(const XDfePrach_RCCfg *RCCfg)
+{
+	u32 Used = 0U;
+	u32 RCId;
+
+	for (RCId = 0U; RCId < XDFEPRACH_RC_NUM_MAX; RCId++) {
+		if (RCCfg->InternalRCCfg[RCId].Enable !=
+		    XDFEPRACH_RCID_MAPPING_CHANNEL_NOT_ENABLED) {
+			Used |= 1U << RCCfg->InternalRCCfg[RCId].RachChannel;
+		}
+	}
+
+	return Used;
+}
+
+/*****************************************************************************/
+/*
+* One change of the CC and RC configurations: CC Id, on its own 4 sequence
+* slots of band Id % NUM_BANDS, is added or removed or gets a new SCS, or
+* RC Id on RACH channel Id is added or removed or moved to another CC with
+* new DDC, NCO and schedule.
+*/
+static void ChangeCfg(XDfePrach *InstancePtr, XDfePrach_CCCfg *CCCfg,
+		      XDfePrach_RCCfg *RCCfg, Step *StepPtr)
+{
+	u32 Id = StepPtr->Id;
+	u32 BandId = CC_BAND(Id);
+	u32 Active;
+
+	switch (StepPtr->Kind) {
+	case CHANGE_TOGGLE_CC:
+		if (CCCfg->CarrierCfg[BandId][Id].Enable != 0U) {
+			XDfePrach_RemoveCCfromCCCfgMB(InstancePtr, CCCfg,
+						      (s32)Id, BandId);
+		} else {
+			XHOST_CHECK(XDfePrach_AddCCtoCCCfgMB(
+					    InstancePtr, CCCfg, (s32)Id,
+					    0xFU << (4U * (Id / NUM_BANDS)),
+					    &StepPtr->CarrierCfg, BandId) ==
+				    XST_SUCCESS, "CC %u: add", (unsigned)Id);
+		}
+		break;
+	case CHANGE_UPDATE_CC:
+		if (CCCfg->CarrierCfg[BandId][Id].Enable != 0U) {
+			XDfePrach_UpdateCCinCCCfgMB(InstancePtr, CCCfg,
+						    (s32)Id,
+						    &StepPtr->CarrierCfg,
+						    BandId);
+		}
+		break;
+	default:
+		Active = (RCCfg->InternalRCCfg[Id].Enable !=
+			  XDFEPRACH_RCID_MAPPING_CHANNEL_NOT_ENABLED);
+		if ((StepPtr->Kind == CHANGE_TOGGLE_RC) && Active) {
+			XDfePrach_RemoveRCfromRCCfg(InstancePtr, RCCfg, Id);
+		} else if ((StepPtr->Kind == CHANGE_TOGGLE_RC) || Active) {
+			XHOST_CHECK(XDfePrach_AddRCtoRCCfgMB(
+					    InstancePtr, RCCfg, StepPtr->CCID,
+					    Id, Id, &StepPtr->DdcCfg,
+					    &StepPtr->NcoCfg,
+					    &StepPtr->Schedule, CCCfg,
+					    CC_BAND(StepPtr->CCID)) ==
+				    XST_SUCCESS, "RC %u: add", (unsigned)Id);
+		}
+		break;
+	}
+}
+
+/*****************************************************************************/
+/*
+* A change as done without transaction: the CC and RC configurations are
+* read back, changed and written as a whole.
+*/
+static void LegacyChange(Step *StepPtr)
+{
+	XDfePrach_CCCfg CCCfg;
+	XDfePrach_RCCfg RCCfg;
+
+	memset(&CCCfg, 0, sizeof(CCCfg));
+	memset(&RCCfg, 0, sizeof(RCCfg));
+	XDfePrach_GetCurrentCCCfg(&Prach[0], &CCCfg);
+	XDfePrach_GetCurrentRCCfg(&Prach[0], &RCCfg);
+	ChangeCfg(&Prach[0], &CCCfg, &RCCfg, StepPtr);
+	(void)XDfePrach_SetNextCfg(&Prach[0], &CCCfg, &RCCfg);
+}
+
+static void TransactionChange(Step *StepPtr)
+{
+	XDfePrach_CCCfg NextCC = CurrCC;
+	XDfePrach_RCCfg NextRC = CurrRC;
+
+	ChangeCfg(&Prach[1], &NextCC, &NextRC, StepPtr);
+	XDfePrach_CompileCfg(&Prach[1], &CurrCC, &CurrRC, &NextCC, &NextRC,
+			     &Transaction[0]);
+	XHOST_CHECK(Transaction[0].NumWrites < XDFEPRACH_TRANSACTION_WRITES_MAX,
+		    "%u writes", (unsigned)Transaction[0].NumWrites);
+	LoggedChannels = UsedChannels(&CurrRC);
+	Redundant = 0U;
+	Logging = 1U;
+	(void)XDfePrach_SetTransactionAndTrigger(&Prach[1], &Transaction[0]);
+	Logging = 0U;
+	XHOST_CHECK(Redundant == 0U, "%u redundant writes",
+		    (unsigned)Redundant);
+	CurrCC = NextCC;
+	CurrRC = NextRC;
+}
+
+static void CompareCores(u32 Number)
+{
+	u32 Offset;
+	u32 BandId;
+	u32 Value[2];
+
+	for (Offset = 0U; Offset < REGION_SIZE; Offset += 4U) {
+		memcpy(&Value[0], &Regs[0][Offset], sizeof(u32));
+		memcpy(&Value[1], &Regs[1][Offset], sizeof(u32));
+		if (Value[0] != Value[1]) {
+			XHOST_CHECK(0, "change %u: register 0x%04x is 0x%08x, "
+				    "0x%08x without transaction",
+				    (unsigned)Number, (unsigned)Offset,
+				    (unsigned)Value[1], (unsigned)Value[0]);
+			return;
+		}
+	}
+	for (BandId = 0U; BandId < NUM_BANDS; BandId++) {
+		XHOST_CHECK(Prach[0].NotUsedCCID[BandId] ==
+			    Prach[1].NotUsedCCID[BandId],
+			    "change %u: band %u unused CCID %d, %d without "
+			    "transaction", (unsigned)Number, (unsigned)BandId,
+			    (int)Prach[1].NotUsedCCID[BandId],
+			    (int)Prach[0].NotUsedCCID[BandId]);
+	}
+}
+
+int main(void)
+{
+	static const u32 Bench[NUM_BENCHES][2] = {
+		{ 0U, NUM_RUNS }, { ACCESS_NS, NUM_SLOW_RUNS }
+	};
+	XDfePrach_CCCfg CCCfg;
+	XDfePrach_RCCfg RCCfg;
+	XDfePrach_CCCfg NextCC;
+	XDfePrach_RCCfg NextRC;
+	Step Action;
+	u64 StartNs;
+	u64 Time[2];
+	u32 Count[2][2];
+	u32 NumFull;
+	u32 Runs;
+	u32 Run;
+	u32 Index;
+
+	CoreInit(0U);
+	CoreInit(1U);
+	srand(1U);
+
+	/* Both instances start from all the CCs, with one RC each */
+	XDfePrach_GetEmptyCCCfg(&Prach[0], &CCCfg);
+	XDfePrach_GetEmptyRCCfg(&Prach[0], &RCCfg);
+	for (Index = 0U; Index < (2U * NUM_CCS); Index++) {
+		RandomStep(&Action);
+		Action.Kind = (Index < NUM_CCS) ? CHANGE_TOGGLE_CC :
+						  CHANGE_TOGGLE_RC;
+		Action.Id = Index % NUM_CCS;
+		Action.CCID = (s32)Action.Id;
+		ChangeCfg(&Prach[0], &CCCfg, &RCCfg, &Action);
+	}
+	(void)XDfePrach_SetNextCfg(&Prach[0], &CCCfg, &RCCfg);
+	CurrCC = CCCfg;
+	CurrRC = RCCfg;
+	for (Index = 0U; Index < NUM_BANDS; Index++) {
+		Prach[1].NotUsedCCID[Index] = Prach[0].NotUsedCCID[Index];
+	}
+	XDfePrach_CompileCfg(&Prach[1], NULL, NULL, &CurrCC, &CurrRC,
+			     &Transaction[0]);
+	NumFull = Transaction[0].NumWrites;
+	(void)XDfePrach_SetTransactionAndTrigger(&Prach[1], &Transaction[0]);
+	CompareCores(0U);
+
+	for (Index = 1U; Index <= NUM_CHANGES; Index++) {
+		RandomStep(&Action);
+		LegacyChange(&Action);
+		TransactionChange(&Action);
+		CompareCores(Index);
+	}
+
+	/* A pending update is refused */
+	metal_set_log_level(METAL_LOG_EMERGENCY);
+	Regs[1][XDFEPRACH_ISR] |= 1U << XDFEPRACH_RACH_UPDATE_TRIGGERED_OFFSET;
+	XHOST_CHECK(XDfePrach_SetTransactionAndTrigger(&Prach[1],
+							&Transaction[0]) ==
+		    XST_FAILURE, "RACH update pending");
+	metal_set_log_level(METAL_LOG_ERROR);
+	Regs[1][XDFEPRACH_ISR] = 0U;
+	XHOST_CHECK(XHostModel_AssertCount == 0U, "%u assertions",
+		    (unsigned)XHostModel_AssertCount);
+
+	/* Add and remove the last RC, compiled once */
+	RandomStep(&Action);
+	Action.Kind = CHANGE_TOGGLE_RC;
+	Action.Id = NUM_RCS - 1U;
+	NextCC = CurrCC;
+	NextRC = CurrRC;
+	ChangeCfg(&Prach[1], &NextCC, &NextRC, &Action);
+	XDfePrach_CompileCfg(&Prach[1], &CurrCC, &CurrRC, &NextCC, &NextRC,
+			     &Transaction[0]);
+	XDfePrach_CompileCfg(&Prach[1], &NextCC, &NextRC, &CurrCC, &CurrRC,
+			     &Transaction[1]);
+	printf("transaction writes: %u full, %u and %u to toggle RC %u\n",
+	       (unsigned)NumFull, (unsigned)Transaction[0].NumWrites,
+	       (unsigned)Transaction[1].NumWrites, (unsigned)(NUM_RCS - 1U));
+
+	/* Benchmark, without and with bus latency */
+	for (Index = 0U; Index < NUM_BENCHES; Index++) {
+		AccessNs = Bench[Index][0];
+		Runs = Bench[Index][1];
+		Reads = 0U;
+		Writes = 0U;
+		StartNs = XHostModel_TimeNs();
+		for (Run = 0U; Run < Runs; Run++) {
+			LegacyChange(&Action);
+		}
+		Time[0] = XHostModel_TimeNs() - StartNs;
+		Count[0][0] = Reads / Runs;
+		Count[0][1] = Writes / Runs;
+		Reads = 0U;
+		Writes = 0U;
+		StartNs = XHostModel_TimeNs();
+		for (Run = 0U; Run < Runs; Run++) {
+			(void)XDfePrach_SetTransactionAndTrigger(
+				&Prach[1], &Transaction[Run % 2U]);
+		}
+		Time[1] = XHostModel_TimeNs() - StartNs;
+		Count[1][0] = Reads / Runs;
+		Count[1][1] = Writes / Runs;
+		printf("%3u ns per access: RC configuration %.2f us (%u reads "
+		       "%u writes), transaction %.2f us (%u reads %u writes)\n",
+		       (unsigned)AccessNs, (double)Time[0] / Runs / 1000.0,
+		       (unsigned)Count[0][0], (unsigned)Count[0][1],
+		       (double)Time[1] / Runs / 1000.0, (unsigned)Count[1][0],
+		       (unsigned)Count[1][1]);
+		XHOST_CHECK((Count[1][0] < Count[0][0]) &&
+			    (Count[1][1] < Count[0][1]),
+			    "transaction: %u reads %u writes",
+			    (unsigned)Count[1][0], (unsigned)Count[1][1]);
+	}
+
+	return XHostModel_Report("xdfeprach_transaction_model_test");
+}
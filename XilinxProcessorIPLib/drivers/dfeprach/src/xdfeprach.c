@@ -54,6 +54,7 @@
 * 1.7   dc     11/29/23 Add continuous scheduling
 *       dc     01/19/24 Correct memset destination address
 *       dc     03/22/24 Correct order of RACH mapping steps
+*       kt     10/18/26 Add precompiled configuration transactions
 * </pre>
 * @addtogroup dfeprach Overview
 * @{
@@ -79,6 +80,13 @@
 #define XDFEPRACH_SEQUENCE_ENTRY_NULL (-1) /* Null sequence entry flag */
 #define XDFEPRACH_NO_EMPTY_CCID_FLAG (0xFFFFU) /* Not Empty CCID flag */
 #define XDFEPRACH_U32_NUM_BITS (32U) /**< Number of bits in register */
+#define XDFEPRACH_BAND_WRITES                                                  \
+	(1U + (2U * XDFEPRACH_SEQ_LENGTH_MAX)) /**< Register writes of the CC
+		configuration of a band */
+#define XDFEPRACH_SCHEDULE_WRITES (2U) /**< Register writes of a schedule */
+#define XDFEPRACH_RC_WRITES (4U) /**< Register writes of the DDC and the
+		mapping of a RC */
+#define XDFEPRACH_NCO_WRITES (8U) /**< Register writes of an NCO */
 /**
 * @endcond
 */
@@ -142,6 +150,21 @@ static void XDfePrach_AddSchedule(XDfePrach_RCCfg *RCCfg,
 				  const XDfePrach_Schedule *Schedule, u32 RCId);
 static void XDfePrach_SetSchedule(const XDfePrach *InstancePtr,
 				  const XDfePrach_RCCfg *RCCfg, u32 RCId);
+static u32 XDfePrach_GetRCWrites(const XDfePrach *InstancePtr);
+static u32 XDfePrach_GetNumCfgWrites(const XDfePrach *InstancePtr);
+static u32 XDfePrach_GetCfgWrite(const XDfePrach *InstancePtr,
+				 const XDfePrach_CCCfg *CCCfg,
+				 const XDfePrach_RCCfg *RCCfg,
+				 const s32 *NotUsedCCID, u32 Write,
+				 u32 *Offset);
+static u32 XDfePrach_GetNCOWrite(const XDfePrach_NCO *NcoCfg, u32 Write,
+				 u32 *Offset);
+static const XDfePrach_NCO *
+XDfePrach_GetChannelNCO(const XDfePrach_RCCfg *RCCfg, u32 RachChan);
+static void XDfePrach_GetNextCfgWrites(const XDfePrach *InstancePtr,
+				       const XDfePrach_CCCfg *NextCCCfg,
+				       const XDfePrach_RCCfg *NextRCCfg,
+				       XDfePrach_Transaction *Transaction);
 /************************** Variable Definitions ****************************/
 #ifdef __BAREMETAL__
 extern struct metal_device XDfePrach_CustomDevice[XDFEPRACH_MAX_NUM_INSTANCES];
@@ -299,7 +322,7 @@ u32 XDfePrach_WrBitField(u32 FieldWidth, u32 FieldOffset, u32 Data, u32 Val)
 * @return  Unused CCID
 *
 ****************************************************************************/
-static s32 XDfePrach_GetNotUsedCCID(XDfePrach_CCSequence *Sequence)
+static s32 XDfePrach_GetNotUsedCCID(const XDfePrach_CCSequence *Sequence)
 {
 	u32 Index;
 	s32 NotUsedCCID;
@@ -1514,6 +1537,355 @@ static void XDfePrach_EnableFrameMarkerTrigger(const XDfePrach *InstancePtr,
 	XDfePrach_WriteReg(InstancePtr,
 			   XDFEPRACH_TRIGGERS_FRAME_INIT_OFFSET(BandId), Data);
 }
+/****************************************************************************/
+/**
+*
+* Gets the number of register writes of an RC in a configuration, without
+* the NCO registers.
+*
+* @param    InstancePtr Pointer to the PRACH instance.
+*
+* @return   Number of register writes.
+*
+****************************************************************************/
+static u32 XDfePrach_GetRCWrites(const XDfePrach *InstancePtr)
+{
+	if (InstancePtr->Config.HasContinuousSched ==
+	    XDFEPRACH_MODEL_PARAM_HAS_CONTINUOUS_SCHED_OFF) {
+		return XDFEPRACH_RC_WRITES + XDFEPRACH_SCHEDULE_WRITES;
+	}
+	return XDFEPRACH_RC_WRITES;
+}
+
+/****************************************************************************/
+/**
+*
+* Gets the number of register writes of a configuration, without the NCO
+* registers. These writes are always to the same registers in the same
+* order, see XDfePrach_GetCfgWrite().
+*
+* @param    InstancePtr Pointer to the PRACH instance.
+*
+* @return   Number of register writes.
+*
+****************************************************************************/
+static u32 XDfePrach_GetNumCfgWrites(const XDfePrach *InstancePtr)
+{
+	return (InstancePtr->Config.NumBands * XDFEPRACH_BAND_WRITES) +
+	       (XDFEPRACH_RC_NUM_MAX * XDfePrach_GetRCWrites(InstancePtr));
+}
+
+/****************************************************************************/
+/**
+*
+* Gets one register write of the CC and RC configurations, other than the
+* NCO registers. The CC configuration of each band comes first, then the
+* schedule, DDC and mapping of each RC, so the writes of two configurations
+* compare one by one.
+*
+* @param    InstancePtr Pointer to the PRACH instance.
+* @param    CCCfg CC configuration container.
+* @param    RCCfg RC configuration container.
+* @param    NotUsedCCID Not used CCID of each band, written to the CC
+*           sequence slots without CC.
+* @param    Write Write number, in the order the registers are written.
+* @param    Offset Register offset of the write.
+*
+* @return   Value to be written.
+*
+****************************************************************************/
+static u32 XDfePrach_GetCfgWrite(const XDfePrach *InstancePtr,
+				 const XDfePrach_CCCfg *CCCfg,
+				 const XDfePrach_RCCfg *RCCfg,
+				 const s32 *NotUsedCCID, u32 Write,
+				 u32 *Offset)
+{
+	u32 Data;
+	u32 Reg;
+	u32 Index;
+	u32 BandId;
+	u32 RCId;
+	const XDfePrach_InternalChannelCfg *InternalRCCfg;
+	const XDfePrach_DDCCfg *DdcCfg;
+	const XDfePrach_Schedule *Schedule;
+
+	/* CC configuration of each band */
+	if (Write < (InstancePtr->Config.NumBands * XDFEPRACH_BAND_WRITES)) {
+		BandId = Write / XDFEPRACH_BAND_WRITES;
+		Reg = Write % XDFEPRACH_BAND_WRITES;
+		if (Reg == 0U) {
+			*Offset = XDFEPRACH_CC_SEQUENCE_LENGTH_NEXT(BandId);
+			if (InstancePtr->SequenceLength[BandId] == 0) {
+				return 0U;
+			}
+			return InstancePtr->SequenceLength[BandId] - 1U;
+		}
+		Index = (Reg - 1U) / 2U;
+		if (((Reg - 1U) % 2U) == 0U) {
+			*Offset = XDFEPRACH_CC_SEQUENCE_NEXT(BandId, Index);
+			if ((CCCfg->Sequence[BandId].CCID[Index] ==
+			     XDFEPRACH_SEQUENCE_ENTRY_NULL) ||
+			    (Index >= InstancePtr->SequenceLength[BandId])) {
+				return (u32)NotUsedCCID[BandId];
+			}
+			return (u32)CCCfg->Sequence[BandId].CCID[Index];
+		}
+		Data = XDfePrach_WrBitField(
+			XDFEPRACH_CC_MAPPING_ENABLE_WIDTH,
+			XDFEPRACH_CC_MAPPING_ENABLE_OFFSET, 0U,
+			CCCfg->CarrierCfg[BandId][Index].Enable);
+		Data = XDfePrach_WrBitField(
+			XDFEPRACH_CC_MAPPING_SCS_WIDTH,
+			XDFEPRACH_CC_MAPPING_SCS_OFFSET, Data,
+			CCCfg->CarrierCfg[BandId][Index].SCS);
+		Data = XDfePrach_WrBitField(
+			XDFEPRACH_CC_MAPPING_DECIMATION_RATE_WIDTH,
+			XDFEPRACH_CC_MAPPING_DECIMATION_RATE_OFFSET, Data,
+			CCCfg->CarrierCfg[BandId][Index].CCRate);
+		*Offset = XDFEPRACH_CC_MAPPING_NEXT(BandId, Index);
+		return Data;
+	}
+
+	/* RC configuration */
+	Write -= InstancePtr->Config.NumBands * XDFEPRACH_BAND_WRITES;
+	RCId = Write / XDfePrach_GetRCWrites(InstancePtr);
+	Reg = Write % XDfePrach_GetRCWrites(InstancePtr);
+	InternalRCCfg = &RCCfg->InternalRCCfg[RCId];
+
+	/* Schedule */
+	if (InstancePtr->Config.HasContinuousSched ==
+	    XDFEPRACH_MODEL_PARAM_HAS_CONTINUOUS_SCHED_OFF) {
+		Schedule = &RCCfg->StaticSchedule[RCId];
+		if (Reg == 0U) {
+			Data = XDfePrach_WrBitField(
+				XDFEPRACH_RCID_SCHEDULE_LOCATION_PATTERN_PERIOD_WIDTH,
+				XDFEPRACH_RCID_SCHEDULE_LOCATION_PATTERN_PERIOD_OFFSET,
+				0U, (Schedule->PatternPeriod - 1U));
+			Data = XDfePrach_WrBitField(
+				XDFEPRACH_RCID_SCHEDULE_LOCATION_FRAMEID_WIDTH,
+				XDFEPRACH_RCID_SCHEDULE_LOCATION_FRAMEID_OFFSET,
+				Data, Schedule->FrameID);
+			Data = XDfePrach_WrBitField(
+				XDFEPRACH_RCID_SCHEDULE_LOCATION_SUBFRAME_ID_WIDTH,
+				XDFEPRACH_RCID_SCHEDULE_LOCATION_SUBFRAME_ID_OFFSET,
+				Data, Schedule->SubframeID);
+			Data = XDfePrach_WrBitField(
+				XDFEPRACH_RCID_SCHEDULE_LOCATION_SLOT_ID_WIDTH,
+				XDFEPRACH_RCID_SCHEDULE_LOCATION_SLOT_ID_OFFSET,
+				Data, Schedule->SlotId);
+			*Offset = XDFEPRACH_RCID_SCHEDULE_LOCATION_NEXT +
+				  (RCId * sizeof(u32));
+			return Data;
+		}
+		if (Reg == 1U) {
+			Data = XDfePrach_WrBitField(
+				XDFEPRACH_RCID_SCHEDULE_LENGTH_DURATION_WIDTH,
+				XDFEPRACH_RCID_SCHEDULE_LENGTH_DURATION_OFFSET,
+				0U, Schedule->Duration);
+			Data = XDfePrach_WrBitField(
+				XDFEPRACH_RCID_SCHEDULE_LENGTH_NUM_REPEATS_WIDTH,
+				XDFEPRACH_RCID_SCHEDULE_LENGTH_NUM_REPEATS_OFFSET,
+				Data, Schedule->Repeats);
+			*Offset = XDFEPRACH_RCID_SCHEDULE_LENGTH_NEXT +
+				  (RCId * sizeof(u32));
+			return Data;
+		}
+		Reg -= XDFEPRACH_SCHEDULE_WRITES;
+	}
+
+	/* DDC */
+	DdcCfg = &RCCfg->DdcCfg[RCId];
+	if (Reg == 0U) {
+		*Offset = XDFEPRACH_DECIMATION_RATE +
+			  (RCId * XDFEPRACH_CONFIG_DEC_ADDR_STEP);
+		return XDfePrach_WrBitField(XDFEPRACH_DECIMATION_RATE_WIDTH,
+					    XDFEPRACH_DECIMATION_RATE_OFFSET,
+					    0U, DdcCfg->DecimationRate);
+	}
+	if (Reg == 1U) {
+		Data = XDfePrach_WrBitField(XDFEPRACH_DECIMATION_GAIN0_WIDTH,
+					    XDFEPRACH_DECIMATION_GAIN0_OFFSET,
+					    0U, DdcCfg->RachGain[0]);
+		Data = XDfePrach_WrBitField(XDFEPRACH_DECIMATION_GAIN1_WIDTH,
+					    XDFEPRACH_DECIMATION_GAIN1_OFFSET,
+					    Data, DdcCfg->RachGain[1]);
+		Data = XDfePrach_WrBitField(XDFEPRACH_DECIMATION_GAIN2_WIDTH,
+					    XDFEPRACH_DECIMATION_GAIN2_OFFSET,
+					    Data, DdcCfg->RachGain[2]);
+		Data = XDfePrach_WrBitField(XDFEPRACH_DECIMATION_GAIN3_WIDTH,
+					    XDFEPRACH_DECIMATION_GAIN3_OFFSET,
+					    Data, DdcCfg->RachGain[3]);
+		Data = XDfePrach_WrBitField(XDFEPRACH_DECIMATION_GAIN4_WIDTH,
+					    XDFEPRACH_DECIMATION_GAIN4_OFFSET,
+					    Data, DdcCfg->RachGain[4]);
+		Data = XDfePrach_WrBitField(XDFEPRACH_DECIMATION_GAIN5_WIDTH,
+					    XDFEPRACH_DECIMATION_GAIN5_OFFSET,
+					    Data, DdcCfg->RachGain[5]);
+		*Offset = XDFEPRACH_DECIMATION_GAIN +
+			  (RCId * XDFEPRACH_CONFIG_DEC_ADDR_STEP);
+		return Data;
+	}
+
+	/* Mapping source and mapping channel */
+	if (Reg == 2U) {
+		Data = XDfePrach_WrBitField(
+			XDFEPRACH_RCID_MAPPING_SOURCE_CCID_WIDTH,
+			XDFEPRACH_RCID_MAPPING_SOURCE_CCID_OFFSET, 0U,
+			InternalRCCfg->CCID);
+		Data = XDfePrach_WrBitField(
+			XDFEPRACH_RCID_MAPPING_SOURCE_BAND_WIDTH,
+			XDFEPRACH_RCID_MAPPING_SOURCE_BAND_OFFSET, Data,
+			InternalRCCfg->BandId);
+		*Offset = XDFEPRACH_RCID_MAPPING_SOURCE_NEXT +
+			  (RCId * sizeof(u32));
+		return Data;
+	}
+	Data = XDfePrach_WrBitField(
+		XDFEPRACH_RCID_MAPPING_CHANNEL_ENABLE_WIDTH,
+		XDFEPRACH_RCID_MAPPING_CHANNEL_ENABLE_OFFSET, 0U,
+		InternalRCCfg->Enable);
+	Data = XDfePrach_WrBitField(
+		XDFEPRACH_RCID_MAPPING_CHANNEL_RACH_CHANNEL_WIDTH,
+		XDFEPRACH_RCID_MAPPING_CHANNEL_RACH_CHANNEL_OFFSET, Data,
+		InternalRCCfg->RachChannel);
+	*Offset = XDFEPRACH_RCID_MAPPING_CHANNEL_NEXT + (RCId * sizeof(u32));
+	return Data;
+}
+
+/****************************************************************************/
+/**
+*
+* Gets one register write of an NCO. The registers of an NCO are always
+* XDFEPRACH_NCO_WRITES writes in the same order.
+*
+* @param    NcoCfg NCO configuration container.
+* @param    Write Write number, in the order the registers are written.
+* @param    Offset Register offset of the write, for the first RACH channel.
+*
+* @return   Value to be written.
+*
+****************************************************************************/
+static u32 XDfePrach_GetNCOWrite(const XDfePrach_NCO *NcoCfg, u32 Write,
+				 u32 *Offset)
+{
+	switch (Write) {
+	case 0U:
+		*Offset = XDFEPRACH_PHASE_PHASE_ACC;
+		return NcoCfg->PhaseAcc;
+	case 1U:
+		*Offset = XDFEPRACH_PHASE_DUAL_MOD_COUNT;
+		return NcoCfg->DualModCount;
+	case 2U:
+		*Offset = XDFEPRACH_PHASE_DUAL_MOD_SEL;
+		return NcoCfg->DualModSel;
+	case 3U:
+		*Offset = XDFEPRACH_NCO_GAIN;
+		return NcoCfg->NcoGain;
+	case 4U:
+		*Offset = XDFEPRACH_FREQUENCY_CONTROL_WORD;
+		return NcoCfg->Frequency;
+	case 5U:
+		*Offset = XDFEPRACH_FREQUENCY_SINGLE_MOD_COUNT;
+		return NcoCfg->FreqSingleModCount;
+	case 6U:
+		*Offset = XDFEPRACH_FREQUENCY_DUAL_MOD_COUNT;
+		return NcoCfg->FreqDualModCount;
+	default:
+		*Offset = XDFEPRACH_FREQUENCY_PHASE_OFFSET;
+		return NcoCfg->FreqPhaseOffset;
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Gets the NCO configuration a RC configuration loads to a RACH channel,
+* the one of the last enabled RC mapped to the channel.
+*
+* @param    RCCfg RC configuration container.
+* @param    RachChan RACH channel Id.
+*
+* @return   NCO configuration, NULL if no enabled RC uses the channel.
+*
+****************************************************************************/
+static const XDfePrach_NCO *
+XDfePrach_GetChannelNCO(const XDfePrach_RCCfg *RCCfg, u32 RachChan)
+{
+	const XDfePrach_NCO *NcoCfg = NULL;
+	u32 RCId;
+
+	for (RCId = 0; RCId < XDFEPRACH_RC_NUM_MAX; RCId++) {
+		if ((RCCfg->InternalRCCfg[RCId].Enable !=
+		     XDFEPRACH_RCID_MAPPING_CHANNEL_NOT_ENABLED) &&
+		    (RCCfg->InternalRCCfg[RCId].RachChannel == RachChan)) {
+			NcoCfg = &RCCfg->NcoCfg[RCId];
+		}
+	}
+	return NcoCfg;
+}
+
+/****************************************************************************/
+/**
+*
+* Gets the register writes of the next CC and RC configurations, the
+* registers XDfePrach_SetNextCfg() writes. The NCO registers of the enabled
+* RCs follow the other registers, by RACH channel.
+*
+* @param    InstancePtr Pointer to the PRACH instance.
+* @param    NextCCCfg Next CC configuration container.
+* @param    NextRCCfg Next RC configuration container.
+* @param    Transaction Transaction container, filled with all the writes.
+*
+****************************************************************************/
+static void XDfePrach_GetNextCfgWrites(const XDfePrach *InstancePtr,
+				       const XDfePrach_CCCfg *NextCCCfg,
+				       const XDfePrach_RCCfg *NextRCCfg,
+				       XDfePrach_Transaction *Transaction)
+{
+	u32 Write;
+	u32 NumWrites;
+	u32 RCId;
+	u32 RachChan;
+	u32 Offset;
+	const XDfePrach_NCO *NcoCfg;
+
+	NumWrites = XDfePrach_GetNumCfgWrites(InstancePtr);
+	for (Write = 0U; Write < NumWrites; Write++) {
+		Transaction->Data[Write] = XDfePrach_GetCfgWrite(
+			InstancePtr, NextCCCfg, NextRCCfg,
+			InstancePtr->NotUsedCCID, Write,
+			&Transaction->Offset[Write]);
+	}
+	Transaction->NumWrites = NumWrites;
+
+	for (RCId = 0; RCId < XDFEPRACH_RC_NUM_MAX; RCId++) {
+		if ((NextRCCfg->InternalRCCfg[RCId].Enable !=
+		     XDFEPRACH_RCID_MAPPING_CHANNEL_NOT_ENABLED) &&
+		    (NextRCCfg->InternalRCCfg[RCId].RachChannel >=
+		     XDFEPRACH_NCO_NUM_MAX)) {
+			metal_log(METAL_LOG_ERROR,
+				  "RACH channel %d is greater than %d\n",
+				  NextRCCfg->InternalRCCfg[RCId].RachChannel,
+				  XDFEPRACH_NCO_NUM_MAX);
+		}
+	}
+
+	/* NCO, addressed by the RACH channel */
+	for (RachChan = 0U; RachChan < XDFEPRACH_NCO_NUM_MAX; RachChan++) {
+		NcoCfg = XDfePrach_GetChannelNCO(NextRCCfg, RachChan);
+		if (NcoCfg == NULL) {
+			continue;
+		}
+		for (Write = 0U; Write < XDFEPRACH_NCO_WRITES; Write++) {
+			Transaction->Data[Transaction->NumWrites] =
+				XDfePrach_GetNCOWrite(NcoCfg, Write, &Offset);
+			Transaction->Offset[Transaction->NumWrites] =
+				Offset +
+				(RachChan * XDFEPRACH_NCO_CTRL_ADDR_STEP);
+			Transaction->NumWrites++;
+		}
+	}
+}
 /**
 * @endcond
 */
@@ -2518,6 +2890,147 @@ u32 XDfePrach_SetNextCfg(const XDfePrach *InstancePtr,
 	return XST_SUCCESS;
 }
 
+/****************************************************************************/
+/**
+*
+* Compiles the CC and RC configurations into a transaction, the register
+* writes that change the shadow (NEXT), NCO and DDC registers from the
+* current configurations to the next ones. Only the registers which differ
+* between the two configurations are written, no register is read. The
+* writes of the current configurations are computed one at a time while
+* comparing, they are not stored.
+*
+* The transaction can be set with XDfePrach_SetTransactionAndTrigger() any
+* number of times, on any PRACH instance with the same bands, sequence
+* lengths and not used CCIDs, whose registers hold the current
+* configurations. The CC sequence slots without CC of the current
+* configuration are taken to hold the lowest CCID not in its sequence, the
+* not used CCID XDfePrach_AddCCtoCCCfg() and XDfePrach_RemoveCCfromCCCfg()
+* leave in the instance.
+*
+* @param    InstancePtr Pointer to the PRACH instance.
+* @param    CurrCCCfg Current CC configuration container, as last written to
+*           the registers. If NULL, all the registers are written.
+* @param    CurrRCCfg Current RC configuration container, as last written to
+*           the registers. If NULL, all the registers are written.
+* @param    NextCCCfg Next CC configuration container.
+* @param    NextRCCfg Next RC configuration container.
+* @param    Transaction Transaction container.
+*
+****************************************************************************/
+void XDfePrach_CompileCfg(const XDfePrach *InstancePtr,
+			  const XDfePrach_CCCfg *CurrCCCfg,
+			  const XDfePrach_RCCfg *CurrRCCfg,
+			  const XDfePrach_CCCfg *NextCCCfg,
+			  const XDfePrach_RCCfg *NextRCCfg,
+			  XDfePrach_Transaction *Transaction)
+{
+	const XDfePrach_NCO *NcoCfg = NULL;
+	s32 CurrNotUsedCCID[XDFEPRACH_BAND_ID_MAX];
+	u32 NumWrites = 0U;
+	u32 NumCfgWrites;
+	u32 Index;
+	u32 Write;
+	u32 RachChan;
+	u32 Offset;
+	u32 BandId;
+	bool Changed;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(NextCCCfg != NULL);
+	Xil_AssertVoid(NextRCCfg != NULL);
+	Xil_AssertVoid(Transaction != NULL);
+
+	XDfePrach_GetNextCfgWrites(InstancePtr, NextCCCfg, NextRCCfg,
+				   Transaction);
+	if ((CurrCCCfg == NULL) || (CurrRCCfg == NULL)) {
+		return;
+	}
+
+	/* The not used CCIDs of the instance already follow the next CC
+	   sequences, the current sequences were written with their own */
+	for (BandId = 0U; BandId < InstancePtr->Config.NumBands; BandId++) {
+		CurrNotUsedCCID[BandId] =
+			XDfePrach_GetNotUsedCCID(&CurrCCCfg->Sequence[BandId]);
+	}
+
+	/* Drop the writes of values the registers already hold. The writes
+	   other than NCO of both configurations compare one by one, the NCO
+	   writes compare with the NCO the current configuration loads to the
+	   same RACH channel, if any */
+	NumCfgWrites = XDfePrach_GetNumCfgWrites(InstancePtr);
+	for (Index = 0U; Index < Transaction->NumWrites; Index++) {
+		if (Index < NumCfgWrites) {
+			Changed = (Transaction->Data[Index] !=
+				   XDfePrach_GetCfgWrite(InstancePtr, CurrCCCfg,
+							 CurrRCCfg,
+							 CurrNotUsedCCID, Index,
+							 &Offset));
+		} else {
+			Write = (Index - NumCfgWrites) % XDFEPRACH_NCO_WRITES;
+			if (Write == 0U) {
+				RachChan = (Transaction->Offset[Index] -
+					    XDFEPRACH_PHASE_PHASE_ACC) /
+					   XDFEPRACH_NCO_CTRL_ADDR_STEP;
+				NcoCfg = XDfePrach_GetChannelNCO(CurrRCCfg,
+								 RachChan);
+			}
+			Changed = ((NcoCfg == NULL) ||
+				   (Transaction->Data[Index] !=
+				    XDfePrach_GetNCOWrite(NcoCfg, Write,
+							  &Offset)));
+		}
+		if (Changed == true) {
+			Transaction->Offset[NumWrites] =
+				Transaction->Offset[Index];
+			Transaction->Data[NumWrites] = Transaction->Data[Index];
+			NumWrites++;
+		}
+	}
+	Transaction->NumWrites = NumWrites;
+}
+
+/****************************************************************************/
+/**
+*
+* Writes a compiled transaction to the registers and triggers copying from
+* shadow to operational registers.
+*
+* @param    InstancePtr Pointer to the PRACH instance.
+* @param    Transaction Transaction container, see XDfePrach_CompileCfg().
+*
+* @return
+*           - XST_SUCCESS if successful.
+*           - XST_FAILURE if error occurs.
+*
+****************************************************************************/
+u32 XDfePrach_SetTransactionAndTrigger(const XDfePrach *InstancePtr,
+				       const XDfePrach_Transaction *Transaction)
+{
+	u32 Index;
+	u32 BandId;
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Transaction != NULL);
+	Xil_AssertNonvoid(Transaction->NumWrites <=
+			  XDFEPRACH_TRANSACTION_WRITES_MAX);
+
+	for (Index = 0U; Index < Transaction->NumWrites; Index++) {
+		XDfePrach_WriteReg(InstancePtr, Transaction->Offset[Index],
+				   Transaction->Data[Index]);
+	}
+
+	/* Now do trigger, needs to be set after all the writes */
+	if (XST_FAILURE == XDfePrach_EnableUpdateTrigger(InstancePtr)) {
+		metal_log(METAL_LOG_ERROR, "Trigger failure, %s\n", __func__);
+		return XST_FAILURE;
+	}
+	/* Enable the frame marker trigger too. */
+	for (BandId = 0; BandId < InstancePtr->Config.NumBands; BandId++) {
+		XDfePrach_EnableFrameMarkerTrigger(InstancePtr, BandId);
+	}
+	return XST_SUCCESS;
+}
+
 /**
 * @cond nocomments
 */
@@ -80,6 +80,7 @@
 *       cog    07/04/23 Add support for SDT
 * 1.7   dc     11/29/23 Add continuous scheduling
 *       cog    02/19/24 Fixed SDT runtime issue
+*       kt     10/18/26 Add precompiled configuration transactions
 *
 * </pre>
 * @endcond
@@ -147,6 +148,10 @@ extern "C" {
 #define XDFEPRACH_ANT_NUM_MAX (8U) /**< Maximum anntena number. */
 #define XDFEPRACH_SEQ_LENGTH_MAX (16U) /**< Maximum CCID sequence length. */
 #define XDFEPRACH_BAND_ID_MAX (3U) /**< Maximum Band Id number. */
+#define XDFEPRACH_TRANSACTION_WRITES_MAX                                       \
+	((XDFEPRACH_BAND_ID_MAX * (1U + (2U * XDFEPRACH_SEQ_LENGTH_MAX))) +    \
+	 (XDFEPRACH_RC_NUM_MAX * 14U)) /**< Maximum number of register writes
+		in a transaction. */
 
 /**************************** Type Definitions *******************************/
 /*********** start - common code to all Logiccores ************/
@@ -515,6 +520,16 @@ typedef struct {
 		[XDFEPRACH_RC_NUM_MAX]; /**< Static Schedule configuration */
 } XDfePrach_RCCfg;
 
+/**
+ * Precompiled CC and RC configuration, the register writes from one
+ * configuration to another.
+ */
+typedef struct {
+	u32 NumWrites; /**< Number of register writes. */
+	u32 Offset[XDFEPRACH_TRANSACTION_WRITES_MAX]; /**< Register offsets. */
+	u32 Data[XDFEPRACH_TRANSACTION_WRITES_MAX]; /**< Register values. */
+} XDfePrach_Transaction;
+
 /**
  * PRACH status.
  */
@@ -707,6 +722,14 @@ u32 XDfePrach_UpdateCCinCCCfg(const XDfePrach *InstancePtr,
 u32 XDfePrach_SetNextCfg(const XDfePrach *InstancePtr,
 			 const XDfePrach_CCCfg *NextCCCfg,
 			 XDfePrach_RCCfg *NextRCCfg);
+void XDfePrach_CompileCfg(const XDfePrach *InstancePtr,
+			  const XDfePrach_CCCfg *CurrCCCfg,
+			  const XDfePrach_RCCfg *CurrRCCfg,
+			  const XDfePrach_CCCfg *NextCCCfg,
+			  const XDfePrach_RCCfg *NextRCCfg,
+			  XDfePrach_Transaction *Transaction);
+u32 XDfePrach_SetTransactionAndTrigger(const XDfePrach *InstancePtr,
+				       const XDfePrach_Transaction *Transaction);
 u32 XDfePrach_AddCC(XDfePrach *InstancePtr, s32 CCID, u32 CCSeqBitmap,
 		    const XDfePrach_CarrierCfg *CarrierCfg);
 u32 XDfePrach_RemoveCC(XDfePrach *InstancePtr, s32 CCID);
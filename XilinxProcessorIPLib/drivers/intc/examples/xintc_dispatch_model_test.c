@@ -0,0 +1,419 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xintc_dispatch_model_test.c
+*
+* Host test of the dispatch of XIntc_DeviceInterruptHandler() against stub
+* registers. It is not a target example: it is built and run with the other
+* driver model tests by make -C scripts/host_model, once as is and once
+* with the interrupt level register and the vector statistics
+* (XPAR_XINTC_HAS_ILR, XINTC_ENABLE_STATS).
+*
+* The stub registers log the acknowledges, the ILR writes and the exception
+* mask changes, and the vector handlers log their calls. For random status,
+* enable and mode registers, numbers of sources, acknowledge masks and
+* service options, the log of the driver must match the one of the loop
+* the driver used before, which tested the status one bit at a time; it is
+* kept in this file as RefDispatch(). With the statistics, the counts and
+* the times of every vector must match the ones seen by the reference, with
+* a time source moved by the handlers.
+*
+* The host time of one dispatch of both loops is then printed for a low, a
+* high and a few random pending interrupts; the reference does not keep
+* statistics.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 3.18  kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xintc.h"
+#include "xintc_i.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#ifdef XINTC_ENABLE_STATS
+#define TEST_NAME	"xintc_dispatch_stats_model_test"
+#else
+#define TEST_NAME	"xintc_dispatch_model_test"
+#endif
+
+#define NUM_VECTORS	32
+#define MAX_EVENTS	256U
+#define NUM_ROUNDS	20000U
+#define BENCH_ROUNDS	100000U
+#define BENCH_RUNS	5U
+
+/* Logged events */
+#define EV_CALL		1U		/* Handler of the vector in Value */
+#define EV_ACK		2U		/* Acknowledge of the mask in Value */
+#define EV_ILR		3U		/* ILR write of Value */
+#define EV_ENABLE	4U		/* Exceptions enabled */
+#define EV_DISABLE	5U		/* Exceptions disabled */
+
+/**************************** Type Definitions *******************************/
+
+typedef struct {
+	u32 Type;
+	u32 Value;
+} Event;
+
+typedef struct {
+	Event Events[MAX_EVENTS];
+	u32 NumEvents;
+	u32 Isr;			/* Status left at the end */
+	u32 Count[NUM_VECTORS];
+	u32 MaxLatency[NUM_VECTORS];
+	u32 MaxCycles[NUM_VECTORS];
+	u64 TotalCycles[NUM_VECTORS];
+} Log;
+
+/************************** Function Prototypes ******************************/
+
+XIntc_Config *LookupConfigByBaseAddress(UINTPTR BaseAddress);
+
+static void LogEvent(u32 Type, u32 Value);
+static void VectorHandler(void *CallBackRef);
+static void RefDispatch(void *DeviceId);
+static void SetState(u32 Isr, u32 Ier, u32 Imr);
+static u32 Random(void);
+static void CheckRound(u32 Round);
+static double Bench(u32 Isr, u32 Reference);
+
+/************************** Variable Definitions *****************************/
+
+static u32 Regs[16];
+static Log DriverLog;
+static Log RefLog;
+static Log *CurLog;
+static u32 Clock;		/* Time source of the statistics */
+static u32 EntryClock;		/* Clock at the entry of the reference */
+static u32 Seed = 1U;
+static u32 LogOn;
+
+XIntc_Config XIntc_ConfigTable[] = {
+	{ "intc", 0, 0U, 0, 0U, NUM_VECTORS, 32U, XIN_SVC_ALL_ISRS_OPTION,
+	  XIN_INTC_NOCASCADE },
+	{ NULL }
+};
+
+/*****************************************************************************/
+/*
+* Register model: an acknowledge clears the status bits.
+*/
+u32 Xil_In32(UINTPTR Addr)
+{
+	return Regs[(Addr - (UINTPTR)Regs) / 4U];
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	u32 Offset = (u32)(Addr - (UINTPTR)Regs);
+
+	if (Offset == XIN_IAR_OFFSET) {
+		Regs[XIN_ISR_OFFSET / 4U] &= ~Value;
+		LogEvent(EV_ACK, Value);
+	} else {
+		Regs[Offset / 4U] = Value;
+		if (Offset == XIN_ILR_OFFSET) {
+			LogEvent(EV_ILR, Value);
+		}
+	}
+}
+
+void Xil_ExceptionEnable(void)
+{
+	LogEvent(EV_ENABLE, 0U);
+}
+
+void Xil_ExceptionDisable(void)
+{
+	LogEvent(EV_DISABLE, 0U);
+}
+
+#ifdef XINTC_ENABLE_STATS
+static u32 ReadClock(void)
+{
+	return Clock;
+}
+#endif
+
+static void LogEvent(u32 Type, u32 Value)
+{
+	if ((LogOn != 0U) && (CurLog->NumEvents < MAX_EVENTS)) {
+		CurLog->Events[CurLog->NumEvents].Type = Type;
+		CurLog->Events[CurLog->NumEvents].Value = Value;
+		CurLog->NumEvents++;
+	}
+}
+
+/*****************************************************************************/
+/*
+* Vector handler: logs the call and spends (Id + 1) * 10 ticks. In the
+* reference it also keeps the statistics the driver must report.
+*/
+static void VectorHandler(void *CallBackRef)
+{
+	u32 Id = (u32)(UINTPTR)CallBackRef;
+
+	LogEvent(EV_CALL, Id);
+	if (CurLog == &RefLog) {
+		RefLog.Count[Id]++;
+		if ((Clock - EntryClock) > RefLog.MaxLatency[Id]) {
+			RefLog.MaxLatency[Id] = Clock - EntryClock;
+		}
+		if (((Id + 1U) * 10U) > RefLog.MaxCycles[Id]) {
+			RefLog.MaxCycles[Id] = (Id + 1U) * 10U;
+		}
+		RefLog.TotalCycles[Id] += (Id + 1U) * 10U;
+	}
+	Clock += (Id + 1U) * 10U;
+}
+
+/*****************************************************************************/
+/*
+* The dispatch loop of XIntc_DeviceInterruptHandler() before it used
+* XIntc_FirstPending(): the status is shifted one bit at a time.
+*/
+static void RefDispatch(void *DeviceId)
+{
+	XIntc_Config *CfgPtr = LookupConfigByBaseAddress((UINTPTR)DeviceId);
+	u32 IntrStatus;
+	u32 IntrMask = 1U;
+	int IntrNumber;
+	XIntc_VectorTableEntry *TablePtr;
+#if defined (XPAR_XINTC_HAS_ILR) && (XPAR_XINTC_HAS_ILR == TRUE)
+	u32 ILR_reg;
+
+	ILR_reg = Xil_In32(CfgPtr->BaseAddress + XIN_ILR_OFFSET);
+#endif
+	EntryClock = Clock;
+	IntrStatus = XIntc_GetIntrStatus(CfgPtr->BaseAddress);
+	if (CfgPtr->FastIntr == TRUE) {
+		IntrStatus &= ~XIntc_In32(CfgPtr->BaseAddress +
+					  XIN_IMR_OFFSET);
+	}
+
+	for (IntrNumber = 0; IntrNumber < (CfgPtr->NumberofIntrs +
+					   CfgPtr->NumberofSwIntrs);
+	     IntrNumber++) {
+		if (IntrStatus & 1) {
+#if defined (XPAR_XINTC_HAS_ILR) && (XPAR_XINTC_HAS_ILR == TRUE)
+			Xil_Out32(CfgPtr->BaseAddress + XIN_ILR_OFFSET,
+				  IntrNumber);
+			Xil_In32(CfgPtr->BaseAddress + XIN_ILR_OFFSET);
+			Xil_ExceptionEnable();
+#endif
+			if (CfgPtr->AckBeforeService & IntrMask) {
+				XIntc_AckIntr(CfgPtr->BaseAddress, IntrMask);
+			}
+			TablePtr = &(CfgPtr->HandlerTable[IntrNumber]);
+			TablePtr->Handler(TablePtr->CallBackRef);
+			if ((CfgPtr->AckBeforeService & IntrMask) == 0) {
+				XIntc_AckIntr(CfgPtr->BaseAddress, IntrMask);
+			}
+#if defined (XPAR_XINTC_HAS_ILR) && (XPAR_XINTC_HAS_ILR == TRUE)
+			Xil_ExceptionDisable();
+			Xil_Out32(CfgPtr->BaseAddress + XIN_ILR_OFFSET,
+				  ILR_reg);
+#endif
+			(void)XIntc_GetIntrStatus(CfgPtr->BaseAddress);
+			if (CfgPtr->Options == XIN_SVC_SGL_ISR_OPTION) {
+				return;
+			}
+		}
+		IntrMask <<= 1;
+		IntrStatus >>= 1;
+		if (IntrStatus == 0) {
+			break;
+		}
+	}
+}
+
+static void SetState(u32 Isr, u32 Ier, u32 Imr)
+{
+	Regs[XIN_ISR_OFFSET / 4U] = Isr;
+	Regs[XIN_IER_OFFSET / 4U] = Ier;
+	Regs[XIN_IMR_OFFSET / 4U] = Imr;
+	Regs[XIN_ILR_OFFSET / 4U] = 0xFFFFFFFFU;
+}
+
+static u32 Random(void)
+{
+	Seed = (Seed * 1103515245U) + 12345U;
+	return (Seed >> 16) | (Seed << 16);
+}
+
+/*****************************************************************************/
+/*
+* One random configuration, dispatched by the driver and by the reference
+* from the same registers.
+*/
+static void CheckRound(u32 Round)
+{
+	XIntc_Config *CfgPtr = &XIntc_ConfigTable[0];
+	u32 Isr = Random();
+	u32 Ier = Random() | Random();
+	u32 Imr = Random();
+
+	/* Mostly sparse status, sometimes all sources */
+	if ((Round % 4U) != 0U) {
+		Isr &= Random() & Random();
+	}
+	CfgPtr->NumberofIntrs = 1 + (int)(Random() % NUM_VECTORS);
+	CfgPtr->NumberofSwIntrs = (int)(Random() % (u32)(NUM_VECTORS + 1 -
+					CfgPtr->NumberofIntrs));
+	CfgPtr->FastIntr = ((Random() & 3U) == 0U) ? TRUE : FALSE;
+	CfgPtr->AckBeforeService = Random();
+	CfgPtr->Options = ((Random() & 1U) != 0U) ? XIN_SVC_SGL_ISR_OPTION :
+			  XIN_SVC_ALL_ISRS_OPTION;
+
+	(void)memset(&DriverLog.Events, 0, sizeof(DriverLog.Events));
+	(void)memset(&RefLog.Events, 0, sizeof(RefLog.Events));
+	DriverLog.NumEvents = 0U;
+	RefLog.NumEvents = 0U;
+
+	SetState(Isr, Ier, Imr);
+	CurLog = &DriverLog;
+	XIntc_DeviceInterruptHandler((void *)CfgPtr->BaseAddress);
+	DriverLog.Isr = Regs[XIN_ISR_OFFSET / 4U];
+
+	SetState(Isr, Ier, Imr);
+	CurLog = &RefLog;
+	RefDispatch((void *)CfgPtr->BaseAddress);
+	RefLog.Isr = Regs[XIN_ISR_OFFSET / 4U];
+
+	XHOST_CHECK((DriverLog.NumEvents == RefLog.NumEvents) &&
+		    (memcmp(DriverLog.Events, RefLog.Events,
+			    sizeof(DriverLog.Events)) == 0) &&
+		    (DriverLog.Isr == RefLog.Isr),
+		    "round %u: ISR %08x IER %08x IMR %08x, %d+%d sources, "
+		    "fast %d, ack before %08x, option %u: %u events, "
+		    "expected %u", (unsigned)Round, (unsigned)Isr,
+		    (unsigned)Ier, (unsigned)Imr, CfgPtr->NumberofIntrs,
+		    CfgPtr->NumberofSwIntrs, CfgPtr->FastIntr,
+		    (unsigned)CfgPtr->AckBeforeService,
+		    (unsigned)CfgPtr->Options, (unsigned)DriverLog.NumEvents,
+		    (unsigned)RefLog.NumEvents);
+}
+
+/*****************************************************************************/
+/*
+* Host time of one dispatch of the status Isr, by the driver or by the
+* reference, the best of BENCH_RUNS runs.
+*/
+static double Bench(u32 Isr, u32 Reference)
+{
+	XIntc_Config *CfgPtr = &XIntc_ConfigTable[0];
+	u32 Run;
+	u32 Round;
+	u64 StartNs;
+	u64 Ns;
+	u64 BestNs = ~0ULL;
+
+	for (Run = 0U; Run < BENCH_RUNS; Run++) {
+		StartNs = XHostModel_TimeNs();
+		for (Round = 0U; Round < BENCH_ROUNDS; Round++) {
+			Regs[XIN_ISR_OFFSET / 4U] = Isr;
+			if (Reference != 0U) {
+				RefDispatch((void *)CfgPtr->BaseAddress);
+			} else {
+				XIntc_DeviceInterruptHandler(
+					(void *)CfgPtr->BaseAddress);
+			}
+		}
+		Ns = XHostModel_TimeNs() - StartNs;
+		if (Ns < BestNs) {
+			BestNs = Ns;
+		}
+	}
+
+	return (double)BestNs / (double)BENCH_ROUNDS;
+}
+
+int main(void)
+{
+	XIntc_Config *CfgPtr = &XIntc_ConfigTable[0];
+	static const char *const Names[] = { "bit 0", "bit 30", "4 random" };
+	u32 BenchIsr[3];
+	u32 Round;
+	int Id;
+#ifdef XINTC_ENABLE_STATS
+	XIntc_VectorStats Stats;
+#endif
+
+	CfgPtr->BaseAddress = (UINTPTR)Regs;
+	for (Id = 0; Id < NUM_VECTORS; Id++) {
+		XIntc_RegisterHandler(CfgPtr->BaseAddress, Id, VectorHandler,
+				      (void *)(UINTPTR)Id);
+	}
+#ifdef XINTC_ENABLE_STATS
+	XIntc_SetStatsTimer(CfgPtr->BaseAddress, ReadClock);
+	XIntc_ResetVectorStats(CfgPtr->BaseAddress);
+#endif
+
+	LogOn = 1U;
+	for (Round = 0U; Round < NUM_ROUNDS; Round++) {
+		CheckRound(Round);
+	}
+
+#ifdef XINTC_ENABLE_STATS
+	for (Id = 0; Id < NUM_VECTORS; Id++) {
+		XIntc_GetVectorStats(CfgPtr->BaseAddress, Id, &Stats);
+		XHOST_CHECK((Stats.Count == RefLog.Count[Id]) &&
+			    (Stats.MaxLatency == RefLog.MaxLatency[Id]) &&
+			    (Stats.MaxCycles == RefLog.MaxCycles[Id]) &&
+			    (Stats.TotalCycles == RefLog.TotalCycles[Id]),
+			    "vector %d: %u calls, latency %u, cycles %u/%llu, "
+			    "expected %u, %u, %u/%llu", Id,
+			    (unsigned)Stats.Count, (unsigned)Stats.MaxLatency,
+			    (unsigned)Stats.MaxCycles,
+			    (unsigned long long)Stats.TotalCycles,
+			    (unsigned)RefLog.Count[Id],
+			    (unsigned)RefLog.MaxLatency[Id],
+			    (unsigned)RefLog.MaxCycles[Id],
+			    (unsigned long long)RefLog.TotalCycles[Id]);
+	}
+	XIntc_ResetVectorStats(CfgPtr->BaseAddress);
+	XIntc_GetVectorStats(CfgPtr->BaseAddress, 5, &Stats);
+	XHOST_CHECK((Stats.Count == 0U) && (Stats.MaxLatency == 0U) &&
+		    (Stats.MaxCycles == 0U) && (Stats.TotalCycles == 0U),
+		    "statistics not reset");
+#endif
+
+	/* All sources, every pending interrupt served, acked after */
+	LogOn = 0U;
+	CfgPtr->NumberofIntrs = NUM_VECTORS;
+	CfgPtr->NumberofSwIntrs = 0;
+	CfgPtr->FastIntr = FALSE;
+	CfgPtr->AckBeforeService = 0U;
+	CfgPtr->Options = XIN_SVC_ALL_ISRS_OPTION;
+	SetState(0U, 0xFFFFFFFFU, 0U);
+	BenchIsr[0] = 1U;
+	BenchIsr[1] = 1U << 30;
+	BenchIsr[2] = 0U;
+	while (__builtin_popcount(BenchIsr[2]) < 4) {
+		BenchIsr[2] |= 1U << (Random() % NUM_VECTORS);
+	}
+	printf("ns per dispatch   driver  bit loop\n");
+	for (Round = 0U; Round < 3U; Round++) {
+		printf("%-14s %9.1f %9.1f\n", Names[Round],
+		       Bench(BenchIsr[Round], 0U), Bench(BenchIsr[Round], 1U));
+	}
+
+	return XHostModel_Report(TEST_NAME);
+}
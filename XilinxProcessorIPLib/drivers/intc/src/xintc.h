@@ -68,6 +68,15 @@
 * tables should not mislead the user into thinking they no longer need to
 * register/connect interrupt handlers with this driver.
 *
+* <b>Vector Statistics</b>
+*
+* When the driver is built with XINTC_ENABLE_STATS defined, the primary
+* interrupt handler counts the invocations of each vector. If a time source is
+* registered with XIntc_SetStatsTimer(), it also records the dispatch latency,
+* from the entry of the primary handler to the call of the vector handler, and
+* the cycles spent in the vector handler. The statistics are read with
+* XIntc_GetVectorStats().
+*
 * <pre>
 * MODIFICATION HISTORY:
 *
@@ -201,6 +210,7 @@
 * 3.11   adk  10/03/20 Fix race condition for designs where interrupt pin is
 *                      connected to cascade slices.
 * 3.13   mus  12/22/20 Updated source code comments. It fixes CR#1080821
+* 3.18   kt   10/18/26 Added per-vector statistics in XIntc_Config.
 * </pre>
 *
 ******************************************************************************/
@@ -311,6 +321,15 @@ typedef struct {
 	XIntc_VectorTableEntry HandlerTable[XPAR_INTC_MAX_NUM_INTR_INPUTS];
 #endif
 	int NumberofSwIntrs;      /**< Number of SW interrupts */
+#ifdef XINTC_ENABLE_STATS
+	XIntc_StatsTimer StatsTimer;	/**< Time source of the statistics */
+	/** Statistics of the vector table entries */
+#if XPAR_INTC_0_INTC_TYPE != XIN_INTC_NOCASCADE
+	XIntc_VectorStats Stats[XIN_CONTROLLER_MAX_INTRS];
+#else
+	XIntc_VectorStats Stats[XPAR_INTC_MAX_NUM_INTR_INPUTS];
+#endif
+#endif
 } XIntc_Config;
 
 /**
@@ -25,6 +25,7 @@
 *                     pointer.
 * 1.10c mta  03/21/07 Updated to new coding style
 * 2.00a ktn  10/20/09 Updated to use HAL Processor APIs.
+* 3.18  kt   10/18/26 Added XIntc_FirstPending macro.
 * </pre>
 *
 ******************************************************************************/
@@ -50,9 +51,31 @@ extern "C" {
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
+/****************************************************************************/
+/**
+*
+* Returns the number of the lowest set bit of a non-zero pending mask, that
+* is the highest priority interrupt waiting to be serviced.
+*
+* @param	Pending is the mask of pending interrupts, it must not be 0.
+*
+* @return	The interrupt number.
+*
+* @note		C-style signature:
+*		int XIntc_FirstPending(u32 Pending);
+*
+*****************************************************************************/
+#if defined (__GNUC__)
+#define XIntc_FirstPending(Pending)	__builtin_ctz(Pending)
+#else
+#define XIntc_FirstPending(Pending)	XIntc_LowestBit(Pending)
+#endif
 
 /************************** Function Prototypes ******************************/
 
+#if !defined (__GNUC__)
+int XIntc_LowestBit(u32 Pending);
+#endif
 
 /************************** Variable Definitions *****************************/
 
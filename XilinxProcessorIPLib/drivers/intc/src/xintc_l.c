@@ -60,6 +60,10 @@
 *                     in case of microbalze. It fixes CR#1120158.
 * 3.16  mus  10/04/22 Fixed warnings reported with "-Wundef" compiler flag.
 *                     It fixes CR#1142085.
+* 3.18  kt   10/18/26 Updated XIntc_DeviceInterruptHandler and
+*                     XIntc_CascadeHandler to find pending interrupts with
+*                     XIntc_FirstPending instead of shifting the status bit
+*                     by bit. Added per-vector statistics.
 *
 * </pre>
 *
@@ -92,6 +96,12 @@ XIntc_Config *LookupConfigByBaseAddress(UINTPTR BaseAddress);
 static void XIntc_CascadeHandler(void *DeviceId);
 #endif
 
+#ifdef XINTC_ENABLE_STATS
+static u32 XIntc_StatsTime(const XIntc_Config *CfgPtr);
+static void XIntc_UpdateStats(XIntc_Config *CfgPtr, int IntrNumber, u32 Entry,
+			      u32 Start);
+#endif
+
 /************************** Variable Definitions *****************************/
 
 #ifdef XPAR_INTC_SINGLE_DEVICE_ID
@@ -172,10 +182,16 @@ void XIntc_LowLevelInterruptHandler(void)
 void XIntc_DeviceInterruptHandler(void *DeviceId)
 {
 	u32 IntrStatus;
-	u32 IntrMask = 1;
+	u32 IntrMask;
 	int IntrNumber;
+	int NumIntrs;
 	XIntc_Config *CfgPtr;
+	XIntc_VectorTableEntry *TablePtr;
 	u32 Imr;
+#ifdef XINTC_ENABLE_STATS
+	u32 Entry;
+	u32 Start;
+#endif
 
 #if defined(SDT)
 	CfgPtr = LookupConfigByBaseAddress((UINTPTR)DeviceId);
@@ -200,6 +216,9 @@ void XIntc_DeviceInterruptHandler(void *DeviceId)
 		volatile u32 ILR_reg;
 		/* Save ILR register */
 		ILR_reg = Xil_In32(CfgPtr->BaseAddress + XIN_ILR_OFFSET);
+#endif
+#ifdef XINTC_ENABLE_STATS
+		Entry = XIntc_StatsTime(CfgPtr);
 #endif
 		/* Get the interrupts that are waiting to be serviced */
 		IntrStatus = XIntc_GetIntrStatus(CfgPtr->BaseAddress);
@@ -210,105 +229,106 @@ void XIntc_DeviceInterruptHandler(void *DeviceId)
 			IntrStatus &=  ~Imr;
 		}
 
-		/* Service each interrupt that is active and enabled by
-		 * checking each bit in the register from LSB to MSB which
-		 * corresponds to an interrupt input signal
+		/* Ignore the bits above the interrupt sources */
+		NumIntrs = CfgPtr->NumberofIntrs + CfgPtr->NumberofSwIntrs;
+		if (NumIntrs < XIN_CONTROLLER_MAX_INTRS) {
+			IntrStatus &= ((u32)1 << NumIntrs) - 1U;
+		}
+
+		/* Service each interrupt that is active and enabled, going
+		 * straight to the lowest set bit, which is the highest
+		 * priority interrupt still pending
 		 */
-		for (IntrNumber = 0; IntrNumber < (CfgPtr->NumberofIntrs + CfgPtr->NumberofSwIntrs);
-		     IntrNumber++) {
-			if (IntrStatus & 1) {
-				XIntc_VectorTableEntry *TablePtr;
+		while (IntrStatus != 0U) {
+			IntrNumber = XIntc_FirstPending(IntrStatus);
+			IntrMask = (u32)1 << IntrNumber;
+			IntrStatus &= ~IntrMask;
 #if defined (XPAR_XINTC_HAS_ILR) && (XPAR_XINTC_HAS_ILR == TRUE)
-				/* Write to ILR the current interrupt
-				* number
-				*/
-				Xil_Out32(CfgPtr->BaseAddress +
-					  XIN_ILR_OFFSET, IntrNumber);
+			/* Write to ILR the current interrupt
+			* number
+			*/
+			Xil_Out32(CfgPtr->BaseAddress +
+				  XIN_ILR_OFFSET, IntrNumber);
 
-				/* Read back ILR to ensure the value
-				* has been updated and it is safe to
-				* enable interrupts
-				*/
+			/* Read back ILR to ensure the value
+			* has been updated and it is safe to
+			* enable interrupts
+			*/
 
-				Xil_In32(CfgPtr->BaseAddress +
-					 XIN_ILR_OFFSET);
+			Xil_In32(CfgPtr->BaseAddress +
+				 XIN_ILR_OFFSET);
 
-				/* Enable interrupts */
+			/* Enable interrupts */
 #ifdef __MICROBLAZE__
-				microblaze_enable_interrupts();
+			microblaze_enable_interrupts();
 #else
-				Xil_ExceptionEnable();
+			Xil_ExceptionEnable();
+#endif
+#endif
+			/* If the interrupt has been setup to
+			 * acknowledge it before servicing the
+			 * interrupt, then ack it */
+			if (CfgPtr->AckBeforeService & IntrMask) {
+				XIntc_AckIntr(CfgPtr->BaseAddress,
+					      IntrMask);
+			}
+
+			/* The interrupt is active and enabled, call
+			 * the interrupt handler that was setup with
+			 * the specified parameter
+			 */
+			TablePtr = &(CfgPtr->HandlerTable[IntrNumber]);
+#ifdef XINTC_ENABLE_STATS
+			Start = XIntc_StatsTime(CfgPtr);
 #endif
+			TablePtr->Handler(TablePtr->CallBackRef);
+#ifdef XINTC_ENABLE_STATS
+			XIntc_UpdateStats(CfgPtr, IntrNumber, Entry,
+					  Start);
 #endif
-				/* If the interrupt has been setup to
-				 * acknowledge it before servicing the
-				 * interrupt, then ack it */
-				if (CfgPtr->AckBeforeService & IntrMask) {
-					XIntc_AckIntr(CfgPtr->BaseAddress,
-						      IntrMask);
-				}
-
-				/* The interrupt is active and enabled, call
-				 * the interrupt handler that was setup with
-				 * the specified parameter
-				 */
-				TablePtr = &(CfgPtr->HandlerTable[IntrNumber]);
-				TablePtr->Handler(TablePtr->CallBackRef);
-
-				/* If the interrupt has been setup to
-				 * acknowledge it after it has been serviced
-				 * then ack it
-				 */
-				if ((CfgPtr->AckBeforeService &
-				     IntrMask) == 0) {
-					XIntc_AckIntr(CfgPtr->BaseAddress,
-						      IntrMask);
-				}
+
+			/* If the interrupt has been setup to
+			 * acknowledge it after it has been serviced
+			 * then ack it
+			 */
+			if ((CfgPtr->AckBeforeService &
+			     IntrMask) == 0) {
+				XIntc_AckIntr(CfgPtr->BaseAddress,
+					      IntrMask);
+			}
 
 #if defined (XPAR_XINTC_HAS_ILR) && (XPAR_XINTC_HAS_ILR == TRUE)
-				/* Disable interrupts */
+			/* Disable interrupts */
 #ifdef __MICROBLAZE__
-				microblaze_disable_interrupts();
+			microblaze_disable_interrupts();
 #else
-				Xil_ExceptionDisable();
+			Xil_ExceptionDisable();
 #endif
-				/* Restore ILR */
-				Xil_Out32(CfgPtr->BaseAddress + XIN_ILR_OFFSET,
-					  ILR_reg);
+			/* Restore ILR */
+			Xil_Out32(CfgPtr->BaseAddress + XIN_ILR_OFFSET,
+				  ILR_reg);
 #endif
-				/*
-				 * Read the ISR again to handle architectures
-				 * with posted write bus access issues.
-				 */
-				(void) XIntc_GetIntrStatus(CfgPtr->BaseAddress);
-
-				/*
-				 * If only the highest priority interrupt is to
-				 * be serviced, exit loop and return after
-				 * servicing
-				 * the interrupt
-				 */
-				if (CfgPtr->Options == XIN_SVC_SGL_ISR_OPTION) {
+			/*
+			 * Read the ISR again to handle architectures
+			 * with posted write bus access issues.
+			 */
+			(void) XIntc_GetIntrStatus(CfgPtr->BaseAddress);
+
+			/*
+			 * If only the highest priority interrupt is to
+			 * be serviced, exit loop and return after
+			 * servicing
+			 * the interrupt
+			 */
+			if (CfgPtr->Options == XIN_SVC_SGL_ISR_OPTION) {
 
 #if defined (XPAR_XINTC_HAS_ILR) && (XPAR_XINTC_HAS_ILR == TRUE)
 #ifdef __MICROBLAZE__
-					/* Restore r14 */
-					mtgpr(r14, R14_register);
+				/* Restore r14 */
+				mtgpr(r14, R14_register);
 #endif
 #endif
-					return;
-				}
-			}
-
-			/* Move	 to the next interrupt to check */
-			IntrMask <<= 1;
-			IntrStatus >>= 1;
-
-			/* If there are no other bits set indicating that all
-			 * interrupts have been serviced, then exit the loop
-			 */
-			if (IntrStatus == 0) {
-				break;
+				return;
 			}
 		}
 #if defined (XPAR_XINTC_HAS_ILR) && (XPAR_XINTC_HAS_ILR == TRUE)
@@ -617,11 +637,17 @@ void XIntc_RegisterFastHandler(UINTPTR BaseAddress, u8 Id,
 static void XIntc_CascadeHandler(void *DeviceId)
 {
 	u32 IntrStatus;
-	u32 IntrMask = 1;
+	u32 IntrMask;
 	int IntrNumber;
+	int NumIntrs;
 	u32 Imr;
 	XIntc_Config *CfgPtr;
+	XIntc_VectorTableEntry *TablePtr;
 	static int Id = 0;
+#ifdef XINTC_ENABLE_STATS
+	u32 Entry;
+	u32 Start;
+#endif
 
 	/* Get the configuration data using the device ID */
 	CfgPtr = &XIntc_ConfigTable[(u32)DeviceId];
@@ -629,6 +655,9 @@ static void XIntc_CascadeHandler(void *DeviceId)
 		return;
 	}
 
+#ifdef XINTC_ENABLE_STATS
+	Entry = XIntc_StatsTime(CfgPtr);
+#endif
 	/* Get the interrupts that are waiting to be serviced */
 	IntrStatus = XIntc_GetIntrStatus(CfgPtr->BaseAddress);
 
@@ -638,79 +667,306 @@ static void XIntc_CascadeHandler(void *DeviceId)
 		IntrStatus &=  ~Imr;
 	}
 
-	/* Service each interrupt that is active and enabled by
-	 * checking each bit in the register from LSB to MSB which
-	 * corresponds to an interrupt input signal
+	/* Ignore the bits above the interrupt sources */
+	NumIntrs = CfgPtr->NumberofIntrs + CfgPtr->NumberofSwIntrs;
+	if (NumIntrs < XIN_CONTROLLER_MAX_INTRS) {
+		IntrStatus &= ((u32)1 << NumIntrs) - 1U;
+	}
+
+	/* Service each interrupt that is active and enabled, going straight
+	 * to the lowest set bit, which is the highest priority interrupt
+	 * still pending
 	 */
-	for (IntrNumber = 0; IntrNumber < (CfgPtr->NumberofIntrs + CfgPtr->NumberofSwIntrs); IntrNumber++) {
-		if (IntrStatus & 1) {
-			XIntc_VectorTableEntry *TablePtr;
+	while (IntrStatus != 0U) {
+		IntrNumber = XIntc_FirstPending(IntrStatus);
+		IntrMask = (u32)1 << IntrNumber;
+		IntrStatus &= ~IntrMask;
+
+		/* In Cascade mode call this function recursively
+		 * for interrupt id 31 and until interrupts of last
+		 * instance/controller are handled
+		 */
+		if ((IntrNumber == 31) &&
+		    (CfgPtr->IntcType != XIN_INTC_LAST) &&
+		    (CfgPtr->IntcType != XIN_INTC_NOCASCADE)) {
+			XIntc_CascadeHandler((void *)++Id);
+			Id--;
+		}
 
-			/* In Cascade mode call this function recursively
-			 * for interrupt id 31 and until interrupts of last
-			 * instance/controller are handled
-			 */
-			if ((IntrNumber == 31) &&
-			    (CfgPtr->IntcType != XIN_INTC_LAST) &&
-			    (CfgPtr->IntcType != XIN_INTC_NOCASCADE)) {
-				XIntc_CascadeHandler((void *)++Id);
-				Id--;
-			}
+		/* If the interrupt has been setup to
+		 * acknowledge it before servicing the
+		 * interrupt, then ack it */
+		if (CfgPtr->AckBeforeService & IntrMask) {
+			XIntc_AckIntr(CfgPtr->BaseAddress, IntrMask);
+		}
 
-			/* If the interrupt has been setup to
-			 * acknowledge it before servicing the
-			 * interrupt, then ack it */
-			if (CfgPtr->AckBeforeService & IntrMask) {
-				XIntc_AckIntr(CfgPtr->BaseAddress, IntrMask);
-			}
+		/* Handler of 31 interrupt Id has to be called only
+		 * for Last controller in cascade Mode
+		 */
+		if (!((IntrNumber == 31) &&
+		      (CfgPtr->IntcType != XIN_INTC_LAST) &&
+		      (CfgPtr->IntcType != XIN_INTC_NOCASCADE))) {
 
-			/* Handler of 31 interrupt Id has to be called only
-			 * for Last controller in cascade Mode
+			/* The interrupt is active and enabled, call
+			 * the interrupt handler that was setup with
+			 * the specified parameter
 			 */
-			if (!((IntrNumber == 31) &&
-			      (CfgPtr->IntcType != XIN_INTC_LAST) &&
-			      (CfgPtr->IntcType != XIN_INTC_NOCASCADE))) {
-
-				/* The interrupt is active and enabled, call
-				 * the interrupt handler that was setup with
-				 * the specified parameter
-				 */
-				TablePtr = &(CfgPtr->HandlerTable[IntrNumber]);
-				TablePtr->Handler(TablePtr->CallBackRef);
+			TablePtr = &(CfgPtr->HandlerTable[IntrNumber]);
+#ifdef XINTC_ENABLE_STATS
+			Start = XIntc_StatsTime(CfgPtr);
+#endif
+			TablePtr->Handler(TablePtr->CallBackRef);
+#ifdef XINTC_ENABLE_STATS
+			XIntc_UpdateStats(CfgPtr, IntrNumber, Entry,
+					  Start);
+#endif
+		}
+		/* If the interrupt has been setup to acknowledge it
+		 * after it has been serviced then ack it
+		 */
+		if ((CfgPtr->AckBeforeService & IntrMask) == 0) {
+			XIntc_AckIntr(CfgPtr->BaseAddress, IntrMask);
+		}
+
+		/*
+		 * Read the ISR again to handle architectures with
+		 * posted write bus access issues.
+		 */
+		XIntc_GetIntrStatus(CfgPtr->BaseAddress);
+
+		/*
+		 * If only the highest priority interrupt is to be
+		 * serviced, exit loop and return after servicing
+		 * the interrupt
+		 */
+		if (CfgPtr->Options == XIN_SVC_SGL_ISR_OPTION) {
+			return;
+		}
+	}
+}
+#endif
+
+
+#if !defined (__GNUC__)
+/*****************************************************************************/
+/**
+*
+* Returns the number of the lowest set bit of a non-zero pending mask. It is
+* used by XIntc_FirstPending when the compiler has no count trailing zeros
+* builtin.
+*
+* @param	Pending is the mask of pending interrupts, it must not be 0.
+*
+* @return	The interrupt number.
+*
+* @note		None.
+*
+******************************************************************************/
+int XIntc_LowestBit(u32 Pending)
+{
+	int Bit = 0;
+	u32 Mask = Pending;
+
+	if ((Mask & 0xFFFFU) == 0U) {
+		Mask >>= 16;
+		Bit += 16;
+	}
+	if ((Mask & 0xFFU) == 0U) {
+		Mask >>= 8;
+		Bit += 8;
+	}
+	if ((Mask & 0xFU) == 0U) {
+		Mask >>= 4;
+		Bit += 4;
+	}
+	if ((Mask & 0x3U) == 0U) {
+		Mask >>= 2;
+		Bit += 2;
+	}
+	if ((Mask & 0x1U) == 0U) {
+		Bit += 1;
+	}
+
+	return Bit;
+}
+#endif
+
+#ifdef XINTC_ENABLE_STATS
+/*****************************************************************************/
+/**
+*
+* Reads the time source of the vector statistics.
+*
+* @param	CfgPtr is the configuration of the interrupt controller.
+*
+* @return	The current time, or 0 if no time source is registered.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XIntc_StatsTime(const XIntc_Config *CfgPtr)
+{
+	return (CfgPtr->StatsTimer != NULL) ? CfgPtr->StatsTimer() : 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* Updates the statistics of a vector after its handler has returned.
+*
+* @param	CfgPtr is the configuration of the interrupt controller.
+* @param	IntrNumber is the interrupt number on this controller.
+* @param	Entry is the time the primary handler was entered.
+* @param	Start is the time the vector handler was called.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XIntc_UpdateStats(XIntc_Config *CfgPtr, int IntrNumber, u32 Entry,
+			      u32 Start)
+{
+	XIntc_VectorStats *StatsPtr = &CfgPtr->Stats[IntrNumber];
+	u32 Latency;
+	u32 Cycles;
+
+	StatsPtr->Count++;
+
+	if (CfgPtr->StatsTimer != NULL) {
+		Latency = Start - Entry;
+		Cycles = CfgPtr->StatsTimer() - Start;
+		if (Latency > StatsPtr->MaxLatency) {
+			StatsPtr->MaxLatency = Latency;
+		}
+		if (Cycles > StatsPtr->MaxCycles) {
+			StatsPtr->MaxCycles = Cycles;
+		}
+		StatsPtr->TotalCycles += Cycles;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Registers the time source of the vector statistics. In Cascade mode the
+* time source is set for the Slave controllers too.
+*
+* @param	BaseAddress is the base address of the interrupt controller.
+* @param	Timer is the function returning the current time, or NULL to
+*		only count the invocations.
+*
+* @return	None.
+*
+* @note		This function has no effect if the input base address is
+*		invalid.
+*
+******************************************************************************/
+void XIntc_SetStatsTimer(UINTPTR BaseAddress, XIntc_StatsTimer Timer)
+{
+	XIntc_Config *CfgPtr;
+
+	CfgPtr = LookupConfigByBaseAddress(BaseAddress);
+	if (CfgPtr != NULL) {
+		CfgPtr->StatsTimer = Timer;
+		/* If Cascade mode set the time source for all Slaves */
+		if (CfgPtr->IntcType != XIN_INTC_NOCASCADE) {
+			int Index;
+#ifndef SDT
+			for (Index = 1; Index <= XPAR_XINTC_NUM_INSTANCES - 1;
+			     Index++) {
+				CfgPtr = XIntc_LookupConfig(Index);
+				CfgPtr->StatsTimer = Timer;
 			}
-			/* If the interrupt has been setup to acknowledge it
-			 * after it has been serviced then ack it
-			 */
-			if ((CfgPtr->AckBeforeService & IntrMask) == 0) {
-				XIntc_AckIntr(CfgPtr->BaseAddress, IntrMask);
+#else
+			for (Index = 1;  XIntc_ConfigTable[Index].Name != NULL;
+			     Index++) {
+				CfgPtr = XIntc_LookupConfig(XIntc_ConfigTable[Index].BaseAddress);
+				CfgPtr->StatsTimer = Timer;
 			}
+#endif
+		}
+	}
+}
 
-			/*
-			 * Read the ISR again to handle architectures with
-			 * posted write bus access issues.
-			 */
-			XIntc_GetIntrStatus(CfgPtr->BaseAddress);
+/*****************************************************************************/
+/**
+*
+* Reads the statistics of an interrupt ID. In Cascade mode the Interrupt Id
+* is used to read the statistics of the corresponding Slave Controller.
+*
+* @param	BaseAddress is the base address of the interrupt controller.
+* @param	InterruptId is the interrupt ID.
+* @param	StatsPtr is a pointer to the structure the statistics are
+*		copied to.
+*
+* @return	None.
+*
+* @note		This function has no effect if the input base address is
+*		invalid.
+*
+******************************************************************************/
+void XIntc_GetVectorStats(UINTPTR BaseAddress, int InterruptId,
+			  XIntc_VectorStats *StatsPtr)
+{
+	XIntc_Config *CfgPtr;
 
-			/*
-			 * If only the highest priority interrupt is to be
-			 * serviced, exit loop and return after servicing
-			 * the interrupt
-			 */
-			if (CfgPtr->Options == XIN_SVC_SGL_ISR_OPTION) {
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	CfgPtr = LookupConfigByBaseAddress(BaseAddress);
+	if (CfgPtr != NULL) {
+		if (InterruptId > 31) {
+			CfgPtr = XIntc_LookupConfig(InterruptId / 32);
+			if (CfgPtr == NULL) {
 				return;
 			}
+			*StatsPtr = CfgPtr->Stats[InterruptId % 32];
+		} else {
+			*StatsPtr = CfgPtr->Stats[InterruptId];
 		}
+	}
+}
 
-		/* Move	 to the next interrupt to check */
-		IntrMask <<= 1;
-		IntrStatus >>= 1;
+/*****************************************************************************/
+/**
+*
+* Clears the statistics of all interrupt IDs. In Cascade mode the statistics
+* of the Slave controllers are cleared too.
+*
+* @param	BaseAddress is the base address of the interrupt controller.
+*
+* @return	None.
+*
+* @note		This function has no effect if the input base address is
+*		invalid.
+*
+******************************************************************************/
+void XIntc_ResetVectorStats(UINTPTR BaseAddress)
+{
+	XIntc_Config *CfgPtr;
+	int Index;
+	int Vector;
 
-		/* If there are no other bits set indicating that all interrupts
-		 * have been serviced, then exit the loop
-		 */
-		if (IntrStatus == 0) {
+	CfgPtr = LookupConfigByBaseAddress(BaseAddress);
+	for (Index = 1; CfgPtr != NULL; Index++) {
+		for (Vector = 0; Vector < (int)(sizeof(CfgPtr->Stats) /
+				sizeof(CfgPtr->Stats[0])); Vector++) {
+			CfgPtr->Stats[Vector].Count = 0U;
+			CfgPtr->Stats[Vector].MaxLatency = 0U;
+			CfgPtr->Stats[Vector].MaxCycles = 0U;
+			CfgPtr->Stats[Vector].TotalCycles = 0U;
+		}
+		if (CfgPtr->IntcType == XIN_INTC_NOCASCADE) {
 			break;
 		}
+#ifndef SDT
+		CfgPtr = (Index < XPAR_XINTC_NUM_INSTANCES) ?
+			 XIntc_LookupConfig(Index) : NULL;
+#else
+		CfgPtr = (XIntc_ConfigTable[Index].Name != NULL) ?
+			 XIntc_LookupConfig(XIntc_ConfigTable[Index].BaseAddress) :
+			 NULL;
+#endif
 	}
 }
 #endif
@@ -59,6 +59,8 @@
 * 3.16  mus  10/04/22 Fixed warnings reported with "-Wundef" compiler flag.
 *                     It fixes CR#1142085.
 *
+* 3.18  kt   10/18/26 Added XIntc_VectorStats and the statistics functions.
+*
 * </pre>
 *
 ******************************************************************************/
@@ -153,6 +155,22 @@ typedef struct {
 
 typedef void (*XFastInterruptHandler) (void);
 
+/* Time source of the vector statistics. It returns a free running count,
+ * e.g. the cycle counter of the processor or the counter of a timer.
+ */
+typedef u32 (*XIntc_StatsTimer) (void);
+
+/* The following data type holds the statistics of a vector table entry. The
+ * latency and cycle fields are in units of the registered time source and
+ * are left at zero when there is none.
+ */
+typedef struct {
+	u32 Count;		/* Calls of the vector handler */
+	u32 MaxLatency;		/* Maximum entry to dispatch latency */
+	u32 MaxCycles;		/* Maximum time spent in the handler */
+	u64 TotalCycles;	/* Total time spent in the handler */
+} XIntc_VectorStats;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*
@@ -307,6 +325,14 @@ void XIntc_RegisterHandler(UINTPTR BaseAddress, int InterruptId,
 void XIntc_RegisterFastHandler(UINTPTR BaseAddress, u8 Id,
 			       XFastInterruptHandler FastHandler);
 
+#ifdef XINTC_ENABLE_STATS
+/* Vector statistics functions */
+void XIntc_SetStatsTimer(UINTPTR BaseAddress, XIntc_StatsTimer Timer);
+void XIntc_GetVectorStats(UINTPTR BaseAddress, int InterruptId,
+			  XIntc_VectorStats *StatsPtr);
+void XIntc_ResetVectorStats(UINTPTR BaseAddress);
+#endif
+
 /************************** Variable Definitions *****************************/
 
 
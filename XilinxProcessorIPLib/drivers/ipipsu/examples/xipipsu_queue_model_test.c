@@ -0,0 +1,413 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xipipsu_queue_model_test.c
+*
+* Host test of the message queue of xipipsu_queue.c between two threads, a
+* requester and a server, each standing for a processor. It is not a target
+* example: it is built and run with the other driver model tests by
+* make -C scripts/host_model.
+*
+* The IPI registers of both processors are modelled: a trigger sets the
+* bit of the source in the status of each destination, the Observation
+* register shows the destinations which have not cleared it yet, and a
+* status write clears it. Each thread only reads its ring when it sees the
+* doorbell, so a lost doorbell stops the exchange; the threads give up
+* after WAIT_NS without one.
+*
+* The requester keeps up to twice the ring depth of requests in flight, so
+* both ends meet a full ring. The server answers each batch it drained in
+* reverse order. Every request must be completed once, with its tag and
+* its payload, and the doorbells rung and skipped must add up. The
+* requests per second and the doorbells per request are printed for a few
+* depths and batches.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 2.15  kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include "xipipsu.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define NUM_REQUESTS	50000U
+#define MAX_DEPTH	64U
+#define MAX_WINDOW	(2U * MAX_DEPTH)
+#define WAIT_NS		2000000000ULL
+
+#define REQUESTER	0U
+#define SERVER		1U
+#define REQUESTER_MASK	0x00000001U	/* APU */
+#define SERVER_MASK	0x00000100U	/* RPU 0 */
+
+/**************************** Type Definitions *******************************/
+
+typedef struct {
+	u32 Depth;
+	u32 Batch;
+} Setting;
+
+typedef struct {
+	u32 Tag;
+	u32 Msg[XIPIPSU_MAX_MSG_LEN];
+	u32 MsgLength;
+} Held;
+
+/************************** Function Prototypes ******************************/
+
+static u32 RegDev(UINTPTR Addr);
+static void Interleave(void);
+static u32 Expected(u32 Tag, u32 Index);
+static u32 MsgLength(u32 Tag);
+static int WaitDoorbell(u32 Dev, XIpiPsu *InstancePtr, u32 SourceMask);
+static void *Server(void *Arg);
+static void RunSetting(const Setting *SettingPtr);
+
+/************************** Variable Definitions *****************************/
+
+static u32 Regs[2][8];
+static const u32 DevMask[2] = { REQUESTER_MASK, SERVER_MASK };
+
+static u8 RingMem[2][XIPIPSU_QUEUE_RING_SIZE(MAX_DEPTH)]
+	__attribute__((aligned(XIPIPSU_QUEUE_ALIGN)));
+
+static XIpiPsu Ipi[2];
+static XIpiPsu_Queue Queue[2];
+static u8 Pending[NUM_REQUESTS];
+static volatile u32 Stop;
+static __thread u32 Seed = 1U;
+
+/*****************************************************************************/
+/*
+* Register model, shared by the two threads. A trigger sets the bit of the
+* source in the status of the destinations; the Observation register of a
+* source shows the destinations whose status still has its bit. One access
+* in eight yields to the other thread, to vary the interleavings when the
+* host has a single processor.
+*/
+static void Interleave(void)
+{
+	Seed = (Seed * 1103515245U) + 12345U;
+	if ((Seed >> 29) == 0U) {
+		(void)sched_yield();
+	}
+}
+
+static u32 RegDev(UINTPTR Addr)
+{
+	return (Addr >= (UINTPTR)Regs[SERVER]) ? SERVER : REQUESTER;
+}
+
+u32 Xil_In32(UINTPTR Addr)
+{
+	u32 Dev = RegDev(Addr);
+	u32 *Reg = (u32 *)Addr;
+	u32 Offset = (u32)(Addr - (UINTPTR)Regs[Dev]);
+
+	Interleave();
+	u32 Value = 0U;
+	u32 Dest;
+
+	if (Offset == XIPIPSU_OBS_OFFSET) {
+		for (Dest = 0U; Dest < 2U; Dest++) {
+			if ((__atomic_load_n(&Regs[Dest][XIPIPSU_ISR_OFFSET /
+					     4U], __ATOMIC_SEQ_CST) &
+			     DevMask[Dev]) != 0U) {
+				Value |= DevMask[Dest];
+			}
+		}
+	} else {
+		Value = __atomic_load_n(Reg, __ATOMIC_SEQ_CST);
+	}
+
+	return Value;
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	u32 Dev = RegDev(Addr);
+	u32 *Reg = (u32 *)Addr;
+	u32 Offset = (u32)(Addr - (UINTPTR)Regs[Dev]);
+
+	Interleave();
+	u32 Dest;
+
+	if (Offset == XIPIPSU_TRIG_OFFSET) {
+		for (Dest = 0U; Dest < 2U; Dest++) {
+			if ((Value & DevMask[Dest]) != 0U) {
+				(void)__atomic_fetch_or(
+					&Regs[Dest][XIPIPSU_ISR_OFFSET / 4U],
+					DevMask[Dev], __ATOMIC_SEQ_CST);
+			}
+		}
+	} else if (Offset == XIPIPSU_ISR_OFFSET) {
+		(void)__atomic_fetch_and(Reg, ~Value, __ATOMIC_SEQ_CST);
+	} else {
+		__atomic_store_n(Reg, Value, __ATOMIC_SEQ_CST);
+	}
+}
+
+static u32 Expected(u32 Tag, u32 Index)
+{
+	return (Tag * 2654435761U) + (Index * 40503U);
+}
+
+static u32 MsgLength(u32 Tag)
+{
+	return 1U + (Tag % XIPIPSU_MAX_MSG_LEN);
+}
+
+/*****************************************************************************/
+/*
+* Waits for the doorbell of SourceMask and clears it, as the interrupt
+* handler of the processor would before draining its ring.
+*
+* @return	0 when it rang, -1 after WAIT_NS or when the other thread
+*		gave up
+*/
+static int WaitDoorbell(u32 Dev, XIpiPsu *InstancePtr, u32 SourceMask)
+{
+	u64 StartNs = XHostModel_TimeNs();
+	u32 Spins = 0U;
+
+	while ((XIpiPsu_GetInterruptStatus(InstancePtr) & SourceMask) == 0U) {
+		if (Stop != 0U) {
+			return -1;
+		}
+		Spins++;
+		if (((Spins & 0xFFU) == 0U) &&
+		    ((XHostModel_TimeNs() - StartNs) > WAIT_NS)) {
+			XHOST_CHECK(0, "%s: no doorbell for %llu ms",
+				    (Dev == SERVER) ? "server" : "requester",
+				    WAIT_NS / 1000000ULL);
+			Stop = 1U;
+			return -1;
+		}
+		(void)sched_yield();
+	}
+	XIpiPsu_ClearInterruptStatus(InstancePtr, SourceMask);
+
+	return 0;
+}
+
+/*****************************************************************************/
+/*
+* Server thread: on each doorbell, drains the requests and completes them
+* in reverse order, with the payload inverted.
+*/
+static void *Server(void *Arg)
+{
+	static Held Batch[MAX_WINDOW + MAX_DEPTH];
+	XIpiPsu_Queue *QueuePtr = &Queue[SERVER];
+	u32 Served = 0U;
+	u32 Count;
+	u32 Index;
+	u32 Word;
+	XStatus Status;
+
+	(void)Arg;
+	Seed = 2U;
+	while (Served < NUM_REQUESTS) {
+		if (WaitDoorbell(SERVER, &Ipi[SERVER], REQUESTER_MASK) != 0) {
+			break;
+		}
+
+		Count = 0U;
+		while (Count < (MAX_WINDOW + MAX_DEPTH)) {
+			Status = XIpiPsu_QueueReceive(QueuePtr,
+						      &Batch[Count].Tag,
+						      Batch[Count].Msg,
+						      &Batch[Count].MsgLength);
+			if (Status == (XStatus)XST_NO_DATA) {
+				break;
+			}
+			XHOST_CHECK(Status == (XStatus)XST_SUCCESS,
+				    "server: receive returned %d", (int)Status);
+			Count++;
+		}
+
+		for (Index = Count; (Index > 0U) && (Stop == 0U); Index--) {
+			Held *HeldPtr = &Batch[Index - 1U];
+
+			for (Word = 0U; Word < HeldPtr->MsgLength; Word++) {
+				HeldPtr->Msg[Word] = ~HeldPtr->Msg[Word];
+			}
+			while (XIpiPsu_QueueSend(QueuePtr, HeldPtr->Tag,
+						 HeldPtr->Msg,
+						 HeldPtr->MsgLength) ==
+			       (XStatus)XST_DEVICE_BUSY) {
+				if (Stop != 0U) {
+					break;
+				}
+				(void)sched_yield();
+			}
+			Served++;
+		}
+		(void)XIpiPsu_QueueKick(QueuePtr);
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/*
+* Runs NUM_REQUESTS requests through rings of the given depth and batch.
+*/
+static void RunSetting(const Setting *SettingPtr)
+{
+	XIpiPsu_Queue *QueuePtr = &Queue[REQUESTER];
+	XIpiPsu_QueueCfg Cfg[2];
+	pthread_t Thread;
+	u32 Msg[XIPIPSU_MAX_MSG_LEN];
+	u32 Reply[XIPIPSU_MAX_MSG_LEN];
+	u32 Length;
+	u32 Tag;
+	u32 NextTag = 0U;
+	u32 Done = 0U;
+	u32 Kicks = 0U;
+	u32 Busy = 0U;
+	u32 Word;
+	u32 Dev;
+	u64 StartNs;
+	u64 Ns;
+	XStatus Status;
+
+	(void)memset(Regs, 0, sizeof(Regs));
+	(void)memset(RingMem, 0xA5, sizeof(RingMem));
+	(void)memset(Pending, 0, sizeof(Pending));
+	Stop = 0U;
+	for (Dev = 0U; Dev < 2U; Dev++) {
+		Cfg[Dev].RemoteCpuMask = DevMask[1U - Dev];
+		Cfg[Dev].TxRing = (XIpiPsu_QueueRing *)(void *)RingMem[Dev];
+		Cfg[Dev].RxRing = (XIpiPsu_QueueRing *)(void *)RingMem[1U - Dev];
+		Cfg[Dev].Depth = SettingPtr->Depth;
+		Cfg[Dev].Batch = SettingPtr->Batch;
+		(void)XIpiPsu_QueueInit(&Queue[Dev], &Ipi[Dev], &Cfg[Dev]);
+	}
+
+	StartNs = XHostModel_TimeNs();
+	(void)pthread_create(&Thread, NULL, Server, NULL);
+	while ((Done < NUM_REQUESTS) && (Stop == 0U)) {
+		/* Up to two rings of requests in flight */
+		while ((NextTag < NUM_REQUESTS) &&
+		       ((NextTag - Done) < (2U * SettingPtr->Depth))) {
+			Length = MsgLength(NextTag);
+			for (Word = 0U; Word < Length; Word++) {
+				Msg[Word] = Expected(NextTag, Word);
+			}
+			Status = XIpiPsu_QueueSend(QueuePtr, NextTag, Msg,
+						   Length);
+			if (Status == (XStatus)XST_DEVICE_BUSY) {
+				Busy++;
+				break;
+			}
+			Pending[NextTag] = 1U;
+			NextTag++;
+		}
+		(void)XIpiPsu_QueueKick(QueuePtr);
+		Kicks++;
+
+		if (WaitDoorbell(REQUESTER, &Ipi[REQUESTER], SERVER_MASK) != 0) {
+			break;
+		}
+		while (XIpiPsu_QueueReceive(QueuePtr, &Tag, Reply, &Length) ==
+		       (XStatus)XST_SUCCESS) {
+			if ((Tag >= NextTag) || (Pending[Tag] == 0U)) {
+				XHOST_CHECK(0, "completion of tag %u, not in "
+					    "flight", (unsigned)Tag);
+				continue;
+			}
+			Pending[Tag] = 0U;
+			Done++;
+			XHOST_CHECK(Length == MsgLength(Tag),
+				    "tag %u: %u words, expected %u",
+				    (unsigned)Tag, (unsigned)Length,
+				    (unsigned)MsgLength(Tag));
+			for (Word = 0U; (Word < Length) &&
+			     (Word < XIPIPSU_MAX_MSG_LEN); Word++) {
+				XHOST_CHECK(Reply[Word] == ~Expected(Tag, Word),
+					    "tag %u word %u: %08x, expected "
+					    "%08x", (unsigned)Tag,
+					    (unsigned)Word,
+					    (unsigned)Reply[Word],
+					    (unsigned)~Expected(Tag, Word));
+			}
+		}
+	}
+	Stop = 1U;
+	(void)pthread_join(Thread, NULL);
+	Ns = XHostModel_TimeNs() - StartNs;
+
+	XHOST_CHECK(Done == NUM_REQUESTS, "depth %u batch %u: %u of %u "
+		    "requests completed", (unsigned)SettingPtr->Depth,
+		    (unsigned)SettingPtr->Batch, (unsigned)Done,
+		    (unsigned)NUM_REQUESTS);
+	for (Dev = 0U; Dev < 2U; Dev++) {
+		XHOST_CHECK((Queue[Dev].Sent == NUM_REQUESTS) &&
+			    (Queue[Dev].Received == NUM_REQUESTS),
+			    "%s: %u sent, %u received",
+			    (Dev == SERVER) ? "server" : "requester",
+			    (unsigned)Queue[Dev].Sent,
+			    (unsigned)Queue[Dev].Received);
+		XHOST_CHECK(Queue[Dev].Unsignalled == 0U,
+			    "%s: %u messages left without a doorbell",
+			    (Dev == SERVER) ? "server" : "requester",
+			    (unsigned)Queue[Dev].Unsignalled);
+	}
+	/* One doorbell per batch, kick and full ring at most */
+	XHOST_CHECK((Queue[REQUESTER].Doorbells + Queue[REQUESTER].Coalesced) <=
+		    ((NUM_REQUESTS / SettingPtr->Batch) + Kicks + Busy),
+		    "requester: %u doorbells and %u skipped for %u kicks",
+		    (unsigned)Queue[REQUESTER].Doorbells,
+		    (unsigned)Queue[REQUESTER].Coalesced, (unsigned)Kicks);
+
+	printf("depth %2u batch %2u %10.0f req/s  %5.3f doorbells/req  "
+	       "%5u skipped  %4u full\n", (unsigned)SettingPtr->Depth,
+	       (unsigned)SettingPtr->Batch,
+	       (double)NUM_REQUESTS * 1e9 / (double)Ns,
+	       (double)(Queue[REQUESTER].Doorbells +
+			Queue[SERVER].Doorbells) / (double)NUM_REQUESTS,
+	       (unsigned)(Queue[REQUESTER].Coalesced +
+			  Queue[SERVER].Coalesced), (unsigned)Busy);
+}
+
+int main(void)
+{
+	static const Setting Settings[] = {
+		{ 16U, 1U }, { 16U, 4U }, { 4U, 4U }, { 64U, 16U },
+	};
+	XIpiPsu_Config Config;
+	u32 Dev;
+	u32 Index;
+
+	(void)memset(&Config, 0, sizeof(Config));
+	for (Dev = 0U; Dev < 2U; Dev++) {
+		Config.BitMask = DevMask[Dev];
+		(void)XIpiPsu_CfgInitialize(&Ipi[Dev], &Config,
+					    (UINTPTR)Regs[Dev]);
+	}
+
+	for (Index = 0U; Index < (sizeof(Settings) / sizeof(Settings[0]));
+	     Index++) {
+		RunSetting(&Settings[Index]);
+	}
+
+	return XHostModel_Report("xipipsu_queue_model_test");
+}
@@ -44,6 +44,8 @@
  * 		     in system device-tree flow.
  * 2.14 sd 07/27/23  Update the target count.
  * 2.15 ht 01/11/24  Add PMC, PSM bitmasks macros for versal-net
+ * 2.15 kt 10/18/26  Added shared memory message queue with IPI doorbell
+ *                   batching.
  * </pre>
  *
  *****************************************************************************/
@@ -66,6 +68,13 @@ extern "C" {
 #define XIPIPSU_MAX_MSG_LEN		XIPIPSU_MSG_BUF_SIZE /**< Maximum message length */
 #define XIPIPSU_CRC_INDEX		(0x7U) /**< Index where the CRC is stored */
 #define XIPIPSU_W0_TO_W6_SIZE	(28U)	       /**< Size of the word 0 to word 6 */
+#define XIPIPSU_QUEUE_ALIGN		(64U) /**< Alignment of the queue rings */
+
+/**
+ * Bytes of shared memory used by a queue ring of the given depth
+ */
+#define XIPIPSU_QUEUE_RING_SIZE(Depth) \
+	(sizeof(XIpiPsu_QueueRing) + ((Depth) * sizeof(XIpiPsu_QueueEntry)))
 
 /* CRC Mismatch error code */
 #define XIPIPSU_CRC_ERROR		(0xFL) /**< CRC error occurred */
@@ -146,6 +155,54 @@ typedef struct {
 	u32 Options; /**< Options set in the device */
 } XIpiPsu;
 
+/**
+ * Index block of a queue ring in shared memory. Each index is on its own
+ * cache line, as it is written by a different processor.
+ */
+typedef struct {
+	volatile u32 Head; /**< Entries written, updated by the producer */
+	u32 Reserved0[15]; /**< Pad to a cache line */
+	volatile u32 Tail; /**< Entries read, updated by the consumer */
+	u32 Reserved1[15]; /**< Pad to a cache line */
+} XIpiPsu_QueueRing;
+
+/**
+ * Queue ring entry, one cache line. The entries follow the index block.
+ */
+typedef struct {
+	u32 Tag; /**< Request tag, returned with its completion */
+	u32 MsgLength; /**< Length of the message in words */
+	u32 Msg[XIPIPSU_MAX_MSG_LEN]; /**< Message */
+	u32 Reserved[14U - XIPIPSU_MAX_MSG_LEN]; /**< Pad to a cache line */
+} XIpiPsu_QueueEntry;
+
+/**
+ * Queue configuration. The two processors use the same pair of rings, each
+ * sending on the ring the other receives on.
+ */
+typedef struct {
+	u32 RemoteCpuMask; /**< Mask of the processor at the other end */
+	XIpiPsu_QueueRing *TxRing; /**< Ring this processor writes */
+	XIpiPsu_QueueRing *RxRing; /**< Ring this processor reads */
+	u32 Depth; /**< Entries per ring, power of 2 */
+	u32 Batch; /**< Entries sent before the doorbell is rung */
+} XIpiPsu_QueueCfg;
+
+/**
+ * Queue end point of a processor.
+ */
+typedef struct {
+	XIpiPsu *InstancePtr; /**< IPI instance used as the doorbell */
+	XIpiPsu_QueueCfg Cfg; /**< Queue configuration */
+	u32 TxHead; /**< Local copy of the Tx ring head */
+	u32 RxTail; /**< Local copy of the Rx ring tail */
+	u32 Unsignalled; /**< Entries sent since the last doorbell */
+	u32 Sent; /**< Entries sent */
+	u32 Received; /**< Entries received */
+	u32 Doorbells; /**< IPIs triggered */
+	u32 Coalesced; /**< Doorbells skipped as one was still pending */
+} XIpiPsu_Queue;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 /**
 *
@@ -315,6 +372,18 @@ XStatus XIpiPsu_WriteMessage(XIpiPsu *InstancePtr, u32 DestCpuMask, const u32 *M
 
 void XIpiPsu_SetConfigTable(u32 DeviceId, XIpiPsu_Config *ConfigTblPtr);
 
+/* Message queue functions implemented in xipipsu_queue.c */
+XStatus XIpiPsu_QueueInit(XIpiPsu_Queue *QueuePtr, XIpiPsu *InstancePtr,
+			  const XIpiPsu_QueueCfg *CfgPtr);
+
+XStatus XIpiPsu_QueueSend(XIpiPsu_Queue *QueuePtr, u32 Tag, const u32 *MsgPtr,
+			  u32 MsgLength);
+
+XStatus XIpiPsu_QueueKick(XIpiPsu_Queue *QueuePtr);
+
+XStatus XIpiPsu_QueueReceive(XIpiPsu_Queue *QueuePtr, u32 *TagPtr, u32 *MsgPtr,
+			     u32 *MsgLengthPtr);
+
 #ifdef __cplusplus
 }
 #endif
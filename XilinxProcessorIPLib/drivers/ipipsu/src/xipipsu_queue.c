@@ -0,0 +1,279 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file xipipsu_queue.c
+* @addtogroup ipipsu_api IPIPSU APIs
+* @{
+*
+* The xipipsu_queue.c file contains the implementation of the message queue
+* functions for XIpiPsu driver.
+*
+* A queue connects two processors through a pair of rings in shared memory
+* (DDR or OCM), one for each direction. Messages are written to the ring
+* entries rather than to the IPI buffers, and the IPI is only used as a
+* doorbell:
+*
+* - XIpiPsu_QueueSend() rings the doorbell once every Batch messages, and
+*   XIpiPsu_QueueKick() rings it for the messages sent since.
+* - A doorbell is skipped when the previous one has not been taken by the
+*   remote processor yet, as seen in the Observation register.
+* - Requests carry a tag. The remote processor sends the completion of a
+*   request back on the other ring with the same tag, in any order.
+*
+* To not lose a doorbell, the receiving processor must clear its interrupt
+* status for the remote processor before calling XIpiPsu_QueueReceive()
+* until it returns XST_NO_DATA. Both processors must call
+* XIpiPsu_QueueInit() before either sends a message.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date	Changes
+* ----- ------ -------- ----------------------------------------------
+* 2.15	kt	10/18/26	First Release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+#include "xipipsu.h"
+#include "xipipsu_hw.h"
+#include "xil_cache.h"
+
+/************************** Constant Definitions *****************************/
+
+/************************** Function Prototypes *****************************/
+static XIpiPsu_QueueEntry *XIpiPsu_QueueEntryPtr(XIpiPsu_QueueRing *RingPtr,
+		u32 Depth, u32 Index);
+
+/************************** Variable Definitions *****************************/
+
+/****************************************************************************/
+/**
+ * @brief	Gets the address of a ring entry
+ *
+ * @param	RingPtr Pointer to the ring
+ * @param	Depth Number of entries in the ring
+ * @param	Index Free running index of the entry
+ *
+ * @return	Pointer to the entry
+ */
+static XIpiPsu_QueueEntry *XIpiPsu_QueueEntryPtr(XIpiPsu_QueueRing *RingPtr,
+		u32 Depth, u32 Index)
+{
+	XIpiPsu_QueueEntry *EntryPtr = (XIpiPsu_QueueEntry *)(void *)&RingPtr[1];
+
+	return &EntryPtr[Index & (Depth - 1U)];
+}
+
+/****************************************************************************/
+/**
+ * @brief	Initializes the local end of a message queue
+ *
+ * @param	QueuePtr Pointer to the queue end point to be initialized
+ * @param	InstancePtr Pointer to the IPI instance used as the doorbell
+ * @param	CfgPtr Pointer to the queue configuration. The rings must be
+ *		XIPIPSU_QUEUE_ALIGN aligned and XIPIPSU_QUEUE_RING_SIZE(Depth)
+ *		bytes long.
+ *
+ * @return	XST_SUCCESS if successful
+ */
+XStatus XIpiPsu_QueueInit(XIpiPsu_Queue *QueuePtr, XIpiPsu *InstancePtr,
+			  const XIpiPsu_QueueCfg *CfgPtr)
+{
+	/* Validate the input arguments */
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(CfgPtr != NULL);
+	Xil_AssertNonvoid(CfgPtr->TxRing != NULL);
+	Xil_AssertNonvoid(CfgPtr->RxRing != NULL);
+	Xil_AssertNonvoid(((UINTPTR)CfgPtr->TxRing &
+			   (XIPIPSU_QUEUE_ALIGN - 1U)) == 0U);
+	Xil_AssertNonvoid(((UINTPTR)CfgPtr->RxRing &
+			   (XIPIPSU_QUEUE_ALIGN - 1U)) == 0U);
+	Xil_AssertNonvoid((CfgPtr->Depth != 0U) &&
+			  ((CfgPtr->Depth & (CfgPtr->Depth - 1U)) == 0U));
+	Xil_AssertNonvoid((CfgPtr->Batch != 0U) &&
+			  (CfgPtr->Batch <= CfgPtr->Depth));
+
+	QueuePtr->InstancePtr = InstancePtr;
+	QueuePtr->Cfg = *CfgPtr;
+	QueuePtr->TxHead = 0U;
+	QueuePtr->RxTail = 0U;
+	QueuePtr->Unsignalled = 0U;
+	QueuePtr->Sent = 0U;
+	QueuePtr->Received = 0U;
+	QueuePtr->Doorbells = 0U;
+	QueuePtr->Coalesced = 0U;
+
+	/* Reset the indices this end writes */
+	CfgPtr->TxRing->Head = 0U;
+	Xil_DCacheFlushRange((INTPTR)&CfgPtr->TxRing->Head, XIPIPSU_QUEUE_ALIGN);
+	CfgPtr->RxRing->Tail = 0U;
+	Xil_DCacheFlushRange((INTPTR)&CfgPtr->RxRing->Tail, XIPIPSU_QUEUE_ALIGN);
+
+	return (XStatus)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Sends a message on a queue. The doorbell is rung once Batch
+ *		messages have been sent since the last one.
+ *
+ * @param	QueuePtr Pointer to the queue end point
+ * @param	Tag Tag of the message, e.g. to match a completion to its request
+ * @param	MsgPtr Pointer to the message
+ * @param	MsgLength Length of the message in words
+ *
+ * @return	XST_SUCCESS if successful
+ * 			XST_DEVICE_BUSY if the ring is full
+ */
+XStatus XIpiPsu_QueueSend(XIpiPsu_Queue *QueuePtr, u32 Tag, const u32 *MsgPtr,
+			  u32 MsgLength)
+{
+	XIpiPsu_QueueRing *RingPtr;
+	XIpiPsu_QueueEntry *EntryPtr;
+	XStatus Status;
+	u32 Index;
+
+	/* Validate the input arguments */
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(MsgPtr != NULL);
+	Xil_AssertNonvoid(MsgLength <= XIPIPSU_MAX_MSG_LEN);
+
+	RingPtr = QueuePtr->Cfg.TxRing;
+
+	/* Get the entries read by the remote processor */
+	Xil_DCacheInvalidateRange((INTPTR)&RingPtr->Tail, XIPIPSU_QUEUE_ALIGN);
+	if ((QueuePtr->TxHead - RingPtr->Tail) >= QueuePtr->Cfg.Depth) {
+		/* Make sure the remote processor drains the ring */
+		(void)XIpiPsu_QueueKick(QueuePtr);
+		Status = (XStatus)XST_DEVICE_BUSY;
+		goto END;
+	}
+
+	EntryPtr = XIpiPsu_QueueEntryPtr(RingPtr, QueuePtr->Cfg.Depth,
+					 QueuePtr->TxHead);
+	EntryPtr->Tag = Tag;
+	EntryPtr->MsgLength = MsgLength;
+	for (Index = 0U; Index < MsgLength; Index++) {
+		EntryPtr->Msg[Index] = MsgPtr[Index];
+	}
+	Xil_DCacheFlushRange((INTPTR)EntryPtr, sizeof(XIpiPsu_QueueEntry));
+
+	/* Publish the entry once its contents are visible */
+	QueuePtr->TxHead++;
+	RingPtr->Head = QueuePtr->TxHead;
+	Xil_DCacheFlushRange((INTPTR)&RingPtr->Head, XIPIPSU_QUEUE_ALIGN);
+
+	QueuePtr->Sent++;
+	QueuePtr->Unsignalled++;
+	if (QueuePtr->Unsignalled >= QueuePtr->Cfg.Batch) {
+		(void)XIpiPsu_QueueKick(QueuePtr);
+	}
+	Status = (XStatus)XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Rings the doorbell for the messages sent since the last one.
+ *		The IPI is not triggered if the remote processor has not
+ *		taken the previous one yet, as it reads the ring after
+ *		taking it.
+ *
+ * @param	QueuePtr Pointer to the queue end point
+ *
+ * @return	XST_SUCCESS if successful
+ */
+XStatus XIpiPsu_QueueKick(XIpiPsu_Queue *QueuePtr)
+{
+	XStatus Status = (XStatus)XST_SUCCESS;
+
+	/* Validate the input arguments */
+	Xil_AssertNonvoid(QueuePtr != NULL);
+
+	if (QueuePtr->Unsignalled != 0U) {
+		if ((XIpiPsu_GetObsStatus(QueuePtr->InstancePtr) &
+		     QueuePtr->Cfg.RemoteCpuMask) != 0U) {
+			QueuePtr->Coalesced++;
+		} else {
+			Status = XIpiPsu_TriggerIpi(QueuePtr->InstancePtr,
+						    QueuePtr->Cfg.RemoteCpuMask);
+			QueuePtr->Doorbells++;
+		}
+		QueuePtr->Unsignalled = 0U;
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Receives a message from a queue
+ *
+ * @param	QueuePtr Pointer to the queue end point
+ * @param	TagPtr Pointer to store the tag of the message
+ * @param	MsgPtr Pointer to a buffer of XIPIPSU_MAX_MSG_LEN words to store
+ *		the message
+ * @param	MsgLengthPtr Pointer to store the length of the message in words
+ *
+ * @return	XST_SUCCESS if successful
+ * 			XST_NO_DATA if the ring is empty
+ * 			XST_FAILURE if the entry is corrupted, it is dropped
+ */
+XStatus XIpiPsu_QueueReceive(XIpiPsu_Queue *QueuePtr, u32 *TagPtr, u32 *MsgPtr,
+			     u32 *MsgLengthPtr)
+{
+	XIpiPsu_QueueRing *RingPtr;
+	XIpiPsu_QueueEntry *EntryPtr;
+	XStatus Status;
+	u32 Index;
+
+	/* Validate the input arguments */
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(TagPtr != NULL);
+	Xil_AssertNonvoid(MsgPtr != NULL);
+	Xil_AssertNonvoid(MsgLengthPtr != NULL);
+
+	RingPtr = QueuePtr->Cfg.RxRing;
+
+	/* Get the entries written by the remote processor */
+	Xil_DCacheInvalidateRange((INTPTR)&RingPtr->Head, XIPIPSU_QUEUE_ALIGN);
+	if (RingPtr->Head == QueuePtr->RxTail) {
+		Status = (XStatus)XST_NO_DATA;
+		goto END;
+	}
+
+	EntryPtr = XIpiPsu_QueueEntryPtr(RingPtr, QueuePtr->Cfg.Depth,
+					 QueuePtr->RxTail);
+	Xil_DCacheInvalidateRange((INTPTR)EntryPtr, sizeof(XIpiPsu_QueueEntry));
+	if (EntryPtr->MsgLength > XIPIPSU_MAX_MSG_LEN) {
+		Status = (XStatus)XST_FAILURE;
+	} else {
+		*TagPtr = EntryPtr->Tag;
+		*MsgLengthPtr = EntryPtr->MsgLength;
+		for (Index = 0U; Index < EntryPtr->MsgLength; Index++) {
+			MsgPtr[Index] = EntryPtr->Msg[Index];
+		}
+		QueuePtr->Received++;
+		Status = (XStatus)XST_SUCCESS;
+	}
+
+	/* Hand the entry back to the remote processor */
+	QueuePtr->RxTail++;
+	RingPtr->Tail = QueuePtr->RxTail;
+	Xil_DCacheFlushRange((INTPTR)&RingPtr->Tail, XIPIPSU_QUEUE_ALIGN);
+
+END:
+	return Status;
+}
+/** @} */
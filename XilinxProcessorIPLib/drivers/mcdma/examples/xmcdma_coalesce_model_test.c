@@ -0,0 +1,349 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xmcdma_coalesce_model_test.c
+*
+* Host test of the adaptive interrupt coalescing of the MCDMA driver and of
+* the AXI DMA driver it follows, against a register model of one channel of
+* each. It is not a target example: it is built and run with the other
+* driver model tests by make -C scripts/host_model.
+*
+* The same traffic is played on both channels, one tick at a time: the BDs
+* completed in a tick raise the completion interrupt once the threshold
+* programmed by the driver is reached, or the delay interrupt when the
+* channel saw no completion for the programmed delay. The MCDMA interrupt
+* is served by XMcdma_ChanIntrHandler(), whose done callback retrieves the
+* BDs; the AXI DMA one by the sequence of an application handler: get and
+* acknowledge the interrupt, retrieve the BDs, then
+* XAxiDma_BdRingAdaptCoalesce(). The BDs retrieved are added to the
+* statistics as the BD retrieval functions do.
+*
+* The traffic starts with one window of single BDs closed by an interrupt
+* carrying 17 BDs, which makes the two BDs per interrupt needed to leave
+* the lowest profile only when the BDs of the closing interrupt are counted
+* in its window. It then alternates sparse packets, bursts and a steady one
+* BD per tick. Both drivers must take the same coalescing profile after
+* every interrupt: the lowest one for sparse and steady traffic, since one
+* BD per interrupt does not leave it, and the highest one for bursts. Their
+* statistics must count the interrupts, BDs and changes of the model, and
+* a disabled adaptive mode must keep the setting.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 1.10  kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xmcdma.h"
+#include "xaxidma.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define MCDMA_REG_SPAN	0x1000U
+#define AXIDMA_REG_SPAN	0x100U
+#define NUM_LEVELS	7		/* Coalescing profiles of the drivers */
+#define NUM_PHASES	6U
+#define AXIDMA		0U
+#define MCDMA		1U
+
+/**************************** Type Definitions *******************************/
+
+/* Completions of one channel since its last interrupt */
+typedef struct {
+	u32 Pending;		/* BDs completed, not yet retrieved */
+	u32 IdleTicks;		/* Ticks since the last completion */
+	u32 IrqCount;
+	u32 IocCount;
+	u32 DelayCount;
+	u32 BdCount;
+	u32 Changes;
+	int Level;
+} Channel;
+
+/* A phase of the traffic: Bds BDs every Period ticks, LastBds more BDs on
+   the last tick */
+typedef struct {
+	const char *Name;
+	u32 Ticks;
+	u32 Period;
+	u32 Bds;
+	u32 LastBds;
+	int Level;		/* Profile expected at the end */
+} Phase;
+
+/************************** Function Prototypes ******************************/
+
+static void McdmaDone(void *CallBackRef);
+static void GetSetting(u32 Dma, u32 *Counter, u32 *Timer);
+static int GetLevel(u32 Dma);
+static u32 Tick(u32 Dma, u32 Bds);
+static void RunPhases(int Adaptive);
+
+/************************** Variable Definitions *****************************/
+
+static u32 McdmaRegs[MCDMA_REG_SPAN / 4U];
+static u32 AxiDmaRegs[AXIDMA_REG_SPAN / 4U];
+static XMcdma_ChanCtrl McdmaChan;
+static XAxiDma_BdRing AxiDmaRing;
+static Channel Chans[2];
+
+static const Phase Phases[NUM_PHASES] = {
+	{ "closing burst", 16U, 1U, 1U, 16U, 1 },
+	{ "sparse", 8000U, 40U, 1U, 0U, 0 },
+	{ "burst", 2000U, 1U, 8U, 0U, NUM_LEVELS - 1 },
+	{ "sparse", 16000U, 40U, 1U, 0U, 0 },
+	{ "steady", 4000U, 1U, 1U, 0U, 0 },
+	{ "burst", 2000U, 1U, 8U, 0U, NUM_LEVELS - 1 },
+};
+
+/*****************************************************************************/
+/*
+* Register model: the status registers are write one to clear.
+*/
+u32 Xil_In32(UINTPTR Addr)
+{
+	return *(volatile u32 *)Addr;
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	if ((Addr == ((UINTPTR)AxiDmaRegs + XAXIDMA_SR_OFFSET)) ||
+	    (Addr == ((UINTPTR)McdmaRegs + XMCDMA_SR_OFFSET))) {
+		*(volatile u32 *)Addr &= ~Value;
+	} else {
+		*(volatile u32 *)Addr = Value;
+	}
+}
+
+/*****************************************************************************/
+/*
+* MCDMA done callback: retrieves the BDs of the interrupt.
+*/
+static void McdmaDone(void *CallBackRef)
+{
+	XMcdma_ChanCtrl *Chan = (XMcdma_ChanCtrl *)CallBackRef;
+
+	Chan->Coalesce.Stats.BdCount += Chans[MCDMA].Pending;
+	Chans[MCDMA].Pending = 0U;
+}
+
+static void GetSetting(u32 Dma, u32 *Counter, u32 *Timer)
+{
+	XMcdma_CoalesceStats McdmaStats;
+	XAxiDma_CoalesceStats AxiDmaStats;
+
+	if (Dma == MCDMA) {
+		XMcdma_GetChanCoalesceStats(&McdmaChan, &McdmaStats);
+		*Counter = McdmaStats.Counter;
+		*Timer = McdmaStats.Timer;
+	} else {
+		XAxiDma_BdRingGetCoalesceStats(&AxiDmaRing, &AxiDmaStats);
+		*Counter = AxiDmaStats.Counter;
+		*Timer = AxiDmaStats.Timer;
+	}
+}
+
+static int GetLevel(u32 Dma)
+{
+	return (Dma == MCDMA) ? McdmaChan.Coalesce.Level :
+	       AxiDmaRing.Coalesce.Level;
+}
+
+/*****************************************************************************/
+/*
+* One tick of a channel with Bds completions.
+*
+* @return	1 if the channel raised an interrupt, 0 otherwise.
+*/
+static u32 Tick(u32 Dma, u32 Bds)
+{
+	Channel *ChanPtr = &Chans[Dma];
+	u32 Counter;
+	u32 Timer;
+	u32 Irq = 0U;
+	u32 Ioc = (Dma == MCDMA) ? XMCDMA_IRQ_IOC_MASK : XAXIDMA_IRQ_IOC_MASK;
+	u32 Delay = (Dma == MCDMA) ? XMCDMA_IRQ_DELAY_MASK :
+		    XAXIDMA_IRQ_DELAY_MASK;
+	int Level = GetLevel(Dma);
+
+	GetSetting(Dma, &Counter, &Timer);
+	ChanPtr->Pending += Bds;
+	ChanPtr->IdleTicks = (Bds != 0U) ? 0U : (ChanPtr->IdleTicks + 1U);
+	if ((ChanPtr->Pending != 0U) && (ChanPtr->Pending >= Counter)) {
+		Irq = Ioc;
+		ChanPtr->IocCount++;
+	} else if ((ChanPtr->Pending != 0U) && (Timer != 0U) &&
+		   (ChanPtr->IdleTicks >= Timer)) {
+		Irq = Delay;
+		ChanPtr->DelayCount++;
+	} else {
+		return 0U;
+	}
+	ChanPtr->IrqCount++;
+	ChanPtr->BdCount += ChanPtr->Pending;
+
+	if (Dma == MCDMA) {
+		McdmaRegs[XMCDMA_SR_OFFSET / 4U] |= Irq;
+		XMcdma_ChanIntrHandler(&McdmaChan);
+		XHOST_CHECK(McdmaRegs[XMCDMA_SR_OFFSET / 4U] == 0U,
+			    "MCDMA interrupt not acknowledged");
+	} else {
+		AxiDmaRegs[XAXIDMA_SR_OFFSET / 4U] |= Irq;
+		Irq = XAxiDma_BdRingGetIrq(&AxiDmaRing);
+		XAxiDma_BdRingAckIrq(&AxiDmaRing, Irq);
+		AxiDmaRing.Coalesce.Stats.BdCount += ChanPtr->Pending;
+		ChanPtr->Pending = 0U;
+		XAxiDma_BdRingAdaptCoalesce(&AxiDmaRing, Irq);
+	}
+	XHOST_CHECK(ChanPtr->Pending == 0U, "%s BDs not retrieved",
+		    (Dma == MCDMA) ? "MCDMA" : "AXI DMA");
+	if (GetLevel(Dma) != Level) {
+		ChanPtr->Changes++;
+	}
+
+	return 1U;
+}
+
+/*****************************************************************************/
+/*
+* Plays the phases on both channels and checks the drivers take the same
+* profiles, and the expected one at the end of each phase.
+*/
+static void RunPhases(int Adaptive)
+{
+	XMcdma_CoalesceStats McdmaStats;
+	XAxiDma_CoalesceStats AxiDmaStats;
+	u32 Counter[2];
+	u32 Timer[2];
+	u32 Index;
+	u32 TickNum;
+	u32 Bds;
+	u32 Dma;
+	u32 Irqs;
+	u32 Mismatches = 0U;
+
+	memset(Chans, 0, sizeof(Chans));
+	XHOST_CHECK((XMcdma_SetChanCoalesceDelay(&McdmaChan, 4U, 2U) ==
+		     XST_SUCCESS) &&
+		    (XAxiDma_BdRingSetCoalesce(&AxiDmaRing, 4U, 2U) ==
+		     XST_SUCCESS), "fixed setting refused");
+	XHOST_CHECK((XMcdma_SetChanAdaptiveCoalesce(&McdmaChan,
+						    Adaptive) == XST_SUCCESS) &&
+		    (XAxiDma_BdRingSetAdaptiveCoalesce(&AxiDmaRing,
+						       Adaptive) ==
+		     XST_SUCCESS), "adaptive mode %d refused", Adaptive);
+	XMcdma_ResetChanCoalesceStats(&McdmaChan);
+	XAxiDma_BdRingResetCoalesceStats(&AxiDmaRing);
+	GetSetting(MCDMA, &Counter[MCDMA], &Timer[MCDMA]);
+	GetSetting(AXIDMA, &Counter[AXIDMA], &Timer[AXIDMA]);
+	if (Adaptive != 0) {
+		XHOST_CHECK((Counter[MCDMA] == 1U) && (Timer[MCDMA] == 1U) &&
+			    (Counter[AXIDMA] == 1U) && (Timer[AXIDMA] == 0U),
+			    "lowest profiles %u/%u and %u/%u",
+			    (unsigned)Counter[MCDMA], (unsigned)Timer[MCDMA],
+			    (unsigned)Counter[AXIDMA],
+			    (unsigned)Timer[AXIDMA]);
+	}
+
+	for (Index = 0U; Index < NUM_PHASES; Index++) {
+		for (TickNum = 0U; TickNum < Phases[Index].Ticks; TickNum++) {
+			Bds = ((TickNum % Phases[Index].Period) == 0U) ?
+			      Phases[Index].Bds : 0U;
+			if (TickNum == (Phases[Index].Ticks - 1U)) {
+				Bds += Phases[Index].LastBds;
+			}
+			Irqs = Tick(MCDMA, Bds);
+			Irqs += Tick(AXIDMA, Bds);
+			if ((Irqs != 0U) &&
+			    (GetLevel(MCDMA) != GetLevel(AXIDMA))) {
+				Mismatches++;
+			}
+		}
+		if (Adaptive != 0) {
+			XHOST_CHECK((GetLevel(MCDMA) == Phases[Index].Level) &&
+				    (GetLevel(AXIDMA) == Phases[Index].Level),
+				    "%s phase %u ends in profiles %d and %d, "
+				    "expected %d", Phases[Index].Name,
+				    (unsigned)Index, GetLevel(MCDMA),
+				    GetLevel(AXIDMA), Phases[Index].Level);
+		} else {
+			XHOST_CHECK((GetLevel(MCDMA) == 0) &&
+				    (GetLevel(AXIDMA) == 0),
+				    "disabled mode changed the profile");
+		}
+	}
+	XHOST_CHECK(Mismatches == 0U,
+		    "the drivers took different profiles after %u interrupts",
+		    (unsigned)Mismatches);
+
+	XMcdma_GetChanCoalesceStats(&McdmaChan, &McdmaStats);
+	XAxiDma_BdRingGetCoalesceStats(&AxiDmaRing, &AxiDmaStats);
+	XHOST_CHECK((McdmaStats.IrqCount == Chans[MCDMA].IrqCount) &&
+		    (McdmaStats.IocIrqCount == Chans[MCDMA].IocCount) &&
+		    (McdmaStats.DelayIrqCount == Chans[MCDMA].DelayCount) &&
+		    (McdmaStats.BdCount == Chans[MCDMA].BdCount) &&
+		    (McdmaStats.Changes == Chans[MCDMA].Changes),
+		    "MCDMA statistics %u/%u/%u/%u/%u, model %u/%u/%u/%u/%u",
+		    (unsigned)McdmaStats.IrqCount,
+		    (unsigned)McdmaStats.IocIrqCount,
+		    (unsigned)McdmaStats.DelayIrqCount,
+		    (unsigned)McdmaStats.BdCount, (unsigned)McdmaStats.Changes,
+		    (unsigned)Chans[MCDMA].IrqCount,
+		    (unsigned)Chans[MCDMA].IocCount,
+		    (unsigned)Chans[MCDMA].DelayCount,
+		    (unsigned)Chans[MCDMA].BdCount,
+		    (unsigned)Chans[MCDMA].Changes);
+	XHOST_CHECK((AxiDmaStats.IrqCount == Chans[AXIDMA].IrqCount) &&
+		    (AxiDmaStats.IocIrqCount == Chans[AXIDMA].IocCount) &&
+		    (AxiDmaStats.DelayIrqCount == Chans[AXIDMA].DelayCount) &&
+		    (AxiDmaStats.BdCount == Chans[AXIDMA].BdCount) &&
+		    (AxiDmaStats.Changes == Chans[AXIDMA].Changes),
+		    "AXI DMA statistics %u/%u/%u/%u/%u, model %u/%u/%u/%u/%u",
+		    (unsigned)AxiDmaStats.IrqCount,
+		    (unsigned)AxiDmaStats.IocIrqCount,
+		    (unsigned)AxiDmaStats.DelayIrqCount,
+		    (unsigned)AxiDmaStats.BdCount,
+		    (unsigned)AxiDmaStats.Changes,
+		    (unsigned)Chans[AXIDMA].IrqCount,
+		    (unsigned)Chans[AXIDMA].IocCount,
+		    (unsigned)Chans[AXIDMA].DelayCount,
+		    (unsigned)Chans[AXIDMA].BdCount,
+		    (unsigned)Chans[AXIDMA].Changes);
+
+	for (Dma = AXIDMA; Dma <= MCDMA; Dma++) {
+		printf("%-8s %s: %6u interrupts (%u delay) for %6u BDs, "
+		       "%u changes\n", (Dma == MCDMA) ? "MCDMA" : "AXI DMA",
+		       (Adaptive != 0) ? "adaptive" : "fixed   ",
+		       (unsigned)Chans[Dma].IrqCount,
+		       (unsigned)Chans[Dma].DelayCount,
+		       (unsigned)Chans[Dma].BdCount,
+		       (unsigned)Chans[Dma].Changes);
+	}
+}
+
+int main(void)
+{
+	McdmaChan.ChanBase = (UINTPTR)McdmaRegs;
+	McdmaChan.Chan_id = 1U;
+	McdmaChan.DoneHandler = McdmaDone;
+	McdmaChan.DoneRef = &McdmaChan;
+	AxiDmaRing.ChanBase = (UINTPTR)AxiDmaRegs;
+
+	RunPhases(0);
+	RunPhases(1);
+
+	return XHostModel_Report("xmcdma_coalesce_model_test");
+}
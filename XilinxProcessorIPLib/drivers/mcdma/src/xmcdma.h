@@ -124,6 +124,8 @@
 * 			 the gcc warning in mcdma integration test suite.
 * 1.7   sa      08/12/22 Updated the examples to use latest MIG cannoical define
 * 		         i.e XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR.
+* 1.10  kt      10/18/26 Added adaptive interrupt coalescing and coalescing
+*                        statistics APIs.
 ******************************************************************************/
 #ifndef XMCDMA_H_
 #define XMCDMA_H_
@@ -151,6 +153,9 @@ extern "C" {
 #define XMCDMA_BD_MINIMUM_ALIGNMENT	0x40
 #define XMCDMA_AXCACHE			0xB
 
+/* Number of completion interrupts between two adaptive coalescing decisions */
+#define XMCDMA_COALESCE_WINDOW		16
+
 /* Direction flags */
 #define XMCDMA_DEV_TO_MEM		0
 #define XMCDMA_MEM_TO_DEV		1
@@ -188,6 +193,35 @@ typedef enum {
 	XMCDMA_WRR_PRIORITY,
 } XMcdma_QScheduler;
 
+/**
+ * Interrupt coalescing statistics of a channel, see
+ * XMcdma_GetChanCoalesceStats(). The interrupt rate is IrqCount over the
+ * time since the last XMcdma_ResetChanCoalesceStats() call, and BdCount
+ * over IrqCount gives the average number of BDs handled per interrupt.
+ */
+typedef struct {
+	u32 Counter;		/**< Current coalescing threshold */
+	u32 Timer;		/**< Current delay timer */
+	u32 IrqCount;		/**< Number of completion interrupts */
+	u32 IocIrqCount;	/**< Interrupts raised by the threshold */
+	u32 DelayIrqCount;	/**< Interrupts raised by the delay timer */
+	u32 BdCount;		/**< Number of BDs completed */
+	u32 Changes;		/**< Number of adaptive setting changes */
+} XMcdma_CoalesceStats;
+
+/**
+ * Adaptive interrupt coalescing state of a channel
+ */
+typedef struct {
+	int Enabled;		/**< Adaptive coalescing is enabled */
+	int Level;		/**< Current coalescing profile */
+	u32 WinIrqCount;	/**< Interrupts in the current window */
+	u32 WinIocCount;	/**< Threshold interrupts in the window */
+	u32 WinDelayCount;	/**< Delay interrupts in the window */
+	u32 WinBdStart;		/**< BdCount at the start of the window */
+	XMcdma_CoalesceStats Stats;	/**< Statistics */
+} XMcdma_Coalesce;
+
 typedef struct {
 	UINTPTR ChanBase;
 	u32 Chan_id;		/* Channel Number */
@@ -230,6 +264,8 @@ typedef struct {
 	                                     * interrupt callback */
 	XMcdma_ChanPktDropHandler PktdropHandler;
 	void *PktDropRef;
+
+	XMcdma_Coalesce Coalesce;	/**< Adaptive interrupt coalescing */
 } XMcdma_ChanCtrl;
 
 typedef struct {
@@ -608,6 +644,11 @@ u16 XMcdma_GetChanServiced(XMcdma *InstancePtr);
 u16 XMcdma_GetTxChanServiced(XMcdma *InstancePtr);
 u32 XMcdma_SetChanCoalesceDelay(XMcdma_ChanCtrl *Chan, u32 IrqCoalesce,
 				u32 IrqDelay);
+u32 XMcdma_SetChanAdaptiveCoalesce(XMcdma_ChanCtrl *Chan, int Enable);
+void XMcdma_ChanAdaptCoalesce(XMcdma_ChanCtrl *Chan, u32 IrqStatus);
+void XMcdma_GetChanCoalesceStats(XMcdma_ChanCtrl *Chan,
+				 XMcdma_CoalesceStats *StatsPtr);
+void XMcdma_ResetChanCoalesceStats(XMcdma_ChanCtrl *Chan);
 u32 XMCdma_SetChan_Weight(XMcdma_ChanCtrl *Chan, u8 Weight);
 u32 XMCdma_GetChan_Weight(XMcdma_ChanCtrl *Chan);
 u32 XMCdma_GetChan_PktDoneCnt(XMcdma_ChanCtrl *Chan);
@@ -23,6 +23,9 @@
 *  1.3  rsp  02/11/19 Add top level submit XMcDma_Chan_Sideband_Submit() API
 *                     to program BD control and sideband information.
 *  1.4  rsp  09/17/19 Prefer using dmb in XMcdma_UpdateChanTDesc.
+*  1.10 kt   10/18/26 Added adaptive interrupt coalescing.
+*  1.10 kt   10/18/26 Count the BDs of the closing interrupt in the adaptive
+*                    coalescing window.
 ******************************************************************************/
 
 #include "xmcdma.h"
@@ -58,6 +61,19 @@
 		(BdPtr) = (XMcdma_Bd *)(void *)Addr;                            \
 	}
 
+/*
+ * Coalescing profiles used by the adaptive mode, as {Threshold, Delay} pairs.
+ * Profile 0 gives the lowest latency, the delay timer grows with the
+ * threshold so the latency stays bounded when the traffic slows down. The
+ * channel rejects a zero delay, with a threshold of one the delay timer of
+ * profile 0 never expires before the threshold is reached.
+ */
+static const u8 XMcdma_CoalesceProfile[][2] = {
+	{1, 1}, {2, 1}, {4, 2}, {8, 4}, {16, 8}, {32, 16}, {64, 32}
+};
+
+#define XMCDMA_COALESCE_LEVELS \
+	((int)(sizeof(XMcdma_CoalesceProfile) / sizeof(XMcdma_CoalesceProfile[0])))
 
 /*****************************************************************************/
 /**
@@ -520,6 +536,7 @@ int XMcdma_BdChainFromHW(XMcdma_ChanCtrl *Chan, u32 BdLimit, XMcdma_Bd **BdSetPt
 		Chan->BdSubmitCnt -= BdCount;
 		Chan->BdCnt += BdCount;
 		Chan->BdDoneCnt += BdCount;
+		Chan->Coalesce.Stats.BdCount += BdCount;
 		XMCDMA_CHAN_SEEKAHEAD(Chan, Chan->BdHead, BdCount);
 
 		return BdCount;
@@ -757,6 +774,165 @@ u32 XMcdma_SetChanCoalesceDelay(XMcdma_ChanCtrl *Chan, u32 IrqCoalesce, u32 IrqD
 	return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+* Enable or disable adaptive interrupt coalescing for a particular channel.
+* The tuning follows XAxiDma_BdRingSetAdaptiveCoalesce() of the AXI DMA
+* driver, with a delay of at least 1 in the lowest profile.
+*
+* Enabling the mode starts from the lowest latency profile and clears the
+* statistics. Disabling it keeps the current setting.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+* @param	Enable is non-zero to enable and zero to disable adaptive
+*		coalescing.
+*
+* @return
+*		- XST_SUCCESS if the mode has been changed
+*		- XST_FAILURE if the coalescing setting could not be applied
+*
+* @note		The delay interrupt must be enabled along with the completion
+*		interrupt for the adaptive mode to lower the setting.
+*
+*****************************************************************************/
+u32 XMcdma_SetChanAdaptiveCoalesce(XMcdma_ChanCtrl *Chan, int Enable)
+{
+	XMcdma_Coalesce *CoalescePtr = &Chan->Coalesce;
+
+	if (!Enable) {
+		CoalescePtr->Enabled = 0;
+		return XST_SUCCESS;
+	}
+
+	memset(CoalescePtr, 0, sizeof(XMcdma_Coalesce));
+	CoalescePtr->Enabled = 1;
+
+	return XMcdma_SetChanCoalesceDelay(Chan, XMcdma_CoalesceProfile[0][0],
+					   XMcdma_CoalesceProfile[0][1]);
+}
+
+/*****************************************************************************/
+/**
+* Account a completion interrupt of a particular channel in the coalescing
+* statistics and, when the adaptive mode is enabled, retune the coalescing
+* setting at the end of each XMCDMA_COALESCE_WINDOW interrupts.
+*
+* The driver interrupt handlers call this function with the acknowledged
+* interrupt status after the done callback, so that the BDs retrieved by
+* XMcdma_BdChainFromHW() for this interrupt are counted in the window it
+* closes.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+* @param	IrqStatus is the pending interrupt mask of the channel.
+*
+* @return	None
+*
+*****************************************************************************/
+void XMcdma_ChanAdaptCoalesce(XMcdma_ChanCtrl *Chan, u32 IrqStatus)
+{
+	XMcdma_Coalesce *CoalescePtr = &Chan->Coalesce;
+	int Level;
+
+	if (!(IrqStatus & (XMCDMA_IRQ_IOC_MASK | XMCDMA_IRQ_DELAY_MASK))) {
+		return;
+	}
+
+	CoalescePtr->Stats.IrqCount++;
+	CoalescePtr->WinIrqCount++;
+
+	if (IrqStatus & XMCDMA_IRQ_IOC_MASK) {
+		CoalescePtr->Stats.IocIrqCount++;
+		CoalescePtr->WinIocCount++;
+	}
+
+	if (IrqStatus & XMCDMA_IRQ_DELAY_MASK) {
+		CoalescePtr->Stats.DelayIrqCount++;
+		CoalescePtr->WinDelayCount++;
+	}
+
+	if (!CoalescePtr->Enabled ||
+	    (CoalescePtr->WinIrqCount < XMCDMA_COALESCE_WINDOW)) {
+		return;
+	}
+
+	Level = CoalescePtr->Level;
+
+	if ((CoalescePtr->WinDelayCount * 2) > XMCDMA_COALESCE_WINDOW) {
+		/* Sparse traffic, favor latency */
+		if (Level > 0) {
+			Level--;
+		}
+	} else if (((CoalescePtr->WinIocCount * 4) >=
+		    (XMCDMA_COALESCE_WINDOW * 3)) &&
+		   ((Level > 0) ||
+		    ((CoalescePtr->Stats.BdCount - CoalescePtr->WinBdStart) >=
+		     (2 * XMCDMA_COALESCE_WINDOW)))) {
+		/* Bursty traffic, favor interrupt load. Profile 0 interrupts
+		 * on every BD, so leave it only when the interrupts find at
+		 * least two BDs completed on average.
+		 */
+		if (Level < (XMCDMA_COALESCE_LEVELS - 1)) {
+			Level++;
+		}
+	}
+
+	if (Level != CoalescePtr->Level) {
+		if (XMcdma_SetChanCoalesceDelay(Chan,
+						XMcdma_CoalesceProfile[Level][0],
+						XMcdma_CoalesceProfile[Level][1]) ==
+		    XST_SUCCESS) {
+			CoalescePtr->Level = Level;
+			CoalescePtr->Stats.Changes++;
+		}
+	}
+
+	CoalescePtr->WinIrqCount = 0;
+	CoalescePtr->WinIocCount = 0;
+	CoalescePtr->WinDelayCount = 0;
+	CoalescePtr->WinBdStart = CoalescePtr->Stats.BdCount;
+}
+
+/*****************************************************************************/
+/**
+* Retrieve the interrupt coalescing statistics of a particular channel, along
+* with the current threshold and delay timer.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+* @param	StatsPtr points to a memory location where the statistics
+*		will be written.
+*
+* @return	None
+*
+*****************************************************************************/
+void XMcdma_GetChanCoalesceStats(XMcdma_ChanCtrl *Chan,
+				 XMcdma_CoalesceStats *StatsPtr)
+{
+	u32 Cr;
+	u32 Offset;
+
+	Offset = (Chan->Chan_id - 1) * XMCDMA_NXTCHAN_OFFSET;
+	Cr = XMcdma_ReadReg(Chan->ChanBase, XMCDMA_CR_OFFSET + Offset);
+
+	*StatsPtr = Chan->Coalesce.Stats;
+	StatsPtr->Counter = (Cr & XMCDMA_COALESCE_MASK) >> XMCDMA_COALESCE_SHIFT;
+	StatsPtr->Timer = (Cr & XMCDMA_DELAY_MASK) >> XMCDMA_DELAY_SHIFT;
+}
+
+/*****************************************************************************/
+/**
+* Clear the interrupt coalescing statistics of a particular channel.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+*
+* @return	None
+*
+*****************************************************************************/
+void XMcdma_ResetChanCoalesceStats(XMcdma_ChanCtrl *Chan)
+{
+	memset(&Chan->Coalesce.Stats, 0, sizeof(XMcdma_CoalesceStats));
+	Chan->Coalesce.WinBdStart = 0;
+}
+
 
 /*****************************************************************************/
 /**
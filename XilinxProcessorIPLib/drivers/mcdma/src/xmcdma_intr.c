@@ -19,6 +19,8 @@
 * Ver   Who     Date     Changes
 * ----- ------  -------- ------------------------------------------------------
 * 1.0    adk    18/07/17 Initial version.
+* 1.10   kt     10/18/26 Account completion interrupts for adaptive
+*                        interrupt coalescing after the done callback.
 *
 ******************************************************************************/
 
@@ -85,6 +87,7 @@ void XMcdma_ChanIntrHandler(void *Instance)
 	if ((IrqStatus & (XMCDMA_IRQ_DELAY_MASK | XMCDMA_IRQ_IOC_MASK))) {
 		Chan->ChanState = XMCDMA_CHAN_IDLE;
 		Chan->DoneHandler(Chan->DoneRef);
+		XMcdma_ChanAdaptCoalesce(Chan, IrqStatus);
 	}
 
 	if ((IrqStatus & XMCDMA_IRQ_ERROR_MASK)) {
@@ -217,6 +220,7 @@ void XMcdma_IntrHandler(void *Instance)
 				if ((IrqStatus & (XMCDMA_IRQ_DELAY_MASK | XMCDMA_IRQ_IOC_MASK))) {
 					Chan->ChanState = XMCDMA_CHAN_IDLE;
 					InstancePtr->DoneHandler(InstancePtr->DoneRef, Chan_id);
+					XMcdma_ChanAdaptCoalesce(Chan, IrqStatus);
 				}
 
 				if ((IrqStatus & XMCDMA_IRQ_PKTDROP_MASK)) {
@@ -300,6 +304,7 @@ void XMcdma_TxIntrHandler(void *Instance)
 				if ((IrqStatus & (XMCDMA_IRQ_DELAY_MASK | XMCDMA_IRQ_IOC_MASK))) {
 					Chan->ChanState = XMCDMA_CHAN_IDLE;
 					InstancePtr->TxDoneHandler(InstancePtr->TxDoneRef, Chan_id);
+					XMcdma_ChanAdaptCoalesce(Chan, IrqStatus);
 				}
 
 				/* In Case of errors Channel Service Register
@@ -0,0 +1,399 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xospipsv_stream_model_test.c
+*
+* Host test and throughput model of the OSPIPSV streaming read. It is not a
+* target example: it is built and run with the other driver model tests by
+* make -C scripts/host_model.
+*
+* The controller is modelled by XOspiPsv_StartDmaTransfer(),
+* XOspiPsv_CheckDmaDone() and XOspiPsv_PollTransfer(), which replace the
+* driver ones. A transfer checks the read message built by the stream, takes CMD_NS plus the flash time
+* of its bytes in a virtual clock, and only fills the destination when it
+* is found done; until then the destination holds a poison pattern. Each
+* poll of the DMA costs POLL_NS, each Xil_MemCpy() of the stream COPY_MBPS,
+* and the consumer of the data CONSUME_MBPS after every read.
+*
+* Every workload is played once with plain polled reads, one transfer per
+* read, and once through a stream with a 4 page cache, and the data of
+* every read is checked against the flash:
+*
+* - sequential 300 byte reads, which must miss once and then find every
+*   page prefetched, and be faster than the plain reads,
+* - random 64 byte reads, which must not prefetch,
+* - 64 KB reads to an aligned buffer, which must go straight to it but
+*   for the first page, prefetched by the read before.
+*
+* The test also checks that the controller is busy while a prefetch is in
+* flight, that XOspiPsv_StreamInvalidate() drops the cached pages, that no
+* page past the flash is prefetched and that in DAC mode the reads go
+* through the linear window without DMA. The virtual throughput of both
+* readers and the host time per stream call are printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 1.10  kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xospipsv.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define FLASH_SIZE	(4U * 1024U * 1024U)
+#define PAGE_SIZE	4096U
+#define NUM_PAGES	4U
+#define READ_OPCODE	0x7CU		/* Octal I/O fast read, 4 byte */
+#define ADDR_BYTES	4U
+#define DUMMY_CYCLES	16U
+#define CMD_NS		500U		/* Command, address, dummy, DMA setup */
+#define FLASH_MBPS	200U		/* Octal SPI at 200 MHz, SDR */
+#define POLL_NS		50U		/* One poll of the DMA status */
+#define COPY_MBPS	1000U		/* Xil_MemCpy() from the page cache */
+#define CONSUME_MBPS	100U		/* Consumer of the data, e.g. a hash */
+#define POISON		0xEEU
+#define SEQ_READS	2000U
+#define SEQ_SIZE	300U
+#define RAND_READS	2000U
+#define RAND_SIZE	64U
+#define BIG_READS	32U
+#define BIG_SIZE	(64U * 1024U)
+
+/**************************** Type Definitions *******************************/
+
+typedef u32 (*ReadFunc)(u32 Addr, u8 *BfrPtr, u32 ByteCount);
+
+/************************** Function Prototypes ******************************/
+
+static u64 BytesNs(u32 Bytes, u32 MBps);
+static u32 PlainRead(u32 Addr, u8 *BfrPtr, u32 ByteCount);
+static u32 StreamRead(u32 Addr, u8 *BfrPtr, u32 ByteCount);
+static void Play(const char *Name, ReadFunc Read, u32 Reads, u32 Size,
+		 u32 Random, u64 *NsPtr);
+static void InitStream(void);
+
+/************************** Variable Definitions *****************************/
+
+static u8 Flash[FLASH_SIZE];
+static u8 PageMem[NUM_PAGES * PAGE_SIZE] __attribute__((aligned(64)));
+static u8 Bfr[BIG_SIZE] __attribute__((aligned(64)));
+static XOspiPsv Ospi;
+static XOspiPsv_Stream Stream;
+static XOspiPsv_Msg PlainMsg;
+
+/* Controller model */
+static u64 NowNs;
+static u64 DoneNs;
+static u8 *XferBfr;
+static u32 XferAddr;
+static u32 XferLen;
+static u32 XferCount;
+
+/*****************************************************************************/
+/*
+* Virtual time of Bytes at MBps.
+*/
+static u64 BytesNs(u32 Bytes, u32 MBps)
+{
+	return ((u64)Bytes * 1000U) / MBps;
+}
+
+/*****************************************************************************/
+/*
+* Checks a read message of the stream.
+*/
+static u32 CheckMsg(const XOspiPsv_Msg *Msg)
+{
+	XHOST_CHECK((Msg->Flags == XOSPIPSV_MSG_FLAG_RX) &&
+		    (Msg->Opcode == READ_OPCODE) &&
+		    (Msg->Addrsize == ADDR_BYTES) && (Msg->Addrvalid == 1U) &&
+		    (Msg->Dummy == DUMMY_CYCLES) &&
+		    (Msg->Proto == XOSPIPSV_READ_8_8_8) &&
+		    (Msg->IsDDROpCode == 0U) && (Msg->TxBfrPtr == NULL) &&
+		    (Msg->RxBfrPtr != NULL), "bad read message");
+	XHOST_CHECK((Msg->Addr <= FLASH_SIZE) &&
+		    (Msg->ByteCount <= (FLASH_SIZE - Msg->Addr)),
+		    "read of %u bytes at 0x%x past the flash",
+		    (unsigned)Msg->ByteCount, (unsigned)Msg->Addr);
+
+	return (Msg->ByteCount <= (FLASH_SIZE - Msg->Addr)) ?
+	       (u32)XST_SUCCESS : (u32)XST_FAILURE;
+}
+
+/*****************************************************************************/
+/*
+* Controller model: schedules the DMA transfer of a read message.
+*/
+u32 XOspiPsv_StartDmaTransfer(XOspiPsv *InstancePtr, XOspiPsv_Msg *Msg)
+{
+	if (InstancePtr->IsBusy == (u32)TRUE) {
+		return (u32)XST_DEVICE_BUSY;
+	}
+	XHOST_CHECK(InstancePtr->OpMode == XOSPIPSV_IDAC_MODE,
+		    "DMA transfer in DAC mode");
+	if (CheckMsg(Msg) != (u32)XST_SUCCESS) {
+		return (u32)XST_FAILURE;
+	}
+
+	InstancePtr->IsBusy = (u32)TRUE;
+	XferBfr = Msg->RxBfrPtr;
+	XferAddr = Msg->Addr;
+	XferLen = Msg->ByteCount;
+	XferCount++;
+	(void)memset(XferBfr, POISON, XferLen);
+	DoneNs = NowNs + CMD_NS + BytesNs(XferLen, FLASH_MBPS);
+
+	return (u32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/*
+* Controller model: the data lands when the transfer is found done.
+*/
+u32 XOspiPsv_CheckDmaDone(XOspiPsv *InstancePtr)
+{
+	if (InstancePtr->IsBusy != (u32)TRUE) {
+		return (u32)XST_FAILURE;
+	}
+	if (NowNs < DoneNs) {
+		NowNs += POLL_NS;
+		return (u32)XST_FAILURE;
+	}
+
+	(void)memcpy(XferBfr, &Flash[XferAddr], XferLen);
+	InstancePtr->IsBusy = (u32)FALSE;
+
+	return (u32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/*
+* Controller model: in DAC mode the CPU copies from the linear window.
+*/
+u32 XOspiPsv_PollTransfer(XOspiPsv *InstancePtr, XOspiPsv_Msg *Msg)
+{
+	if (InstancePtr->IsBusy == (u32)TRUE) {
+		return (u32)XST_DEVICE_BUSY;
+	}
+	XHOST_CHECK(InstancePtr->OpMode == XOSPIPSV_DAC_MODE,
+		    "linear window read in INDAC mode");
+	if (CheckMsg(Msg) != (u32)XST_SUCCESS) {
+		return (u32)XST_FAILURE;
+	}
+
+	(void)memcpy(Msg->RxBfrPtr, &Flash[Msg->Addr], Msg->ByteCount);
+	NowNs += CMD_NS + BytesNs(Msg->ByteCount, FLASH_MBPS);
+
+	return (u32)XST_SUCCESS;
+}
+
+void Xil_MemCpy(void *dst, const void *src, u32 cnt)
+{
+	(void)memcpy(dst, src, cnt);
+	NowNs += BytesNs(cnt, COPY_MBPS);
+}
+
+/*****************************************************************************/
+/*
+* A read without the stream: one polled transfer to the caller buffer.
+*/
+static u32 PlainRead(u32 Addr, u8 *BfrPtr, u32 ByteCount)
+{
+	u32 Status;
+
+	(void)memset(&PlainMsg, 0, sizeof(PlainMsg));
+	PlainMsg.RxBfrPtr = BfrPtr;
+	PlainMsg.ByteCount = ByteCount;
+	PlainMsg.Flags = XOSPIPSV_MSG_FLAG_RX;
+	PlainMsg.Opcode = READ_OPCODE;
+	PlainMsg.Addr = Addr;
+	PlainMsg.Addrsize = ADDR_BYTES;
+	PlainMsg.Addrvalid = 1U;
+	PlainMsg.Dummy = DUMMY_CYCLES;
+	PlainMsg.Proto = XOSPIPSV_READ_8_8_8;
+
+	Status = XOspiPsv_StartDmaTransfer(&Ospi, &PlainMsg);
+	if (Status == (u32)XST_SUCCESS) {
+		while (XOspiPsv_CheckDmaDone(&Ospi) != (u32)XST_SUCCESS) {
+			/* Wait for the data */
+		}
+	}
+
+	return Status;
+}
+
+static u32 StreamRead(u32 Addr, u8 *BfrPtr, u32 ByteCount)
+{
+	return XOspiPsv_StreamRead(&Stream, Addr, BfrPtr, ByteCount);
+}
+
+static void InitStream(void)
+{
+	XOspiPsv_StreamCfg Cfg;
+
+	Cfg.Opcode = READ_OPCODE;
+	Cfg.AddrSize = ADDR_BYTES;
+	Cfg.Dummy = DUMMY_CYCLES;
+	Cfg.Proto = XOSPIPSV_READ_8_8_8;
+	Cfg.IsDDROpCode = 0U;
+	Cfg.FlashSize = FLASH_SIZE;
+	Cfg.PageSize = PAGE_SIZE;
+	Cfg.NumPages = NUM_PAGES;
+	Cfg.PageMem = PageMem;
+	XHOST_CHECK(XOspiPsv_StreamInit(&Stream, &Ospi, &Cfg) ==
+		    (u32)XST_SUCCESS, "stream not initialized");
+}
+
+/*****************************************************************************/
+/*
+* Plays Reads reads of Size bytes, sequential or at random addresses, each
+* followed by the consumer, and checks their data.
+*/
+static void Play(const char *Name, ReadFunc Read, u32 Reads, u32 Size,
+		 u32 Random, u64 *NsPtr)
+{
+	u32 Seed = 12345U;
+	u32 Addr = 0U;
+	u32 Index;
+	u64 StartNs = NowNs;
+
+	for (Index = 0U; Index < Reads; Index++) {
+		if (Random != 0U) {
+			Seed = (Seed * 1103515245U) + 12345U;
+			Addr = (Seed >> 4U) % (FLASH_SIZE - Size);
+		}
+		(void)memset(Bfr, 0, Size);
+		XHOST_CHECK(Read(Addr, Bfr, Size) == (u32)XST_SUCCESS,
+			    "%s read %u failed", Name, (unsigned)Index);
+		XHOST_CHECK(memcmp(Bfr, &Flash[Addr], Size) == 0,
+			    "%s read %u of %u bytes at 0x%x has bad data", Name,
+			    (unsigned)Index, (unsigned)Size, (unsigned)Addr);
+		NowNs += BytesNs(Size, CONSUME_MBPS);
+		if (Random == 0U) {
+			Addr += Size;
+		}
+	}
+	*NsPtr = NowNs - StartNs;
+}
+
+int main(void)
+{
+	static const char *const Names[] = { "sequential", "random", "64 KB" };
+	static const u32 Sizes[] = { SEQ_SIZE, RAND_SIZE, BIG_SIZE };
+	static const u32 Reads[] = { SEQ_READS, RAND_READS, BIG_READS };
+	u64 PlainNs;
+	u64 StreamNs;
+	u64 HostNs;
+	u32 Total;
+	u32 Index;
+
+	for (Index = 0U; Index < FLASH_SIZE; Index++) {
+		Flash[Index] = (u8)((Index * 7U) + (Index >> 9) + (Index >> 17));
+	}
+	Ospi.IsReady = XIL_COMPONENT_IS_READY;
+	Ospi.OpMode = XOSPIPSV_IDAC_MODE;
+
+	printf("%-10s %6s %9s %9s %7s %7s %9s %12s\n", "reads", "bytes",
+	       "plain", "stream", "misses", "hits", "prefetch", "host ns/call");
+	for (Index = 0U; Index < 3U; Index++) {
+		Play(Names[Index], PlainRead, Reads[Index], Sizes[Index],
+		     (u32)(Index == 1U), &PlainNs);
+		InitStream();
+		HostNs = XHostModel_TimeNs();
+		Play(Names[Index], StreamRead, Reads[Index], Sizes[Index],
+		     (u32)(Index == 1U), &StreamNs);
+		HostNs = XHostModel_TimeNs() - HostNs;
+		printf("%-10s %6u %6.1f MB/s %6.1f MB/s %5u %7u %9u %12.0f\n",
+		       Names[Index], (unsigned)Sizes[Index],
+		       (double)Reads[Index] * Sizes[Index] * 1000.0 /
+		       (double)PlainNs,
+		       (double)Reads[Index] * Sizes[Index] * 1000.0 /
+		       (double)StreamNs, (unsigned)Stream.Misses,
+		       (unsigned)Stream.Hits, (unsigned)Stream.PrefetchHits,
+		       (double)HostNs / (double)Reads[Index]);
+
+		Total = Reads[Index] * Sizes[Index];
+		if (Index == 0U) {
+			XHOST_CHECK((Stream.Misses == 1U) &&
+				    (Stream.PrefetchHits ==
+				     ((Total - 1U) / PAGE_SIZE)),
+				    "sequential reads: %u misses, %u prefetch hits",
+				    (unsigned)Stream.Misses,
+				    (unsigned)Stream.PrefetchHits);
+			XHOST_CHECK(StreamNs < PlainNs,
+				    "sequential stream not faster than plain");
+		} else if (Index == 1U) {
+			XHOST_CHECK(Stream.PrefetchHits == 0U,
+				    "random reads: %u prefetch hits",
+				    (unsigned)Stream.PrefetchHits);
+		} else {
+			XHOST_CHECK((Stream.Misses == 0U) &&
+				    ((Stream.DirectBytes +
+				      (Stream.Hits * PAGE_SIZE)) == Total),
+				    "aligned reads: %u direct bytes, %u hits, "
+				    "%u misses", (unsigned)Stream.DirectBytes,
+				    (unsigned)Stream.Hits,
+				    (unsigned)Stream.Misses);
+		}
+		XOspiPsv_StreamInvalidate(&Stream);
+	}
+
+	/* The controller belongs to the stream while a prefetch is in flight */
+	InitStream();
+	XHOST_CHECK(StreamRead(0U, Bfr, 16U) == (u32)XST_SUCCESS,
+		    "first read failed");
+	XHOST_CHECK(PlainRead(0U, Bfr, 16U) == (u32)XST_DEVICE_BUSY,
+		    "plain read not refused during the prefetch");
+	XOspiPsv_StreamInvalidate(&Stream);
+	XHOST_CHECK(PlainRead(0U, Bfr, 16U) == (u32)XST_SUCCESS,
+		    "plain read refused after the invalidation");
+
+	/* Cached pages are stale until invalidated */
+	XHOST_CHECK((StreamRead(0U, Bfr, 16U) == (u32)XST_SUCCESS) &&
+		    (memcmp(Bfr, Flash, 16U) == 0), "read of page 0 failed");
+	Flash[0] ^= 0xFFU;
+	XHOST_CHECK((StreamRead(0U, Bfr, 16U) == (u32)XST_SUCCESS) &&
+		    (Bfr[0] != Flash[0]), "page 0 not read from the cache");
+	XOspiPsv_StreamInvalidate(&Stream);
+	XHOST_CHECK((StreamRead(0U, Bfr, 16U) == (u32)XST_SUCCESS) &&
+		    (Bfr[0] == Flash[0]), "page 0 cached after invalidation");
+
+	/* No prefetch past the flash */
+	XHOST_CHECK((StreamRead(FLASH_SIZE - 200U, Bfr, 100U) ==
+		     (u32)XST_SUCCESS) &&
+		    (StreamRead(FLASH_SIZE - 100U, Bfr, 100U) ==
+		     (u32)XST_SUCCESS) &&
+		    (memcmp(Bfr, &Flash[FLASH_SIZE - 100U], 100U) == 0),
+		    "read of the last page failed");
+	XHOST_CHECK(Ospi.IsBusy == (u32)FALSE,
+		    "prefetch started past the flash");
+	XOspiPsv_StreamInvalidate(&Stream);
+
+	/* DAC mode reads through the linear window, without DMA or cache */
+	Ospi.OpMode = XOSPIPSV_DAC_MODE;
+	InitStream();
+	XferCount = 0U;
+	Play("linear", StreamRead, SEQ_READS, SEQ_SIZE, 0U, &StreamNs);
+	XHOST_CHECK((XferCount == 0U) && (Stream.Misses == 0U) &&
+		    (Stream.Hits == 0U) &&
+		    (Stream.DirectBytes == (SEQ_READS * SEQ_SIZE)),
+		    "linear reads: %u transfers, %u misses, %u hits",
+		    (unsigned)XferCount, (unsigned)Stream.Misses,
+		    (unsigned)Stream.Hits);
+
+	return XHostModel_Report("xospipsv_stream_model_test");
+}
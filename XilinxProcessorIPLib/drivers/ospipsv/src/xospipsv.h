@@ -57,6 +57,8 @@
 * 1.10	akm  01/31/24 Use OSPI controller reset for resetting flash device.
 * 1.10	akm  02/06/24 Increase the delay after device reset.
 * 1.10	akm  02/01/24 Update OSPI TX tap delay element to 0x26 for DDR mode.
+* 1.10	kt   10/18/26 Added streaming read API with page cache and DMA
+*                     prefetch.
 *
 * </pre>
 *
@@ -174,6 +176,53 @@ typedef struct {
 #endif
 } XOspiPsv;
 
+#define XOSPIPSV_STREAM_MAX_PAGES	8U	/**< Pages of a stream cache */
+#define XOSPIPSV_STREAM_XFER_MAX	0x100000U /**< Bytes per direct read */
+
+/**
+ * Read command and cache geometry of a streaming read.
+ */
+typedef struct {
+	u8 Opcode;		/**< Flash read command */
+	u8 AddrSize;		/**< Address bytes sent after the command */
+	u8 Dummy;		/**< Dummy cycles for the command */
+	u8 Proto;		/**< Number of Cmd-Addr-Data lines */
+	u8 IsDDROpCode;		/**< 1 if the command is DDR, 0 otherwise */
+	u32 FlashSize;		/**< Flash size in bytes, at most 512 MB */
+	u32 PageSize;		/**< Cache page size, power of 2 */
+	u32 NumPages;		/**< Cache pages, at most XOSPIPSV_STREAM_MAX_PAGES */
+	u8 *PageMem;		/**< NumPages * PageSize bytes, cache line aligned */
+} XOspiPsv_StreamCfg;
+
+/**
+ * Cache page of a streaming read.
+ */
+typedef struct {
+	u32 Addr;		/**< Flash address of the page */
+	u8 *BfrPtr;		/**< Page data */
+	u32 Age;		/**< Last use, for replacement */
+	u8 Valid;		/**< Page holds flash data */
+	u8 Prefetched;		/**< Filled ahead of use, not read yet */
+} XOspiPsv_StreamPage;
+
+/**
+ * Streaming read state. The message is used by the DMA transfer in flight,
+ * so it is kept here.
+ */
+typedef struct {
+	XOspiPsv *InstancePtr;	/**< Controller used by the stream */
+	XOspiPsv_StreamCfg Cfg;	/**< Read command and cache geometry */
+	XOspiPsv_StreamPage Page[XOSPIPSV_STREAM_MAX_PAGES];	/**< Cache */
+	s32 Inflight;		/**< Page filled by DMA, -1 if none */
+	u32 Tick;		/**< Replacement clock */
+	u32 NextAddr;		/**< Address following the last read */
+	XOspiPsv_Msg Msg;	/**< Read message */
+	u32 Hits;		/**< Page reads served from the cache */
+	u32 Misses;		/**< Page reads that waited for the flash */
+	u32 PrefetchHits;	/**< Hits on prefetched pages */
+	u32 DirectBytes;	/**< Bytes read straight to the caller */
+} XOspiPsv_Stream;
+
 /************************** Variable Definitions *****************************/
 extern XOspiPsv_Config XOspiPsv_ConfigTable[];
 
@@ -422,6 +471,12 @@ u32 XOspiPsv_StartDmaTransfer(XOspiPsv *InstancePtr, XOspiPsv_Msg *Msg);
 u32 XOspiPsv_CheckDmaDone(XOspiPsv *InstancePtr);
 u32 XOspiPsv_SetDllDelay(XOspiPsv *InstancePtr);
 u32 XOspiPsv_ConfigDualByteOpcode(XOspiPsv *InstancePtr, u8 Enable);
+/* Streaming read functions */
+u32 XOspiPsv_StreamInit(XOspiPsv_Stream *StreamPtr, XOspiPsv *InstancePtr,
+			const XOspiPsv_StreamCfg *CfgPtr);
+u32 XOspiPsv_StreamRead(XOspiPsv_Stream *StreamPtr, u32 Addr, u8 *ReadBfrPtr,
+			u32 ByteCount);
+void XOspiPsv_StreamInvalidate(XOspiPsv_Stream *StreamPtr);
 #ifdef __cplusplus
 }
 #endif
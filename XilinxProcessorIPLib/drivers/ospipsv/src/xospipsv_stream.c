@@ -0,0 +1,481 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xospipsv_stream.c
+* @addtogroup ospipsv_api OSPIPSV APIs
+* @{
+*
+* The xospipsv_stream.c file implements the streaming read functions. In
+* INDAC mode a stream reads flash through a small cache of pages:
+*
+* - Reads that cover whole pages and start on a page boundary go straight
+*   to the caller buffer, as back to back DMA transfers.
+* - Other reads fill a cache page, replacing the least recently used one.
+* - Once a read that continues the previous one is served, the page
+*   that follows it is fetched by DMA while the caller processes the
+*   data, so sequential reads find it in the cache. Reads elsewhere do
+*   not prefetch, which would keep the controller busy for nothing.
+*
+* A stream suits sequential consumers: a read that misses costs a whole
+* page, so random reads much smaller than a page are faster as plain
+* transfers.
+*
+* In DAC mode the flash is read through the linear window, which the CPU
+* can copy from directly, so reads bypass the cache.
+*
+* The stream owns the controller while a prefetch is in flight; other
+* transfers on the same instance return XST_DEVICE_BUSY until the next
+* stream call completes it. XOspiPsv_StreamInvalidate() must be called
+* after the flash is programmed or erased.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who Date     Changes
+* ----- --- -------- -----------------------------------------------
+* 1.10  kt  10/18/26 First release
+*       kt  10/18/26 Zero the read message, no prefetch past the flash
+*       kt  10/18/26 Prefetch only after sequential reads
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xospipsv.h"
+
+/************************** Constant Definitions *****************************/
+#define XOSPIPSV_STREAM_DIRECT_ALIGN	64U	/**< Caller buffer alignment
+						  for direct reads */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static void XOspiPsv_StreamSetup(XOspiPsv_Stream *StreamPtr, u32 Addr,
+				 u8 *BfrPtr, u32 ByteCount);
+static void XOspiPsv_StreamComplete(XOspiPsv_Stream *StreamPtr, u32 Wait);
+static u32 XOspiPsv_StreamXfer(XOspiPsv_Stream *StreamPtr, u32 Addr,
+			       u8 *BfrPtr, u32 ByteCount);
+static u32 XOspiPsv_StreamLookup(const XOspiPsv_Stream *StreamPtr, u32 Addr);
+static u32 XOspiPsv_StreamVictim(const XOspiPsv_Stream *StreamPtr);
+static void XOspiPsv_StreamPrefetch(XOspiPsv_Stream *StreamPtr, u32 Addr);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* @brief
+* Builds the read message for a flash region.
+*
+* @param	StreamPtr Pointer to the stream.
+* @param	Addr Flash address of the region.
+* @param	BfrPtr Destination buffer.
+* @param	ByteCount Number of bytes to read.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XOspiPsv_StreamSetup(XOspiPsv_Stream *StreamPtr, u32 Addr,
+				 u8 *BfrPtr, u32 ByteCount)
+{
+	XOspiPsv_Msg *Msg = &StreamPtr->Msg;
+
+	(void)memset(Msg, 0, sizeof(*Msg));
+	Msg->RxBfrPtr = BfrPtr;
+	Msg->ByteCount = ByteCount;
+	Msg->Flags = XOSPIPSV_MSG_FLAG_RX;
+	Msg->Opcode = StreamPtr->Cfg.Opcode;
+	Msg->Addr = Addr;
+	Msg->Addrsize = StreamPtr->Cfg.AddrSize;
+	Msg->Addrvalid = 1U;
+	Msg->Dummy = StreamPtr->Cfg.Dummy;
+	Msg->Proto = StreamPtr->Cfg.Proto;
+	Msg->IsDDROpCode = StreamPtr->Cfg.IsDDROpCode;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Completes the prefetch in flight, if any.
+*
+* @param	StreamPtr Pointer to the stream.
+* @param	Wait Non-zero to wait for the prefetch, zero to only check it.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XOspiPsv_StreamComplete(XOspiPsv_Stream *StreamPtr, u32 Wait)
+{
+	u32 Status;
+
+	if (StreamPtr->Inflight >= 0) {
+		do {
+			Status = XOspiPsv_CheckDmaDone(StreamPtr->InstancePtr);
+		} while ((Status != (u32)XST_SUCCESS) && (Wait != 0U));
+
+		if (Status == (u32)XST_SUCCESS) {
+			StreamPtr->Page[StreamPtr->Inflight].Valid = (u8)TRUE;
+			StreamPtr->Inflight = -1;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Reads a flash region and waits for the data. Regions larger than
+* XOSPIPSV_STREAM_XFER_MAX are read as back to back transfers.
+*
+* @param	StreamPtr Pointer to the stream.
+* @param	Addr Flash address of the region.
+* @param	BfrPtr Destination buffer.
+* @param	ByteCount Number of bytes to read.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_DEVICE_BUSY if the controller is busy.
+*		- XST_FAILURE if a transfer could not be started.
+*
+******************************************************************************/
+static u32 XOspiPsv_StreamXfer(XOspiPsv_Stream *StreamPtr, u32 Addr,
+			       u8 *BfrPtr, u32 ByteCount)
+{
+	u32 Remaining = ByteCount;
+	u32 Offset = 0U;
+	u32 Len;
+	u32 Status = (u32)XST_SUCCESS;
+
+	XOspiPsv_StreamComplete(StreamPtr, (u32)TRUE);
+
+	while (Remaining != 0U) {
+		Len = (Remaining > XOSPIPSV_STREAM_XFER_MAX) ?
+		      XOSPIPSV_STREAM_XFER_MAX : Remaining;
+
+		XOspiPsv_StreamSetup(StreamPtr, Addr + Offset, &BfrPtr[Offset],
+				     Len);
+		Status = XOspiPsv_StartDmaTransfer(StreamPtr->InstancePtr,
+						   &StreamPtr->Msg);
+		if (Status != (u32)XST_SUCCESS) {
+			break;
+		}
+		while (XOspiPsv_CheckDmaDone(StreamPtr->InstancePtr) !=
+		       (u32)XST_SUCCESS) {
+			/* Wait for the data */
+		}
+
+		Remaining -= Len;
+		Offset += Len;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Looks up a page in the cache. The page being prefetched is reported as
+* present.
+*
+* @param	StreamPtr Pointer to the stream.
+* @param	Addr Page aligned flash address.
+*
+* @return	Index of the page, NumPages if it is not cached.
+*
+******************************************************************************/
+static u32 XOspiPsv_StreamLookup(const XOspiPsv_Stream *StreamPtr, u32 Addr)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < StreamPtr->Cfg.NumPages; Index++) {
+		if ((StreamPtr->Page[Index].Addr == Addr) &&
+		    ((StreamPtr->Page[Index].Valid != 0U) ||
+		     ((s32)Index == StreamPtr->Inflight))) {
+			break;
+		}
+	}
+
+	return Index;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Selects the page to be replaced: a free page, otherwise the least
+* recently used one. The page being prefetched is never selected.
+*
+* @param	StreamPtr Pointer to the stream.
+*
+* @return	Index of the page.
+*
+******************************************************************************/
+static u32 XOspiPsv_StreamVictim(const XOspiPsv_Stream *StreamPtr)
+{
+	u32 Victim = StreamPtr->Cfg.NumPages;
+	u32 Index;
+
+	for (Index = 0U; Index < StreamPtr->Cfg.NumPages; Index++) {
+		if ((s32)Index == StreamPtr->Inflight) {
+			continue;
+		}
+		if (StreamPtr->Page[Index].Valid == 0U) {
+			Victim = Index;
+			break;
+		}
+		if ((Victim == StreamPtr->Cfg.NumPages) ||
+		    (StreamPtr->Page[Index].Age < StreamPtr->Page[Victim].Age)) {
+			Victim = Index;
+		}
+	}
+
+	return Victim;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Starts fetching a page in the background, unless it is already cached,
+* a prefetch is in flight, the cache has a single page or the page ends
+* past the flash.
+*
+* @param	StreamPtr Pointer to the stream.
+* @param	Addr Page aligned flash address.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XOspiPsv_StreamPrefetch(XOspiPsv_Stream *StreamPtr, u32 Addr)
+{
+	u32 Victim;
+
+	XOspiPsv_StreamComplete(StreamPtr, (u32)FALSE);
+
+	if ((StreamPtr->Inflight >= 0) || (StreamPtr->Cfg.NumPages < 2U) ||
+	    (Addr > (StreamPtr->Cfg.FlashSize - StreamPtr->Cfg.PageSize)) ||
+	    (XOspiPsv_StreamLookup(StreamPtr, Addr) != StreamPtr->Cfg.NumPages)) {
+		return;
+	}
+
+	Victim = XOspiPsv_StreamVictim(StreamPtr);
+	StreamPtr->Page[Victim].Valid = (u8)FALSE;
+	StreamPtr->Page[Victim].Addr = Addr;
+
+	XOspiPsv_StreamSetup(StreamPtr, Addr, StreamPtr->Page[Victim].BfrPtr,
+			     StreamPtr->Cfg.PageSize);
+	if (XOspiPsv_StartDmaTransfer(StreamPtr->InstancePtr,
+				      &StreamPtr->Msg) == (u32)XST_SUCCESS) {
+		StreamPtr->Page[Victim].Prefetched = (u8)TRUE;
+		StreamPtr->Page[Victim].Age = StreamPtr->Tick;
+		StreamPtr->Inflight = (s32)Victim;
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Initializes a streaming read on an OSPIPSV instance.
+*
+* @param	StreamPtr Pointer to the stream.
+* @param	InstancePtr Pointer to the XOspiPsv instance, with the flash
+*		selected.
+* @param	CfgPtr Pointer to the read command and cache geometry.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*
+******************************************************************************/
+u32 XOspiPsv_StreamInit(XOspiPsv_Stream *StreamPtr, XOspiPsv *InstancePtr,
+			const XOspiPsv_StreamCfg *CfgPtr)
+{
+	u32 Index;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(CfgPtr != NULL);
+	Xil_AssertNonvoid(CfgPtr->PageMem != NULL);
+	Xil_AssertNonvoid((CfgPtr->NumPages > 0U) &&
+			  (CfgPtr->NumPages <= XOSPIPSV_STREAM_MAX_PAGES));
+	Xil_AssertNonvoid((CfgPtr->PageSize >= 4U) &&
+			  ((CfgPtr->PageSize & (CfgPtr->PageSize - 1U)) == 0U));
+	Xil_AssertNonvoid((CfgPtr->FlashSize >= CfgPtr->PageSize) &&
+			  (CfgPtr->FlashSize <= SIZE_512MB));
+
+	StreamPtr->InstancePtr = InstancePtr;
+	StreamPtr->Cfg = *CfgPtr;
+	StreamPtr->Inflight = -1;
+	StreamPtr->Tick = 0U;
+	StreamPtr->NextAddr = 0U;
+	StreamPtr->Hits = 0U;
+	StreamPtr->Misses = 0U;
+	StreamPtr->PrefetchHits = 0U;
+	StreamPtr->DirectBytes = 0U;
+	for (Index = 0U; Index < CfgPtr->NumPages; Index++) {
+		StreamPtr->Page[Index].Addr = 0U;
+		StreamPtr->Page[Index].BfrPtr = &CfgPtr->PageMem[Index *
+						CfgPtr->PageSize];
+		StreamPtr->Page[Index].Age = 0U;
+		StreamPtr->Page[Index].Valid = (u8)FALSE;
+		StreamPtr->Page[Index].Prefetched = (u8)FALSE;
+	}
+
+	return (u32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Reads flash through the stream. In INDAC mode, when the read continues
+* the previous one, the page that follows is prefetched once the data is
+* copied so that a sequential consumer finds it ready. In DAC mode the data
+* is copied from the linear window.
+*
+* @param	StreamPtr Pointer to the stream.
+* @param	Addr Flash address to read from.
+* @param	ReadBfrPtr Destination buffer.
+* @param	ByteCount Number of bytes to read.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_DEVICE_BUSY if another transfer is in progress.
+*		- XST_FAILURE if a transfer could not be started.
+*
+******************************************************************************/
+u32 XOspiPsv_StreamRead(XOspiPsv_Stream *StreamPtr, u32 Addr, u8 *ReadBfrPtr,
+			u32 ByteCount)
+{
+	XOspiPsv_StreamPage *PagePtr;
+	u32 Requested = ByteCount;
+	u32 Sequential;
+	u32 PageMask;
+	u32 PageAddr;
+	u32 Offset;
+	u32 Index;
+	u32 Len;
+	u32 Status = (u32)XST_SUCCESS;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(StreamPtr->InstancePtr != NULL);
+	Xil_AssertNonvoid(ReadBfrPtr != NULL);
+
+	if (StreamPtr->InstancePtr->OpMode == XOSPIPSV_DAC_MODE) {
+		XOspiPsv_StreamComplete(StreamPtr, (u32)TRUE);
+		XOspiPsv_StreamSetup(StreamPtr, Addr, ReadBfrPtr, ByteCount);
+		Status = XOspiPsv_PollTransfer(StreamPtr->InstancePtr,
+					       &StreamPtr->Msg);
+		if (Status == (u32)XST_SUCCESS) {
+			StreamPtr->DirectBytes += ByteCount;
+		}
+		goto END;
+	}
+
+	Sequential = (u32)(Addr == StreamPtr->NextAddr);
+	PageMask = StreamPtr->Cfg.PageSize - 1U;
+
+	while (ByteCount != 0U) {
+		PageAddr = Addr & ~PageMask;
+		Offset = Addr - PageAddr;
+		Index = XOspiPsv_StreamLookup(StreamPtr, PageAddr);
+
+		if ((s32)Index == StreamPtr->Inflight) {
+			XOspiPsv_StreamComplete(StreamPtr, (u32)TRUE);
+		}
+
+		if (Index == StreamPtr->Cfg.NumPages) {
+			/* Whole pages go straight to the caller buffer */
+			if ((Offset == 0U) && (ByteCount >= StreamPtr->Cfg.PageSize) &&
+			    (((UINTPTR)ReadBfrPtr &
+			      (XOSPIPSV_STREAM_DIRECT_ALIGN - 1U)) == 0U)) {
+				Len = ByteCount & ~PageMask;
+				Status = XOspiPsv_StreamXfer(StreamPtr, Addr,
+							     ReadBfrPtr, Len);
+				if (Status != (u32)XST_SUCCESS) {
+					goto END;
+				}
+				StreamPtr->DirectBytes += Len;
+				Addr += Len;
+				ReadBfrPtr = &ReadBfrPtr[Len];
+				ByteCount -= Len;
+				continue;
+			}
+
+			XOspiPsv_StreamComplete(StreamPtr, (u32)TRUE);
+			Index = XOspiPsv_StreamVictim(StreamPtr);
+			PagePtr = &StreamPtr->Page[Index];
+			PagePtr->Valid = (u8)FALSE;
+			Status = XOspiPsv_StreamXfer(StreamPtr, PageAddr,
+						     PagePtr->BfrPtr,
+						     StreamPtr->Cfg.PageSize);
+			if (Status != (u32)XST_SUCCESS) {
+				goto END;
+			}
+			PagePtr->Addr = PageAddr;
+			PagePtr->Valid = (u8)TRUE;
+			PagePtr->Prefetched = (u8)FALSE;
+			StreamPtr->Misses++;
+		} else {
+			PagePtr = &StreamPtr->Page[Index];
+			StreamPtr->Hits++;
+			if (PagePtr->Prefetched != 0U) {
+				PagePtr->Prefetched = (u8)FALSE;
+				StreamPtr->PrefetchHits++;
+			}
+		}
+
+		Len = StreamPtr->Cfg.PageSize - Offset;
+		if (Len > ByteCount) {
+			Len = ByteCount;
+		}
+		Xil_MemCpy(ReadBfrPtr, &PagePtr->BfrPtr[Offset], Len);
+
+		StreamPtr->Tick++;
+		PagePtr->Age = StreamPtr->Tick;
+		Addr += Len;
+		ReadBfrPtr = &ReadBfrPtr[Len];
+		ByteCount -= Len;
+	}
+
+	/* Fetch the page that follows the last byte of a sequential read */
+	if ((Requested != 0U) && (Sequential != 0U)) {
+		XOspiPsv_StreamPrefetch(StreamPtr, ((Addr - 1U) & ~PageMask) +
+					StreamPtr->Cfg.PageSize);
+	}
+	StreamPtr->NextAddr = Addr;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Completes the prefetch in flight and empties the cache of the stream.
+* It must be called before the controller is used for other transfers
+* that change the flash contents.
+*
+* @param	StreamPtr Pointer to the stream.
+*
+* @return	None.
+*
+******************************************************************************/
+void XOspiPsv_StreamInvalidate(XOspiPsv_Stream *StreamPtr)
+{
+	u32 Index;
+
+	Xil_AssertVoid(StreamPtr != NULL);
+
+	XOspiPsv_StreamComplete(StreamPtr, (u32)TRUE);
+
+	for (Index = 0U; Index < StreamPtr->Cfg.NumPages; Index++) {
+		StreamPtr->Page[Index].Valid = (u8)FALSE;
+		StreamPtr->Page[Index].Prefetched = (u8)FALSE;
+	}
+}
+/** @} */
@@ -0,0 +1,369 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xqspipsu_stream_model_test.c
+*
+* Host test and throughput model of the QSPIPSU streaming read. It is not a
+* target example: it is built and run with the other driver model tests by
+* make -C scripts/host_model.
+*
+* The controller is modelled by XQspiPsu_StartDmaTransfer() and
+* XQspiPsu_CheckDmaDone(), which replace the driver ones. A transfer checks
+* the read messages built by the stream, takes CMD_NS plus the flash time
+* of its bytes in a virtual clock, and only fills the destination when it
+* is found done; until then the destination holds a poison pattern. Each
+* poll of the DMA costs POLL_NS, each Xil_MemCpy() of the stream COPY_MBPS,
+* and the consumer of the data CONSUME_MBPS after every read.
+*
+* Every workload is played once with plain polled reads, one transfer per
+* read, and once through a stream with a 4 page cache, and the data of
+* every read is checked against the flash:
+*
+* - sequential 300 byte reads, which must miss once and then find every
+*   page prefetched, and be faster than the plain reads,
+* - random 64 byte reads, which must not prefetch,
+* - 64 KB reads to an aligned buffer, which must go straight to it but
+*   for the first page, prefetched by the read before.
+*
+* The test also checks that the controller is busy while a prefetch is in
+* flight, that XQspiPsu_StreamInvalidate() drops the cached pages and that
+* no page past the flash is prefetched. The virtual throughput of both
+* readers and the host time per stream call are printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 1.19  kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xqspipsu.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define FLASH_SIZE	(4U * 1024U * 1024U)
+#define PAGE_SIZE	4096U
+#define NUM_PAGES	4U
+#define READ_OPCODE	0x6CU		/* Quad output fast read, 4 byte */
+#define ADDR_BYTES	4U
+#define DUMMY_CYCLES	8U
+#define CMD_NS		1000U		/* Command, address, dummy, DMA setup */
+#define FLASH_MBPS	75U		/* Quad SPI at 150 MHz */
+#define POLL_NS		50U		/* One poll of the DMA status */
+#define COPY_MBPS	1000U		/* Xil_MemCpy() from the page cache */
+#define CONSUME_MBPS	100U		/* Consumer of the data, e.g. a hash */
+#define POISON		0xEEU
+#define SEQ_READS	2000U
+#define SEQ_SIZE	300U
+#define RAND_READS	2000U
+#define RAND_SIZE	64U
+#define BIG_READS	32U
+#define BIG_SIZE	(64U * 1024U)
+
+/**************************** Type Definitions *******************************/
+
+typedef s32 (*ReadFunc)(u32 Addr, u8 *BfrPtr, u32 ByteCount);
+
+/************************** Function Prototypes ******************************/
+
+static u64 BytesNs(u32 Bytes, u32 MBps);
+static s32 PlainRead(u32 Addr, u8 *BfrPtr, u32 ByteCount);
+static s32 StreamRead(u32 Addr, u8 *BfrPtr, u32 ByteCount);
+static void Play(const char *Name, ReadFunc Read, u32 Reads, u32 Size,
+		 u32 Random, u64 *NsPtr);
+static void InitStream(void);
+
+/************************** Variable Definitions *****************************/
+
+static u8 Flash[FLASH_SIZE];
+static u8 PageMem[NUM_PAGES * PAGE_SIZE] __attribute__((aligned(64)));
+static u8 Bfr[BIG_SIZE] __attribute__((aligned(64)));
+static XQspiPsu Qspi;
+static XQspiPsu_Stream Stream;
+static XQspiPsu_Msg PlainMsg[3];
+static u8 PlainCmd[8];
+
+/* Controller model */
+static u64 NowNs;
+static u64 DoneNs;
+static u8 *XferBfr;
+static u32 XferAddr;
+static u32 XferLen;
+
+/*****************************************************************************/
+/*
+* Virtual time of Bytes at MBps.
+*/
+static u64 BytesNs(u32 Bytes, u32 MBps)
+{
+	return ((u64)Bytes * 1000U) / MBps;
+}
+
+/*****************************************************************************/
+/*
+* Controller model: checks the read messages and schedules the transfer.
+*/
+s32 XQspiPsu_StartDmaTransfer(XQspiPsu *InstancePtr, XQspiPsu_Msg *Msg,
+			      u32 NumMsg)
+{
+	u32 Addr = 0U;
+	u32 Index;
+
+	if (InstancePtr->IsBusy == (u32)TRUE) {
+		return (s32)XST_DEVICE_BUSY;
+	}
+
+	XHOST_CHECK(NumMsg == 3U, "%u messages", (unsigned)NumMsg);
+	XHOST_CHECK((Msg[0].Flags == XQSPIPSU_MSG_FLAG_TX) &&
+		    (Msg[0].ByteCount == (ADDR_BYTES + 1U)) &&
+		    (Msg[0].TxBfrPtr[0] == READ_OPCODE),
+		    "bad command message");
+	for (Index = 1U; Index <= ADDR_BYTES; Index++) {
+		Addr = (Addr << 8U) | Msg[0].TxBfrPtr[Index];
+	}
+	XHOST_CHECK((Msg[1].ByteCount == DUMMY_CYCLES) &&
+		    (Msg[1].TxBfrPtr == NULL) && (Msg[1].RxBfrPtr == NULL) &&
+		    (Msg[1].Flags == 0U), "bad dummy message");
+	XHOST_CHECK((Msg[2].Flags == XQSPIPSU_MSG_FLAG_RX) &&
+		    (Msg[2].BusWidth == XQSPIPSU_SELECT_MODE_QUADSPI) &&
+		    (Msg[2].RxBfrPtr != NULL), "bad data message");
+	XHOST_CHECK((Addr <= FLASH_SIZE) &&
+		    (Msg[2].ByteCount <= (FLASH_SIZE - Addr)),
+		    "read of %u bytes at 0x%x past the flash",
+		    (unsigned)Msg[2].ByteCount, (unsigned)Addr);
+	if (Msg[2].ByteCount > (FLASH_SIZE - Addr)) {
+		return (s32)XST_FAILURE;
+	}
+
+	InstancePtr->IsBusy = (u32)TRUE;
+	XferBfr = Msg[2].RxBfrPtr;
+	XferAddr = Addr;
+	XferLen = Msg[2].ByteCount;
+	(void)memset(XferBfr, POISON, XferLen);
+	DoneNs = NowNs + CMD_NS + BytesNs(XferLen, FLASH_MBPS);
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/*
+* Controller model: the data lands when the transfer is found done.
+*/
+s32 XQspiPsu_CheckDmaDone(XQspiPsu *InstancePtr)
+{
+	if (InstancePtr->IsBusy != (u32)TRUE) {
+		return (s32)XST_FAILURE;
+	}
+	if (NowNs < DoneNs) {
+		NowNs += POLL_NS;
+		return (s32)XST_FAILURE;
+	}
+
+	(void)memcpy(XferBfr, &Flash[XferAddr], XferLen);
+	InstancePtr->IsBusy = (u32)FALSE;
+
+	return (s32)XST_SUCCESS;
+}
+
+void Xil_MemCpy(void *dst, const void *src, u32 cnt)
+{
+	(void)memcpy(dst, src, cnt);
+	NowNs += BytesNs(cnt, COPY_MBPS);
+}
+
+/*****************************************************************************/
+/*
+* A read without the stream: one polled transfer to the caller buffer.
+*/
+static s32 PlainRead(u32 Addr, u8 *BfrPtr, u32 ByteCount)
+{
+	u32 Index;
+	s32 Status;
+
+	(void)memset(PlainMsg, 0, sizeof(PlainMsg));
+	PlainCmd[0] = READ_OPCODE;
+	for (Index = 0U; Index < ADDR_BYTES; Index++) {
+		PlainCmd[ADDR_BYTES - Index] = (u8)(Addr >> (8U * Index));
+	}
+	PlainMsg[0].TxBfrPtr = PlainCmd;
+	PlainMsg[0].ByteCount = ADDR_BYTES + 1U;
+	PlainMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	PlainMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
+	PlainMsg[1].ByteCount = DUMMY_CYCLES;
+	PlainMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
+	PlainMsg[2].RxBfrPtr = BfrPtr;
+	PlainMsg[2].ByteCount = ByteCount;
+	PlainMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
+	PlainMsg[2].Flags = XQSPIPSU_MSG_FLAG_RX;
+
+	Status = XQspiPsu_StartDmaTransfer(&Qspi, PlainMsg, 3U);
+	if (Status == (s32)XST_SUCCESS) {
+		while (XQspiPsu_CheckDmaDone(&Qspi) != (s32)XST_SUCCESS) {
+			/* Wait for the data */
+		}
+	}
+
+	return Status;
+}
+
+static s32 StreamRead(u32 Addr, u8 *BfrPtr, u32 ByteCount)
+{
+	return XQspiPsu_StreamRead(&Stream, Addr, BfrPtr, ByteCount);
+}
+
+static void InitStream(void)
+{
+	XQspiPsu_StreamCfg Cfg;
+
+	Cfg.Opcode = READ_OPCODE;
+	Cfg.AddrBytes = ADDR_BYTES;
+	Cfg.DummyCycles = DUMMY_CYCLES;
+	Cfg.BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
+	Cfg.Flags = 0U;
+	Cfg.FlashSize = FLASH_SIZE;
+	Cfg.PageSize = PAGE_SIZE;
+	Cfg.NumPages = NUM_PAGES;
+	Cfg.PageMem = PageMem;
+	XHOST_CHECK(XQspiPsu_StreamInit(&Stream, &Qspi, &Cfg) ==
+		    (s32)XST_SUCCESS, "stream not initialized");
+}
+
+/*****************************************************************************/
+/*
+* Plays Reads reads of Size bytes, sequential or at random addresses, each
+* followed by the consumer, and checks their data.
+*/
+static void Play(const char *Name, ReadFunc Read, u32 Reads, u32 Size,
+		 u32 Random, u64 *NsPtr)
+{
+	u32 Seed = 12345U;
+	u32 Addr = 0U;
+	u32 Index;
+	u64 StartNs = NowNs;
+
+	for (Index = 0U; Index < Reads; Index++) {
+		if (Random != 0U) {
+			Seed = (Seed * 1103515245U) + 12345U;
+			Addr = (Seed >> 4U) % (FLASH_SIZE - Size);
+		}
+		(void)memset(Bfr, 0, Size);
+		XHOST_CHECK(Read(Addr, Bfr, Size) == (s32)XST_SUCCESS,
+			    "%s read %u failed", Name, (unsigned)Index);
+		XHOST_CHECK(memcmp(Bfr, &Flash[Addr], Size) == 0,
+			    "%s read %u of %u bytes at 0x%x has bad data", Name,
+			    (unsigned)Index, (unsigned)Size, (unsigned)Addr);
+		NowNs += BytesNs(Size, CONSUME_MBPS);
+		if (Random == 0U) {
+			Addr += Size;
+		}
+	}
+	*NsPtr = NowNs - StartNs;
+}
+
+int main(void)
+{
+	static const char *const Names[] = { "sequential", "random", "64 KB" };
+	static const u32 Sizes[] = { SEQ_SIZE, RAND_SIZE, BIG_SIZE };
+	static const u32 Reads[] = { SEQ_READS, RAND_READS, BIG_READS };
+	u64 PlainNs;
+	u64 StreamNs;
+	u64 HostNs;
+	u32 Total;
+	u32 Index;
+
+	for (Index = 0U; Index < FLASH_SIZE; Index++) {
+		Flash[Index] = (u8)((Index * 7U) + (Index >> 9) + (Index >> 17));
+	}
+	Qspi.IsReady = XIL_COMPONENT_IS_READY;
+	Qspi.ReadMode = XQSPIPSU_READMODE_DMA;
+
+	printf("%-10s %6s %9s %9s %7s %7s %9s %12s\n", "reads", "bytes",
+	       "plain", "stream", "misses", "hits", "prefetch", "host ns/call");
+	for (Index = 0U; Index < 3U; Index++) {
+		Play(Names[Index], PlainRead, Reads[Index], Sizes[Index],
+		     (u32)(Index == 1U), &PlainNs);
+		InitStream();
+		HostNs = XHostModel_TimeNs();
+		Play(Names[Index], StreamRead, Reads[Index], Sizes[Index],
+		     (u32)(Index == 1U), &StreamNs);
+		HostNs = XHostModel_TimeNs() - HostNs;
+		printf("%-10s %6u %6.1f MB/s %6.1f MB/s %5u %7u %9u %12.0f\n",
+		       Names[Index], (unsigned)Sizes[Index],
+		       (double)Reads[Index] * Sizes[Index] * 1000.0 /
+		       (double)PlainNs,
+		       (double)Reads[Index] * Sizes[Index] * 1000.0 /
+		       (double)StreamNs, (unsigned)Stream.Misses,
+		       (unsigned)Stream.Hits, (unsigned)Stream.PrefetchHits,
+		       (double)HostNs / (double)Reads[Index]);
+
+		Total = Reads[Index] * Sizes[Index];
+		if (Index == 0U) {
+			XHOST_CHECK((Stream.Misses == 1U) &&
+				    (Stream.PrefetchHits ==
+				     ((Total - 1U) / PAGE_SIZE)),
+				    "sequential reads: %u misses, %u prefetch hits",
+				    (unsigned)Stream.Misses,
+				    (unsigned)Stream.PrefetchHits);
+			XHOST_CHECK(StreamNs < PlainNs,
+				    "sequential stream not faster than plain");
+		} else if (Index == 1U) {
+			XHOST_CHECK(Stream.PrefetchHits == 0U,
+				    "random reads: %u prefetch hits",
+				    (unsigned)Stream.PrefetchHits);
+		} else {
+			XHOST_CHECK((Stream.Misses == 0U) &&
+				    ((Stream.DirectBytes +
+				      (Stream.Hits * PAGE_SIZE)) == Total),
+				    "aligned reads: %u direct bytes, %u hits, "
+				    "%u misses", (unsigned)Stream.DirectBytes,
+				    (unsigned)Stream.Hits,
+				    (unsigned)Stream.Misses);
+		}
+		XQspiPsu_StreamInvalidate(&Stream);
+	}
+
+	/* The controller belongs to the stream while a prefetch is in flight */
+	InitStream();
+	XHOST_CHECK(StreamRead(0U, Bfr, 16U) == (s32)XST_SUCCESS,
+		    "first read failed");
+	XHOST_CHECK(PlainRead(0U, Bfr, 16U) == (s32)XST_DEVICE_BUSY,
+		    "plain read not refused during the prefetch");
+	XQspiPsu_StreamInvalidate(&Stream);
+	XHOST_CHECK(PlainRead(0U, Bfr, 16U) == (s32)XST_SUCCESS,
+		    "plain read refused after the invalidation");
+
+	/* Cached pages are stale until invalidated */
+	XHOST_CHECK((StreamRead(0U, Bfr, 16U) == (s32)XST_SUCCESS) &&
+		    (memcmp(Bfr, Flash, 16U) == 0), "read of page 0 failed");
+	Flash[0] ^= 0xFFU;
+	XHOST_CHECK((StreamRead(0U, Bfr, 16U) == (s32)XST_SUCCESS) &&
+		    (Bfr[0] != Flash[0]), "page 0 not read from the cache");
+	XQspiPsu_StreamInvalidate(&Stream);
+	XHOST_CHECK((StreamRead(0U, Bfr, 16U) == (s32)XST_SUCCESS) &&
+		    (Bfr[0] == Flash[0]), "page 0 cached after invalidation");
+
+	/* No prefetch past the flash */
+	XHOST_CHECK((StreamRead(FLASH_SIZE - 200U, Bfr, 100U) ==
+		     (s32)XST_SUCCESS) &&
+		    (StreamRead(FLASH_SIZE - 100U, Bfr, 100U) ==
+		     (s32)XST_SUCCESS) &&
+		    (memcmp(Bfr, &Flash[FLASH_SIZE - 100U], 100U) == 0),
+		    "read of the last page failed");
+	XHOST_CHECK(Qspi.IsBusy == (u32)FALSE,
+		    "prefetch started past the flash");
+	XQspiPsu_StreamInvalidate(&Stream);
+
+	return XHostModel_Report("xqspipsu_stream_model_test");
+}
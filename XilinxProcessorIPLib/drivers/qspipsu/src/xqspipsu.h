@@ -128,6 +128,8 @@
  * 1.18 ht  07/18/23 Fixed GCC warnings.
  * 1.18 sb  08/01/23 Added support for Feed back clock
  * 1.19 sb  01/12/24 Added support for baud rate divisior
+ * 1.19 kt  10/18/26 Added streaming read API with page cache and DMA
+ *                   prefetch.
  *
  * </pre>
  *
@@ -246,6 +248,54 @@ typedef struct {
 	void *StatusRef;	/**< Callback reference for status handler */
 } XQspiPsu;
 
+#define XQSPIPSU_STREAM_MAX_PAGES	8U	/**< Pages of a stream cache */
+#define XQSPIPSU_STREAM_XFER_MAX	0x100000U /**< Bytes per direct read */
+
+/**
+ * Read command and cache geometry of a streaming read.
+ */
+typedef struct {
+	u8 Opcode;		/**< Flash read command */
+	u8 AddrBytes;		/**< Address bytes sent after the command, 3 or 4 */
+	u8 DummyCycles;		/**< Dummy clocks between address and data */
+	u32 BusWidth;		/**< Data bus width, XQSPIPSU_SELECT_MODE_* */
+	u32 Flags;		/**< Extra data message flags, e.g. stripe */
+	u32 FlashSize;		/**< Flash size in bytes, both flashes if striped */
+	u32 PageSize;		/**< Cache page size, power of 2 */
+	u32 NumPages;		/**< Cache pages, at most XQSPIPSU_STREAM_MAX_PAGES */
+	u8 *PageMem;		/**< NumPages * PageSize bytes, cache line aligned */
+} XQspiPsu_StreamCfg;
+
+/**
+ * Cache page of a streaming read.
+ */
+typedef struct {
+	u32 Addr;		/**< Flash address of the page */
+	u8 *BfrPtr;		/**< Page data */
+	u32 Age;		/**< Last use, for replacement */
+	u8 Valid;		/**< Page holds flash data */
+	u8 Prefetched;		/**< Filled ahead of use, not read yet */
+} XQspiPsu_StreamPage;
+
+/**
+ * Streaming read state. The messages and the command buffer are used by
+ * the DMA transfer in flight, so they are kept here.
+ */
+typedef struct {
+	XQspiPsu *InstancePtr;	/**< Controller used by the stream */
+	XQspiPsu_StreamCfg Cfg;	/**< Read command and cache geometry */
+	XQspiPsu_StreamPage Page[XQSPIPSU_STREAM_MAX_PAGES];	/**< Cache */
+	s32 Inflight;		/**< Page filled by DMA, -1 if none */
+	u32 Tick;		/**< Replacement clock */
+	u32 NextAddr;		/**< Address following the last read */
+	XQspiPsu_Msg Msg[3];	/**< Read messages */
+	u8 CmdBfr[8];		/**< Command and address bytes */
+	u32 Hits;		/**< Page reads served from the cache */
+	u32 Misses;		/**< Page reads that waited for the flash */
+	u32 PrefetchHits;	/**< Hits on prefetched pages */
+	u32 DirectBytes;	/**< Bytes read straight to the caller */
+} XQspiPsu_Stream;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /**
@@ -515,6 +565,13 @@ s32 XQspiPsu_StartDmaTransfer(XQspiPsu *InstancePtr, XQspiPsu_Msg *Msg,
 			      u32 NumMsg);
 s32 XQspiPsu_CheckDmaDone(XQspiPsu *InstancePtr);
 
+/* Streaming read functions */
+s32 XQspiPsu_StreamInit(XQspiPsu_Stream *StreamPtr, XQspiPsu *InstancePtr,
+			const XQspiPsu_StreamCfg *CfgPtr);
+s32 XQspiPsu_StreamRead(XQspiPsu_Stream *StreamPtr, u32 Addr, u8 *ReadBfrPtr,
+			u32 ByteCount);
+void XQspiPsu_StreamInvalidate(XQspiPsu_Stream *StreamPtr);
+
 /* Configuration functions */
 s32 XQspiPsu_SetClkPrescaler(const XQspiPsu *InstancePtr, u8 Prescaler);
 void XQspiPsu_SelectFlash(XQspiPsu *InstancePtr, u8 FlashCS, u8 FlashBus);
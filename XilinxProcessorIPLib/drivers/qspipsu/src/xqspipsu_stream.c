@@ -0,0 +1,503 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+ * @file xqspipsu_stream.c
+ * @addtogroup qspipsu_api QSPIPSU APIs
+ * @{
+ * @details
+ *
+ * The xqspipsu_stream.c contains the streaming read functions. A stream
+ * reads flash through a small cache of pages:
+ *
+ * - Reads that cover whole pages and start on a page boundary go straight
+ *   to the caller buffer, as back to back DMA transfers.
+ * - Other reads fill a cache page, replacing the least recently used one.
+ * - Once a read that continues the previous one is served, the page
+ *   that follows it is fetched by DMA while the caller processes the
+ *   data, so sequential reads find it in the cache. Reads elsewhere do
+ *   not prefetch, which would keep the controller busy for nothing.
+ *
+ * A stream suits sequential consumers: a read that misses costs a whole
+ * page, so random reads much smaller than a page are faster as plain
+ * transfers.
+ *
+ * The stream owns the controller while a prefetch is in flight; other
+ * transfers on the same instance return XST_DEVICE_BUSY until the next
+ * stream call completes it. XQspiPsu_StreamInvalidate() must be called
+ * after the flash is programmed or erased.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who Date     Changes
+ * ----- --- -------- -----------------------------------------------
+ * 1.19  kt  10/18/26 First release
+ *       kt  10/18/26 Zero the read messages, no prefetch past the flash
+ *       kt  10/18/26 Prefetch only after sequential reads
+ *
+ * </pre>
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xqspipsu.h"
+
+/************************** Constant Definitions *****************************/
+#define XQSPIPSU_STREAM_DIRECT_ALIGN	64U	/**< Caller buffer alignment
+						  for direct reads */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static s32 XQspiPsu_StreamStart(XQspiPsu_Stream *StreamPtr, u32 Addr,
+				u8 *BfrPtr, u32 ByteCount);
+static void XQspiPsu_StreamComplete(XQspiPsu_Stream *StreamPtr, u32 Wait);
+static s32 XQspiPsu_StreamXfer(XQspiPsu_Stream *StreamPtr, u32 Addr,
+			       u8 *BfrPtr, u32 ByteCount);
+static u32 XQspiPsu_StreamLookup(const XQspiPsu_Stream *StreamPtr, u32 Addr);
+static u32 XQspiPsu_StreamVictim(const XQspiPsu_Stream *StreamPtr);
+static void XQspiPsu_StreamPrefetch(XQspiPsu_Stream *StreamPtr, u32 Addr);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+ *
+ * Builds the read messages for a flash region and starts their DMA
+ * transfer.
+ *
+ * @param	StreamPtr Pointer to the stream.
+ * @param	Addr Flash address of the region.
+ * @param	BfrPtr Destination buffer.
+ * @param	ByteCount Number of bytes to read.
+ *
+ * @return
+ *		- XST_SUCCESS if the transfer is started.
+ *		- XST_DEVICE_BUSY if the controller is busy.
+ *		- XST_FAILURE if the transfer could not be started.
+ *
+ ******************************************************************************/
+static s32 XQspiPsu_StreamStart(XQspiPsu_Stream *StreamPtr, u32 Addr,
+				u8 *BfrPtr, u32 ByteCount)
+{
+	u32 CmdAddr = Addr;
+	u32 NumMsg = 0U;
+	u32 Index;
+
+	/* In parallel mode each flash holds half of the data */
+	if ((StreamPtr->Cfg.Flags & XQSPIPSU_MSG_FLAG_STRIPE) != 0U) {
+		CmdAddr >>= 1U;
+	}
+
+	StreamPtr->CmdBfr[0] = StreamPtr->Cfg.Opcode;
+	for (Index = 0U; Index < StreamPtr->Cfg.AddrBytes; Index++) {
+		StreamPtr->CmdBfr[StreamPtr->Cfg.AddrBytes - Index] =
+			(u8)(CmdAddr >> (8U * Index));
+	}
+
+	(void)memset(StreamPtr->Msg, 0, sizeof(StreamPtr->Msg));
+
+	StreamPtr->Msg[NumMsg].TxBfrPtr = StreamPtr->CmdBfr;
+	StreamPtr->Msg[NumMsg].ByteCount = (u32)StreamPtr->Cfg.AddrBytes + 1U;
+	StreamPtr->Msg[NumMsg].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	StreamPtr->Msg[NumMsg].Flags = XQSPIPSU_MSG_FLAG_TX;
+	NumMsg++;
+
+	if (StreamPtr->Cfg.DummyCycles != 0U) {
+		StreamPtr->Msg[NumMsg].ByteCount = StreamPtr->Cfg.DummyCycles;
+		StreamPtr->Msg[NumMsg].BusWidth = StreamPtr->Cfg.BusWidth;
+		NumMsg++;
+	}
+
+	StreamPtr->Msg[NumMsg].RxBfrPtr = BfrPtr;
+	StreamPtr->Msg[NumMsg].ByteCount = ByteCount;
+	StreamPtr->Msg[NumMsg].BusWidth = StreamPtr->Cfg.BusWidth;
+	StreamPtr->Msg[NumMsg].Flags = XQSPIPSU_MSG_FLAG_RX |
+				       StreamPtr->Cfg.Flags;
+	NumMsg++;
+
+	return XQspiPsu_StartDmaTransfer(StreamPtr->InstancePtr,
+					 StreamPtr->Msg, NumMsg);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Completes the prefetch in flight, if any.
+ *
+ * @param	StreamPtr Pointer to the stream.
+ * @param	Wait Non-zero to wait for the prefetch, zero to only check it.
+ *
+ * @return	None.
+ *
+ ******************************************************************************/
+static void XQspiPsu_StreamComplete(XQspiPsu_Stream *StreamPtr, u32 Wait)
+{
+	s32 Status;
+
+	if (StreamPtr->Inflight >= 0) {
+		do {
+			Status = XQspiPsu_CheckDmaDone(StreamPtr->InstancePtr);
+		} while ((Status != (s32)XST_SUCCESS) && (Wait != 0U));
+
+		if (Status == (s32)XST_SUCCESS) {
+			StreamPtr->Page[StreamPtr->Inflight].Valid = (u8)TRUE;
+			StreamPtr->Inflight = -1;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Reads a flash region and waits for the data. Regions larger than
+ * XQSPIPSU_STREAM_XFER_MAX are read as back to back transfers.
+ *
+ * @param	StreamPtr Pointer to the stream.
+ * @param	Addr Flash address of the region.
+ * @param	BfrPtr Destination buffer.
+ * @param	ByteCount Number of bytes to read.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_DEVICE_BUSY if the controller is busy.
+ *		- XST_FAILURE if a transfer could not be started.
+ *
+ ******************************************************************************/
+static s32 XQspiPsu_StreamXfer(XQspiPsu_Stream *StreamPtr, u32 Addr,
+			       u8 *BfrPtr, u32 ByteCount)
+{
+	u32 Remaining = ByteCount;
+	u32 Offset = 0U;
+	u32 Len;
+	s32 Status = (s32)XST_SUCCESS;
+
+	XQspiPsu_StreamComplete(StreamPtr, (u32)TRUE);
+
+	while (Remaining != 0U) {
+		Len = (Remaining > XQSPIPSU_STREAM_XFER_MAX) ?
+		      XQSPIPSU_STREAM_XFER_MAX : Remaining;
+
+		Status = XQspiPsu_StreamStart(StreamPtr, Addr + Offset,
+					      &BfrPtr[Offset], Len);
+		if (Status != (s32)XST_SUCCESS) {
+			break;
+		}
+		while (XQspiPsu_CheckDmaDone(StreamPtr->InstancePtr) !=
+		       (s32)XST_SUCCESS) {
+			/* Wait for the data */
+		}
+
+		Remaining -= Len;
+		Offset += Len;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Looks up a page in the cache. The page being prefetched is reported as
+ * present.
+ *
+ * @param	StreamPtr Pointer to the stream.
+ * @param	Addr Page aligned flash address.
+ *
+ * @return	Index of the page, NumPages if it is not cached.
+ *
+ ******************************************************************************/
+static u32 XQspiPsu_StreamLookup(const XQspiPsu_Stream *StreamPtr, u32 Addr)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < StreamPtr->Cfg.NumPages; Index++) {
+		if ((StreamPtr->Page[Index].Addr == Addr) &&
+		    ((StreamPtr->Page[Index].Valid != 0U) ||
+		     ((s32)Index == StreamPtr->Inflight))) {
+			break;
+		}
+	}
+
+	return Index;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Selects the page to be replaced: a free page, otherwise the least
+ * recently used one. The page being prefetched is never selected.
+ *
+ * @param	StreamPtr Pointer to the stream.
+ *
+ * @return	Index of the page.
+ *
+ ******************************************************************************/
+static u32 XQspiPsu_StreamVictim(const XQspiPsu_Stream *StreamPtr)
+{
+	u32 Victim = StreamPtr->Cfg.NumPages;
+	u32 Index;
+
+	for (Index = 0U; Index < StreamPtr->Cfg.NumPages; Index++) {
+		if ((s32)Index == StreamPtr->Inflight) {
+			continue;
+		}
+		if (StreamPtr->Page[Index].Valid == 0U) {
+			Victim = Index;
+			break;
+		}
+		if ((Victim == StreamPtr->Cfg.NumPages) ||
+		    (StreamPtr->Page[Index].Age < StreamPtr->Page[Victim].Age)) {
+			Victim = Index;
+		}
+	}
+
+	return Victim;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Starts fetching a page in the background, unless it is already cached,
+ * a prefetch is in flight, the cache has a single page or the page ends
+ * past the flash.
+ *
+ * @param	StreamPtr Pointer to the stream.
+ * @param	Addr Page aligned flash address.
+ *
+ * @return	None.
+ *
+ ******************************************************************************/
+static void XQspiPsu_StreamPrefetch(XQspiPsu_Stream *StreamPtr, u32 Addr)
+{
+	u32 Victim;
+
+	XQspiPsu_StreamComplete(StreamPtr, (u32)FALSE);
+
+	if ((StreamPtr->Inflight >= 0) || (StreamPtr->Cfg.NumPages < 2U) ||
+	    (Addr > (StreamPtr->Cfg.FlashSize - StreamPtr->Cfg.PageSize)) ||
+	    (XQspiPsu_StreamLookup(StreamPtr, Addr) != StreamPtr->Cfg.NumPages)) {
+		return;
+	}
+
+	Victim = XQspiPsu_StreamVictim(StreamPtr);
+	StreamPtr->Page[Victim].Valid = (u8)FALSE;
+	StreamPtr->Page[Victim].Addr = Addr;
+
+	if (XQspiPsu_StreamStart(StreamPtr, Addr, StreamPtr->Page[Victim].BfrPtr,
+				 StreamPtr->Cfg.PageSize) == (s32)XST_SUCCESS) {
+		StreamPtr->Page[Victim].Prefetched = (u8)TRUE;
+		StreamPtr->Page[Victim].Age = StreamPtr->Tick;
+		StreamPtr->Inflight = (s32)Victim;
+	}
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Initializes a streaming read on a QSPIPSU instance.
+ *
+ * @param	StreamPtr Pointer to the stream.
+ * @param	InstancePtr Pointer to the XQspiPsu instance, in DMA read mode,
+ *		with the flash selected.
+ * @param	CfgPtr Pointer to the read command and cache geometry.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if the instance is not in DMA read mode.
+ *
+ ******************************************************************************/
+s32 XQspiPsu_StreamInit(XQspiPsu_Stream *StreamPtr, XQspiPsu *InstancePtr,
+			const XQspiPsu_StreamCfg *CfgPtr)
+{
+	u32 Index;
+	s32 Status;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(CfgPtr != NULL);
+	Xil_AssertNonvoid(CfgPtr->PageMem != NULL);
+	Xil_AssertNonvoid((CfgPtr->AddrBytes == 3U) || (CfgPtr->AddrBytes == 4U));
+	Xil_AssertNonvoid((CfgPtr->NumPages > 0U) &&
+			  (CfgPtr->NumPages <= XQSPIPSU_STREAM_MAX_PAGES));
+	Xil_AssertNonvoid((CfgPtr->PageSize >= 4U) &&
+			  ((CfgPtr->PageSize & (CfgPtr->PageSize - 1U)) == 0U));
+	Xil_AssertNonvoid(CfgPtr->FlashSize >= CfgPtr->PageSize);
+
+	if (InstancePtr->ReadMode != XQSPIPSU_READMODE_DMA) {
+		Status = (s32)XST_FAILURE;
+		goto END;
+	}
+
+	StreamPtr->InstancePtr = InstancePtr;
+	StreamPtr->Cfg = *CfgPtr;
+	StreamPtr->Inflight = -1;
+	StreamPtr->Tick = 0U;
+	StreamPtr->NextAddr = 0U;
+	StreamPtr->Hits = 0U;
+	StreamPtr->Misses = 0U;
+	StreamPtr->PrefetchHits = 0U;
+	StreamPtr->DirectBytes = 0U;
+	for (Index = 0U; Index < CfgPtr->NumPages; Index++) {
+		StreamPtr->Page[Index].Addr = 0U;
+		StreamPtr->Page[Index].BfrPtr = &CfgPtr->PageMem[Index *
+						CfgPtr->PageSize];
+		StreamPtr->Page[Index].Age = 0U;
+		StreamPtr->Page[Index].Valid = (u8)FALSE;
+		StreamPtr->Page[Index].Prefetched = (u8)FALSE;
+	}
+
+	Status = (s32)XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Reads flash through the stream. When the read continues the previous
+ * one, the page that follows is prefetched once the data is copied so that
+ * a sequential consumer finds it ready.
+ *
+ * @param	StreamPtr Pointer to the stream.
+ * @param	Addr Flash address to read from.
+ * @param	ReadBfrPtr Destination buffer.
+ * @param	ByteCount Number of bytes to read.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_DEVICE_BUSY if another transfer is in progress.
+ *		- XST_FAILURE if a transfer could not be started.
+ *
+ ******************************************************************************/
+s32 XQspiPsu_StreamRead(XQspiPsu_Stream *StreamPtr, u32 Addr, u8 *ReadBfrPtr,
+			u32 ByteCount)
+{
+	XQspiPsu_StreamPage *PagePtr;
+	u32 Requested = ByteCount;
+	u32 Sequential;
+	u32 PageMask;
+	u32 PageAddr;
+	u32 Offset;
+	u32 Index;
+	u32 Len;
+	s32 Status = (s32)XST_SUCCESS;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(StreamPtr->InstancePtr != NULL);
+	Xil_AssertNonvoid(ReadBfrPtr != NULL);
+
+	Sequential = (u32)(Addr == StreamPtr->NextAddr);
+	PageMask = StreamPtr->Cfg.PageSize - 1U;
+
+	while (ByteCount != 0U) {
+		PageAddr = Addr & ~PageMask;
+		Offset = Addr - PageAddr;
+		Index = XQspiPsu_StreamLookup(StreamPtr, PageAddr);
+
+		if ((s32)Index == StreamPtr->Inflight) {
+			XQspiPsu_StreamComplete(StreamPtr, (u32)TRUE);
+		}
+
+		if (Index == StreamPtr->Cfg.NumPages) {
+			/* Whole pages go straight to the caller buffer */
+			if ((Offset == 0U) && (ByteCount >= StreamPtr->Cfg.PageSize) &&
+			    (((UINTPTR)ReadBfrPtr &
+			      (XQSPIPSU_STREAM_DIRECT_ALIGN - 1U)) == 0U)) {
+				Len = ByteCount & ~PageMask;
+				Status = XQspiPsu_StreamXfer(StreamPtr, Addr,
+							     ReadBfrPtr, Len);
+				if (Status != (s32)XST_SUCCESS) {
+					goto END;
+				}
+				StreamPtr->DirectBytes += Len;
+				Addr += Len;
+				ReadBfrPtr = &ReadBfrPtr[Len];
+				ByteCount -= Len;
+				continue;
+			}
+
+			XQspiPsu_StreamComplete(StreamPtr, (u32)TRUE);
+			Index = XQspiPsu_StreamVictim(StreamPtr);
+			PagePtr = &StreamPtr->Page[Index];
+			PagePtr->Valid = (u8)FALSE;
+			Status = XQspiPsu_StreamXfer(StreamPtr, PageAddr,
+						     PagePtr->BfrPtr,
+						     StreamPtr->Cfg.PageSize);
+			if (Status != (s32)XST_SUCCESS) {
+				goto END;
+			}
+			PagePtr->Addr = PageAddr;
+			PagePtr->Valid = (u8)TRUE;
+			PagePtr->Prefetched = (u8)FALSE;
+			StreamPtr->Misses++;
+		} else {
+			PagePtr = &StreamPtr->Page[Index];
+			StreamPtr->Hits++;
+			if (PagePtr->Prefetched != 0U) {
+				PagePtr->Prefetched = (u8)FALSE;
+				StreamPtr->PrefetchHits++;
+			}
+		}
+
+		Len = StreamPtr->Cfg.PageSize - Offset;
+		if (Len > ByteCount) {
+			Len = ByteCount;
+		}
+		Xil_MemCpy(ReadBfrPtr, &PagePtr->BfrPtr[Offset], Len);
+
+		StreamPtr->Tick++;
+		PagePtr->Age = StreamPtr->Tick;
+		Addr += Len;
+		ReadBfrPtr = &ReadBfrPtr[Len];
+		ByteCount -= Len;
+	}
+
+	/* Fetch the page that follows the last byte of a sequential read */
+	if ((Requested != 0U) && (Sequential != 0U)) {
+		XQspiPsu_StreamPrefetch(StreamPtr,
+					((Addr - 1U) & ~PageMask) +
+					StreamPtr->Cfg.PageSize);
+	}
+	StreamPtr->NextAddr = Addr;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Completes the prefetch in flight and empties the cache of the stream.
+ * It must be called before the controller is used for other transfers
+ * that change the flash contents.
+ *
+ * @param	StreamPtr Pointer to the stream.
+ *
+ * @return	None.
+ *
+ ******************************************************************************/
+void XQspiPsu_StreamInvalidate(XQspiPsu_Stream *StreamPtr)
+{
+	u32 Index;
+
+	Xil_AssertVoid(StreamPtr != NULL);
+
+	XQspiPsu_StreamComplete(StreamPtr, (u32)TRUE);
+
+	for (Index = 0U; Index < StreamPtr->Cfg.NumPages; Index++) {
+		StreamPtr->Page[Index].Valid = (u8)FALSE;
+		StreamPtr->Page[Index].Prefetched = (u8)FALSE;
+	}
+}
+/** @} */
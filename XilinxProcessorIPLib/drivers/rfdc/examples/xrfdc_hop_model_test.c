@@ -0,0 +1,484 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xrfdc_hop_model_test.c
+*
+* Host test and benchmark of XRFdc_PrepareHop() and XRFdc_ApplyHop() against
+* a libmetal register model of the converters. It is not a target example:
+* it is built and run with the other driver model tests by
+* make -C scripts/host_model.
+*
+* Two instances of the same converters are retuned through the same sequence
+* of NCO hops, one with XRFdc_SetMixerSettings() and XRFdc_UpdateEvent() per
+* block and one with a table of hops prepared ahead of time. The channels
+* span ADC and DAC tiles, on the tile, slice and SYSREF update events, and the
+* frequencies span several Nyquist zones. After every hop the NCO frequency
+* and phase registers and the mixer settings of both instances must be the
+* same, and in the applied hop all the update triggers must follow the last
+* NCO word, with one trigger per tile on the tile event.
+*
+* The time, register reads and register writes of a hop are printed for both
+* ways, with the register model answering at once and with a bus latency per
+* access, as the AXI-Lite accesses of the converters have on the target.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 12.2  kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xrfdc.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define NUM_CHANNELS	16U		/* Channels retuned by a hop */
+#define NUM_HOPS	5U		/* Hops of the table */
+#define ACCESS_NS	100U		/* Bus latency of a register access */
+#define NUM_RUNS	20000U		/* Hops timed without latency */
+#define NUM_SLOW_RUNS	200U		/* Hops timed with latency */
+#define NUM_BENCHES	2U
+#define NUM_PREPARES	2000U		/* Hop preparations timed */
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define CORE(io)	((io) == &Io[0] ? 0U : 1U)
+
+/************************** Function Prototypes ******************************/
+
+static void CoreInit(u32 Core);
+static u32 LegacyHop(XRFdc *InstancePtr, u32 Hop);
+static void TableHop(u32 Hop);
+static u32 IsNcoWord(u32 Addr);
+static u32 IsTileTrigger(u32 Addr);
+static void CompareCores(u32 Hop);
+static void CheckTriggers(const XRFdc_Hop *HopPtr);
+
+/************************** Variable Definitions *****************************/
+
+static u8 Regs[2][XRFDC_REGION_SIZE];
+static struct metal_io_region Io[2];
+static XRFdc RFdc[2];
+static XRFdc_Hop_Channel Channels[NUM_CHANNELS];
+static XRFdc_Hop Hops[NUM_HOPS];
+static u32 AccessNs;
+static u32 Reads;
+static u32 Writes;
+static u32 Logging;
+static u32 NumLogged;
+static u32 Logged[XRFDC_HOP_MAX_WRITES];
+
+/* Configuration table of the SDT initialization, the instances are set up
+ * by XRFdc_CfgInitialize() */
+XRFdc_Config XRFdc_ConfigTable[] = { { NULL } };
+
+/* First NCO frequency of each hop in MHz, in several Nyquist zones */
+static const double HopFreq[NUM_HOPS] = { 100.0, -300.0, 1200.0, 2900.0,
+					  -5000.0 };
+
+/*****************************************************************************/
+/*
+* Register model: plain memory for each instance, with a bus latency per
+* access and the writes to the second instance logged while a hop is
+* applied.
+*/
+uint64_t metal_io_read(struct metal_io_region *io, unsigned long offset,
+		       int width)
+{
+	uint64_t Value = 0U;
+	u64 StartNs = XHostModel_TimeNs();
+
+	while ((XHostModel_TimeNs() - StartNs) < AccessNs) {
+	}
+	Reads++;
+	memcpy(&Value, &Regs[CORE(io)][offset], (size_t)width);
+	return Value;
+}
+
+void metal_io_write(struct metal_io_region *io, unsigned long offset,
+		    uint64_t value, int width)
+{
+	u64 StartNs = XHostModel_TimeNs();
+
+	while ((XHostModel_TimeNs() - StartNs) < AccessNs) {
+	}
+	Writes++;
+	memcpy(&Regs[CORE(io)][offset], &value, (size_t)width);
+	if (Logging && (CORE(io) == 1U) && (NumLogged < XRFDC_HOP_MAX_WRITES)) {
+		Logged[NumLogged++] = (u32)offset;
+	}
+}
+
+/*****************************************************************************/
+/*
+* Gen 3 converters with all the paths enabled, ADC tiles at 2 GSPS and DAC
+* tiles at 6 GSPS, and the channel blocks on the fine mixer. One channel is
+* on the SYSREF event, every fifth on the slice event, the others on the
+* tile event. An ADC and a DAC channel are in the second Nyquist zone.
+*/
+static void CoreInit(u32 Core)
+{
+	XRFdc_Config Cfg;
+	XRFdc_Mixer_Settings Mixer;
+	XRFdc *InstancePtr = &RFdc[Core];
+	u32 Tile;
+	u32 Block;
+	u32 Channel;
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	Cfg.Name = "rfdc";
+	Cfg.IPType = XRFDC_GEN3;
+	for (Tile = 0U; Tile < XRFDC_NUM_OF_TILES4; Tile++) {
+		Cfg.ADCTile_Config[Tile].Enable = 1U;
+		Cfg.ADCTile_Config[Tile].SamplingRate = 2.0;
+		Cfg.ADCTile_Config[Tile].NumSlices = 4U;
+		Cfg.DACTile_Config[Tile].Enable = 1U;
+		Cfg.DACTile_Config[Tile].SamplingRate = 6.0;
+		for (Block = 0U; Block < XRFDC_NUM_OF_BLKS4; Block++) {
+			Cfg.ADCTile_Config[Tile].ADCBlock_Digital_Config[Block]
+				.MixerType = XRFDC_MIXER_TYPE_FINE;
+			Cfg.DACTile_Config[Tile].DACBlock_Digital_Config[Block]
+				.MixerType = XRFDC_MIXER_TYPE_FINE;
+		}
+	}
+
+	memset(Regs[Core], 0, sizeof(Regs[Core]));
+	memset(InstancePtr, 0, sizeof(*InstancePtr));
+	metal_io_init(&Io[Core], Regs[Core], &Cfg.BaseAddr, XRFDC_REGION_SIZE,
+		      (unsigned)(-1), 0U, NULL);
+	InstancePtr->io = &Io[Core];
+	XRFdc_WriteReg(InstancePtr, XRFDC_IP_BASE,
+		       XRFDC_ADC_PATHS_ENABLED_OFFSET, 0xFFFFFFFFU);
+	XRFdc_WriteReg(InstancePtr, XRFDC_IP_BASE,
+		       XRFDC_DAC_PATHS_ENABLED_OFFSET, 0xFFFFFFFFU);
+	XHOST_CHECK(XRFdc_CfgInitialize(InstancePtr, &Cfg) == XRFDC_SUCCESS,
+		    "core %u: initialization", (unsigned)Core);
+
+	for (Channel = 0U; Channel < NUM_CHANNELS; Channel++) {
+		memset(&Mixer, 0, sizeof(Mixer));
+		Mixer.Freq = 100.0;
+		Mixer.MixerMode = XRFDC_MIXER_MODE_C2C;
+		Mixer.MixerType = XRFDC_MIXER_TYPE_FINE;
+		Mixer.CoarseMixFreq = XRFDC_COARSE_MIX_OFF;
+		Mixer.FineMixerScale = XRFDC_MIXER_SCALE_AUTO;
+		Mixer.EventSource = ((Channel % 5U) == 4U) ?
+				    XRFDC_EVNT_SRC_SLICE : XRFDC_EVNT_SRC_TILE;
+		if (Channel == 3U) {
+			Mixer.EventSource = XRFDC_EVNT_SRC_SYSREF;
+		}
+		XHOST_CHECK(XRFdc_SetMixerSettings(InstancePtr,
+						   Channels[Channel].Type,
+						   Channels[Channel].Tile_Id,
+						   Channels[Channel].Block_Id,
+						   &Mixer) == XRFDC_SUCCESS,
+			    "core %u channel %u: mixer", (unsigned)Core,
+			    (unsigned)Channel);
+	}
+
+	/* Frequencies out of the first zone are negated in an even zone */
+	XHOST_CHECK((XRFdc_SetNyquistZone(InstancePtr, XRFDC_ADC_TILE, 1U, 0U,
+					  XRFDC_EVEN_NYQUIST_ZONE) ==
+		     XRFDC_SUCCESS) &&
+		    (XRFdc_SetNyquistZone(InstancePtr, XRFDC_DAC_TILE, 2U, 2U,
+					  XRFDC_EVEN_NYQUIST_ZONE) ==
+		     XRFDC_SUCCESS), "core %u: Nyquist zone", (unsigned)Core);
+}
+
+/*****************************************************************************/
+/*
+* A hop as done without the hop table: each block is read back, retuned and
+* triggered on its own.
+*/
+static u32 LegacyHop(XRFdc *InstancePtr, u32 Hop)
+{
+	XRFdc_Mixer_Settings Mixer;
+	u32 Status = XRFDC_SUCCESS;
+	u32 Channel;
+	XRFdc_Hop_Channel *ChPtr;
+
+	for (Channel = 0U; Channel < NUM_CHANNELS; Channel++) {
+		ChPtr = &Channels[Channel];
+		Status |= XRFdc_GetMixerSettings(InstancePtr, ChPtr->Type,
+						 ChPtr->Tile_Id,
+						 ChPtr->Block_Id, &Mixer);
+		Mixer.Freq = HopFreq[Hop] + (37.5 * Channel);
+		Mixer.PhaseOffset = (10.0 * Channel) - 80.0;
+		Status |= XRFdc_SetMixerSettings(InstancePtr, ChPtr->Type,
+						 ChPtr->Tile_Id,
+						 ChPtr->Block_Id, &Mixer);
+		if (Mixer.EventSource != XRFDC_EVNT_SRC_SYSREF) {
+			Status |= XRFdc_UpdateEvent(InstancePtr, ChPtr->Type,
+						    ChPtr->Tile_Id,
+						    ChPtr->Block_Id,
+						    XRFDC_EVENT_MIXER);
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/*
+* The channels of a hop, as given to XRFdc_PrepareHop().
+*/
+static void TableHop(u32 Hop)
+{
+	u32 Channel;
+
+	for (Channel = 0U; Channel < NUM_CHANNELS; Channel++) {
+		Channels[Channel].Freq = HopFreq[Hop] + (37.5 * Channel);
+		Channels[Channel].PhaseOffset = (10.0 * Channel) - 80.0;
+	}
+}
+
+static u32 IsNcoWord(u32 Addr)
+{
+	static const u32 Offsets[] = { XRFDC_ADC_NCO_FQWD_LOW_OFFSET,
+				       XRFDC_ADC_NCO_FQWD_MID_OFFSET,
+				       XRFDC_ADC_NCO_FQWD_UPP_OFFSET,
+				       XRFDC_NCO_PHASE_LOW_OFFSET,
+				       XRFDC_NCO_PHASE_UPP_OFFSET };
+	u32 Channel;
+	u32 Index;
+
+	for (Channel = 0U; Channel < NUM_CHANNELS; Channel++) {
+		for (Index = 0U; Index < sizeof(Offsets) / sizeof(Offsets[0]);
+		     Index++) {
+			if (Addr == (XRFDC_BLOCK_BASE(Channels[Channel].Type,
+						      Channels[Channel].Tile_Id,
+						      Channels[Channel].Block_Id) +
+				     Offsets[Index])) {
+				return 1U;
+			}
+		}
+	}
+
+	return 0U;
+}
+
+static u32 IsTileTrigger(u32 Addr)
+{
+	u32 Tile;
+
+	for (Tile = 0U; Tile < XRFDC_NUM_OF_TILES4; Tile++) {
+		if ((Addr == (XRFDC_ADC_TILE_DRP_ADDR(Tile) + XRFDC_HSCOM_ADDR +
+			      XRFDC_HSCOM_UPDT_DYN_OFFSET)) ||
+		    (Addr == (XRFDC_DAC_TILE_DRP_ADDR(Tile) + XRFDC_HSCOM_ADDR +
+			      XRFDC_HSCOM_UPDT_DYN_OFFSET))) {
+			return 1U;
+		}
+	}
+
+	return 0U;
+}
+
+static void CompareCores(u32 Hop)
+{
+	static const u32 Offsets[] = { XRFDC_ADC_NCO_FQWD_LOW_OFFSET,
+				       XRFDC_ADC_NCO_FQWD_MID_OFFSET,
+				       XRFDC_ADC_NCO_FQWD_UPP_OFFSET,
+				       XRFDC_NCO_PHASE_LOW_OFFSET,
+				       XRFDC_NCO_PHASE_UPP_OFFSET };
+	XRFdc_Mixer_Settings Mixer[2];
+	XRFdc_Hop_Channel *ChPtr;
+	u32 Channel;
+	u32 Index;
+	u32 Addr;
+	u16 Value[2];
+
+	for (Channel = 0U; Channel < NUM_CHANNELS; Channel++) {
+		ChPtr = &Channels[Channel];
+		for (Index = 0U; Index < sizeof(Offsets) / sizeof(Offsets[0]);
+		     Index++) {
+			Addr = XRFDC_BLOCK_BASE(ChPtr->Type, ChPtr->Tile_Id,
+						ChPtr->Block_Id) + Offsets[Index];
+			memcpy(&Value[0], &Regs[0][Addr], sizeof(u16));
+			memcpy(&Value[1], &Regs[1][Addr], sizeof(u16));
+			XHOST_CHECK(Value[0] == Value[1], "hop %u channel %u: "
+				    "register 0x%05x is 0x%04x, 0x%04x without "
+				    "hop table", (unsigned)Hop,
+				    (unsigned)Channel, (unsigned)Addr,
+				    (unsigned)Value[1], (unsigned)Value[0]);
+		}
+		(void)XRFdc_GetMixerSettings(&RFdc[0], ChPtr->Type,
+					     ChPtr->Tile_Id, ChPtr->Block_Id,
+					     &Mixer[0]);
+		(void)XRFdc_GetMixerSettings(&RFdc[1], ChPtr->Type,
+					     ChPtr->Tile_Id, ChPtr->Block_Id,
+					     &Mixer[1]);
+		XHOST_CHECK((Mixer[0].Freq == Mixer[1].Freq) &&
+			    (Mixer[0].PhaseOffset == Mixer[1].PhaseOffset),
+			    "hop %u channel %u: mixer %.3f MHz %.1f deg, %.3f MHz"
+			    " %.1f deg without hop table", (unsigned)Hop,
+			    (unsigned)Channel, Mixer[1].Freq,
+			    Mixer[1].PhaseOffset, Mixer[0].Freq,
+			    Mixer[0].PhaseOffset);
+	}
+}
+
+/*****************************************************************************/
+/*
+* All the update triggers follow the last NCO word, and each tile with a
+* channel on the tile event is triggered once.
+*/
+static void CheckTriggers(const XRFdc_Hop *HopPtr)
+{
+	u32 TileMask[2] = { 0U, 0U };
+	u32 NumTiles = 0U;
+	u32 NumTriggers = 0U;
+	u32 LastNco = 0U;
+	u32 FirstTrigger = NumLogged;
+	u32 Channel;
+	u32 Index;
+
+	for (Channel = 0U; Channel < NUM_CHANNELS; Channel++) {
+		if (XRFdc_RDReg(&RFdc[1], XRFDC_BLOCK_BASE(Channels[Channel].Type,
+							   Channels[Channel].Tile_Id,
+							   Channels[Channel].Block_Id),
+				XRFDC_NCO_UPDT_OFFSET, XRFDC_NCO_UPDT_MODE_MASK) ==
+		    XRFDC_EVNT_SRC_TILE) {
+			TileMask[Channels[Channel].Type] |=
+				1U << Channels[Channel].Tile_Id;
+		}
+	}
+	NumTiles = (u32)__builtin_popcount(TileMask[0]) +
+		   (u32)__builtin_popcount(TileMask[1]);
+
+	XHOST_CHECK(NumLogged == HopPtr->NumWrites, "%u writes, %u in the hop",
+		    (unsigned)NumLogged, (unsigned)HopPtr->NumWrites);
+	for (Index = 0U; Index < NumLogged; Index++) {
+		if (IsNcoWord(Logged[Index])) {
+			LastNco = Index;
+		} else if (FirstTrigger == NumLogged) {
+			FirstTrigger = Index;
+		}
+		if (IsTileTrigger(Logged[Index])) {
+			NumTriggers++;
+		}
+	}
+	XHOST_CHECK(LastNco < FirstTrigger, "trigger at write %u before the "
+		    "NCO word at write %u", (unsigned)FirstTrigger,
+		    (unsigned)LastNco);
+	XHOST_CHECK(NumTriggers == NumTiles, "%u tile triggers for %u tiles",
+		    (unsigned)NumTriggers, (unsigned)NumTiles);
+}
+
+int main(void)
+{
+	static const u32 Bench[NUM_BENCHES][2] = {
+		{ 0U, NUM_RUNS }, { ACCESS_NS, NUM_SLOW_RUNS }
+	};
+	u64 StartNs;
+	u64 Time[2];
+	u32 Count[2][2];
+	u32 Runs;
+	u32 Run;
+	u32 Index;
+	u32 Hop;
+	u32 Channel;
+
+	for (Channel = 0U; Channel < NUM_CHANNELS; Channel++) {
+		Channels[Channel].Type = (Channel < 8U) ? XRFDC_ADC_TILE :
+							  XRFDC_DAC_TILE;
+		Channels[Channel].Tile_Id = (Channel % 8U) / 2U;
+		Channels[Channel].Block_Id = (Channel % 2U) * 2U;
+	}
+	CoreInit(0U);
+	CoreInit(1U);
+
+	for (Hop = 0U; Hop < NUM_HOPS; Hop++) {
+		TableHop(Hop);
+		XHOST_CHECK(XRFdc_PrepareHop(&RFdc[1], Channels, NUM_CHANNELS,
+					     &Hops[Hop]) == XRFDC_SUCCESS,
+			    "hop %u: prepare", (unsigned)Hop);
+	}
+	for (Hop = 0U; Hop < NUM_HOPS; Hop++) {
+		XHOST_CHECK(LegacyHop(&RFdc[0], Hop) == XRFDC_SUCCESS,
+			    "hop %u: mixer settings", (unsigned)Hop);
+		NumLogged = 0U;
+		Logging = 1U;
+		(void)XRFdc_ApplyHop(&RFdc[1], &Hops[Hop]);
+		Logging = 0U;
+		TableHop(Hop);
+		CompareCores(Hop);
+		CheckTriggers(&Hops[Hop]);
+	}
+
+	/* Too many channels and a block without fine mixer are refused */
+	metal_set_log_level(METAL_LOG_EMERGENCY);
+	XHOST_CHECK(XRFdc_PrepareHop(&RFdc[1], Channels,
+				     XRFDC_HOP_MAX_CHANNELS + 1U,
+				     &Hops[0]) == XRFDC_FAILURE,
+		    "%u channels", (unsigned)(XRFDC_HOP_MAX_CHANNELS + 1U));
+	RFdc[1].ADC_Tile[0].ADCBlock_Digital_Datapath[0].Mixer_Settings
+		.MixerType = XRFDC_MIXER_TYPE_COARSE;
+	XHOST_CHECK((XRFdc_PrepareHop(&RFdc[1], Channels, NUM_CHANNELS,
+				      &Hops[0]) == XRFDC_FAILURE) &&
+		    (Hops[0].NumWrites == 0U), "coarse mixer");
+	metal_set_log_level(METAL_LOG_ERROR);
+	RFdc[1].ADC_Tile[0].ADCBlock_Digital_Datapath[0].Mixer_Settings
+		.MixerType = XRFDC_MIXER_TYPE_FINE;
+	TableHop(0U);
+	(void)XRFdc_PrepareHop(&RFdc[1], Channels, NUM_CHANNELS, &Hops[0]);
+	XHOST_CHECK(XHostModel_AssertCount == 0U, "%u assertions",
+		    (unsigned)XHostModel_AssertCount);
+
+	/* Benchmark, without and with bus latency */
+	for (Index = 0U; Index < NUM_BENCHES; Index++) {
+		AccessNs = Bench[Index][0];
+		Runs = Bench[Index][1];
+		Reads = 0U;
+		Writes = 0U;
+		StartNs = XHostModel_TimeNs();
+		for (Run = 0U; Run < Runs; Run++) {
+			(void)LegacyHop(&RFdc[0], Run % NUM_HOPS);
+		}
+		Time[0] = XHostModel_TimeNs() - StartNs;
+		Count[0][0] = Reads / Runs;
+		Count[0][1] = Writes / Runs;
+		Reads = 0U;
+		Writes = 0U;
+		StartNs = XHostModel_TimeNs();
+		for (Run = 0U; Run < Runs; Run++) {
+			(void)XRFdc_ApplyHop(&RFdc[1], &Hops[Run % NUM_HOPS]);
+		}
+		Time[1] = XHostModel_TimeNs() - StartNs;
+		Count[1][0] = Reads / Runs;
+		Count[1][1] = Writes / Runs;
+		printf("%3u ns per access: mixer settings %.2f us (%u reads %u "
+		       "writes), hop table %.2f us (%u reads %u writes)\n",
+		       (unsigned)AccessNs, (double)Time[0] / Runs / 1000.0,
+		       (unsigned)Count[0][0], (unsigned)Count[0][1],
+		       (double)Time[1] / Runs / 1000.0, (unsigned)Count[1][0],
+		       (unsigned)Count[1][1]);
+		XHOST_CHECK((Count[1][0] == 0U) &&
+			    (Count[1][1] < Count[0][1]),
+			    "hop table: %u reads %u writes",
+			    (unsigned)Count[1][0], (unsigned)Count[1][1]);
+	}
+
+	AccessNs = 0U;
+	Reads = 0U;
+	StartNs = XHostModel_TimeNs();
+	for (Run = 0U; Run < NUM_PREPARES; Run++) {
+		(void)XRFdc_PrepareHop(&RFdc[1], Channels, NUM_CHANNELS,
+				       &Hops[0]);
+	}
+	printf("prepare: %.2f us (%u reads)\n",
+	       (double)(XHostModel_TimeNs() - StartNs) / NUM_PREPARES / 1000.0,
+	       (unsigned)(Reads / NUM_PREPARES));
+
+	return XHostModel_Report("xrfdc_hop_model_test");
+}
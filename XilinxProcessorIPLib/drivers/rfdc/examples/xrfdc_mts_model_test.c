@@ -0,0 +1,625 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xrfdc_mts_model_test.c
+*
+* Host test of the multi-tile sync DTC scans of XRFdc_MultiConverter_Sync()
+* and XRFdc_MultiConverter_Sync_Fast() against a libmetal register model of
+* the converters. It is not a target example: it is built and run with the
+* other driver model tests by make -C scripts/host_model.
+*
+* The register model latches the early/late sysref flags of a tile when its
+* capture is cleared, from a scripted flag pattern indexed by the DTC code
+* then programmed, separately for the PLL and T1 captures. The patterns put
+* sysref edges of several widths on the 4 ADC tiles, at the ends of the code
+* range, with a narrow edge that the coarse scan steps over, and with a tile
+* that has no clear window. Each pattern is synced with the full per-tile
+* scan and with the group scan:
+* - The group scan must pick the codes and window statistics of the full
+*   scan, and report the same status, when the edges are wider than the
+*   coarse step.
+* - A picked code next to a missed narrow edge must fail the check, and the
+*   tile is scanned in full to pick the code of the full scan.
+* - With narrow edges only, the picked codes must keep half the minimum
+*   window clear of any edge.
+* - Verifying the codes of the full scan must keep them, with cleared window
+*   statistics, and a tile whose edge drifted onto its code must be rescanned
+*   to the code of the full scan reloaded with the same codes.
+*
+* The sysref waits of each sync are printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 12.2  kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xrfdc.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define NUM_TILES	4U
+#define NUM_CODES	128U
+#define T1		0U		/* Flag pattern of the T1 capture */
+#define PLL		1U		/* Flag pattern of the PLL capture */
+#define TILES		0xFU		/* Tiles of the sync group */
+#define REF_TILE	0U
+#define T1_ONLY_TILE	1U		/* Tile on the T1 clock, no PLL scan */
+#define MARGIN		2		/* Half the minimum window of Gen 3 */
+#define COARSE_STEP	4U		/* Code step of the coarse scan */
+#define MAX_VERIFY_WAITS	20U	/* Sysref waits of a verify */
+
+/* The DTC registers and flags of the model */
+#define SRCAP_T1	(0x24U << 2U)
+#define SRCAP_PLL	(0x0CU << 2U)
+#define SRDTC_T1	(0x27U << 2U)
+#define SRDTC_PLL	(0x26U << 2U)
+#define SRFLAG		(0x49U << 2U)
+#define SRFLAG_T1_S	4U
+#define SRFLAG_PLL_S	2U
+#define SRCOUNT_CTRL	0x004CU
+#define SRCOUNT_VAL	0x0050U
+#define SRFREQ_VAL	0x0054U
+#define ADC_MARKER_CNT	0x0010U
+#define DLY_ALIGNER0	0x28U
+#define AMARK_DONE	0x100000U
+
+/**************************** Type Definitions *******************************/
+
+/* Periodic sysref edges of each tile, per capture */
+typedef struct {
+	const char *Name;
+	u8 Period[2][NUM_TILES];
+	u8 Width[2][NUM_TILES];
+	u8 Offset[2][NUM_TILES];
+} Pattern;
+
+typedef struct {
+	u32 Status;
+	u32 Waits;
+	XRFdc_MTS_DTC_Settings Set[2];
+} SyncResult;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define HSCOM(Tile)	(XRFDC_ADC_TILE_DRP_ADDR(Tile) + XRFDC_HSCOM_ADDR)
+
+/************************** Function Prototypes ******************************/
+
+static void ModelInit(void);
+static void SetPattern(const Pattern *PatternPtr);
+static void AddEdge(u32 Cap, u32 Tile, u32 Start, u32 Width);
+static void Sync(u32 Fast, int Mode, const int *PLL_CodesPtr,
+		 const int *T1_CodesPtr, SyncResult *ResultPtr);
+static u32 SameCodes(const SyncResult *APtr, const SyncResult *BPtr);
+static u32 SameStats(const SyncResult *APtr, const SyncResult *BPtr);
+static u32 IsSafe(const SyncResult *ResultPtr, u32 Cap, u32 Tile);
+static void CheckSafe(const char *Name, const SyncResult *ResultPtr);
+static void PrintCodes(const char *Name, const SyncResult *ResultPtr);
+static void CheckPattern(const Pattern *PatternPtr);
+static void CheckNarrowFallback(void);
+static void CheckNoWindow(void);
+static void CheckVerify(const Pattern *PatternPtr);
+
+/************************** Variable Definitions *****************************/
+
+static u8 Regs[XRFDC_REGION_SIZE];
+static struct metal_io_region Io;
+static XRFdc RFdc;
+static XRFdc_MultiConverter_Sync_Config SyncConfig;
+static u8 Flags[2][NUM_TILES][NUM_CODES];
+static u32 Waits;
+
+/* Configuration table of the SDT initialization, the instance is set up
+ * by XRFdc_CfgInitialize() */
+XRFdc_Config XRFdc_ConfigTable[] = { { NULL } };
+
+static const Pattern Patterns[] = {
+	{ "edges of 4 to 7 codes",
+	  { { 45, 52, 61, 70 }, { 38, 57, 66, 49 } },
+	  { { 4, 5, 6, 7 }, { 7, 6, 5, 4 } },
+	  { { 3, 17, 40, 9 }, { 30, 2, 11, 25 } } },
+	{ "overlapping edges of 9 to 13 codes",
+	  { { 60, 64, 72, 80 }, { 90, 58, 67, 75 } },
+	  { { 9, 11, 13, 10 }, { 12, 9, 10, 13 } },
+	  { { 22, 50, 5, 33 }, { 41, 7, 29, 60 } } },
+	{ "edges on the first and last codes",
+	  { { 127, 127, 127, 127 }, { 127, 127, 127, 127 } },
+	  { { 6, 4, 8, 5 }, { 5, 7, 4, 6 } },
+	  { { 124, 125, 122, 126 }, { 125, 123, 126, 124 } } },
+};
+
+static const Pattern Narrow = {
+	"edges of 1 to 3 codes",
+	{ { 33, 41, 47, 53 }, { 37, 43, 51, 31 } },
+	{ { 1, 2, 3, 1 }, { 2, 1, 1, 3 } },
+	{ { 5, 18, 29, 2 }, { 13, 26, 7, 21 } }
+};
+
+/*****************************************************************************/
+/*
+* Register model: plain memory, with the sysref flags of a tile latched from
+* the pattern at the programmed DTC code when its capture is cleared, and the
+* sysref waits counted.
+*/
+void metal_io_write(struct metal_io_region *io, unsigned long offset,
+		    uint64_t value, int width)
+{
+	u32 Tile;
+	u16 Code;
+	u16 Flag;
+
+	memcpy(&Regs[offset], &value, (size_t)width);
+	if (offset == SRCOUNT_CTRL) {
+		Waits++;
+		return;
+	}
+	for (Tile = 0U; Tile < NUM_TILES; Tile++) {
+		memcpy(&Flag, &Regs[HSCOM(Tile) + SRFLAG], sizeof(Flag));
+		if ((offset == (HSCOM(Tile) + SRCAP_T1)) &&
+		    ((value & XRFDC_MTS_SRCLR_T1_M) != 0U)) {
+			memcpy(&Code, &Regs[HSCOM(Tile) + SRDTC_T1], sizeof(Code));
+			Flag &= ~(0x3U << SRFLAG_T1_S);
+			Flag |= ((Code < NUM_CODES) ? Flags[T1][Tile][Code] : 3U)
+				<< SRFLAG_T1_S;
+		} else if ((offset == (HSCOM(Tile) + SRCAP_PLL)) &&
+			   ((value & XRFDC_MTS_SRCLR_PLL_M) != 0U)) {
+			memcpy(&Code, &Regs[HSCOM(Tile) + SRDTC_PLL], sizeof(Code));
+			Flag &= ~(0x3U << SRFLAG_PLL_S);
+			Flag |= ((Code < NUM_CODES) ? Flags[PLL][Tile][Code] : 3U)
+				<< SRFLAG_PLL_S;
+		} else {
+			continue;
+		}
+		memcpy(&Regs[HSCOM(Tile) + SRFLAG], &Flag, sizeof(Flag));
+	}
+}
+
+/*****************************************************************************/
+/*
+* Gen 3 converters with 4 ADC tiles, started and enabled for MTS. The sysref
+* counters always have counted enough sysrefs, and all the tiles capture the
+* marker at the same count, so that the latency alignment passes. All the
+* tiles but one run the T1 clock from the PLL, and need the PLL scan.
+*/
+static void ModelInit(void)
+{
+	XRFdc_Config Cfg;
+	XRFdc *InstancePtr = &RFdc;
+	u32 Tile;
+	u32 Value;
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	Cfg.Name = "rfdc";
+	Cfg.IPType = XRFDC_GEN3;
+	for (Tile = 0U; Tile < NUM_TILES; Tile++) {
+		Cfg.ADCTile_Config[Tile].Enable = 1U;
+		Cfg.ADCTile_Config[Tile].SamplingRate = 2.0;
+		Cfg.ADCTile_Config[Tile].NumSlices = 4U;
+	}
+
+	memset(Regs, 0, sizeof(Regs));
+	memset(InstancePtr, 0, sizeof(*InstancePtr));
+	metal_io_init(&Io, Regs, &Cfg.BaseAddr, XRFDC_REGION_SIZE,
+		      (unsigned)(-1), 0U, NULL);
+	InstancePtr->io = &Io;
+	XRFdc_WriteReg(InstancePtr, XRFDC_IP_BASE, XRFDC_ADC_PATHS_ENABLED_OFFSET,
+		       0xFFFFFFFFU);
+	XHOST_CHECK(XRFdc_CfgInitialize(InstancePtr, &Cfg) == XRFDC_SUCCESS,
+		    "initialization");
+
+	XRFdc_WriteReg(InstancePtr, XRFDC_IP_BASE, SRCOUNT_VAL, XRFDC_MTS_SRCOUNT_M);
+	XRFdc_WriteReg(InstancePtr, XRFDC_IP_BASE, SRFREQ_VAL, 0x201U);
+	for (Tile = 0U; Tile < NUM_TILES; Tile++) {
+		XRFdc_WriteReg16(InstancePtr, XRFDC_ADC_TILE_CTRL_STATS_ADDR(Tile),
+				 XRFDC_CURRENT_STATE_OFFSET, 0xFU);
+		XRFdc_WriteReg(InstancePtr, XRFDC_ADC_TILE_DRP_ADDR(Tile) -
+			       XRFDC_TILE_DRP_OFFSET, DLY_ALIGNER0, 1U);
+		XRFdc_WriteReg(InstancePtr, XRFDC_CTRL_STS_BASE(XRFDC_ADC_TILE, Tile),
+			       ADC_MARKER_CNT, AMARK_DONE | 0x20U);
+		Value = (Tile == T1_ONLY_TILE) ? XRFDC_NET_CTRL_CLK_T1_SRC_LOCAL :
+						 0U;
+		XRFdc_WriteReg16(InstancePtr, HSCOM(Tile), XRFDC_CLK_NETWORK_CTRL1,
+				 Value);
+		XHOST_CHECK((XRFdc_SetDecimationFactor(InstancePtr, Tile, 0U,
+						       XRFDC_INTERP_DECIM_1X) ==
+			     XRFDC_SUCCESS) &&
+			    (XRFdc_SetFabRdVldWords(InstancePtr, Tile, 0U, 8U) ==
+			     XRFDC_SUCCESS), "tile %u: data path",
+			    (unsigned)Tile);
+	}
+}
+
+/*****************************************************************************/
+/*
+* An edge is flagged early on its first code, late on its last code, and
+* both in between.
+*/
+static void AddEdge(u32 Cap, u32 Tile, u32 Start, u32 Width)
+{
+	u32 Index;
+	u8 Flag;
+
+	for (Index = 0U; Index < Width; Index++) {
+		if (Index == 0U) {
+			Flag = 1U;
+		} else if (Index == (Width - 1U)) {
+			Flag = 2U;
+		} else {
+			Flag = 3U;
+		}
+		if ((Start + Index) < NUM_CODES) {
+			Flags[Cap][Tile][Start + Index] |= Flag;
+		}
+	}
+}
+
+static void SetPattern(const Pattern *PatternPtr)
+{
+	u32 Cap;
+	u32 Tile;
+	u32 Start;
+
+	memset(Flags, 0, sizeof(Flags));
+	for (Cap = T1; Cap <= PLL; Cap++) {
+		for (Tile = 0U; Tile < NUM_TILES; Tile++) {
+			for (Start = PatternPtr->Offset[Cap][Tile] %
+				     PatternPtr->Period[Cap][Tile];
+			     Start < NUM_CODES;
+			     Start += PatternPtr->Period[Cap][Tile]) {
+				AddEdge(Cap, Tile, Start,
+					PatternPtr->Width[Cap][Tile]);
+			}
+			/* The part of an edge wrapped from before code 0 */
+			Start = PatternPtr->Offset[Cap][Tile] %
+				PatternPtr->Period[Cap][Tile];
+			if ((Start + PatternPtr->Width[Cap][Tile]) >
+			    PatternPtr->Period[Cap][Tile]) {
+				AddEdge(Cap, Tile, 0U, Start +
+					PatternPtr->Width[Cap][Tile] -
+					PatternPtr->Period[Cap][Tile]);
+			}
+		}
+	}
+}
+
+/*****************************************************************************/
+/*
+* A sync of the 4 ADC tiles from a fresh config, with the DTC codes of a
+* previous sync in the given scan mode when they are provided.
+*/
+static void Sync(u32 Fast, int Mode, const int *PLL_CodesPtr,
+		 const int *T1_CodesPtr, SyncResult *ResultPtr)
+{
+	(void)XRFdc_MultiConverter_Init(&SyncConfig, (int *)PLL_CodesPtr,
+					(int *)T1_CodesPtr, REF_TILE);
+	SyncConfig.Tiles = TILES;
+	if (PLL_CodesPtr != NULL) {
+		SyncConfig.DTC_Set_PLL.Scan_Mode = Mode;
+		SyncConfig.DTC_Set_T1.Scan_Mode = Mode;
+	}
+	/* Statistics left by an earlier sync */
+	memset(SyncConfig.DTC_Set_PLL.Num_Windows, 0x5A,
+	       sizeof(SyncConfig.DTC_Set_PLL.Num_Windows));
+	memset(SyncConfig.DTC_Set_T1.Num_Windows, 0x5A,
+	       sizeof(SyncConfig.DTC_Set_T1.Num_Windows));
+
+	Waits = 0U;
+	if (Fast != 0U) {
+		ResultPtr->Status = XRFdc_MultiConverter_Sync_Fast(&RFdc,
+								   XRFDC_ADC_TILE,
+								   &SyncConfig);
+	} else {
+		ResultPtr->Status = XRFdc_MultiConverter_Sync(&RFdc,
+							      XRFDC_ADC_TILE,
+							      &SyncConfig);
+	}
+	ResultPtr->Waits = Waits;
+	ResultPtr->Set[T1] = SyncConfig.DTC_Set_T1;
+	ResultPtr->Set[PLL] = SyncConfig.DTC_Set_PLL;
+}
+
+static u32 SameCodes(const SyncResult *APtr, const SyncResult *BPtr)
+{
+	return ((APtr->Status == BPtr->Status) &&
+		(memcmp(APtr->Set[T1].DTC_Code, BPtr->Set[T1].DTC_Code,
+			sizeof(APtr->Set[T1].DTC_Code)) == 0) &&
+		(memcmp(APtr->Set[PLL].DTC_Code, BPtr->Set[PLL].DTC_Code,
+			sizeof(APtr->Set[PLL].DTC_Code)) == 0)) ? 1U : 0U;
+}
+
+static u32 SameStats(const SyncResult *APtr, const SyncResult *BPtr)
+{
+	u32 Cap;
+	u32 Tile;
+
+	for (Cap = T1; Cap <= PLL; Cap++) {
+		for (Tile = 0U; Tile < NUM_TILES; Tile++) {
+			if ((Cap == PLL) && (Tile == T1_ONLY_TILE)) {
+				continue;
+			}
+			if ((APtr->Set[Cap].Num_Windows[Tile] !=
+			     BPtr->Set[Cap].Num_Windows[Tile]) ||
+			    (APtr->Set[Cap].Max_Gap[Tile] !=
+			     BPtr->Set[Cap].Max_Gap[Tile]) ||
+			    (APtr->Set[Cap].Min_Gap[Tile] !=
+			     BPtr->Set[Cap].Min_Gap[Tile]) ||
+			    (APtr->Set[Cap].Max_Overlap[Tile] !=
+			     BPtr->Set[Cap].Max_Overlap[Tile])) {
+				return 0U;
+			}
+		}
+	}
+
+	return 1U;
+}
+
+/*****************************************************************************/
+/*
+* No edge is flagged within the margin around the picked code.
+*/
+static u32 IsSafe(const SyncResult *ResultPtr, u32 Cap, u32 Tile)
+{
+	int Code = ResultPtr->Set[Cap].DTC_Code[Tile];
+	int Offset;
+
+	if ((Code < 0) || (Code >= (int)NUM_CODES)) {
+		return 0U;
+	}
+	for (Offset = -MARGIN; Offset <= MARGIN; Offset++) {
+		if (((Code + Offset) >= 0) && ((Code + Offset) < (int)NUM_CODES) &&
+		    (Flags[Cap][Tile][Code + Offset] != 0U)) {
+			return 0U;
+		}
+	}
+
+	return 1U;
+}
+
+static void CheckSafe(const char *Name, const SyncResult *ResultPtr)
+{
+	u32 Cap;
+	u32 Tile;
+
+	for (Cap = T1; Cap <= PLL; Cap++) {
+		for (Tile = 0U; Tile < NUM_TILES; Tile++) {
+			if ((Cap == PLL) && (Tile == T1_ONLY_TILE)) {
+				XHOST_CHECK(ResultPtr->Set[PLL].DTC_Code[Tile] == -1,
+					    "%s: PLL code %d on the T1 clock tile",
+					    Name, ResultPtr->Set[PLL].DTC_Code[Tile]);
+				continue;
+			}
+			XHOST_CHECK(IsSafe(ResultPtr, Cap, Tile), "%s: %s code %d "
+				    "of tile %u next to an edge", Name,
+				    (Cap == PLL) ? "PLL" : "T1",
+				    ResultPtr->Set[Cap].DTC_Code[Tile],
+				    (unsigned)Tile);
+		}
+	}
+}
+
+static void PrintCodes(const char *Name, const SyncResult *ResultPtr)
+{
+	printf("  %-12s status 0x%03x, %4u sysref waits, PLL %3d %3d %3d %3d, "
+	       "T1 %3d %3d %3d %3d\n", Name, (unsigned)ResultPtr->Status,
+	       (unsigned)ResultPtr->Waits, ResultPtr->Set[PLL].DTC_Code[0],
+	       ResultPtr->Set[PLL].DTC_Code[1], ResultPtr->Set[PLL].DTC_Code[2],
+	       ResultPtr->Set[PLL].DTC_Code[3], ResultPtr->Set[T1].DTC_Code[0],
+	       ResultPtr->Set[T1].DTC_Code[1], ResultPtr->Set[T1].DTC_Code[2],
+	       ResultPtr->Set[T1].DTC_Code[3]);
+}
+
+/*****************************************************************************/
+/*
+* Edges wider than the coarse step: the group scan picks the codes of the
+* full scan with fewer sysref waits.
+*/
+static void CheckPattern(const Pattern *PatternPtr)
+{
+	SyncResult Full;
+	SyncResult Fast;
+
+	SetPattern(PatternPtr);
+	Sync(0U, XRFDC_MTS_SCAN_INIT, NULL, NULL, &Full);
+	Sync(1U, XRFDC_MTS_SCAN_INIT, NULL, NULL, &Fast);
+	printf("%s:\n", PatternPtr->Name);
+	PrintCodes("full scan", &Full);
+	PrintCodes("group scan", &Fast);
+
+	XHOST_CHECK(Full.Status == XRFDC_MTS_OK, "%s: full scan status 0x%x",
+		    PatternPtr->Name, (unsigned)Full.Status);
+	XHOST_CHECK(SameCodes(&Full, &Fast), "%s: group scan codes",
+		    PatternPtr->Name);
+	XHOST_CHECK(SameStats(&Full, &Fast), "%s: group scan statistics",
+		    PatternPtr->Name);
+	XHOST_CHECK(Fast.Waits < Full.Waits, "%s: %u sysref waits, %u in "
+		    "the full scan", PatternPtr->Name, (unsigned)Fast.Waits,
+		    (unsigned)Full.Waits);
+	CheckSafe(PatternPtr->Name, &Fast);
+}
+
+/*****************************************************************************/
+/*
+* An edge of one code between two coarse codes and next to the code picked
+* without it is missed by the coarse scan. The check of the picked code
+* finds it, and the tile is scanned in full. Narrow edges elsewhere are
+* missed, the codes can then differ but stay clear of them.
+*/
+static void CheckNarrowFallback(void)
+{
+	SyncResult Full;
+	SyncResult Fast;
+	SyncResult Clean;
+	u32 Tile;
+	u32 Cap;
+	int Code;
+
+	for (Cap = T1; Cap <= PLL; Cap++) {
+		for (Tile = 0U; Tile < NUM_TILES; Tile++) {
+			if ((Cap == PLL) && (Tile == T1_ONLY_TILE)) {
+				continue;
+			}
+			SetPattern(&Patterns[0]);
+			Sync(1U, XRFDC_MTS_SCAN_INIT, NULL, NULL, &Clean);
+			Code = Clean.Set[Cap].DTC_Code[Tile] + 1;
+			if ((Code % (int)COARSE_STEP) == 0) {
+				Code -= 2;
+			}
+			AddEdge(Cap, Tile, (u32)Code, 1U);
+			Sync(0U, XRFDC_MTS_SCAN_INIT, NULL, NULL, &Full);
+			Sync(1U, XRFDC_MTS_SCAN_INIT, NULL, NULL, &Fast);
+			XHOST_CHECK(SameCodes(&Full, &Fast) &&
+				    (Fast.Set[Cap].DTC_Code[Tile] !=
+				     Clean.Set[Cap].DTC_Code[Tile]),
+				    "%s tile %u, edge at code %d: group scan code "
+				    "%d, full scan %d", (Cap == PLL) ? "PLL" : "T1",
+				    (unsigned)Tile, Code,
+				    Fast.Set[Cap].DTC_Code[Tile],
+				    Full.Set[Cap].DTC_Code[Tile]);
+			XHOST_CHECK(Fast.Waits > Clean.Waits, "%s tile %u: %u "
+				    "sysref waits, %u without the edge",
+				    (Cap == PLL) ? "PLL" : "T1", (unsigned)Tile,
+				    (unsigned)Fast.Waits, (unsigned)Clean.Waits);
+			if ((Cap == T1) && (Tile == 2U)) {
+				printf("missed edge next to the T1 code of tile 2:\n");
+				PrintCodes("full scan", &Full);
+				PrintCodes("group scan", &Fast);
+			}
+		}
+	}
+
+	SetPattern(&Narrow);
+	Sync(0U, XRFDC_MTS_SCAN_INIT, NULL, NULL, &Full);
+	Sync(1U, XRFDC_MTS_SCAN_INIT, NULL, NULL, &Fast);
+	printf("%s:\n", Narrow.Name);
+	PrintCodes("full scan", &Full);
+	PrintCodes("group scan", &Fast);
+	XHOST_CHECK(Fast.Status == Full.Status, "%s: status 0x%x, 0x%x in the "
+		    "full scan", Narrow.Name, (unsigned)Fast.Status,
+		    (unsigned)Full.Status);
+	CheckSafe(Narrow.Name, &Fast);
+}
+
+/*****************************************************************************/
+/*
+* A tile with no clear window fails both scans alike.
+*/
+static void CheckNoWindow(void)
+{
+	SyncResult Full;
+	SyncResult Fast;
+
+	SetPattern(&Patterns[0]);
+	memset(Flags[T1][3], 3, sizeof(Flags[T1][3]));
+	metal_set_log_level(METAL_LOG_EMERGENCY);
+	Sync(0U, XRFDC_MTS_SCAN_INIT, NULL, NULL, &Full);
+	Sync(1U, XRFDC_MTS_SCAN_INIT, NULL, NULL, &Fast);
+	metal_set_log_level(METAL_LOG_ERROR);
+	XHOST_CHECK(((Full.Status & XRFDC_MTS_DTC_INVALID) != 0U) &&
+		    (Full.Set[T1].DTC_Code[3] == -1), "no window: full scan "
+		    "status 0x%x code %d", (unsigned)Full.Status,
+		    Full.Set[T1].DTC_Code[3]);
+	XHOST_CHECK(SameCodes(&Full, &Fast), "no window: group scan status "
+		    "0x%x code %d", (unsigned)Fast.Status,
+		    Fast.Set[T1].DTC_Code[3]);
+}
+
+/*****************************************************************************/
+/*
+* The codes of the full scan are verified without a scan. After the T1 edge
+* of a tile drifts onto its code, the verify rescans that tile only, as the
+* full scan reloading the same codes would.
+*/
+static void CheckVerify(const Pattern *PatternPtr)
+{
+	SyncResult Full;
+	SyncResult Verify;
+	SyncResult Reload;
+	int PLL_Codes[NUM_TILES];
+	int T1_Codes[NUM_TILES];
+	u32 Cap;
+	u32 Tile;
+
+	SetPattern(PatternPtr);
+	Sync(0U, XRFDC_MTS_SCAN_INIT, NULL, NULL, &Full);
+	memcpy(PLL_Codes, Full.Set[PLL].DTC_Code, sizeof(PLL_Codes));
+	memcpy(T1_Codes, Full.Set[T1].DTC_Code, sizeof(T1_Codes));
+
+	Sync(1U, XRFDC_MTS_SCAN_VERIFY, PLL_Codes, T1_Codes, &Verify);
+	XHOST_CHECK(SameCodes(&Full, &Verify), "%s: verified codes",
+		    PatternPtr->Name);
+	XHOST_CHECK(Verify.Waits <= MAX_VERIFY_WAITS, "%s: %u sysref waits "
+		    "to verify", PatternPtr->Name, (unsigned)Verify.Waits);
+	for (Cap = T1; Cap <= PLL; Cap++) {
+		for (Tile = 0U; Tile < NUM_TILES; Tile++) {
+			if ((Cap == PLL) && (Tile == T1_ONLY_TILE)) {
+				continue;
+			}
+			XHOST_CHECK((Verify.Set[Cap].Num_Windows[Tile] == 0) &&
+				    (Verify.Set[Cap].Max_Gap[Tile] == 0) &&
+				    (Verify.Set[Cap].Min_Gap[Tile] == 0) &&
+				    (Verify.Set[Cap].Max_Overlap[Tile] == 0),
+				    "%s: statistics of verified tile %u",
+				    PatternPtr->Name, (unsigned)Tile);
+		}
+	}
+
+	/* The regular sync scans the verify mode as the reload mode */
+	Sync(0U, XRFDC_MTS_SCAN_RELOAD, PLL_Codes, T1_Codes, &Reload);
+	Sync(0U, XRFDC_MTS_SCAN_VERIFY, PLL_Codes, T1_Codes, &Full);
+	XHOST_CHECK(SameCodes(&Reload, &Full) && SameStats(&Reload, &Full),
+		    "%s: full scan in the verify mode", PatternPtr->Name);
+
+	AddEdge(T1, 2U, (u32)T1_Codes[2] - 1U, 3U);
+	Sync(0U, XRFDC_MTS_SCAN_RELOAD, PLL_Codes, T1_Codes, &Reload);
+	Sync(1U, XRFDC_MTS_SCAN_VERIFY, PLL_Codes, T1_Codes, &Verify);
+	printf("%s, T1 edge of tile 2 on its code %d:\n", PatternPtr->Name,
+	       T1_Codes[2]);
+	PrintCodes("full reload", &Reload);
+	PrintCodes("verify", &Verify);
+	XHOST_CHECK(SameCodes(&Reload, &Verify) &&
+		    (Verify.Set[T1].DTC_Code[2] != T1_Codes[2]),
+		    "%s: drifted T1 code %d, %d in the full scan",
+		    PatternPtr->Name, Verify.Set[T1].DTC_Code[2],
+		    Reload.Set[T1].DTC_Code[2]);
+	XHOST_CHECK((Verify.Set[T1].Num_Windows[2] ==
+		     Reload.Set[T1].Num_Windows[2]) &&
+		    (Verify.Set[T1].Num_Windows[0] == 0), "%s: statistics of "
+		    "the rescanned tile", PatternPtr->Name);
+	CheckSafe(PatternPtr->Name, &Verify);
+}
+
+int main(void)
+{
+	u32 Index;
+
+	ModelInit();
+
+	for (Index = 0U; Index < sizeof(Patterns) / sizeof(Patterns[0]);
+	     Index++) {
+		CheckPattern(&Patterns[Index]);
+	}
+	CheckNarrowFallback();
+	CheckNoWindow();
+	for (Index = 0U; Index < sizeof(Patterns) / sizeof(Patterns[0]);
+	     Index++) {
+		CheckVerify(&Patterns[Index]);
+	}
+	XHOST_CHECK(XHostModel_AssertCount == 0U, "%u assertions",
+		    (unsigned)XHostModel_AssertCount);
+
+	return XHostModel_Report("xrfdc_mts_model_test");
+}
@@ -292,6 +292,10 @@
 * 12.1  cog    07/04/23 Add support for SDT.
 *       cog    07/14/23 Fix issues with SDT flow.
 *       cog    07/27/23 Add NCO frequency to config structures.
+* 12.2  kt     10/18/26 Added APIs XRFdc_PrepareHop() and XRFdc_ApplyHop() to
+*                       retune the NCOs of several blocks with one update.
+*       kt     10/18/26 Added API XRFdc_MultiConverter_Sync_Fast() and the
+*                       XRFDC_MTS_SCAN_VERIFY DTC scan mode.
 *
 * </pre>
 *
@@ -328,6 +332,9 @@ extern "C" {
 #define XRFDC_MTS_RMW(read, mask, data) (((read) & ~(mask)) | ((data) & (mask)))
 #define XRFDC_MTS_FIELD(data, mask, shift) (((data) & (mask)) >> (shift))
 
+#define XRFDC_HOP_MAX_CHANNELS 32U
+#define XRFDC_HOP_MAX_WRITES ((XRFDC_HOP_MAX_CHANNELS * 12U) + 8U)
+
 #ifndef __BAREMETAL__
 typedef __u32 u32;
 typedef __u16 u16;
@@ -496,6 +503,29 @@ typedef struct {
 	u8 MixerType;
 } XRFdc_Mixer_Settings;
 
+/**
+ * NCO hop channel settings.
+ */
+typedef struct {
+	u32 Type;
+	u32 Tile_Id;
+	u32 Block_Id;
+	double Freq;
+	double PhaseOffset;
+} XRFdc_Hop_Channel;
+
+/**
+ * Precomputed NCO hop, the register writes of all the channels followed by
+ * their update event triggers.
+ */
+typedef struct {
+	u32 NumChannels;
+	XRFdc_Hop_Channel Channels[XRFDC_HOP_MAX_CHANNELS];
+	u32 NumWrites;
+	u32 WriteAddr[XRFDC_HOP_MAX_WRITES];
+	u16 WriteData[XRFDC_HOP_MAX_WRITES];
+} XRFdc_Hop;
+
 /**
  * ADC block Threshold settings.
  */
@@ -1327,6 +1357,7 @@ typedef struct {
 
 #define XRFDC_MTS_SCAN_INIT 0U
 #define XRFDC_MTS_SCAN_RELOAD 1U
+#define XRFDC_MTS_SCAN_VERIFY 2U
 
 /* MTS Error Codes */
 #define XRFDC_MTS_OK 0U
@@ -1367,6 +1398,8 @@ u32 XRFdc_SetMixerSettings(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_
 			   XRFdc_Mixer_Settings *MixerSettingsPtr);
 u32 XRFdc_GetMixerSettings(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id,
 			   XRFdc_Mixer_Settings *MixerSettingsPtr);
+u32 XRFdc_PrepareHop(XRFdc *InstancePtr, XRFdc_Hop_Channel *ChannelsPtr, u32 NumChannels, XRFdc_Hop *HopPtr);
+u32 XRFdc_ApplyHop(XRFdc *InstancePtr, XRFdc_Hop *HopPtr);
 u32 XRFdc_SetQMCSettings(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, XRFdc_QMC_Settings *QMCSettingsPtr);
 u32 XRFdc_GetQMCSettings(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, XRFdc_QMC_Settings *QMCSettingsPtr);
 u32 XRFdc_GetCoarseDelaySettings(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id,
@@ -1489,6 +1522,7 @@ u32 XRFdc_GetMaxSampleRate(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, double *Ma
 u32 XRFdc_GetMinSampleRate(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, double *MinSampleRatePtr);
 double XRFdc_GetDriverVersion(void);
 u32 XRFdc_MultiConverter_Sync(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter_Sync_Config *ConfigPtr);
+u32 XRFdc_MultiConverter_Sync_Fast(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter_Sync_Config *ConfigPtr);
 u32 XRFdc_MultiConverter_Init(XRFdc_MultiConverter_Sync_Config *ConfigPtr, int *PLL_CodesPtr, int *T1_CodesPtr,
 			      u32 RefTile);
 u32 XRFdc_MTS_Sysref_Config(XRFdc *InstancePtr, XRFdc_MultiConverter_Sync_Config *DACSyncConfigPtr,
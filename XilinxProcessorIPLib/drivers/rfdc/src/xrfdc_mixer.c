@@ -56,6 +56,8 @@
 * 11.0  cog    05/31/21 Upversion.
 * 11.1  cog    11/16/21 Upversion.
 *       cog    01/18/22 Added safety checks.
+* 12.2  kt     10/18/26 Added XRFdc_PrepareHop() and XRFdc_ApplyHop() to
+*                       retune the NCOs of several blocks with one update.
 * </pre>
 *
 ******************************************************************************/
@@ -74,6 +76,9 @@ static void XRFdc_SetCoarseMixer(XRFdc *InstancePtr, u32 Type, u32 BaseAddr, u32
 static u32 XRFdc_MixerRangeCheck(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id,
 				 XRFdc_Mixer_Settings *MixerSettingsPtr);
 static void XRFdc_MixersOff(XRFdc *InstancePtr, u32 BaseAddr);
+static u32 XRFdc_GetNCOFreqWord(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, double SamplingRate,
+				double NCOFreq, s64 *FreqWordPtr);
+static void XRFdc_AddHopWrite(XRFdc_Hop *HopPtr, u32 Addr, u16 Data);
 
 /************************** Function Prototypes ******************************/
 
@@ -118,7 +123,6 @@ u32 XRFdc_SetMixerSettings(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_
 	u8 CalibrationMode = 0U;
 	u32 CoarseMixFreq;
 	double NCOFreq;
-	u32 NyquistZone = 0U;
 	u32 Offset;
 	u32 DatapathMode;
 	u32 BWDiv = XRFDC_FULL_BW_DIVISOR;
@@ -271,27 +275,11 @@ u32 XRFdc_SetMixerSettings(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_
 			}
 		}
 
-		if ((NCOFreq < -(SamplingRate / 2.0)) || (NCOFreq > (SamplingRate / 2.0))) {
-			Status = XRFdc_GetNyquistZone(InstancePtr, Type, Tile_Id, Block_Id, &NyquistZone);
-			if (Status != XRFDC_SUCCESS) {
-				return XRFDC_FAILURE;
-			}
-			do {
-				if (NCOFreq < -(SamplingRate / 2.0)) {
-					NCOFreq += SamplingRate;
-				}
-				if (NCOFreq > (SamplingRate / 2.0)) {
-					NCOFreq -= SamplingRate;
-				}
-			} while ((NCOFreq < -(SamplingRate / 2.0)) || (NCOFreq > (SamplingRate / 2.0)));
-
-			if ((NyquistZone == XRFDC_EVEN_NYQUIST_ZONE) && (NCOFreq != 0)) {
-				NCOFreq *= -1;
-			}
-		}
-
 		/* NCO Frequency */
-		Freq = ((NCOFreq * XRFDC_NCO_FREQ_MULTIPLIER) / SamplingRate);
+		Status = XRFdc_GetNCOFreqWord(InstancePtr, Type, Tile_Id, Block_Id, SamplingRate, NCOFreq, &Freq);
+		if (Status != XRFDC_SUCCESS) {
+			return XRFDC_FAILURE;
+		}
 		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_LOW_OFFSET, (u16)Freq);
 		ReadReg = (Freq >> XRFDC_NCO_FQWD_MID_SHIFT) & XRFDC_NCO_FQWD_MID_MASK;
 		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_MID_OFFSET, (u16)ReadReg);
@@ -731,6 +719,76 @@ static void XRFdc_SetCoarseMixer(XRFdc *InstancePtr, u32 Type, u32 BaseAddr, u32
 	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_MXR_MODE_OFFSET, XRFDC_MIXER_MODE_OFF);
 }
 
+/*****************************************************************************/
+/**
+* Static API used to get the NCO frequency word of a block. Frequencies out
+* of the first Nyquist zone are folded back, and negated in an even zone.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3.
+* @param    Block_Id is ADC/DAC block number inside the tile.
+* @param    SamplingRate is the sampling rate of the NCO in MHz.
+* @param    NCOFreq is the NCO frequency in MHz.
+* @param    FreqWordPtr is a pointer to the frequency word.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if the Nyquist zone could not be read.
+*
+* @note     Static API
+*
+******************************************************************************/
+static u32 XRFdc_GetNCOFreqWord(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, double SamplingRate,
+				double NCOFreq, s64 *FreqWordPtr)
+{
+	u32 Status;
+	u32 NyquistZone = 0U;
+
+	if ((NCOFreq < -(SamplingRate / 2.0)) || (NCOFreq > (SamplingRate / 2.0))) {
+		Status = XRFdc_GetNyquistZone(InstancePtr, Type, Tile_Id, Block_Id, &NyquistZone);
+		if (Status != XRFDC_SUCCESS) {
+			return XRFDC_FAILURE;
+		}
+		do {
+			if (NCOFreq < -(SamplingRate / 2.0)) {
+				NCOFreq += SamplingRate;
+			}
+			if (NCOFreq > (SamplingRate / 2.0)) {
+				NCOFreq -= SamplingRate;
+			}
+		} while ((NCOFreq < -(SamplingRate / 2.0)) || (NCOFreq > (SamplingRate / 2.0)));
+
+		if ((NyquistZone == XRFDC_EVEN_NYQUIST_ZONE) && (NCOFreq != 0)) {
+			NCOFreq *= -1;
+		}
+	}
+
+	*FreqWordPtr = ((NCOFreq * XRFDC_NCO_FREQ_MULTIPLIER) / SamplingRate);
+
+	return XRFDC_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Static API used to add a register write to an NCO hop.
+*
+* @param    HopPtr is a pointer to the XRFdc_Hop structure.
+* @param    Addr is the register address.
+* @param    Data is the value to write.
+*
+* @return
+*           - None
+*
+* @note     Static API
+*
+******************************************************************************/
+static void XRFdc_AddHopWrite(XRFdc_Hop *HopPtr, u32 Addr, u16 Data)
+{
+	HopPtr->WriteAddr[HopPtr->NumWrites] = Addr;
+	HopPtr->WriteData[HopPtr->NumWrites++] = Data;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1048,6 +1106,290 @@ RETURN_PATH:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* The API is used to precompute an NCO hop. The NCO frequency and phase words
+* of all the channels are computed with the current sampling rate, Nyquist
+* zone and calibration mode of each block, and stored in the hop as a list
+* of register writes followed by the update event triggers. A hop table is
+* built by calling this API once per hop, ahead of time.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    ChannelsPtr is a pointer to the array of channels of the hop.
+*           Each channel gives the ADC/DAC block with its new NCO frequency
+*           and phase offset, as in XRFdc_Mixer_Settings.
+* @param    NumChannels is the number of channels, up to
+*           XRFDC_HOP_MAX_CHANNELS.
+* @param    HopPtr is a pointer to the XRFdc_Hop structure to fill.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if a channel is not valid or its block does not
+*             use the fine mixer.
+*
+* @note     The update event source of each block is read when the hop is
+*           prepared. Blocks on the tile event get a single trigger per
+*           tile, issued back to back for all the tiles after all the
+*           frequency words are written. Blocks on the SYSREF, PL or marker
+*           event are not triggered, the new words are applied on the next
+*           external event, which aligns them across tiles.
+*           The hop must be prepared again after the sampling rate, the
+*           Nyquist zone, the calibration mode, the datapath mode or the
+*           event source of one of its blocks changed.
+*
+******************************************************************************/
+u32 XRFdc_PrepareHop(XRFdc *InstancePtr, XRFdc_Hop_Channel *ChannelsPtr, u32 NumChannels, XRFdc_Hop *HopPtr)
+{
+	u32 Status;
+	u32 Channel;
+	u32 Type;
+	u32 Tile_Id;
+	u32 Block_Id;
+	u32 Index;
+	u32 NoOfBlocks;
+	u32 BaseAddr;
+	u32 EventSource;
+	u32 DatapathMode;
+	u32 BWDiv;
+	u32 TileMask[2] = { 0U, 0U };
+	u32 NumTrigs = 0U;
+	u32 TrigAddr[(XRFDC_HOP_MAX_CHANNELS * 2U) + 8U];
+	u16 TrigData[(XRFDC_HOP_MAX_CHANNELS * 2U) + 8U];
+	double SamplingRate;
+	double NCOFreq;
+	s64 Freq;
+	s32 PhaseOffset;
+	u8 CalibrationMode = 0U;
+	XRFdc_Mixer_Settings *MixerConfigPtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ChannelsPtr != NULL);
+	Xil_AssertNonvoid(HopPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	HopPtr->NumChannels = 0U;
+	HopPtr->NumWrites = 0U;
+
+	if (NumChannels > XRFDC_HOP_MAX_CHANNELS) {
+		Status = XRFDC_FAILURE;
+		metal_log(METAL_LOG_ERROR, "\n Invalid number of hop channels (%u) in %s\r\n", NumChannels, __func__);
+		goto RETURN_PATH;
+	}
+
+	for (Channel = 0U; Channel < NumChannels; Channel++) {
+		Type = ChannelsPtr[Channel].Type;
+		Tile_Id = ChannelsPtr[Channel].Tile_Id;
+		Block_Id = ChannelsPtr[Channel].Block_Id;
+
+		Status = XRFdc_CheckDigitalPathEnabled(InstancePtr, Type, Tile_Id, Block_Id);
+		if (Status != XRFDC_SUCCESS) {
+			metal_log(METAL_LOG_ERROR, "\n %s %u digital path %u not enabled in %s\r\n",
+				  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id, Block_Id, __func__);
+			goto RETURN_PATH;
+		}
+		if ((ChannelsPtr[Channel].PhaseOffset >= XRFDC_MIXER_PHASE_OFFSET_UP_LIMIT) ||
+		    (ChannelsPtr[Channel].PhaseOffset <= XRFDC_MIXER_PHASE_OFFSET_LOW_LIMIT)) {
+			Status = XRFDC_FAILURE;
+			metal_log(METAL_LOG_ERROR, "\n Invalid phase offset value (%lf) for %s %u block %u in %s\r\n",
+				  ChannelsPtr[Channel].PhaseOffset, (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id,
+				  Block_Id, __func__);
+			goto RETURN_PATH;
+		}
+
+		BWDiv = XRFDC_FULL_BW_DIVISOR;
+		if ((InstancePtr->RFdc_Config.IPType >= XRFDC_GEN3) && (Type == XRFDC_DAC_TILE)) {
+			DatapathMode = XRFdc_RDReg(InstancePtr, XRFDC_BLOCK_BASE(XRFDC_DAC_TILE, Tile_Id, Block_Id),
+						   XRFDC_DAC_DATAPATH_OFFSET, XRFDC_DATAPATH_MODE_MASK);
+			if (DatapathMode == XRFDC_DAC_INT_MODE_FULL_BW_BYPASS) {
+				Status = XRFDC_FAILURE;
+				metal_log(METAL_LOG_ERROR,
+					  "\n Can't set mixer as DAC %u DUC %u is in bypass mode in %s\r\n", Tile_Id,
+					  Block_Id, __func__);
+				goto RETURN_PATH;
+			} else if (DatapathMode == XRFDC_DAC_INT_MODE_HALF_BW_IMR) {
+				BWDiv = XRFDC_HALF_BW_DIVISOR;
+			}
+		}
+
+		Index = Block_Id;
+		if ((XRFdc_IsHighSpeedADC(InstancePtr, Tile_Id) == 1) && (Type == XRFDC_ADC_TILE)) {
+			NoOfBlocks = XRFDC_NUM_OF_BLKS2;
+			if (Block_Id == XRFDC_BLK_ID1) {
+				Index = XRFDC_BLK_ID2;
+				NoOfBlocks = XRFDC_NUM_OF_BLKS4;
+			}
+		} else {
+			NoOfBlocks = Block_Id + 1U;
+		}
+
+		for (; Index < NoOfBlocks; Index++) {
+			if (Type == XRFDC_ADC_TILE) {
+				MixerConfigPtr =
+					&InstancePtr->ADC_Tile[Tile_Id].ADCBlock_Digital_Datapath[Index].Mixer_Settings;
+				SamplingRate = InstancePtr->ADC_Tile[Tile_Id].PLL_Settings.SampleRate;
+			} else {
+				MixerConfigPtr =
+					&InstancePtr->DAC_Tile[Tile_Id].DACBlock_Digital_Datapath[Index].Mixer_Settings;
+				SamplingRate = InstancePtr->DAC_Tile[Tile_Id].PLL_Settings.SampleRate / BWDiv;
+			}
+
+			if (MixerConfigPtr->MixerType != XRFDC_MIXER_TYPE_FINE) {
+				Status = XRFDC_FAILURE;
+				metal_log(METAL_LOG_ERROR, "\n Fine mixer not in use for %s %u block %u in %s\r\n",
+					  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id, Block_Id, __func__);
+				goto RETURN_PATH;
+			}
+			if (SamplingRate <= 0) {
+				Status = XRFDC_FAILURE;
+				metal_log(METAL_LOG_ERROR, "\n Incorrect Sampling rate (%2.4f GHz) for %s %u in %s\r\n",
+					  SamplingRate, (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id, __func__);
+				goto RETURN_PATH;
+			}
+			SamplingRate *= XRFDC_MILLI;
+
+			NCOFreq = ChannelsPtr[Channel].Freq;
+			if ((InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) && (Type == XRFDC_ADC_TILE)) {
+				Status = XRFdc_GetCalibrationMode(InstancePtr, Tile_Id, Block_Id, &CalibrationMode);
+				if (Status != XRFDC_SUCCESS) {
+					goto RETURN_PATH;
+				}
+				if (CalibrationMode == XRFDC_CALIB_MODE1) {
+					NCOFreq -= SamplingRate / 2.0;
+				}
+			}
+
+			Status = XRFdc_GetNCOFreqWord(InstancePtr, Type, Tile_Id, Block_Id, SamplingRate, NCOFreq, &Freq);
+			if (Status != XRFDC_SUCCESS) {
+				goto RETURN_PATH;
+			}
+			PhaseOffset = ((ChannelsPtr[Channel].PhaseOffset * XRFDC_NCO_PHASE_MULTIPLIER) /
+				       XRFDC_MIXER_PHASE_OFFSET_UP_LIMIT);
+
+			BaseAddr = XRFDC_BLOCK_BASE(Type, Tile_Id, Index);
+			XRFdc_AddHopWrite(HopPtr, BaseAddr + XRFDC_ADC_NCO_FQWD_LOW_OFFSET, (u16)Freq);
+			XRFdc_AddHopWrite(HopPtr, BaseAddr + XRFDC_ADC_NCO_FQWD_MID_OFFSET,
+					  (u16)((Freq >> XRFDC_NCO_FQWD_MID_SHIFT) & XRFDC_NCO_FQWD_MID_MASK));
+			XRFdc_AddHopWrite(HopPtr, BaseAddr + XRFDC_ADC_NCO_FQWD_UPP_OFFSET,
+					  (u16)((Freq >> XRFDC_NCO_FQWD_UPP_SHIFT) & XRFDC_NCO_FQWD_UPP_MASK));
+			XRFdc_AddHopWrite(HopPtr, BaseAddr + XRFDC_NCO_PHASE_LOW_OFFSET, (u16)PhaseOffset);
+			XRFdc_AddHopWrite(HopPtr, BaseAddr + XRFDC_NCO_PHASE_UPP_OFFSET,
+					  (u16)((PhaseOffset >> XRFDC_NCO_PHASE_UPP_SHIFT) & XRFDC_NCO_PHASE_UPP_MASK));
+
+			/* Event Source */
+			EventSource = XRFdc_RDReg(InstancePtr, BaseAddr, XRFDC_NCO_UPDT_OFFSET, XRFDC_NCO_UPDT_MODE_MASK);
+			switch (EventSource) {
+			case XRFDC_EVNT_SRC_IMMEDIATE:
+				TrigAddr[NumTrigs] = BaseAddr + ((Type == XRFDC_ADC_TILE) ? XRFDC_ADC_UPDATE_DYN_OFFSET :
+											    XRFDC_DAC_UPDATE_DYN_OFFSET);
+				TrigData[NumTrigs++] = XRFDC_UPDT_EVNT_NCO_MASK;
+				break;
+			case XRFDC_EVNT_SRC_SLICE:
+				TrigAddr[NumTrigs] = BaseAddr + ((Type == XRFDC_ADC_TILE) ? XRFDC_ADC_UPDATE_DYN_OFFSET :
+											    XRFDC_DAC_UPDATE_DYN_OFFSET);
+				TrigData[NumTrigs++] = XRFDC_UPDT_EVNT_SLICE_MASK;
+				break;
+			case XRFDC_EVNT_SRC_TILE:
+				TileMask[Type] |= (1U << Tile_Id);
+				break;
+			default:
+				/* Issued external to the driver */
+				break;
+			}
+		}
+
+		HopPtr->Channels[HopPtr->NumChannels++] = ChannelsPtr[Channel];
+	}
+
+	/* Update event triggers, after all the frequency words */
+	for (Index = 0U; Index < NumTrigs; Index++) {
+		XRFdc_AddHopWrite(HopPtr, TrigAddr[Index], TrigData[Index]);
+	}
+	for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_NUM_OF_TILES4; Tile_Id++) {
+		if ((TileMask[XRFDC_ADC_TILE] & (1U << Tile_Id)) != 0U) {
+			XRFdc_AddHopWrite(HopPtr,
+					  XRFDC_ADC_TILE_DRP_ADDR(Tile_Id) + XRFDC_HSCOM_ADDR + XRFDC_HSCOM_UPDT_DYN_OFFSET,
+					  0x1U);
+		}
+		if ((TileMask[XRFDC_DAC_TILE] & (1U << Tile_Id)) != 0U) {
+			XRFdc_AddHopWrite(HopPtr,
+					  XRFDC_DAC_TILE_DRP_ADDR(Tile_Id) + XRFDC_HSCOM_ADDR + XRFDC_HSCOM_UPDT_DYN_OFFSET,
+					  0x1U);
+		}
+	}
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	if (Status != XRFDC_SUCCESS) {
+		HopPtr->NumChannels = 0U;
+		HopPtr->NumWrites = 0U;
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* The API is used to apply an NCO hop precomputed by XRFdc_PrepareHop(). The
+* frequency and phase words of all the channels are written back to back,
+* followed by the update event triggers. Driver structure is updated with the
+* new values.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    HopPtr is a pointer to the XRFdc_Hop structure to apply.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*
+* @note     No register is read, the hop is applied as it was prepared.
+*
+******************************************************************************/
+u32 XRFdc_ApplyHop(XRFdc *InstancePtr, XRFdc_Hop *HopPtr)
+{
+	u32 Index;
+	u32 Channel;
+	u32 NoOfBlocks;
+	XRFdc_Hop_Channel *ChannelPtr;
+	XRFdc_Mixer_Settings *MixerConfigPtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(HopPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	for (Index = 0U; Index < HopPtr->NumWrites; Index++) {
+		XRFdc_WriteReg16(InstancePtr, 0U, HopPtr->WriteAddr[Index], HopPtr->WriteData[Index]);
+	}
+
+	/* Update the instance with new values */
+	for (Channel = 0U; Channel < HopPtr->NumChannels; Channel++) {
+		ChannelPtr = &HopPtr->Channels[Channel];
+		Index = ChannelPtr->Block_Id;
+		if ((XRFdc_IsHighSpeedADC(InstancePtr, ChannelPtr->Tile_Id) == 1) &&
+		    (ChannelPtr->Type == XRFDC_ADC_TILE)) {
+			NoOfBlocks = XRFDC_NUM_OF_BLKS2;
+			if (ChannelPtr->Block_Id == XRFDC_BLK_ID1) {
+				Index = XRFDC_BLK_ID2;
+				NoOfBlocks = XRFDC_NUM_OF_BLKS4;
+			}
+		} else {
+			NoOfBlocks = ChannelPtr->Block_Id + 1U;
+		}
+		for (; Index < NoOfBlocks; Index++) {
+			if (ChannelPtr->Type == XRFDC_ADC_TILE) {
+				MixerConfigPtr = &InstancePtr->ADC_Tile[ChannelPtr->Tile_Id]
+							  .ADCBlock_Digital_Datapath[Index]
+							  .Mixer_Settings;
+			} else {
+				MixerConfigPtr = &InstancePtr->DAC_Tile[ChannelPtr->Tile_Id]
+							  .DACBlock_Digital_Datapath[Index]
+							  .Mixer_Settings;
+			}
+			MixerConfigPtr->Freq = ChannelPtr->Freq;
+			MixerConfigPtr->PhaseOffset = ChannelPtr->PhaseOffset;
+		}
+	}
+
+	return XRFDC_SUCCESS;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -55,6 +55,11 @@
 *       cog    01/18/22 Added safety checks.
 *       cog    01/18/22 Add cast in XRFdc_MTS_Dtc_Calc.
 *       cog    01/18/22 Initialize DatapathMode in XRFdc_MTS_Latency.
+* 12.2  kt     10/18/26 Added XRFdc_MultiConverter_Sync_Fast, which scans the
+*                       DTC codes of all the tiles at once, coarse to fine,
+*                       and can verify the codes of a previous sync.
+*       kt     10/18/26 Calculate all the codes of the group scan again after
+*                       a tile is scanned in full.
 *
 * </pre>
 *
@@ -76,6 +81,7 @@
 #define XRFDC_MTS_MIN_GAP_PLL 5U
 #define XRFDC_MTS_SR_TIMEOUT 4096U
 #define XRFDC_MTS_DTC_COUNT 10U
+#define XRFDC_MTS_COARSE_STEP 4U
 #define XRFDC_MTS_MARKER_COUNT 4U
 #define XRFDC_MTS_SRCOUNT_TIMEOUT 1000U
 #define XRFDC_MTS_DELAY_MAX 31U
@@ -99,6 +105,17 @@
 #define XRFDC_MTS_DAC_MARKER_LOC_MASK(X) ((X < XRFDC_GEN3) ? 0x7U : 0xFU)
 #define XRFDC_MTS_RMW(read, mask, data) (((read) & ~(mask)) | ((data) & (mask)))
 #define XRFDC_MTS_FIELD(data, mask, shift) (((data) & (mask)) >> (shift))
+
+/**
+ * DTC scan state of a group of tiles.
+ */
+typedef struct {
+	u32 IsPLL;
+	u16 SRctl[4];
+	u8 Flags[4][XRFDC_MTS_NUM_DTC + 1];
+	u8 Scanned[4][XRFDC_MTS_NUM_DTC];
+} XRFdc_MTS_Dtc_Group;
+
 /************************** Function Prototypes ******************************/
 
 static void XRFdc_MTS_Sysref_TRx(XRFdc *InstancePtr, u32 Enable);
@@ -118,6 +135,12 @@ static void XRFdc_MTS_Marker_Read(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32
 				  u32 *DonePtr);
 static u32 XRFdc_MTS_Latency(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter_Sync_Config *ConfigPtr,
 			     XRFdc_MTS_Marker *MarkersPtr);
+static u32 XRFdc_MTS_Dtc_Is_PLL(XRFdc *InstancePtr, u32 Type, u32 Tile_Id);
+static u32 XRFdc_MTS_Dtc_Probe(XRFdc *InstancePtr, u32 Type, XRFdc_MTS_Dtc_Group *GroupPtr, const int *CodesPtr);
+static u32 XRFdc_MTS_Dtc_Check(XRFdc *InstancePtr, u32 Type, XRFdc_MTS_Dtc_Group *GroupPtr, u32 Tiles,
+			       const int *CodesPtr, int Margin, u32 *FailedPtr);
+static u32 XRFdc_MTS_Dtc_Scan_Group(XRFdc *InstancePtr, u32 Type, u32 Tiles, XRFdc_MTS_DTC_Settings *SettingsPtr);
+static u32 XRFdc_MTS_Sync(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter_Sync_Config *ConfigPtr, u32 Fast);
 
 /*****************************************************************************/
 /**
@@ -629,6 +652,43 @@ static u32 XRFdc_MTS_Dtc_Scan(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, XRFdc_M
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API checks whether the PLL analog sysref capture of a tile needs a DTC
+* scan.
+*
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3.
+*
+* @return
+*         - 1 if the PLL DTC scan is needed.
+*         - 0 otherwise.
+*
+* @note     None.
+*
+******************************************************************************/
+static u32 XRFdc_MTS_Dtc_Is_PLL(XRFdc *InstancePtr, u32 Type, u32 Tile_Id)
+{
+	u32 BaseAddr;
+	u32 NetCtrlReg;
+	u32 DistCtrlReg;
+
+	BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
+	if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
+		NetCtrlReg = XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_MTS_CLKSTAT);
+		return ((NetCtrlReg & XRFDC_MTS_PLLEN_M) != XRFDC_DISABLED) ? 1U : 0U;
+	}
+
+	NetCtrlReg = XRFdc_RDReg(InstancePtr, BaseAddr, XRFDC_CLK_NETWORK_CTRL1,
+				 (XRFDC_NET_CTRL_CLK_T1_SRC_LOCAL | XRFDC_NET_CTRL_CLK_T1_SRC_DIST));
+	DistCtrlReg = XRFdc_RDReg(InstancePtr, BaseAddr, XRFDC_HSCOM_CLK_DSTR_OFFSET, XRFDC_DIST_CTRL_DIST_SRC_PLL);
+
+	return ((NetCtrlReg == XRFDC_DISABLED) || (DistCtrlReg != XRFDC_DISABLED)) ? 1U : 0U;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -652,38 +712,386 @@ static u32 XRFdc_MTS_Dtc_Scan_PLL(XRFdc *InstancePtr, u32 Type, u32 Tile_Id,
 				  XRFdc_MultiConverter_Sync_Config *ConfigPtr)
 {
 	u32 Status;
+
+	Status = XRFDC_MTS_OK;
+	if (XRFdc_MTS_Dtc_Is_PLL(InstancePtr, Type, Tile_Id) != 0U) {
+		/* DTC Scan PLL */
+		if (Tile_Id == ConfigPtr->RefTile) {
+			metal_log(METAL_LOG_INFO, "\nDTC Scan PLL\n");
+		}
+		ConfigPtr->DTC_Set_PLL.RefTile = ConfigPtr->RefTile;
+		Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, Tile_Id, &ConfigPtr->DTC_Set_PLL);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets one DTC code on each tile of a group, waits once for the
+* sysrefs to be captured by all of them, and records their early/late flags.
+*
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    GroupPtr is the group scan state.
+* @param    CodesPtr is the code to set for each tile, -1 to skip a tile.
+*
+* @return
+*         - XRFDC_MTS_OK if successful.
+*         - XRFDC_MTS_TIMEOUT if timeout occurs.
+*
+* @note     None.
+*
+******************************************************************************/
+static u32 XRFdc_MTS_Dtc_Probe(XRFdc *InstancePtr, u32 Type, XRFdc_MTS_Dtc_Group *GroupPtr, const int *CodesPtr)
+{
+	u32 Status;
+	u32 Tile_Id;
 	u32 BaseAddr;
-	u32 NetCtrlReg;
-	u32 DistCtrlReg;
+	u32 SRCtrlAddr;
+	u32 DTCAddr;
+	u16 SRclr_m;
+	u16 Flag_s;
+
+	SRCtrlAddr = (GroupPtr->IsPLL != 0U) ? XRFDC_MTS_SRCAP_PLL : XRFDC_MTS_SRCAP_T1;
+	DTCAddr = (GroupPtr->IsPLL != 0U) ? XRFDC_MTS_SRDTC_PLL : XRFDC_MTS_SRDTC_T1;
+	SRclr_m = (GroupPtr->IsPLL != 0U) ? XRFDC_MTS_SRCLR_PLL_M : XRFDC_MTS_SRCLR_T1_M;
+	Flag_s = (GroupPtr->IsPLL != 0U) ? XRFDC_MTS_SRFLAG_PLL : XRFDC_MTS_SRFLAG_T1;
+
+	for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+		if (CodesPtr[Tile_Id] < 0) {
+			continue;
+		}
+		BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, DTCAddr, CodesPtr[Tile_Id]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, SRCtrlAddr, GroupPtr->SRctl[Tile_Id] | SRclr_m);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, SRCtrlAddr, GroupPtr->SRctl[Tile_Id]);
+	}
+
+	Status = XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_DTC_COUNT);
+
+	for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+		if (CodesPtr[Tile_Id] < 0) {
+			continue;
+		}
+		BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
+		GroupPtr->Flags[Tile_Id][CodesPtr[Tile_Id]] =
+			(XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_MTS_SRFLAG) >> Flag_s) & 0x3U;
+		GroupPtr->Scanned[Tile_Id][CodesPtr[Tile_Id]] = 1U;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks that no edge is flagged within a margin around one code of
+* each tile of a group. The codes of the margin that were not scanned yet are
+* scanned for all the tiles at once.
+*
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    GroupPtr is the group scan state.
+* @param    Tiles is the mask of the tiles to check.
+* @param    CodesPtr is the code to check for each tile.
+* @param    Margin is the number of codes to check on each side.
+* @param    FailedPtr is filled with the mask of the tiles with an edge
+*           within the margin, or with a code out of range.
+*
+* @return
+*         - XRFDC_MTS_OK if successful.
+*         - XRFDC_MTS_TIMEOUT if timeout occurs.
+*
+* @note     None.
+*
+******************************************************************************/
+static u32 XRFdc_MTS_Dtc_Check(XRFdc *InstancePtr, u32 Type, XRFdc_MTS_Dtc_Group *GroupPtr, u32 Tiles,
+			       const int *CodesPtr, int Margin, u32 *FailedPtr)
+{
+	u32 Status;
+	u32 Tile_Id;
+	u32 Probe;
+	int Offset;
+	int Code;
+	int Codes[4];
 
 	Status = XRFDC_MTS_OK;
-	BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
-	if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
-		NetCtrlReg = XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_MTS_CLKSTAT);
-		if ((NetCtrlReg & XRFDC_MTS_PLLEN_M) != XRFDC_DISABLED) {
-			/* DTC Scan PLL */
-			if (Tile_Id == ConfigPtr->RefTile) {
-				metal_log(METAL_LOG_INFO, "\nDTC Scan PLL\n");
+	*FailedPtr = 0U;
+	for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+		if (((Tiles & (1U << Tile_Id)) != 0U) &&
+		    ((CodesPtr[Tile_Id] < 0) || (CodesPtr[Tile_Id] >= (int)XRFDC_MTS_NUM_DTC))) {
+			*FailedPtr |= (1U << Tile_Id);
+		}
+	}
+	Tiles &= ~(*FailedPtr);
+
+	for (Offset = -Margin; (Offset <= Margin) && (Status == XRFDC_MTS_OK); Offset++) {
+		Probe = 0U;
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			Codes[Tile_Id] = -1;
+			Code = CodesPtr[Tile_Id] + Offset;
+			if (((Tiles & (1U << Tile_Id)) != 0U) && (Code >= 0) && (Code < (int)XRFDC_MTS_NUM_DTC) &&
+			    (GroupPtr->Scanned[Tile_Id][Code] == 0U)) {
+				Codes[Tile_Id] = Code;
+				Probe = 1U;
+			}
+		}
+		if (Probe != 0U) {
+			Status |= XRFdc_MTS_Dtc_Probe(InstancePtr, Type, GroupPtr, Codes);
+		}
+	}
+
+	for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+		if ((Tiles & (1U << Tile_Id)) == 0U) {
+			continue;
+		}
+		for (Offset = -Margin; Offset <= Margin; Offset++) {
+			Code = CodesPtr[Tile_Id] + Offset;
+			if ((Code >= 0) && (Code < (int)XRFDC_MTS_NUM_DTC) && (GroupPtr->Flags[Tile_Id][Code] != 0U)) {
+				*FailedPtr |= (1U << Tile_Id);
+				break;
 			}
-			ConfigPtr->DTC_Set_PLL.RefTile = ConfigPtr->RefTile;
-			Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, Tile_Id, &ConfigPtr->DTC_Set_PLL);
 		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API Scans the DTC codes of a group of tiles at once and determine the
+* optimal capture code of each tile, for both PLL and T1 cases.
+*
+* Each step sets one code on every tile of the group and waits once for the
+* sysrefs, instead of once per tile. The codes are first scanned with a
+* coarse step, then the codes around each flagged edge are scanned. The
+* picked codes are checked to have no edge within half the minimum window,
+* the tiles that fail the check are scanned in full and the codes of all the
+* tiles are calculated again, as in the full scan. In the
+* XRFDC_MTS_SCAN_VERIFY mode, the codes in Target are checked first, and
+* only the tiles that fail the check are scanned.
+*
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tiles is the mask of the tiles to scan.
+* @param    SettingsPtr dtc settings structure.
+*
+* @return
+* 		- XRFDC_MTS_OK if successful.
+*           - XRFDC_MTS_TIMEOUT if timeout occurs.
+*           - XRFDC_MTS_DTC_INVALID if no code is found for a tile.
+*
+* @note     The window statistics of a tile are those of the scanned codes.
+*           A tile whose code passes the check of the XRFDC_MTS_SCAN_VERIFY
+*           mode is not scanned, its Num_Windows, Max_Gap, Min_Gap and
+*           Max_Overlap are cleared to 0.
+*
+******************************************************************************/
+static u32 XRFdc_MTS_Dtc_Scan_Group(XRFdc *InstancePtr, u32 Type, u32 Tiles, XRFdc_MTS_DTC_Settings *SettingsPtr)
+{
+	u32 Status;
+	u32 Tile_Id;
+	u32 Index;
+	u32 Pending;
+	u32 Failed = 0U;
+	u32 Scanned_Full;
+	u32 Probe;
+	u32 BaseAddr;
+	u16 SRclr_m;
+	int Margin;
+	int Code;
+	int Codes[4];
+	int Start_Codes[4];
+	XRFdc_MTS_Dtc_Group Group = { 0U };
+
+	Status = XRFDC_MTS_OK;
+	Group.IsPLL = SettingsPtr->IsPLL;
+	SRclr_m = (SettingsPtr->IsPLL != 0U) ? XRFDC_MTS_SRCLR_PLL_M : XRFDC_MTS_SRCLR_T1_M;
+
+	if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
+		Margin = ((SettingsPtr->IsPLL != 0U) ? XRFDC_MTS_MIN_GAP_PLL : XRFDC_MTS_MIN_GAP_T1) / 2;
 	} else {
-		NetCtrlReg = XRFdc_RDReg(InstancePtr, BaseAddr, XRFDC_CLK_NETWORK_CTRL1,
-					 (XRFDC_NET_CTRL_CLK_T1_SRC_LOCAL | XRFDC_NET_CTRL_CLK_T1_SRC_DIST));
-		DistCtrlReg =
-			XRFdc_RDReg(InstancePtr, BaseAddr, XRFDC_HSCOM_CLK_DSTR_OFFSET, XRFDC_DIST_CTRL_DIST_SRC_PLL);
-
-		if ((NetCtrlReg == XRFDC_DISABLED) || (DistCtrlReg != XRFDC_DISABLED)) {
-			/* DTC Scan PLL */
-			if (Tile_Id == ConfigPtr->RefTile) {
-				metal_log(METAL_LOG_INFO, "\nDTC Scan PLL\n");
+		Margin = XRFDC_MTS_MIN_GAP_GEN3 / 2;
+	}
+
+	/*  Enable SysRef Capture and Disable Divide Reset */
+	for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+		if ((Tiles & (1U << Tile_Id)) != 0U) {
+			XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, Tile_Id, SettingsPtr->IsPLL, 1, 0);
+			BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
+			Group.SRctl[Tile_Id] =
+				XRFdc_ReadReg16(InstancePtr, BaseAddr,
+						(SettingsPtr->IsPLL != 0U) ? XRFDC_MTS_SRCAP_PLL : XRFDC_MTS_SRCAP_T1) &
+				~SRclr_m;
+		}
+	}
+
+	/* Check the codes of the previous sync */
+	Pending = Tiles;
+	if (SettingsPtr->Scan_Mode == XRFDC_MTS_SCAN_VERIFY) {
+		Status |= XRFdc_MTS_Dtc_Check(InstancePtr, Type, &Group, Tiles, SettingsPtr->Target, Margin, &Failed);
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			if (((Tiles & ~Failed) & (1U << Tile_Id)) != 0U) {
+				SettingsPtr->DTC_Code[Tile_Id] = SettingsPtr->Target[Tile_Id];
+				/* Not scanned, no window statistics */
+				SettingsPtr->Num_Windows[Tile_Id] = 0;
+				SettingsPtr->Max_Gap[Tile_Id] = 0;
+				SettingsPtr->Min_Gap[Tile_Id] = 0;
+				SettingsPtr->Max_Overlap[Tile_Id] = 0;
 			}
-			ConfigPtr->DTC_Set_PLL.RefTile = ConfigPtr->RefTile;
-			Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, Tile_Id, &ConfigPtr->DTC_Set_PLL);
 		}
+		Pending = Failed;
+		metal_log(METAL_LOG_DEBUG, "Verified %s tiles 0x%x, rescan 0x%x\n",
+			  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tiles & ~Failed, Failed);
+	}
+
+	if ((Pending != 0U) && (Status == XRFDC_MTS_OK)) {
+		/* Coarse scan, always including the last code */
+		for (Index = 0U; (Index < (XRFDC_MTS_NUM_DTC + XRFDC_MTS_COARSE_STEP - 1U)) && (Status == XRFDC_MTS_OK);
+		     Index += XRFDC_MTS_COARSE_STEP) {
+			Code = (Index < XRFDC_MTS_NUM_DTC) ? (int)Index : (int)(XRFDC_MTS_NUM_DTC - 1U);
+			for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+				Codes[Tile_Id] = ((Pending & (1U << Tile_Id)) != 0U) ? Code : -1;
+			}
+			Status |= XRFdc_MTS_Dtc_Probe(InstancePtr, Type, &Group, Codes);
+		}
+
+		/* Fine scan, grow the scanned codes around each flagged code */
+		do {
+			Probe = 0U;
+			for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+				Codes[Tile_Id] = -1;
+				if ((Pending & (1U << Tile_Id)) == 0U) {
+					continue;
+				}
+				for (Code = 0; (Code < (int)XRFDC_MTS_NUM_DTC) && (Codes[Tile_Id] < 0); Code++) {
+					if ((Group.Flags[Tile_Id][Code] == 0U) || (Group.Scanned[Tile_Id][Code] == 0U)) {
+						continue;
+					}
+					for (Index = 1U; Index < XRFDC_MTS_COARSE_STEP; Index++) {
+						if (((Code - (int)Index) >= 0) &&
+						    (Group.Scanned[Tile_Id][Code - Index] == 0U)) {
+							Codes[Tile_Id] = Code - Index;
+							break;
+						}
+						if (((Code + Index) < XRFDC_MTS_NUM_DTC) &&
+						    (Group.Scanned[Tile_Id][Code + Index] == 0U)) {
+							Codes[Tile_Id] = Code + Index;
+							break;
+						}
+					}
+				}
+				if (Codes[Tile_Id] >= 0) {
+					Probe = 1U;
+				}
+			}
+			if (Probe != 0U) {
+				Status |= XRFdc_MTS_Dtc_Probe(InstancePtr, Type, &Group, Codes);
+			}
+		} while ((Probe != 0U) && (Status == XRFDC_MTS_OK));
+
+		/*
+		 * Calculate the best DTC codes in the order of the full scan,
+		 * starting with the reference tile, and check them. The tiles
+		 * that fail the check are scanned in full, then all the codes
+		 * are calculated again, as they depend on the reference code.
+		 */
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			Start_Codes[Tile_Id] = SettingsPtr->DTC_Code[Tile_Id];
+		}
+		Scanned_Full = 0U;
+		do {
+			for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+				if ((Pending & (1U << Tile_Id)) != 0U) {
+					SettingsPtr->DTC_Code[Tile_Id] = Start_Codes[Tile_Id];
+				}
+			}
+			if ((Pending & (1U << SettingsPtr->RefTile)) != 0U) {
+				(void)XRFdc_MTS_Dtc_Calc(InstancePtr, Type, SettingsPtr->RefTile, SettingsPtr,
+							 Group.Flags[SettingsPtr->RefTile]);
+			}
+			for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+				if ((Tile_Id != SettingsPtr->RefTile) && ((Pending & (1U << Tile_Id)) != 0U)) {
+					(void)XRFdc_MTS_Dtc_Calc(InstancePtr, Type, Tile_Id, SettingsPtr,
+								 Group.Flags[Tile_Id]);
+				}
+			}
+
+			/* A code picked from all the flags of a tile is always clear */
+			Failed = 0U;
+			if (Status == XRFDC_MTS_OK) {
+				Status |= XRFdc_MTS_Dtc_Check(InstancePtr, Type, &Group, Pending & ~Scanned_Full,
+							      SettingsPtr->DTC_Code, Margin, &Failed);
+			}
+			if ((Failed != 0U) && (Status == XRFDC_MTS_OK)) {
+				metal_log(METAL_LOG_DEBUG, "Full DTC scan of %s tiles 0x%x\n",
+					  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Failed);
+				for (Index = 0U; (Index < XRFDC_MTS_NUM_DTC) && (Status == XRFDC_MTS_OK); Index++) {
+					Probe = 0U;
+					for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+						Codes[Tile_Id] = -1;
+						if (((Failed & (1U << Tile_Id)) != 0U) &&
+						    (Group.Scanned[Tile_Id][Index] == 0U)) {
+							Codes[Tile_Id] = Index;
+							Probe = 1U;
+						}
+					}
+					if (Probe != 0U) {
+						Status |= XRFdc_MTS_Dtc_Probe(InstancePtr, Type, &Group, Codes);
+					}
+				}
+				Scanned_Full |= Failed;
+			}
+		} while ((Failed != 0U) && (Status == XRFDC_MTS_OK));
+	}
+
+	/* Program the calculated codes */
+	Probe = 0U;
+	for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+		Codes[Tile_Id] = -1;
+		if ((Tiles & (1U << Tile_Id)) == 0U) {
+			continue;
+		}
+		if (SettingsPtr->DTC_Code[Tile_Id] == -1) {
+			metal_log(METAL_LOG_ERROR, "Unable to capture analog SysRef safely on %s tile %d\n",
+				  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id);
+			Status |= XRFDC_MTS_DTC_INVALID;
+		} else {
+			Codes[Tile_Id] = SettingsPtr->DTC_Code[Tile_Id];
+			Probe = 1U;
+		}
+	}
+	if (Probe != 0U) {
+		(void)XRFdc_MTS_Dtc_Probe(InstancePtr, Type, &Group, Codes);
 	}
 
+	if (SettingsPtr->IsPLL != 0U) {
+		/* PLL - Disable SysRef Capture */
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			if ((Tiles & (1U << Tile_Id)) != 0U) {
+				XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, Tile_Id, 1, 0, 0);
+			}
+		}
+	} else {
+		/* T1 - Reset Dividers */
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			if ((Tiles & (1U << Tile_Id)) != 0U) {
+				XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, Tile_Id, 0, 1, 1);
+			}
+		}
+		Status |= XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_DTC_COUNT);
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			if ((Tiles & (1U << Tile_Id)) != 0U) {
+				XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, Tile_Id, 0, 1, 0);
+			}
+		}
+	}
 	return Status;
 }
 
@@ -1208,7 +1616,13 @@ u32 XRFdc_MTS_Sysref_Config(XRFdc *InstancePtr, XRFdc_MultiConverter_Sync_Config
 *       - XRFDC_MTS_OK if successful.
 *       - XRFDC_MTS_BAD_REF_TILE if bad reference tile value is supplied.
 *
-* @note     None.
+* @note     The DTC Scan_Mode is XRFDC_MTS_SCAN_RELOAD when codes are
+*           provided, XRFDC_MTS_SCAN_INIT otherwise. To only check the
+*           provided codes with XRFdc_MultiConverter_Sync_Fast(), set
+*           DTC_Set_PLL.Scan_Mode and DTC_Set_T1.Scan_Mode of the config
+*           structure to XRFDC_MTS_SCAN_VERIFY after this call.
+*           XRFdc_MultiConverter_Sync() scans the XRFDC_MTS_SCAN_VERIFY
+*           mode as the XRFDC_MTS_SCAN_RELOAD mode.
 *
 ******************************************************************************/
 u32 XRFdc_MultiConverter_Init(XRFdc_MultiConverter_Sync_Config *ConfigPtr, int *PLL_CodesPtr, int *T1_CodesPtr,
@@ -1276,6 +1690,75 @@ RETURN_PATH:
 *
 ******************************************************************************/
 u32 XRFdc_MultiConverter_Sync(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter_Sync_Config *ConfigPtr)
+{
+	return XRFdc_MTS_Sync(InstancePtr, Type, ConfigPtr, 0U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the top level API which will be used for Multi-tile
+* Synchronization, scanning the DTC codes of all the tiles at once.
+*
+* The sysref capture DTC codes of all the tiles are set together, so each
+* step waits once for the sysrefs instead of once per tile. The codes are
+* scanned coarse to fine around the sysref edges rather than one by one.
+* If the DTC Scan_Mode is XRFDC_MTS_SCAN_VERIFY, the DTC Target codes are
+* the codes of a previous sync, e.g. DTC_Code saved from the config
+* structure and passed to XRFdc_MultiConverter_Init(), which sets the
+* XRFDC_MTS_SCAN_RELOAD mode: the caller then sets DTC_Set_PLL.Scan_Mode
+* and DTC_Set_T1.Scan_Mode to XRFDC_MTS_SCAN_VERIFY. The Target codes are
+* only checked for a clear capture window, and the tiles that fail the
+* check are scanned again.
+*
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    ConfigPtr Multi-tile sync config structure.
+*
+* @return
+* 		- XRFDC_MTS_OK if successful.
+*           - XRFDC_MTS_TIMEOUT if timeout occurs.
+* 		- XRFDC_MTS_MARKER_RUN
+* 		- XRFDC_MTS_MARKER_MISM
+* 		- XRFDC_MTS_NOT_SUPPORTED if MTS is not supported.
+*
+* @note     Each picked code is checked to have no sysref edge within half
+*           the minimum capture window, and a tile that fails the check is
+*           scanned in full. An edge narrower than the coarse step can be
+*           missed, the picked code is then safe but can differ from the
+*           code picked by XRFdc_MultiConverter_Sync().
+*           The window statistics of a tile whose code is verified are
+*           cleared to 0, as the tile is not scanned.
+*
+******************************************************************************/
+u32 XRFdc_MultiConverter_Sync_Fast(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter_Sync_Config *ConfigPtr)
+{
+	return XRFdc_MTS_Sync(InstancePtr, Type, ConfigPtr, 1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API runs the Multi-tile Synchronization.
+*
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    ConfigPtr Multi-tile sync config structure.
+* @param    Fast selects the group DTC scan, valid values are 0 and 1.
+*
+* @return
+* 		- XRFDC_MTS_OK if successful.
+*           - XRFDC_MTS_TIMEOUT if timeout occurs.
+* 		- XRFDC_MTS_MARKER_RUN
+* 		- XRFDC_MTS_MARKER_MISM
+* 		- XRFDC_MTS_NOT_SUPPORTED if MTS is not supported.
+*
+* @note     None.
+*
+******************************************************************************/
+static u32 XRFdc_MTS_Sync(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter_Sync_Config *ConfigPtr, u32 Fast)
 {
 	u32 Status;
 	u32 Index;
@@ -1285,6 +1768,8 @@ u32 XRFdc_MultiConverter_Sync(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter
 	u32 BaseAddr;
 	u32 TileState;
 	u32 BlockStatus;
+	u32 Tiles;
+	u32 PLL_Tiles;
 
 	Xil_AssertNonvoid(InstancePtr != NULL);
 	Xil_AssertNonvoid(ConfigPtr != NULL);
@@ -1333,27 +1818,46 @@ u32 XRFdc_MultiConverter_Sync(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter
 	/* Update distribution */
 	Status |= XRFdc_MTS_Sysref_Dist(InstancePtr, -1);
 
-	/* Scan DTCs for each tile starting with the reference tile */
-	Status |= XRFdc_MTS_Dtc_Scan_PLL(InstancePtr, Type, ConfigPtr->RefTile, ConfigPtr);
-	for (Index = XRFDC_TILE_ID0; Index < XRFDC_TILE_ID4; Index++) {
-		if (Index == ConfigPtr->RefTile) {
-			continue;
+	if (Fast != 0U) {
+		/* Scan DTCs of all the tiles at once */
+		Tiles = ConfigPtr->Tiles | (1U << ConfigPtr->RefTile);
+		PLL_Tiles = 0U;
+		for (Index = XRFDC_TILE_ID0; Index < XRFDC_TILE_ID4; Index++) {
+			if (((Tiles & (1U << Index)) != 0U) && (XRFdc_MTS_Dtc_Is_PLL(InstancePtr, Type, Index) != 0U)) {
+				PLL_Tiles |= (1U << Index);
+			}
 		}
-		if ((ConfigPtr->Tiles & (1U << Index)) != 0U) {
-			/* Run DTC Scan for PLL */
-			Status |= XRFdc_MTS_Dtc_Scan_PLL(InstancePtr, Type, Index, ConfigPtr);
+		if (PLL_Tiles != 0U) {
+			metal_log(METAL_LOG_INFO, "\nDTC Scan PLL\n");
+			ConfigPtr->DTC_Set_PLL.RefTile = ConfigPtr->RefTile;
+			Status |= XRFdc_MTS_Dtc_Scan_Group(InstancePtr, Type, PLL_Tiles, &ConfigPtr->DTC_Set_PLL);
 		}
-	}
-	/* Scan DTCs for each tile T1 starting with the reference tile */
-	metal_log(METAL_LOG_INFO, "\nDTC Scan T1\n");
-	ConfigPtr->DTC_Set_T1.RefTile = ConfigPtr->RefTile;
-	Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, ConfigPtr->RefTile, &ConfigPtr->DTC_Set_T1);
-	for (Index = XRFDC_TILE_ID0; Index < XRFDC_TILE_ID4; Index++) {
-		if ((ConfigPtr->Tiles & (1U << Index)) != 0U) {
+		metal_log(METAL_LOG_INFO, "\nDTC Scan T1\n");
+		ConfigPtr->DTC_Set_T1.RefTile = ConfigPtr->RefTile;
+		Status |= XRFdc_MTS_Dtc_Scan_Group(InstancePtr, Type, Tiles, &ConfigPtr->DTC_Set_T1);
+	} else {
+		/* Scan DTCs for each tile starting with the reference tile */
+		Status |= XRFdc_MTS_Dtc_Scan_PLL(InstancePtr, Type, ConfigPtr->RefTile, ConfigPtr);
+		for (Index = XRFDC_TILE_ID0; Index < XRFDC_TILE_ID4; Index++) {
 			if (Index == ConfigPtr->RefTile) {
 				continue;
 			}
-			Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, Index, &ConfigPtr->DTC_Set_T1);
+			if ((ConfigPtr->Tiles & (1U << Index)) != 0U) {
+				/* Run DTC Scan for PLL */
+				Status |= XRFdc_MTS_Dtc_Scan_PLL(InstancePtr, Type, Index, ConfigPtr);
+			}
+		}
+		/* Scan DTCs for each tile T1 starting with the reference tile */
+		metal_log(METAL_LOG_INFO, "\nDTC Scan T1\n");
+		ConfigPtr->DTC_Set_T1.RefTile = ConfigPtr->RefTile;
+		Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, ConfigPtr->RefTile, &ConfigPtr->DTC_Set_T1);
+		for (Index = XRFDC_TILE_ID0; Index < XRFDC_TILE_ID4; Index++) {
+			if ((ConfigPtr->Tiles & (1U << Index)) != 0U) {
+				if (Index == ConfigPtr->RefTile) {
+					continue;
+				}
+				Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, Index, &ConfigPtr->DTC_Set_T1);
+			}
 		}
 	}
 
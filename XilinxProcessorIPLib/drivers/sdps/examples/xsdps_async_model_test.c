@@ -0,0 +1,459 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsdps_async_model_test.c
+*
+* Host test of the asynchronous transfer queue against a model of the SDHCI
+* registers and of the card. It is not a target example: it is built and
+* run with the other driver model tests by make -C scripts/host_model.
+*
+* The model executes the ADMA2 descriptor table of each data command, so the
+* test checks:
+* - data integrity through split scatter-gather segments,
+* - in order completion and the queue limits,
+* - the CMD23 and Auto CMD12 sequences, with the data command sent by the
+*   poll that finds CMD23 complete,
+* - CMD12 after a failed multi-block transfer, in both modes,
+* - a request left pending while the data lines are busy,
+* - the rejection of segment lists whose block count sum wraps.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.3   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include <stdlib.h>
+#include "xsdps_core.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define MODEL_BASE	0x10000U	/* Base address of the register model */
+#define MODEL_LATENCY	3		/* Status reads before transfer complete */
+#define MAX_REQ_BLKS	344U		/* Largest request of the test */
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define REG32(Off)	(*(u32 *)&Regs[(Off)])
+#define REG16(Off)	(*(u16 *)&Regs[(Off)])
+
+/************************** Variable Definitions *****************************/
+
+static u8 Regs[256];
+static u8 Card[4U << 20U];
+static XSdPs Sd;
+
+static int InFlight;		/* Data command accepted by the model */
+static int TcCountdown = -1;	/* Status reads left before TC */
+static int InjectError;		/* Next data transfer fails */
+static int DatBusyReads;	/* Present state reads with DAT inhibit */
+static int Cmd23Pending;	/* CMD23 seen since the last data command */
+static u32 Cmd23Arg;
+static u32 PendMode, PendArg, PendCnt, PendSize;
+static u64 PendSar;
+
+static u32 NumCmd23, NumCmd12, NumAutoCmd12, NumData;
+
+/*****************************************************************************/
+/**
+* Executes the ADMA2 table of the data command in flight on the card model.
+*
+******************************************************************************/
+static void ModelDma(void)
+{
+	XSdPs_Adma2Descriptor64 *Desc;
+	u64 Sar = PendSar;
+	u32 Off = PendArg * XSDPS_BLK_SIZE_512_MASK;
+	u32 Total = 0U;
+	u32 Len;
+
+	for (;;) {
+		Desc = (XSdPs_Adma2Descriptor64 *)(UINTPTR)Sar;
+		Len = (Desc->Length != 0U) ? Desc->Length : 65536U;
+		XHOST_CHECK((Desc->Attribute & XSDPS_DESC_VALID) != 0U,
+			    "invalid descriptor");
+		if ((PendMode & XSDPS_TM_DAT_DIR_SEL_MASK) != 0U) {
+			memcpy((void *)(UINTPTR)Desc->Address, &Card[Off], Len);
+		} else {
+			memcpy(&Card[Off], (void *)(UINTPTR)Desc->Address, Len);
+		}
+		Off += Len;
+		Total += Len;
+		if ((Desc->Attribute & XSDPS_DESC_END) != 0U) {
+			break;
+		}
+		Sar += sizeof(XSdPs_Adma2Descriptor64);
+	}
+
+	XHOST_CHECK(Total == (PendCnt * PendSize), "table length %u, command %u",
+		    Total, PendCnt * PendSize);
+}
+
+/*****************************************************************************/
+/**
+* Accepts a command written to the transfer mode and command registers.
+*
+******************************************************************************/
+static void ModelCommand(u32 Value)
+{
+	u32 Cmd = (Value >> 24U) & 0x3FU;
+	u32 Mode = Value & 0xFFFFU;
+
+	REG16(XSDPS_NORM_INTR_STS_OFFSET) |= XSDPS_INTR_CC_MASK;
+
+	if (Cmd == 23U) {
+		Cmd23Arg = REG32(XSDPS_ARGMT_OFFSET);
+		Cmd23Pending = 1;
+		NumCmd23++;
+		return;
+	}
+
+	if (Cmd == 12U) {
+		XHOST_CHECK(InFlight == 0, "CMD12 while the transfer runs");
+		NumCmd12++;
+		return;
+	}
+
+	if ((Value & ((u32)XSDPS_DAT_PRESENT_SEL_MASK << 16U)) == 0U) {
+		return;
+	}
+
+	XHOST_CHECK(InFlight == 0, "data command while a transfer runs");
+	PendMode = Mode;
+	PendArg = REG32(XSDPS_ARGMT_OFFSET);
+	PendCnt = REG16(XSDPS_BLK_CNT_OFFSET);
+	PendSize = REG16(XSDPS_BLK_SIZE_OFFSET) & XSDPS_BLK_SIZE_MASK;
+	PendSar = REG32(XSDPS_ADMA_SAR_OFFSET) |
+		  ((u64)REG32(XSDPS_ADMA_SAR_EXT_OFFSET) << 32U);
+
+	if (PendCnt > 1U) {
+		if (Cmd23Pending != 0) {
+			XHOST_CHECK(Cmd23Arg == PendCnt, "CMD23 %u, blocks %u",
+				    Cmd23Arg, PendCnt);
+			XHOST_CHECK((Mode & XSDPS_TM_AUTO_CMD12_EN_MASK) == 0U,
+				    "CMD23 with Auto CMD12");
+		} else {
+			XHOST_CHECK((Mode & XSDPS_TM_AUTO_CMD12_EN_MASK) != 0U,
+				    "multi-block transfer without stop");
+			NumAutoCmd12++;
+		}
+	}
+
+	Cmd23Pending = 0;
+	NumData++;
+	InFlight = 1;
+	TcCountdown = MODEL_LATENCY;
+}
+
+static void ModelWrite(UINTPTR Addr, u32 Value, int Size)
+{
+	u32 Off = (u32)(Addr - MODEL_BASE);
+
+	if ((Off == XSDPS_NORM_INTR_STS_OFFSET) && (Size == 2)) {
+		REG16(Off) &= (u16)~Value;
+	} else if ((Off == XSDPS_ERR_INTR_STS_OFFSET) && (Size == 2)) {
+		REG16(Off) &= (u16)~Value;
+		if (REG16(Off) == 0U) {
+			REG16(XSDPS_NORM_INTR_STS_OFFSET) &=
+				(u16)~XSDPS_INTR_ERR_MASK;
+		}
+	} else if (Off == XSDPS_SW_RST_OFFSET) {
+		Regs[Off] = 0U;
+		InFlight = 0;
+		TcCountdown = -1;
+	} else if ((Off == XSDPS_XFER_MODE_OFFSET) && (Size == 4)) {
+		REG32(Off) = Value;
+		ModelCommand(Value);
+	} else if (Size == 4) {
+		REG32(Off) = Value;
+	} else if (Size == 2) {
+		REG16(Off) = (u16)Value;
+	} else {
+		Regs[Off] = (u8)Value;
+	}
+}
+
+static u32 ModelRead(UINTPTR Addr, int Size)
+{
+	u32 Off = (u32)(Addr - MODEL_BASE);
+
+	if (Off == XSDPS_PRES_STATE_OFFSET) {
+		if (DatBusyReads > 0) {
+			DatBusyReads--;
+			return XSDPS_PSR_CARD_INSRT_MASK | XSDPS_PSR_INHIBIT_DAT_MASK;
+		}
+		return XSDPS_PSR_CARD_INSRT_MASK;
+	}
+
+	if ((Off == XSDPS_NORM_INTR_STS_OFFSET) && (InFlight != 0) &&
+	    (TcCountdown >= 0) && (TcCountdown-- == 0)) {
+		InFlight = 0;
+		if (InjectError != 0) {
+			InjectError = 0;
+			REG16(XSDPS_NORM_INTR_STS_OFFSET) |= XSDPS_INTR_ERR_MASK;
+			REG16(XSDPS_ERR_INTR_STS_OFFSET) |= XSDPS_INTR_ERR_DCRC_MASK;
+		} else {
+			ModelDma();
+			REG16(XSDPS_NORM_INTR_STS_OFFSET) |= XSDPS_INTR_TC_MASK;
+		}
+	}
+
+	if (Size == 4) {
+		return REG32(Off);
+	}
+	if (Size == 2) {
+		return REG16(Off);
+	}
+	return Regs[Off];
+}
+
+u8 Xil_In8(UINTPTR Addr) { return (u8)ModelRead(Addr, 1); }
+u16 Xil_In16(UINTPTR Addr) { return (u16)ModelRead(Addr, 2); }
+u32 Xil_In32(UINTPTR Addr) { return ModelRead(Addr, 4); }
+void Xil_Out8(UINTPTR Addr, u8 Value) { ModelWrite(Addr, Value, 1); }
+void Xil_Out16(UINTPTR Addr, u16 Value) { ModelWrite(Addr, Value, 2); }
+void Xil_Out32(UINTPTR Addr, u32 Value) { ModelWrite(Addr, Value, 4); }
+
+/*****************************************************************************/
+/**
+* Resets the model and the instance for a card of the given type.
+*
+******************************************************************************/
+static void ModelInit(u8 CardType, u32 Scr)
+{
+	memset(&Sd, 0, sizeof(Sd));
+	memset(Regs, 0, sizeof(Regs));
+	Sd.IsReady = XIL_COMPONENT_IS_READY;
+	Sd.Config.BaseAddress = MODEL_BASE;
+	Sd.Config.IsCacheCoherent = 1U;
+	Sd.HC_Version = XSDPS_HC_SPEC_V3;
+	Sd.CardType = CardType;
+	Sd.SdCardConfig = Scr;
+	REG16(XSDPS_BLK_SIZE_OFFSET) = XSDPS_BLK_SIZE_512_MASK;
+	InFlight = 0;
+	TcCountdown = -1;
+	Cmd23Pending = 0;
+	NumCmd23 = 0U;
+	NumCmd12 = 0U;
+	NumAutoCmd12 = 0U;
+	NumData = 0U;
+}
+
+/*****************************************************************************/
+/**
+* Polls until the queue is empty and records the returned requests.
+*
+******************************************************************************/
+static u32 Drain(XSdPs_AsyncReq **Order)
+{
+	XSdPs_AsyncReq *ReqPtr;
+	u32 Num = 0U;
+	s32 Status;
+
+	while ((Status = XSdPs_AsyncPoll(&Sd, &ReqPtr)) != XST_NO_DATA) {
+		if (Status == XST_SUCCESS) {
+			Order[Num++] = ReqPtr;
+		}
+	}
+
+	return Num;
+}
+
+static u32 ReqBlocks(u32 Index)
+{
+	return (Index == 0U) ? 1U : (64U + (40U * Index));
+}
+
+int main(void)
+{
+	static u8 Src[XSDPS_ASYNC_QUEUE_DEPTH][MAX_REQ_BLKS * 512U];
+	static u8 Dst[XSDPS_ASYNC_QUEUE_DEPTH][MAX_REQ_BLKS * 512U];
+	XSdPs_SgEntry WSg[XSDPS_ASYNC_QUEUE_DEPTH][3];
+	XSdPs_SgEntry RSg[XSDPS_ASYNC_QUEUE_DEPTH][2];
+	XSdPs_AsyncReq W[XSDPS_ASYNC_QUEUE_DEPTH];
+	XSdPs_AsyncReq R[XSDPS_ASYNC_QUEUE_DEPTH];
+	XSdPs_AsyncReq *Order[2U * XSDPS_ASYNC_QUEUE_DEPTH];
+	XSdPs_AsyncReq *ReqPtr;
+	XSdPs_AsyncReq Extra;
+	u32 Index;
+	u32 Blks;
+	u32 Num;
+	u32 Byte;
+
+	/* eMMC: CMD23, writes and reads with different segmentation */
+	ModelInit(XSDPS_CHIP_EMMC, 0U);
+	srand(1);
+	memset(W, 0, sizeof(W));
+	memset(R, 0, sizeof(R));
+	for (Index = 0U; Index < XSDPS_ASYNC_QUEUE_DEPTH; Index++) {
+		Blks = ReqBlocks(Index);
+		for (Byte = 0U; Byte < (Blks * 512U); Byte++) {
+			Src[Index][Byte] = (u8)rand();
+		}
+		if (Blks == 1U) {
+			WSg[Index][0].Buff = Src[Index];
+			WSg[Index][0].BlkCnt = 1U;
+			W[Index].SgCount = 1U;
+			RSg[Index][0].Buff = Dst[Index];
+			RSg[Index][0].BlkCnt = 1U;
+			R[Index].SgCount = 1U;
+		} else {
+			WSg[Index][0].Buff = Src[Index];
+			WSg[Index][0].BlkCnt = 3U;
+			WSg[Index][1].Buff = &Src[Index][3U * 512U];
+			WSg[Index][1].BlkCnt = Blks - 13U;
+			WSg[Index][2].Buff = &Src[Index][(Blks - 10U) * 512U];
+			WSg[Index][2].BlkCnt = 10U;
+			W[Index].SgCount = 3U;
+			RSg[Index][0].Buff = Dst[Index];
+			RSg[Index][0].BlkCnt = Blks / 2U;
+			RSg[Index][1].Buff = &Dst[Index][(Blks / 2U) * 512U];
+			RSg[Index][1].BlkCnt = Blks - (Blks / 2U);
+			R[Index].SgCount = 2U;
+		}
+		W[Index].Arg = Index * 1024U;
+		W[Index].SgList = WSg[Index];
+		W[Index].IsWrite = 1U;
+		R[Index].Arg = Index * 1024U;
+		R[Index].SgList = RSg[Index];
+		XHOST_CHECK(XSdPs_AsyncSubmit(&Sd, &W[Index]) == XST_SUCCESS,
+			    "submit write %u", Index);
+		if (Index == 1U) {
+			XHOST_CHECK(Sd.AsyncQueue.Prepared == 1U,
+				    "next table not prepared");
+		}
+	}
+	Extra = W[0];
+	XHOST_CHECK(XSdPs_AsyncSubmit(&Sd, &Extra) == XST_DEVICE_BUSY,
+		    "full queue accepted a request");
+
+	Num = Drain(Order);
+	XHOST_CHECK(Num == XSDPS_ASYNC_QUEUE_DEPTH, "%u writes returned", Num);
+	for (Index = 0U; Index < Num; Index++) {
+		XHOST_CHECK((Order[Index] == &W[Index]) &&
+			    (W[Index].Status == XST_SUCCESS),
+			    "order or status of write %u", Index);
+	}
+	for (Index = 0U; Index < XSDPS_ASYNC_QUEUE_DEPTH; Index++) {
+		(void)XSdPs_AsyncSubmit(&Sd, &R[Index]);
+	}
+	(void)Drain(Order);
+	for (Index = 0U; Index < XSDPS_ASYNC_QUEUE_DEPTH; Index++) {
+		XHOST_CHECK((R[Index].Status == XST_SUCCESS) &&
+			    (memcmp(Src[Index], Dst[Index],
+				    ReqBlocks(Index) * 512U) == 0),
+			    "data of read %u", Index);
+	}
+	XHOST_CHECK((NumCmd23 == 14U) && (NumAutoCmd12 == 0U),
+		    "eMMC: %u CMD23, %u Auto CMD12", NumCmd23, NumAutoCmd12);
+	XHOST_CHECK(Sd.IsBusy == FALSE, "instance busy after the queue drained");
+
+	/* CMD23 and the data command are sent by separate calls */
+	ModelInit(XSDPS_CHIP_EMMC, 0U);
+	(void)XSdPs_AsyncSubmit(&Sd, &W[3]);
+	XHOST_CHECK((NumCmd23 == 1U) && (NumData == 0U),
+		    "submit sent %u CMD23, %u data commands", NumCmd23, NumData);
+	XHOST_CHECK(XSdPs_AsyncPoll(&Sd, &ReqPtr) == XST_DEVICE_BUSY,
+		    "poll after CMD23 did not report busy");
+	XHOST_CHECK(NumData == 1U, "poll after CMD23 sent %u data commands",
+		    NumData);
+	(void)Drain(Order);
+
+	/* SD card without CMD23 support: Auto CMD12 */
+	ModelInit(XSDPS_CARD_SD, 0U);
+	(void)XSdPs_AsyncSubmit(&Sd, &W[3]);
+	(void)XSdPs_AsyncSubmit(&Sd, &R[3]);
+	(void)Drain(Order);
+	XHOST_CHECK((NumCmd23 == 0U) && (NumAutoCmd12 == 2U),
+		    "SD: %u CMD23, %u Auto CMD12", NumCmd23, NumAutoCmd12);
+	ModelInit(XSDPS_CARD_SD, XSDPS_SCR_CMD23_SUPP);
+	(void)XSdPs_AsyncSubmit(&Sd, &W[3]);
+	(void)Drain(Order);
+	XHOST_CHECK(NumCmd23 == 1U, "SD with CMD23 support: %u CMD23",
+		    NumCmd23);
+
+	/* Error on the second request, stopped by CMD12, the queue goes on */
+	ModelInit(XSDPS_CHIP_EMMC, 0U);
+	(void)XSdPs_AsyncSubmit(&Sd, &W[1]);
+	(void)XSdPs_AsyncSubmit(&Sd, &W[2]);
+	(void)XSdPs_AsyncSubmit(&Sd, &W[3]);
+	while (XSdPs_AsyncPoll(&Sd, &ReqPtr) != XST_SUCCESS) {
+	}
+	InjectError = 1;
+	Num = Drain(Order);
+	XHOST_CHECK((W[2].Status == XST_FAILURE) &&
+		    (W[3].Status == XST_SUCCESS) && (Num == 2U),
+		    "error handling in CMD23 mode");
+	XHOST_CHECK(NumCmd12 == 1U, "CMD23 mode error: %u CMD12", NumCmd12);
+
+	ModelInit(XSDPS_CARD_SD, 0U);
+	(void)XSdPs_AsyncSubmit(&Sd, &W[2]);
+	InjectError = 1;
+	(void)Drain(Order);
+	XHOST_CHECK((W[2].Status == XST_FAILURE) && (NumCmd12 == 1U),
+		    "Auto CMD12 mode error: %u CMD12", NumCmd12);
+
+	ModelInit(XSDPS_CHIP_EMMC, 0U);
+	(void)XSdPs_AsyncSubmit(&Sd, &W[0]);
+	InjectError = 1;
+	(void)Drain(Order);
+	XHOST_CHECK((W[0].Status == XST_FAILURE) && (NumCmd12 == 0U),
+		    "single block error: %u CMD12", NumCmd12);
+
+	/* Busy data lines keep the request pending, polls do not wait */
+	ModelInit(XSDPS_CHIP_EMMC, 0U);
+	DatBusyReads = 2;
+	(void)XSdPs_AsyncSubmit(&Sd, &W[4]);
+	XHOST_CHECK(NumCmd23 == 0U, "command sent while DAT busy");
+	XHOST_CHECK(XSdPs_AsyncPoll(&Sd, &ReqPtr) == XST_DEVICE_BUSY,
+		    "poll while DAT busy");
+	Num = Drain(Order);
+	XHOST_CHECK((Num == 1U) && (W[4].Status == XST_SUCCESS),
+		    "request after DAT busy");
+
+	/* Parameter checks */
+	{
+		XSdPs_SgEntry Sg[XSDPS_ASYNC_DESC_COUNT + 1U];
+		XSdPs_AsyncReq Bad;
+
+		memset(&Bad, 0, sizeof(Bad));
+		for (Index = 0U; Index <= XSDPS_ASYNC_DESC_COUNT; Index++) {
+			Sg[Index].Buff = Src[0];
+			Sg[Index].BlkCnt = 1U;
+		}
+		Bad.SgList = Sg;
+		Bad.SgCount = XSDPS_ASYNC_DESC_COUNT + 1U;
+		XHOST_CHECK(XSdPs_AsyncSubmit(&Sd, &Bad) == XST_INVALID_PARAM,
+			    "too many descriptors accepted");
+		Sg[0].BlkCnt = 0U;
+		Bad.SgCount = 1U;
+		XHOST_CHECK(XSdPs_AsyncSubmit(&Sd, &Bad) == XST_INVALID_PARAM,
+			    "empty segment accepted");
+		Sg[0].BlkCnt = 0xFFFFFFFFU;
+		Sg[1].BlkCnt = 2U;
+		Bad.SgCount = 2U;
+		XHOST_CHECK(XSdPs_AsyncSubmit(&Sd, &Bad) == XST_INVALID_PARAM,
+			    "wrapping block count accepted");
+		Sg[0].BlkCnt = XSDPS_ASYNC_MAX_BLKCNT;
+		Sg[1].BlkCnt = 1U;
+		XHOST_CHECK(XSdPs_AsyncSubmit(&Sd, &Bad) == XST_INVALID_PARAM,
+			    "oversized request accepted");
+		XHOST_CHECK((Sd.IsBusy == FALSE) && (Sd.AsyncQueue.Count == 0U),
+			    "state after a rejected request");
+	}
+
+	return XHostModel_Report("xsdps_async_model_test");
+}
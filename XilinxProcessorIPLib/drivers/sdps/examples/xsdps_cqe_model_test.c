@@ -0,0 +1,505 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsdps_cqe_model_test.c
+*
+* Host test of the eMMC command queuing mode against a model of the SDHCI
+* and CQHCI registers and of the card. It is not a target example: it is
+* built and run with the other driver model tests by
+* make -C scripts/host_model.
+*
+* The model decodes the task descriptor list from raw memory with the CQHCI
+* layout used by the driver, 64-bit task descriptors and 64-bit DMA
+* addressing:
+* - each slot is 24 bytes: the 64-bit task descriptor followed by a 128-bit
+*   link descriptor, Attribute at byte 8, Length at byte 10, the 64-bit
+*   address at byte 12 and 32 reserved bits,
+* - the data descriptors are 128-bit: Attribute, Length, 64-bit address at
+*   byte 4 and 32 reserved bits,
+* - CQCFG selects 64-bit task descriptors.
+*
+* The buffers of the test are linked above 4GB on 64-bit hosts, so the upper
+* address words are exercised. The tasks are executed out of order, with
+* data checks, slot reuse, a response error with recovery, and the
+* fallbacks when the card or the controller does not support queuing.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.3   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include "xsdps_core.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define MODEL_BASE	0x10000U	/* Base address of the register model */
+#define SLOT_SIZE	24U		/* 64-bit task + 128-bit link descriptor */
+#define DESC_SIZE	16U		/* 128-bit data descriptor */
+#define NUM_REQ		40U
+#define MAX_REQ_BLKS	67U
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define REG32(Off)	(*(u32 *)&Regs[(Off)])
+#define REG16(Off)	(*(u16 *)&Regs[(Off)])
+
+/* Little endian fields of the descriptor memory */
+#define MEM16(Addr)	((u16)(((const u8 *)(Addr))[0] | \
+			       ((u16)((const u8 *)(Addr))[1] << 8U)))
+#define MEM32(Addr)	((u32)MEM16(Addr) | ((u32)MEM16((const u8 *)(Addr) + 2) << 16U))
+#define MEM64(Addr)	((u64)MEM32(Addr) | ((u64)MEM32((const u8 *)(Addr) + 4) << 32U))
+
+/* Layout of the driver structures */
+_Static_assert(sizeof(XSdPs_CqeSlot) == SLOT_SIZE, "task descriptor slot");
+_Static_assert(offsetof(XSdPs_CqeSlot, Attribute) == 8U, "link attribute");
+_Static_assert(offsetof(XSdPs_CqeSlot, Length) == 10U, "link length");
+_Static_assert(offsetof(XSdPs_CqeSlot, Address) == 12U, "link address");
+_Static_assert(sizeof(XSdPs_CqeDesc) == DESC_SIZE, "data descriptor");
+_Static_assert(offsetof(XSdPs_CqeDesc, Address) == 4U, "data address");
+
+/************************** Variable Definitions *****************************/
+
+static u8 Regs[0x400];
+static u8 Card[4U << 20U];
+static u8 ExtCsdModel[512];
+static XSdPs Sd;
+static XSdPs_CqeMem Mem __attribute__((aligned(1024)));
+
+static u32 Doorbell;
+static u32 CqVer = 0x510U;
+static int ReadsPerTask = 2;
+static int ReadCount;
+static u32 InjectTaskErr;	/* Task number that gets a response error */
+static u32 NumTasks, NumCmd6En, NumCmd6Dis, NumCmd48, MaxOutstanding;
+static u32 FirstTag;
+
+static u32 Popcount(u32 Value)
+{
+	return (u32)__builtin_popcount(Value);
+}
+
+/*****************************************************************************/
+/**
+* Executes one task picked by the card model: the highest tag first, so that
+* the tasks complete out of order.
+*
+******************************************************************************/
+static void ModelRunTask(void)
+{
+	const u8 *SlotPtr;
+	const u8 *DescPtr;
+	u64 Task;
+	u64 DescAddr;
+	u32 Tag;
+	u32 Blk;
+	u32 Off;
+	u32 Len;
+	u32 Total = 0U;
+	u16 Attr;
+
+	if (((REG32(XSDPS_CQ_CFG_OFFSET) & XSDPS_CQ_CFG_ENABLE_MASK) == 0U) ||
+	    ((REG32(XSDPS_CQ_CTL_OFFSET) & XSDPS_CQ_CTL_HALT_MASK) != 0U) ||
+	    (Doorbell == 0U)) {
+		return;
+	}
+
+	Tag = 31U - (u32)__builtin_clz(Doorbell);
+	SlotPtr = (const u8 *)(UINTPTR)((((u64)REG32(XSDPS_CQ_TDLBAU_OFFSET) << 32U) |
+					 REG32(XSDPS_CQ_TDLBA_OFFSET)) +
+					((u64)Tag * SLOT_SIZE));
+	Task = MEM64(SlotPtr);
+	XHOST_CHECK(((Task & XSDPS_CQ_TD_VALID) != 0U) &&
+		    ((Task & XSDPS_CQ_TD_END) != 0U) &&
+		    (((Task >> 3U) & 0x7U) == 5U),
+		    "task descriptor of slot %u: %llx", Tag,
+		    (unsigned long long)Task);
+	XHOST_CHECK(MEM16(SlotPtr + 8) == (XSDPS_DESC_LINK | XSDPS_DESC_VALID),
+		    "link descriptor attribute of slot %u", Tag);
+	XHOST_CHECK((MEM16(SlotPtr + 10) == 0U) && (MEM32(SlotPtr + 20) == 0U),
+		    "link descriptor length or reserved bits of slot %u", Tag);
+	XHOST_CHECK(MEM64(SlotPtr + 12) == (u64)(UINTPTR)&Mem.Desc[Tag][0],
+		    "link descriptor address of slot %u", Tag);
+
+	Blk = (u32)(Task >> XSDPS_CQ_TD_BLKCNT_SHIFT) & 0xFFFFU;
+	Off = (u32)(Task >> 32U) * XSDPS_BLK_SIZE_512_MASK;
+	Doorbell &= ~(1U << Tag);
+	if (NumTasks == 0U) {
+		FirstTag = Tag;
+	}
+	NumTasks++;
+
+	if (NumTasks == InjectTaskErr) {
+		REG32(XSDPS_CQ_IS_OFFSET) |= XSDPS_CQ_IS_RED_MASK;
+		REG16(XSDPS_NORM_INTR_STS_OFFSET) |= XSDPS_INTR_ERR_MASK;
+		REG16(XSDPS_ERR_INTR_STS_OFFSET) |= XSDPS_INTR_ERR_CCRC_MASK;
+		return;
+	}
+
+	DescAddr = MEM64(SlotPtr + 12);
+	for (;;) {
+		DescPtr = (const u8 *)(UINTPTR)DescAddr;
+		Attr = MEM16(DescPtr);
+		Len = (MEM16(DescPtr + 2) != 0U) ? MEM16(DescPtr + 2) : 65536U;
+		XHOST_CHECK(((Attr & XSDPS_DESC_VALID) != 0U) &&
+			    ((Attr & 0x30U) == XSDPS_DESC_TRAN) &&
+			    (MEM32(DescPtr + 12) == 0U),
+			    "data descriptor of slot %u", Tag);
+		if ((Task & XSDPS_CQ_TD_DATA_DIR_READ) != 0U) {
+			memcpy((void *)(UINTPTR)MEM64(DescPtr + 4), &Card[Off], Len);
+		} else {
+			memcpy(&Card[Off], (const void *)(UINTPTR)MEM64(DescPtr + 4), Len);
+		}
+		Off += Len;
+		Total += Len;
+		if ((Attr & XSDPS_DESC_END) != 0U) {
+			break;
+		}
+		DescAddr += DESC_SIZE;
+	}
+	XHOST_CHECK(Total == (Blk * XSDPS_BLK_SIZE_512_MASK),
+		    "task length %u, %u blocks", Total, Blk);
+
+	REG32(XSDPS_CQ_TCN_OFFSET) |= 1U << Tag;
+	if ((Task & XSDPS_CQ_TD_INT) != 0U) {
+		REG32(XSDPS_CQ_IS_OFFSET) |= XSDPS_CQ_IS_TCC_MASK;
+	}
+}
+
+/*****************************************************************************/
+/**
+* Accepts a legacy command: CMD8 returns the EXT_CSD model, CMD6 switches
+* the queuing mode of the card and CMD48 discards its queue.
+*
+******************************************************************************/
+static void ModelCommand(u32 Value)
+{
+	XSdPs_Adma2Descriptor64 *Desc;
+	u32 Cmd = (Value >> 24U) & 0x3FU;
+	u32 Arg = REG32(XSDPS_ARGMT_OFFSET);
+
+	XHOST_CHECK(((REG32(XSDPS_CQ_CFG_OFFSET) & XSDPS_CQ_CFG_ENABLE_MASK) == 0U) ||
+		    ((REG32(XSDPS_CQ_CTL_OFFSET) & XSDPS_CQ_CTL_HALT_MASK) != 0U),
+		    "legacy CMD%u while queuing", Cmd);
+
+	REG16(XSDPS_NORM_INTR_STS_OFFSET) |= XSDPS_INTR_CC_MASK;
+
+	if (Cmd == 8U) {
+		Desc = (XSdPs_Adma2Descriptor64 *)(UINTPTR)
+		       (REG32(XSDPS_ADMA_SAR_OFFSET) |
+			((u64)REG32(XSDPS_ADMA_SAR_EXT_OFFSET) << 32U));
+		memcpy((void *)(UINTPTR)Desc->Address, ExtCsdModel,
+		       sizeof(ExtCsdModel));
+		REG16(XSDPS_NORM_INTR_STS_OFFSET) |= XSDPS_INTR_TC_MASK;
+	} else if (Cmd == 6U) {
+		if (((Arg >> 16U) & 0xFFU) == EXT_CSD_CMDQ_MODE_EN_BYTE) {
+			if (((Arg >> 8U) & 0xFFU) != 0U) {
+				NumCmd6En++;
+			} else {
+				NumCmd6Dis++;
+			}
+		}
+		REG16(XSDPS_NORM_INTR_STS_OFFSET) |= XSDPS_INTR_TC_MASK;
+	} else if (Cmd == 48U) {
+		XHOST_CHECK(Arg == 1U, "CMD48 argument %x", Arg);
+		NumCmd48++;
+		REG16(XSDPS_NORM_INTR_STS_OFFSET) |= XSDPS_INTR_TC_MASK;
+	}
+}
+
+static void ModelWrite(UINTPTR Addr, u32 Value, int Size)
+{
+	u32 Off = (u32)(Addr - MODEL_BASE);
+	u32 Outstanding;
+
+	if ((Off == XSDPS_NORM_INTR_STS_OFFSET) && (Size == 2)) {
+		REG16(Off) &= (u16)~Value;
+	} else if ((Off == XSDPS_ERR_INTR_STS_OFFSET) && (Size == 2)) {
+		REG16(Off) &= (u16)~Value;
+		if (REG16(Off) == 0U) {
+			REG16(XSDPS_NORM_INTR_STS_OFFSET) &=
+				(u16)~XSDPS_INTR_ERR_MASK;
+		}
+	} else if (Off == XSDPS_SW_RST_OFFSET) {
+		Regs[Off] = 0U;
+	} else if (Off == XSDPS_CQ_TDBR_OFFSET) {
+		XHOST_CHECK((REG32(XSDPS_CQ_CFG_OFFSET) & XSDPS_CQ_CFG_ENABLE_MASK) != 0U,
+			    "doorbell while disabled");
+		XHOST_CHECK((Doorbell & Value) == 0U, "doorbell of a busy slot");
+		Doorbell |= Value;
+		Outstanding = Popcount(Doorbell | REG32(XSDPS_CQ_TCN_OFFSET));
+		if (Outstanding > MaxOutstanding) {
+			MaxOutstanding = Outstanding;
+		}
+	} else if ((Off == XSDPS_CQ_TCN_OFFSET) || (Off == XSDPS_CQ_IS_OFFSET)) {
+		REG32(Off) &= ~Value;
+	} else if (Off == XSDPS_CQ_CTL_OFFSET) {
+		if ((Value & XSDPS_CQ_CTL_CLEAR_ALL_MASK) != 0U) {
+			Doorbell = 0U;
+			Value &= ~XSDPS_CQ_CTL_CLEAR_ALL_MASK;
+		}
+		if ((Value & XSDPS_CQ_CTL_HALT_MASK) != 0U) {
+			REG32(XSDPS_CQ_IS_OFFSET) |= XSDPS_CQ_IS_HAC_MASK;
+		}
+		REG32(Off) = Value;
+	} else if ((Off == XSDPS_XFER_MODE_OFFSET) && (Size == 4)) {
+		REG32(Off) = Value;
+		ModelCommand(Value);
+	} else if (Size == 4) {
+		REG32(Off) = Value;
+	} else if (Size == 2) {
+		REG16(Off) = (u16)Value;
+	} else {
+		Regs[Off] = (u8)Value;
+	}
+}
+
+static u32 ModelRead(UINTPTR Addr, int Size)
+{
+	u32 Off = (u32)(Addr - MODEL_BASE);
+
+	if (Off == XSDPS_PRES_STATE_OFFSET) {
+		return XSDPS_PSR_CARD_INSRT_MASK;
+	}
+	if (Off == XSDPS_CQ_VER_OFFSET) {
+		return CqVer;
+	}
+	if ((Off == XSDPS_CQ_IS_OFFSET) && (++ReadCount >= ReadsPerTask)) {
+		ReadCount = 0;
+		ModelRunTask();
+	}
+
+	if (Size == 4) {
+		return REG32(Off);
+	}
+	if (Size == 2) {
+		return REG16(Off);
+	}
+	return Regs[Off];
+}
+
+u8 Xil_In8(UINTPTR Addr) { return (u8)ModelRead(Addr, 1); }
+u16 Xil_In16(UINTPTR Addr) { return (u16)ModelRead(Addr, 2); }
+u32 Xil_In32(UINTPTR Addr) { return ModelRead(Addr, 4); }
+void Xil_Out8(UINTPTR Addr, u8 Value) { ModelWrite(Addr, Value, 1); }
+void Xil_Out16(UINTPTR Addr, u16 Value) { ModelWrite(Addr, Value, 2); }
+void Xil_Out32(UINTPTR Addr, u32 Value) { ModelWrite(Addr, Value, 4); }
+
+/*****************************************************************************/
+/**
+* Resets the model and the instance. Support and Depth are the command
+* queuing fields of the EXT_CSD model.
+*
+******************************************************************************/
+static void ModelInit(u8 CardType, u8 Support, u8 Depth)
+{
+	memset(&Sd, 0, sizeof(Sd));
+	memset(Regs, 0, sizeof(Regs));
+	Sd.IsReady = XIL_COMPONENT_IS_READY;
+	Sd.Config.BaseAddress = MODEL_BASE;
+	Sd.Config.IsCacheCoherent = 1U;
+	Sd.HC_Version = XSDPS_HC_SPEC_V3;
+	Sd.CardType = CardType;
+	Sd.RelCardAddr = 0x12340000U;
+	REG16(XSDPS_BLK_SIZE_OFFSET) = XSDPS_BLK_SIZE_512_MASK;
+	ExtCsdModel[EXT_CSD_CMDQ_SUPPORT_BYTE] = Support;
+	ExtCsdModel[EXT_CSD_CMDQ_DEPTH_BYTE] = Depth;
+	Doorbell = 0U;
+	NumTasks = 0U;
+	MaxOutstanding = 0U;
+	NumCmd6En = 0U;
+	NumCmd6Dis = 0U;
+	NumCmd48 = 0U;
+}
+
+static u32 ReqBlocks(u32 Index)
+{
+	return 1U + ((Index % 7U) * 11U);
+}
+
+int main(void)
+{
+	static u8 Src[NUM_REQ][MAX_REQ_BLKS * 512U];
+	static u8 Dst[NUM_REQ][MAX_REQ_BLKS * 512U];
+	XSdPs_SgEntry WSg[NUM_REQ][2];
+	XSdPs_SgEntry RSg[NUM_REQ];
+	XSdPs_AsyncReq W[NUM_REQ];
+	XSdPs_AsyncReq R[NUM_REQ];
+	XSdPs_AsyncReq *ReqPtr;
+	u32 Returned = 0U;
+	u32 Failed = 0U;
+	u32 Index;
+	u32 Blks;
+	u32 Byte;
+	s32 Status;
+
+	/* Queuing mode with a 32 deep card */
+	ModelInit(XSDPS_CHIP_EMMC, 1U, 31U);
+	Status = XSdPs_CqeEnable(&Sd, &Mem);
+	XHOST_CHECK((Status == XST_SUCCESS) && (Sd.Cqe.Enabled != 0U) &&
+		    (Sd.Cqe.NumTasks == 32U) && (NumCmd6En == 1U),
+		    "enable: status %d", (int)Status);
+	XHOST_CHECK((REG32(XSDPS_CQ_CFG_OFFSET) & XSDPS_CQ_CFG_TASK_DESC_128_MASK) == 0U,
+		    "128-bit task descriptors selected");
+	XHOST_CHECK((REG32(XSDPS_CQ_TDLBA_OFFSET) == (u32)(UINTPTR)&Mem.Tdl[0]) &&
+		    (REG32(XSDPS_CQ_TDLBAU_OFFSET) ==
+		     (u32)((u64)(UINTPTR)&Mem.Tdl[0] >> 32U)),
+		    "task descriptor list base");
+	XHOST_CHECK(REG32(XSDPS_CQ_SSC2_OFFSET) == 0x1234U, "send status RCA");
+	XHOST_CHECK(XSdPs_ReadPolled(&Sd, 0U, 1U, Dst[0]) != XST_SUCCESS,
+		    "legacy read accepted while queuing");
+
+	srand(2);
+	memset(W, 0, sizeof(W));
+	memset(R, 0, sizeof(R));
+	for (Index = 0U; Index < NUM_REQ; Index++) {
+		Blks = ReqBlocks(Index);
+		for (Byte = 0U; Byte < (Blks * 512U); Byte++) {
+			Src[Index][Byte] = (u8)rand();
+		}
+		WSg[Index][0].Buff = Src[Index];
+		WSg[Index][0].BlkCnt = (Blks + 1U) / 2U;
+		WSg[Index][1].Buff = &Src[Index][WSg[Index][0].BlkCnt * 512U];
+		WSg[Index][1].BlkCnt = Blks - WSg[Index][0].BlkCnt;
+		W[Index].SgList = WSg[Index];
+		W[Index].SgCount = (Blks > 1U) ? 2U : 1U;
+		W[Index].IsWrite = 1U;
+		W[Index].Arg = Index * 128U;
+		RSg[Index].Buff = Dst[Index];
+		RSg[Index].BlkCnt = Blks;
+		R[Index].SgList = &RSg[Index];
+		R[Index].SgCount = 1U;
+		R[Index].Arg = Index * 128U;
+	}
+
+	/* 40 writes into 32 slots: the last ones wait for free slots */
+	for (Index = 0U; Index < NUM_REQ; ) {
+		Status = XSdPs_AsyncSubmit(&Sd, &W[Index]);
+		if (Status == XST_SUCCESS) {
+			Index++;
+			continue;
+		}
+		XHOST_CHECK(Status == XST_DEVICE_BUSY, "submit %u: %d", Index,
+			    (int)Status);
+		if (Status != XST_DEVICE_BUSY) {
+			break;
+		}
+		if (XSdPs_AsyncPoll(&Sd, &ReqPtr) == XST_SUCCESS) {
+			Returned++;
+			XHOST_CHECK(ReqPtr->Status == XST_SUCCESS, "write status");
+		}
+	}
+	while ((Status = XSdPs_AsyncPoll(&Sd, &ReqPtr)) != XST_NO_DATA) {
+		if (Status == XST_SUCCESS) {
+			Returned++;
+			XHOST_CHECK(ReqPtr->Status == XST_SUCCESS, "write status");
+		}
+	}
+	for (Index = 0U; Index < NUM_REQ; Index++) {
+		if (XSdPs_AsyncSubmit(&Sd, &R[Index]) != XST_SUCCESS) {
+			break;
+		}
+	}
+	XHOST_CHECK(Index == 32U, "%u reads queued, expected 32", Index);
+	while (XSdPs_AsyncPoll(&Sd, &ReqPtr) != XST_NO_DATA) {
+	}
+	for (; Index < NUM_REQ; Index++) {
+		(void)XSdPs_AsyncSubmit(&Sd, &R[Index]);
+	}
+	while (XSdPs_AsyncPoll(&Sd, &ReqPtr) != XST_NO_DATA) {
+	}
+	for (Index = 0U; Index < NUM_REQ; Index++) {
+		XHOST_CHECK((R[Index].Status == XST_SUCCESS) &&
+			    (memcmp(Src[Index], Dst[Index],
+				    ReqBlocks(Index) * 512U) == 0),
+			    "data of request %u", Index);
+	}
+	XHOST_CHECK((NumTasks == (2U * NUM_REQ)) && (Returned == NUM_REQ) &&
+		    (MaxOutstanding == 32U) &&
+		    (Sd.AsyncQueue.Completed == (2U * NUM_REQ)),
+		    "%u tasks, %u returned, %u outstanding", NumTasks, Returned,
+		    MaxOutstanding);
+	XHOST_CHECK(FirstTag != 0U, "tasks executed in order");
+
+	/* Too many descriptors for a task */
+	{
+		XSdPs_SgEntry Sg[XSDPS_CQE_DESC_COUNT + 1U];
+		XSdPs_AsyncReq Bad;
+
+		memset(&Bad, 0, sizeof(Bad));
+		for (Index = 0U; Index <= XSDPS_CQE_DESC_COUNT; Index++) {
+			Sg[Index].Buff = Src[0];
+			Sg[Index].BlkCnt = 1U;
+		}
+		Bad.SgList = Sg;
+		Bad.SgCount = XSDPS_CQE_DESC_COUNT + 1U;
+		XHOST_CHECK(XSdPs_AsyncSubmit(&Sd, &Bad) == XST_INVALID_PARAM,
+			    "too many descriptors accepted");
+	}
+
+	/* Response error on the third task: the pending tasks fail */
+	InjectTaskErr = NumTasks + 3U;
+	for (Index = 0U; Index < 6U; Index++) {
+		(void)XSdPs_AsyncSubmit(&Sd, &R[Index]);
+	}
+	Returned = 0U;
+	while ((Status = XSdPs_AsyncPoll(&Sd, &ReqPtr)) != XST_NO_DATA) {
+		if (Status == XST_SUCCESS) {
+			Returned++;
+			if (ReqPtr->Status != XST_SUCCESS) {
+				Failed++;
+			}
+		}
+	}
+	XHOST_CHECK((Returned == 6U) && (Failed == 4U) && (NumCmd48 == 1U) &&
+		    (Doorbell == 0U) && (REG32(XSDPS_CQ_CTL_OFFSET) == 0U),
+		    "error recovery: %u returned, %u failed, %u CMD48",
+		    Returned, Failed, NumCmd48);
+	InjectTaskErr = 0U;
+	XHOST_CHECK(XSdPs_AsyncSubmit(&Sd, &R[1]) == XST_SUCCESS,
+		    "submit after recovery");
+	XHOST_CHECK(XSdPs_CqeDisable(&Sd) == XST_DEVICE_BUSY,
+		    "disabled with a pending task");
+	while (XSdPs_AsyncPoll(&Sd, &ReqPtr) != XST_NO_DATA) {
+	}
+	XHOST_CHECK(R[1].Status == XST_SUCCESS, "task after recovery");
+
+	/* Back to the legacy path */
+	XHOST_CHECK((XSdPs_CqeDisable(&Sd) == XST_SUCCESS) &&
+		    (Sd.Cqe.Enabled == 0U) && (NumCmd6Dis == 1U) &&
+		    (Sd.IsBusy == FALSE) && (REG32(XSDPS_CQ_CFG_OFFSET) == 0U),
+		    "disable");
+
+	/* Fallbacks */
+	ModelInit(XSDPS_CHIP_EMMC, 0U, 31U);
+	XHOST_CHECK((XSdPs_CqeEnable(&Sd, &Mem) == XST_NO_FEATURE) &&
+		    (Sd.Cqe.Enabled == 0U) && (NumCmd6En == 0U),
+		    "card without queuing");
+	ModelInit(XSDPS_CHIP_EMMC, 1U, 7U);
+	CqVer = 0U;
+	XHOST_CHECK(XSdPs_CqeEnable(&Sd, &Mem) == XST_NO_FEATURE,
+		    "controller without queuing");
+	CqVer = 0x510U;
+	ModelInit(XSDPS_CARD_SD, 1U, 7U);
+	XHOST_CHECK(XSdPs_CqeEnable(&Sd, &Mem) == XST_NO_FEATURE, "SD card");
+	ModelInit(XSDPS_CHIP_EMMC, 1U, 7U);
+	XHOST_CHECK((XSdPs_CqeEnable(&Sd, &Mem) == XST_SUCCESS) &&
+		    (Sd.Cqe.NumTasks == 8U), "8 deep card");
+
+	return XHostModel_Report("xsdps_cqe_model_test");
+}
@@ -92,6 +92,8 @@
 *                       for SD/eMMC.
 * 4.2   ro     06/12/23 Added support for system device-tree flow.
 * 4.3   ap     11/29/23 Add support for Sanitize feature.
+*       kt     10/18/26 Initialize the asynchronous transfer queue.
+*       kt     10/18/26 Initialize the command queuing state.
 *
 * </pre>
 *
@@ -187,6 +189,9 @@ s32 XSdPs_CfgInitialize(XSdPs *InstancePtr, XSdPs_Config *ConfigPtr,
 	InstancePtr->IsBusy = FALSE;
 	InstancePtr->BlkSize = 0U;
 	InstancePtr->IsTuningDone = 0U;
+	InstancePtr->SdCardConfig = 0U;
+	(void)memset(&InstancePtr->AsyncQueue, 0, sizeof(XSdPs_AsyncQueue));
+	(void)memset(&InstancePtr->Cqe, 0, sizeof(XSdPs_Cqe));
 
 	/* Host Controller version is read. */
 	InstancePtr->HC_Version =
@@ -101,6 +101,12 @@
 * 4.3   ap     10/11/23 Resolved compilation errors with Microblaze RISC-V
 * 4.3   ap     11/29/23 Add support for Sanitize feature.
 * 4.3   ap     12/22/23 Add support to read custom HS400 tap delay value from design for eMMC.
+* 4.3   kt     10/18/26 Add asynchronous scatter-gather transfer queue with
+*                       double-buffered ADMA2 descriptor tables and CMD23.
+*       kt     10/18/26 Add eMMC command queuing (CQHCI) mode to the
+*                       asynchronous transfer queue.
+*       kt     10/18/26 Track the bus phase of the asynchronous request in
+*                       flight so that polling does not wait.
 *
 * </pre>
 *
@@ -177,6 +183,31 @@ extern "C" {
 
 /** @} */
 
+/** @name Asynchronous transfer queue
+ *
+ * Sizes of the asynchronous transfer queue. Each request uses at most
+ * XSDPS_ASYNC_DESC_COUNT ADMA2 descriptors, one per 64KB of each
+ * scatter-gather segment.
+ * @{
+ */
+#define XSDPS_ASYNC_DESC_COUNT	32U	/**< Descriptors per request */
+#define XSDPS_ASYNC_QUEUE_DEPTH	8U	/**< Pending requests per instance */
+#define XSDPS_ASYNC_MAX_BLKCNT	0xFFFFU	/**< Blocks per request */
+
+#define XSDPS_ASYNC_IDLE	0U	/**< No request on the bus */
+#define XSDPS_ASYNC_CMD23	1U	/**< CMD23 sent, data command next */
+#define XSDPS_ASYNC_DATA	2U	/**< Data command sent */
+/** @} */
+
+/** @name Command queuing
+ *
+ * In command queuing mode each request is a task of the eMMC queuing
+ * engine and uses at most XSDPS_CQE_DESC_COUNT ADMA2 descriptors.
+ * @{
+ */
+#define XSDPS_CQE_DESC_COUNT	8U	/**< Descriptors per task */
+/** @} */
+
 /**************************** Type Definitions *******************************/
 
 /**
@@ -238,6 +269,101 @@ typedef struct {
 }  __attribute__((__packed__))XSdPs_Adma2Descriptor64;
 #endif
 
+/**
+ * Scatter-gather segment of an asynchronous transfer.
+ */
+typedef struct {
+	u8 *Buff;		/**< Segment buffer */
+	u32 BlkCnt;		/**< Number of blocks in the segment */
+} XSdPs_SgEntry;
+
+/**
+ * Asynchronous transfer request. The request is owned by the driver from
+ * XSdPs_AsyncSubmit() until XSdPs_AsyncPoll() returns it.
+ */
+typedef struct {
+	u32 Arg;			/**< Card address of the first block */
+	const XSdPs_SgEntry *SgList;	/**< Scatter-gather segments */
+	u32 SgCount;			/**< Number of segments */
+	u8 IsWrite;			/**< Write if non-zero, read otherwise */
+	u32 BlkCnt;			/**< Total block count, set by submit */
+	s32 Status;			/**< Completion status */
+	void *UserRef;			/**< Caller reference, not used */
+} XSdPs_AsyncReq;
+
+/**
+ * Slot of the command queuing task descriptor list: a 64-bit task
+ * descriptor followed by a 128-bit ADMA2 link descriptor pointing to the
+ * data descriptors of the task.
+ */
+typedef struct {
+	u64 Task;		/**< Task descriptor */
+	u16 Attribute;		/**< Attributes of link descriptor */
+	u16 Length;		/**< Unused, must be 0 */
+	u64 Address;		/**< Address of the data descriptors */
+	u32 Reserved;		/**< Reserved */
+#ifdef __ICCARM__
+} XSdPs_CqeSlot;
+#else
+}  __attribute__((__packed__))XSdPs_CqeSlot;
+#endif
+
+/**
+ * 128-bit ADMA2 data descriptor of the command queuing engine
+ */
+typedef struct {
+	u16 Attribute;		/**< Attributes of descriptor */
+	u16 Length;		/**< Length of current dma transfer */
+	u64 Address;		/**< Address of current dma transfer */
+	u32 Reserved;		/**< Reserved */
+#ifdef __ICCARM__
+} XSdPs_CqeDesc;
+#else
+}  __attribute__((__packed__))XSdPs_CqeDesc;
+#endif
+
+/**
+ * Descriptor memory of the command queuing engine. The user allocates it
+ * 1KB aligned and passes it to XSdPs_CqeEnable().
+ */
+typedef struct {
+	XSdPs_CqeSlot Tdl[XSDPS_CQ_MAX_TASKS];	/**< Task descriptor list */
+	XSdPs_CqeDesc Desc[XSDPS_CQ_MAX_TASKS][XSDPS_CQE_DESC_COUNT];	/**< Data
+						descriptors of each task */
+} XSdPs_CqeMem;
+
+/**
+ * Command queuing state. A task slot is busy from submission until its
+ * request is returned: Pending holds the slots owned by the engine, Done
+ * the completed slots not yet returned by XSdPs_AsyncPoll().
+ */
+typedef struct {
+	XSdPs_CqeMem *MemPtr;	/**< Descriptor memory */
+	XSdPs_AsyncReq *Task[XSDPS_CQ_MAX_TASKS];	/**< Request of each slot */
+	u32 NumTasks;		/**< Slots used, limited by the card queue depth */
+	u32 Pending;		/**< Slots submitted to the engine */
+	u32 Done;		/**< Completed slots */
+	u8 Enabled;		/**< Command queuing mode is active */
+} XSdPs_Cqe;
+
+/**
+ * Asynchronous transfer queue state. The request at Head is on the bus when
+ * Phase is not XSDPS_ASYNC_IDLE, it uses descriptor table ActiveTbl. When
+ * Prepared is set, the table of the next request is already built in the
+ * other table.
+ */
+typedef struct {
+	XSdPs_AsyncReq *Queue[XSDPS_ASYNC_QUEUE_DEPTH];	/**< Pending requests */
+	u32 Head;		/**< Index of the oldest request */
+	u32 Count;		/**< Number of pending requests */
+	u8 Phase;		/**< Bus phase of the oldest request */
+	u8 Cmd23;		/**< Oldest request declared its block count */
+	u8 Prepared;		/**< Next descriptor table is ready */
+	u8 ActiveTbl;		/**< Table used by the request in flight */
+	u32 MaxDepth;		/**< Highest number of pending requests */
+	u32 Completed;		/**< Number of completed requests */
+} XSdPs_AsyncQueue;
+
 /**
  * The XSdPs driver instance data. The user is required to allocate a
  * variable of this type for every SD device in the system. A pointer
@@ -276,6 +402,16 @@ typedef struct {
 #else
 	XSdPs_Adma2Descriptor32 Adma2_DescrTbl32[32] __attribute__ ((aligned(32)));	/**< ADMA descriptor table 32 Bit */
 	XSdPs_Adma2Descriptor64 Adma2_DescrTbl64[32] __attribute__ ((aligned(32)));	/**< ADMA descriptor table 64 Bit */
+#endif
+	XSdPs_AsyncQueue AsyncQueue;	/**< Asynchronous transfer queue */
+	XSdPs_Cqe Cqe;			/**< Command queuing state */
+#ifdef __ICCARM__
+#pragma data_alignment = 32
+	XSdPs_Adma2Descriptor32 Async_DescrTbl32[2][XSDPS_ASYNC_DESC_COUNT];	/**< Async descriptor tables 32 Bit */
+	XSdPs_Adma2Descriptor64 Async_DescrTbl64[2][XSDPS_ASYNC_DESC_COUNT];	/**< Async descriptor tables 64 Bit */
+#else
+	XSdPs_Adma2Descriptor32 Async_DescrTbl32[2][XSDPS_ASYNC_DESC_COUNT] __attribute__ ((aligned(32)));	/**< Async descriptor tables 32 Bit */
+	XSdPs_Adma2Descriptor64 Async_DescrTbl64[2][XSDPS_ASYNC_DESC_COUNT] __attribute__ ((aligned(32)));	/**< Async descriptor tables 64 Bit */
 #endif
 } XSdPs;
 
@@ -341,6 +477,10 @@ s32 XSdPs_StartWriteTransfer(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, u8 *Buff);
 s32 XSdPs_CheckWriteTransfer(XSdPs *InstancePtr);
 s32 XSdPs_Erase(XSdPs *InstancePtr, u32 StartAddr, u32 EndAddr);
 s32 XSdPs_Sanitize(XSdPs *InstancePtr);
+s32 XSdPs_AsyncSubmit(XSdPs *InstancePtr, XSdPs_AsyncReq *ReqPtr);
+s32 XSdPs_AsyncPoll(XSdPs *InstancePtr, XSdPs_AsyncReq **ReqPtr);
+s32 XSdPs_CqeEnable(XSdPs *InstancePtr, XSdPs_CqeMem *MemPtr);
+s32 XSdPs_CqeDisable(XSdPs *InstancePtr);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,661 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsdps_async.c
+* @addtogroup sdps_api SDPS APIs
+* @{
+*
+* The xsdps_async.c file contains the asynchronous transfer queue of the
+* XSdPs driver.
+*
+* Requests are submitted with XSdPs_AsyncSubmit() and returned in order by
+* XSdPs_AsyncPoll(). Each request describes a multi-block read or write as a
+* list of scatter-gather segments, which is translated into one ADMA2
+* descriptor table. Two descriptor tables are used in turn: while a request
+* is on the bus, the table of the next queued request is built and flushed,
+* so starting it on completion only takes the register writes of the
+* commands.
+*
+* When the card supports it, the block count is declared with CMD23
+* (SET_BLOCK_COUNT) before CMD18/CMD25, instead of stopping the transfer
+* with Auto CMD12. The data command is then sent by the poll that finds
+* CMD23 complete, so neither submit nor poll waits for the bus. A failed
+* multi-block transfer is stopped with CMD12 in both modes.
+*
+* When eMMC command queuing is enabled with XSdPs_CqeEnable(), requests are
+* handed to the queuing engine instead (see xsdps_cqe.c) and are returned in
+* completion order.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.3   kt     10/18/26 First release
+*       kt     10/18/26 Route requests to the command queuing engine when it
+*                       is enabled.
+*       kt     10/18/26 Send CMD23 and the data command from separate polls so
+*                       that no call waits on the bus, stop multi-block
+*                       transfers with CMD12 on error and bound the block
+*                       count sum of the segments.
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xsdps_core.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static u32 XSdPs_AsyncIsCmd23Supported(const XSdPs *InstancePtr);
+static u32 XSdPs_AsyncIsBusIdle(const XSdPs *InstancePtr);
+static void XSdPs_AsyncBuildTbl(XSdPs *InstancePtr,
+				const XSdPs_AsyncReq *ReqPtr, u8 Tbl);
+static s32 XSdPs_AsyncSendCmd(XSdPs *InstancePtr, u32 Cmd, u32 Arg,
+			      u32 BlkCnt);
+static s32 XSdPs_AsyncSendData(XSdPs *InstancePtr,
+			       const XSdPs_AsyncReq *ReqPtr);
+static s32 XSdPs_AsyncIssue(XSdPs *InstancePtr, XSdPs_AsyncReq *ReqPtr,
+			    u8 Tbl);
+static void XSdPs_AsyncStartNext(XSdPs *InstancePtr);
+
+/*****************************************************************************/
+/**
+* @brief
+* Checks whether the card accepts CMD23 ahead of multi-block transfers.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+*
+* @return	1 if CMD23 is supported, 0 otherwise.
+*
+******************************************************************************/
+static u32 XSdPs_AsyncIsCmd23Supported(const XSdPs *InstancePtr)
+{
+	u32 Supported;
+
+	if (InstancePtr->CardType == XSDPS_CHIP_EMMC) {
+		Supported = 1U;
+	} else if (InstancePtr->CardType == XSDPS_CARD_SD) {
+		Supported = ((InstancePtr->SdCardConfig &
+			      XSDPS_SCR_CMD23_SUPP) != 0U) ? 1U : 0U;
+	} else {
+		Supported = 0U;
+	}
+
+	return Supported;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Checks without waiting that neither a command nor a data transfer is in
+* progress. A write keeps DAT0 busy after its last block, and so does the
+* CMD12 sent after a failed write.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+*
+* @return	1 if a command can be sent, 0 otherwise.
+*
+******************************************************************************/
+static u32 XSdPs_AsyncIsBusIdle(const XSdPs *InstancePtr)
+{
+	u32 PresentStateReg;
+
+	PresentStateReg = XSdPs_ReadReg(InstancePtr->Config.BaseAddress,
+					XSDPS_PRES_STATE_OFFSET);
+
+	return ((PresentStateReg & (XSDPS_PSR_INHIBIT_CMD_MASK |
+				    XSDPS_PSR_INHIBIT_DAT_MASK)) == 0U) ? 1U : 0U;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Counts the ADMA2 descriptors needed by a request.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	ReqPtr Pointer to the request.
+*
+* @return	Number of descriptors.
+*
+******************************************************************************/
+u32 XSdPs_AsyncDescCount(const XSdPs *InstancePtr,
+			 const XSdPs_AsyncReq *ReqPtr)
+{
+	u32 DescCount = 0U;
+	u32 Length;
+	u32 Index;
+
+	for (Index = 0U; Index < ReqPtr->SgCount; Index++) {
+		Length = ReqPtr->SgList[Index].BlkCnt * InstancePtr->BlkSize;
+		DescCount += (Length + XSDPS_DESC_MAX_LENGTH - 1U) /
+			     XSDPS_DESC_MAX_LENGTH;
+	}
+
+	return DescCount;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Builds the ADMA2 descriptor table of a request and performs the cache
+* maintenance of its buffers.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	ReqPtr Pointer to the request.
+* @param	Tbl Index of the descriptor table to be built.
+*
+* @return	None
+*
+******************************************************************************/
+static void XSdPs_AsyncBuildTbl(XSdPs *InstancePtr,
+				const XSdPs_AsyncReq *ReqPtr, u8 Tbl)
+{
+	const XSdPs_SgEntry *SgPtr;
+	UINTPTR Addr;
+	u32 Remaining;
+	u32 Length;
+	u32 DescNum = 0U;
+	u32 Index;
+
+	for (Index = 0U; Index < ReqPtr->SgCount; Index++) {
+		SgPtr = &ReqPtr->SgList[Index];
+		Addr = (UINTPTR)SgPtr->Buff;
+		Remaining = SgPtr->BlkCnt * InstancePtr->BlkSize;
+
+		if (InstancePtr->Config.IsCacheCoherent == 0U) {
+			if (ReqPtr->IsWrite != 0U) {
+				Xil_DCacheFlushRange((INTPTR)Addr, (INTPTR)Remaining);
+			} else {
+				Xil_DCacheInvalidateRange((INTPTR)Addr, (INTPTR)Remaining);
+			}
+		}
+
+		while (Remaining != 0U) {
+			Length = (Remaining > XSDPS_DESC_MAX_LENGTH) ?
+				 XSDPS_DESC_MAX_LENGTH : Remaining;
+
+			/* A length field of 0 stands for 64KB */
+			if (InstancePtr->HC_Version == XSDPS_HC_SPEC_V3) {
+				InstancePtr->Async_DescrTbl64[Tbl][DescNum].Address = (u64)Addr;
+				InstancePtr->Async_DescrTbl64[Tbl][DescNum].Length = (u16)Length;
+				InstancePtr->Async_DescrTbl64[Tbl][DescNum].Attribute =
+					XSDPS_DESC_TRAN | XSDPS_DESC_VALID;
+			} else {
+				InstancePtr->Async_DescrTbl32[Tbl][DescNum].Address = (u32)Addr;
+				InstancePtr->Async_DescrTbl32[Tbl][DescNum].Length = (u16)Length;
+				InstancePtr->Async_DescrTbl32[Tbl][DescNum].Attribute =
+					XSDPS_DESC_TRAN | XSDPS_DESC_VALID;
+			}
+
+			Addr += Length;
+			Remaining -= Length;
+			DescNum++;
+		}
+	}
+
+	if (InstancePtr->HC_Version == XSDPS_HC_SPEC_V3) {
+		InstancePtr->Async_DescrTbl64[Tbl][DescNum - 1U].Attribute |=
+			XSDPS_DESC_END;
+		if (InstancePtr->Config.IsCacheCoherent == 0U) {
+			Xil_DCacheFlushRange((INTPTR)&InstancePtr->Async_DescrTbl64[Tbl][0],
+					     (INTPTR)sizeof(XSdPs_Adma2Descriptor64) *
+					     (INTPTR)DescNum);
+		}
+	} else {
+		InstancePtr->Async_DescrTbl32[Tbl][DescNum - 1U].Attribute |=
+			XSDPS_DESC_END;
+		if (InstancePtr->Config.IsCacheCoherent == 0U) {
+			Xil_DCacheFlushRange((INTPTR)&InstancePtr->Async_DescrTbl32[Tbl][0],
+					     (INTPTR)sizeof(XSdPs_Adma2Descriptor32) *
+					     (INTPTR)DescNum);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Writes a command without waiting for its response. The caller has checked
+* that the bus is idle.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	Cmd Command to be sent.
+* @param	Arg Argument of the command.
+* @param	BlkCnt Block count of the command.
+*
+* @return
+* 		- XST_SUCCESS if the command is sent
+* 		- XST_FAILURE if the command could not be sent
+*
+******************************************************************************/
+static s32 XSdPs_AsyncSendCmd(XSdPs *InstancePtr, u32 Cmd, u32 Arg,
+			      u32 BlkCnt)
+{
+	s32 Status;
+
+	Status = XSdPs_SetupCmd(InstancePtr, Arg, BlkCnt);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_SendCmd(InstancePtr, Cmd);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+	}
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Sends the read or write command of a request, after CMD23 when the block
+* count has been declared.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	ReqPtr Pointer to the request.
+*
+* @return
+* 		- XST_SUCCESS if the command is sent
+* 		- XST_FAILURE if the command could not be sent
+*
+******************************************************************************/
+static s32 XSdPs_AsyncSendData(XSdPs *InstancePtr,
+			       const XSdPs_AsyncReq *ReqPtr)
+{
+	XSdPs_AsyncQueue *QueuePtr = &InstancePtr->AsyncQueue;
+	u32 Cmd;
+	s32 Status;
+
+	if (ReqPtr->BlkCnt == 1U) {
+		InstancePtr->TransferMode = XSDPS_TM_BLK_CNT_EN_MASK |
+					    XSDPS_TM_DMA_EN_MASK;
+		Cmd = (ReqPtr->IsWrite != 0U) ? CMD24 : CMD17;
+	} else {
+		if (QueuePtr->Cmd23 != 0U) {
+			/* Block count declared, no stop command needed */
+			InstancePtr->TransferMode = XSDPS_TM_BLK_CNT_EN_MASK |
+						    XSDPS_TM_MUL_SIN_BLK_SEL_MASK |
+						    XSDPS_TM_DMA_EN_MASK;
+		} else {
+			InstancePtr->TransferMode = XSDPS_TM_AUTO_CMD12_EN_MASK |
+						    XSDPS_TM_BLK_CNT_EN_MASK |
+						    XSDPS_TM_MUL_SIN_BLK_SEL_MASK |
+						    XSDPS_TM_DMA_EN_MASK;
+		}
+		Cmd = (ReqPtr->IsWrite != 0U) ? CMD25 : CMD18;
+	}
+
+	if (ReqPtr->IsWrite == 0U) {
+		InstancePtr->TransferMode |= XSDPS_TM_DAT_DIR_SEL_MASK;
+	}
+
+	Status = XSdPs_AsyncSendCmd(InstancePtr, Cmd, ReqPtr->Arg,
+				    ReqPtr->BlkCnt);
+	if (Status == XST_SUCCESS) {
+		QueuePtr->Phase = XSDPS_ASYNC_DATA;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Points the ADMA2 engine to a built descriptor table and sends the first
+* command of a request: CMD23 when the card supports it for a multi-block
+* transfer, the data command otherwise. The function does not wait for the
+* response, XSdPs_AsyncPoll() follows the request from its Phase.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	ReqPtr Pointer to the request.
+* @param	Tbl Index of the descriptor table of the request.
+*
+* @return
+* 		- XST_SUCCESS if the transfer is started
+* 		- XST_FAILURE if the command could not be sent
+*
+******************************************************************************/
+static s32 XSdPs_AsyncIssue(XSdPs *InstancePtr, XSdPs_AsyncReq *ReqPtr,
+			    u8 Tbl)
+{
+	XSdPs_AsyncQueue *QueuePtr = &InstancePtr->AsyncQueue;
+	s32 Status;
+
+	if (InstancePtr->HC_Version == XSDPS_HC_SPEC_V3) {
+#if defined(__aarch64__) || defined(__arch64__)
+		XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_ADMA_SAR_EXT_OFFSET,
+			       (u32)((UINTPTR)&InstancePtr->Async_DescrTbl64[Tbl][0] >> 32U));
+#endif
+		XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_ADMA_SAR_OFFSET,
+			       (u32)((UINTPTR)&InstancePtr->Async_DescrTbl64[Tbl][0]));
+	} else {
+		XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_ADMA_SAR_OFFSET,
+			       (u32)((UINTPTR)&InstancePtr->Async_DescrTbl32[Tbl][0]));
+	}
+
+	QueuePtr->Cmd23 = ((ReqPtr->BlkCnt > 1U) &&
+			   (XSdPs_AsyncIsCmd23Supported(InstancePtr) != 0U)) ?
+			  1U : 0U;
+
+	if (QueuePtr->Cmd23 != 0U) {
+		InstancePtr->TransferMode = 0U;
+		Status = XSdPs_AsyncSendCmd(InstancePtr, CMD23, ReqPtr->BlkCnt, 0U);
+		if (Status == XST_SUCCESS) {
+			QueuePtr->Phase = XSDPS_ASYNC_CMD23;
+		}
+	} else {
+		Status = XSdPs_AsyncSendData(InstancePtr, ReqPtr);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Starts the oldest pending request if the bus is free, and builds the
+* descriptor table of the request following the one in flight. When the bus
+* is still busy, the request stays pending and the next poll retries.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+*
+* @return	None
+*
+******************************************************************************/
+static void XSdPs_AsyncStartNext(XSdPs *InstancePtr)
+{
+	XSdPs_AsyncQueue *QueuePtr = &InstancePtr->AsyncQueue;
+	XSdPs_AsyncReq *ReqPtr;
+	u32 Next;
+
+	ReqPtr = QueuePtr->Queue[QueuePtr->Head];
+	if ((QueuePtr->Count != 0U) && (QueuePtr->Phase == XSDPS_ASYNC_IDLE) &&
+	    (ReqPtr->Status == XST_DEVICE_BUSY) &&
+	    (XSdPs_AsyncIsBusIdle(InstancePtr) != 0U)) {
+		if (QueuePtr->Prepared != 0U) {
+			QueuePtr->ActiveTbl ^= 1U;
+			QueuePtr->Prepared = 0U;
+		} else {
+			XSdPs_AsyncBuildTbl(InstancePtr, ReqPtr, QueuePtr->ActiveTbl);
+		}
+
+		if (XSdPs_AsyncIssue(InstancePtr, ReqPtr,
+				     QueuePtr->ActiveTbl) != XST_SUCCESS) {
+			/* Returned with its error by the next poll */
+			ReqPtr->Status = XST_FAILURE;
+		}
+	}
+
+	if ((QueuePtr->Phase != XSDPS_ASYNC_IDLE) && (QueuePtr->Count > 1U) &&
+	    (QueuePtr->Prepared == 0U)) {
+		Next = (QueuePtr->Head + 1U) % XSDPS_ASYNC_QUEUE_DEPTH;
+		XSdPs_AsyncBuildTbl(InstancePtr, QueuePtr->Queue[Next],
+				    QueuePtr->ActiveTbl ^ 1U);
+		QueuePtr->Prepared = 1U;
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Queues an asynchronous multi-block read or write. The transfer is started
+* immediately when the bus is free, otherwise it starts when the previous
+* requests are completed by XSdPs_AsyncPoll().
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	ReqPtr Pointer to the request. Arg, SgList, SgCount and IsWrite
+* 		must be set; the request and its segments must stay valid
+* 		until the request is returned by XSdPs_AsyncPoll().
+*
+* @return
+* 		- XST_SUCCESS if the request is queued
+* 		- XST_INVALID_PARAM if the scatter-gather list is empty, has an
+* 		empty segment or needs more than XSDPS_ASYNC_DESC_COUNT
+* 		descriptors or XSDPS_ASYNC_MAX_BLKCNT blocks
+* 		- XST_DEVICE_BUSY if the queue is full or a transfer started
+* 		by XSdPs_StartReadTransfer/XSdPs_StartWriteTransfer is pending
+* 		- XST_INVALID_PARAM in command queuing mode if the request
+* 		needs more than XSDPS_CQE_DESC_COUNT descriptors
+* 		- XST_FAILURE if the card is not present or the block size
+* 		could not be set
+*
+* @note		Segment buffers must meet the ADMA2 alignment of the
+* 		controller and, when the data cache is enabled, be cache line
+* 		aligned.
+*
+******************************************************************************/
+s32 XSdPs_AsyncSubmit(XSdPs *InstancePtr, XSdPs_AsyncReq *ReqPtr)
+{
+	XSdPs_AsyncQueue *QueuePtr;
+	u32 BlkCnt = 0U;
+	u32 Index;
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(ReqPtr != NULL);
+
+	QueuePtr = &InstancePtr->AsyncQueue;
+
+	if ((ReqPtr->SgList == NULL) || (ReqPtr->SgCount == 0U)) {
+		Status = XST_INVALID_PARAM;
+		goto RETURN_PATH;
+	}
+
+	for (Index = 0U; Index < ReqPtr->SgCount; Index++) {
+		/* Checked against the room left so that the sum cannot wrap */
+		if ((ReqPtr->SgList[Index].BlkCnt == 0U) ||
+		    (ReqPtr->SgList[Index].BlkCnt >
+		     (XSDPS_ASYNC_MAX_BLKCNT - BlkCnt))) {
+			Status = XST_INVALID_PARAM;
+			goto RETURN_PATH;
+		}
+		BlkCnt += ReqPtr->SgList[Index].BlkCnt;
+	}
+
+	if (InstancePtr->Cqe.Enabled != 0U) {
+		ReqPtr->BlkCnt = BlkCnt;
+		Status = XSdPs_CqeSubmit(InstancePtr, ReqPtr);
+		goto RETURN_PATH;
+	}
+
+	if (((InstancePtr->IsBusy == TRUE) && (QueuePtr->Count == 0U)) ||
+	    (QueuePtr->Count == XSDPS_ASYNC_QUEUE_DEPTH)) {
+		Status = XST_DEVICE_BUSY;
+		goto RETURN_PATH;
+	}
+
+	if (QueuePtr->Count == 0U) {
+#if defined  (XCLOCKING)
+		Xil_ClockEnable(InstancePtr->Config.RefClk);
+#endif
+		Status = XSdPs_SetupTransfer(InstancePtr);
+		if (Status != XST_SUCCESS) {
+#if defined  (XCLOCKING)
+			Xil_ClockDisable(InstancePtr->Config.RefClk);
+#endif
+			Status = XST_FAILURE;
+			goto RETURN_PATH;
+		}
+		InstancePtr->BlkSize = (u32)XSdPs_ReadReg16(InstancePtr->Config.BaseAddress,
+							    XSDPS_BLK_SIZE_OFFSET) &
+				       XSDPS_BLK_SIZE_MASK;
+		InstancePtr->IsBusy = TRUE;
+	}
+
+	if (XSdPs_AsyncDescCount(InstancePtr, ReqPtr) > XSDPS_ASYNC_DESC_COUNT) {
+		Status = XST_INVALID_PARAM;
+		if (QueuePtr->Count == 0U) {
+#if defined  (XCLOCKING)
+			Xil_ClockDisable(InstancePtr->Config.RefClk);
+#endif
+			InstancePtr->IsBusy = FALSE;
+		}
+		goto RETURN_PATH;
+	}
+
+	ReqPtr->BlkCnt = BlkCnt;
+	ReqPtr->Status = XST_DEVICE_BUSY;
+
+	QueuePtr->Queue[(QueuePtr->Head + QueuePtr->Count) %
+			XSDPS_ASYNC_QUEUE_DEPTH] = ReqPtr;
+	QueuePtr->Count++;
+	if (QueuePtr->Count > QueuePtr->MaxDepth) {
+		QueuePtr->MaxDepth = QueuePtr->Count;
+	}
+
+	XSdPs_AsyncStartNext(InstancePtr);
+
+	Status = XST_SUCCESS;
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Checks the request in flight without blocking. When CMD23 of the request
+* is complete, its data command is sent. When the request is complete, the
+* next pending request is started and the completed one is returned.
+* Requests are returned in submission order, or in completion order in
+* command queuing mode.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	ReqPtr Pointer to a location to store the completed request.
+* 		The Status of the request is XST_SUCCESS or XST_FAILURE.
+*
+* @return
+* 		- XST_SUCCESS if a request is returned
+* 		- XST_DEVICE_BUSY if the request in flight is not complete
+* 		- XST_NO_DATA if no request is pending
+*
+* @note		On a transfer error the command and data lines are reset and
+* 		a multi-block transfer is stopped with CMD12, this recovery
+* 		waits for the CMD12 response.
+*
+******************************************************************************/
+s32 XSdPs_AsyncPoll(XSdPs *InstancePtr, XSdPs_AsyncReq **ReqPtr)
+{
+	XSdPs_AsyncQueue *QueuePtr;
+	XSdPs_AsyncReq *DonePtr;
+	u16 StatusReg;
+	u32 Index;
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(ReqPtr != NULL);
+
+	if (InstancePtr->Cqe.Enabled != 0U) {
+		Status = XSdPs_CqePoll(InstancePtr, ReqPtr);
+		goto RETURN_PATH;
+	}
+
+	QueuePtr = &InstancePtr->AsyncQueue;
+
+	if (QueuePtr->Count == 0U) {
+		Status = XST_NO_DATA;
+		goto RETURN_PATH;
+	}
+
+	DonePtr = QueuePtr->Queue[QueuePtr->Head];
+
+	if (QueuePtr->Phase != XSDPS_ASYNC_IDLE) {
+		StatusReg = XSdPs_ReadReg16(InstancePtr->Config.BaseAddress,
+					    XSDPS_NORM_INTR_STS_OFFSET);
+		if ((StatusReg & XSDPS_INTR_ERR_MASK) != 0U) {
+			/* Write to clear error bits */
+			XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+					 XSDPS_ERR_INTR_STS_OFFSET,
+					 XSDPS_ERROR_INTR_ALL_MASK);
+			(void)XSdPs_Reset(InstancePtr, XSDPS_SWRST_CMD_LINE_MASK |
+					  XSDPS_SWRST_DAT_LINE_MASK);
+			/*
+			 * The card stays in the data state after a failed
+			 * multi-block transfer, CMD23 and Auto CMD12 alike.
+			 */
+			if ((QueuePtr->Phase == XSDPS_ASYNC_DATA) &&
+			    (DonePtr->BlkCnt > 1U)) {
+				InstancePtr->TransferMode = 0U;
+				(void)XSdPs_CmdTransfer(InstancePtr, CMD12, 0U, 0U);
+			}
+			DonePtr->Status = XST_FAILURE;
+		} else if (QueuePtr->Phase == XSDPS_ASYNC_CMD23) {
+			if ((StatusReg & XSDPS_INTR_CC_MASK) == 0U) {
+				Status = XST_DEVICE_BUSY;
+				goto RETURN_PATH;
+			}
+			/* Write to clear bit */
+			XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+					 XSDPS_NORM_INTR_STS_OFFSET,
+					 XSDPS_INTR_CC_MASK);
+			if (XSdPs_AsyncSendData(InstancePtr, DonePtr) == XST_SUCCESS) {
+				Status = XST_DEVICE_BUSY;
+				goto RETURN_PATH;
+			}
+			DonePtr->Status = XST_FAILURE;
+		} else if ((StatusReg & XSDPS_INTR_TC_MASK) != 0U) {
+			/* Write to clear bits */
+			XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+					 XSDPS_NORM_INTR_STS_OFFSET,
+					 XSDPS_INTR_TC_MASK | XSDPS_INTR_CC_MASK);
+			DonePtr->Status = XST_SUCCESS;
+		} else {
+			Status = XST_DEVICE_BUSY;
+			goto RETURN_PATH;
+		}
+		QueuePtr->Phase = XSDPS_ASYNC_IDLE;
+	} else if (DonePtr->Status == XST_DEVICE_BUSY) {
+		/* Not started yet, the bus was busy */
+		XSdPs_AsyncStartNext(InstancePtr);
+		if (DonePtr->Status == XST_DEVICE_BUSY) {
+			Status = XST_DEVICE_BUSY;
+			goto RETURN_PATH;
+		}
+	}
+
+	if ((DonePtr->Status == XST_SUCCESS) && (DonePtr->IsWrite == 0U) &&
+	    (InstancePtr->Config.IsCacheCoherent == 0U)) {
+		for (Index = 0U; Index < DonePtr->SgCount; Index++) {
+			Xil_DCacheInvalidateRange((INTPTR)DonePtr->SgList[Index].Buff,
+						  (INTPTR)DonePtr->SgList[Index].BlkCnt *
+						  (INTPTR)InstancePtr->BlkSize);
+		}
+	}
+
+	QueuePtr->Head = (QueuePtr->Head + 1U) % XSDPS_ASYNC_QUEUE_DEPTH;
+	QueuePtr->Count--;
+	QueuePtr->Completed++;
+
+	if (QueuePtr->Count == 0U) {
+		InstancePtr->IsBusy = FALSE;
+#if defined  (XCLOCKING)
+		Xil_ClockDisable(InstancePtr->Config.RefClk);
+#endif
+	} else {
+		XSdPs_AsyncStartNext(InstancePtr);
+	}
+
+	*ReqPtr = DonePtr;
+	Status = XST_SUCCESS;
+
+RETURN_PATH:
+	return Status;
+}
+/** @} */
@@ -28,6 +28,7 @@
 * 4.0   sk     02/25/22 Add support for eMMC5.1.
 * 4.1   sa     01/06/23 Include xil_util.h in this file.
 * 4.2   ap     08/09/23 Add XSdPs_SetTapDelay APIs.
+* 4.3   kt     10/18/26 Add command queuing internal APIs.
 * </pre>
 *
 ******************************************************************************/
@@ -115,6 +116,9 @@ void XSdPs_SetTapDelay_SDR104(XSdPs *InstancePtr);
 void XSdPs_SetTapDelay_SDR50(XSdPs *InstancePtr);
 void XSdPs_SetTapDelay_DDR50(XSdPs *InstancePtr);
 void XSdPs_SetTapDelay_SDR25(XSdPs *InstancePtr);
+u32 XSdPs_AsyncDescCount(const XSdPs *InstancePtr, const XSdPs_AsyncReq *ReqPtr);
+s32 XSdPs_CqeSubmit(XSdPs *InstancePtr, XSdPs_AsyncReq *ReqPtr);
+s32 XSdPs_CqePoll(XSdPs *InstancePtr, XSdPs_AsyncReq **ReqPtr);
 #ifdef VERSAL_NET
 u32 XSdPs_Select_HS400(XSdPs *InstancePtr);
 #endif
@@ -0,0 +1,593 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsdps_cqe.c
+* @addtogroup sdps_api SDPS APIs
+* @{
+*
+* The xsdps_cqe.c file contains the eMMC command queuing (CQHCI) mode of the
+* XSdPs driver.
+*
+* XSdPs_CqeEnable() switches the card and the controller to command queuing
+* when both support it. Requests of XSdPs_AsyncSubmit() then become tasks of
+* the queuing engine: each one gets a slot of the task descriptor list, with
+* its own ADMA2 data descriptors, and is started by ringing the doorbell of
+* the slot. The engine queues the tasks on the card (CMD44/CMD45), polls the
+* card queue status and executes the tasks in the order chosen by the card.
+* XSdPs_AsyncPoll() collects completed tasks from the task completion
+* notification register.
+*
+* When the card or the controller has no command queuing support,
+* XSdPs_CqeEnable() returns XST_NO_FEATURE and the requests keep using the
+* one command at a time path of xsdps_async.c.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.3   kt     10/18/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xsdps_core.h"
+
+/************************** Constant Definitions *****************************/
+#define XSDPS_CQE_HALT_TIMEOUT	1000000U	/**< Halt and clear timeout */
+#define XSDPS_CQE_DISCARD_QUEUE	1U	/**< CMD48 discard entire queue */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static void XSdPs_CqeBuildTask(XSdPs *InstancePtr,
+			       const XSdPs_AsyncReq *ReqPtr, u32 Tag);
+static s32 XSdPs_CqeHalt(XSdPs *InstancePtr);
+static void XSdPs_CqeRecover(XSdPs *InstancePtr);
+
+/*****************************************************************************/
+/**
+* @brief
+* Builds the task descriptor and the data descriptors of a request in its
+* slot and performs the cache maintenance of its buffers.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	ReqPtr Pointer to the request.
+* @param	Tag Task slot of the request.
+*
+* @return	None
+*
+******************************************************************************/
+static void XSdPs_CqeBuildTask(XSdPs *InstancePtr,
+			       const XSdPs_AsyncReq *ReqPtr, u32 Tag)
+{
+	XSdPs_CqeMem *MemPtr = InstancePtr->Cqe.MemPtr;
+	XSdPs_CqeDesc *DescPtr = &MemPtr->Desc[Tag][0];
+	XSdPs_CqeSlot *SlotPtr = &MemPtr->Tdl[Tag];
+	const XSdPs_SgEntry *SgPtr;
+	UINTPTR Addr;
+	u32 Remaining;
+	u32 Length;
+	u32 DescNum = 0U;
+	u32 Index;
+	u64 Task;
+
+	for (Index = 0U; Index < ReqPtr->SgCount; Index++) {
+		SgPtr = &ReqPtr->SgList[Index];
+		Addr = (UINTPTR)SgPtr->Buff;
+		Remaining = SgPtr->BlkCnt * XSDPS_BLK_SIZE_512_MASK;
+
+		if (InstancePtr->Config.IsCacheCoherent == 0U) {
+			if (ReqPtr->IsWrite != 0U) {
+				Xil_DCacheFlushRange((INTPTR)Addr, (INTPTR)Remaining);
+			} else {
+				Xil_DCacheInvalidateRange((INTPTR)Addr, (INTPTR)Remaining);
+			}
+		}
+
+		while (Remaining != 0U) {
+			Length = (Remaining > XSDPS_DESC_MAX_LENGTH) ?
+				 XSDPS_DESC_MAX_LENGTH : Remaining;
+
+			/* A length field of 0 stands for 64KB */
+			DescPtr[DescNum].Address = (u64)Addr;
+			DescPtr[DescNum].Length = (u16)Length;
+			DescPtr[DescNum].Attribute = XSDPS_DESC_TRAN | XSDPS_DESC_VALID;
+			DescPtr[DescNum].Reserved = 0U;
+
+			Addr += Length;
+			Remaining -= Length;
+			DescNum++;
+		}
+	}
+	DescPtr[DescNum - 1U].Attribute |= XSDPS_DESC_END;
+
+	Task = (u64)XSDPS_CQ_TD_VALID | (u64)XSDPS_CQ_TD_END |
+	       (u64)XSDPS_CQ_TD_INT | (u64)XSDPS_CQ_TD_TASK |
+	       ((u64)ReqPtr->BlkCnt << XSDPS_CQ_TD_BLKCNT_SHIFT) |
+	       ((u64)ReqPtr->Arg << 32U);
+	if (ReqPtr->IsWrite == 0U) {
+		Task |= (u64)XSDPS_CQ_TD_DATA_DIR_READ;
+	}
+
+	SlotPtr->Task = Task;
+	SlotPtr->Attribute = XSDPS_DESC_LINK | XSDPS_DESC_VALID;
+	SlotPtr->Length = 0U;
+	SlotPtr->Address = (u64)(UINTPTR)DescPtr;
+	SlotPtr->Reserved = 0U;
+
+	if (InstancePtr->Config.IsCacheCoherent == 0U) {
+		Xil_DCacheFlushRange((INTPTR)DescPtr,
+				     (INTPTR)sizeof(XSdPs_CqeDesc) * (INTPTR)DescNum);
+		Xil_DCacheFlushRange((INTPTR)SlotPtr, (INTPTR)sizeof(XSdPs_CqeSlot));
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Halts the queuing engine. While halted, no new task is sent to the card
+* and commands can be issued through the legacy command registers.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+*
+* @return
+* 		- XST_SUCCESS if the engine is halted
+* 		- XST_FAILURE if the engine did not halt in time
+*
+******************************************************************************/
+static s32 XSdPs_CqeHalt(XSdPs *InstancePtr)
+{
+	u32 Ctl;
+	s32 Status;
+
+	Ctl = XSdPs_ReadReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_CTL_OFFSET);
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_CTL_OFFSET,
+		       Ctl | XSDPS_CQ_CTL_HALT_MASK);
+
+	/* The halt bit reads back as set once the engine is halted */
+	Status = (s32)Xil_WaitForEvent(InstancePtr->Config.BaseAddress +
+				       XSDPS_CQ_CTL_OFFSET, XSDPS_CQ_CTL_HALT_MASK,
+				       XSDPS_CQ_CTL_HALT_MASK,
+				       XSDPS_CQE_HALT_TIMEOUT);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+	}
+
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_IS_OFFSET,
+		       XSDPS_CQ_IS_HAC_MASK);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Recovers from a task error. The engine is halted, the tasks queued on the
+* controller and on the card are discarded, the command and data lines are
+* reset and all pending tasks are completed with XST_FAILURE.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+*
+* @return	None
+*
+******************************************************************************/
+static void XSdPs_CqeRecover(XSdPs *InstancePtr)
+{
+	XSdPs_Cqe *CqePtr = &InstancePtr->Cqe;
+	u32 Tag;
+
+	(void)XSdPs_CqeHalt(InstancePtr);
+
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			 XSDPS_ERR_INTR_STS_OFFSET, XSDPS_ERROR_INTR_ALL_MASK);
+	(void)XSdPs_Reset(InstancePtr, XSDPS_SWRST_CMD_LINE_MASK |
+			  XSDPS_SWRST_DAT_LINE_MASK);
+
+	/* Discard the tasks already queued on the card */
+	(void)XSdPs_CmdTransfer(InstancePtr, CMD48, XSDPS_CQE_DISCARD_QUEUE, 0U);
+
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_CTL_OFFSET,
+		       XSDPS_CQ_CTL_HALT_MASK | XSDPS_CQ_CTL_CLEAR_ALL_MASK);
+	(void)Xil_WaitForEvent(InstancePtr->Config.BaseAddress +
+			       XSDPS_CQ_CTL_OFFSET, XSDPS_CQ_CTL_CLEAR_ALL_MASK,
+			       0U, XSDPS_CQE_HALT_TIMEOUT);
+
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_TCN_OFFSET,
+		       XSdPs_ReadReg(InstancePtr->Config.BaseAddress,
+				     XSDPS_CQ_TCN_OFFSET));
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_IS_OFFSET,
+		       XSDPS_CQ_IS_ALL_MASK);
+
+	for (Tag = 0U; Tag < CqePtr->NumTasks; Tag++) {
+		if ((CqePtr->Pending & ((u32)1U << Tag)) != 0U) {
+			CqePtr->Task[Tag]->Status = XST_FAILURE;
+		}
+	}
+	CqePtr->Done |= CqePtr->Pending;
+	CqePtr->Pending = 0U;
+
+	/* Leave the halt state */
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_CTL_OFFSET, 0U);
+}
+
+/** @cond INTERNAL */
+/*****************************************************************************/
+/**
+* @brief
+* Queues a request as a task of the queuing engine. Called by
+* XSdPs_AsyncSubmit() in command queuing mode, with BlkCnt of the request
+* already set.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	ReqPtr Pointer to the request.
+*
+* @return
+* 		- XST_SUCCESS if the task is started
+* 		- XST_INVALID_PARAM if the request needs more than
+* 		XSDPS_CQE_DESC_COUNT descriptors
+* 		- XST_DEVICE_BUSY if no task slot is free
+*
+******************************************************************************/
+s32 XSdPs_CqeSubmit(XSdPs *InstancePtr, XSdPs_AsyncReq *ReqPtr)
+{
+	XSdPs_Cqe *CqePtr = &InstancePtr->Cqe;
+	u32 Busy;
+	u32 Tag;
+	u32 Depth = 0U;
+	s32 Status;
+
+	if (XSdPs_AsyncDescCount(InstancePtr, ReqPtr) > XSDPS_CQE_DESC_COUNT) {
+		Status = XST_INVALID_PARAM;
+		goto RETURN_PATH;
+	}
+
+	Busy = CqePtr->Pending | CqePtr->Done;
+	for (Tag = 0U; Tag < CqePtr->NumTasks; Tag++) {
+		if ((Busy & ((u32)1U << Tag)) == 0U) {
+			break;
+		}
+	}
+	if (Tag == CqePtr->NumTasks) {
+		Status = XST_DEVICE_BUSY;
+		goto RETURN_PATH;
+	}
+
+	XSdPs_CqeBuildTask(InstancePtr, ReqPtr, Tag);
+
+	ReqPtr->Status = XST_DEVICE_BUSY;
+	CqePtr->Task[Tag] = ReqPtr;
+	CqePtr->Pending |= (u32)1U << Tag;
+
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_TDBR_OFFSET,
+		       (u32)1U << Tag);
+
+	Busy |= (u32)1U << Tag;
+	while (Busy != 0U) {
+		Depth += Busy & 1U;
+		Busy >>= 1U;
+	}
+	if (Depth > InstancePtr->AsyncQueue.MaxDepth) {
+		InstancePtr->AsyncQueue.MaxDepth = Depth;
+	}
+
+	Status = XST_SUCCESS;
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Returns a completed task without blocking. Called by XSdPs_AsyncPoll() in
+* command queuing mode.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	ReqPtr Pointer to a location to store the completed request.
+*
+* @return
+* 		- XST_SUCCESS if a request is returned
+* 		- XST_DEVICE_BUSY if no submitted task is complete
+* 		- XST_NO_DATA if no task is pending
+*
+******************************************************************************/
+s32 XSdPs_CqePoll(XSdPs *InstancePtr, XSdPs_AsyncReq **ReqPtr)
+{
+	XSdPs_Cqe *CqePtr = &InstancePtr->Cqe;
+	XSdPs_AsyncReq *DonePtr;
+	u32 IntrSts;
+	u16 StatusReg;
+	u32 Tcn;
+	u32 Tag;
+	u32 Index;
+	s32 Status;
+
+	if ((CqePtr->Pending | CqePtr->Done) == 0U) {
+		Status = XST_NO_DATA;
+		goto RETURN_PATH;
+	}
+
+	if (CqePtr->Done == 0U) {
+		IntrSts = XSdPs_ReadReg(InstancePtr->Config.BaseAddress,
+					XSDPS_CQ_IS_OFFSET);
+		StatusReg = XSdPs_ReadReg16(InstancePtr->Config.BaseAddress,
+					    XSDPS_NORM_INTR_STS_OFFSET);
+
+		if (((IntrSts & XSDPS_CQ_IS_TCC_MASK) != 0U) ||
+		    ((IntrSts & XSDPS_CQ_IS_RED_MASK) != 0U)) {
+			/* Write to clear bits, then collect the completed tasks */
+			XSdPs_WriteReg(InstancePtr->Config.BaseAddress,
+				       XSDPS_CQ_IS_OFFSET, IntrSts);
+			Tcn = XSdPs_ReadReg(InstancePtr->Config.BaseAddress,
+					    XSDPS_CQ_TCN_OFFSET);
+			XSdPs_WriteReg(InstancePtr->Config.BaseAddress,
+				       XSDPS_CQ_TCN_OFFSET, Tcn);
+			Tcn &= CqePtr->Pending;
+			for (Tag = 0U; Tag < CqePtr->NumTasks; Tag++) {
+				if ((Tcn & ((u32)1U << Tag)) != 0U) {
+					CqePtr->Task[Tag]->Status = XST_SUCCESS;
+				}
+			}
+			CqePtr->Pending &= ~Tcn;
+			CqePtr->Done |= Tcn;
+		}
+
+		if (((IntrSts & XSDPS_CQ_IS_RED_MASK) != 0U) ||
+		    ((StatusReg & XSDPS_INTR_ERR_MASK) != 0U)) {
+			XSdPs_CqeRecover(InstancePtr);
+		}
+
+		if (CqePtr->Done == 0U) {
+			Status = XST_DEVICE_BUSY;
+			goto RETURN_PATH;
+		}
+	}
+
+	for (Tag = 0U; Tag < CqePtr->NumTasks; Tag++) {
+		if ((CqePtr->Done & ((u32)1U << Tag)) != 0U) {
+			break;
+		}
+	}
+	CqePtr->Done &= ~((u32)1U << Tag);
+	DonePtr = CqePtr->Task[Tag];
+
+	if ((DonePtr->Status == XST_SUCCESS) && (DonePtr->IsWrite == 0U) &&
+	    (InstancePtr->Config.IsCacheCoherent == 0U)) {
+		for (Index = 0U; Index < DonePtr->SgCount; Index++) {
+			Xil_DCacheInvalidateRange((INTPTR)DonePtr->SgList[Index].Buff,
+						  (INTPTR)DonePtr->SgList[Index].BlkCnt *
+						  (INTPTR)XSDPS_BLK_SIZE_512_MASK);
+		}
+	}
+
+	InstancePtr->AsyncQueue.Completed++;
+	*ReqPtr = DonePtr;
+	Status = XST_SUCCESS;
+
+RETURN_PATH:
+	return Status;
+}
+/** @endcond */
+
+/*****************************************************************************/
+/**
+* @brief
+* Enables eMMC command queuing. The card queuing mode is enabled through
+* EXT_CSD and the queuing engine of the controller is set up with the task
+* descriptor list in MemPtr. Up to the queue depth of the card, at most
+* XSDPS_CQ_MAX_TASKS, requests of XSdPs_AsyncSubmit() are then queued on
+* the card at the same time.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	MemPtr Pointer to the descriptor memory, 1KB aligned. It must
+* 		stay valid until XSdPs_CqeDisable() is called.
+*
+* @return
+* 		- XST_SUCCESS if command queuing is enabled
+* 		- XST_NO_FEATURE if the card or the controller has no command
+* 		queuing support; transfers keep using the legacy mode
+* 		- XST_DEVICE_BUSY if a transfer is pending
+* 		- XST_FAILURE if the card could not be switched
+*
+* @note		While command queuing is enabled only XSdPs_AsyncSubmit() and
+* 		XSdPs_AsyncPoll() can transfer data.
+*
+******************************************************************************/
+s32 XSdPs_CqeEnable(XSdPs *InstancePtr, XSdPs_CqeMem *MemPtr)
+{
+	XSdPs_Cqe *CqePtr;
+	u32 Tag;
+	s32 Status;
+#ifdef __ICCARM__
+#pragma data_alignment = 32
+	static u8 ExtCsd[512];
+#else
+	static u8 ExtCsd[512] __attribute__ ((aligned(32)));
+#endif
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(MemPtr != NULL);
+
+	CqePtr = &InstancePtr->Cqe;
+
+	if (CqePtr->Enabled != 0U) {
+		Status = XST_SUCCESS;
+		goto RETURN_PATH;
+	}
+
+	if (InstancePtr->IsBusy == TRUE) {
+		Status = XST_DEVICE_BUSY;
+		goto RETURN_PATH;
+	}
+
+	/* The queuing engine only walks 64-bit ADMA2 descriptors */
+	if ((InstancePtr->CardType != XSDPS_CHIP_EMMC) ||
+	    (InstancePtr->HC_Version != XSDPS_HC_SPEC_V3) ||
+	    (XSdPs_ReadReg(InstancePtr->Config.BaseAddress,
+			   XSDPS_CQ_VER_OFFSET) == 0U)) {
+		Status = XST_NO_FEATURE;
+		goto RETURN_PATH;
+	}
+
+#if defined  (XCLOCKING)
+	Xil_ClockEnable(InstancePtr->Config.RefClk);
+#endif
+
+	Status = XSdPs_Get_Mmc_ExtCsd(InstancePtr, ExtCsd);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto CLOCK_PATH;
+	}
+
+	if ((ExtCsd[EXT_CSD_CMDQ_SUPPORT_BYTE] & EXT_CSD_CMDQ_SUPPORTED) == 0U) {
+		Status = XST_NO_FEATURE;
+		goto CLOCK_PATH;
+	}
+
+	Status = XSdPs_SetupTransfer(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto CLOCK_PATH;
+	}
+
+	Status = XSdPs_Set_Mmc_ExtCsd(InstancePtr, XSDPS_MMC_CMDQ_EN_ARG);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto CLOCK_PATH;
+	}
+	InstancePtr->BlkSize = XSDPS_BLK_SIZE_512_MASK;
+
+	CqePtr->MemPtr = MemPtr;
+	CqePtr->NumTasks = ((u32)ExtCsd[EXT_CSD_CMDQ_DEPTH_BYTE] &
+			    EXT_CSD_CMDQ_DEPTH_MASK) + 1U;
+	CqePtr->Pending = 0U;
+	CqePtr->Done = 0U;
+
+	for (Tag = 0U; Tag < XSDPS_CQ_MAX_TASKS; Tag++) {
+		MemPtr->Tdl[Tag].Task = 0U;
+	}
+	if (InstancePtr->Config.IsCacheCoherent == 0U) {
+		Xil_DCacheFlushRange((INTPTR)&MemPtr->Tdl[0],
+				     (INTPTR)sizeof(MemPtr->Tdl));
+	}
+
+	/* Program the engine while it is disabled */
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_CFG_OFFSET, 0U);
+#if defined(__aarch64__) || defined(__arch64__)
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_TDLBAU_OFFSET,
+		       (u32)((UINTPTR)&MemPtr->Tdl[0] >> 32U));
+#else
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_TDLBAU_OFFSET, 0U);
+#endif
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_TDLBA_OFFSET,
+		       (u32)((UINTPTR)&MemPtr->Tdl[0]));
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_SSC1_OFFSET,
+		       XSDPS_CQ_SSC1_DEFAULT);
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_SSC2_OFFSET,
+		       InstancePtr->RelCardAddr >> 16U);
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_RMEM_OFFSET,
+		       XSDPS_CQ_RMEM_DEFAULT);
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_IC_OFFSET, 0U);
+
+	/* Completions are polled, the interrupt line is not used */
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_ISGE_OFFSET, 0U);
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_ISTE_OFFSET,
+		       XSDPS_CQ_IS_ALL_MASK);
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_TCN_OFFSET,
+		       XSdPs_ReadReg(InstancePtr->Config.BaseAddress,
+				     XSDPS_CQ_TCN_OFFSET));
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_IS_OFFSET,
+		       XSDPS_CQ_IS_ALL_MASK);
+
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_CFG_OFFSET,
+		       XSDPS_CQ_CFG_ENABLE_MASK);
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_CTL_OFFSET, 0U);
+
+	CqePtr->Enabled = 1U;
+	InstancePtr->IsBusy = TRUE;
+
+	/* The clock stays enabled until XSdPs_CqeDisable() */
+	Status = XST_SUCCESS;
+	goto RETURN_PATH;
+
+CLOCK_PATH:
+#if defined  (XCLOCKING)
+	Xil_ClockDisable(InstancePtr->Config.RefClk);
+#endif
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Disables eMMC command queuing and returns to the legacy transfer mode.
+* All requests must have been returned by XSdPs_AsyncPoll().
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+*
+* @return
+* 		- XST_SUCCESS if command queuing is disabled
+* 		- XST_DEVICE_BUSY if a task is pending
+* 		- XST_FAILURE if the engine did not halt or the card could not
+* 		be switched
+*
+******************************************************************************/
+s32 XSdPs_CqeDisable(XSdPs *InstancePtr)
+{
+	XSdPs_Cqe *CqePtr;
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	CqePtr = &InstancePtr->Cqe;
+
+	if (CqePtr->Enabled == 0U) {
+		Status = XST_SUCCESS;
+		goto RETURN_PATH;
+	}
+
+	if ((CqePtr->Pending | CqePtr->Done) != 0U) {
+		Status = XST_DEVICE_BUSY;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_CqeHalt(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		goto RETURN_PATH;
+	}
+
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_CFG_OFFSET, 0U);
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_CTL_OFFSET, 0U);
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_ISTE_OFFSET, 0U);
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_CQ_IS_OFFSET,
+		       XSDPS_CQ_IS_ALL_MASK);
+
+	CqePtr->Enabled = 0U;
+	InstancePtr->IsBusy = FALSE;
+
+	Status = XSdPs_Set_Mmc_ExtCsd(InstancePtr, XSDPS_MMC_CMDQ_DIS_ARG);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+	}
+
+#if defined  (XCLOCKING)
+	Xil_ClockDisable(InstancePtr->Config.RefClk);
+#endif
+
+RETURN_PATH:
+	return Status;
+}
+/** @} */
@@ -41,6 +41,10 @@
 * 	sa     01/25/23 Use instance structure to store DMA descriptor tables.
 * 4.2   ap     08/09/23 Restructured XSdPs_FrameCmd API
 * 4.3   ap     12/22/23 Add support to read custom HS400 tap delay value from design for eMMC.
+*       kt     10/18/26 Save the SCR CMD_SUPPORT bits and frame CMD23 as a
+*                       command without data.
+*       kt     10/18/26 Frame CMD48 and reject legacy transfers while command
+*                       queuing is enabled.
 * </pre>
 *
 ******************************************************************************/
@@ -218,6 +222,12 @@ s32 XSdPs_SetupTransfer(XSdPs *InstancePtr)
 	u32 PresentStateReg;
 	s32 Status;
 
+	/* Data transfers are issued by the queuing engine in this mode */
+	if (InstancePtr->Cqe.Enabled != 0U) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
 	if ((InstancePtr->HC_Version != XSDPS_HC_SPEC_V3) ||
 	    ((InstancePtr->Host_Caps & XSDPS_CAPS_SLOT_TYPE_MASK)
 	     != XSDPS_CAPS_EMB_SLOT)) {
@@ -333,6 +343,10 @@ s32 XSdPs_SdModeInit(XSdPs *InstancePtr)
 		goto RETURN_PATH;
 	}
 
+	/* Keep the upper word of SCR, it holds the CMD_SUPPORT bits */
+	InstancePtr->SdCardConfig = ((u32)SCR[0] << 24U) | ((u32)SCR[1] << 16U) |
+				    ((u32)SCR[2] << 8U) | (u32)SCR[3];
+
 	if ((SCR[1] & WIDTH_4_BIT_SUPPORT) != 0U) {
 		InstancePtr->BusWidth = XSDPS_4_BIT_WIDTH;
 		Status = XSdPs_Change_BusWidth(InstancePtr);
@@ -1749,6 +1763,7 @@ u32 XSdPs_FrameCmd(XSdPs *InstancePtr, u32 Cmd)
 			break;
 		case CMD5:
 		case CMD38:
+		case CMD48:
 			RetVal |= RESP_R1B;
 			break;
 		case CMD6:
@@ -1764,6 +1779,7 @@ u32 XSdPs_FrameCmd(XSdPs *InstancePtr, u32 Cmd)
 		case CMD11:
 		case CMD12:
 		case CMD16:
+		case CMD23:
 		case CMD32:
 		case CMD33:
 		case CMD35:
@@ -1785,7 +1801,6 @@ u32 XSdPs_FrameCmd(XSdPs *InstancePtr, u32 Cmd)
 		case CMD18:
 		case CMD19:
 		case CMD21:
-		case CMD23:
 		case ACMD23:
 		case CMD24:
 		case CMD25:
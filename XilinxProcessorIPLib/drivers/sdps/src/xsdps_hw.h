@@ -48,6 +48,8 @@
 * 4.2   ro     06/12/23 Added support for system device-tree flow.
 * 4.3   ap     11/29/23 Add support for Sanitize feature.
 * 4.3   ap     12/22/23 Add support to read custom HS400 tap delay value from design for eMMC.
+*       kt     10/18/26 Add command queuing (CQHCI) register and EXT_CSD
+*                       definitions.
 *
 * </pre>
 *
@@ -160,6 +162,47 @@ extern "C" {
 
 /** @} */
 
+/** @name Command Queuing Register Map
+ *
+ * Register offsets of the eMMC command queuing engine (CQHCI), relative
+ * to the base address of the controller.
+ * @{
+ */
+#define XSDPS_CQ_BASE_OFFSET		0x200U	/**< Command queuing registers */
+#define XSDPS_CQ_VER_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x00U)	/**< Version */
+#define XSDPS_CQ_CAP_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x04U)	/**< Capabilities */
+#define XSDPS_CQ_CFG_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x08U)	/**< Configuration */
+#define XSDPS_CQ_CTL_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x0CU)	/**< Control */
+#define XSDPS_CQ_IS_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x10U)	/**< Interrupt Status */
+#define XSDPS_CQ_ISTE_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x14U)	/**< Interrupt Status
+							Enable */
+#define XSDPS_CQ_ISGE_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x18U)	/**< Interrupt Signal
+							Enable */
+#define XSDPS_CQ_IC_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x1CU)	/**< Interrupt
+							Coalescing */
+#define XSDPS_CQ_TDLBA_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x20U)	/**< Task Descriptor
+							List Base Address */
+#define XSDPS_CQ_TDLBAU_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x24U)	/**< Task Descriptor
+							List Base Address
+							Upper */
+#define XSDPS_CQ_TDBR_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x28U)	/**< Task Doorbell */
+#define XSDPS_CQ_TCN_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x2CU)	/**< Task Completion
+							Notification */
+#define XSDPS_CQ_DQS_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x30U)	/**< Device Queue
+							Status */
+#define XSDPS_CQ_DPT_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x34U)	/**< Device Pending
+							Tasks */
+#define XSDPS_CQ_TCLR_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x38U)	/**< Task Clear */
+#define XSDPS_CQ_SSC1_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x40U)	/**< Send Status
+							Configuration 1 */
+#define XSDPS_CQ_SSC2_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x44U)	/**< Send Status
+							Configuration 2 */
+#define XSDPS_CQ_RMEM_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x50U)	/**< Response Mode
+							Error Mask */
+#define XSDPS_CQ_TERRI_OFFSET		(XSDPS_CQ_BASE_OFFSET + 0x54U)	/**< Task Error
+							Information */
+/** @} */
+
 /** @name Control Register - Host control, Power control,
  * 			Block Gap control and Wakeup control
  *
@@ -627,6 +670,30 @@ extern "C" {
 #define XSDPS_HC_SPEC_V1		0x0000U	/**< HC spec version 1 */
 /** @} */
 
+/** @name Command Queuing Registers
+ *
+ * Bits of the configuration, control and interrupt status registers of
+ * the command queuing engine.
+ * @{
+ */
+#define XSDPS_CQ_CFG_ENABLE_MASK	0x00000001U /**< Queuing enable */
+#define XSDPS_CQ_CFG_TASK_DESC_128_MASK	0x00000100U /**< 128-bit task
+							descriptors */
+#define XSDPS_CQ_CFG_DCMD_MASK		0x00001000U /**< Direct command
+							slot enable */
+#define XSDPS_CQ_CTL_HALT_MASK		0x00000001U /**< Halt */
+#define XSDPS_CQ_CTL_CLEAR_ALL_MASK	0x00000100U /**< Clear all tasks */
+#define XSDPS_CQ_IS_HAC_MASK		0x00000001U /**< Halt complete */
+#define XSDPS_CQ_IS_TCC_MASK		0x00000002U /**< Task complete */
+#define XSDPS_CQ_IS_RED_MASK		0x00000004U /**< Response error */
+#define XSDPS_CQ_IS_TCL_MASK		0x00000008U /**< Task cleared */
+#define XSDPS_CQ_IS_ALL_MASK		0x0000000FU /**< All interrupts */
+#define XSDPS_CQ_SSC1_DEFAULT		0x00011000U /**< CMD13 polling: one
+							block count, 4096
+							clock interval */
+#define XSDPS_CQ_RMEM_DEFAULT		0xFDF9A080U /**< R1 error bits */
+/** @} */
+
 /** @name PHYCTRL Register1 - OTAP, ITAP and SROBE SEL
  *
  * This register contains bits for input tap, output tap and strobe sel.
@@ -710,6 +777,7 @@ extern "C" {
 #define CMD41	 0x2900U
 #define ACMD41	 (XSDPS_APP_CMD_PREFIX + 0x2900U)
 #define ACMD42	 (XSDPS_APP_CMD_PREFIX + 0x2A00U)
+#define CMD48	 0x3000U
 #define ACMD51	 (XSDPS_APP_CMD_PREFIX + 0x3300U)
 #define CMD52	 0x3400U
 #define CMD55	 0x3700U
@@ -987,6 +1055,12 @@ extern "C" {
 #define EXT_CSD_RST_N_FUN_PERM_EN	1U	/* RST_n signal is permanently enabled */
 #define EXT_CSD_RST_N_FUN_PERM_DIS	2U	/* RST_n signal is permanently disabled */
 
+#define EXT_CSD_CMDQ_MODE_EN_BYTE	15U
+#define EXT_CSD_CMDQ_DEPTH_BYTE		307U
+#define EXT_CSD_CMDQ_DEPTH_MASK		0x1FU	/* Queue depth minus one */
+#define EXT_CSD_CMDQ_SUPPORT_BYTE	308U
+#define EXT_CSD_CMDQ_SUPPORTED		(1U<<0)	/* Card supports command queuing */
+
 #define XSDPS_EXT_CSD_CMD_SET		0U
 #define XSDPS_EXT_CSD_SET_BITS		1U
 #define XSDPS_EXT_CSD_CLR_BITS		2U
@@ -1040,6 +1114,13 @@ extern "C" {
 	| ((u32)EXT_CSD_RST_N_FUN_BYTE << 16) \
 	| ((u32)EXT_CSD_RST_N_FUN_PERM_EN << 8))
 
+#define XSDPS_MMC_CMDQ_EN_ARG		(((u32)XSDPS_EXT_CSD_WRITE_BYTE << 24) \
+	| ((u32)EXT_CSD_CMDQ_MODE_EN_BYTE << 16) \
+	| ((u32)1U << 8))
+
+#define XSDPS_MMC_CMDQ_DIS_ARG		(((u32)XSDPS_EXT_CSD_WRITE_BYTE << 24) \
+	| ((u32)EXT_CSD_CMDQ_MODE_EN_BYTE << 16))
+
 #define XSDPS_MMC_DELAY_FOR_SWITCH	1000U
 
 /** @} */
@@ -1079,7 +1160,28 @@ extern "C" {
 #define XSDPS_DESC_END       	(0x1U << 1)
 #define XSDPS_DESC_INT       	(0x1U << 2)
 #define XSDPS_DESC_TRAN  	(0x2U << 4)
+#define XSDPS_DESC_LINK  	(0x3U << 4)
+
+/** @} */
 
+/**
+ *@name Command Queuing Task Descriptor definitions
+ * @{
+ */
+/**
+ * Fields of the 64-bit task descriptor of the command queuing engine. The
+ * upper word holds the card address of the first block.
+ */
+#define XSDPS_CQ_TD_VALID		(0x1U << 0)
+#define XSDPS_CQ_TD_END			(0x1U << 1)
+#define XSDPS_CQ_TD_INT			(0x1U << 2)
+#define XSDPS_CQ_TD_TASK		(0x5U << 3)
+#define XSDPS_CQ_TD_FORCED_PROG		(0x1U << 6)
+#define XSDPS_CQ_TD_DATA_DIR_READ	(0x1U << 12)
+#define XSDPS_CQ_TD_PRIORITY		(0x1U << 13)
+#define XSDPS_CQ_TD_BLKCNT_SHIFT	16U
+
+#define XSDPS_CQ_MAX_TASKS		32U	/**< Task slots of the engine */
 /** @} */
 
 /* For changing clock frequencies */
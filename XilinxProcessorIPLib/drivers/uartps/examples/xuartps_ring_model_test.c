@@ -0,0 +1,405 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xuartps_ring_model_test.c
+*
+* Host test of the ring mode of xuartps_ring.c against a model of the PS
+* UART. It is not a target example: it is built and run with the other
+* driver model tests by make -C scripts/host_model.
+*
+* The model has the two 64 byte FIFOs, a line that sends and receives one
+* byte every BYTE_TICKS, the latched interrupt status and the receive
+* timeout. Each register access takes a tick, and the interrupt handler is
+* called as soon as an enabled status is set, also in the middle of
+* XUartPs_RingSend(). No application handler is set.
+*
+* Bursts of random sizes are sent through the TX ring with random gaps,
+* some long enough for the TX FIFO to get empty, while bursts are received.
+* The line must carry the bytes in order without a TX FIFO overflow, every
+* byte received must reach the RX ring, and the bytes of XUartPs_SendByte()
+* must go through the TX ring while it is stdout. The interrupts per
+* kilobyte are printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.1   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xuartps.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define UART_BASE	0xE0000000U
+#define BYTE_TICKS	200U	/* Line time of a byte in register accesses */
+#define TX_RING_SIZE	1024U
+#define RX_RING_SIZE	1024U
+#define NUM_BURSTS	2000U
+#define MAX_BURST	300U
+#define STDOUT_BYTES	100U
+
+/************************** Function Prototypes ******************************/
+
+static u8 Pattern(u32 Index);
+static u32 Random(void);
+static void Tick(void);
+static void Idle(u32 Ticks);
+static void DrainRx(void);
+static void SendBurst(u32 Length);
+
+/************************** Variable Definitions *****************************/
+
+static XUartPs Uart;
+static XUartPsRing Ring;
+static u8 TxStorage[TX_RING_SIZE];
+static u8 RxStorage[RX_RING_SIZE];
+
+/* Device model */
+static u32 Regs[0x50 / 4];
+static u32 Isr;
+static u32 Imr;
+static u8 TxFifo[XUARTPS_FIFO_SIZE];
+static u32 TxCount;
+static u8 RxFifo[XUARTPS_FIFO_SIZE];
+static u32 RxCount;
+static u32 Clock;
+static u32 TxLineFree;		/* Clock at which the line takes a byte */
+static u32 RxNext;		/* Clock of the next byte received */
+static u32 RxBurstLeft;
+static u32 RxLast;		/* Clock of the last byte received */
+static u32 ToutLatched;
+static u32 InHandler;
+
+/* Checks */
+static u32 TxQueued;		/* Bytes handed to the driver */
+static u32 TxOnLine;		/* Bytes sent on the line */
+static u32 TxOverflows;
+static u32 TxMismatches;
+static u32 RxOnLine;		/* Bytes received from the line */
+static u32 RxTaken;		/* Bytes read from the RX ring */
+static u32 RxOverruns;
+static u32 RxUnderflows;
+static u32 Seed = 1U;
+
+/*****************************************************************************/
+/*
+* Register model. The FIFO register writes the TX FIFO and reads the RX
+* FIFO; the status is computed from the FIFO levels.
+*/
+u32 Xil_In32(UINTPTR Addr)
+{
+	u32 Offset = (u32)(Addr - UART_BASE);
+	u32 Value;
+	u32 Index;
+
+	switch (Offset) {
+	case XUARTPS_ISR_OFFSET:
+		Value = Isr;
+		break;
+	case XUARTPS_IMR_OFFSET:
+		Value = Imr;
+		break;
+	case XUARTPS_SR_OFFSET:
+		Value = 0U;
+		if (TxCount == 0U) {
+			Value |= XUARTPS_SR_TXEMPTY;
+		}
+		if (TxCount == XUARTPS_FIFO_SIZE) {
+			Value |= XUARTPS_SR_TXFULL;
+		}
+		if (RxCount == 0U) {
+			Value |= XUARTPS_SR_RXEMPTY;
+		}
+		if (RxCount == XUARTPS_FIFO_SIZE) {
+			Value |= XUARTPS_SR_RXFULL;
+		}
+		if (RxCount >= (Regs[XUARTPS_RXWM_OFFSET / 4U] &
+				XUARTPS_RXWM_MASK)) {
+			Value |= XUARTPS_SR_RXOVR;
+		}
+		break;
+	case XUARTPS_FIFO_OFFSET:
+		if (RxCount == 0U) {
+			RxUnderflows++;
+			Value = 0U;
+		} else {
+			Value = RxFifo[0];
+			RxCount--;
+			for (Index = 0U; Index < RxCount; Index++) {
+				RxFifo[Index] = RxFifo[Index + 1U];
+			}
+		}
+		break;
+	default:
+		Value = Regs[Offset / 4U];
+		break;
+	}
+	Tick();
+
+	return Value;
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	u32 Offset = (u32)(Addr - UART_BASE);
+
+	switch (Offset) {
+	case XUARTPS_IER_OFFSET:
+		Imr |= Value;
+		break;
+	case XUARTPS_IDR_OFFSET:
+		Imr &= ~Value;
+		break;
+	case XUARTPS_ISR_OFFSET:
+		Isr &= ~Value;
+		break;
+	case XUARTPS_FIFO_OFFSET:
+		if (TxCount == XUARTPS_FIFO_SIZE) {
+			TxOverflows++;
+		} else {
+			TxFifo[TxCount] = (u8)Value;
+			TxCount++;
+		}
+		break;
+	default:
+		Regs[Offset / 4U] = Value;
+		break;
+	}
+	Tick();
+}
+
+static u8 Pattern(u32 Index)
+{
+	return (u8)((Index * 7U) + (Index >> 8));
+}
+
+static u32 Random(void)
+{
+	Seed = (Seed * 1103515245U) + 12345U;
+	return Seed >> 8;
+}
+
+/*****************************************************************************/
+/*
+* Moves the line by one tick, then takes the interrupt if an enabled status
+* is set.
+*/
+static void Tick(void)
+{
+	u32 Index;
+	u32 ToutTicks;
+
+	Clock++;
+
+	/* The transmitter takes the next byte once the last one is out */
+	if ((TxCount != 0U) && ((s32)(Clock - TxLineFree) >= 0)) {
+		if (TxFifo[0] != Pattern(TxOnLine)) {
+			TxMismatches++;
+		}
+		TxOnLine++;
+		TxCount--;
+		for (Index = 0U; Index < TxCount; Index++) {
+			TxFifo[Index] = TxFifo[Index + 1U];
+		}
+		TxLineFree = Clock + BYTE_TICKS;
+		if (TxCount == 0U) {
+			Isr |= XUARTPS_IXR_TXEMPTY;
+		}
+	}
+
+	/* The receiver gets the bytes of a burst back to back */
+	if ((RxBurstLeft != 0U) && ((s32)(Clock - RxNext) >= 0)) {
+		if (RxCount == XUARTPS_FIFO_SIZE) {
+			RxOverruns++;
+			Isr |= XUARTPS_IXR_OVER;
+		} else {
+			RxFifo[RxCount] = Pattern(RxOnLine);
+			RxCount++;
+			if (RxCount >= (Regs[XUARTPS_RXWM_OFFSET / 4U] &
+					XUARTPS_RXWM_MASK)) {
+				Isr |= XUARTPS_IXR_RXOVR;
+			}
+			if (RxCount == XUARTPS_FIFO_SIZE) {
+				Isr |= XUARTPS_IXR_RXFULL;
+			}
+		}
+		RxOnLine++;
+		RxBurstLeft--;
+		RxNext = Clock + BYTE_TICKS;
+		RxLast = Clock;
+		ToutLatched = 0U;
+	}
+
+	/* The timeout counts 4 bit periods, 10 bits a byte */
+	ToutTicks = (Regs[XUARTPS_RXTOUT_OFFSET / 4U] * 4U * BYTE_TICKS) / 10U;
+	if ((RxCount != 0U) && (ToutLatched == 0U) &&
+	    ((Clock - RxLast) >= ToutTicks)) {
+		Isr |= XUARTPS_IXR_TOUT;
+		ToutLatched = 1U;
+	}
+
+	if (((Isr & Imr) != 0U) && (InHandler == 0U)) {
+		InHandler = 1U;
+		XUartPs_RingInterruptHandler(&Ring);
+		InHandler = 0U;
+	}
+}
+
+static void Idle(u32 Ticks)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < Ticks; Index++) {
+		Tick();
+	}
+}
+
+static void DrainRx(void)
+{
+	u8 Buffer[97];
+	u32 Count;
+	u32 Index;
+
+	do {
+		Count = XUartPs_RingRecv(&Ring, Buffer, sizeof(Buffer));
+		for (Index = 0U; Index < Count; Index++) {
+			XHOST_CHECK(Buffer[Index] == Pattern(RxTaken),
+				    "RX byte %u: %02x, expected %02x",
+				    (unsigned)RxTaken, Buffer[Index],
+				    Pattern(RxTaken));
+			RxTaken++;
+		}
+	} while (Count != 0U);
+}
+
+/*****************************************************************************/
+/*
+* Sends a burst through the TX ring once it has room for it.
+*/
+static void SendBurst(u32 Length)
+{
+	u8 Buffer[MAX_BURST];
+	u32 Index;
+	u32 Queued;
+
+	while ((TX_RING_SIZE - (Ring.TxRing.Head - Ring.TxRing.Tail)) <
+	       Length) {
+		Idle(BYTE_TICKS);
+		DrainRx();
+	}
+	for (Index = 0U; Index < Length; Index++) {
+		Buffer[Index] = Pattern(TxQueued + Index);
+	}
+	Queued = XUartPs_RingSend(&Ring, Buffer, Length);
+	XHOST_CHECK(Queued == Length, "%u of %u bytes queued",
+		    (unsigned)Queued, (unsigned)Length);
+	TxQueued += Queued;
+}
+
+int main(void)
+{
+	XUartPs_Config Config;
+	XUartPsRingStats Stats;
+	u32 Burst;
+	u32 Index;
+	u32 Waited;
+
+	(void)memset(&Config, 0, sizeof(Config));
+	Config.BaseAddress = UART_BASE;
+	Config.InputClockHz = 100000000U;
+	Config.RefClk = 100000000U;
+	(void)XUartPs_CfgInitialize(&Uart, &Config, UART_BASE);
+	(void)XUartPs_RingInitialize(&Ring, &Uart, TxStorage, TX_RING_SIZE,
+				     RxStorage, RX_RING_SIZE);
+
+	for (Burst = 0U; Burst < NUM_BURSTS; Burst++) {
+		if ((RxBurstLeft == 0U) && ((Random() % 4U) == 0U)) {
+			RxBurstLeft = 1U + (Random() % 400U);
+			RxNext = Clock + (Random() % BYTE_TICKS);
+		}
+		SendBurst(1U + (Random() % MAX_BURST));
+		DrainRx();
+
+		/* Short gaps, or long enough to send all */
+		if ((Random() % 3U) == 0U) {
+			Idle((Random() % 400U) * BYTE_TICKS);
+		} else {
+			Idle(Random() % (4U * BYTE_TICKS));
+		}
+		DrainRx();
+	}
+
+	/* Bytes printed while the TX ring is stdout, then polled again */
+	Idle(TX_RING_SIZE * BYTE_TICKS);
+	DrainRx();
+	XUartPs_RingSetStdout(&Ring, TRUE);
+	for (Index = 0U; Index < STDOUT_BYTES; Index++) {
+		XUartPs_SendByte(UART_BASE, Pattern(TxQueued));
+		TxQueued++;
+	}
+	XHOST_CHECK(Ring.TxRing.Head != Ring.TxRing.Tail,
+		    "stdout did not go through the TX ring");
+	Waited = 0U;
+	while ((Ring.TxRing.Head != Ring.TxRing.Tail) &&
+	       (Waited < (TX_RING_SIZE * BYTE_TICKS))) {
+		Idle(BYTE_TICKS);
+		Waited += BYTE_TICKS;
+	}
+	XUartPs_RingSetStdout(&Ring, FALSE);
+	for (Index = 0U; Index < STDOUT_BYTES; Index++) {
+		XUartPs_SendByte(UART_BASE, Pattern(TxQueued));
+		TxQueued++;
+	}
+
+	/* Let the line finish */
+	Idle((TX_RING_SIZE + 1000U) * BYTE_TICKS);
+	DrainRx();
+
+	XUartPs_RingGetStats(&Ring, &Stats);
+	XHOST_CHECK(TxOverflows == 0U, "%u TX FIFO overflows",
+		    (unsigned)TxOverflows);
+	XHOST_CHECK((TxOnLine == TxQueued) && (TxMismatches == 0U),
+		    "%u of %u bytes sent, %u out of order",
+		    (unsigned)TxOnLine, (unsigned)TxQueued,
+		    (unsigned)TxMismatches);
+	XHOST_CHECK(Stats.TxBytes == (TxQueued - STDOUT_BYTES),
+		    "%u bytes through the TX ring, expected %u",
+		    (unsigned)Stats.TxBytes,
+		    (unsigned)(TxQueued - STDOUT_BYTES));
+	XHOST_CHECK((RxTaken == RxOnLine) && (RxOverruns == 0U) &&
+		    (RxUnderflows == 0U),
+		    "%u of %u bytes received, %u overruns, %u underflows",
+		    (unsigned)RxTaken, (unsigned)RxOnLine,
+		    (unsigned)RxOverruns, (unsigned)RxUnderflows);
+	XHOST_CHECK((Stats.TxDropped == 0U) && (Stats.RxDropped == 0U) &&
+		    (Stats.RxErrors == 0U),
+		    "%u TX dropped, %u RX dropped, %u errors",
+		    (unsigned)Stats.TxDropped, (unsigned)Stats.RxDropped,
+		    (unsigned)Stats.RxErrors);
+	XHOST_CHECK(((Imr & XUARTPS_IXR_TXEMPTY) == 0U) &&
+		    (Ring.TxActive == 0U),
+		    "TX empty interrupt left enabled");
+	XHOST_CHECK(XHostModel_AssertCount == 0U, "%u asserts",
+		    (unsigned)XHostModel_AssertCount);
+
+	printf("%u bytes sent, %u received, %u interrupts, %.1f per KB\n",
+	       (unsigned)TxOnLine, (unsigned)RxOnLine,
+	       (unsigned)Stats.Interrupts,
+	       (double)Stats.Interrupts * 1024.0 /
+	       (double)(TxOnLine + RxOnLine));
+
+	return XHostModel_Report("xuartps_ring_model_test");
+}
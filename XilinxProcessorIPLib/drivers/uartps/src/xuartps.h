@@ -150,6 +150,7 @@
 * 3.9   sd     02/06/20 Added clock support
 * 3.12	gm     11/04/22 Added timeout support using Xil_WaitForEvent
 * 3.13	adk    14/04/23 Added support for system device-tree flow.
+* 4.1	kt     10/18/26 Added ring buffered interrupt mode in xuartps_ring.c.
 *
 * </pre>
 *
@@ -186,6 +187,17 @@ extern "C" {
 
 #define XUARTPS_DFT_BAUDRATE  115200U   /* Default baud rate */
 
+#define XUARTPS_FIFO_SIZE	64U	/* Size of the TX and RX FIFOs in bytes */
+
+/*
+ * The following constants are the RX FIFO trigger level and the receive
+ * timeout, in units of 4 bit periods, set by XUartPs_RingInitialize(). The
+ * trigger level leaves room in the FIFO for the interrupt latency, the
+ * timeout flushes the bytes below the trigger level at the end of a burst.
+ */
+#define XUARTPS_RING_RX_TRIGGER	48U
+#define XUARTPS_RING_RX_TIMEOUT	8U
+
 /** @name Configuration options
  * @{
  */
@@ -349,6 +361,40 @@ typedef struct {
 	u8 is_rxbs_error;
 } XUartPs;
 
+/* Keep track of state information about a ring buffer in the ring mode. */
+typedef struct {
+	u8 *BufferPtr;		/* Ring storage */
+	u32 Size;		/* Size of the ring in bytes, a power of two */
+	volatile u32 Head;	/* Write index, free running */
+	volatile u32 Tail;	/* Read index, free running */
+} XUartPsRingBuffer;
+
+/**
+ * Statistics of a device in the ring mode.
+ */
+typedef struct {
+	u32 TxBytes;		/**< Bytes written to the TX FIFO */
+	u32 RxBytes;		/**< Bytes read from the RX FIFO */
+	u32 TxDropped;		/**< Bytes not sent as the TX ring was full */
+	u32 RxDropped;		/**< Bytes lost as the RX ring was full */
+	u32 RxErrors;		/**< Overrun, framing and parity errors */
+	u32 Interrupts;		/**< Interrupts handled */
+} XUartPsRingStats;
+
+/**
+ * The XUartPs ring mode data structure. The ring mode replaces the buffer
+ * functions XUartPs_Send() and XUartPs_Recv() of the interrupt mode with a
+ * TX and an RX ring, so that the sender and the receiver never wait on the
+ * device.
+ */
+typedef struct {
+	XUartPs *InstancePtr;		/* Device the rings are attached to */
+	XUartPsRingBuffer TxRing;	/* Filled by the application */
+	XUartPsRingBuffer RxRing;	/* Filled by the interrupt handler */
+	XUartPsRingStats Stats;		/* Statistics */
+	volatile u32 TxActive;		/* Handler is refilling the TX FIFO */
+} XUartPsRing;
+
 
 /***************** Macros (Inline Functions) Definitions ********************/
 
@@ -512,6 +558,24 @@ void XUartPs_InterruptHandler(XUartPs *InstancePtr);
 void XUartPs_SetHandler(XUartPs *InstancePtr, XUartPs_Handler FuncPtr,
 			 void *CallBackRef);
 
+/* ring mode functions in xuartps_ring.c */
+s32 XUartPs_RingInitialize(XUartPsRing *RingPtr, XUartPs *InstancePtr,
+			   u8 *TxBufferPtr, u32 TxSize,
+			   u8 *RxBufferPtr, u32 RxSize);
+
+u32 XUartPs_RingSend(XUartPsRing *RingPtr, const u8 *BufferPtr,
+		     u32 NumBytes);
+
+u32 XUartPs_RingRecv(XUartPsRing *RingPtr, u8 *BufferPtr, u32 NumBytes);
+
+void XUartPs_RingInterruptHandler(XUartPsRing *RingPtr);
+
+void XUartPs_RingSetStdout(XUartPsRing *RingPtr, u32 Enable);
+
+void XUartPs_RingGetStats(XUartPsRing *RingPtr, XUartPsRingStats *StatsPtr);
+
+void XUartPs_RingClearStats(XUartPsRing *RingPtr);
+
 /* self-test functions in xuartps_selftest.c */
 s32 XUartPs_SelfTest(XUartPs *InstancePtr);
 
@@ -21,6 +21,8 @@
 * 1.05a hk     08/22/13 Added reset function
 * 3.00  kvn    02/13/15 Modified code for MISRA-C:2012 compliance.
 * 4.00  sd     02/02/24 Added wait for transmission done function
+* 4.1   kt     10/18/26 Added XUartPs_SetSendByteHandler() to redirect
+*			XUartPs_SendByte() of a device.
 * </pre>
 *
 *****************************************************************************/
@@ -39,6 +41,10 @@
 
 /************************** Variable Definitions *****************************/
 
+static u32 SendByteAddress;
+static XUartPs_SendByteHandler SendByteHandler;
+static void *SendByteRef;
+
 /****************************************************************************/
 /**
 *
@@ -55,13 +61,18 @@
 *****************************************************************************/
 void XUartPs_SendByte(u32 BaseAddress, u8 Data)
 {
-	/* Wait until there is space in TX FIFO */
-	while (XUartPs_IsTransmitFull(BaseAddress)) {
-		;
+	if ((SendByteHandler != NULL) && (BaseAddress == SendByteAddress)) {
+		/* Hand the byte over, e.g. to the TX ring of the device */
+		SendByteHandler(SendByteRef, Data);
+	} else {
+		/* Wait until there is space in TX FIFO */
+		while (XUartPs_IsTransmitFull(BaseAddress)) {
+			;
+		}
+
+		/* Write the byte into the TX FIFO */
+		XUartPs_WriteReg(BaseAddress, XUARTPS_FIFO_OFFSET, (u32)Data);
 	}
-
-	/* Write the byte into the TX FIFO */
-	XUartPs_WriteReg(BaseAddress, XUARTPS_FIFO_OFFSET, (u32)Data);
 }
 
 /****************************************************************************/
@@ -176,6 +187,31 @@ void XUartPs_WaitTransmitDone(u32 BaseAddress)
 	}
 }
 
+/****************************************************************************/
+/**
+*
+* This function sets a handler that takes the bytes sent to a device with
+* XUartPs_SendByte(), which is what outbyte() and so xil_printf() use for
+* stdout. Only one device can be redirected at a time.
+*
+* @param	BaseAddress contains the base address of the device.
+* @param	FuncPtr is the handler, NULL to write to the TX FIFO again.
+* @param	CallBackRef is passed back to the handler.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XUartPs_SetSendByteHandler(u32 BaseAddress,
+				XUartPs_SendByteHandler FuncPtr,
+				void *CallBackRef)
+{
+	SendByteHandler = NULL;
+	SendByteAddress = BaseAddress;
+	SendByteRef = CallBackRef;
+	SendByteHandler = FuncPtr;
+}
 
 #ifdef SDT
 #ifdef XPAR_STDIN_IS_UARTPS
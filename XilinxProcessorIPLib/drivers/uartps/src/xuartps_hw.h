@@ -34,6 +34,7 @@
 *			modem control register.
 * 4.0   sd     02/02/24 Added macros for transmission FIFO empty check
 *                       and transmission active state check
+* 4.1   kt     10/18/26 Added XUartPs_SetSendByteHandler().
 *
 * </pre>
 *
@@ -339,6 +340,12 @@ extern "C" {
 
 /**************************** Type Definitions *******************************/
 
+/*
+ * Handler that takes the bytes of XUartPs_SendByte() for a device instead of
+ * the TX FIFO, e.g. to queue stdout in the ring mode.
+ */
+typedef void (*XUartPs_SendByteHandler) (void *CallBackRef, u8 Data);
+
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -451,6 +458,10 @@ void XUartPs_ResetHw(u32 BaseAddress);
 
 void XUartPs_WaitTransmitDone(u32 BaseAddress);
 
+void XUartPs_SetSendByteHandler(u32 BaseAddress,
+				XUartPs_SendByteHandler FuncPtr,
+				void *CallBackRef);
+
 /************************** Variable Definitions *****************************/
 
 #ifdef __cplusplus
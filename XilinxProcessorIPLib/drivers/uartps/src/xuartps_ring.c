@@ -0,0 +1,569 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file xuartps_ring.c
+* @addtogroup uartps Overview
+* @{
+*
+* This file contains the functions for the ring mode.
+*
+* In the ring mode the data goes through a TX and an RX ring in memory:
+*
+* - XUartPs_RingSend() copies the data into the TX ring and returns. The
+*   interrupt handler refills the TX FIFO with up to XUARTPS_FIFO_SIZE bytes
+*   each time it gets empty. The data that does not fit in the TX ring is
+*   dropped and counted.
+* - The interrupt handler empties the RX FIFO into the RX ring when it
+*   reaches the trigger level, or when the receive timeout expires for the
+*   last bytes of a burst. XUartPs_RingRecv() gets the data from the RX ring.
+* - XUartPs_RingSetStdout() sends the bytes of XUartPs_SendByte(), and so of
+*   xil_printf() on stdout, to the TX ring. Printing does not wait on the
+*   UART anymore.
+*
+* Each ring has one producer and one consumer, the rings are not locked.
+* XUartPs_RingSend() and xil_printf() must not be called from an interrupt
+* handler while they may also run at the task level.
+*
+* The PS UART has no DMA request lines, so a DMA channel would not be paced by
+* the TX FIFO. The handler writes a full FIFO per TX empty interrupt instead,
+* with no status read in between.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date	Changes
+* ----- ------ -------- -----------------------------------------------
+* 4.1   kt     10/18/26 First Release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xuartps.h"
+
+/************************** Constant Definitions ****************************/
+
+/**************************** Type Definitions ******************************/
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Function Prototypes *****************************/
+
+static void XUartPs_RingStartSend(XUartPsRing *RingPtr);
+static void XUartPs_RingFillTxFifo(XUartPsRing *RingPtr, u32 FifoEmpty);
+static u32 XUartPs_RingDrainRxFifo(XUartPsRing *RingPtr);
+static void XUartPs_RingSendByte(void *CallBackRef, u8 Data);
+static void XUartPs_RingNullHandler(void *CallBackRef, u32 Event,
+				    u32 ByteCount);
+
+/************************** Variable Definitions ****************************/
+
+/****************************************************************************/
+/**
+*
+* This function initializes the ring mode of a device. It sets the RX FIFO
+* trigger level to XUARTPS_RING_RX_TRIGGER and the receive timeout to
+* XUARTPS_RING_RX_TIMEOUT, which can be changed afterwards with
+* XUartPs_SetFifoThreshold() and XUartPs_SetRecvTimeout(), and enables the
+* RX interrupts. XUartPs_RingInterruptHandler() must be connected to the
+* interrupt of the device instead of XUartPs_InterruptHandler().
+*
+* The application handler is set to one that ignores the events, so the
+* ring mode works without one. XUartPs_SetHandler() must be called after
+* this function to get the events.
+*
+* @param	RingPtr is a pointer to the XUartPsRing to be initialized.
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	TxBufferPtr is a pointer to the storage of the TX ring.
+* @param	TxSize is the size of the TX ring in bytes, a power of two.
+* @param	RxBufferPtr is a pointer to the storage of the RX ring.
+* @param	RxSize is the size of the RX ring in bytes, a power of two.
+*
+* @return	XST_SUCCESS.
+*
+* @note		None.
+*
+*****************************************************************************/
+s32 XUartPs_RingInitialize(XUartPsRing *RingPtr, XUartPs *InstancePtr,
+			   u8 *TxBufferPtr, u32 TxSize,
+			   u8 *RxBufferPtr, u32 RxSize)
+{
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(RingPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(TxBufferPtr != NULL);
+	Xil_AssertNonvoid(RxBufferPtr != NULL);
+	Xil_AssertNonvoid((TxSize != (u32)0) &&
+			  ((TxSize & (TxSize - (u32)1)) == (u32)0));
+	Xil_AssertNonvoid((RxSize != (u32)0) &&
+			  ((RxSize & (RxSize - (u32)1)) == (u32)0));
+
+	RingPtr->InstancePtr = InstancePtr;
+	RingPtr->TxRing.BufferPtr = TxBufferPtr;
+	RingPtr->TxRing.Size = TxSize;
+	RingPtr->TxRing.Head = (u32)0;
+	RingPtr->TxRing.Tail = (u32)0;
+	RingPtr->RxRing.BufferPtr = RxBufferPtr;
+	RingPtr->RxRing.Size = RxSize;
+	RingPtr->RxRing.Head = (u32)0;
+	RingPtr->RxRing.Tail = (u32)0;
+	RingPtr->TxActive = (u32)0;
+	XUartPs_RingClearStats(RingPtr);
+
+	/* The stub handler of XUartPs_CfgInitialize() asserts when called */
+	XUartPs_SetHandler(InstancePtr, XUartPs_RingNullHandler, NULL);
+
+	XUartPs_SetFifoThreshold(InstancePtr, (u8)XUARTPS_RING_RX_TRIGGER);
+	XUartPs_SetRecvTimeout(InstancePtr, (u8)XUARTPS_RING_RX_TIMEOUT);
+
+	/*
+	 * The TX empty interrupt is enabled by XUartPs_RingSend() while the
+	 * TX ring holds data
+	 */
+	XUartPs_SetInterruptMask(InstancePtr, (u32)XUARTPS_IXR_RXOVR |
+				 (u32)XUARTPS_IXR_RXFULL | (u32)XUARTPS_IXR_TOUT |
+				 (u32)XUARTPS_IXR_OVER | (u32)XUARTPS_IXR_FRAMING |
+				 (u32)XUARTPS_IXR_PARITY);
+
+	return (s32)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function sends data through the TX ring. It does not wait: the data
+* that does not fit in the TX ring is dropped and counted in TxDropped.
+*
+* @param	RingPtr is a pointer to the XUartPsRing instance.
+* @param	BufferPtr is pointer to the data to be sent.
+* @param	NumBytes is the number of bytes to be sent.
+*
+* @return	The number of bytes queued.
+*
+* @note		None.
+*
+*****************************************************************************/
+u32 XUartPs_RingSend(XUartPsRing *RingPtr, const u8 *BufferPtr,
+		     u32 NumBytes)
+{
+	XUartPsRingBuffer *TxRingPtr;
+	u32 Head;
+	u32 Count;
+
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(RingPtr != NULL);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+
+	TxRingPtr = &RingPtr->TxRing;
+	Head = TxRingPtr->Head;
+	for (Count = (u32)0; Count < NumBytes; Count++) {
+		if ((Head - TxRingPtr->Tail) >= TxRingPtr->Size) {
+			break;
+		}
+		TxRingPtr->BufferPtr[Head & (TxRingPtr->Size - (u32)1)] =
+			BufferPtr[Count];
+		Head++;
+	}
+	RingPtr->Stats.TxDropped += NumBytes - Count;
+
+	/* Publish the data once it is in the ring */
+	TxRingPtr->Head = Head;
+
+	/*
+	 * If the handler is refilling the TX FIFO, it picks the data up.
+	 * Otherwise start the sending here.
+	 */
+	if ((Count != (u32)0) && (RingPtr->TxActive == (u32)0)) {
+		XUartPs_RingStartSend(RingPtr);
+	}
+
+	return Count;
+}
+
+/****************************************************************************/
+/**
+*
+* This function receives data from the RX ring.
+*
+* @param	RingPtr is a pointer to the XUartPsRing instance.
+* @param	BufferPtr is pointer to buffer for data to be received into.
+* @param	NumBytes is the maximum number of bytes to be received.
+*
+* @return	The number of bytes received, 0 if the RX ring is empty.
+*
+* @note		None.
+*
+*****************************************************************************/
+u32 XUartPs_RingRecv(XUartPsRing *RingPtr, u8 *BufferPtr, u32 NumBytes)
+{
+	XUartPsRingBuffer *RxRingPtr;
+	u32 Tail;
+	u32 Count;
+
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(RingPtr != NULL);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+
+	RxRingPtr = &RingPtr->RxRing;
+	Tail = RxRingPtr->Tail;
+	for (Count = (u32)0; Count < NumBytes; Count++) {
+		if (Tail == RxRingPtr->Head) {
+			break;
+		}
+		BufferPtr[Count] =
+			RxRingPtr->BufferPtr[Tail & (RxRingPtr->Size - (u32)1)];
+		Tail++;
+	}
+
+	/* Hand the space back once the data is copied */
+	RxRingPtr->Tail = Tail;
+
+	return Count;
+}
+
+/****************************************************************************/
+/**
+*
+* This function is the interrupt handler for the ring mode. It empties the
+* RX FIFO into the RX ring and refills the TX FIFO from the TX ring.
+*
+* The application handler set with XUartPs_SetHandler() is called with
+* XUARTPS_EVENT_RECV_DATA and the number of bytes in the RX ring when data
+* is received, with XUARTPS_EVENT_RECV_ERROR on a receive error and with
+* XUARTPS_EVENT_SENT_DATA when the TX ring gets empty.
+*
+* @param	RingPtr is a pointer to the XUartPsRing instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XUartPs_RingInterruptHandler(XUartPsRing *RingPtr)
+{
+	XUartPs *InstancePtr;
+	u32 IsrStatus;
+	u32 RecvCount = (u32)0;
+
+	Xil_AssertVoid(RingPtr != NULL);
+
+	InstancePtr = RingPtr->InstancePtr;
+	RingPtr->Stats.Interrupts++;
+
+	IsrStatus = XUartPs_ReadReg(InstancePtr->Config.BaseAddress,
+				   XUARTPS_IMR_OFFSET);
+	IsrStatus &= XUartPs_ReadReg(InstancePtr->Config.BaseAddress,
+				   XUARTPS_ISR_OFFSET);
+
+	/*
+	 * Clear the interrupt status first, so that the events of the data
+	 * arriving or leaving while it is handled are not lost
+	 */
+	XUartPs_WriteReg(InstancePtr->Config.BaseAddress, XUARTPS_ISR_OFFSET,
+			 IsrStatus);
+
+	if ((IsrStatus & ((u32)XUARTPS_IXR_OVER | (u32)XUARTPS_IXR_FRAMING |
+			  (u32)XUARTPS_IXR_PARITY)) != (u32)0) {
+		RingPtr->Stats.RxErrors++;
+	}
+
+	if ((IsrStatus & ((u32)XUARTPS_IXR_RXOVR | (u32)XUARTPS_IXR_RXFULL |
+			  (u32)XUARTPS_IXR_TOUT | (u32)XUARTPS_IXR_OVER |
+			  (u32)XUARTPS_IXR_FRAMING | (u32)XUARTPS_IXR_PARITY))
+	    != (u32)0) {
+		RecvCount = XUartPs_RingDrainRxFifo(RingPtr);
+	}
+
+	if ((IsrStatus & (u32)XUARTPS_IXR_TXEMPTY) != (u32)0) {
+		if (RingPtr->TxRing.Head != RingPtr->TxRing.Tail) {
+			XUartPs_RingFillTxFifo(RingPtr, TRUE);
+		} else {
+			/*
+			 * Nothing left to send, stop the TX empty interrupt
+			 * until XUartPs_RingSend() starts the sending again
+			 */
+			XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
+					 XUARTPS_IDR_OFFSET,
+					 (u32)XUARTPS_IXR_TXEMPTY);
+			RingPtr->TxActive = (u32)0;
+
+			InstancePtr->Handler(InstancePtr->CallBackRef,
+					     XUARTPS_EVENT_SENT_DATA,
+					     RingPtr->Stats.TxBytes);
+		}
+	}
+
+	if ((IsrStatus & ((u32)XUARTPS_IXR_OVER | (u32)XUARTPS_IXR_FRAMING |
+			  (u32)XUARTPS_IXR_PARITY)) != (u32)0) {
+		InstancePtr->Handler(InstancePtr->CallBackRef,
+				     XUARTPS_EVENT_RECV_ERROR, IsrStatus);
+	}
+
+	if (RecvCount != (u32)0) {
+		InstancePtr->Handler(InstancePtr->CallBackRef,
+				     XUARTPS_EVENT_RECV_DATA,
+				     RingPtr->RxRing.Head - RingPtr->RxRing.Tail);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This function sends the bytes of XUartPs_SendByte() for the device, and so
+* of xil_printf() when the device is stdout, to the TX ring.
+*
+* @param	RingPtr is a pointer to the XUartPsRing instance.
+* @param	Enable is TRUE to redirect the bytes to the TX ring, FALSE to
+*		write them to the TX FIFO again.
+*
+* @return	None.
+*
+* @note		Bytes printed while the TX ring is full are dropped and
+*		counted in TxDropped.
+*
+*****************************************************************************/
+void XUartPs_RingSetStdout(XUartPsRing *RingPtr, u32 Enable)
+{
+	Xil_AssertVoid(RingPtr != NULL);
+
+	if (Enable != (u32)FALSE) {
+		XUartPs_SetSendByteHandler(
+			(u32)RingPtr->InstancePtr->Config.BaseAddress,
+			XUartPs_RingSendByte, RingPtr);
+	} else {
+		XUartPs_SetSendByteHandler(
+			(u32)RingPtr->InstancePtr->Config.BaseAddress,
+			NULL, NULL);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This function gets a copy of the statistics of the ring mode. Throughput is
+* obtained by sampling TxBytes and RxBytes at a known interval.
+*
+* @param	RingPtr is a pointer to the XUartPsRing instance.
+* @param	StatsPtr is a pointer to the structure to copy the statistics to.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XUartPs_RingGetStats(XUartPsRing *RingPtr, XUartPsRingStats *StatsPtr)
+{
+	Xil_AssertVoid(RingPtr != NULL);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	*StatsPtr = RingPtr->Stats;
+}
+
+/****************************************************************************/
+/**
+*
+* This function clears the statistics of the ring mode.
+*
+* @param	RingPtr is a pointer to the XUartPsRing instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XUartPs_RingClearStats(XUartPsRing *RingPtr)
+{
+	Xil_AssertVoid(RingPtr != NULL);
+
+	RingPtr->Stats.TxBytes = (u32)0;
+	RingPtr->Stats.RxBytes = (u32)0;
+	RingPtr->Stats.TxDropped = (u32)0;
+	RingPtr->Stats.RxDropped = (u32)0;
+	RingPtr->Stats.RxErrors = (u32)0;
+	RingPtr->Stats.Interrupts = (u32)0;
+}
+
+/****************************************************************************/
+/**
+*
+* This function starts the sending of the TX ring when the interrupt handler
+* is not refilling the TX FIFO.
+*
+* @param	RingPtr is a pointer to the XUartPsRing instance.
+*
+* @return	None.
+*
+* @note		The TX empty interrupt is disabled at this point, so the
+*		interrupt handler does not touch the TX FIFO meanwhile. Its
+*		status is latched though, from the last time the TX FIFO got
+*		empty: it is cleared once the TX FIFO is refilled, so that
+*		the interrupt handler only writes a full FIFO to an empty one.
+*
+*****************************************************************************/
+static void XUartPs_RingStartSend(XUartPsRing *RingPtr)
+{
+	u32 BaseAddress = RingPtr->InstancePtr->Config.BaseAddress;
+
+	XUartPs_RingFillTxFifo(RingPtr,
+			       XUartPs_IsTransmitEmpty(RingPtr->InstancePtr));
+
+	/* Let the interrupt handler send what did not fit in the TX FIFO */
+	while (RingPtr->TxRing.Head != RingPtr->TxRing.Tail) {
+		XUartPs_WriteReg(BaseAddress, XUARTPS_ISR_OFFSET,
+				 (u32)XUARTPS_IXR_TXEMPTY);
+		if (!XUartPs_IsTransmitEmpty(RingPtr->InstancePtr)) {
+			RingPtr->TxActive = (u32)1;
+			XUartPs_WriteReg(BaseAddress, XUARTPS_IER_OFFSET,
+					 (u32)XUARTPS_IXR_TXEMPTY);
+			break;
+		}
+
+		/* The TX FIFO got empty before its status was cleared */
+		XUartPs_RingFillTxFifo(RingPtr, TRUE);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This function writes data from the TX ring to the TX FIFO until the TX FIFO
+* is full or the TX ring is empty.
+*
+* @param	RingPtr is a pointer to the XUartPsRing instance.
+* @param	FifoEmpty is TRUE if the TX FIFO is known to be empty, then a
+*		full FIFO is written without reading the status.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XUartPs_RingFillTxFifo(XUartPsRing *RingPtr, u32 FifoEmpty)
+{
+	XUartPsRingBuffer *TxRingPtr = &RingPtr->TxRing;
+	u32 BaseAddress = RingPtr->InstancePtr->Config.BaseAddress;
+	u32 Tail = TxRingPtr->Tail;
+	u32 Head = TxRingPtr->Head;
+	u32 Count = (u32)0;
+
+	if (FifoEmpty != (u32)FALSE) {
+		while ((Count < XUARTPS_FIFO_SIZE) && (Tail != Head)) {
+			XUartPs_WriteReg(BaseAddress, XUARTPS_FIFO_OFFSET,
+					 (u32)TxRingPtr->BufferPtr[Tail &
+						(TxRingPtr->Size - (u32)1)]);
+			Tail++;
+			Count++;
+		}
+	} else {
+		while ((Tail != Head) &&
+		       (!XUartPs_IsTransmitFull(BaseAddress))) {
+			XUartPs_WriteReg(BaseAddress, XUARTPS_FIFO_OFFSET,
+					 (u32)TxRingPtr->BufferPtr[Tail &
+						(TxRingPtr->Size - (u32)1)]);
+			Tail++;
+			Count++;
+		}
+	}
+
+	TxRingPtr->Tail = Tail;
+	RingPtr->Stats.TxBytes += Count;
+}
+
+/****************************************************************************/
+/**
+*
+* This function reads all the data of the RX FIFO into the RX ring. The data
+* that does not fit in the RX ring is dropped and counted in RxDropped.
+*
+* @param	RingPtr is a pointer to the XUartPsRing instance.
+*
+* @return	The number of bytes read from the RX FIFO.
+*
+* @note		When the RX FIFO is over the trigger level, that many bytes
+*		are read without reading the status.
+*
+*****************************************************************************/
+static u32 XUartPs_RingDrainRxFifo(XUartPsRing *RingPtr)
+{
+	XUartPsRingBuffer *RxRingPtr = &RingPtr->RxRing;
+	u32 BaseAddress = RingPtr->InstancePtr->Config.BaseAddress;
+	u32 Head = RxRingPtr->Head;
+	u32 Known = (u32)0;
+	u32 Count = (u32)0;
+	u32 Dropped = (u32)0;
+	u8 Data;
+
+	if ((XUartPs_ReadReg(BaseAddress, XUARTPS_SR_OFFSET) &
+	     (u32)XUARTPS_SR_RXOVR) != (u32)0) {
+		Known = XUartPs_ReadReg(BaseAddress, XUARTPS_RXWM_OFFSET) &
+			(u32)XUARTPS_RXWM_MASK;
+	}
+
+	while ((Count < Known) || XUartPs_IsReceiveData(BaseAddress)) {
+		Data = (u8)XUartPs_ReadReg(BaseAddress, XUARTPS_FIFO_OFFSET);
+		if ((Head - RxRingPtr->Tail) < RxRingPtr->Size) {
+			RxRingPtr->BufferPtr[Head & (RxRingPtr->Size - (u32)1)] =
+				Data;
+			Head++;
+		} else {
+			Dropped++;
+		}
+		Count++;
+	}
+
+	/* Publish the data once it is in the ring */
+	RxRingPtr->Head = Head;
+	RingPtr->Stats.RxBytes += Count;
+	RingPtr->Stats.RxDropped += Dropped;
+
+	return Count;
+}
+
+/****************************************************************************/
+/**
+*
+* This function is the XUartPs_SendByte() handler set by
+* XUartPs_RingSetStdout().
+*
+* @param	CallBackRef is a pointer to the XUartPsRing instance.
+* @param	Data is the byte to be sent.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XUartPs_RingSendByte(void *CallBackRef, u8 Data)
+{
+	(void)XUartPs_RingSend((XUartPsRing *)CallBackRef, &Data, (u32)1);
+}
+/****************************************************************************/
+/**
+*
+* This function is the application handler set by XUartPs_RingInitialize(),
+* it ignores the events.
+*
+* @param	CallBackRef is unused by this function.
+* @param	Event is unused by this function.
+* @param	ByteCount is unused by this function.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XUartPs_RingNullHandler(void *CallBackRef, u32 Event,
+				    u32 ByteCount)
+{
+	(void)CallBackRef;
+	(void)Event;
+	(void)ByteCount;
+}
+/** @} */
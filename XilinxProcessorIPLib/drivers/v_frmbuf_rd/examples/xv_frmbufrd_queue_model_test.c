@@ -0,0 +1,364 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_frmbufrd_queue_model_test.c
+*
+* Host test of the buffer queue of the frame buffer read driver against a
+* software model of the core registers. It is not a target example: it is
+* built and run with the other driver model tests by make -C
+* scripts/host_model.
+*
+* At every ap_ready the model latches the programmed buffer address and field
+* id and runs the interrupt handler. The application side submits numbered
+* frames and receives the released ones at random, with both queue policies.
+* The core must only ever read a frame held by the driver and a frame must
+* not be released while it is read or programmed. With XVFRMBUFRD_QUEUE_FIFO
+* every frame is read in order. With XVFRMBUFRD_QUEUE_LATEST the newest
+* frame queued at a frame start is read next. Without a new frame the last
+* one is read again. XVFrmbufRd_QueueStop() must release every frame it
+* holds.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.8   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "xv_frmbufrd_l2.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define CORE_BASE	0x40000000U	/* Base address of the core */
+#define CORE_SPAN	0x100U		/* Registers of the core */
+#define QUEUE_SIZE	4U		/* Frames the queue can hold */
+#define NUM_BUFFERS	6U		/* Buffers of the application */
+#define BUFFER_BASE	0x10000000U	/* Luma address of the first buffer */
+#define BUFFER_SPAN	0x01000000U	/* Address space of a buffer */
+#define NUM_STEPS	20000U		/* Steps of the random sequence */
+#define NO_FRAME	0xFFFFFFFFU	/* No frame read since the start */
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define REG(Offset)	Regs[(Offset) / 4U]
+
+/************************** Function Prototypes ******************************/
+
+static void CoreInit(XVFrmbufRd_QueuePolicy Policy);
+static UINTPTR Programmed(void);
+static void Submit(u32 Buffer);
+static u32 Receive(void);
+static void Frame(void);
+static void Start(void);
+static void CheckStop(void);
+static void Run(XVFrmbufRd_QueuePolicy Policy);
+
+/************************** Variable Definitions *****************************/
+
+static u32 Regs[CORE_SPAN / 4U];
+static XV_FrmbufRd_l2 FrmbufRd;
+static XVFrmbufRd_Queue Queue;
+static XVidC_FrameDesc Desc[2U * QUEUE_SIZE];
+
+/* Model state: owner and frame of the buffers, the buffer being read, the
+ * frames submitted and the last one read */
+static u8 HeldByApp[NUM_BUFFERS];
+static u32 Content[NUM_BUFFERS];
+static u32 Reading;
+static u32 NumSubmitted;
+static u32 Submitted;		/* Frames submitted at the last frame start */
+static u32 LastRead;
+static u32 IsFirst;		/* Next frame start is the first one */
+static u32 NumRepeats;
+
+/* Configuration table of the SDT initialization, the core is set up by
+ * XV_frmbufrd_CfgInitialize() */
+XV_frmbufrd_Config XV_frmbufrd_ConfigTable[] = { { NULL } };
+
+/*****************************************************************************/
+/*
+* Register model: plain memory, a flush is done at once.
+*/
+u32 Xil_In32(UINTPTR Addr)
+{
+	return Regs[(Addr - CORE_BASE) / 4U];
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	if ((Addr - CORE_BASE) == XV_FRMBUFRD_CTRL_ADDR_AP_CTRL) {
+		if ((Value & XV_FRMBUFRD_CTRL_BITS_FLUSH_BIT) != 0U) {
+			Value |= XV_FRMBUFRD_CTRL_BITS_FLUSH_STATUSBIT;
+		}
+	}
+	Regs[(Addr - CORE_BASE) / 4U] = Value;
+}
+
+static void CoreInit(XVFrmbufRd_QueuePolicy Policy)
+{
+	XV_frmbufrd_Config Cfg;
+	u32 Buffer;
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	Cfg.Name = "frmbufrd";
+	Cfg.PixPerClk = 2U;
+	Cfg.MaxWidth = 3840U;
+	Cfg.MaxHeight = 2160U;
+	Cfg.MaxDataWidth = 8U;
+	Cfg.AXIMMDataWidth = 128U;
+	Cfg.AXIMMAddrWidth = 64U;
+	Cfg.Interlaced = 1U;
+
+	memset(Regs, 0, sizeof(Regs));
+	memset(&FrmbufRd, 0, sizeof(FrmbufRd));
+	(void)XV_frmbufrd_CfgInitialize(&FrmbufRd.FrmbufRd, &Cfg, CORE_BASE);
+	XHOST_CHECK(XVFrmbufRd_QueueInit(&FrmbufRd, &Queue, Desc, QUEUE_SIZE,
+					 Policy, NULL) == XST_SUCCESS,
+		    "queue init");
+
+	for (Buffer = 0U; Buffer < NUM_BUFFERS; Buffer++) {
+		HeldByApp[Buffer] = 1U;
+	}
+	Reading = NUM_BUFFERS;
+	NumSubmitted = 0U;
+	NumRepeats = 0U;
+}
+
+/*****************************************************************************/
+/*
+* Buffer address in the registers, read at the next frame start.
+*/
+static UINTPTR Programmed(void)
+{
+	return ((UINTPTR)REG(XV_FRMBUFRD_CTRL_ADDR_HWREG_FRM_BUFFER_V_DATA + 4U)
+		<< 32) | REG(XV_FRMBUFRD_CTRL_ADDR_HWREG_FRM_BUFFER_V_DATA);
+}
+
+/*****************************************************************************/
+/*
+* Gives the next frame to the driver, in buffer Buffer.
+*/
+static void Submit(u32 Buffer)
+{
+	XVidC_FrameDesc Frame;
+
+	memset(&Frame, 0, sizeof(Frame));
+	Frame.LumaAddr = BUFFER_BASE + ((UINTPTR)Buffer * BUFFER_SPAN);
+	Frame.ChromaAddr = Frame.LumaAddr + (BUFFER_SPAN / 2U);
+	Frame.FieldId = NumSubmitted & 1U;
+	if (Queue.NumQueued >= QUEUE_SIZE) {
+		XHOST_CHECK(XVFrmbufRd_QueueSubmit(&FrmbufRd, &Frame) ==
+			    XST_FAILURE, "buffer %u submitted to a full queue",
+			    (unsigned)Buffer);
+		return;
+	}
+	XHOST_CHECK(XVFrmbufRd_QueueSubmit(&FrmbufRd, &Frame) == XST_SUCCESS,
+		    "buffer %u not submitted", (unsigned)Buffer);
+	Content[Buffer] = NumSubmitted++;
+	HeldByApp[Buffer] = 0U;
+}
+
+/*****************************************************************************/
+/*
+* Receives a released frame. Returns its buffer, or NUM_BUFFERS if none.
+*/
+static u32 Receive(void)
+{
+	XVidC_FrameDesc Frame;
+	u32 Buffer;
+
+	if (XVFrmbufRd_QueueReceive(&FrmbufRd, &Frame) != XST_SUCCESS) {
+		return NUM_BUFFERS;
+	}
+
+	Buffer = (u32)((Frame.LumaAddr - BUFFER_BASE) / BUFFER_SPAN);
+	XHOST_CHECK((Buffer < NUM_BUFFERS) && !HeldByApp[Buffer],
+		    "released buffer 0x%lx", (unsigned long)Frame.LumaAddr);
+	if (Buffer >= NUM_BUFFERS) {
+		return NUM_BUFFERS;
+	}
+	if (Queue.IsRunning) {
+		XHOST_CHECK((Buffer != Reading) &&
+			    (Frame.LumaAddr != Programmed()),
+			    "frame %u released while read",
+			    (unsigned)Content[Buffer]);
+	}
+	HeldByApp[Buffer] = 1U;
+
+	return Buffer;
+}
+
+/*****************************************************************************/
+/*
+* The core starts a frame: the programmed buffer and field are latched.
+*/
+static void Frame(void)
+{
+	UINTPTR Addr = Programmed();
+	u32 Buffer = (u32)((Addr - BUFFER_BASE) / BUFFER_SPAN);
+	u32 Expected;
+
+	XHOST_CHECK((Buffer < NUM_BUFFERS) && !HeldByApp[Buffer],
+		    "buffer 0x%lx read", (unsigned long)Addr);
+	if (Buffer >= NUM_BUFFERS) {
+		return;
+	}
+
+	/* A new frame when one was queued at the last frame start: the oldest
+	 * one when started, else the next or the newest one */
+	if (IsFirst) {
+		Expected = (LastRead == NO_FRAME) ? 0U : LastRead + 1U;
+	} else if ((Submitted != 0U) && ((Submitted - 1U) > LastRead)) {
+		Expected = (Queue.Policy == XVFRMBUFRD_QUEUE_LATEST) ?
+			   (Submitted - 1U) : (LastRead + 1U);
+	} else {
+		Expected = LastRead;
+		NumRepeats++;
+	}
+	XHOST_CHECK(Content[Buffer] == Expected, "frame %u read, expected %u",
+		    (unsigned)Content[Buffer], (unsigned)Expected);
+	XHOST_CHECK(REG(XV_FRMBUFRD_CTRL_ADDR_HWREG_FIELD_ID_DATA) ==
+		    (Content[Buffer] & 1U), "frame %u field id %u",
+		    (unsigned)Content[Buffer],
+		    (unsigned)REG(XV_FRMBUFRD_CTRL_ADDR_HWREG_FIELD_ID_DATA));
+	Reading = Buffer;
+	LastRead = Content[Buffer];
+	IsFirst = 0U;
+
+	Submitted = NumSubmitted;
+	REG(XV_FRMBUFRD_CTRL_ADDR_ISR) |= XVFRMBUFRD_IRQ_READY_MASK;
+	XVFrmbufRd_InterruptHandler(&FrmbufRd);
+}
+
+/*****************************************************************************/
+/*
+* Starts the queue, with a frame submitted if none is queued.
+*/
+static void Start(void)
+{
+	u32 Buffer;
+
+	if (Queue.Ready.Head == Queue.Ready.Tail) {
+		for (Buffer = 0U; !HeldByApp[Buffer]; Buffer++) {
+		}
+		Submit(Buffer);
+	}
+	XHOST_CHECK(XVFrmbufRd_QueueStart(&FrmbufRd) == XST_SUCCESS,
+		    "queue not started");
+	IsFirst = 1U;
+}
+
+/*****************************************************************************/
+/*
+* Stops the queue. Every frame held by the driver must be released, the
+* frames queued and never read too.
+*/
+static void CheckStop(void)
+{
+	u32 Buffer;
+
+	XHOST_CHECK(XVFrmbufRd_QueueStop(&FrmbufRd) == XST_SUCCESS,
+		    "queue not stopped");
+	Reading = NUM_BUFFERS;
+	while (Receive() != NUM_BUFFERS) {
+	}
+	for (Buffer = 0U; Buffer < NUM_BUFFERS; Buffer++) {
+		XHOST_CHECK(HeldByApp[Buffer], "buffer %u not released",
+			    (unsigned)Buffer);
+	}
+	XHOST_CHECK(Queue.NumQueued == 0U, "%u frames held",
+		    (unsigned)Queue.NumQueued);
+
+	/* The frames queued before are gone */
+	LastRead = NumSubmitted - 1U;
+}
+
+/*****************************************************************************/
+/*
+* Random application with one queue policy.
+*/
+static void Run(XVFrmbufRd_QueuePolicy Policy)
+{
+	u32 Buffer;
+	u32 Step;
+
+	CoreInit(Policy);
+	LastRead = NO_FRAME;
+	for (Buffer = 0U; Buffer < NUM_BUFFERS; Buffer++) {
+		Submit(Buffer);
+	}
+	XHOST_CHECK(Queue.NumQueued == QUEUE_SIZE, "%u frames queued",
+		    (unsigned)Queue.NumQueued);
+
+	/* Nothing more submitted: the last frame is read again */
+	Start();
+	for (Step = 0U; Step < 10U; Step++) {
+		Frame();
+	}
+	XHOST_CHECK(Queue.NumRepeated == NumRepeats, "%u repeats, %u counted",
+		    (unsigned)NumRepeats, (unsigned)Queue.NumRepeated);
+	XHOST_CHECK(LastRead == (QUEUE_SIZE - 1U), "frame %u read last",
+		    (unsigned)LastRead);
+	XHOST_CHECK((Policy == XVFRMBUFRD_QUEUE_LATEST) ?
+		    (Queue.NumDropped == (QUEUE_SIZE - 2U)) :
+		    (Queue.NumDropped == 0U), "%u frames dropped",
+		    (unsigned)Queue.NumDropped);
+	CheckStop();
+
+	srand(1);
+	for (Step = 0U; Step < NUM_STEPS; Step++) {
+		if ((Step % 1000U) == 0U) {
+			if (Step != 0U) {
+				CheckStop();
+			}
+			Start();
+		}
+		switch (rand() % 5) {
+		case 0:
+			(void)Receive();
+			break;
+		case 1:
+		case 2:
+			Buffer = (u32)rand() % NUM_BUFFERS;
+			if (HeldByApp[Buffer]) {
+				Submit(Buffer);
+			}
+			break;
+		default:
+			Frame();
+			break;
+		}
+	}
+	CheckStop();
+	XHOST_CHECK(Queue.NumRepeated == NumRepeats, "%u repeats, %u counted",
+		    (unsigned)NumRepeats, (unsigned)Queue.NumRepeated);
+
+	printf("%s: %u frames read, %u repeated, %u dropped\n",
+	       (Policy == XVFRMBUFRD_QUEUE_LATEST) ? "latest" : "fifo",
+	       (unsigned)Queue.NumFrames, (unsigned)Queue.NumRepeated,
+	       (unsigned)Queue.NumDropped);
+	XHOST_CHECK((Policy == XVFRMBUFRD_QUEUE_LATEST) ==
+		    (Queue.NumDropped != 0U), "%u frames dropped",
+		    (unsigned)Queue.NumDropped);
+}
+
+int main(void)
+{
+	Run(XVFRMBUFRD_QUEUE_FIFO);
+	Run(XVFRMBUFRD_QUEUE_LATEST);
+
+	return XHostModel_Report("xv_frmbufrd_queue_model_test");
+}
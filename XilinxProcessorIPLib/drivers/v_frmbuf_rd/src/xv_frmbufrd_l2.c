@@ -36,6 +36,7 @@
 * 4.50  pg    01/07/21   Added new registers to support fid_out interlace solution.
 *						Interrupt count support for throughput measurement.
 * 4.70  pg    05/23/23   Added new 3 planar video format Y_U_V8_420.
+* 4.8   kt    10/18/26   Report buffer queue statistics
 * </pre>
 *
 ******************************************************************************/
@@ -1007,6 +1008,14 @@ void XVFrmbufRd_DbgReportStatus(XV_FrmbufRd_l2 *InstancePtr)
 	xil_printf("Video Format:               %d\r\n",   XV_frmbufrd_Get_HwReg_video_format(&InstancePtr->FrmbufRd));
 	xil_printf("Buffer Address:             0x%x\r\n", XV_frmbufrd_Get_HwReg_frm_buffer_V(&InstancePtr->FrmbufRd));
 	xil_printf("Chroma Buffer Address:      0x%x\r\n", XV_frmbufrd_Get_HwReg_frm_buffer2_V(&InstancePtr->FrmbufRd));
+
+	if (InstancePtr->QueuePtr) {
+		xil_printf("Queue Running:              %d\r\n", InstancePtr->QueuePtr->IsRunning);
+		xil_printf("Queue Buffers:              %d\r\n", InstancePtr->QueuePtr->NumQueued);
+		xil_printf("Queue Frames Read:          %d\r\n", InstancePtr->QueuePtr->NumFrames);
+		xil_printf("Queue Frames Repeated:      %d\r\n", InstancePtr->QueuePtr->NumRepeated);
+		xil_printf("Queue Frames Dropped:       %d\r\n", InstancePtr->QueuePtr->NumDropped);
+	}
 }
 
 /** @} */
@@ -75,6 +75,29 @@
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
 *
+* <b> Buffer Queue </b>
+*
+* XVFrmbufRd_SetBufferAddr() programs the address of the next frame only, and
+* the application has to program a new address after each ap_ready. Instead,
+* a queue of buffers can be attached with XVFrmbufRd_QueueInit():
+*   - The application gives frames to be read to the driver with
+*     XVFrmbufRd_QueueSubmit() and gets the buffers back with
+*     XVFrmbufRd_QueueReceive() once they are read. A frame is described by an
+*     XVidC_FrameDesc.
+*   - XVFrmbufRd_QueueStart() enables the ap_ready interrupt and auto restart
+*     and starts the core. At each ap_ready the interrupt handler releases the
+*     frame read before and programs the next frame.
+*   - When no frame is queued the address is not changed and the current
+*     frame is repeated. With the XVFRMBUFRD_QUEUE_LATEST policy, the frames
+*     queued behind a newer one are dropped, so the latest frame is always
+*     read next.
+*   - XVFrmbufRd_QueueStop() stops the core and releases the frames held by
+*     the driver.
+* The queues are rings with one producer and one consumer, the application
+* and the interrupt handler, which need no locking. Frames received from a
+* frame buffer write queue can be submitted as is, which converts the frame
+* rate between the two cores without copy.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -100,6 +123,7 @@
 * 4.50  kp    13/07/21   Added new 3 planar video format Y_U_V8
 * 4.60  kp    12/03/21   Added new 3 planar video format Y_U_V10
 * 4.70  pg    05/23/23   Added new 3 planar video format Y_U_V8_420.
+* 4.8   kt    10/18/26   Added buffer queue
 * </pre>
 *
 ******************************************************************************/
@@ -153,6 +177,53 @@ typedef enum {
 */
 typedef void (*XVFrmbufRd_Callback)(void *CallbackRef);
 
+/**
+ * This typedef enumerates the policies of the buffer queue
+ */
+typedef enum {
+  XVFRMBUFRD_QUEUE_FIFO = 0,   /**< Read every queued frame in order */
+  XVFRMBUFRD_QUEUE_LATEST      /**< Drop frames queued behind a newer one */
+} XVFrmbufRd_QueuePolicy;
+
+/**
+ * This typedef contains a ring of frame descriptors, with one producer and
+ * one consumer
+ */
+typedef struct {
+    XVidC_FrameDesc *DescPtr;  /**< Descriptors, provided by the user */
+    u32 Size;                  /**< Number of descriptors, a power of 2 */
+    volatile u32 Head;         /**< Write index, free running */
+    volatile u32 Tail;         /**< Read index, free running */
+}XVFrmbufRd_Ring;
+
+/**
+ * Time source of the frame timestamps. Returns a free running count in any
+ * unit
+ */
+typedef u32 (*XVFrmbufRd_QueueTimer)(void);
+
+/**
+ * This typedef contains the buffer queue. It is provided by the application
+ * and attached to the instance with XVFrmbufRd_QueueInit()
+ */
+typedef struct {
+    XVFrmbufRd_Ring Ready;       /**< Frames to read, from the application */
+    XVFrmbufRd_Ring Released;    /**< Frames read, to the application */
+    XVidC_FrameDesc Programmed;  /**< Frame in the address registers */
+    XVidC_FrameDesc Active;      /**< Frame being read */
+    u8 HasProgrammed;            /**< Programmed holds a frame */
+    u8 HasActive;                /**< Active holds a frame */
+    u8 IsRepeat;                 /**< Programmed is the Active frame */
+    volatile u8 IsRunning;       /**< Queue is started */
+    XVFrmbufRd_QueuePolicy Policy; /**< Policy when frames are queued */
+    u32 NumQueued;               /**< Frames given and not received back */
+    XVFrmbufRd_QueueTimer Timer; /**< Time source, NULL if not used */
+    u32 Sequence;                /**< Sequence number of the next frame */
+    u32 NumFrames;               /**< Frames read */
+    u32 NumRepeated;             /**< Frames read again, no frame queued */
+    u32 NumDropped;              /**< Frames released without being read */
+}XVFrmbufRd_Queue;
+
 /**
  * Frame Buffer Read driver Layer 2 data. The user is required to allocate a
  * variable of this type for every frame buffer read device in the system. A
@@ -172,6 +243,7 @@ typedef struct {
                                 callback */
 
     XVidC_VideoStream Stream;    /**< Output AXIS */
+    XVFrmbufRd_Queue *QueuePtr;  /**< Buffer queue, NULL if not used */
 }XV_FrmbufRd_l2;
 
 /************************** Macros Definitions *******************************/
@@ -703,6 +775,21 @@ u32 XVFrmbufRd_Get_FidErrorCount(XV_FrmbufRd_l2 *InstancePtr);
 u32 XVFrmbufRd_Get_FieldOut(XV_FrmbufRd_l2 *InstancePtr);
 void XVFrmbufRd_DbgReportStatus(XV_FrmbufRd_l2 *InstancePtr);
 
+/* Buffer queue related function */
+int XVFrmbufRd_QueueInit(XV_FrmbufRd_l2 *InstancePtr,
+                         XVFrmbufRd_Queue *QueuePtr,
+                         XVidC_FrameDesc *DescPtr,
+                         u32 Size,
+                         XVFrmbufRd_QueuePolicy Policy,
+                         XVFrmbufRd_QueueTimer Timer);
+int XVFrmbufRd_QueueSubmit(XV_FrmbufRd_l2 *InstancePtr,
+                           const XVidC_FrameDesc *FramePtr);
+int XVFrmbufRd_QueueReceive(XV_FrmbufRd_l2 *InstancePtr,
+                            XVidC_FrameDesc *FramePtr);
+int XVFrmbufRd_QueueStart(XV_FrmbufRd_l2 *InstancePtr);
+int XVFrmbufRd_QueueStop(XV_FrmbufRd_l2 *InstancePtr);
+void XVFrmbufRd_QueueReadyHandler(XV_FrmbufRd_l2 *InstancePtr);
+
 /* Interrupt related function */
 void XVFrmbufRd_InterruptHandler(void *InstancePtr);
 int XVFrmbufRd_SetCallback(XV_FrmbufRd_l2 *InstancePtr,
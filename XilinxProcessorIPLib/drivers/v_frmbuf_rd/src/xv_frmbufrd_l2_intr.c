@@ -24,6 +24,7 @@
 * 4.20  pg    01/31/20   Removed Frmbuf start function from Interrupt handler.
 * 4.50  pg    01/07/21   Added new registers to support fid_out interlace solution.
 *						Interrupt count support for throughput measurement.
+* 4.8   kt    10/18/26   Advance the buffer queue on ap_ready
 * </pre>
 *
 ******************************************************************************/
@@ -135,6 +136,10 @@ void XVFrmbufRd_InterruptHandler(void *InstancePtr)
 	if(Status & XVFRMBUFRD_IRQ_READY_MASK) {
 		/* Clear the interrupt */
 		XV_frmbufrd_InterruptClear(&FrmbufRdPtr->FrmbufRd, XVFRMBUFRD_IRQ_READY_MASK);
+		//Release the read frame and program the next one, if queued
+		if((FrmbufRdPtr->QueuePtr != NULL) && FrmbufRdPtr->QueuePtr->IsRunning) {
+			XVFrmbufRd_QueueReadyHandler(FrmbufRdPtr);
+		}
 		//Call user registered callback function, if any
 		if(FrmbufRdPtr->FrameReadyCallback) {
 			FrmbufRdPtr->FrameReadyCallback(FrmbufRdPtr->CallbackReadyRef);
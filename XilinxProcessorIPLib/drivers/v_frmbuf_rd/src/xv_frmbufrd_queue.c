@@ -0,0 +1,385 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_frmbufrd_queue.c
+* @addtogroup v_frmbuf_rd Overview
+* @{
+*
+* The functions in this file provide the buffer queue of the frame buffer
+* read driver. See xv_frmbufrd_l2.h for a description of the queue.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.8   kt    10/18/26   Initial Release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xv_frmbufrd_l2.h"
+
+/************************** Function Prototypes ******************************/
+static int RingPut(XVFrmbufRd_Ring *RingPtr, const XVidC_FrameDesc *FramePtr);
+static int RingGet(XVFrmbufRd_Ring *RingPtr, XVidC_FrameDesc *FramePtr);
+static void ProgramFrame(XV_FrmbufRd_l2 *InstancePtr,
+			 const XVidC_FrameDesc *FramePtr);
+
+/*****************************************************************************/
+/**
+* This function attaches a buffer queue to the core instance
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  QueuePtr is a pointer to the queue provided by the application
+* @param  DescPtr is a pointer to 2 * Size descriptors provided by the
+*         application, for the queued frame and the released frame rings
+* @param  Size is the number of frames the queue can hold, a power of 2
+* @param  Policy is the policy when more than one frame is queued
+* @param  Timer is the time source of the frame timestamps, NULL if not used
+*
+* @return XST_SUCCESS or XST_INVALID_PARAM if Size is not a power of 2
+*
+******************************************************************************/
+int XVFrmbufRd_QueueInit(XV_FrmbufRd_l2 *InstancePtr,
+			 XVFrmbufRd_Queue *QueuePtr,
+			 XVidC_FrameDesc *DescPtr,
+			 u32 Size,
+			 XVFrmbufRd_QueuePolicy Policy,
+			 XVFrmbufRd_QueueTimer Timer)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(DescPtr != NULL);
+	Xil_AssertNonvoid(Policy <= XVFRMBUFRD_QUEUE_LATEST);
+
+	if ((Size == 0) || ((Size & (Size - 1)) != 0)) {
+		return(XST_INVALID_PARAM);
+	}
+
+	memset(QueuePtr, 0, sizeof(XVFrmbufRd_Queue));
+	QueuePtr->Ready.DescPtr = DescPtr;
+	QueuePtr->Ready.Size = Size;
+	QueuePtr->Released.DescPtr = &DescPtr[Size];
+	QueuePtr->Released.Size = Size;
+	QueuePtr->Policy = Policy;
+	QueuePtr->Timer = Timer;
+
+	InstancePtr->QueuePtr = QueuePtr;
+	return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function gives a frame to be read to the driver
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  FramePtr is a pointer to the frame descriptor. The buffer addresses
+*         and, if interlaced, the field id are used
+*
+* @return XST_SUCCESS if the frame is queued
+*         XVFRMBUFRD_ERR_MEM_ADDR_MISALIGNED if an address is misaligned
+*         XST_FAILURE if the queue holds Size frames
+*
+* @note   Must not be called from the interrupt handler
+*
+******************************************************************************/
+int XVFrmbufRd_QueueSubmit(XV_FrmbufRd_l2 *InstancePtr,
+			   const XVidC_FrameDesc *FramePtr)
+{
+	XVFrmbufRd_Queue *QueuePtr;
+	UINTPTR Align;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->QueuePtr != NULL);
+	Xil_AssertNonvoid(FramePtr != NULL);
+	Xil_AssertNonvoid(FramePtr->LumaAddr != 0);
+
+	QueuePtr = InstancePtr->QueuePtr;
+
+	/* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
+	Align = 2 * InstancePtr->FrmbufRd.Config.PixPerClk * 4;
+	if (((FramePtr->LumaAddr % Align) != 0) ||
+	    ((FramePtr->ChromaAddr % Align) != 0) ||
+	    ((FramePtr->VChromaAddr % Align) != 0)) {
+		return(XVFRMBUFRD_ERR_MEM_ADDR_MISALIGNED);
+	}
+
+	/* Bounding the frames held by the driver by Size ensures the rings can
+	 * never overflow */
+	if (QueuePtr->NumQueued >= QueuePtr->Ready.Size) {
+		return(XST_FAILURE);
+	}
+
+	RingPut(&QueuePtr->Ready, FramePtr);
+	QueuePtr->NumQueued++;
+	return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function gets the oldest released frame from the driver. The buffer
+* is not read by the core anymore
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  FramePtr is a pointer to the descriptor to be filled
+*
+* @return XST_SUCCESS or XST_NO_DATA if no frame is released
+*
+* @note   Must not be called from the interrupt handler
+*
+******************************************************************************/
+int XVFrmbufRd_QueueReceive(XV_FrmbufRd_l2 *InstancePtr,
+			    XVidC_FrameDesc *FramePtr)
+{
+	XVFrmbufRd_Queue *QueuePtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->QueuePtr != NULL);
+	Xil_AssertNonvoid(FramePtr != NULL);
+
+	QueuePtr = InstancePtr->QueuePtr;
+
+	if (RingGet(&QueuePtr->Released, FramePtr) != XST_SUCCESS) {
+		return(XST_NO_DATA);
+	}
+
+	QueuePtr->NumQueued--;
+	return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function programs the first queued frame, enables the ap_ready
+* interrupt with auto restart and starts the core
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return XST_SUCCESS or XST_NO_DATA if no frame was submitted
+*
+* @note   The interrupt handler must be connected, see
+*         XVFrmbufRd_InterruptHandler()
+*
+******************************************************************************/
+int XVFrmbufRd_QueueStart(XV_FrmbufRd_l2 *InstancePtr)
+{
+	XVFrmbufRd_Queue *QueuePtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->QueuePtr != NULL);
+
+	QueuePtr = InstancePtr->QueuePtr;
+	Xil_AssertNonvoid(!QueuePtr->IsRunning);
+
+	if (RingGet(&QueuePtr->Ready, &QueuePtr->Programmed) != XST_SUCCESS) {
+		return(XST_NO_DATA);
+	}
+	ProgramFrame(InstancePtr, &QueuePtr->Programmed);
+	QueuePtr->HasProgrammed = TRUE;
+	QueuePtr->HasActive = FALSE;
+	QueuePtr->IsRepeat = FALSE;
+	QueuePtr->IsRunning = TRUE;
+
+	XVFrmbufRd_InterruptEnable(InstancePtr, XVFRMBUFRD_IRQ_READY_MASK);
+	XV_frmbufrd_EnableAutoRestart(&InstancePtr->FrmbufRd);
+	XV_frmbufrd_Start(&InstancePtr->FrmbufRd);
+
+	return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function stops the core and releases the frames held by the driver
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return XST_SUCCESS if the core is stopped
+*         XST_FAILURE if the core is not in stop state
+*
+* @note   The frames still in the queued frame ring are released too
+*
+******************************************************************************/
+int XVFrmbufRd_QueueStop(XV_FrmbufRd_l2 *InstancePtr)
+{
+	XVFrmbufRd_Queue *QueuePtr;
+	XVidC_FrameDesc Frame;
+	int Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->QueuePtr != NULL);
+
+	QueuePtr = InstancePtr->QueuePtr;
+
+	XV_frmbufrd_InterruptDisable(&InstancePtr->FrmbufRd,
+				     XVFRMBUFRD_IRQ_READY_MASK);
+	QueuePtr->IsRunning = FALSE;
+
+	Status = XVFrmbufRd_Stop(InstancePtr);
+
+	/* The handler is stopped, the released frame ring can be filled from
+	 * here */
+	if (QueuePtr->HasActive) {
+		RingPut(&QueuePtr->Released, &QueuePtr->Active);
+	}
+	if (QueuePtr->HasProgrammed && !QueuePtr->IsRepeat) {
+		RingPut(&QueuePtr->Released, &QueuePtr->Programmed);
+	}
+	while (RingGet(&QueuePtr->Ready, &Frame) == XST_SUCCESS) {
+		RingPut(&QueuePtr->Released, &Frame);
+	}
+	QueuePtr->HasActive = FALSE;
+	QueuePtr->HasProgrammed = FALSE;
+	QueuePtr->IsRepeat = FALSE;
+
+	return(Status);
+}
+
+/*****************************************************************************/
+/**
+* This function advances the queue when the core has started a frame. The
+* frame read before is released to the application and the next queued
+* frame is programmed
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return none
+*
+* @note   Called by XVFrmbufRd_InterruptHandler() on ap_ready
+*
+******************************************************************************/
+void XVFrmbufRd_QueueReadyHandler(XV_FrmbufRd_l2 *InstancePtr)
+{
+	XVFrmbufRd_Queue *QueuePtr;
+	XVidC_FrameDesc Newer;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->QueuePtr != NULL);
+
+	QueuePtr = InstancePtr->QueuePtr;
+
+	/* A repeated frame is still being read */
+	if (QueuePtr->HasActive && !QueuePtr->IsRepeat) {
+		RingPut(&QueuePtr->Released, &QueuePtr->Active);
+	}
+
+	/* The programmed frame is being read */
+	if (QueuePtr->HasProgrammed) {
+		if (QueuePtr->IsRepeat) {
+			QueuePtr->NumRepeated++;
+		} else {
+			if (QueuePtr->Timer) {
+				QueuePtr->Programmed.Timestamp = QueuePtr->Timer();
+			}
+			QueuePtr->Programmed.Sequence = QueuePtr->Sequence++;
+			QueuePtr->NumFrames++;
+		}
+	}
+	QueuePtr->Active = QueuePtr->Programmed;
+	QueuePtr->HasActive = QueuePtr->HasProgrammed;
+
+	if (RingGet(&QueuePtr->Ready, &QueuePtr->Programmed) == XST_SUCCESS) {
+		if (QueuePtr->Policy == XVFRMBUFRD_QUEUE_LATEST) {
+			while (RingGet(&QueuePtr->Ready, &Newer) == XST_SUCCESS) {
+				RingPut(&QueuePtr->Released, &QueuePtr->Programmed);
+				QueuePtr->Programmed = Newer;
+				QueuePtr->NumDropped++;
+			}
+		}
+		ProgramFrame(InstancePtr, &QueuePtr->Programmed);
+		QueuePtr->HasProgrammed = TRUE;
+		QueuePtr->IsRepeat = FALSE;
+	} else {
+		/* Keep the registers, the next frame reads the active buffer again */
+		QueuePtr->Programmed = QueuePtr->Active;
+		QueuePtr->IsRepeat = QueuePtr->HasActive;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function adds a descriptor to a ring
+*
+* @param  RingPtr is a pointer to the ring
+* @param  FramePtr is a pointer to the descriptor
+*
+* @return XST_SUCCESS or XST_FAILURE if the ring is full
+*
+******************************************************************************/
+static int RingPut(XVFrmbufRd_Ring *RingPtr, const XVidC_FrameDesc *FramePtr)
+{
+	u32 Head = RingPtr->Head;
+
+	if ((Head - RingPtr->Tail) >= RingPtr->Size) {
+		return(XST_FAILURE);
+	}
+
+	RingPtr->DescPtr[Head & (RingPtr->Size - 1)] = *FramePtr;
+	/* The descriptor must be visible before the new Head is */
+	DATA_SYNC;
+	RingPtr->Head = Head + 1;
+	return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function removes the oldest descriptor from a ring
+*
+* @param  RingPtr is a pointer to the ring
+* @param  FramePtr is a pointer to the descriptor to be filled
+*
+* @return XST_SUCCESS or XST_NO_DATA if the ring is empty
+*
+******************************************************************************/
+static int RingGet(XVFrmbufRd_Ring *RingPtr, XVidC_FrameDesc *FramePtr)
+{
+	u32 Tail = RingPtr->Tail;
+
+	if (Tail == RingPtr->Head) {
+		return(XST_NO_DATA);
+	}
+
+	/* Read the descriptor only after the Head that published it, and
+	 * complete the read before the slot is released to the producer */
+	DATA_SYNC;
+	*FramePtr = RingPtr->DescPtr[Tail & (RingPtr->Size - 1)];
+	DATA_SYNC;
+	RingPtr->Tail = Tail + 1;
+	return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function programs the buffer addresses and the field id of a frame
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  FramePtr is a pointer to the frame descriptor
+*
+* @return none
+*
+******************************************************************************/
+static void ProgramFrame(XV_FrmbufRd_l2 *InstancePtr,
+			 const XVidC_FrameDesc *FramePtr)
+{
+	XV_frmbufrd_Set_HwReg_frm_buffer_V(&InstancePtr->FrmbufRd,
+					   FramePtr->LumaAddr);
+	if (FramePtr->ChromaAddr != 0) {
+		XV_frmbufrd_Set_HwReg_frm_buffer2_V(&InstancePtr->FrmbufRd,
+						    FramePtr->ChromaAddr);
+	}
+	if (FramePtr->VChromaAddr != 0) {
+		XV_frmbufrd_Set_HwReg_frm_buffer3_V(&InstancePtr->FrmbufRd,
+						    FramePtr->VChromaAddr);
+	}
+	if (XVFrmbufRd_InterlacedEnabled(InstancePtr)) {
+		XV_frmbufrd_Set_HwReg_field_id(&InstancePtr->FrmbufRd,
+					       FramePtr->FieldId);
+	}
+}
+/** @} */
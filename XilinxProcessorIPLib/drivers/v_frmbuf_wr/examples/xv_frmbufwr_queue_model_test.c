@@ -0,0 +1,328 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_frmbufwr_queue_model_test.c
+*
+* Host test of the buffer queue of the frame buffer write driver against a
+* software model of the core registers. It is not a target example: it is
+* built and run with the other driver model tests by make -C
+* scripts/host_model.
+*
+* At every ap_ready the model latches the programmed buffer address and runs
+* the interrupt handler, the frame started before is then complete. The
+* application side submits and receives buffers at random. The core must
+* only ever write a buffer held by the driver. Every frame must either be
+* received, in order and in the buffer it was written to, or be dropped
+* because no empty buffer was left. XVFrmbufWr_QueueStop() must give every
+* buffer it holds back to the empty buffer ring, and a restart must run from
+* them.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.8   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "xv_frmbufwr_l2.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define CORE_BASE	0x40000000U	/* Base address of the core */
+#define CORE_SPAN	0x100U		/* Registers of the core */
+#define QUEUE_SIZE	4U		/* Buffers the queue can hold */
+#define NUM_BUFFERS	6U		/* Buffers of the application */
+#define BUFFER_BASE	0x10000000U	/* Luma address of the first buffer */
+#define BUFFER_SPAN	0x01000000U	/* Address space of a buffer */
+#define NUM_STEPS	20000U		/* Steps of the random sequence */
+#define FRAME_TIME	1000U		/* Timer ticks of a frame */
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define REG(Offset)	Regs[(Offset) / 4U]
+
+/************************** Function Prototypes ******************************/
+
+static u32 Timer(void);
+static void CoreInit(void);
+static void Submit(u32 Buffer);
+static u32 Receive(void);
+static void Frame(void);
+static void CheckStop(void);
+
+/************************** Variable Definitions *****************************/
+
+static u32 Regs[CORE_SPAN / 4U];
+static u32 Clock;
+static XV_FrmbufWr_l2 FrmbufWr;
+static XVFrmbufWr_Queue Queue;
+static XVidC_FrameDesc Desc[2U * QUEUE_SIZE];
+
+/* Model state: owner of the buffers, the buffer being written and the frame
+ * number written in each buffer */
+static u8 HeldByApp[NUM_BUFFERS];
+static u32 Writing = NUM_BUFFERS;
+static u32 Content[NUM_BUFFERS];
+static u32 NumStarted;
+static u32 NumReceived;
+static u32 LastReceived;
+
+/* Configuration table of the SDT initialization, the core is set up by
+ * XV_frmbufwr_CfgInitialize() */
+XV_frmbufwr_Config XV_frmbufwr_ConfigTable[] = { { NULL } };
+
+/*****************************************************************************/
+/*
+* Register model: plain memory, a flush is done at once.
+*/
+u32 Xil_In32(UINTPTR Addr)
+{
+	return Regs[(Addr - CORE_BASE) / 4U];
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	if ((Addr - CORE_BASE) == XV_FRMBUFWR_CTRL_ADDR_AP_CTRL) {
+		if ((Value & XV_FRMBUFWR_CTRL_BITS_FLUSH_BIT) != 0U) {
+			Value |= XV_FRMBUFWR_CTRL_BITS_FLUSH_STATUSBIT;
+		}
+	}
+	Regs[(Addr - CORE_BASE) / 4U] = Value;
+}
+
+static u32 Timer(void)
+{
+	return Clock;
+}
+
+static void CoreInit(void)
+{
+	XV_frmbufwr_Config Cfg;
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	Cfg.Name = "frmbufwr";
+	Cfg.PixPerClk = 2U;
+	Cfg.MaxWidth = 3840U;
+	Cfg.MaxHeight = 2160U;
+	Cfg.MaxDataWidth = 8U;
+	Cfg.AXIMMDataWidth = 128U;
+	Cfg.AXIMMAddrWidth = 64U;
+
+	memset(&FrmbufWr, 0, sizeof(FrmbufWr));
+	(void)XV_frmbufwr_CfgInitialize(&FrmbufWr.FrmbufWr, &Cfg, CORE_BASE);
+}
+
+/*****************************************************************************/
+/*
+* Gives buffer Buffer to the driver.
+*/
+static void Submit(u32 Buffer)
+{
+	XVidC_FrameDesc Frame;
+
+	memset(&Frame, 0, sizeof(Frame));
+	Frame.LumaAddr = BUFFER_BASE + ((UINTPTR)Buffer * BUFFER_SPAN);
+	Frame.ChromaAddr = Frame.LumaAddr + (BUFFER_SPAN / 2U);
+	if (Queue.NumQueued >= QUEUE_SIZE) {
+		XHOST_CHECK(XVFrmbufWr_QueueSubmit(&FrmbufWr, &Frame) ==
+			    XST_FAILURE, "buffer %u submitted to a full queue",
+			    (unsigned)Buffer);
+		return;
+	}
+	XHOST_CHECK(XVFrmbufWr_QueueSubmit(&FrmbufWr, &Frame) == XST_SUCCESS,
+		    "buffer %u not submitted", (unsigned)Buffer);
+	HeldByApp[Buffer] = 0U;
+}
+
+/*****************************************************************************/
+/*
+* Receives a written frame. Returns its buffer, or NUM_BUFFERS if none.
+*/
+static u32 Receive(void)
+{
+	XVidC_FrameDesc Frame;
+	u32 Buffer;
+
+	if (XVFrmbufWr_QueueReceive(&FrmbufWr, &Frame) != XST_SUCCESS) {
+		return NUM_BUFFERS;
+	}
+
+	Buffer = (u32)((Frame.LumaAddr - BUFFER_BASE) / BUFFER_SPAN);
+	XHOST_CHECK((Buffer < NUM_BUFFERS) && !HeldByApp[Buffer] &&
+		    (Frame.ChromaAddr == (Frame.LumaAddr + (BUFFER_SPAN / 2U))),
+		    "received buffer 0x%lx", (unsigned long)Frame.LumaAddr);
+	if (Buffer >= NUM_BUFFERS) {
+		return NUM_BUFFERS;
+	}
+	XHOST_CHECK(Buffer != Writing, "buffer %u received while written",
+		    (unsigned)Buffer);
+
+	/* Frames arrive in order, the newer frames of a full queue dropped */
+	XHOST_CHECK((NumReceived == 0U) || (Content[Buffer] > LastReceived),
+		    "frame %u received after frame %u",
+		    (unsigned)Content[Buffer], (unsigned)LastReceived);
+	XHOST_CHECK(Frame.Sequence == NumReceived, "sequence %u, expected %u",
+		    (unsigned)Frame.Sequence, (unsigned)NumReceived);
+	/* Complete when the next frame is started */
+	XHOST_CHECK(Frame.Timestamp == ((Content[Buffer] + 2U) * FRAME_TIME),
+		    "frame %u time %u", (unsigned)Content[Buffer],
+		    (unsigned)Frame.Timestamp);
+	LastReceived = Content[Buffer];
+	NumReceived++;
+	HeldByApp[Buffer] = 1U;
+
+	return Buffer;
+}
+
+/*****************************************************************************/
+/*
+* The core starts a frame: the programmed buffer is latched, the frame
+* before is complete.
+*/
+static void Frame(void)
+{
+	UINTPTR Addr;
+	u32 Buffer;
+
+	Clock += FRAME_TIME;
+	Addr = ((UINTPTR)REG(XV_FRMBUFWR_CTRL_ADDR_HWREG_FRM_BUFFER_V_DATA + 4U)
+		<< 32) | REG(XV_FRMBUFWR_CTRL_ADDR_HWREG_FRM_BUFFER_V_DATA);
+	Buffer = (u32)((Addr - BUFFER_BASE) / BUFFER_SPAN);
+	XHOST_CHECK((Buffer < NUM_BUFFERS) && !HeldByApp[Buffer],
+		    "frame %u written to buffer 0x%lx", (unsigned)NumStarted,
+		    (unsigned long)Addr);
+	if (Buffer < NUM_BUFFERS) {
+		Writing = Buffer;
+		Content[Buffer] = NumStarted;
+	}
+	NumStarted++;
+
+	REG(XV_FRMBUFWR_CTRL_ADDR_ISR) |= XVFRMBUFWR_IRQ_READY_MASK;
+	XVFrmbufWr_InterruptHandler(&FrmbufWr);
+}
+
+/*****************************************************************************/
+/*
+* Stops the queue. The buffers held by the driver must be back in the empty
+* buffer ring, the written frames still in the written frame ring.
+*/
+static void CheckStop(void)
+{
+	u32 NumApp = 0U;
+	u32 Buffer;
+
+	XHOST_CHECK(XVFrmbufWr_QueueStop(&FrmbufWr) == XST_SUCCESS,
+		    "queue not stopped");
+	Writing = NUM_BUFFERS;
+	while (Receive() != NUM_BUFFERS) {
+	}
+	for (Buffer = 0U; Buffer < NUM_BUFFERS; Buffer++) {
+		NumApp += HeldByApp[Buffer];
+	}
+	XHOST_CHECK((Queue.Free.Head - Queue.Free.Tail) == Queue.NumQueued,
+		    "%u buffers held, %u returned", (unsigned)Queue.NumQueued,
+		    (unsigned)(Queue.Free.Head - Queue.Free.Tail));
+	XHOST_CHECK((NumApp + Queue.NumQueued) == NUM_BUFFERS,
+		    "%u buffers lost", (unsigned)(NUM_BUFFERS - NumApp -
+						  Queue.NumQueued));
+	XHOST_CHECK(!Queue.HasActive && !Queue.HasProgrammed,
+		    "buffers left in the driver");
+}
+
+int main(void)
+{
+	u32 Buffer;
+	u32 Step;
+	u32 NumReady;
+
+	CoreInit();
+	XHOST_CHECK(XVFrmbufWr_QueueInit(&FrmbufWr, &Queue, Desc, 3U, Timer) ==
+		    XST_INVALID_PARAM, "queue of 3 buffers");
+	XHOST_CHECK(XVFrmbufWr_QueueInit(&FrmbufWr, &Queue, Desc, QUEUE_SIZE,
+					 Timer) == XST_SUCCESS, "queue init");
+	XHOST_CHECK(XVFrmbufWr_QueueStart(&FrmbufWr) == XST_NO_DATA,
+		    "started without buffer");
+	memset(&Desc[0], 0, sizeof(Desc[0]));
+	Desc[0].LumaAddr = BUFFER_BASE + 8U;
+	XHOST_CHECK(XVFrmbufWr_QueueSubmit(&FrmbufWr, &Desc[0]) ==
+		    XVFRMBUFWR_ERR_MEM_ADDR_MISALIGNED, "misaligned buffer");
+	for (Buffer = 0U; Buffer < NUM_BUFFERS; Buffer++) {
+		HeldByApp[Buffer] = 1U;
+		Submit(Buffer);
+	}
+	XHOST_CHECK(Queue.NumQueued == QUEUE_SIZE, "%u buffers queued",
+		    (unsigned)Queue.NumQueued);
+
+	/* Nothing received: the last buffer is written over and over */
+	XHOST_CHECK(XVFrmbufWr_QueueStart(&FrmbufWr) == XST_SUCCESS, "start");
+	for (Step = 0U; Step < 10U; Step++) {
+		Frame();
+	}
+	XHOST_CHECK((Queue.NumFrames == (QUEUE_SIZE - 1U)) &&
+		    (Queue.NumDropped == (10U - QUEUE_SIZE)),
+		    "full queue: %u frames, %u dropped",
+		    (unsigned)Queue.NumFrames, (unsigned)Queue.NumDropped);
+	XHOST_CHECK(Writing == (QUEUE_SIZE - 1U), "buffer %u written",
+		    (unsigned)Writing);
+	XHOST_CHECK(Receive() == 0U, "first frame not in buffer 0");
+	Submit(0U);
+	Frame();
+	Frame();
+	XHOST_CHECK(Writing == 0U, "returned buffer not written");
+	CheckStop();
+
+	/* Random application, restarted from the returned buffers */
+	srand(1);
+	NumReady = 0U;
+	for (Step = 0U; Step < NUM_STEPS; Step++) {
+		if ((Step % 1000U) == 0U) {
+			if (Step != 0U) {
+				CheckStop();
+			}
+			XHOST_CHECK(XVFrmbufWr_QueueStart(&FrmbufWr) ==
+				    XST_SUCCESS, "restart at step %u",
+				    (unsigned)Step);
+			NumReady = Queue.NumFrames + Queue.NumDropped;
+		}
+		switch (rand() % 4) {
+		case 0:
+			(void)Receive();
+			break;
+		case 1:
+			Buffer = (u32)rand() % NUM_BUFFERS;
+			if (HeldByApp[Buffer]) {
+				Submit(Buffer);
+			}
+			break;
+		default:
+			Frame();
+			NumReady++;
+			XHOST_CHECK((Queue.NumFrames + Queue.NumDropped + 1U) ==
+				    NumReady, "step %u: %u frames, %u dropped",
+				    (unsigned)Step, (unsigned)Queue.NumFrames,
+				    (unsigned)Queue.NumDropped);
+			break;
+		}
+	}
+	CheckStop();
+
+	printf("%u frames started, %u received, %u dropped\n",
+	       (unsigned)NumStarted, (unsigned)NumReceived,
+	       (unsigned)Queue.NumDropped);
+	XHOST_CHECK(Queue.NumDropped != 0U, "no frame dropped");
+
+	return XHostModel_Report("xv_frmbufwr_queue_model_test");
+}
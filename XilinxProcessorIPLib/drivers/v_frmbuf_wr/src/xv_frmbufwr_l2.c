@@ -36,6 +36,7 @@
 * 4.50  kp    12/07/21   Added new 3 planar video format Y_U_V8.
 * 4.60  kp    10/27/21   Added new 3 planar video format Y_U_V10.
 * 4.70  pg    05/23/23   Added new 3 planar video format Y_U_V8_420.
+* 4.8   kt    10/18/26   Report buffer queue statistics
 * </pre>
 *
 ******************************************************************************/
@@ -837,6 +838,13 @@ void XVFrmbufWr_DbgReportStatus(XV_FrmbufWr_l2 *InstancePtr)
   xil_printf("Video Format:               %d\r\n", XV_frmbufwr_Get_HwReg_video_format(&InstancePtr->FrmbufWr));
   xil_printf("Buffer Address:             0x%x\r\n", XV_frmbufwr_Get_HwReg_frm_buffer_V(&InstancePtr->FrmbufWr));
   xil_printf("Chroma Buffer Address:      0x%x\r\n", XV_frmbufwr_Get_HwReg_frm_buffer2_V(&InstancePtr->FrmbufWr));
+
+  if (InstancePtr->QueuePtr) {
+    xil_printf("Queue Running:              %d\r\n", InstancePtr->QueuePtr->IsRunning);
+    xil_printf("Queue Buffers:              %d\r\n", InstancePtr->QueuePtr->NumQueued);
+    xil_printf("Queue Frames Written:       %d\r\n", InstancePtr->QueuePtr->NumFrames);
+    xil_printf("Queue Frames Dropped:       %d\r\n", InstancePtr->QueuePtr->NumDropped);
+  }
 }
 
 /** @} */
@@ -75,6 +75,28 @@
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
 *
+* <b> Buffer Queue </b>
+*
+* XVFrmbufWr_SetBufferAddr() programs the address of the next frame only, and
+* the application has to program a new address after each ap_ready. Instead,
+* a queue of buffers can be attached with XVFrmbufWr_QueueInit():
+*   - The application gives empty buffers to the driver with
+*     XVFrmbufWr_QueueSubmit() and gets written frames back with
+*     XVFrmbufWr_QueueReceive(). A frame is described by an XVidC_FrameDesc.
+*   - XVFrmbufWr_QueueStart() enables the ap_ready interrupt and auto restart
+*     and starts the core. At each ap_ready the interrupt handler returns the
+*     frame just written, with its timestamp, sequence number and field id,
+*     and programs the next empty buffer.
+*   - When there is no empty buffer the address is not changed, the next frame
+*     overwrites the current one and the current frame is dropped.
+*   - XVFrmbufWr_QueueStop() stops the core and gives the buffers held by the
+*     driver back to the queue of empty buffers.
+* The queues are rings with one producer and one consumer, the application
+* and the interrupt handler, which need no locking. The frames received from
+* a frame buffer write queue can be submitted as is to a frame buffer read
+* queue, and the frames released by the read queue submitted back to the
+* write queue.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -100,6 +122,7 @@
 * 4.50  kp    12/07/21   Added new 3 planar video format Y_U_V8.
 * 4.60  kp    10/27/21   Added new 3 planar video format Y_U_V10.
 * 4.70  pg    05/23/23   Added new 3 planar video format Y_U_V8_420.
+* 4.8   kt    10/18/26   Added buffer queue
 * </pre>
 *
 ******************************************************************************/
@@ -153,6 +176,43 @@ typedef enum {
 */
 typedef void (*XVFrmbufWr_Callback)(void *CallbackRef);
 
+/**
+ * This typedef contains a ring of frame descriptors, with one producer and
+ * one consumer
+ */
+typedef struct {
+    XVidC_FrameDesc *DescPtr;  /**< Descriptors, provided by the user */
+    u32 Size;                  /**< Number of descriptors, a power of 2 */
+    volatile u32 Head;         /**< Write index, free running */
+    volatile u32 Tail;         /**< Read index, free running */
+}XVFrmbufWr_Ring;
+
+/**
+ * Time source of the frame timestamps. Returns a free running count in any
+ * unit
+ */
+typedef u32 (*XVFrmbufWr_QueueTimer)(void);
+
+/**
+ * This typedef contains the buffer queue. It is provided by the application
+ * and attached to the instance with XVFrmbufWr_QueueInit()
+ */
+typedef struct {
+    XVFrmbufWr_Ring Free;        /**< Empty buffers, from the application */
+    XVFrmbufWr_Ring Done;        /**< Written frames, to the application */
+    XVidC_FrameDesc Programmed;  /**< Buffer in the address registers */
+    XVidC_FrameDesc Active;      /**< Buffer being written */
+    u8 HasProgrammed;            /**< Programmed holds a buffer */
+    u8 HasActive;                /**< Active holds a buffer */
+    u8 IsRepeat;                 /**< Programmed is the Active buffer */
+    volatile u8 IsRunning;       /**< Queue is started */
+    u32 NumQueued;               /**< Buffers given and not received back */
+    XVFrmbufWr_QueueTimer Timer; /**< Time source, NULL if not used */
+    u32 Sequence;                /**< Sequence number of the next frame */
+    u32 NumFrames;               /**< Frames written and returned */
+    u32 NumDropped;              /**< Frames overwritten, no empty buffer */
+}XVFrmbufWr_Queue;
+
 /**
  * Frame Buffer Write driver Layer 2 data. The user is required to allocate a
  * variable of this type for every frame buffer write device in the system. A
@@ -172,6 +232,7 @@ typedef struct {
                                 callback */
 
     XVidC_VideoStream Stream;    /**< Input AXIS */
+    XVFrmbufWr_Queue *QueuePtr;  /**< Buffer queue, NULL if not used */
 }XV_FrmbufWr_l2;
 
 /************************** Macros Definitions *******************************/
@@ -651,6 +712,20 @@ UINTPTR XVFrmbufWr_GetVChromaBufferAddr(XV_FrmbufWr_l2 *InstancePtr);
 u32 XVFrmbufWr_GetFieldID(XV_FrmbufWr_l2 *InstancePtr);
 void XVFrmbufWr_DbgReportStatus(XV_FrmbufWr_l2 *InstancePtr);
 
+/* Buffer queue related function */
+int XVFrmbufWr_QueueInit(XV_FrmbufWr_l2 *InstancePtr,
+                         XVFrmbufWr_Queue *QueuePtr,
+                         XVidC_FrameDesc *DescPtr,
+                         u32 Size,
+                         XVFrmbufWr_QueueTimer Timer);
+int XVFrmbufWr_QueueSubmit(XV_FrmbufWr_l2 *InstancePtr,
+                           const XVidC_FrameDesc *FramePtr);
+int XVFrmbufWr_QueueReceive(XV_FrmbufWr_l2 *InstancePtr,
+                            XVidC_FrameDesc *FramePtr);
+int XVFrmbufWr_QueueStart(XV_FrmbufWr_l2 *InstancePtr);
+int XVFrmbufWr_QueueStop(XV_FrmbufWr_l2 *InstancePtr);
+void XVFrmbufWr_QueueReadyHandler(XV_FrmbufWr_l2 *InstancePtr);
+
 /* Interrupt related function */
 void XVFrmbufWr_InterruptHandler(void *InstancePtr);
 int XVFrmbufWr_SetCallback(XV_FrmbufWr_l2 *InstancePtr,
@@ -22,6 +22,7 @@
 * 1.00  vyc   04/05/17   Initial Release
 * 3.00  vyc   04/04/18   Add interrupt handler for ap_ready
 * 4.20  pg    01/31/20   Removed Frmbufwr_start function from Interrupt handler
+* 4.8   kt    10/18/26   Advance the buffer queue on ap_ready
 * </pre>
 *
 ******************************************************************************/
@@ -134,6 +135,10 @@ void XVFrmbufWr_InterruptHandler(void *InstancePtr)
   if(Status & XVFRMBUFWR_IRQ_READY_MASK) {
     /* Clear the interrupt */
     XV_frmbufwr_InterruptClear(&FrmbufWrPtr->FrmbufWr, XVFRMBUFWR_IRQ_READY_MASK);
+    //Return the written frame and program the next buffer, if queued
+    if((FrmbufWrPtr->QueuePtr != NULL) && FrmbufWrPtr->QueuePtr->IsRunning) {
+      XVFrmbufWr_QueueReadyHandler(FrmbufWrPtr);
+    }
     //Call user registered callback function, if any
     if(FrmbufWrPtr->FrameReadyCallback) {
           FrmbufWrPtr->FrameReadyCallback(FrmbufWrPtr->CallbackReadyRef);
@@ -0,0 +1,370 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_frmbufwr_queue.c
+* @addtogroup v_frmbuf_wr Overview
+* @{
+*
+* The functions in this file provide the buffer queue of the frame buffer
+* write driver. See xv_frmbufwr_l2.h for a description of the queue.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.8   kt    10/18/26   Initial Release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xv_frmbufwr_l2.h"
+
+/************************** Function Prototypes ******************************/
+static int RingPut(XVFrmbufWr_Ring *RingPtr, const XVidC_FrameDesc *FramePtr);
+static int RingGet(XVFrmbufWr_Ring *RingPtr, XVidC_FrameDesc *FramePtr);
+static void ProgramFrame(XV_FrmbufWr_l2 *InstancePtr,
+			 const XVidC_FrameDesc *FramePtr);
+
+/*****************************************************************************/
+/**
+* This function attaches a buffer queue to the core instance
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  QueuePtr is a pointer to the queue provided by the application
+* @param  DescPtr is a pointer to 2 * Size descriptors provided by the
+*         application, for the empty buffer and the written frame rings
+* @param  Size is the number of buffers the queue can hold, a power of 2
+* @param  Timer is the time source of the frame timestamps, NULL if not used
+*
+* @return XST_SUCCESS or XST_INVALID_PARAM if Size is not a power of 2
+*
+******************************************************************************/
+int XVFrmbufWr_QueueInit(XV_FrmbufWr_l2 *InstancePtr,
+			 XVFrmbufWr_Queue *QueuePtr,
+			 XVidC_FrameDesc *DescPtr,
+			 u32 Size,
+			 XVFrmbufWr_QueueTimer Timer)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(DescPtr != NULL);
+
+	if ((Size == 0) || ((Size & (Size - 1)) != 0)) {
+		return(XST_INVALID_PARAM);
+	}
+
+	memset(QueuePtr, 0, sizeof(XVFrmbufWr_Queue));
+	QueuePtr->Free.DescPtr = DescPtr;
+	QueuePtr->Free.Size = Size;
+	QueuePtr->Done.DescPtr = &DescPtr[Size];
+	QueuePtr->Done.Size = Size;
+	QueuePtr->Timer = Timer;
+
+	InstancePtr->QueuePtr = QueuePtr;
+	return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function gives an empty buffer to the driver
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  FramePtr is a pointer to the buffer descriptor. Only the buffer
+*         addresses are used
+*
+* @return XST_SUCCESS if the buffer is queued
+*         XVFRMBUFWR_ERR_MEM_ADDR_MISALIGNED if an address is misaligned
+*         XST_FAILURE if the queue holds Size buffers
+*
+* @note   Must not be called from the interrupt handler
+*
+******************************************************************************/
+int XVFrmbufWr_QueueSubmit(XV_FrmbufWr_l2 *InstancePtr,
+			   const XVidC_FrameDesc *FramePtr)
+{
+	XVFrmbufWr_Queue *QueuePtr;
+	UINTPTR Align;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->QueuePtr != NULL);
+	Xil_AssertNonvoid(FramePtr != NULL);
+	Xil_AssertNonvoid(FramePtr->LumaAddr != 0);
+
+	QueuePtr = InstancePtr->QueuePtr;
+
+	/* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
+	Align = 2 * InstancePtr->FrmbufWr.Config.PixPerClk * 4;
+	if (((FramePtr->LumaAddr % Align) != 0) ||
+	    ((FramePtr->ChromaAddr % Align) != 0) ||
+	    ((FramePtr->VChromaAddr % Align) != 0)) {
+		return(XVFRMBUFWR_ERR_MEM_ADDR_MISALIGNED);
+	}
+
+	/* Bounding the buffers held by the driver by Size ensures the rings can
+	 * never overflow */
+	if (QueuePtr->NumQueued >= QueuePtr->Free.Size) {
+		return(XST_FAILURE);
+	}
+
+	RingPut(&QueuePtr->Free, FramePtr);
+	QueuePtr->NumQueued++;
+	return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function gets the oldest written frame from the driver
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  FramePtr is a pointer to the descriptor to be filled
+*
+* @return XST_SUCCESS or XST_NO_DATA if no frame is written
+*
+* @note   Must not be called from the interrupt handler
+*
+******************************************************************************/
+int XVFrmbufWr_QueueReceive(XV_FrmbufWr_l2 *InstancePtr,
+			    XVidC_FrameDesc *FramePtr)
+{
+	XVFrmbufWr_Queue *QueuePtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->QueuePtr != NULL);
+	Xil_AssertNonvoid(FramePtr != NULL);
+
+	QueuePtr = InstancePtr->QueuePtr;
+
+	if (RingGet(&QueuePtr->Done, FramePtr) != XST_SUCCESS) {
+		return(XST_NO_DATA);
+	}
+
+	QueuePtr->NumQueued--;
+	return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function programs the first empty buffer, enables the ap_ready
+* interrupt with auto restart and starts the core
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return XST_SUCCESS or XST_NO_DATA if no empty buffer was submitted
+*
+* @note   The interrupt handler must be connected, see
+*         XVFrmbufWr_InterruptHandler()
+*
+******************************************************************************/
+int XVFrmbufWr_QueueStart(XV_FrmbufWr_l2 *InstancePtr)
+{
+	XVFrmbufWr_Queue *QueuePtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->QueuePtr != NULL);
+
+	QueuePtr = InstancePtr->QueuePtr;
+	Xil_AssertNonvoid(!QueuePtr->IsRunning);
+
+	if (RingGet(&QueuePtr->Free, &QueuePtr->Programmed) != XST_SUCCESS) {
+		return(XST_NO_DATA);
+	}
+	ProgramFrame(InstancePtr, &QueuePtr->Programmed);
+	QueuePtr->HasProgrammed = TRUE;
+	QueuePtr->HasActive = FALSE;
+	QueuePtr->IsRepeat = FALSE;
+	QueuePtr->IsRunning = TRUE;
+
+	XVFrmbufWr_InterruptEnable(InstancePtr, XVFRMBUFWR_IRQ_READY_MASK);
+	XV_frmbufwr_EnableAutoRestart(&InstancePtr->FrmbufWr);
+	XV_frmbufwr_Start(&InstancePtr->FrmbufWr);
+
+	return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function stops the core and gives the buffers held by the driver back
+* to the empty buffer ring
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return XST_SUCCESS if the core is stopped
+*         XST_FAILURE if the core is not in stop state
+*
+* @note   The frame being written is lost. The core is flushed, see
+*         XVFrmbufWr_Stop()
+*
+******************************************************************************/
+int XVFrmbufWr_QueueStop(XV_FrmbufWr_l2 *InstancePtr)
+{
+	XVFrmbufWr_Queue *QueuePtr;
+	int Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->QueuePtr != NULL);
+
+	QueuePtr = InstancePtr->QueuePtr;
+
+	XV_frmbufwr_InterruptDisable(&InstancePtr->FrmbufWr,
+				     XVFRMBUFWR_IRQ_READY_MASK);
+	QueuePtr->IsRunning = FALSE;
+
+	Status = XVFrmbufWr_Stop(InstancePtr);
+
+	/* The handler is stopped, the empty buffer ring can be filled from
+	 * here */
+	if (QueuePtr->HasActive) {
+		RingPut(&QueuePtr->Free, &QueuePtr->Active);
+	}
+	if (QueuePtr->HasProgrammed && !QueuePtr->IsRepeat) {
+		RingPut(&QueuePtr->Free, &QueuePtr->Programmed);
+	}
+	QueuePtr->HasActive = FALSE;
+	QueuePtr->HasProgrammed = FALSE;
+	QueuePtr->IsRepeat = FALSE;
+
+	return(Status);
+}
+
+/*****************************************************************************/
+/**
+* This function advances the queue when the core has started a frame. The
+* frame written before is returned to the application and the next empty
+* buffer is programmed
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return none
+*
+* @note   Called by XVFrmbufWr_InterruptHandler() on ap_ready
+*
+******************************************************************************/
+void XVFrmbufWr_QueueReadyHandler(XV_FrmbufWr_l2 *InstancePtr)
+{
+	XVFrmbufWr_Queue *QueuePtr;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->QueuePtr != NULL);
+
+	QueuePtr = InstancePtr->QueuePtr;
+
+	if (QueuePtr->HasActive) {
+		if (QueuePtr->IsRepeat) {
+			/* The started frame is written over the previous one */
+			QueuePtr->NumDropped++;
+		} else {
+			if (QueuePtr->Timer) {
+				QueuePtr->Active.Timestamp = QueuePtr->Timer();
+			}
+			if (XVFrmbufWr_InterlacedEnabled(InstancePtr)) {
+				QueuePtr->Active.FieldId =
+					XV_frmbufwr_Get_HwReg_field_id(
+						&InstancePtr->FrmbufWr);
+			}
+			QueuePtr->Active.Sequence = QueuePtr->Sequence++;
+			RingPut(&QueuePtr->Done, &QueuePtr->Active);
+			QueuePtr->NumFrames++;
+		}
+	}
+
+	/* The programmed buffer is being written */
+	QueuePtr->Active = QueuePtr->Programmed;
+	QueuePtr->HasActive = QueuePtr->HasProgrammed;
+
+	if (RingGet(&QueuePtr->Free, &QueuePtr->Programmed) == XST_SUCCESS) {
+		ProgramFrame(InstancePtr, &QueuePtr->Programmed);
+		QueuePtr->HasProgrammed = TRUE;
+		QueuePtr->IsRepeat = FALSE;
+	} else {
+		/* Keep the registers, the next frame reuses the active
+		 * buffer */
+		QueuePtr->Programmed = QueuePtr->Active;
+		QueuePtr->IsRepeat = QueuePtr->HasActive;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function adds a descriptor to a ring
+*
+* @param  RingPtr is a pointer to the ring
+* @param  FramePtr is a pointer to the descriptor
+*
+* @return XST_SUCCESS or XST_FAILURE if the ring is full
+*
+******************************************************************************/
+static int RingPut(XVFrmbufWr_Ring *RingPtr, const XVidC_FrameDesc *FramePtr)
+{
+	u32 Head = RingPtr->Head;
+
+	if ((Head - RingPtr->Tail) >= RingPtr->Size) {
+		return(XST_FAILURE);
+	}
+
+	RingPtr->DescPtr[Head & (RingPtr->Size - 1)] = *FramePtr;
+	/* The descriptor must be visible before the new Head is */
+	DATA_SYNC;
+	RingPtr->Head = Head + 1;
+	return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function removes the oldest descriptor from a ring
+*
+* @param  RingPtr is a pointer to the ring
+* @param  FramePtr is a pointer to the descriptor to be filled
+*
+* @return XST_SUCCESS or XST_NO_DATA if the ring is empty
+*
+******************************************************************************/
+static int RingGet(XVFrmbufWr_Ring *RingPtr, XVidC_FrameDesc *FramePtr)
+{
+	u32 Tail = RingPtr->Tail;
+
+	if (Tail == RingPtr->Head) {
+		return(XST_NO_DATA);
+	}
+
+	/* Read the descriptor only after the Head that published it, and
+	 * complete the read before the slot is released to the producer */
+	DATA_SYNC;
+	*FramePtr = RingPtr->DescPtr[Tail & (RingPtr->Size - 1)];
+	DATA_SYNC;
+	RingPtr->Tail = Tail + 1;
+	return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function programs the buffer addresses of a frame
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  FramePtr is a pointer to the frame descriptor
+*
+* @return none
+*
+******************************************************************************/
+static void ProgramFrame(XV_FrmbufWr_l2 *InstancePtr,
+			 const XVidC_FrameDesc *FramePtr)
+{
+	XV_frmbufwr_Set_HwReg_frm_buffer_V(&InstancePtr->FrmbufWr,
+					   FramePtr->LumaAddr);
+	if (FramePtr->ChromaAddr != 0) {
+		XV_frmbufwr_Set_HwReg_frm_buffer2_V(&InstancePtr->FrmbufWr,
+						    FramePtr->ChromaAddr);
+	}
+	if (FramePtr->VChromaAddr != 0) {
+		XV_frmbufwr_Set_HwReg_frm_buffer3_V(&InstancePtr->FrmbufWr,
+						    FramePtr->VChromaAddr);
+	}
+}
+/** @} */
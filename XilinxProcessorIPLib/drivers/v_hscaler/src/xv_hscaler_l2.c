@@ -31,6 +31,8 @@
 *       rco   02/09/17   Fix c++ compilation warnings
 *	jsr   09/07/18 Fix for 64-bit driver support
 * 3.3   vsa   04/07/20   Improve quality with better coefficient tables
+* 3.5   kt    10/18/26   Added phase/coefficient plan cache
+*       kt    10/18/26   Added runtime coefficient design
 * </pre>
 *
 ******************************************************************************/
@@ -75,8 +77,17 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
                             u32 WidthOut,
                             u32 PixelRate);
 
-static void XV_HScalerSetCoeff(XV_Hscaler_l2 *HscPtr);
-static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr);
+static void XV_HScalerSetCoeff(XV_Hscaler_l2 *HscPtr, u32 *CoeffWords);
+static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr, u32 *PhaseWords);
+static u32 XV_HScalerPhaseWords(XV_Hscaler_l2 *HscPtr);
+static XV_HScalerPlan *XV_HScalerGetPlan(XV_Hscaler_l2 *HscPtr,
+                                         u32 WidthIn,
+                                         u32 WidthOut,
+                                         u8 *IsHit);
+static void XV_HScalerSetPlan(XV_Hscaler_l2 *HscPtr,
+                              u32 WidthIn,
+                              u32 WidthOut,
+                              u32 PixelRate);
 
 /*****************************************************************************/
 /**
@@ -138,7 +149,8 @@ void XV_HScalerStop(XV_Hscaler_l2 *InstancePtr)
 /**
 * This function determines the internal coeffiecient table to be used based on
 * scaling ratio and loads the filter coefficients in the scaler coefficient
-* storage.
+* storage. With coefficient design enabled the coefficients are designed for
+* the exact scaling ratio instead.
 *
 * @param  InstancePtr is a pointer to the core instance to be worked on.
 * @param  WidthIn is the input stream width
@@ -168,7 +180,18 @@ static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
   /* Scale Down Mode will use dynamic filter selection logic
    * Scale Up Mode (including 1:1) will always use 6 tap filter
    */
-  if(IsScaleDown)
+  if(InstancePtr->DesignCoeff &&
+     (XVidC_PolyphaseDesign(InstancePtr->designed,
+                            numPhases,
+                            InstancePtr->Hsc.Config.NumTaps,
+                            WidthIn,
+                            WidthOut) == XST_SUCCESS))
+  {
+    //Filter designed for the exact ratio with all taps of the IP
+    coeff = InstancePtr->designed;
+    numTaps = InstancePtr->Hsc.Config.NumTaps;
+  }
+  else if(IsScaleDown)
   {
     ScalingRatio = ((WidthIn * 10)/WidthOut);
 
@@ -426,6 +449,14 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
         if (nrRds >= HscPtr->Hsc.Config.PixPerClk)
             nrRds -= HscPtr->Hsc.Config.PixPerClk;
     }
+
+    /* Clear the phases past the line, so that the phase registers written
+     * by XV_HScalerSetPhase() only depend on the configuration */
+    for (x=loopWidth; x<(int)(HscPtr->Hsc.Config.MaxWidth/HscPtr->Hsc.Config.PixPerClk); x++)
+    {
+        HscPtr->phasesH[x] = 0;
+        HscPtr->phasesH_H[x] = 0;
+    }
 }
 
 /*****************************************************************************/
@@ -433,6 +464,8 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
 * This function programs the phase data into core registers
 *
 * @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  PhaseWords is an array of XV_HSCALER_PLAN_PHASE_WORDS words to store
+*         the register image into, NULL if not needed
 *
 * @return None
 *
@@ -440,7 +473,7 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
 *        User must load the coefficients, using the provided API, before
 *        scaler can be used
 ******************************************************************************/
-static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
+static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr, u32 *PhaseWords)
 {
   u32 loopWidth;
   UINTPTR baseAddr;
@@ -465,6 +498,10 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
                 msb = (u32)(HscPtr->phasesH[i+1] & (u64)XHSC_MASK_LOW_16BITS);
                 val = (msb<<16 | lsb);
                 Xil_Out32(baseAddr+(index*4), val);
+                if(PhaseWords != NULL)
+                {
+                  PhaseWords[index] = val;
+                }
                 ++index;
               }
             }
@@ -481,6 +518,10 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
               {
                 val = (u32)(HscPtr->phasesH[i] & XHSC_MASK_LOW_32BITS);
                 Xil_Out32(baseAddr+(i*4), val);
+                if(PhaseWords != NULL)
+                {
+                  PhaseWords[i] = val;
+                }
               }
             }
             break;
@@ -503,6 +544,11 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
                 msb = (u32)((phaseHData>>32) & XHSC_MASK_LOW_32BITS);
                 Xil_Out32(baseAddr+(offset*4), lsb);
                 Xil_Out32(baseAddr+((offset+1)*4), msb);
+                if(PhaseWords != NULL)
+                {
+                  PhaseWords[offset]   = lsb;
+                  PhaseWords[offset+1] = msb;
+                }
                 ++index;
                 offset += 2;
               }
@@ -537,6 +583,12 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
 			Xil_Out32(baseAddr+(offset*4), bits_0_31);
 			Xil_Out32(baseAddr+((offset+1)*4), bits_32_63);
 			Xil_Out32(baseAddr+((offset+2)*4), bits_64_95);
+			if (PhaseWords != NULL) {
+				PhaseWords[offset] = bits_0_31;
+				PhaseWords[offset+1] = bits_32_63;
+				PhaseWords[offset+2] = bits_64_95;
+				PhaseWords[offset+3] = 0;
+			}
 			/*(offset+3)*4 register is reserved,so increment offset by 4*/
 			offset += 4;
 			index++;
@@ -557,6 +609,8 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
 * registers
 *
 * @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  CoeffWords is an array of XV_HSCALER_PLAN_COEFF_WORDS words to store
+*         the register image into, NULL if not needed
 *
 * @return None
 *
@@ -564,7 +618,7 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
 *        User must load the coefficients, using the provided API, before
 *        scaler can be used
 ******************************************************************************/
-static void XV_HScalerSetCoeff(XV_Hscaler_l2 *HscPtr)
+static void XV_HScalerSetCoeff(XV_Hscaler_l2 *HscPtr, u32 *CoeffWords)
 {
   int num_phases = 1<<HscPtr->Hsc.Config.PhaseShift;
   int num_taps   = HscPtr->Hsc.Config.NumTaps/2;
@@ -580,8 +634,279 @@ static void XV_HScalerSetCoeff(XV_Hscaler_l2 *HscPtr)
        rdIndx = j*2+offset;
        val = (HscPtr->coeff[i][rdIndx+1] << 16) | (HscPtr->coeff[i][rdIndx] & XHSC_MASK_LOW_16BITS);
        Xil_Out32(baseAddr+((i*num_taps+j)*4), val);
+       if(CoeffWords != NULL)
+       {
+         CoeffWords[i*num_taps+j] = (u32)val;
+       }
+    }
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function returns the number of words of the phase registers written by
+* XV_HScalerSetPhase()
+*
+* @param  HscPtr is a pointer to the core instance to be worked on.
+*
+* @return Number of words, including the reserved words for 8 pixels per clock
+*
+******************************************************************************/
+static u32 XV_HScalerPhaseWords(XV_Hscaler_l2 *HscPtr)
+{
+  u32 loopWidth;
+  u32 NumWords;
+
+  loopWidth = HscPtr->Hsc.Config.MaxWidth/HscPtr->Hsc.Config.PixPerClk;
+  switch(HscPtr->Hsc.Config.PixPerClk)
+  {
+    case XVIDC_PPC_1:
+         NumWords = (loopWidth+1)/2;
+         break;
+
+    case XVIDC_PPC_2:
+         NumWords = loopWidth;
+         break;
+
+    case XVIDC_PPC_4:
+         NumWords = loopWidth*2;
+         break;
+
+    case XVIDC_PPC_8:
+         NumWords = loopWidth*4;
+         break;
+
+    default:
+         NumWords = 0;
+         break;
+  }
+
+  return(NumWords);
+}
+
+/*****************************************************************************/
+/**
+* This function looks up the plan of a configuration in the plan cache of the
+* instance. If there is none, the least recently used plan is taken for it and
+* must be computed.
+*
+* @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  WidthIn is the input stream width
+* @param  WidthOut is the output stream width
+* @param  IsHit is set to TRUE if the plan holds the configuration, FALSE if
+*         it must be computed
+*
+* @return Pointer to the plan
+*
+******************************************************************************/
+static XV_HScalerPlan *XV_HScalerGetPlan(XV_Hscaler_l2 *HscPtr,
+                                         u32 WidthIn,
+                                         u32 WidthOut,
+                                         u8 *IsHit)
+{
+  XV_HScalerPlanCache *CachePtr = HscPtr->PlanCache;
+  XV_hscaler_Config *CfgPtr = &HscPtr->Hsc.Config;
+  XV_HScalerPlan *PlanPtr;
+  XV_HScalerPlan *VictimPtr;
+  u32 i;
+
+  CachePtr->Clock++;
+  VictimPtr = &CachePtr->Plans[0];
+  for(i=0; i < CachePtr->NumPlans; i++)
+  {
+    PlanPtr = &CachePtr->Plans[i];
+    if(PlanPtr->IsValid &&
+       (PlanPtr->WidthIn == WidthIn) &&
+       (PlanPtr->WidthOut == WidthOut) &&
+       (PlanPtr->PixPerClk == CfgPtr->PixPerClk) &&
+       (PlanPtr->NumTaps == CfgPtr->NumTaps) &&
+       (PlanPtr->PhaseShift == CfgPtr->PhaseShift) &&
+       (PlanPtr->MaxWidth == CfgPtr->MaxWidth))
+    {
+      PlanPtr->LastUse = CachePtr->Clock;
+      CachePtr->Hits++;
+      *IsHit = TRUE;
+      return(PlanPtr);
+    }
+
+    /* Prefer a free plan, else the least recently used one */
+    if(VictimPtr->IsValid &&
+       (!PlanPtr->IsValid ||
+        ((CachePtr->Clock - PlanPtr->LastUse) >
+         (CachePtr->Clock - VictimPtr->LastUse))))
+    {
+      VictimPtr = PlanPtr;
+    }
+  }
+
+  if(VictimPtr->IsValid)
+  {
+    CachePtr->Evictions++;
+  }
+  CachePtr->Misses++;
+
+  VictimPtr->WidthIn    = WidthIn;
+  VictimPtr->WidthOut   = WidthOut;
+  VictimPtr->PixPerClk  = CfgPtr->PixPerClk;
+  VictimPtr->NumTaps    = CfgPtr->NumTaps;
+  VictimPtr->PhaseShift = CfgPtr->PhaseShift;
+  VictimPtr->MaxWidth   = CfgPtr->MaxWidth;
+  VictimPtr->HasCoeff   = FALSE;
+  VictimPtr->IsValid    = TRUE;
+  VictimPtr->LastUse    = CachePtr->Clock;
+  *IsHit = FALSE;
+
+  return(VictimPtr);
+}
+
+/*****************************************************************************/
+/**
+* This function programs the filter coefficients and phase data into core
+* registers from the plan cache of the instance. A plan is computed, as
+* without plan cache, the first time its configuration is used. After that
+* its register images are copied into the core registers.
+*
+* @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  WidthIn is the input stream width
+* @param  WidthOut is the output stream width
+* @param  PixelRate is the number of pixels per clock being processed
+*
+* @return None
+*
+* @Note  User defined coefficients are not cached, they are programmed from
+*        the instance as without plan cache.
+******************************************************************************/
+static void XV_HScalerSetPlan(XV_Hscaler_l2 *HscPtr,
+                              u32 WidthIn,
+                              u32 WidthOut,
+                              u32 PixelRate)
+{
+  XV_HScalerPlan *PlanPtr;
+  UINTPTR baseAddr;
+  u32 NumWords;
+  u32 i;
+  u8 IsHit;
+
+  PlanPtr = XV_HScalerGetPlan(HscPtr, WidthIn, WidthOut, &IsHit);
+
+  if(HscPtr->Hsc.Config.ScalerType == XV_HSCALER_POLYPHASE)
+  {
+    if(HscPtr->UseExtCoeff)  //User defined coefficients
+    {
+      XV_HScalerSetCoeff(HscPtr, NULL);
+    }
+    else if(IsHit && PlanPtr->HasCoeff &&
+            (PlanPtr->IsDesigned == HscPtr->DesignCoeff))
+    {
+      NumWords = (1<<HscPtr->Hsc.Config.PhaseShift) *
+                 (HscPtr->Hsc.Config.NumTaps/2);
+      baseAddr = XV_hscaler_Get_HwReg_hfltCoeff_BaseAddress(&HscPtr->Hsc);
+      for(i=0; i < NumWords; i++)
+      {
+        Xil_Out32(baseAddr+(i*4), PlanPtr->CoeffWords[i]);
+      }
+    }
+    else
+    {
+      XV_HScalerSelectCoeff(HscPtr, WidthIn, WidthOut);
+      XV_HScalerSetCoeff(HscPtr, PlanPtr->CoeffWords);
+      PlanPtr->HasCoeff = TRUE;
+      PlanPtr->IsDesigned = HscPtr->DesignCoeff;
+    }
+  }
+
+  if(IsHit)
+  {
+    NumWords = XV_HScalerPhaseWords(HscPtr);
+    baseAddr = XV_hscaler_Get_HwReg_phasesH_V_BaseAddress(&HscPtr->Hsc);
+    for(i=0; i < NumWords; i++)
+    {
+      /* Every 4th word is reserved for 8 pixels per clock */
+      if((HscPtr->Hsc.Config.PixPerClk != XVIDC_PPC_8) || ((i & 3) != 3))
+      {
+        Xil_Out32(baseAddr+(i*4), PlanPtr->PhaseWords[i]);
+      }
     }
   }
+  else
+  {
+    CalculatePhases(HscPtr, WidthIn, WidthOut, PixelRate);
+    XV_HScalerSetPhase(HscPtr, PlanPtr->PhaseWords);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function initializes a plan cache. The cache is empty and its
+* statistics are cleared.
+*
+* @param  CachePtr is a pointer to the plan cache to be initialized.
+* @param  PlansPtr is a pointer to an array of plans allocated by the user
+* @param  NumPlans is the number of plans in the array
+*
+* @return None
+*
+******************************************************************************/
+void XV_HScalerPlanCacheInit(XV_HScalerPlanCache *CachePtr,
+                             XV_HScalerPlan *PlansPtr,
+                             u32 NumPlans)
+{
+  u32 i;
+
+  Xil_AssertVoid(CachePtr != NULL);
+  Xil_AssertVoid(PlansPtr != NULL);
+  Xil_AssertVoid(NumPlans > 0);
+
+  CachePtr->Plans     = PlansPtr;
+  CachePtr->NumPlans  = NumPlans;
+  CachePtr->Clock     = 0;
+  CachePtr->Hits      = 0;
+  CachePtr->Misses    = 0;
+  CachePtr->Evictions = 0;
+  for(i=0; i < NumPlans; i++)
+  {
+    PlansPtr[i].IsValid = FALSE;
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function attaches a plan cache to the instance. The following calls to
+* XV_HScalerSetup() program the phases and coefficients through the cache.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+* @param  CachePtr is a pointer to an initialized plan cache, NULL to compute
+*         every setup again
+*
+* @return None
+*
+******************************************************************************/
+void XV_HScalerSetPlanCache(XV_Hscaler_l2 *InstancePtr,
+                            XV_HScalerPlanCache *CachePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->PlanCache = CachePtr;
+}
+
+/*****************************************************************************/
+/**
+* This function selects how the following calls to XV_HScalerSetup() get the
+* internal filter coefficients. When enabled they are designed for the exact
+* scaling ratio and the number of taps of the IP, else they are taken from the
+* fixed tables.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+* @param  Enable is TRUE to design the coefficients, FALSE to use the tables
+*
+* @return None
+*
+******************************************************************************/
+void XV_HScalerSetCoeffDesign(XV_Hscaler_l2 *InstancePtr, u8 Enable)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->DesignCoeff = Enable;
 }
 
 /*****************************************************************************/
@@ -626,22 +951,30 @@ int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
 
   PixelRate = (WidthIn * STEP_PRECISION)/WidthOut;
 
-  if(InstancePtr->Hsc.Config.ScalerType == XV_HSCALER_POLYPHASE)
+  if(InstancePtr->PlanCache != NULL)
+  {
+    /* Program coefficients and Phase from the plan cache */
+    XV_HScalerSetPlan(InstancePtr, WidthIn, WidthOut, PixelRate);
+  }
+  else
   {
-    if(!InstancePtr->UseExtCoeff)  //No user defined coefficients
+    if(InstancePtr->Hsc.Config.ScalerType == XV_HSCALER_POLYPHASE)
     {
-      /* Determine coefficient table to use */
-      XV_HScalerSelectCoeff(InstancePtr, WidthIn, WidthOut);
+      if(!InstancePtr->UseExtCoeff)  //No user defined coefficients
+      {
+        /* Determine coefficient table to use */
+        XV_HScalerSelectCoeff(InstancePtr, WidthIn, WidthOut);
+      }
+      /* Program generated coefficients into the IP register bank */
+      XV_HScalerSetCoeff(InstancePtr, NULL);
     }
-    /* Program generated coefficients into the IP register bank */
-    XV_HScalerSetCoeff(InstancePtr);
-  }
 
-  /* Compute Phase for 1 line */
-  CalculatePhases(InstancePtr, WidthIn, WidthOut, PixelRate);
+    /* Compute Phase for 1 line */
+    CalculatePhases(InstancePtr, WidthIn, WidthOut, PixelRate);
 
-  /* Program computed Phase into the IP register bank */
-  XV_HScalerSetPhase(InstancePtr);
+    /* Program computed Phase into the IP register bank */
+    XV_HScalerSetPhase(InstancePtr, NULL);
+  }
 
   XV_hscaler_Set_HwReg_Height(&InstancePtr->Hsc,        HeightIn);
   XV_hscaler_Set_HwReg_WidthIn(&InstancePtr->Hsc,       WidthIn);
@@ -747,6 +1080,19 @@ void XV_HScalerDbgReportStatus(XV_Hscaler_l2 *InstancePtr)
       }
     }
   }
+
+  xil_printf("\r\n\r\nCoefficient Design:  %s\r\n",
+             InstancePtr->DesignCoeff?"Enabled":"Disabled");
+
+  if(InstancePtr->PlanCache != NULL)
+  {
+    xil_printf("\r\nPlan Cache Hits:      %d\r\n",
+               InstancePtr->PlanCache->Hits);
+    xil_printf("Plan Cache Misses:    %d\r\n",
+               InstancePtr->PlanCache->Misses);
+    xil_printf("Plan Cache Evictions: %d\r\n",
+               InstancePtr->PlanCache->Evictions);
+  }
 }
 
 /*****************************************************************************/
@@ -45,6 +45,24 @@
 * Advanced users always have the capability to directly interact with the IP
 * core using Layer-1 API's that perform low level register peek/poke.
 *
+* <b> Plan Cache </b>
+*
+* XV_HScalerSetup() computes the phases of a line and the filter coefficients
+* for every call. When the same resolutions come back often, a plan cache can
+* be attached to the instance with XV_HScalerSetPlanCache(). A plan holds the
+* phase and coefficient register images of one input/output width, which are
+* written back without being computed again. A cache can be shared by the
+* instances of the same IP configuration. The Hits, Misses and Evictions
+* counters of the cache give its hit rate.
+*
+* <b> Coefficient Design </b>
+*
+* By default the filter coefficients are taken from fixed tables, selected by
+* ranges of scaling ratio. XV_HScalerSetCoeffDesign() makes the driver design
+* the coefficients for the exact scaling ratio and the number of taps of the
+* IP at every setup instead, see XVidC_PolyphaseDesign(). User defined
+* coefficients loaded with XV_HScalerLoadExtCoeff() take precedence.
+*
 * <b> Interrupts </b>
 *
 * This driver does not have any interrupts
@@ -71,6 +89,8 @@
 *       dmc   12/17/15   Add macro to query the Is422Enabled flag that was
 *                        added to the XV_hscaler_Config structure
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
+* 3.5   kt    10/18/26   Added phase/coefficient plan cache
+*       kt    10/18/26   Added runtime coefficient design
 * </pre>
 *
 ******************************************************************************/
@@ -92,6 +112,16 @@ extern "C" {
 #define XV_HSCALER_MAX_H_TAPS           (12)
 #define XV_HSCALER_MAX_H_PHASES         (64)
 #define XV_HSCALER_MAX_LINE_WIDTH       (8192)
+/*@}*/
+
+/** @name Plan Cache
+ * @{
+ * Sizes of the register images of a plan
+ */
+#define XV_HSCALER_PLAN_PHASE_WORDS     (XV_HSCALER_MAX_LINE_WIDTH/2)
+#define XV_HSCALER_PLAN_COEFF_WORDS     (XV_HSCALER_MAX_H_PHASES * \
+                                         XV_HSCALER_MAX_H_TAPS/2)
+/*@}*/
 
 /**************************** Type Definitions *******************************/
 /**
@@ -115,6 +145,39 @@ typedef enum
   XV_HSCALER_TAPS_12 = 12
 }XV_HSCALER_TAPS;
 
+/**
+ * This typedef contains a plan, the register images for one scaling
+ * configuration
+ */
+typedef struct
+{
+  u32 WidthIn;      /**< Input width */
+  u32 WidthOut;     /**< Output width */
+  u16 PixPerClk;    /**< Pixels per clock of the IP */
+  u16 NumTaps;      /**< Number of taps of the IP */
+  u16 PhaseShift;   /**< Phase shift of the IP */
+  u16 MaxWidth;     /**< Maximum width of the IP */
+  u8 IsValid;       /**< Plan holds a configuration */
+  u8 HasCoeff;      /**< CoeffWords holds the internal coefficients */
+  u8 IsDesigned;    /**< CoeffWords holds designed coefficients */
+  u32 LastUse;      /**< Cache clock of the last use, for replacement */
+  u32 PhaseWords[XV_HSCALER_PLAN_PHASE_WORDS]; /**< Phase registers */
+  u32 CoeffWords[XV_HSCALER_PLAN_COEFF_WORDS]; /**< Coefficient registers */
+}XV_HScalerPlan;
+
+/**
+ * This typedef contains a plan cache. The plans are provided by the user.
+ */
+typedef struct
+{
+  XV_HScalerPlan *Plans; /**< Array of plans */
+  u32 NumPlans;          /**< Number of plans in the array */
+  u32 Clock;             /**< Counts the lookups, for replacement */
+  u32 Hits;              /**< Number of setups served by a plan */
+  u32 Misses;            /**< Number of setups which computed a plan */
+  u32 Evictions;         /**< Number of plans replaced */
+}XV_HScalerPlanCache;
+
 /**
  * H Scaler Layer 2 data. The user is required to allocate a variable
  * of this type for every H Scaler device in the system. A pointer to a
@@ -124,9 +187,12 @@ typedef struct
 {
   XV_hscaler Hsc; /*<< Layer 1 instance */
   u8 UseExtCoeff;
+  u8 DesignCoeff; /*<< Design coefficients instead of using the tables */
   short coeff[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_MAX_H_TAPS];
+  short designed[XV_HSCALER_MAX_H_PHASES*XV_HSCALER_MAX_H_TAPS]; /*<< Designed coefficients */
   u64 phasesH[XV_HSCALER_MAX_LINE_WIDTH];
   u64 phasesH_H[XV_HSCALER_MAX_LINE_WIDTH];
+  XV_HScalerPlanCache *PlanCache; /*<< Plan cache, NULL if not used */
 }XV_Hscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -185,6 +251,12 @@ int XV_HScalerValidateConfig(XV_Hscaler_l2 *InstancePtr,
                              u32 ColorFormatIn,
                              u32 ColorFormatOut);
 void XV_HScalerDbgReportStatus(XV_Hscaler_l2 *InstancePtr);
+void XV_HScalerPlanCacheInit(XV_HScalerPlanCache *CachePtr,
+                             XV_HScalerPlan *PlansPtr,
+                             u32 NumPlans);
+void XV_HScalerSetPlanCache(XV_Hscaler_l2 *InstancePtr,
+                            XV_HScalerPlanCache *CachePtr);
+void XV_HScalerSetCoeffDesign(XV_Hscaler_l2 *InstancePtr, u8 Enable);
 
 #ifdef __cplusplus
 }
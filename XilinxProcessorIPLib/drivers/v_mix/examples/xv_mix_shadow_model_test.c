@@ -0,0 +1,348 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_mix_shadow_model_test.c
+*
+* Host test of the staged layer configuration of the mixer against a software
+* model of the core registers. It is not a target example: it is built and
+* run with the other driver model tests by make -C scripts/host_model.
+*
+* A random sequence of layer sets is staged and committed, at once or by the
+* interrupt handler at frame done. After every commit the layer set read back
+* from the registers must be the committed set, and the commit must have
+* written exactly the registers whose value changed. While a requested commit
+* is pending XVMix_ShadowStage() must return XST_DEVICE_BUSY and leave the
+* staged set alone. Invalid sets must be rejected without being staged.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 6.5   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "xv_mix_l2.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define CORE_BASE	0x40000000U	/* Base address of the core */
+#define CORE_SPAN	0x4000U		/* Layer registers of the core */
+#define NUM_STEPS	5000U		/* Layer sets of the sequence */
+#define STREAM_LAYER	XVMIX_LAYER_16	/* Stream interface layer */
+#define FRAME_TIME	1000U		/* Timer ticks of the frame done callback */
+#define LAYER_SPAN	0x100U		/* Registers of a layer */
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define REG(Offset)	Regs[(Offset) / 4U]
+
+/************************** Function Prototypes ******************************/
+
+static u32 Timer(void);
+static void FrameDone(void *CallbackRef);
+static void CoreInit(void);
+static void RandomLayer(XVMix_LayerState *LayerPtr, u32 LayerId);
+static u32 ChangedRegs(void);
+static void CheckCommit(u32 Step, u32 Writes);
+static void CheckInvalid(void);
+
+/************************** Variable Definitions *****************************/
+
+static u32 Regs[CORE_SPAN / 4U];
+static u32 Before[CORE_SPAN / 4U];
+static u32 NumWrites;
+static u32 Clock;
+static XV_Mix_l2 Mix;
+static XV_Mix_l2 Check;
+static XVMix_Shadow Shadow;
+static XVMix_Shadow CheckShadow;
+
+/* Configuration table of the SDT initialization, the core is set up by
+ * XV_mix_CfgInitialize() */
+XV_mix_Config XV_mix_ConfigTable[] = { { NULL } };
+
+/*****************************************************************************/
+/*
+* Register model: plain memory, the writes are counted.
+*/
+u32 Xil_In32(UINTPTR Addr)
+{
+	return Regs[(Addr - CORE_BASE) / 4U];
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	Regs[(Addr - CORE_BASE) / 4U] = Value;
+	NumWrites++;
+}
+
+static u32 Timer(void)
+{
+	return ++Clock;
+}
+
+static void FrameDone(void *CallbackRef)
+{
+	(void)CallbackRef;
+	Clock += FRAME_TIME;
+}
+
+static void CoreInit(void)
+{
+	XV_mix_Config Cfg;
+	u32 Layer;
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	Cfg.Name = "mixer";
+	Cfg.PixPerClk = 2U;
+	Cfg.MaxWidth = 1920U;
+	Cfg.MaxHeight = 1080U;
+	Cfg.MaxDataWidth = 8U;
+	Cfg.NumLayers = XVMIX_MAX_SUPPORTED_LAYERS + 1U;
+	Cfg.LogoEn = 1U;
+	Cfg.MaxLogoWidth = 256U;
+	Cfg.MaxLogoHeight = 256U;
+	for (Layer = 0U; Layer < XV_MIX_MAX_MEMORY_LAYERS; Layer++) {
+		Cfg.AlphaEn[Layer] = (u8)((Layer % 3U) != 2U);
+		Cfg.ScalingEn[Layer] = (u8)(Layer < 8U);
+		Cfg.LayerMaxWidth[Layer] = 1920U;
+		Cfg.LayerIntrfType[Layer] = (u8)((Layer + 1U) == STREAM_LAYER);
+	}
+
+	memset(&Mix, 0, sizeof(Mix));
+	(void)XV_mix_CfgInitialize(&Mix.Mix, &Cfg, CORE_BASE);
+	Mix.Stream.Timing.HActive = 1920U;
+	Mix.Stream.Timing.VActive = 1080U;
+	Check = Mix;
+}
+
+/*****************************************************************************/
+/*
+* Random valid configuration of a layer. Values that the IP configuration
+* does not have are left alone.
+*/
+static void RandomLayer(XVMix_LayerState *LayerPtr, u32 LayerId)
+{
+	u32 Scale = 1U;
+
+	if (Mix.Mix.Config.ScalingEn[LayerId - 1U]) {
+		LayerPtr->Scale = (u16)((u32)rand() % 3U);
+		Scale = 1U << LayerPtr->Scale;
+	}
+	LayerPtr->Win.Width = 64U + (2U * ((u32)rand() % 96U));
+	LayerPtr->Win.Height = 64U + ((u32)rand() % 128U);
+	LayerPtr->Win.StartX = 2U * ((u32)rand() %
+			     (((1920U - (LayerPtr->Win.Width * Scale)) / 2U) + 1U));
+	LayerPtr->Win.StartY = (u32)rand() %
+			       ((1080U - (LayerPtr->Win.Height * Scale)) + 1U);
+	if (Mix.Mix.Config.AlphaEn[LayerId - 1U]) {
+		LayerPtr->Alpha = (u16)((u32)rand() % (XVMIX_ALPHA_MAX + 1U));
+	}
+	if (LayerId != STREAM_LAYER) {
+		LayerPtr->Stride = 16U * (1U + ((u32)rand() % 512U));
+		LayerPtr->BufAddr = (UINTPTR)0x10000000U +
+				    (16U * ((u32)rand() % 0x100000U));
+		if ((rand() & 7) == 0) {
+			LayerPtr->BufAddr += (UINTPTR)1U << 32U;
+		}
+		LayerPtr->ChromaBufAddr = LayerPtr->BufAddr + 0x800000U;
+	}
+}
+
+/* Number of layer registers changed since Before */
+static u32 ChangedRegs(void)
+{
+	u32 Count = 0U;
+	u32 Index;
+
+	for (Index = 0U; Index < (CORE_SPAN / 4U); Index++) {
+		if ((Index != (XV_MIX_CTRL_ADDR_AP_CTRL / 4U)) &&
+		    (Index != (XV_MIX_CTRL_ADDR_ISR / 4U)) &&
+		    (Regs[Index] != Before[Index])) {
+			Count++;
+		}
+	}
+
+	return Count;
+}
+
+static void CheckCommit(u32 Step, u32 Writes)
+{
+	u32 Changed = ChangedRegs();
+	u32 Layer;
+
+	XHOST_CHECK(Writes == Changed, "step %u: %u writes, %u registers "
+		    "changed", (unsigned)Step, (unsigned)Writes,
+		    (unsigned)Changed);
+	XHOST_CHECK(memcmp(&Shadow.Committed, &Shadow.Staged,
+			   sizeof(XVMix_LayerSet)) == 0,
+		    "step %u: staged set not committed", (unsigned)Step);
+
+	/* Read the layer set back from the registers */
+	(void)XVMix_ShadowInit(&Check, &CheckShadow, NULL);
+	XHOST_CHECK(memcmp(&CheckShadow.Committed, &Shadow.Committed,
+			   sizeof(XVMix_LayerSet)) == 0,
+		    "step %u: registers differ from the committed set",
+		    (unsigned)Step);
+
+	/* The instance holds the buffers, as after the layer API's */
+	for (Layer = XVMIX_LAYER_1; Layer < XVMix_GetNumLayers(&Mix);
+	     Layer++) {
+		if (XVMix_IsLayerInterfaceStream(&Mix, Layer)) {
+			continue;
+		}
+		XHOST_CHECK((Mix.Layer[Layer].BufAddr ==
+			     Shadow.Committed.Layer[Layer].BufAddr) &&
+			    (Mix.Layer[Layer].ChromaBufAddr ==
+			     Shadow.Committed.Layer[Layer].ChromaBufAddr),
+			    "step %u: layer %u buffers not cached",
+			    (unsigned)Step, (unsigned)Layer);
+	}
+}
+
+/*****************************************************************************/
+/*
+* Invalid sets are rejected and the staged set is not changed.
+*/
+static void CheckInvalid(void)
+{
+	XVMix_LayerSet Staged = Shadow.Staged;
+	XVMix_LayerSet Set;
+
+	Set = Shadow.Committed;
+	Set.Layer[3].Win.Width = 30U;
+	XHOST_CHECK(XVMix_ShadowStage(&Mix, &Set) ==
+		    XVMIX_ERR_LAYER_WINDOW_INVALID, "small window");
+	Set = Shadow.Committed;
+	Set.Layer[3].Win.StartX = 1919U;
+	XHOST_CHECK(XVMix_ShadowStage(&Mix, &Set) ==
+		    XVMIX_ERR_LAYER_WINDOW_INVALID, "window out of frame");
+	Set = Shadow.Committed;
+	Set.Layer[10].Scale = (u16)(Set.Layer[10].Scale + 1U);
+	XHOST_CHECK(XVMix_ShadowStage(&Mix, &Set) == XVMIX_ERR_DISABLED_IN_HW,
+		    "scale without scaler");
+	Set = Shadow.Committed;
+	Set.Layer[3].Alpha = (u16)((Set.Layer[3].Alpha + 1U) % 256U);
+	XHOST_CHECK(XVMix_ShadowStage(&Mix, &Set) == XVMIX_ERR_DISABLED_IN_HW,
+		    "alpha without alpha");
+	Set = Shadow.Committed;
+	Set.Layer[4].Alpha = XVMIX_ALPHA_MAX + 1U;
+	XHOST_CHECK(XVMix_ShadowStage(&Mix, &Set) == XST_INVALID_PARAM,
+		    "alpha out of range");
+	Set = Shadow.Committed;
+	Set.Layer[STREAM_LAYER].BufAddr = 0x1000U;
+	XHOST_CHECK(XVMix_ShadowStage(&Mix, &Set) ==
+		    XVMIX_ERR_LAYER_INTF_TYPE_MISMATCH, "stream layer buffer");
+	Set = Shadow.Committed;
+	Set.Layer[5].BufAddr += 4U;
+	XHOST_CHECK(XVMix_ShadowStage(&Mix, &Set) ==
+		    XVMIX_ERR_MEM_ADDR_MISALIGNED, "misaligned buffer");
+	XHOST_CHECK(memcmp(&Staged, &Shadow.Staged, sizeof(Staged)) == 0,
+		    "invalid set staged");
+}
+
+int main(void)
+{
+	XVMix_LayerSet Set;
+	XVMix_LayerSet Staged;
+	u32 Requests = 0U;
+	u32 Writes;
+	u32 Count;
+	u32 Layer;
+	u32 Step;
+
+	CoreInit();
+	XVMix_SetCallback(&Mix, (void *)FrameDone, &Mix);
+	REG(XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTX_0_DATA +
+	    (3U * LAYER_SPAN)) = 64U;
+	(void)XVMix_ShadowInit(&Mix, &Shadow, Timer);
+	XHOST_CHECK(Shadow.Committed.Layer[3].Win.StartX == 64U,
+		    "shadow not loaded from the registers");
+	srand(1);
+
+	for (Step = 0U; Step < NUM_STEPS; Step++) {
+		/* Change a few layers of the committed set */
+		Set = Shadow.Committed;
+		for (Count = (u32)rand() % 4U; Count != 0U; Count--) {
+			Layer = 1U + ((u32)rand() % XVMIX_MAX_SUPPORTED_LAYERS);
+			RandomLayer(&Set.Layer[Layer], Layer);
+		}
+		if ((rand() & 3) == 0) {
+			Set.LayerEnable = (u32)rand() & 0x1FFFFU;
+		}
+		if ((rand() & 7) == 0) {
+			Set.Logo.Win.Width = 32U + (2U * ((u32)rand() % 112U));
+			Set.Logo.Win.Height = 32U + ((u32)rand() % 224U);
+			Set.Logo.Alpha = (u16)((u32)rand() % 257U);
+		}
+		XHOST_CHECK(XVMix_ShadowStage(&Mix, &Set) == XST_SUCCESS,
+			    "step %u: valid set rejected", (unsigned)Step);
+
+		memcpy(Before, Regs, sizeof(Regs));
+		if ((rand() & 1) == 0) {
+			NumWrites = 0U;
+			Writes = XVMix_ShadowCommit(&Mix);
+			XHOST_CHECK(Writes == NumWrites, "step %u: %u writes "
+				    "counted, %u done", (unsigned)Step,
+				    (unsigned)Writes, (unsigned)NumWrites);
+		} else {
+			XVMix_ShadowRequestCommit(&Mix);
+			Requests++;
+
+			/* Staging is refused until the frame is done */
+			Staged = Shadow.Staged;
+			Set.LayerEnable ^= 1U;
+			XHOST_CHECK(XVMix_ShadowStage(&Mix, &Set) ==
+				    XST_DEVICE_BUSY, "step %u: staged while "
+				    "pending", (unsigned)Step);
+			XHOST_CHECK(memcmp(&Staged, &Shadow.Staged,
+					   sizeof(Staged)) == 0,
+				    "step %u: pending set changed",
+				    (unsigned)Step);
+
+			REG(XV_MIX_CTRL_ADDR_ISR) = XVMIX_IRQ_DONE_MASK;
+			XVMix_InterruptHandler(&Mix);
+			XHOST_CHECK(!Shadow.IsPending, "step %u: still pending",
+				    (unsigned)Step);
+			XHOST_CHECK(Shadow.LastLatency > FRAME_TIME,
+				    "step %u: latency %u", (unsigned)Step,
+				    (unsigned)Shadow.LastLatency);
+			Writes = Shadow.LastWrites;
+		}
+		CheckCommit(Step, Writes);
+
+		if ((Step % 500U) == 0U) {
+			CheckInvalid();
+		}
+	}
+
+	/* Nothing changed, nothing written */
+	NumWrites = 0U;
+	XHOST_CHECK((XVMix_ShadowCommit(&Mix) == 0U) && (NumWrites == 0U),
+		    "%u writes without change", (unsigned)NumWrites);
+
+	XHOST_CHECK(Shadow.NumCommits == NUM_STEPS + 1U, "%u commits",
+		    (unsigned)Shadow.NumCommits);
+	XHOST_CHECK(XHostModel_AssertCount == 0U, "%u assertions",
+		    (unsigned)XHostModel_AssertCount);
+	printf("%u commits, %u at frame done: %.1f register writes per commit, "
+	       "max latency %u ticks\n", (unsigned)Shadow.NumCommits,
+	       (unsigned)Requests,
+	       (double)Shadow.TotalWrites / Shadow.NumCommits,
+	       (unsigned)Shadow.MaxLatency);
+
+	return XHostModel_Report("xv_mix_shadow_model_test");
+}
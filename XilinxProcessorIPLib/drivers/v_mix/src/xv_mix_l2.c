@@ -49,6 +49,9 @@
 * 6.00  pg    01/10/20   Add Colorimetry feature.
 *                        Program Mixer CSC registers to do color conversion
 *                        from YUV to RGB and RGB to YUV.
+* 6.5   kt    10/18/26   Added staged layer configuration. Layer sets are
+*                        validated in memory and committed as the register
+*                        writes which differ from the last commit
 * </pre>
 *
 ******************************************************************************/
@@ -94,6 +97,22 @@ static void SetPowerOnDefaultState(XV_Mix_l2 *InstancePtr);
 static int IsWindowValid(XVidC_VideoStream *Strm,
                          XVidC_VideoWindow *Win,
                          XVMix_Scalefactor ScaleFactor);
+static void ShadowReadLayers(XV_Mix_l2 *InstancePtr, XVMix_LayerSet *SetPtr);
+static int ShadowValidateLayer(XV_Mix_l2 *InstancePtr,
+                               XVMix_LayerId LayerId,
+                               const XVMix_LayerState *NewPtr,
+                               const XVMix_LayerState *OldPtr);
+static int ShadowValidateLogo(XV_Mix_l2 *InstancePtr,
+                              const XVMix_LayerState *NewPtr,
+                              const XVMix_LayerState *OldPtr);
+static u32 ShadowWriteReg(UINTPTR BaseAddress,
+                          u32 RegOffset,
+                          u32 Data,
+                          u32 OldData);
+static u32 ShadowWriteAddr(UINTPTR BaseAddress,
+                           u32 RegOffset,
+                           UINTPTR Addr,
+                           UINTPTR OldAddr);
 
 /*****************************************************************************/
 /**
@@ -1532,6 +1551,17 @@ void XVMix_DbgReportStatus(XV_Mix_l2 *InstancePtr)
   xil_printf("Background Color Y/R: %d\r\n", XV_mix_Get_HwReg_background_Y_R(MixPtr));
   xil_printf("Background Color U/G: %d\r\n", XV_mix_Get_HwReg_background_U_G(MixPtr));
   xil_printf("Background Color V/B: %d\r\n\r\n", XV_mix_Get_HwReg_background_V_B(MixPtr));
+
+  if(InstancePtr->ShadowPtr) {
+    XVMix_Shadow *ShadowPtr = InstancePtr->ShadowPtr;
+
+    xil_printf("Shadow Commits:       %d\r\n", ShadowPtr->NumCommits);
+    xil_printf("Shadow Pending:       %d\r\n", ShadowPtr->IsPending);
+    xil_printf("Last Commit Writes:   %d\r\n", ShadowPtr->LastWrites);
+    xil_printf("Total Commit Writes:  %d\r\n", ShadowPtr->TotalWrites);
+    xil_printf("Last Commit Latency:  %d\r\n", ShadowPtr->LastLatency);
+    xil_printf("Max Commit Latency:   %d\r\n\r\n", ShadowPtr->MaxLatency);
+  }
 }
 
 /*****************************************************************************/
@@ -1788,4 +1818,530 @@ u32 XVMix_SetCscCoeffs(XV_Mix_l2 *InstancePtr,
 	return XST_SUCCESS;
 
 }
+
+/*****************************************************************************/
+/**
+* This function attaches a layer register shadow to the core instance. The
+* committed and staged sets of the shadow are loaded from the core registers
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  ShadowPtr is a pointer to the shadow provided by the application
+* @param  Timer is the time source of the commit latency, NULL if not used
+*
+* @return XST_SUCCESS
+*
+* @note   The shadow must not be modified by the application, except through
+*         the XVMix_Shadow API's. The layer API's do not update the shadow:
+*         a layer changed by them after this call leaves the Committed set
+*         stale, and the next commit skips the registers it believes are
+*         unchanged. Call XVMix_ShadowInit() again to reload it
+*
+******************************************************************************/
+int XVMix_ShadowInit(XV_Mix_l2 *InstancePtr,
+                     XVMix_Shadow *ShadowPtr,
+                     XVMix_ShadowTimer Timer)
+{
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(InstancePtr->Mix.IsReady == XIL_COMPONENT_IS_READY);
+  Xil_AssertNonvoid(ShadowPtr != NULL);
+
+  memset(ShadowPtr, 0, sizeof(XVMix_Shadow));
+  ShadowPtr->Timer = Timer;
+
+  ShadowReadLayers(InstancePtr, &ShadowPtr->Committed);
+  ShadowPtr->Staged = ShadowPtr->Committed;
+
+  InstancePtr->ShadowPtr = ShadowPtr;
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function validates a layer set and stages it for the next commit. The
+* values which differ from the committed set are checked the same way the
+* layer API's check them
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  SetPtr is a pointer to the configuration of all the layers
+*
+* @return XST_SUCCESS if the set is staged
+*         XST_DEVICE_BUSY if a requested commit is pending, the interrupt
+*         handler may be reading the staged set
+*         else error code with reason. The staged set is not changed on error
+*
+******************************************************************************/
+int XVMix_ShadowStage(XV_Mix_l2 *InstancePtr, const XVMix_LayerSet *SetPtr)
+{
+  XVMix_Shadow *ShadowPtr;
+  u32 index;
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(InstancePtr->ShadowPtr != NULL);
+  Xil_AssertNonvoid(SetPtr != NULL);
+
+  ShadowPtr = InstancePtr->ShadowPtr;
+
+  if(ShadowPtr->IsPending) {
+    return(XST_DEVICE_BUSY);
+  }
+
+  for(index=XVMIX_LAYER_1; index<=XVMIX_LAYER_16; ++index) {
+    Status = ShadowValidateLayer(InstancePtr, (XVMix_LayerId)index,
+                                 &SetPtr->Layer[index],
+                                 &ShadowPtr->Committed.Layer[index]);
+    if(Status != XST_SUCCESS) {
+      return(Status);
+    }
+  }
+
+  Status = ShadowValidateLogo(InstancePtr, &SetPtr->Logo,
+                              &ShadowPtr->Committed.Logo);
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  ShadowPtr->Staged = *SetPtr;
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function writes the staged layer set to the core. Only the registers
+* which differ from the committed set are written, the layer enable register
+* is written last
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return Number of registers written
+*
+* @note   The core reads the registers when a frame is started. To apply a
+*         set between two frames use XVMix_ShadowRequestCommit() in interrupt
+*         mode, or commit while the core is stopped
+*
+******************************************************************************/
+u32 XVMix_ShadowCommit(XV_Mix_l2 *InstancePtr)
+{
+  XV_mix *MixPtr;
+  XVMix_Shadow *ShadowPtr;
+  const XVMix_LayerState *NewPtr, *OldPtr;
+  UINTPTR BaseAddr;
+  u32 index, Offset;
+  u32 StartTime = 0;
+  u32 Latency;
+  u32 Count = 0;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(InstancePtr->ShadowPtr != NULL);
+
+  MixPtr = &InstancePtr->Mix;
+  ShadowPtr = InstancePtr->ShadowPtr;
+  BaseAddr = MixPtr->Config.BaseAddress;
+
+  if(ShadowPtr->Timer) {
+    StartTime = ShadowPtr->IsPending ? ShadowPtr->RequestTime :
+                                       ShadowPtr->Timer();
+  }
+
+  for(index=XVMIX_LAYER_1; index<XVMix_GetNumLayers(InstancePtr); ++index) {
+    NewPtr = &ShadowPtr->Staged.Layer[index];
+    OldPtr = &ShadowPtr->Committed.Layer[index];
+    Offset = index*XVMIX_REG_OFFSET;
+
+    Count += ShadowWriteReg(BaseAddr,
+                 (XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTX_0_DATA+Offset),
+                 NewPtr->Win.StartX, OldPtr->Win.StartX);
+    Count += ShadowWriteReg(BaseAddr,
+                 (XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTY_0_DATA+Offset),
+                 NewPtr->Win.StartY, OldPtr->Win.StartY);
+    Count += ShadowWriteReg(BaseAddr,
+                 (XV_MIX_CTRL_ADDR_HWREG_LAYERWIDTH_0_DATA+Offset),
+                 NewPtr->Win.Width, OldPtr->Win.Width);
+    Count += ShadowWriteReg(BaseAddr,
+                 (XV_MIX_CTRL_ADDR_HWREG_LAYERHEIGHT_0_DATA+Offset),
+                 NewPtr->Win.Height, OldPtr->Win.Height);
+
+    if(XVMix_IsAlphaEnabled(InstancePtr, index)) {
+      Count += ShadowWriteReg(BaseAddr,
+                   (XV_MIX_CTRL_ADDR_HWREG_LAYERALPHA_0_DATA+Offset),
+                   NewPtr->Alpha, OldPtr->Alpha);
+    }
+    if(XVMix_IsScalingEnabled(InstancePtr, index)) {
+      Count += ShadowWriteReg(BaseAddr,
+                   (XV_MIX_CTRL_ADDR_HWREG_LAYERSCALEFACTOR_0_DATA+Offset),
+                   NewPtr->Scale, OldPtr->Scale);
+    }
+    if(!XVMix_IsLayerInterfaceStream(InstancePtr, index)) {
+      Count += ShadowWriteReg(BaseAddr,
+                   (XV_MIX_CTRL_ADDR_HWREG_LAYERSTRIDE_0_DATA+Offset),
+                   NewPtr->Stride, OldPtr->Stride);
+      Count += ShadowWriteAddr(BaseAddr,
+                   (XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA +
+                    ((index-1)*XVMIX_REG_OFFSET)),
+                   NewPtr->BufAddr, OldPtr->BufAddr);
+      Count += ShadowWriteAddr(BaseAddr,
+                   (XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA +
+                    ((index-1)*XVMIX_REG_OFFSET)),
+                   NewPtr->ChromaBufAddr, OldPtr->ChromaBufAddr);
+      InstancePtr->Layer[index].BufAddr = NewPtr->BufAddr;
+      InstancePtr->Layer[index].ChromaBufAddr = NewPtr->ChromaBufAddr;
+    }
+    InstancePtr->Layer[index].Win = NewPtr->Win;
+  }
+
+  if(XVMix_IsLogoEnabled(InstancePtr)) {
+    NewPtr = &ShadowPtr->Staged.Logo;
+    OldPtr = &ShadowPtr->Committed.Logo;
+
+    Count += ShadowWriteReg(BaseAddr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA,
+                            NewPtr->Win.StartX, OldPtr->Win.StartX);
+    Count += ShadowWriteReg(BaseAddr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTY_DATA,
+                            NewPtr->Win.StartY, OldPtr->Win.StartY);
+    Count += ShadowWriteReg(BaseAddr, XV_MIX_CTRL_ADDR_HWREG_LOGOWIDTH_DATA,
+                            NewPtr->Win.Width, OldPtr->Win.Width);
+    Count += ShadowWriteReg(BaseAddr, XV_MIX_CTRL_ADDR_HWREG_LOGOHEIGHT_DATA,
+                            NewPtr->Win.Height, OldPtr->Win.Height);
+    Count += ShadowWriteReg(BaseAddr,
+                            XV_MIX_CTRL_ADDR_HWREG_LOGOSCALEFACTOR_DATA,
+                            NewPtr->Scale, OldPtr->Scale);
+    Count += ShadowWriteReg(BaseAddr, XV_MIX_CTRL_ADDR_HWREG_LOGOALPHA_DATA,
+                            NewPtr->Alpha, OldPtr->Alpha);
+  }
+
+  Count += ShadowWriteReg(BaseAddr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA,
+                          ShadowPtr->Staged.LayerEnable,
+                          ShadowPtr->Committed.LayerEnable);
+
+  ShadowPtr->Committed = ShadowPtr->Staged;
+  ShadowPtr->IsPending = FALSE;
+
+  ShadowPtr->NumCommits++;
+  ShadowPtr->LastWrites = Count;
+  ShadowPtr->TotalWrites += Count;
+  if(ShadowPtr->Timer) {
+    Latency = ShadowPtr->Timer() - StartTime;
+    ShadowPtr->LastLatency = Latency;
+    if(Latency > ShadowPtr->MaxLatency) {
+      ShadowPtr->MaxLatency = Latency;
+    }
+  }
+
+  return(Count);
+}
+
+/*****************************************************************************/
+/**
+* This function requests the staged layer set to be committed by the
+* interrupt handler, when the current frame is done
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return none
+*
+* @note   Interrupts must be enabled, see XVMix_InterruptEnable(). The latency
+*         of the commit is measured from this call
+*
+******************************************************************************/
+void XVMix_ShadowRequestCommit(XV_Mix_l2 *InstancePtr)
+{
+  XVMix_Shadow *ShadowPtr;
+
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(InstancePtr->ShadowPtr != NULL);
+
+  ShadowPtr = InstancePtr->ShadowPtr;
+
+  if(!ShadowPtr->IsPending) {
+    if(ShadowPtr->Timer) {
+      ShadowPtr->RequestTime = ShadowPtr->Timer();
+    }
+    ShadowPtr->IsPending = TRUE;
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function reads the layer configuration from the core registers
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  SetPtr is a pointer to the layer set to be filled
+*
+* @return none
+*
+* @note   Registers not present in the IP configuration read as 0
+*
+******************************************************************************/
+static void ShadowReadLayers(XV_Mix_l2 *InstancePtr, XVMix_LayerSet *SetPtr)
+{
+  XV_mix *MixPtr;
+  XVMix_LayerState *LayerPtr;
+  UINTPTR BaseAddr;
+  u32 index, Offset, BufOffset;
+
+  MixPtr = &InstancePtr->Mix;
+  BaseAddr = MixPtr->Config.BaseAddress;
+
+  memset(SetPtr, 0, sizeof(XVMix_LayerSet));
+  SetPtr->LayerEnable = XV_mix_Get_HwReg_layerEnable(MixPtr);
+
+  for(index=XVMIX_LAYER_1; index<XVMix_GetNumLayers(InstancePtr); ++index) {
+    LayerPtr = &SetPtr->Layer[index];
+    Offset = index*XVMIX_REG_OFFSET;
+
+    LayerPtr->Win.StartX = XV_mix_ReadReg(BaseAddr,
+                     (XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTX_0_DATA+Offset));
+    LayerPtr->Win.StartY = XV_mix_ReadReg(BaseAddr,
+                     (XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTY_0_DATA+Offset));
+    LayerPtr->Win.Width  = XV_mix_ReadReg(BaseAddr,
+                     (XV_MIX_CTRL_ADDR_HWREG_LAYERWIDTH_0_DATA+Offset));
+    LayerPtr->Win.Height = XV_mix_ReadReg(BaseAddr,
+                     (XV_MIX_CTRL_ADDR_HWREG_LAYERHEIGHT_0_DATA+Offset));
+
+    if(XVMix_IsAlphaEnabled(InstancePtr, index)) {
+      LayerPtr->Alpha = XV_mix_ReadReg(BaseAddr,
+                     (XV_MIX_CTRL_ADDR_HWREG_LAYERALPHA_0_DATA+Offset));
+    }
+    if(XVMix_IsScalingEnabled(InstancePtr, index)) {
+      LayerPtr->Scale = XV_mix_ReadReg(BaseAddr,
+                     (XV_MIX_CTRL_ADDR_HWREG_LAYERSCALEFACTOR_0_DATA+Offset));
+    }
+    if(!XVMix_IsLayerInterfaceStream(InstancePtr, index)) {
+      BufOffset = (index-1)*XVMIX_REG_OFFSET;
+      LayerPtr->Stride = XV_mix_ReadReg(BaseAddr,
+                     (XV_MIX_CTRL_ADDR_HWREG_LAYERSTRIDE_0_DATA+Offset));
+      LayerPtr->BufAddr = (UINTPTR)
+          ((u64)XV_mix_ReadReg(BaseAddr,
+                 (XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA+BufOffset)) |
+           ((u64)XV_mix_ReadReg(BaseAddr,
+                 (XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA+BufOffset+4))
+            << 32));
+      LayerPtr->ChromaBufAddr = (UINTPTR)
+          ((u64)XV_mix_ReadReg(BaseAddr,
+                 (XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA+BufOffset)) |
+           ((u64)XV_mix_ReadReg(BaseAddr,
+                 (XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA+BufOffset+4))
+            << 32));
+    }
+  }
+
+  if(XVMix_IsLogoEnabled(InstancePtr)) {
+    LayerPtr = &SetPtr->Logo;
+
+    LayerPtr->Win.StartX = XV_mix_Get_HwReg_logoStartX(MixPtr);
+    LayerPtr->Win.StartY = XV_mix_Get_HwReg_logoStartY(MixPtr);
+    LayerPtr->Win.Width  = XV_mix_Get_HwReg_logoWidth(MixPtr);
+    LayerPtr->Win.Height = XV_mix_Get_HwReg_logoHeight(MixPtr);
+    LayerPtr->Scale = XV_mix_Get_HwReg_logoScaleFactor(MixPtr);
+    LayerPtr->Alpha = XV_mix_Get_HwReg_logoAlpha(MixPtr);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function validates the staged configuration of a layer against its
+* committed configuration
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer to be validated, Layer1-16
+* @param  NewPtr is a pointer to the staged configuration
+* @param  OldPtr is a pointer to the committed configuration
+*
+* @return XST_SUCCESS if the changed values are valid else error code with
+*         reason
+*
+******************************************************************************/
+static int ShadowValidateLayer(XV_Mix_l2 *InstancePtr,
+                               XVMix_LayerId LayerId,
+                               const XVMix_LayerState *NewPtr,
+                               const XVMix_LayerState *OldPtr)
+{
+  XV_mix *MixPtr;
+  XVidC_VideoWindow Win;
+  XVMix_Scalefactor Scale;
+  u32 Align;
+  u32 WinChanged, AlphaChanged, BufChanged;
+
+  MixPtr = &InstancePtr->Mix;
+
+  WinChanged   = ((NewPtr->Win.StartX != OldPtr->Win.StartX) ||
+                  (NewPtr->Win.StartY != OldPtr->Win.StartY) ||
+                  (NewPtr->Win.Width  != OldPtr->Win.Width)  ||
+                  (NewPtr->Win.Height != OldPtr->Win.Height) ||
+                  (NewPtr->Scale      != OldPtr->Scale));
+  AlphaChanged = (NewPtr->Alpha != OldPtr->Alpha);
+  BufChanged   = ((NewPtr->Stride        != OldPtr->Stride)  ||
+                  (NewPtr->BufAddr       != OldPtr->BufAddr) ||
+                  (NewPtr->ChromaBufAddr != OldPtr->ChromaBufAddr));
+
+  if(!WinChanged && !AlphaChanged && !BufChanged) {
+    return(XST_SUCCESS);
+  }
+
+  if(LayerId >= XVMix_GetNumLayers(InstancePtr)) {
+    return(XVMIX_ERR_DISABLED_IN_HW);
+  }
+
+  if(AlphaChanged) {
+    if(!XVMix_IsAlphaEnabled(InstancePtr, LayerId)) {
+      return(XVMIX_ERR_DISABLED_IN_HW);
+    }
+    if(NewPtr->Alpha > XVMIX_ALPHA_MAX) {
+      return(XST_INVALID_PARAM);
+    }
+  }
+
+  if(BufChanged) {
+    if(XVMix_IsLayerInterfaceStream(InstancePtr, LayerId)) {
+      return(XVMIX_ERR_LAYER_INTF_TYPE_MISMATCH);
+    }
+    /* Check alignment to aximm width (2*PPC*32-bits) */
+    Align = 2 * MixPtr->Config.PixPerClk * 4;
+    if((NewPtr->Stride % Align) != 0) {
+      return(XVMIX_ERR_WIN_STRIDE_MISALIGNED);
+    }
+    if(((NewPtr->BufAddr % Align) != 0) ||
+       ((NewPtr->ChromaBufAddr % Align) != 0)) {
+      return(XVMIX_ERR_MEM_ADDR_MISALIGNED);
+    }
+  }
+
+  if(WinChanged) {
+    if(XVMix_IsScalingEnabled(InstancePtr, LayerId)) {
+      if(NewPtr->Scale > XVMIX_SCALE_FACTOR_4X) {
+        return(XST_INVALID_PARAM);
+      }
+      Scale = (XVMix_Scalefactor)NewPtr->Scale;
+    } else {
+      if(NewPtr->Scale != OldPtr->Scale) {
+        return(XVMIX_ERR_DISABLED_IN_HW);
+      }
+      Scale = XVMIX_SCALE_FACTOR_1X;
+    }
+
+    Win = NewPtr->Win;
+    if(((Win.StartX % MixPtr->Config.PixPerClk) != 0) ||
+       ((Win.Width  % MixPtr->Config.PixPerClk) != 0) ||
+       (Win.Width  < XVMIX_MIN_STRM_WIDTH)  ||
+       (Win.Height < XVMIX_MIN_STRM_HEIGHT) ||
+       (Win.Width  > MixPtr->Config.LayerMaxWidth[LayerId-1]) ||
+       (Win.Height > MixPtr->Config.MaxHeight) ||
+       (!IsWindowValid(&InstancePtr->Stream, &Win, Scale))) {
+      return(XVMIX_ERR_LAYER_WINDOW_INVALID);
+    }
+  }
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function validates the staged configuration of the logo layer against
+* its committed configuration
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  NewPtr is a pointer to the staged configuration
+* @param  OldPtr is a pointer to the committed configuration
+*
+* @return XST_SUCCESS if the changed values are valid else error code with
+*         reason
+*
+******************************************************************************/
+static int ShadowValidateLogo(XV_Mix_l2 *InstancePtr,
+                              const XVMix_LayerState *NewPtr,
+                              const XVMix_LayerState *OldPtr)
+{
+  XV_mix *MixPtr;
+  XVidC_VideoWindow Win;
+  u32 WinChanged;
+
+  MixPtr = &InstancePtr->Mix;
+
+  WinChanged = ((NewPtr->Win.StartX != OldPtr->Win.StartX) ||
+                (NewPtr->Win.StartY != OldPtr->Win.StartY) ||
+                (NewPtr->Win.Width  != OldPtr->Win.Width)  ||
+                (NewPtr->Win.Height != OldPtr->Win.Height) ||
+                (NewPtr->Scale      != OldPtr->Scale));
+
+  if(!WinChanged && (NewPtr->Alpha == OldPtr->Alpha)) {
+    return(XST_SUCCESS);
+  }
+
+  if(!XVMix_IsLogoEnabled(InstancePtr)) {
+    return(XVMIX_ERR_DISABLED_IN_HW);
+  }
+
+  if((NewPtr->Alpha > XVMIX_ALPHA_MAX) ||
+     (NewPtr->Scale > XVMIX_SCALE_FACTOR_4X)) {
+    return(XST_INVALID_PARAM);
+  }
+
+  if(WinChanged) {
+    Win = NewPtr->Win;
+    if(((Win.StartX % MixPtr->Config.PixPerClk) != 0) ||
+       ((Win.Width  % MixPtr->Config.PixPerClk) != 0) ||
+       (Win.Width  < XVMIX_MIN_LOGO_WIDTH)  ||
+       (Win.Height < XVMIX_MIN_LOGO_HEIGHT) ||
+       (Win.Width  > MixPtr->Config.MaxLogoWidth) ||
+       (Win.Height > MixPtr->Config.MaxLogoHeight) ||
+       (!IsWindowValid(&InstancePtr->Stream, &Win,
+                       (XVMix_Scalefactor)NewPtr->Scale))) {
+      return(XVMIX_ERR_LAYER_WINDOW_INVALID);
+    }
+  }
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function writes a register if its value changed
+*
+* @param  BaseAddress is the base address of the core
+* @param  RegOffset is the offset of the register
+* @param  Data is the new value
+* @param  OldData is the committed value
+*
+* @return Number of registers written, 0 or 1
+*
+******************************************************************************/
+static u32 ShadowWriteReg(UINTPTR BaseAddress,
+                          u32 RegOffset,
+                          u32 Data,
+                          u32 OldData)
+{
+  if(Data == OldData) {
+    return(0);
+  }
+
+  XV_mix_WriteReg(BaseAddress, RegOffset, Data);
+  return(1);
+}
+
+/*****************************************************************************/
+/**
+* This function writes the words of a 64 bit buffer address register which
+* changed
+*
+* @param  BaseAddress is the base address of the core
+* @param  RegOffset is the offset of the register
+* @param  Addr is the new address
+* @param  OldAddr is the committed address
+*
+* @return Number of registers written, 0 to 2
+*
+******************************************************************************/
+static u32 ShadowWriteAddr(UINTPTR BaseAddress,
+                           u32 RegOffset,
+                           UINTPTR Addr,
+                           UINTPTR OldAddr)
+{
+  u32 Count;
+
+  Count  = ShadowWriteReg(BaseAddress, RegOffset,
+                          (u32)Addr, (u32)OldAddr);
+  Count += ShadowWriteReg(BaseAddress, (RegOffset + 4),
+                          (u32)((u64)Addr >> 32), (u32)((u64)OldAddr >> 32));
+  return(Count);
+}
 /** @} */
@@ -80,6 +80,30 @@
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
 *
+* <b> Staged Layer Configuration </b>
+*
+* Each layer API writes the core registers at once, so updating many layers
+* while a frame is processed takes many register writes and may show a mix of
+* the old and new settings. Instead, the configuration of all the layers can
+* be described in memory with an XVMix_LayerSet and applied in one commit:
+*   - Attach a shadow to the instance with XVMix_ShadowInit(). The shadow is
+*     provided by the application and starts from the register values.
+*   - Fill a layer set, for instance from a copy of the Committed set of the
+*     shadow, and stage it with XVMix_ShadowStage(). The changed values are
+*     validated like the layer APIs do.
+*   - Call XVMix_ShadowRequestCommit() in interrupt mode. The interrupt
+*     handler writes the registers at the next frame done, after the user
+*     callback and before the next frame is started. Until then
+*     XVMix_ShadowStage() returns XST_DEVICE_BUSY. XVMix_ShadowCommit()
+*     writes them at once, when the core is stopped or in polling mode.
+* A commit only writes the registers which differ from the last committed
+* set. The shadow counts the commits and register writes, and records the
+* latency of a commit if a time source was given to XVMix_ShadowInit().
+* The layer APIs do not update the shadow. Once it is attached, a layer
+* changed through them leaves the Committed set stale and a later commit may
+* skip registers it holds as unchanged: use only the shadow, or call
+* XVMix_ShadowInit() again after such changes.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -107,6 +131,7 @@
 * 4.00  vyc   04/04/18   Add 8th overlayer
 *                        Move logo layer enable from bit 8 to bit 15
 * 6.00  pg    01/10/20   Add Colorimetry Feature
+* 6.5   kt    10/18/26   Added staged layer configuration
 * </pre>
 *
 ******************************************************************************/
@@ -277,8 +302,8 @@ typedef struct {
             u8 *BBuffer;
         };
         UINTPTR BufAddr;
-        UINTPTR ChromaBufAddr;
     };
+    UINTPTR ChromaBufAddr;
 }XVMix_Layer;
 
 /**
@@ -295,6 +320,52 @@ typedef struct {
 */
 typedef void (*XVMix_Callback)(void *CallbackRef);
 
+/**
+ * This typedef contains the staged configuration of a layer
+ */
+typedef struct {
+    XVidC_VideoWindow Win;  /**< Window of the layer */
+    u32 Stride;             /**< Stride in bytes, memory layers only */
+    u16 Alpha;              /**< Alpha level, if alpha is enabled in HW */
+    u16 Scale;              /**< XVMix_Scalefactor, if enabled in HW */
+    UINTPTR BufAddr;        /**< Buffer address, memory layers only */
+    UINTPTR ChromaBufAddr;  /**< Chroma buffer address, memory layers only */
+}XVMix_LayerState;
+
+/**
+ * This typedef contains the configuration of all the layers, applied to the
+ * core in one commit
+ */
+typedef struct {
+    u32 LayerEnable;        /**< Layer enable mask, bit n enables layer n */
+    XVMix_LayerState Layer[XVMIX_MAX_SUPPORTED_LAYERS+1]; /**< Layer1-16,
+                                             indexed by layer id */
+    XVMix_LayerState Logo;  /**< Logo layer, Stride and buffers not used */
+}XVMix_LayerSet;
+
+/**
+ * Time source of the shadow statistics. Returns a free running count in
+ * any unit
+ */
+typedef u32 (*XVMix_ShadowTimer)(void);
+
+/**
+ * This typedef contains the shadow of the layer registers. It is provided by
+ * the application and attached to the instance with XVMix_ShadowInit()
+ */
+typedef struct {
+    XVMix_LayerSet Staged;     /**< Configuration of the next commit */
+    XVMix_LayerSet Committed;  /**< Configuration in the core registers */
+    volatile u8 IsPending;     /**< Commit requested for next frame done */
+    XVMix_ShadowTimer Timer;   /**< Time source, NULL if not used */
+    u32 RequestTime;           /**< Time of the pending request */
+    u32 NumCommits;            /**< Number of commits */
+    u32 LastWrites;            /**< Register writes of the last commit */
+    u32 TotalWrites;           /**< Register writes of all commits */
+    u32 LastLatency;           /**< Request to end of the last commit */
+    u32 MaxLatency;            /**< Largest commit latency */
+}XVMix_Shadow;
+
 /**
  * Mixer driver Layer 2 data. The user is required to allocate a variable
  * of this type for every mixer device in the system. A pointer to a
@@ -308,11 +379,13 @@ typedef struct {
     void *CallbackRef;     /**< To be passed to the connect interrupt
                                 callback */
 
-    XVMix_Layer Layer[XVMIX_MAX_SUPPORTED_LAYERS];  /**< Layer configuration
-                                                         structure */
+    XVMix_Layer Layer[XVMIX_MAX_SUPPORTED_LAYERS+1]; /**< Layer configuration
+                                                 structure, indexed by layer id */
     XVMix_BackgroundId BkgndColor;
 
     XVidC_VideoStream Stream;    /**< Input AXIS */
+    XVMix_Shadow *ShadowPtr;     /**< Layer register shadow, NULL if not
+                                      used */
 }XV_Mix_l2;
 
 /************************** Macros Definitions *******************************/
@@ -538,6 +611,13 @@ int XVMix_LoadLogoPixelAlpha(XV_Mix_l2 *InstancePtr,
                              XVidC_VideoWindow *Win,
                              u8 *ABuffer);
 
+int XVMix_ShadowInit(XV_Mix_l2 *InstancePtr,
+                     XVMix_Shadow *ShadowPtr,
+                     XVMix_ShadowTimer Timer);
+int XVMix_ShadowStage(XV_Mix_l2 *InstancePtr, const XVMix_LayerSet *SetPtr);
+u32 XVMix_ShadowCommit(XV_Mix_l2 *InstancePtr);
+void XVMix_ShadowRequestCommit(XV_Mix_l2 *InstancePtr);
+
 void XVMix_DbgReportStatus(XV_Mix_l2 *InstancePtr);
 void XVMix_DbgLayerInfo(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId);
 
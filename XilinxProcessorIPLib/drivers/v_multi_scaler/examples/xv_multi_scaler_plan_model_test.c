@@ -0,0 +1,220 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_multi_scaler_plan_model_test.c
+*
+* Host test and benchmark of the multi scaler plan cache against a software
+* model of the core registers. It is not a target example: it is built and
+* run with the other driver model tests by make -C scripts/host_model.
+*
+* Two instances of the same core are configured with the same random
+* sequence of channels and input/output sizes, one without plan cache and one
+* with a cache smaller than the set of sizes, so that plans are hit, packed
+* and evicted. After every XV_MultiScalerSetChannelConfig() the register
+* images of both cores, including the coefficients of all the channels, must
+* be bit for bit the same. This is done for all numbers of taps, with the
+* table and the designed coefficients. The cache statistics and the host
+* time of a channel configuration with and without cache are printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 1.5   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "xv_multi_scaler_l2.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define CORE_SPAN	0x20000U	/* Register space of a core */
+#define NUM_OUTPUTS	8U		/* Channels of the core */
+#define NUM_PLANS	8U		/* Plans of the cache */
+#define NUM_CONFIGS	2000U		/* Channel configurations per taps */
+#define SRC_BUF		0x10000000U	/* Frame buffers, not accessed */
+#define DST_BUF		0x40000000U
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define CORE(Addr)	((u32)((Addr) / CORE_SPAN) - 1U)
+#define NUM_MODES	(sizeof(Modes) / sizeof(Modes[0]))
+
+/************************** Function Prototypes ******************************/
+
+static void CoreInit(XV_multi_scaler *InstancePtr, u32 Core, u32 NumTaps);
+static void CompareCores(u32 Config);
+static void RunTaps(u32 NumTaps);
+
+/************************** Variable Definitions *****************************/
+
+static u32 Regs[2][CORE_SPAN / 4U];
+static XV_multi_scaler Msc[2];
+static XV_MultiScalerPlan Plans[NUM_PLANS];
+static XV_MultiScalerPlanCache Cache;
+static u64 ConfigTime[2];
+static u32 ConfigCount;
+
+/* Configuration table of the SDT initialization, the cores are set up by
+ * XV_multi_scaler_CfgInitialize() for each number of taps */
+XV_multi_scaler_Config XV_multi_scaler_ConfigTable[] = { { NULL } };
+
+/* Input and output sizes, width and height, more than the plans hold */
+static const u32 Modes[][4] = {
+	{ 1920U, 1080U, 1280U,  720U }, { 1920U, 1080U,  640U,  360U },
+	{ 3840U, 2160U, 1920U, 1080U }, { 1280U,  720U, 1920U, 1080U },
+	{ 1920U, 1080U, 1920U, 1080U }, { 1920U, 1080U,  720U,  480U },
+	{  640U,  480U, 1920U, 1080U }, { 3840U, 2160U,  640U,  360U },
+};
+
+/*****************************************************************************/
+/*
+* Register model: plain memory for each core.
+*/
+u32 Xil_In32(UINTPTR Addr)
+{
+	return Regs[CORE(Addr)][(Addr % CORE_SPAN) / 4U];
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	Regs[CORE(Addr)][(Addr % CORE_SPAN) / 4U] = Value;
+}
+
+u64 Xil_In64(UINTPTR Addr)
+{
+	return (u64)Xil_In32(Addr) | ((u64)Xil_In32(Addr + 4U) << 32U);
+}
+
+void Xil_Out64(UINTPTR Addr, u64 Value)
+{
+	Xil_Out32(Addr, (u32)Value);
+	Xil_Out32(Addr + 4U, (u32)(Value >> 32U));
+}
+
+static void CoreInit(XV_multi_scaler *InstancePtr, u32 Core, u32 NumTaps)
+{
+	XV_multi_scaler_Config Cfg;
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	Cfg.Name = "multi_scaler";
+	Cfg.Ctrl_BaseAddress = (Core + 1U) * CORE_SPAN;
+	Cfg.SamplesPerClock = 2U;
+	Cfg.MaxDataWidth = 8U;
+	Cfg.MaxCols = 3840U;
+	Cfg.MaxRows = 2160U;
+	Cfg.PhaseShift = 6U;
+	Cfg.NumTaps = NumTaps;
+	Cfg.MaxOuts = NUM_OUTPUTS;
+
+	memset(InstancePtr, 0, sizeof(*InstancePtr));
+	(void)XV_multi_scaler_CfgInitialize(InstancePtr, &Cfg);
+}
+
+static void CompareCores(u32 Config)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < (CORE_SPAN / 4U); Index++) {
+		if (Regs[0][Index] != Regs[1][Index]) {
+			XHOST_CHECK(0, "configuration %u: register 0x%05x is "
+				    "0x%08x, 0x%08x without cache",
+				    (unsigned)Config, (unsigned)(Index * 4U),
+				    (unsigned)Regs[1][Index],
+				    (unsigned)Regs[0][Index]);
+			return;
+		}
+	}
+}
+
+/*****************************************************************************/
+/*
+* One number of taps: random channels and sizes, each with the table or the
+* designed coefficients.
+*/
+static void RunTaps(u32 NumTaps)
+{
+	XV_multi_scaler_Video_Config Video;
+	u64 StartNs;
+	u32 Config;
+	u32 Mode;
+	u8 Design;
+
+	memset(Regs, 0, sizeof(Regs));
+	CoreInit(&Msc[0], 0U, NumTaps);
+	CoreInit(&Msc[1], 1U, NumTaps);
+	XV_MultiScalerPlanCacheInit(&Cache, Plans, NUM_PLANS);
+	XV_MultiScalerSetPlanCache(&Msc[1], &Cache);
+	srand(NumTaps);
+
+	for (Config = 0U; Config < NUM_CONFIGS; Config++) {
+		Mode = (u32)rand() % NUM_MODES;
+		Design = (u8)((u32)rand() & 1U);
+		memset(&Video, 0, sizeof(Video));
+		Video.ChannelId = (u32)rand() % NUM_OUTPUTS;
+		Video.WidthIn = Modes[Mode][0];
+		Video.HeightIn = Modes[Mode][1];
+		Video.WidthOut = Modes[Mode][2];
+		Video.HeightOut = Modes[Mode][3];
+		Video.InStride = Video.WidthIn * 4U;
+		Video.OutStride = Video.WidthOut * 4U;
+		Video.SrcImgBuf0 = SRC_BUF;
+		Video.SrcImgBuf1 = SRC_BUF + 0x10000000U;
+		Video.DstImgBuf0 = DST_BUF;
+		Video.DstImgBuf1 = DST_BUF + 0x10000000U;
+		Video.ColorFormatIn = XV_MULTI_SCALER_RGBX8;
+		Video.ColorFormatOut = XV_MULTI_SCALER_RGBX8;
+
+		XV_MultiScalerSetCoeffDesign(&Msc[0], Design);
+		XV_MultiScalerSetCoeffDesign(&Msc[1], Design);
+		StartNs = XHostModel_TimeNs();
+		XV_MultiScalerSetChannelConfig(&Msc[0], &Video);
+		ConfigTime[0] += XHostModel_TimeNs() - StartNs;
+		StartNs = XHostModel_TimeNs();
+		XV_MultiScalerSetChannelConfig(&Msc[1], &Video);
+		ConfigTime[1] += XHostModel_TimeNs() - StartNs;
+		ConfigCount++;
+		CompareCores(Config);
+	}
+
+	/* Both filters of a channel look up a plan */
+	XHOST_CHECK(Cache.Hits + Cache.Misses == 2U * NUM_CONFIGS,
+		    "%u hits %u misses", (unsigned)Cache.Hits,
+		    (unsigned)Cache.Misses);
+	XHOST_CHECK((Cache.Hits != 0U) && (Cache.Evictions != 0U),
+		    "%u hits %u evictions", (unsigned)Cache.Hits,
+		    (unsigned)Cache.Evictions);
+	printf("%2u taps: %u hits %u misses %u evictions\n",
+	       (unsigned)NumTaps, (unsigned)Cache.Hits,
+	       (unsigned)Cache.Misses, (unsigned)Cache.Evictions);
+}
+
+int main(void)
+{
+	u32 Taps;
+
+	for (Taps = XV_MULTISCALER_TAPS_6; Taps <= XV_MULTISCALER_TAPS_12;
+	     Taps += 2U) {
+		RunTaps(Taps);
+	}
+
+	XHOST_CHECK(XHostModel_AssertCount == 0U, "%u assertions",
+		    (unsigned)XHostModel_AssertCount);
+	printf("channel configuration: %.0f ns without cache, "
+	       "%.0f ns with cache\n", (double)ConfigTime[0] / ConfigCount,
+	       (double)ConfigTime[1] / ConfigCount);
+
+	return XHostModel_Report("xv_multi_scaler_plan_model_test");
+}
@@ -26,6 +26,8 @@ int XV_multi_scaler_CfgInitialize(XV_multi_scaler *InstancePtr,
 	InstancePtr->ScaleMode = ConfigPtr->ScaleMode;
 	InstancePtr->NumTaps = ConfigPtr->NumTaps;
 	InstancePtr->MaxOuts = ConfigPtr->MaxOuts;
+	InstancePtr->PlanCache = NULL;
+	InstancePtr->DesignCoeff = FALSE;
 
 	InstancePtr->Config.Ctrl_BaseAddress = ConfigPtr->Ctrl_BaseAddress;
 	InstancePtr->Config.MaxCols = ConfigPtr->MaxCols;
@@ -99,6 +99,9 @@ typedef struct {
 extern XV_multi_scaler_Config XV_multi_scaler_ConfigTable[];
 #endif
 
+/* Coefficients of a filter design: 64 phases of 12 taps */
+#define XV_MULTI_SCALER_DESIGN_COEFFS (64 * 12)
+
 typedef void (*XVMultiScaler_Callback)(void *CallbackRef);
 typedef struct {
     XV_multi_scaler_Config Config;
@@ -115,6 +118,11 @@ typedef struct {
     XVMultiScaler_Callback FrameDoneCallback;
     void *CallbackRef;
     u8 OutBitMask;
+    struct XV_MultiScalerPlanCache *PlanCache; /**< Coefficient plan cache,
+						 *  NULL if not used */
+    u8 DesignCoeff; /**< Design coefficients instead of using the tables */
+    short Designed[XV_MULTI_SCALER_DESIGN_COEFFS]; /**< Designed
+						     *  coefficients */
 } XV_multi_scaler;
 
 /***************** Macros (Inline Functions) Definitions *********************/
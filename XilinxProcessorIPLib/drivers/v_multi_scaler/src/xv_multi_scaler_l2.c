@@ -263,6 +263,14 @@ static const void (*XV_MS_Set_DstImgBuf1[XV_MAX_OUTS])(XV_multi_scaler
 	XV_multi_scaler_Set_HwReg_dstImgBuf1_7_V};
 
 /************************** Function Prototypes ******************************/
+static const short *XV_MultiScalerSelectCoeff(XV_multi_scaler *MscPtr,
+		u32 SizeIn, u32 SizeOut);
+static u32 XV_MultiScalerPackCoeff(XV_multi_scaler *MscPtr,
+		const short *coeff, u32 *CoeffWords);
+static void XV_MultiScalerWriteCoeff(XV_multi_scaler *MscPtr, u32 baseAddr,
+		const short *coeff);
+static XV_MultiScalerPlan *XV_MultiScalerGetPlan(XV_multi_scaler *MscPtr,
+		u32 SizeIn, u32 SizeOut);
 static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
 				   XV_multi_scaler_Video_Config *MS_cfg);
 
@@ -345,30 +353,46 @@ void XV_MultiScalerSetNumOutputs(XV_multi_scaler *InstancePtr, u32 NumOuts)
 
 /*****************************************************************************/
 /**
-* This function programs the computed filter coefficients and phase data into
-* core registers
+* This function selects the internal filter coefficients for a scaling ratio.
+* The same selection is used for the vertical and the horizontal filter.
+* With coefficient design enabled the coefficients are designed for the
+* exact scaling ratio instead, into the Designed array of the instance.
 *
 * @param	MscPtr is a pointer to the core instance to be worked on.
-* @param	NumOut is the output channel number.
+* @param	SizeIn is the input height or width.
+* @param	SizeOut is the output height or width.
 *
-* @return None
+* @return Pointer to the coefficient table
 *
 ******************************************************************************/
-static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
-		XV_multi_scaler_Video_Config *MS_cfg)
+static const short *XV_MultiScalerSelectCoeff(XV_multi_scaler *MscPtr,
+		u32 SizeIn, u32 SizeOut)
 {
-	u32 num_phases = 1<<MscPtr->PhaseShift;
-	u32 num_taps	= MscPtr->NumTaps/2;
-	u32 val;
-	u32 i;
-	u32 j;
-	u32 baseAddr;
-	short *coeff;
-	u32 vfltcoef_offset;
-	u32 hfltcoef_offset;
+	short *designed = MscPtr->Designed;
+	const short *coeff;
 	float scale;
+	s32 i;
+	s32 j;
+
+	if (MscPtr->DesignCoeff &&
+	    (XVidC_PolyphaseDesign(designed, 1 << MscPtr->PhaseShift,
+				   MscPtr->NumTaps, SizeIn, SizeOut) ==
+	     XST_SUCCESS)) {
+		/*
+		 * Spread the phases to rows of XV_MULTISCALER_TAPS_12, the taps
+		 * first. The last row is moved first as rows only grow.
+		 */
+		for (i = (1 << MscPtr->PhaseShift) - 1; i >= 0; i--) {
+			for (j = XV_MULTISCALER_TAPS_12 - 1; j >= 0; j--) {
+				designed[i * XV_MULTISCALER_TAPS_12 + j] =
+					(j < (s32)MscPtr->NumTaps) ?
+					designed[i * MscPtr->NumTaps + j] : 0;
+			}
+		}
+		return designed;
+	}
 
-	scale = (float)MS_cfg->HeightIn / MS_cfg->HeightOut;
+	scale = (float)SizeIn / SizeOut;
 	if ((scale >= 2) && (scale < 2.5))
 	{
 		if(MscPtr->NumTaps == 6)
@@ -416,11 +440,62 @@ static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
 	if(scale < 1)
 		coeff = &XV_multiscaler_fixedcoeff_taps6_12C[0][0];
 
-	vfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_VFLTCOEFF_0_BASE +
-		MS_cfg->ChannelId *
-		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
+	return coeff;
+}
+
+/*****************************************************************************/
+/**
+* This function builds the register image of a coefficient table, as written
+* by XV_MultiScalerWriteCoeff().
+*
+* @param	MscPtr is a pointer to the core instance to be worked on.
+* @param	coeff is a pointer to the coefficient table.
+* @param	CoeffWords is an array of XV_MULTISCALER_PLAN_COEFF_WORDS words
+*		to store the register image into.
+*
+* @return Number of words of the register image
+*
+******************************************************************************/
+static u32 XV_MultiScalerPackCoeff(XV_multi_scaler *MscPtr,
+		const short *coeff, u32 *CoeffWords)
+{
+	u32 num_phases = 1<<MscPtr->PhaseShift;
+	u32 num_taps	= MscPtr->NumTaps/2;
+	u32 i;
+	u32 j;
+
+	/* Same order as XV_MultiScalerWriteCoeff(), the last write wins */
+	for (i = 0; i < num_phases; i++) {
+		for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
+			CoeffWords[i * num_taps + j / 2] =
+				(coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
+				(coeff[i * XV_MULTISCALER_TAPS_12 + j] & 0x0000FFFF);
+		}
+	}
+
+	return (num_phases * num_taps) + (XV_MULTISCALER_TAPS_12 / 2) - num_taps;
+}
+
+/*****************************************************************************/
+/**
+* This function programs a coefficient table into a filter of the core
+*
+* @param	MscPtr is a pointer to the core instance to be worked on.
+* @param	baseAddr is the address of the filter coefficient registers.
+* @param	coeff is a pointer to the coefficient table.
+*
+* @return None
+*
+******************************************************************************/
+static void XV_MultiScalerWriteCoeff(XV_multi_scaler *MscPtr, u32 baseAddr,
+		const short *coeff)
+{
+	u32 num_phases = 1<<MscPtr->PhaseShift;
+	u32 num_taps	= MscPtr->NumTaps/2;
+	u32 val;
+	u32 i;
+	u32 j;
 
-	baseAddr = MscPtr->Ctrl_BaseAddress + vfltcoef_offset;
 	for (i = 0; i < num_phases; i++) {
 		for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
 			val = (coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
@@ -429,68 +504,193 @@ static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
 					((i * num_taps + j / 2) * 4), val);
 		}
 	}
+}
 
-	scale = (float)MS_cfg->WidthIn / MS_cfg->WidthOut;
-	if ((scale >= 2) && (scale < 2.5))
-	{
-		if(MscPtr->NumTaps == 6)
-			coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-		else
-			coeff = &XV_multiscaler_fixedcoeff_taps8_12C[0][0];
-	}
-	if ((scale >= 2.5) && (scale < 3))
-	{
-		if(MscPtr->NumTaps >= 10)
-			coeff = &XV_multiscaler_fixedcoeff_taps10_12C[0][0];
-		else
-		{
-			if(MscPtr->NumTaps == 6)
-				coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-			else
-				coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-		}
-	}
+/*****************************************************************************/
+/**
+* This function looks up the plan of a scaling ratio in the plan cache of the
+* instance. If there is none, the least recently used plan is computed for it.
+*
+* @param	MscPtr is a pointer to the core instance to be worked on.
+* @param	SizeIn is the input height or width.
+* @param	SizeOut is the output height or width.
+*
+* @return Pointer to the plan
+*
+******************************************************************************/
+static XV_MultiScalerPlan *XV_MultiScalerGetPlan(XV_multi_scaler *MscPtr,
+		u32 SizeIn, u32 SizeOut)
+{
+	XV_MultiScalerPlanCache *CachePtr = MscPtr->PlanCache;
+	XV_MultiScalerPlan *PlanPtr;
+	XV_MultiScalerPlan *VictimPtr;
+	u32 i;
 
-	if ((scale >= 3) && (scale < 3.5))
-		if(MscPtr->NumTaps == 12)
-			coeff = &XV_multiscaler_fixedcoeff_taps12_12C[0][0];
-		else
-		{
-			if(MscPtr->NumTaps == 6)
-				coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-			if(MscPtr->NumTaps == 8)
-				coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-			if(MscPtr->NumTaps == 10)
-				coeff = &XV_multiscaler_fixedcoeff_taps10_10C[0][0];
+	CachePtr->Clock++;
+	VictimPtr = &CachePtr->Plans[0];
+	for (i = 0; i < CachePtr->NumPlans; i++) {
+		PlanPtr = &CachePtr->Plans[i];
+		if (PlanPtr->IsValid &&
+		    (PlanPtr->SizeIn == SizeIn) &&
+		    (PlanPtr->SizeOut == SizeOut) &&
+		    (PlanPtr->NumTaps == MscPtr->NumTaps) &&
+		    (PlanPtr->PhaseShift == MscPtr->PhaseShift) &&
+		    (PlanPtr->IsDesigned == MscPtr->DesignCoeff)) {
+			PlanPtr->LastUse = CachePtr->Clock;
+			CachePtr->Hits++;
+			return PlanPtr;
 		}
 
-	if ((scale >= 3.5) || (scale < 2 && scale >= 1))
-	{
-		if(MscPtr->NumTaps == 6)
-			coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-		if(MscPtr->NumTaps == 8)
-			coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-		if(MscPtr->NumTaps == 10)
-			coeff = &XV_multiscaler_fixedcoeff_taps10_10C[0][0];
-		if(MscPtr->NumTaps == 12)
-			coeff = &XV_multiscaler_fixedcoeff_taps12_12C[0][0];
+		/* Prefer a free plan, else the least recently used one */
+		if (VictimPtr->IsValid &&
+		    (!PlanPtr->IsValid ||
+		     ((CachePtr->Clock - PlanPtr->LastUse) >
+		      (CachePtr->Clock - VictimPtr->LastUse))))
+			VictimPtr = PlanPtr;
 	}
-	if(scale < 1)
-		coeff = &XV_multiscaler_fixedcoeff_taps6_12C[0][0];
 
-	hfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_HFLTCOEFF_0_BASE +
+	if (VictimPtr->IsValid)
+		CachePtr->Evictions++;
+	CachePtr->Misses++;
+
+	VictimPtr->NumWords = XV_MultiScalerPackCoeff(MscPtr,
+			XV_MultiScalerSelectCoeff(MscPtr, SizeIn, SizeOut),
+			VictimPtr->CoeffWords);
+	VictimPtr->SizeIn = SizeIn;
+	VictimPtr->SizeOut = SizeOut;
+	VictimPtr->NumTaps = MscPtr->NumTaps;
+	VictimPtr->PhaseShift = MscPtr->PhaseShift;
+	VictimPtr->IsDesigned = MscPtr->DesignCoeff;
+	VictimPtr->IsValid = TRUE;
+	VictimPtr->LastUse = CachePtr->Clock;
+
+	return VictimPtr;
+}
+
+/*****************************************************************************/
+/**
+* This function programs the computed filter coefficients and phase data into
+* core registers
+*
+* @param	MscPtr is a pointer to the core instance to be worked on.
+* @param	MS_cfg is a pointer to the multi scaler config structure.
+*
+* @return None
+*
+* @note		With a plan cache the register images of the plans are written,
+*		which leaves the registers as without plan cache.
+*
+******************************************************************************/
+static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
+		XV_multi_scaler_Video_Config *MS_cfg)
+{
+	XV_MultiScalerPlan *PlanPtr;
+	u32 vbaseAddr;
+	u32 hbaseAddr;
+	u32 i;
+
+	vbaseAddr = MscPtr->Ctrl_BaseAddress +
+		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_VFLTCOEFF_0_BASE +
+		MS_cfg->ChannelId *
+		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
+	hbaseAddr = MscPtr->Ctrl_BaseAddress +
+		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_HFLTCOEFF_0_BASE +
 		MS_cfg->ChannelId *
 		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
 
-	baseAddr = MscPtr->Ctrl_BaseAddress + hfltcoef_offset;
-	for (i = 0; i < num_phases; i++) {
-		for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
-			val = (coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
-				(coeff[i * XV_MULTISCALER_TAPS_12 + j] & 0x0000FFFF);
-			XV_multi_scaler_WriteReg(baseAddr,
-					((i * num_taps + j / 2) * 4), val);
-		}
+	if (MscPtr->PlanCache == NULL) {
+		XV_MultiScalerWriteCoeff(MscPtr, vbaseAddr,
+			XV_MultiScalerSelectCoeff(MscPtr, MS_cfg->HeightIn,
+						  MS_cfg->HeightOut));
+		XV_MultiScalerWriteCoeff(MscPtr, hbaseAddr,
+			XV_MultiScalerSelectCoeff(MscPtr, MS_cfg->WidthIn,
+						  MS_cfg->WidthOut));
+		return;
 	}
+
+	PlanPtr = XV_MultiScalerGetPlan(MscPtr, MS_cfg->HeightIn,
+					MS_cfg->HeightOut);
+	for (i = 0; i < PlanPtr->NumWords; i++)
+		XV_multi_scaler_WriteReg(vbaseAddr, (i * 4),
+					 PlanPtr->CoeffWords[i]);
+
+	PlanPtr = XV_MultiScalerGetPlan(MscPtr, MS_cfg->WidthIn,
+					MS_cfg->WidthOut);
+	for (i = 0; i < PlanPtr->NumWords; i++)
+		XV_multi_scaler_WriteReg(hbaseAddr, (i * 4),
+					 PlanPtr->CoeffWords[i]);
+}
+
+/*****************************************************************************/
+/**
+* This function initializes a plan cache. The cache is empty and its
+* statistics are cleared.
+*
+* @param	CachePtr is a pointer to the plan cache to be initialized.
+* @param	PlansPtr is a pointer to an array of plans allocated by the user.
+* @param	NumPlans is the number of plans in the array.
+*
+* @return None
+*
+******************************************************************************/
+void XV_MultiScalerPlanCacheInit(XV_MultiScalerPlanCache *CachePtr,
+	XV_MultiScalerPlan *PlansPtr, u32 NumPlans)
+{
+	u32 i;
+
+	Xil_AssertVoid(CachePtr != NULL);
+	Xil_AssertVoid(PlansPtr != NULL);
+	Xil_AssertVoid(NumPlans > 0);
+
+	CachePtr->Plans = PlansPtr;
+	CachePtr->NumPlans = NumPlans;
+	CachePtr->Clock = 0;
+	CachePtr->Hits = 0;
+	CachePtr->Misses = 0;
+	CachePtr->Evictions = 0;
+	for (i = 0; i < NumPlans; i++)
+		PlansPtr[i].IsValid = FALSE;
+}
+
+/*****************************************************************************/
+/**
+* This function attaches a plan cache to the instance. The following calls to
+* XV_MultiScalerSetChannelConfig() program the coefficients through the cache.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+* @param	CachePtr is a pointer to an initialized plan cache, NULL to
+*		compute every configuration again.
+*
+* @return None
+*
+******************************************************************************/
+void XV_MultiScalerSetPlanCache(XV_multi_scaler *InstancePtr,
+	XV_MultiScalerPlanCache *CachePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->PlanCache = CachePtr;
+}
+
+/*****************************************************************************/
+/**
+* This function selects how the following calls to
+* XV_MultiScalerSetChannelConfig() get the filter coefficients. When enabled
+* they are designed for the exact scaling ratio and the number of taps of the
+* IP, else they are taken from the fixed tables.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+* @param	Enable is TRUE to design the coefficients, FALSE to use the
+*		tables.
+*
+* @return None
+*
+******************************************************************************/
+void XV_MultiScalerSetCoeffDesign(XV_multi_scaler *InstancePtr, u8 Enable)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->DesignCoeff = Enable;
 }
 
 /*****************************************************************************/
@@ -32,6 +32,22 @@
 * This driver is not thread safe. Any needs for threads or thread mutual
 * exclusion must be satisfied by the layer above this driver.
 *
+* <b> Plan Cache </b>
+*
+* XV_MultiScalerSetChannelConfig() selects and packs the filter coefficients
+* of both filters of the channel for every call. A plan cache can be attached
+* to the instance with XV_MultiScalerSetPlanCache(). A plan holds the
+* coefficient register image of one input/output size, for either filter of
+* any channel, which is written back without being computed again. The Hits,
+* Misses and Evictions counters of the cache give its hit rate.
+*
+* <b> Coefficient Design </b>
+*
+* By default the filter coefficients are taken from fixed tables, selected by
+* ranges of scaling ratio. XV_MultiScalerSetCoeffDesign() makes the driver
+* design the coefficients for the exact scaling ratio and the number of taps
+* of the IP instead, see XVidC_PolyphaseDesign().
+*
 * <b>Limitations</b>
 *
 ******************************************************************************/
@@ -56,6 +72,8 @@ extern "C" {
 #define STEP_PRECISION 65536
 #define XVSC_MASK_LOW_16BITS 0x0000FFFF
 #define XVSC_MASK_HIGH_16BITS 0xFFFF0000
+#define XV_MULTISCALER_PLAN_COEFF_WORDS (XV_MULTISCALER_MAX_V_PHASES * \
+		XV_MULTISCALER_TAPS_12 / 2)
 
 /**************************** Type Definitions *******************************/
 /**
@@ -124,6 +142,34 @@ typedef struct {
 	XV_multi_scaler_Crop_Window CropWin;
 } XV_multi_scaler_Video_Config;
 
+/**
+ * This typedef contains a plan, the coefficient register image of a filter
+ * for one scaling ratio
+ */
+typedef struct {
+	u32 SizeIn;	/**< Input height or width */
+	u32 SizeOut;	/**< Output height or width */
+	u32 NumTaps;	/**< Number of taps of the IP */
+	u32 PhaseShift;	/**< Phase shift of the IP */
+	u8 IsDesigned;	/**< Coefficients are designed */
+	u8 IsValid;	/**< Plan holds a scaling ratio */
+	u32 LastUse;	/**< Cache clock of the last use, for replacement */
+	u32 NumWords;	/**< Number of words of the register image */
+	u32 CoeffWords[XV_MULTISCALER_PLAN_COEFF_WORDS]; /**< Register image */
+} XV_MultiScalerPlan;
+
+/**
+ * This typedef contains a plan cache. The plans are provided by the user.
+ */
+typedef struct XV_MultiScalerPlanCache {
+	XV_MultiScalerPlan *Plans;	/**< Array of plans */
+	u32 NumPlans;	/**< Number of plans in the array */
+	u32 Clock;	/**< Counts the lookups, for replacement */
+	u32 Hits;	/**< Number of filters served by a plan */
+	u32 Misses;	/**< Number of filters which computed a plan */
+	u32 Evictions;	/**< Number of plans replaced */
+} XV_MultiScalerPlanCache;
+
 /*extern const short XV_multiscaler_fixedcoeff_taps6[XV_MULTISCALER_MAX_V_PHASES]
 	[XV_MULTISCALER_TAPS_12];
 extern const short XV_multiscaler_fixedcoeff_taps8[XV_MULTISCALER_MAX_V_PHASES]
@@ -156,6 +202,11 @@ void XV_MultiScalerGetChannelConfig(XV_multi_scaler  *InstancePtr,
 	XV_multi_scaler_Video_Config *multi_scaler_cfg);
 void XV_MultiScalerSetChannelConfig(XV_multi_scaler  *InstancePtr,
 	XV_multi_scaler_Video_Config *multi_scaler_cfg);
+void XV_MultiScalerPlanCacheInit(XV_MultiScalerPlanCache *CachePtr,
+	XV_MultiScalerPlan *PlansPtr, u32 NumPlans);
+void XV_MultiScalerSetPlanCache(XV_multi_scaler *InstancePtr,
+	XV_MultiScalerPlanCache *CachePtr);
+void XV_MultiScalerSetCoeffDesign(XV_multi_scaler *InstancePtr, u8 Enable);
 
 #ifdef __cplusplus
 }
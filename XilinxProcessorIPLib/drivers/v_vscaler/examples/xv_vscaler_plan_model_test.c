@@ -0,0 +1,233 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_vscaler_plan_model_test.c
+*
+* Host test and benchmark of the V Scaler plan cache against a software model
+* of the core registers. It is not a target example: it is built and run with
+* the other driver model tests by make -C scripts/host_model.
+*
+* Two instances of the same core are set up with the same random sequence of
+* scaling ratios, one without plan cache and one with a cache smaller than the
+* set of ratios, so that plans are hit, computed and evicted. After every
+* XV_VScalerSetup() the register images of both cores must be bit for bit the
+* same. This is done for all pixels per clock and numbers of taps, with the
+* table and the designed coefficients, and with user coefficients loaded by
+* XV_VScalerLoadExtCoeff(). The cache statistics and the host time of a setup
+* with and without cache are printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 3.3   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "xv_vscaler_l2.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define CORE_SPAN	0x1000U		/* Register space of a core */
+#define NUM_PLANS	6U		/* Plans of the cache */
+#define NUM_SETUPS	1000U		/* Setups per configuration */
+#define NUM_EXT_SETUPS	100U		/* Setups with user coefficients */
+#define FRAME_WIDTH	1920U
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define CORE(Addr)	((u32)((Addr) / CORE_SPAN) - 1U)
+#define NUM_MODES	(sizeof(Modes) / sizeof(Modes[0]))
+
+/************************** Function Prototypes ******************************/
+
+static void CoreInit(XV_Vscaler_l2 *InstancePtr, u32 Core, u32 PixPerClk,
+		     u32 NumTaps);
+static u64 TimedSetup(XV_Vscaler_l2 *InstancePtr, u32 Mode);
+static void CompareCores(const char *What, u32 Setup);
+static void RunConfig(u32 PixPerClk, u32 NumTaps);
+
+/************************** Variable Definitions *****************************/
+
+static u32 Regs[2][CORE_SPAN / 4U];
+static XV_Vscaler_l2 Vsc[2];
+static XV_VScalerPlan Plans[NUM_PLANS];
+static XV_VScalerPlanCache Cache;
+static short ExtCoeff[XV_VSCALER_MAX_V_PHASES * XV_VSCALER_MAX_V_TAPS];
+static u64 SetupTime[2];
+static u32 SetupCount;
+static u64 HitTime;
+static u32 HitCount;
+
+/* Configuration table of the SDT initialization, the cores are set up by
+ * XV_vscaler_CfgInitialize() for each configuration */
+XV_vscaler_Config XV_vscaler_ConfigTable[] = { { NULL } };
+
+/* Input and output heights, more than the plans of the cache */
+static const u32 Modes[][2] = {
+	{  480U, 1080U }, {  720U, 1080U }, { 1080U, 1080U }, { 2160U, 1080U },
+	{ 1080U,  720U }, { 1080U,  480U }, { 2160U,  360U }, { 1080U,  360U },
+	{  576U, 2160U }, { 1440U, 1080U }, { 2160U,  768U }, {  768U, 2160U },
+};
+
+/*****************************************************************************/
+/*
+* Register model: plain memory for each core.
+*/
+u32 Xil_In32(UINTPTR Addr)
+{
+	return Regs[CORE(Addr)][(Addr % CORE_SPAN) / 4U];
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	Regs[CORE(Addr)][(Addr % CORE_SPAN) / 4U] = Value;
+}
+
+static void CoreInit(XV_Vscaler_l2 *InstancePtr, u32 Core, u32 PixPerClk,
+		     u32 NumTaps)
+{
+	XV_vscaler_Config Cfg;
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	Cfg.Name = "vscaler";
+	Cfg.PixPerClk = (u16)PixPerClk;
+	Cfg.MaxWidth = 4096U;
+	Cfg.MaxHeight = 2160U;
+	Cfg.PhaseShift = 6U;
+	Cfg.NumTaps = (u16)NumTaps;
+	Cfg.ScalerType = XV_VSCALER_POLYPHASE;
+	Cfg.Is420Enabled = 1U;
+
+	memset(InstancePtr, 0, sizeof(*InstancePtr));
+	(void)XV_vscaler_CfgInitialize(&InstancePtr->Vsc, &Cfg,
+				       (Core + 1U) * CORE_SPAN);
+}
+
+static u64 TimedSetup(XV_Vscaler_l2 *InstancePtr, u32 Mode)
+{
+	u64 StartNs = XHostModel_TimeNs();
+
+	XHOST_CHECK(XV_VScalerSetup(InstancePtr, FRAME_WIDTH, Modes[Mode][0],
+				    Modes[Mode][1], XVIDC_CSF_RGB) ==
+		    XST_SUCCESS,
+		    "setup %u->%u", (unsigned)Modes[Mode][0],
+		    (unsigned)Modes[Mode][1]);
+
+	return XHostModel_TimeNs() - StartNs;
+}
+
+static void CompareCores(const char *What, u32 Setup)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < (CORE_SPAN / 4U); Index++) {
+		if (Regs[0][Index] != Regs[1][Index]) {
+			XHOST_CHECK(0, "%s setup %u: register 0x%04x is 0x%08x,"
+				    " 0x%08x without cache", What,
+				    (unsigned)Setup, (unsigned)(Index * 4U),
+				    (unsigned)Regs[1][Index],
+				    (unsigned)Regs[0][Index]);
+			return;
+		}
+	}
+}
+
+/*****************************************************************************/
+/*
+* One core configuration: random ratios, each with the table or the designed
+* coefficients, then user coefficients.
+*/
+static void RunConfig(u32 PixPerClk, u32 NumTaps)
+{
+	u32 Setup;
+	u32 Mode;
+	u32 Hits;
+	u64 Time;
+	u8 Design;
+
+	memset(Regs, 0, sizeof(Regs));
+	CoreInit(&Vsc[0], 0U, PixPerClk, NumTaps);
+	CoreInit(&Vsc[1], 1U, PixPerClk, NumTaps);
+	XV_VScalerPlanCacheInit(&Cache, Plans, NUM_PLANS);
+	XV_VScalerSetPlanCache(&Vsc[1], &Cache);
+	srand(PixPerClk * 16U + NumTaps);
+
+	for (Setup = 0U; Setup < NUM_SETUPS; Setup++) {
+		Mode = (u32)rand() % NUM_MODES;
+		Design = (u8)((u32)rand() & 1U);
+		XV_VScalerSetCoeffDesign(&Vsc[0], Design);
+		XV_VScalerSetCoeffDesign(&Vsc[1], Design);
+		SetupTime[0] += TimedSetup(&Vsc[0], Mode);
+		Hits = Cache.Hits;
+		Time = TimedSetup(&Vsc[1], Mode);
+		SetupTime[1] += Time;
+		SetupCount++;
+		if (Cache.Hits != Hits) {
+			HitTime += Time;
+			HitCount++;
+		}
+		CompareCores("internal coefficients", Setup);
+	}
+	XHOST_CHECK(Cache.Hits + Cache.Misses == NUM_SETUPS,
+		    "%u hits %u misses", (unsigned)Cache.Hits,
+		    (unsigned)Cache.Misses);
+	XHOST_CHECK((Cache.Hits != 0U) && (Cache.Evictions != 0U),
+		    "%u hits %u evictions", (unsigned)Cache.Hits,
+		    (unsigned)Cache.Evictions);
+	printf("%u ppc %2u taps: %u hits %u misses %u evictions\n",
+	       (unsigned)PixPerClk, (unsigned)NumTaps, (unsigned)Cache.Hits,
+	       (unsigned)Cache.Misses, (unsigned)Cache.Evictions);
+
+	XV_VScalerLoadExtCoeff(&Vsc[0], XV_VSCALER_MAX_V_PHASES, (u16)NumTaps,
+			       ExtCoeff);
+	XV_VScalerLoadExtCoeff(&Vsc[1], XV_VSCALER_MAX_V_PHASES, (u16)NumTaps,
+			       ExtCoeff);
+	for (Setup = 0U; Setup < NUM_EXT_SETUPS; Setup++) {
+		Mode = (u32)rand() % NUM_MODES;
+		(void)TimedSetup(&Vsc[0], Mode);
+		(void)TimedSetup(&Vsc[1], Mode);
+		CompareCores("user coefficients", Setup);
+	}
+}
+
+int main(void)
+{
+	static const u32 PixPerClk[] = { XVIDC_PPC_1, XVIDC_PPC_2,
+					 XVIDC_PPC_4, XVIDC_PPC_8 };
+	u32 Index;
+	u32 Ppc;
+	u32 Taps;
+
+	for (Index = 0U; Index < sizeof(ExtCoeff) / sizeof(ExtCoeff[0]);
+	     Index++) {
+		ExtCoeff[Index] = (short)(((Index * 37U) % 1024U) - 256);
+	}
+
+	for (Ppc = 0U; Ppc < sizeof(PixPerClk) / sizeof(PixPerClk[0]); Ppc++) {
+		for (Taps = XV_VSCALER_TAPS_6; Taps <= XV_VSCALER_TAPS_12;
+		     Taps += 2U) {
+			RunConfig(PixPerClk[Ppc], Taps);
+		}
+	}
+
+	XHOST_CHECK(XHostModel_AssertCount == 0U, "%u assertions",
+		    (unsigned)XHostModel_AssertCount);
+	printf("setup: %.0f ns without cache, %.0f ns with cache, "
+	       "%.0f ns on a hit\n", (double)SetupTime[0] / SetupCount,
+	       (double)SetupTime[1] / SetupCount, (double)HitTime / HitCount);
+
+	return XHostModel_Report("xv_vscaler_plan_model_test");
+}
@@ -28,6 +28,8 @@
 *       rco   02/09/17   Fix c++ compilation warnings
 *	jsr   09/07/18 Fix for 64-bit driver support
 * 3.1   vsa   04/07/20   Improve quality with new coefficients
+* 3.3   kt    10/18/26   Added coefficient plan cache
+*       kt    10/18/26   Added runtime coefficient design
 *
 * </pre>
 *
@@ -64,7 +66,10 @@ static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
 		                          u32 HeightIn,
 		                          u32 HeightOut);
 
-static void XV_VScalerSetCoeff(XV_Vscaler_l2 *VscPtr);
+static void XV_VScalerSetCoeff(XV_Vscaler_l2 *VscPtr, u32 *CoeffWords);
+static void XV_VScalerSetPlan(XV_Vscaler_l2 *VscPtr,
+                              u32 HeightIn,
+                              u32 HeightOut);
 
 /*****************************************************************************/
 /**
@@ -125,7 +130,8 @@ void XV_VScalerStop(XV_Vscaler_l2 *InstancePtr)
 /*****************************************************************************/
 /**
 * This function loads default filter coefficients in the scaler coefficient
-* storage based on the selected TAP configuration
+* storage based on the selected TAP configuration. With coefficient design
+* enabled the coefficients are designed for the exact scaling ratio instead.
 *
 * @param  InstancePtr is a pointer to the core instance to be worked on.
 * @param  WidthIn is the input stream height
@@ -154,7 +160,18 @@ static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
   /* Scale Down Mode will use dynamic filter selection logic
    * Scale Up Mode (including 1:1) will always use 6 tap filter
    */
-  if(IsScaleDown)
+  if(InstancePtr->DesignCoeff &&
+     (XVidC_PolyphaseDesign(InstancePtr->designed,
+                            numPhases,
+                            InstancePtr->Vsc.Config.NumTaps,
+                            HeightIn,
+                            HeightOut) == XST_SUCCESS))
+  {
+    //Filter designed for the exact ratio with all taps of the IP
+    coeff = InstancePtr->designed;
+    numTaps = InstancePtr->Vsc.Config.NumTaps;
+  }
+  else if(IsScaleDown)
   {
     ScalingRatio = ((HeightIn * 10)/HeightOut);
 
@@ -323,7 +340,8 @@ void XV_VScalerLoadExtCoeff(XV_Vscaler_l2 *InstancePtr,
 * core registers
 *
 * @param  InstancePtr is a pointer to the core instance to be worked on.
-* @param  VCoeff is the array that holds computed coefficients
+* @param  CoeffWords is an array of XV_VSCALER_PLAN_COEFF_WORDS words to store
+*         the register image into, NULL if not needed
 *
 * @return None
 *
@@ -334,7 +352,7 @@ void XV_VScalerLoadExtCoeff(XV_Vscaler_l2 *InstancePtr,
 *        maintain the sw latency for driver version which would eventually use
 *        computed coefficients
 ******************************************************************************/
-static void XV_VScalerSetCoeff(XV_Vscaler_l2 *VscPtr)
+static void XV_VScalerSetCoeff(XV_Vscaler_l2 *VscPtr, u32 *CoeffWords)
 {
   int num_phases = 1<<VscPtr->Vsc.Config.PhaseShift;
   int num_taps   = VscPtr->Vsc.Config.NumTaps/2;
@@ -350,8 +368,164 @@ static void XV_VScalerSetCoeff(XV_Vscaler_l2 *VscPtr)
        rdIndx = j*2+offset;
        val = (VscPtr->coeff[i][rdIndx+1] << 16) | (VscPtr->coeff[i][rdIndx] & XVSC_MASK_LOW_16BITS);
        Xil_Out32(baseAddr+((i*num_taps+j)*4), val);
+       if(CoeffWords != NULL)
+       {
+         CoeffWords[i*num_taps+j] = (u32)val;
+       }
+    }
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function programs the internal filter coefficients into core registers
+* from the plan cache of the instance. A plan is computed, as without plan
+* cache, the first time its configuration is used. After that its register
+* image is copied into the core registers.
+*
+* @param  VscPtr is a pointer to the core instance to be worked on.
+* @param  HeightIn is the input stream height
+* @param  HeightOut is the output stream height
+*
+* @return None
+*
+******************************************************************************/
+static void XV_VScalerSetPlan(XV_Vscaler_l2 *VscPtr,
+                              u32 HeightIn,
+                              u32 HeightOut)
+{
+  XV_VScalerPlanCache *CachePtr = VscPtr->PlanCache;
+  XV_vscaler_Config *CfgPtr = &VscPtr->Vsc.Config;
+  XV_VScalerPlan *PlanPtr;
+  XV_VScalerPlan *VictimPtr;
+  UINTPTR baseAddr;
+  u32 NumWords;
+  u32 i, j;
+
+  CachePtr->Clock++;
+  VictimPtr = &CachePtr->Plans[0];
+  for(i=0; i < CachePtr->NumPlans; i++)
+  {
+    PlanPtr = &CachePtr->Plans[i];
+    if(PlanPtr->IsValid &&
+       (PlanPtr->HeightIn == HeightIn) &&
+       (PlanPtr->HeightOut == HeightOut) &&
+       (PlanPtr->NumTaps == CfgPtr->NumTaps) &&
+       (PlanPtr->PhaseShift == CfgPtr->PhaseShift) &&
+       (PlanPtr->IsDesigned == VscPtr->DesignCoeff))
+    {
+      PlanPtr->LastUse = CachePtr->Clock;
+      CachePtr->Hits++;
+
+      NumWords = (1<<CfgPtr->PhaseShift) * (CfgPtr->NumTaps/2);
+      baseAddr = XV_vscaler_Get_HwReg_vfltCoeff_BaseAddress(&VscPtr->Vsc);
+      for(j=0; j < NumWords; j++)
+      {
+        Xil_Out32(baseAddr+(j*4), PlanPtr->CoeffWords[j]);
+      }
+      return;
+    }
+
+    /* Prefer a free plan, else the least recently used one */
+    if(VictimPtr->IsValid &&
+       (!PlanPtr->IsValid ||
+        ((CachePtr->Clock - PlanPtr->LastUse) >
+         (CachePtr->Clock - VictimPtr->LastUse))))
+    {
+      VictimPtr = PlanPtr;
     }
   }
+
+  if(VictimPtr->IsValid)
+  {
+    CachePtr->Evictions++;
+  }
+  CachePtr->Misses++;
+
+  XV_VScalerSelectCoeff(VscPtr, HeightIn, HeightOut);
+  XV_VScalerSetCoeff(VscPtr, VictimPtr->CoeffWords);
+
+  VictimPtr->HeightIn   = HeightIn;
+  VictimPtr->HeightOut  = HeightOut;
+  VictimPtr->NumTaps    = CfgPtr->NumTaps;
+  VictimPtr->PhaseShift = CfgPtr->PhaseShift;
+  VictimPtr->IsDesigned = VscPtr->DesignCoeff;
+  VictimPtr->IsValid    = TRUE;
+  VictimPtr->LastUse    = CachePtr->Clock;
+}
+
+/*****************************************************************************/
+/**
+* This function initializes a plan cache. The cache is empty and its
+* statistics are cleared.
+*
+* @param  CachePtr is a pointer to the plan cache to be initialized.
+* @param  PlansPtr is a pointer to an array of plans allocated by the user
+* @param  NumPlans is the number of plans in the array
+*
+* @return None
+*
+******************************************************************************/
+void XV_VScalerPlanCacheInit(XV_VScalerPlanCache *CachePtr,
+                             XV_VScalerPlan *PlansPtr,
+                             u32 NumPlans)
+{
+  u32 i;
+
+  Xil_AssertVoid(CachePtr != NULL);
+  Xil_AssertVoid(PlansPtr != NULL);
+  Xil_AssertVoid(NumPlans > 0);
+
+  CachePtr->Plans     = PlansPtr;
+  CachePtr->NumPlans  = NumPlans;
+  CachePtr->Clock     = 0;
+  CachePtr->Hits      = 0;
+  CachePtr->Misses    = 0;
+  CachePtr->Evictions = 0;
+  for(i=0; i < NumPlans; i++)
+  {
+    PlansPtr[i].IsValid = FALSE;
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function attaches a plan cache to the instance. The following calls to
+* XV_VScalerSetup() program the internal coefficients through the cache.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+* @param  CachePtr is a pointer to an initialized plan cache, NULL to compute
+*         every setup again
+*
+* @return None
+*
+******************************************************************************/
+void XV_VScalerSetPlanCache(XV_Vscaler_l2 *InstancePtr,
+                            XV_VScalerPlanCache *CachePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->PlanCache = CachePtr;
+}
+
+/*****************************************************************************/
+/**
+* This function selects how the following calls to XV_VScalerSetup() get the
+* internal filter coefficients. When enabled they are designed for the exact
+* scaling ratio and the number of taps of the IP, else they are taken from the
+* fixed tables.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+* @param  Enable is TRUE to design the coefficients, FALSE to use the tables
+*
+* @return None
+*
+******************************************************************************/
+void XV_VScalerSetCoeffDesign(XV_Vscaler_l2 *InstancePtr, u8 Enable)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->DesignCoeff = Enable;
 }
 
 /*****************************************************************************/
@@ -392,14 +566,22 @@ int XV_VScalerSetup(XV_Vscaler_l2  *InstancePtr,
 
   if(InstancePtr->Vsc.Config.ScalerType == XV_VSCALER_POLYPHASE)
   {
-    if(!InstancePtr->UseExtCoeff) //No user defined coefficients
+    if(!InstancePtr->UseExtCoeff && (InstancePtr->PlanCache != NULL))
     {
-      /* Determine coefficient table to use */
-      XV_VScalerSelectCoeff(InstancePtr,  HeightIn, HeightOut);
+      /* Program coefficients from the plan cache */
+      XV_VScalerSetPlan(InstancePtr, HeightIn, HeightOut);
     }
+    else
+    {
+      if(!InstancePtr->UseExtCoeff) //No user defined coefficients
+      {
+        /* Determine coefficient table to use */
+        XV_VScalerSelectCoeff(InstancePtr,  HeightIn, HeightOut);
+      }
 
-    /* Program coefficients into the IP register bank */
-    XV_VScalerSetCoeff(InstancePtr);
+      /* Program coefficients into the IP register bank */
+      XV_VScalerSetCoeff(InstancePtr, NULL);
+    }
   }
 
   LineRate = (HeightIn * STEP_PRECISION)/HeightOut;
@@ -500,5 +682,18 @@ void XV_VScalerDbgReportStatus(XV_Vscaler_l2 *InstancePtr)
       }
     }
   }
+
+  xil_printf("\r\n\r\nCoefficient Design:  %s\r\n",
+             InstancePtr->DesignCoeff?"Enabled":"Disabled");
+
+  if(InstancePtr->PlanCache != NULL)
+  {
+    xil_printf("\r\nPlan Cache Hits:      %d\r\n",
+               InstancePtr->PlanCache->Hits);
+    xil_printf("Plan Cache Misses:    %d\r\n",
+               InstancePtr->PlanCache->Misses);
+    xil_printf("Plan Cache Evictions: %d\r\n",
+               InstancePtr->PlanCache->Evictions);
+  }
 }
 /** @} */
@@ -45,6 +45,24 @@
 * Advanced users always have the capability to directly interact with the IP
 * core using Layer-1 API's that perform low level register peek/poke.
 *
+* <b> Plan Cache </b>
+*
+* XV_VScalerSetup() selects and packs the filter coefficients for every call.
+* When the same resolutions come back often, a plan cache can be attached to
+* the instance with XV_VScalerSetPlanCache(). A plan holds the coefficient
+* register image of one input/output height, which is written back without
+* being computed again. User defined coefficients are not cached. A cache can
+* be shared by the instances of the same IP configuration. The Hits, Misses
+* and Evictions counters of the cache give its hit rate.
+*
+* <b> Coefficient Design </b>
+*
+* By default the filter coefficients are taken from fixed tables, selected by
+* ranges of scaling ratio. XV_VScalerSetCoeffDesign() makes the driver design
+* the coefficients for the exact scaling ratio and the number of taps of the
+* IP at every setup instead, see XVidC_PolyphaseDesign(). User defined
+* coefficients loaded with XV_VScalerLoadExtCoeff() take precedence.
+*
 * <b> Interrupts </b>
 *
 * This driver does not have any interrupts
@@ -70,6 +88,8 @@
 * 2.00  rco   11/05/15   Integrate layer-1 with layer-2
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
 * 3.1   vsa   04/07/20   Improve quality with new coefficients
+* 3.3   kt    10/18/26   Added coefficient plan cache
+*       kt    10/18/26   Added runtime coefficient design
 *
 * </pre>
 *
@@ -92,6 +112,15 @@ extern "C" {
   */
  #define XV_VSCALER_MAX_V_TAPS           (12)
  #define XV_VSCALER_MAX_V_PHASES         (64)
+/*@}*/
+
+/** @name Plan Cache
+ * @{
+ * Size of the register image of a plan
+ */
+#define XV_VSCALER_PLAN_COEFF_WORDS     (XV_VSCALER_MAX_V_PHASES * \
+                                         XV_VSCALER_MAX_V_TAPS/2)
+/*@}*/
 
 /**************************** Type Definitions *******************************/
 /**
@@ -115,6 +144,35 @@ typedef enum
   XV_VSCALER_TAPS_12 = 12
 }XV_VSCALER_TAPS;
 
+/**
+ * This typedef contains a plan, the coefficient register image for one
+ * scaling configuration
+ */
+typedef struct
+{
+  u32 HeightIn;     /**< Input height */
+  u32 HeightOut;    /**< Output height */
+  u16 NumTaps;      /**< Number of taps of the IP */
+  u16 PhaseShift;   /**< Phase shift of the IP */
+  u8 IsDesigned;    /**< Coefficients are designed */
+  u8 IsValid;       /**< Plan holds a configuration */
+  u32 LastUse;      /**< Cache clock of the last use, for replacement */
+  u32 CoeffWords[XV_VSCALER_PLAN_COEFF_WORDS]; /**< Coefficient registers */
+}XV_VScalerPlan;
+
+/**
+ * This typedef contains a plan cache. The plans are provided by the user.
+ */
+typedef struct
+{
+  XV_VScalerPlan *Plans; /**< Array of plans */
+  u32 NumPlans;          /**< Number of plans in the array */
+  u32 Clock;             /**< Counts the lookups, for replacement */
+  u32 Hits;              /**< Number of setups served by a plan */
+  u32 Misses;            /**< Number of setups which computed a plan */
+  u32 Evictions;         /**< Number of plans replaced */
+}XV_VScalerPlanCache;
+
 /**
  * V Scaler Layer 2 data. The user is required to allocate a variable
  * of this type for every V Scaler device in the system. A pointer to a
@@ -124,7 +182,10 @@ typedef struct
 {
   XV_vscaler Vsc; /*<< Layer 1 instance */
   u8 UseExtCoeff;
+  u8 DesignCoeff; /*<< Design coefficients instead of using the tables */
   short coeff[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_MAX_V_TAPS];
+  short designed[XV_VSCALER_MAX_V_PHASES*XV_VSCALER_MAX_V_TAPS]; /*<< Designed coefficients */
+  XV_VScalerPlanCache *PlanCache; /*<< Plan cache, NULL if not used */
 }XV_Vscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -155,6 +216,12 @@ int XV_VScalerSetup(XV_Vscaler_l2  *InstancePtr,
                     u32 HeightOut,
                     u32 ColorFormat);
 void XV_VScalerDbgReportStatus(XV_Vscaler_l2 *InstancePtr);
+void XV_VScalerPlanCacheInit(XV_VScalerPlanCache *CachePtr,
+                             XV_VScalerPlan *PlansPtr,
+                             u32 NumPlans);
+void XV_VScalerSetPlanCache(XV_Vscaler_l2 *InstancePtr,
+                            XV_VScalerPlanCache *CachePtr);
+void XV_VScalerSetCoeffDesign(XV_Vscaler_l2 *InstancePtr, u8 Enable);
 
 #ifdef __cplusplus
 }
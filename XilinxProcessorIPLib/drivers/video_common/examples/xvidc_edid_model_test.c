@@ -0,0 +1,943 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xvidc_edid_model_test.c
+*
+* Host test of the EDID capability table, XVidC_EdidCapParse(), on the EDIDs
+* of the HDMI and DisplayPort example designs. It is not a target example: it
+* is built and run with the other driver model tests by
+* make -C scripts/host_model.
+*
+* For each EDID of the corpus the test checks the parsed sink properties, the
+* preferred video mode and the number of timings, video modes, YCbCr 4:2:0
+* video modes and VICs, which were decoded from the EDID bytes apart from the
+* driver. Every video mode of the timing table that
+* XVidC_EdidIsVideoTimingSupported() reports from the base EDID must be in the
+* table, apart from the other frame rates at the preferred resolution, which
+* the legacy check accepts.
+*
+* A CTA-861 extension block with a video data block, an HDMI vendor specific
+* data block and YCbCr 4:2:0 data blocks is checked the same way.
+*
+* Then each established timing is set alone in a base EDID. The legacy check
+* must match it, the interlaced 1024x768@87Hz on the 768 lines of the frame
+* only, and the capability table must hold it, the interlaced timing on the
+* 384 lines of a field.
+*
+* The time of a parse per EDID and of a query per video mode, with the legacy
+* check and with the table, are printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.15  kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xstatus.h"
+#include "xvidc.h"
+#include "xvidc_edid.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define PARSE_ROUNDS	1000U	/* Parses per EDID timed */
+#define QUERY_ROUNDS	100U	/* Queries of every video mode timed */
+#define FRAME_NS	16666667U	/* Frame period at 60 Hz */
+
+/**************************** Type Definitions *******************************/
+
+typedef struct {
+	const char *Name;
+	const u8 *Edid;
+	u32 Size;
+	u8 NumCtaBlocks;
+	u8 IsHdmi;
+	u16 MaxTmdsMhz;
+	u8 IsScdcPresent;
+	u8 MaxFrlRate;
+	u8 IsYCbCr444Supp;
+	u8 IsYCbCr422Supp;
+	u8 IsYCbCr420Supp;
+	u8 DeepColor;
+	u8 Y420DeepColor;
+	XVidC_VideoMode PreferredVm;
+	u8 NumTimings;
+	u8 NumVms;		/* Video modes of the timing table */
+	u8 NumY420Vms;
+	u8 NumVics;
+} Sink;
+
+typedef struct {
+	u8 Offset;
+	u8 Mask;
+	u16 HActive;
+	u16 VActive;		/* Lines of the frame */
+	u8 FrameRate;
+	u8 IsInterlaced;
+} EstTiming;
+
+/************************** Function Prototypes ******************************/
+
+static u32 Count(const u32 *Bits, u32 Num);
+static void CheckSink(const Sink *SinkPtr);
+static void SetChecksum(u8 *Block);
+static void BuildEdid(u8 *Edid, u8 Offset, u8 Mask);
+static void CheckCta(void);
+static void SetMode(XVidC_VideoTimingMode *VtMode, u16 HActive, u16 VActive,
+		u8 FrameRate, u8 IsInterlaced);
+static void CheckEstTiming(const EstTiming *EstPtr);
+static void TimeSink(const Sink *SinkPtr);
+
+/************************** Variable Definitions *****************************/
+
+extern const XVidC_VideoTimingMode XVidC_VideoTimingModes[XVIDC_VM_NUM_SUPPORTED];
+
+/* EDIDs of the example designs */
+
+/* v_hdmitxss1/examples/xhdmi_example/PassThrough/xhdmi_edid.h, SampleEdid */
+static const u8 Edid0[] = {
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0x98, 0x34, 0x12,
+	0x78, 0x56, 0x34, 0x12, 0x17, 0x1D, 0x01, 0x03, 0x80, 0xA0, 0x5A, 0x78,
+	0x0A, 0xEE, 0x91, 0xA3, 0x54, 0x4C, 0x99, 0x26, 0x0F, 0x50, 0x54, 0x21,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0xE8, 0x00, 0x30, 0xF2, 0x70,
+	0x5A, 0x80, 0xB0, 0x58, 0x8A, 0x00, 0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E,
+	0x02, 0x3A, 0x80, 0x18, 0x71, 0x38, 0x2D, 0x40, 0x58, 0x2C, 0x45, 0x00,
+	0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x18,
+	0x90, 0x0F, 0x8C, 0x77, 0x00, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0xFC, 0x00, 0x58, 0x49, 0x4C, 0x49, 0x4E, 0x58, 0x20,
+	0x48, 0x44, 0x4D, 0x49, 0x32, 0x31, 0x01, 0x18, 0x02, 0x03, 0x46, 0xF5,
+	0x58, 0xC4, 0xC3, 0xC2, 0xD4, 0xD7, 0xD6, 0xC1, 0x7F, 0x7E, 0x7D, 0xDB,
+	0xDA, 0x66, 0x65, 0x76, 0x75, 0x61, 0x60, 0x3F, 0x40, 0x10, 0x1F, 0xC7,
+	0xC6, 0x2C, 0x0F, 0x7F, 0x07, 0x5F, 0x7C, 0x01, 0x57, 0x06, 0x03, 0x67,
+	0x7E, 0x03, 0x6B, 0x03, 0x0C, 0x00, 0x10, 0x00, 0x78, 0x3C, 0x20, 0x00,
+	0x20, 0x03, 0x67, 0xD8, 0x5D, 0xC4, 0x01, 0x78, 0x80, 0x63, 0xE4, 0x0F,
+	0xFF, 0xFF, 0xC3, 0xE2, 0x00, 0xCF, 0x08, 0xE8, 0x00, 0x30, 0xF2, 0x70,
+	0x5A, 0x80, 0xB0, 0x58, 0x8A, 0x00, 0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E,
+	0x04, 0x74, 0x00, 0x30, 0xF2, 0x70, 0x5A, 0x80, 0xB0, 0x58, 0x8A, 0x00,
+	0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E, 0x02, 0x3A, 0x80, 0x18, 0x71, 0x38,
+	0x2D, 0x40, 0x58, 0x2C, 0x45, 0x00, 0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E,
+	0x00, 0x00, 0x00, 0xCB
+};
+
+/* v_hdmitxss1/examples/xhdmi_example/PassThrough/xhdmi_edid.h, SampleEdid_1 */
+static const u8 Edid1[] = {
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0x98, 0x34, 0x12,
+	0x78, 0x56, 0x34, 0x12, 0x17, 0x1D, 0x01, 0x03, 0x80, 0xA0, 0x5A, 0x78,
+	0x0A, 0xEE, 0x91, 0xA3, 0x54, 0x4C, 0x99, 0x26, 0x0F, 0x50, 0x54, 0x21,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0xE8, 0x00, 0x30, 0xF2, 0x70,
+	0x5A, 0x80, 0xB0, 0x58, 0x8A, 0x00, 0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E,
+	0x02, 0x3A, 0x80, 0x18, 0x71, 0x38, 0x2D, 0x40, 0x58, 0x2C, 0x45, 0x00,
+	0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x18,
+	0x90, 0x0F, 0x8C, 0x3C, 0x00, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0xFC, 0x00, 0x58, 0x49, 0x4C, 0x49, 0x4E, 0x58, 0x20,
+	0x48, 0x44, 0x4D, 0x49, 0x32, 0x31, 0x01, 0x53, 0x02, 0x03, 0x4B, 0xF4,
+	0x52, 0xC4, 0xC3, 0xC2, 0xDB, 0xDA, 0x66, 0x65, 0x76, 0x75, 0x61, 0x60,
+	0x3F, 0x40, 0x10, 0x1F, 0x21, 0xC7, 0xC6, 0x2C, 0x0F, 0x7F, 0x07, 0x5F,
+	0x7C, 0x01, 0x57, 0x06, 0x03, 0x67, 0x7E, 0x03, 0x6B, 0x03, 0x0C, 0x00,
+	0x10, 0x00, 0x38, 0x3C, 0x20, 0x00, 0x20, 0x03, 0x6A, 0xD8, 0x5D, 0xC4,
+	0x01, 0x78, 0x80, 0x63, 0x1E, 0x18, 0x78, 0xE4, 0x0F, 0xFF, 0xFF, 0x01,
+	0xE2, 0x00, 0xCF, 0xE3, 0x06, 0x0D, 0x01, 0xE3, 0x05, 0xE0, 0x00, 0x08,
+	0xE8, 0x00, 0x30, 0xF2, 0x70, 0x5A, 0x80, 0xB0, 0x58, 0x8A, 0x00, 0x20,
+	0xC2, 0x31, 0x00, 0x00, 0x1E, 0x02, 0x3A, 0x80, 0x18, 0x71, 0x38, 0x2D,
+	0x40, 0x58, 0x2C, 0x4A, 0x00, 0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x9C
+};
+
+/* v_hdmitxss1/examples/xhdmi_example/PassThrough/xhdmi_edid.h, SampleEdid_2 */
+static const u8 Edid2[] = {
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0x98, 0x34, 0x12,
+	0x78, 0x56, 0x34, 0x12, 0x0E, 0x1C, 0x01, 0x03, 0x80, 0xA0, 0x5A, 0x78,
+	0x0A, 0xEE, 0x91, 0xA3, 0x54, 0x4C, 0x99, 0x26, 0x0F, 0x50, 0x54, 0x21,
+	0x08, 0x00, 0x71, 0x4F, 0x81, 0xC0, 0x81, 0x00, 0x81, 0x80, 0x95, 0x00,
+	0xA9, 0xC0, 0xB3, 0x00, 0x01, 0x01, 0x08, 0xE8, 0x00, 0x30, 0xF2, 0x70,
+	0x5A, 0x80, 0xB0, 0x58, 0x8A, 0x00, 0x40, 0x84, 0x63, 0x00, 0x00, 0x1E,
+	0x02, 0x3A, 0x80, 0x18, 0x71, 0x38, 0x2D, 0x40, 0x58, 0x2C, 0x45, 0x00,
+	0x40, 0x84, 0x63, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x18,
+	0x4B, 0x0F, 0x8C, 0x3C, 0x00, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0xFC, 0x00, 0x58, 0x49, 0x4C, 0x49, 0x4E, 0x58, 0x20,
+	0x48, 0x44, 0x4D, 0x49, 0x0A, 0x20, 0x01, 0x85, 0x02, 0x03, 0x51, 0xF4,
+	0x57, 0x61, 0x10, 0x1F, 0x04, 0x13, 0x05, 0x14, 0x20, 0x21, 0x22, 0x5D,
+	0x5E, 0x5F, 0x60, 0x65, 0x66, 0x62, 0x63, 0x64, 0x07, 0x16, 0x03, 0x12,
+	0x23, 0x09, 0x07, 0x07, 0x6B, 0x03, 0x0C, 0x00, 0x10, 0x00, 0x78, 0x3C,
+	0x20, 0x00, 0x20, 0x03, 0x67, 0xD8, 0x5D, 0xC4, 0x01, 0x78, 0x80, 0x07,
+	0x6D, 0x1A, 0x00, 0x00, 0x02, 0x1B, 0x1E, 0x90, 0x00, 0x04, 0x64, 0x32,
+	0x14, 0x00, 0xE3, 0x0F, 0x01, 0xE0, 0xE2, 0x00, 0xCF, 0xE3, 0x06, 0x0D,
+	0x01, 0xE3, 0x05, 0xE0, 0x00, 0x02, 0x3A, 0x80, 0x18, 0x71, 0x38, 0x2D,
+	0x40, 0x58, 0x2C, 0x45, 0x00, 0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E, 0x08,
+	0xE8, 0x00, 0x30, 0xF2, 0x70, 0x5A, 0x80, 0xB0, 0x58, 0x8A, 0x00, 0x20,
+	0xC2, 0x31, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x3B
+};
+
+/* v_hdmitxss1/examples/xhdmi_example/PassThrough/xhdmi_edid.h, SampleEdid_3 */
+static const u8 Edid3[] = {
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0x98, 0x34, 0x12,
+	0x78, 0x56, 0x34, 0x12, 0x17, 0x1D, 0x01, 0x03, 0x80, 0xA0, 0x5A, 0x78,
+	0x0A, 0xEE, 0x91, 0xA3, 0x54, 0x4C, 0x99, 0x26, 0x0F, 0x50, 0x54, 0x21,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0xE8, 0x00, 0x30, 0xF2, 0x70,
+	0x5A, 0x80, 0xB0, 0x58, 0x8A, 0x00, 0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E,
+	0x02, 0x3A, 0x80, 0x18, 0x71, 0x38, 0x2D, 0x40, 0x58, 0x2C, 0x45, 0x00,
+	0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x18,
+	0x90, 0x0F, 0x8C, 0x3C, 0x00, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0xFC, 0x00, 0x58, 0x49, 0x4C, 0x49, 0x4E, 0x58, 0x20,
+	0x48, 0x44, 0x4D, 0x49, 0x32, 0x31, 0x01, 0x53, 0x02, 0x03, 0x4B, 0xF4,
+	0x52, 0xC4, 0xC3, 0xC2, 0xDB, 0xDA, 0x66, 0x65, 0x76, 0x75, 0x61, 0x60,
+	0x3F, 0x40, 0x10, 0x1F, 0x21, 0xC7, 0xC6, 0x2C, 0x0F, 0x7F, 0x07, 0x5F,
+	0x7C, 0x01, 0x57, 0x06, 0x03, 0x67, 0x7E, 0x03, 0x6B, 0x03, 0x0C, 0x00,
+	0x10, 0x00, 0x38, 0x3C, 0x20, 0x00, 0x20, 0x03, 0x6A, 0xD8, 0x5D, 0xC4,
+	0x01, 0x78, 0x80, 0x03, 0x1E, 0x18, 0x78, 0xE4, 0x0F, 0xFF, 0xFF, 0x01,
+	0xE2, 0x00, 0xCF, 0xE3, 0x06, 0x0D, 0x01, 0xE3, 0x05, 0xE0, 0x00, 0x08,
+	0xE8, 0x00, 0x30, 0xF2, 0x70, 0x5A, 0x80, 0xB0, 0x58, 0x8A, 0x00, 0x20,
+	0xC2, 0x31, 0x00, 0x00, 0x1E, 0x02, 0x3A, 0x80, 0x18, 0x71, 0x38, 0x2D,
+	0x40, 0x58, 0x2C, 0x4A, 0x00, 0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFC
+};
+
+/* v_hdmitxss1/examples/xhdmi_example/PassThrough/xhdmi_edid.h, SampleEdid_4 */
+static const u8 Edid4[] = {
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0x98, 0x34, 0x12,
+	0x78, 0x56, 0x34, 0x12, 0x17, 0x1D, 0x01, 0x03, 0x80, 0xA0, 0x5A, 0x78,
+	0x0A, 0xEE, 0x91, 0xA3, 0x54, 0x4C, 0x99, 0x26, 0x0F, 0x50, 0x54, 0x21,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0xE8, 0x00, 0x30, 0xF2, 0x70,
+	0x5A, 0x80, 0xB0, 0x58, 0x8A, 0x00, 0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E,
+	0x02, 0x3A, 0x80, 0x18, 0x71, 0x38, 0x2D, 0x40, 0x58, 0x2C, 0x45, 0x00,
+	0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x18,
+	0x90, 0x0F, 0x8C, 0xF0, 0x00, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0xFC, 0x00, 0x58, 0x49, 0x4C, 0x49, 0x4E, 0x58, 0x20,
+	0x48, 0x44, 0x4D, 0x49, 0x32, 0x31, 0x01, 0x9F, 0x02, 0x03, 0x43, 0xF5,
+	0x52, 0xCF, 0xCE, 0xCC, 0xCB, 0xCA, 0x78, 0xC9, 0xD0, 0x7E, 0x7D, 0xDB,
+	0xDA, 0x66, 0x65, 0x76, 0x75, 0x61, 0x60, 0x2C, 0x0F, 0x7F, 0x07, 0x5F,
+	0x7C, 0x01, 0x57, 0x06, 0x03, 0x67, 0x7E, 0x03, 0x6B, 0x03, 0x0C, 0x00,
+	0x10, 0x00, 0x38, 0x3C, 0x20, 0x00, 0x20, 0x03, 0x6D, 0xD8, 0x5D, 0xC4,
+	0x01, 0x78, 0x80, 0x63, 0x00, 0x00, 0x00, 0xCB, 0x67, 0x3F, 0xE4, 0x0F,
+	0x09, 0xCC, 0x00, 0x09, 0xCC, 0x00, 0xE2, 0x00, 0xCF, 0x08, 0xE8, 0x00,
+	0x30, 0xF2, 0x70, 0x5A, 0x80, 0xB0, 0x58, 0x8A, 0x00, 0x20, 0xC2, 0x31,
+	0x00, 0x00, 0x1E, 0x04, 0x74, 0x00, 0x30, 0xF2, 0x70, 0x5A, 0x80, 0xB0,
+	0x58, 0x8A, 0x00, 0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E, 0x02, 0x3A, 0x80,
+	0x18, 0x71, 0x38, 0x2D, 0x40, 0x58, 0x2C, 0x45, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1B
+};
+
+/* v_hdmirxss/examples/xhdmi_example/RxOnly/xhdmi_edid.h, Edid */
+static const u8 Edid5[] = {
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0x98, 0x34, 0x12,
+	0x78, 0x56, 0x34, 0x12, 0x0E, 0x1C, 0x01, 0x03, 0x80, 0xA0, 0x5A, 0x78,
+	0x0A, 0xEE, 0x91, 0xA3, 0x54, 0x4C, 0x99, 0x26, 0x0F, 0x50, 0x54, 0x21,
+	0x08, 0x00, 0x71, 0x4F, 0x81, 0xC0, 0x81, 0x00, 0x81, 0x80, 0x95, 0x00,
+	0xA9, 0xC0, 0xB3, 0x00, 0x01, 0x01, 0x08, 0xE8, 0x00, 0x30, 0xF2, 0x70,
+	0x5A, 0x80, 0xB0, 0x58, 0x8A, 0x00, 0x40, 0x84, 0x63, 0x00, 0x00, 0x1E,
+	0x02, 0x3A, 0x80, 0x18, 0x71, 0x38, 0x2D, 0x40, 0x58, 0x2C, 0x45, 0x00,
+	0x40, 0x84, 0x63, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x18,
+	0x4B, 0x0F, 0x8C, 0x3C, 0x00, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0xFC, 0x00, 0x58, 0x49, 0x4C, 0x49, 0x4E, 0x58, 0x20,
+	0x48, 0x44, 0x4D, 0x49, 0x0A, 0x20, 0x01, 0x85, 0x02, 0x03, 0x3B, 0xF1,
+	0x57, 0x61, 0x10, 0x1F, 0x04, 0x13, 0x05, 0x14, 0x20, 0x21, 0x22, 0x5D,
+	0x5E, 0x5F, 0x60, 0x65, 0x66, 0x62, 0x63, 0x64, 0x07, 0x16, 0x03, 0x12,
+	0x23, 0x09, 0x07, 0x07, 0x6B, 0x03, 0x0C, 0x00, 0x10, 0x00, 0x78, 0x3C,
+	0x20, 0x00, 0x20, 0x03, 0x67, 0xD8, 0x5D, 0xC4, 0x01, 0x78, 0x80, 0x07,
+	0xE3, 0x0F, 0x01, 0xE0, 0xE2, 0x00, 0xCF, 0x02, 0x3A, 0x80, 0x18, 0x71,
+	0x38, 0x2D, 0x40, 0x58, 0x2C, 0x45, 0x00, 0x20, 0xC2, 0x31, 0x00, 0x00,
+	0x1E, 0x08, 0xE8, 0x00, 0x30, 0xF2, 0x70, 0x5A, 0x80, 0xB0, 0x58, 0x8A,
+	0x00, 0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E, 0x04, 0x74, 0x00, 0x30, 0xF2,
+	0x70, 0x5A, 0x80, 0xB0, 0x58, 0x8A, 0x00, 0x20, 0x52, 0x31, 0x00, 0x00,
+	0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xDC
+};
+
+/* dp12rxss/examples/src/kc/xdprxss_kc705.c, edid */
+static const u8 Edid6[] = {
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0x2C, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0E, 0x19, 0x01, 0x04, 0xB5, 0x3C, 0x22, 0x78,
+	0x3A, 0x4D, 0xD5, 0xA7, 0x55, 0x4A, 0x9D, 0x24, 0x0E, 0x50, 0x54, 0xBF,
+	0xEF, 0x00, 0xD1, 0xC0, 0x81, 0x40, 0x81, 0x80, 0x95, 0x00, 0xB3, 0x00,
+	0x71, 0x4F, 0x81, 0xC0, 0x01, 0x01, 0x4D, 0xD0, 0x00, 0xA0, 0xF0, 0x70,
+	0x3E, 0x80, 0x30, 0x20, 0x35, 0x00, 0x54, 0x4F, 0x21, 0x00, 0x00, 0x1A,
+	0x04, 0x74, 0x00, 0x30, 0xF2, 0x70, 0x5A, 0x80, 0xB0, 0x58, 0x8A, 0x00,
+	0x54, 0x4F, 0x21, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x1D,
+	0x50, 0x18, 0xA0, 0x3C, 0x04, 0x11, 0x00, 0xF0, 0xF8, 0x38, 0xF0, 0x3C,
+	0x00, 0x00, 0x00, 0xFC, 0x00, 0x58, 0x49, 0x4C, 0x49, 0x4E, 0x58, 0x20,
+	0x44, 0x50, 0x0A, 0x20, 0x20, 0x20, 0x01, 0x19, 0x02, 0x03, 0x27, 0x71,
+	0x4F, 0x01, 0x02, 0x03, 0x11, 0x12, 0x13, 0x04, 0x14, 0x05, 0x1F, 0x90,
+	0x0E, 0x0F, 0x1D, 0x1E, 0x23, 0x09, 0x17, 0x07, 0x83, 0x01, 0x00, 0x00,
+	0x6A, 0x03, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x78, 0x20, 0x00, 0x00, 0x56,
+	0x5E, 0x00, 0xA0, 0xA0, 0xA0, 0x29, 0x50, 0x30, 0x20, 0x35, 0x00, 0x54,
+	0x4F, 0x21, 0x00, 0x00, 0x1E, 0xE2, 0x68, 0x00, 0xA0, 0xA0, 0x40, 0x2E,
+	0x60, 0x30, 0x20, 0x36, 0x00, 0x54, 0x4F, 0x21, 0x00, 0x00, 0x1A, 0x01,
+	0x1D, 0x00, 0xBC, 0x52, 0xD0, 0x1E, 0x20, 0xB8, 0x28, 0x55, 0x40, 0x54,
+	0x4F, 0x21, 0x00, 0x00, 0x1E, 0x8C, 0x0A, 0xD0, 0x90, 0x20, 0x40, 0x31,
+	0x20, 0x0C, 0x40, 0x55, 0x00, 0x54, 0x4F, 0x21, 0x00, 0x00, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xF0
+};
+
+/* dp14txss/examples/src/zcu_pt_dp14_hdcp/edid.c, edid #1 */
+static const u8 Edid7[] = {
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0x98, 0x23, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x1C, 0x01, 0x04, 0xB5, 0x3C, 0x22, 0x78,
+	0x26, 0x61, 0x50, 0xA6, 0x56, 0x50, 0xA0, 0x00, 0x0D, 0x50, 0x54, 0xA5,
+	0x6B, 0x80, 0xD1, 0xC0, 0x81, 0xC0, 0x81, 0x00, 0x81, 0x80, 0xA9, 0x00,
+	0xB3, 0x00, 0xD1, 0xFC, 0x01, 0x01, 0x04, 0x74, 0x00, 0x30, 0xF2, 0x70,
+	0x5A, 0x80, 0xB0, 0x58, 0x8A, 0x00, 0x54, 0x4F, 0x21, 0x00, 0x00, 0x1A,
+	0x4D, 0xD0, 0x00, 0xA0, 0xF0, 0x70, 0x3E, 0x80, 0x30, 0x20, 0x35, 0x00,
+	0x56, 0x50, 0x21, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x1E,
+	0x3C, 0x32, 0xB4, 0x66, 0x01, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0xFC, 0x00, 0x58, 0x69, 0x6C, 0x69, 0x6E, 0x78, 0x20,
+	0x73, 0x69, 0x6E, 0x6B, 0x0A, 0x20, 0x01, 0x17, 0x70, 0x12, 0x6E, 0x00,
+	0x00, 0x81, 0x00, 0x04, 0x23, 0x09, 0x03, 0x07, 0x03, 0x00, 0x64, 0xEB,
+	0xA0, 0x01, 0x04, 0xFF, 0x0E, 0xA0, 0x00, 0x2F, 0x80, 0x21, 0x00, 0x6F,
+	0x08, 0x3E, 0x00, 0x03, 0x00, 0x05, 0x00, 0xFD, 0x68, 0x01, 0x04, 0xFF,
+	0x13, 0x4F, 0x00, 0x27, 0x80, 0x1F, 0x00, 0x3F, 0x0B, 0x51, 0x00, 0x43,
+	0x00, 0x07, 0x00, 0x65, 0x8E, 0x01, 0x04, 0xFF, 0x1D, 0x4F, 0x00, 0x07,
+	0x80, 0x1F, 0x00, 0xDF, 0x10, 0x3C, 0x00, 0x2E, 0x00, 0x07, 0x00, 0x86,
+	0x3D, 0x01, 0x04, 0xFF, 0x1D, 0x4F, 0x00, 0x07, 0x80, 0x1F, 0x00, 0xDF,
+	0x10, 0x30, 0x00, 0x22, 0x00, 0x07, 0x00, 0x5C, 0x7F, 0x01, 0x00, 0xFF,
+	0x0E, 0x4F, 0x00, 0x07, 0x80, 0x1F, 0x00, 0x6F, 0x08, 0x73, 0x00, 0x65,
+	0x00, 0x07, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x90
+};
+
+/* dp14txss/examples/src/zcu_pt_dp14_hdcp/edid.c, edid #2 */
+static const u8 Edid8[] = {
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0x98, 0x01, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x01, 0x04, 0xB5, 0x46, 0x27, 0x78,
+	0x3A, 0x73, 0x95, 0xAD, 0x51, 0x34, 0xB9, 0x26, 0x0D, 0x50, 0x54, 0xA5,
+	0x4B, 0x00, 0x81, 0x00, 0xB3, 0x00, 0xD1, 0x00, 0xA9, 0x40, 0x81, 0x80,
+	0xD1, 0xC0, 0x01, 0x01, 0x01, 0x01, 0x4D, 0xD0, 0x00, 0xA0, 0xF0, 0x70,
+	0x3E, 0x80, 0x30, 0x20, 0x35, 0x00, 0xB9, 0x88, 0x21, 0x00, 0x00, 0x1A,
+	0x00, 0x00, 0x00, 0xFF, 0x00, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x58,
+	0x69, 0x6C, 0x69, 0x6E, 0x78, 0x20, 0x38, 0x4B, 0x36, 0x30, 0x0A, 0x20,
+	0x00, 0x00, 0x00, 0xFD, 0x00, 0x18, 0x4B, 0x1E, 0xB4, 0x6C, 0x01, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x02, 0x4D, 0x02, 0x03, 0x1D, 0xF1,
+	0x50, 0x10, 0x1F, 0x20, 0x05, 0x14, 0x04, 0x13, 0x12, 0x11, 0x03, 0x02,
+	0x16, 0x15, 0x07, 0x06, 0x01, 0x23, 0x09, 0x1F, 0x07, 0x83, 0x01, 0x00,
+	0x00, 0xA3, 0x66, 0x00, 0xA0, 0xF0, 0x70, 0x1F, 0x80, 0x30, 0x20, 0x35,
+	0x00, 0xB9, 0x88, 0x21, 0x00, 0x00, 0x1A, 0x56, 0x5E, 0x00, 0xA0, 0xA0,
+	0xA0, 0x29, 0x50, 0x30, 0x20, 0x35, 0x00, 0xB9, 0x88, 0x21, 0x00, 0x00,
+	0x1A, 0x7C, 0x39, 0x00, 0xA0, 0x80, 0x38, 0x1F, 0x40, 0x30, 0x20, 0x3A,
+	0x00, 0xB9, 0x88, 0x21, 0x00, 0x00, 0x1A, 0xA8, 0x16, 0x00, 0xA0, 0x80,
+	0x38, 0x13, 0x40, 0x30, 0x20, 0x3A, 0x00, 0xB9, 0x88, 0x21, 0x00, 0x00,
+	0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x4F, 0x70, 0x12, 0x79, 0x00, 0x00, 0x12, 0x00, 0x16,
+	0x82, 0x10, 0x00, 0x00, 0xFF, 0x0E, 0xDF, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x30, 0x30, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x3C, 0x70, 0x92, 0x01, 0x84, 0xFF, 0x1D, 0x9F, 0x00, 0x2F, 0x80, 0x1F,
+	0x00, 0xDF, 0x10, 0x3C, 0x00, 0x02, 0x00, 0x04, 0x00, 0x80, 0xA0, 0x01,
+	0x04, 0xFF, 0x0E, 0x9F, 0x00, 0x2F, 0x80, 0x1F, 0x00, 0xDF, 0x10, 0x7A,
+	0x00, 0x02, 0x00, 0x09, 0x00, 0x58, 0x4B, 0x01, 0x04, 0xFF, 0x0E, 0x9F,
+	0x00, 0x2F, 0x80, 0x1F, 0x00, 0xDF, 0x10, 0x61, 0x00, 0x02, 0x00, 0x09,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x90
+};
+
+/* dp14txss/examples/src/zcu_pt_dp14_hdcp/edid.c, edid #3 */
+static const u8 Edid9[] = {
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0x98, 0x23, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x1C, 0x01, 0x04, 0xA5, 0x3C, 0x22, 0x78,
+	0x3E, 0x61, 0x50, 0xA6, 0x56, 0x50, 0xA0, 0x00, 0x0D, 0x50, 0x54, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFC, 0x00, 0x38, 0x6B, 0x33, 0x30, 0x2D, 0x6F, 0x6E,
+	0x6C, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x01, 0xFD, 0x70, 0x12, 0x1E, 0x00,
+	0x00, 0x81, 0x00, 0x04, 0x23, 0x08, 0x1F, 0x03, 0x03, 0x00, 0x14, 0x65,
+	0x8E, 0x01, 0x84, 0xFF, 0x1D, 0x4F, 0x00, 0x07, 0x80, 0x1F, 0x00, 0xDF,
+	0x10, 0x3C, 0x00, 0x2E, 0x00, 0x07, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x90
+};
+
+/* dp14txss/examples/src/zcu_pt_dp14_hdcp/edid.c, edid #4 */
+static const u8 Edid10[] = {
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0x98, 0x23, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x1C, 0x01, 0x04, 0xB5, 0x3C, 0x22, 0x78,
+	0x26, 0x61, 0x50, 0xA6, 0x56, 0x50, 0xA0, 0x00, 0x0D, 0x50, 0x54, 0xA5,
+	0x6B, 0x80, 0xD1, 0xC0, 0x81, 0xC0, 0x81, 0x00, 0x81, 0x80, 0xA9, 0x00,
+	0xB3, 0x00, 0xD1, 0xFC, 0x01, 0x01, 0x56, 0x5E, 0x00, 0xA0, 0xA0, 0xA0,
+	0x29, 0x50, 0x30, 0x00, 0x35, 0x00, 0x56, 0x50, 0x21, 0x00, 0x00, 0x1A,
+	0x4D, 0xD0, 0x00, 0xA0, 0xF0, 0x70, 0x3E, 0x80, 0x30, 0x20, 0x35, 0x00,
+	0x56, 0x50, 0x21, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x1E,
+	0x3C, 0x32, 0xB4, 0x66, 0x01, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0xFC, 0x00, 0x58, 0x69, 0x6C, 0x69, 0x6E, 0x78, 0x20,
+	0x73, 0x69, 0x6E, 0x6B, 0x0A, 0x20, 0x01, 0x18, 0x70, 0x12, 0x1E, 0x00,
+	0x00, 0x81, 0x00, 0x04, 0x23, 0x09, 0x03, 0x07, 0x03, 0x00, 0x14, 0xEB,
+	0xA0, 0x01, 0x04, 0xFF, 0x0E, 0xA0, 0x00, 0x2F, 0x80, 0x21, 0x00, 0x6F,
+	0x08, 0x3E, 0x00, 0x03, 0x00, 0x05, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x90
+};
+
+/* dp14txss/examples/src/zcu_pt_dp14_hdcp/edid.c, edid #5 */
+static const u8 Edid11[] = {
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 0xAC, 0x19, 0x41,
+	0x4C, 0x33, 0x32, 0x30, 0x0C, 0x1B, 0x01, 0x04, 0xB5, 0x3C, 0x22, 0x78,
+	0x3A, 0x27, 0x15, 0xAC, 0x51, 0x35, 0xB5, 0x26, 0x0E, 0x50, 0x54, 0xA5,
+	0x4B, 0x00, 0xD1, 0x00, 0xD1, 0xC0, 0xB3, 0x00, 0xA9, 0x40, 0x81, 0x80,
+	0x81, 0x00, 0x71, 0x4F, 0xE1, 0xC0, 0x4D, 0xD0, 0x00, 0xA0, 0xF0, 0x70,
+	0x3E, 0x80, 0x30, 0x20, 0x35, 0x00, 0x55, 0x50, 0x21, 0x00, 0x00, 0x1A,
+	0x00, 0x00, 0x00, 0xFF, 0x00, 0x37, 0x33, 0x4B, 0x30, 0x32, 0x37, 0x33,
+	0x4C, 0x30, 0x32, 0x33, 0x4C, 0x0A, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x44,
+	0x45, 0x4C, 0x4C, 0x20, 0x55, 0x50, 0x32, 0x37, 0x31, 0x38, 0x51, 0x0A,
+	0x00, 0x00, 0x00, 0xFD, 0x00, 0x1D, 0x56, 0x1E, 0x8C, 0x36, 0x01, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0x30, 0x02, 0x03, 0x24, 0xF1,
+	0x4C, 0x10, 0x1F, 0x20, 0x05, 0x14, 0x04, 0x13, 0x12, 0x11, 0x03, 0x02,
+	0x01, 0x23, 0x09, 0x1F, 0x07, 0x83, 0x01, 0x00, 0x00, 0xE3, 0x05, 0xFF,
+	0x01, 0xE6, 0x06, 0x07, 0x01, 0x8B, 0x60, 0x11, 0xA3, 0x66, 0x00, 0xA0,
+	0xF0, 0x70, 0x1F, 0x80, 0x30, 0x20, 0x35, 0x00, 0x55, 0x50, 0x21, 0x00,
+	0x00, 0x1A, 0x56, 0x5E, 0x00, 0xA0, 0xA0, 0xA0, 0x29, 0x50, 0x30, 0x20,
+	0x35, 0x00, 0x55, 0x50, 0x21, 0x00, 0x00, 0x1A, 0x11, 0x44, 0x00, 0xA0,
+	0x80, 0x00, 0x1F, 0x50, 0x30, 0x20, 0x36, 0x00, 0x55, 0x50, 0x21, 0x00,
+	0x00, 0x1A, 0xBF, 0x16, 0x00, 0xA0, 0x80, 0x38, 0x13, 0x40, 0x30, 0x20,
+	0x3A, 0x00, 0x55, 0x50, 0x21, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x91
+};
+
+/* dp14txss/examples/src/zcu_pt_dp14_hdcp/rx.c, edid */
+static const u8 Edid12[] = {
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0x2C, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x01, 0x04, 0xB5, 0x3C, 0x22, 0x78,
+	0x00, 0x1D, 0xF5, 0xAE, 0x4F, 0x35, 0xB3, 0x25, 0x0D, 0x50, 0x54, 0x21,
+	0x08, 0x00, 0x81, 0x00, 0xB3, 0x00, 0xD1, 0x00, 0xD1, 0xC0, 0xA9, 0x40,
+	0x81, 0x80, 0x01, 0x01, 0x01, 0x01, 0xBE, 0x6E, 0x00, 0x68, 0xF1, 0x70,
+	0x5A, 0x80, 0x64, 0x58, 0x8A, 0x00, 0xBA, 0x89, 0x21, 0x00, 0x00, 0x1A,
+	0x00, 0x00, 0x00, 0xFF, 0x00, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x58,
+	0x49, 0x4C, 0x20, 0x44, 0x50, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0xFD, 0x00, 0x31, 0x56, 0x1D, 0x71, 0x1E, 0x00, 0x0A,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0xDA, 0x02, 0x03, 0x0E, 0xC1,
+	0x41, 0x90, 0x23, 0x09, 0x1F, 0x07, 0x83, 0x01, 0x00, 0x00, 0x02, 0x3A,
+	0x80, 0x18, 0x71, 0x38, 0x2D, 0x40, 0x58, 0x2C, 0x45, 0x00, 0x55, 0x50,
+	0x21, 0x00, 0x00, 0x1E, 0x01, 0x1D, 0x80, 0x18, 0x71, 0x1C, 0x16, 0x20,
+	0x58, 0x2C, 0x25, 0x00, 0x55, 0x50, 0x21, 0x00, 0x00, 0x9E, 0x01, 0x1D,
+	0x00, 0x72, 0x51, 0xD0, 0x1E, 0x20, 0x6E, 0x28, 0x55, 0x00, 0x55, 0x50,
+	0x21, 0x00, 0x00, 0x1E, 0x8C, 0x0A, 0xD0, 0x8A, 0x20, 0xE0, 0x2D, 0x10,
+	0x10, 0x3E, 0x96, 0x00, 0x55, 0x50, 0x21, 0x00, 0x00, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xBB
+};
+
+/* dp21rxss/examples/src/dp21_rx_only/xdprxss_dp21_rx.c, edid */
+static const u8 Edid13[] = {
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x05, 0xA4, 0x23, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0x01, 0x04, 0xE5, 0x3D, 0x23, 0x78,
+	0x3A, 0x5F, 0xB1, 0xA2, 0x57, 0x4F, 0xA2, 0x28, 0x0F, 0x50, 0x54, 0xBF,
+	0xEF, 0x80, 0x71, 0x4F, 0x81, 0x00, 0x81, 0xC0, 0x81, 0x80, 0xA9, 0xC0,
+	0xB3, 0x00, 0x95, 0x00, 0xD1, 0xC0, 0x4D, 0xD0, 0x00, 0xA0, 0xF0, 0x70,
+	0x3E, 0x80, 0x30, 0x20, 0x35, 0x00, 0x5F, 0x59, 0x21, 0x00, 0x00, 0x1A,
+	0x56, 0x5E, 0x00, 0xA0, 0xA0, 0xA0, 0x29, 0x50, 0x30, 0x20, 0x35, 0x00,
+	0x5F, 0x59, 0x21, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x38,
+	0x4B, 0x1E, 0x86, 0x36, 0x00, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0xFC, 0x00, 0x41, 0x4D, 0x44, 0x20, 0x53, 0x69, 0x6E,
+	0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x02, 0x21, 0x02, 0x03, 0x12, 0x71,
+	0x83, 0x4F, 0x00, 0x00, 0x29, 0x0F, 0x7F, 0x07, 0x15, 0x06, 0x55, 0x3D,
+	0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x5C, 0x70, 0x20, 0x79, 0x02, 0x00, 0x22, 0x02, 0x3C,
+	0xB2, 0x90, 0x1F, 0x88, 0xFF, 0x1D, 0x4F, 0x00, 0x07, 0x80, 0x1F, 0x00,
+	0xDF, 0x10, 0x7A, 0x00, 0x6C, 0x00, 0x07, 0x00, 0x80, 0xFA, 0x29, 0x08,
+	0xFF, 0x27, 0x4F, 0x00, 0x07, 0x80, 0x1F, 0x00, 0xDF, 0x10, 0x7A, 0x00,
+	0x6C, 0x00, 0x07, 0x00, 0x35, 0x9C, 0x7D, 0x08, 0xFF, 0x3B, 0x4F, 0x00,
+	0x07, 0x80, 0x1F, 0x00, 0xBF, 0x21, 0xF5, 0x00, 0xE7, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x90
+};
+
+static const Sink Sinks[] = {
+	{ "v_hdmitxss1 SampleEdid", Edid0, sizeof(Edid0),
+	  1, 1, 600, 1, 6, 1, 1, 1, 0xF, 0x3,
+	  XVIDC_VM_3840x2160_60_P, 27, 29, 22, 24 },
+	{ "v_hdmitxss1 SampleEdid_1", Edid1, sizeof(Edid1),
+	  1, 1, 600, 1, 6, 1, 1, 1, 0xB, 0x3,
+	  XVIDC_VM_3840x2160_60_P, 20, 22, 19, 18 },
+	{ "v_hdmitxss1 SampleEdid_2", Edid2, sizeof(Edid2),
+	  1, 1, 600, 1, 0, 1, 1, 1, 0xF, 0x7,
+	  XVIDC_VM_3840x2160_60_P, 32, 37, 6, 23 },
+	{ "v_hdmitxss1 SampleEdid_3", Edid3, sizeof(Edid3),
+	  1, 1, 600, 1, 0, 1, 1, 1, 0xB, 0x3,
+	  XVIDC_VM_3840x2160_60_P, 20, 22, 19, 18 },
+	{ "v_hdmitxss1 SampleEdid_4", Edid4, sizeof(Edid4),
+	  1, 1, 600, 1, 6, 1, 1, 1, 0xB, 0x3,
+	  XVIDC_VM_3840x2160_60_P, 23, 22, 6, 18 },
+	{ "v_hdmirxss Edid", Edid5, sizeof(Edid5),
+	  1, 1, 600, 1, 0, 1, 1, 1, 0xF, 0x7,
+	  XVIDC_VM_3840x2160_60_P, 32, 37, 6, 23 },
+	{ "dp12rxss xdprxss_kc705.c", Edid6, sizeof(Edid6),
+	  1, 1, 600, 0, 0, 1, 1, 0, 0x0, 0x0,
+	  XVIDC_VM_3840x2160_60_P, 33, 34, 0, 15 },
+	{ "dp14txss edid.c #1", Edid7, sizeof(Edid7),
+	  0, 0, 0, 0, 0, 0, 0, 0, 0x0, 0x0,
+	  XVIDC_VM_3840x2160_30_P, 19, 18, 0, 0 },
+	{ "dp14txss edid.c #2", Edid8, sizeof(Edid8),
+	  1, 0, 0, 0, 0, 1, 1, 0, 0x0, 0x0,
+	  XVIDC_VM_3840x2160_60_P, 29, 32, 0, 16 },
+	{ "dp14txss edid.c #3", Edid9, sizeof(Edid9),
+	  0, 0, 0, 0, 0, 0, 0, 0, 0x0, 0x0,
+	  XVIDC_VM_NOT_SUPPORTED, 0, 0, 0, 0 },
+	{ "dp14txss edid.c #4", Edid10, sizeof(Edid10),
+	  0, 0, 0, 0, 0, 0, 0, 0, 0x0, 0x0,
+	  XVIDC_VM_NOT_SUPPORTED, 19, 17, 0, 0 },
+	{ "dp14txss edid.c #5", Edid11, sizeof(Edid11),
+	  1, 0, 0, 0, 0, 1, 1, 0, 0x0, 0x0,
+	  XVIDC_VM_3840x2160_60_P, 29, 30, 0, 12 },
+	{ "dp14txss rx.c", Edid12, sizeof(Edid12),
+	  1, 0, 0, 0, 0, 0, 0, 0, 0x0, 0x0,
+	  XVIDC_VM_3840x2160_30_P, 13, 16, 0, 1 },
+	{ "dp21rxss xdprxss_dp21_rx.c", Edid13, sizeof(Edid13),
+	  1, 0, 0, 0, 0, 1, 1, 0, 0x0, 0x0,
+	  XVIDC_VM_3840x2160_60_P, 25, 23, 0, 0 },
+};
+
+/* Established timings I and II and the manufacturer's timing, VESA E-EDID
+ * 1.4 table 3.18 */
+static const EstTiming EstTimings[] = {
+	{ 0x23, 0x80,  720,  400, 70, 0 },
+	{ 0x23, 0x40,  720,  400, 88, 0 },
+	{ 0x23, 0x20,  640,  480, 60, 0 },
+	{ 0x23, 0x10,  640,  480, 67, 0 },
+	{ 0x23, 0x08,  640,  480, 72, 0 },
+	{ 0x23, 0x04,  640,  480, 75, 0 },
+	{ 0x23, 0x02,  800,  600, 56, 0 },
+	{ 0x23, 0x01,  800,  600, 60, 0 },
+	{ 0x24, 0x80,  800,  600, 72, 0 },
+	{ 0x24, 0x40,  800,  600, 75, 0 },
+	{ 0x24, 0x20,  832,  624, 75, 0 },
+	{ 0x24, 0x10, 1024,  768, 87, 1 },
+	{ 0x24, 0x08, 1024,  768, 60, 0 },
+	{ 0x24, 0x04, 1024,  768, 70, 0 },
+	{ 0x24, 0x02, 1024,  768, 75, 0 },
+	{ 0x24, 0x01, 1280, 1024, 75, 0 },
+	{ 0x25, 0x80, 1152,  870, 75, 0 },
+};
+
+/* CTA-861 data blocks: VICs 16, 5 and 4, an HDMI VSDB with 30 and 36 bit
+ * and YCbCr 4:4:4 deep color up to 340 MHz, VIC 97 in YCbCr 4:2:0 only and
+ * the third SVD, VIC 4, also in YCbCr 4:2:0. VIC 97 is both 3840x2160@60Hz
+ * video modes of the timing table. */
+static const u8 CtaDataBlocks[] = {
+	0x43, 0x90, 0x05, 0x04,
+	0x67, 0x03, 0x0C, 0x00, 0x10, 0x00, 0x38, 0x44,
+	0xE2, 0x0E, 0x61,
+	0xE2, 0x0F, 0x04
+};
+
+/* 1920x1080@60Hz detailed timing, the preferred timing of the built EDIDs */
+static const u8 Dtd1080p60[18] = {
+	0x02, 0x3A, 0x80, 0x18, 0x71, 0x38, 0x2D, 0x40, 0x58, 0x2C, 0x45, 0x00,
+	0x20, 0xC2, 0x31, 0x00, 0x00, 0x1E
+};
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* Returns the number of bits set of the first Num bits of a bitmap.
+*
+******************************************************************************/
+static u32 Count(const u32 *Bits, u32 Num)
+{
+	u32 Total = 0;
+	u32 Index;
+
+	for (Index = 0; Index < Num; Index++) {
+		Total += (Bits[Index / 32] >> (Index % 32)) & 0x1;
+	}
+
+	return Total;
+}
+
+/*****************************************************************************/
+/**
+* Parses an EDID of the corpus and checks the capability table against the
+* decoded values and against the legacy check of the base EDID.
+*
+******************************************************************************/
+static void CheckSink(const Sink *SinkPtr)
+{
+	XVidC_EdidCap Cap;
+	XVidC_EdidCap BaseCap;
+	const XVidC_VideoTimingMode *VtMode;
+	const u8 *Ptm;
+	u32 PtmH;
+	u32 PtmV;
+	u32 Index;
+
+	XHOST_CHECK(XVidC_EdidCapParse(&Cap, SinkPtr->Edid, SinkPtr->Size) ==
+		    XST_SUCCESS, "%s: not parsed", SinkPtr->Name);
+	XHOST_CHECK((Cap.NumCtaBlocks == SinkPtr->NumCtaBlocks) &&
+		    (Cap.IsHdmi == SinkPtr->IsHdmi) &&
+		    (Cap.MaxTmdsMhz == SinkPtr->MaxTmdsMhz) &&
+		    (Cap.IsScdcPresent == SinkPtr->IsScdcPresent) &&
+		    (Cap.MaxFrlRate == SinkPtr->MaxFrlRate),
+		    "%s: %u CTA blocks, HDMI %u, %u MHz, SCDC %u, FRL %u",
+		    SinkPtr->Name, Cap.NumCtaBlocks, Cap.IsHdmi,
+		    Cap.MaxTmdsMhz, Cap.IsScdcPresent, Cap.MaxFrlRate);
+	XHOST_CHECK((Cap.IsYCbCr444Supp == SinkPtr->IsYCbCr444Supp) &&
+		    (Cap.IsYCbCr422Supp == SinkPtr->IsYCbCr422Supp) &&
+		    (Cap.IsYCbCr420Supp == SinkPtr->IsYCbCr420Supp) &&
+		    (Cap.DeepColor == SinkPtr->DeepColor) &&
+		    (Cap.Y420DeepColor == SinkPtr->Y420DeepColor),
+		    "%s: YCbCr 444 %u 422 %u 420 %u, deep color 0x%X 0x%X",
+		    SinkPtr->Name, Cap.IsYCbCr444Supp, Cap.IsYCbCr422Supp,
+		    Cap.IsYCbCr420Supp, Cap.DeepColor, Cap.Y420DeepColor);
+	XHOST_CHECK(Cap.PreferredVm == SinkPtr->PreferredVm,
+		    "%s: preferred mode %d, expected %d", SinkPtr->Name,
+		    Cap.PreferredVm, SinkPtr->PreferredVm);
+	XHOST_CHECK((Cap.NumTimings == SinkPtr->NumTimings) &&
+		    (Count(Cap.SuppVm, XVIDC_VM_NUM_SUPPORTED) ==
+		     SinkPtr->NumVms) &&
+		    (Count(Cap.Y420Vm, XVIDC_VM_NUM_SUPPORTED) ==
+		     SinkPtr->NumY420Vms) &&
+		    (Count(Cap.SuppVic, 256) == SinkPtr->NumVics),
+		    "%s: %u timings, %u modes, %u 4:2:0 modes, %u VICs",
+		    SinkPtr->Name, Cap.NumTimings,
+		    (unsigned)Count(Cap.SuppVm, XVIDC_VM_NUM_SUPPORTED),
+		    (unsigned)Count(Cap.Y420Vm, XVIDC_VM_NUM_SUPPORTED),
+		    (unsigned)Count(Cap.SuppVic, 256));
+
+	/* The base EDID alone holds what the legacy check reports */
+	Ptm = &SinkPtr->Edid[XVIDC_EDID_PTM];
+	PtmH = ((Ptm[4] & 0xF0) << 4) | Ptm[2];
+	PtmV = ((Ptm[7] & 0xF0) << 4) | Ptm[5];
+	XVidC_EdidCapParse(&BaseCap, SinkPtr->Edid, XVIDC_EDID_BLOCK_LEN);
+	for (Index = 0; Index < XVIDC_VM_NUM_SUPPORTED; Index++) {
+		VtMode = &XVidC_VideoTimingModes[Index];
+		if (XVidC_EdidIsVideoTimingSupported(SinkPtr->Edid, VtMode) !=
+		    XST_SUCCESS) {
+			continue;
+		}
+		if ((VtMode->Timing.HActive == PtmH) &&
+		    (VtMode->Timing.VActive == PtmV)) {
+			continue;
+		}
+		XHOST_CHECK(XVidC_EdidCapIsVmSupported(&BaseCap,
+				(XVidC_VideoMode)Index) == XST_SUCCESS,
+			    "%s: %s reported by the legacy check only",
+			    SinkPtr->Name, VtMode->Name);
+	}
+	for (Index = 0; Index < XVIDC_VM_NUM_SUPPORTED; Index++) {
+		if ((BaseCap.SuppVm[Index / 32] >> (Index % 32)) & 0x1) {
+			XHOST_CHECK(XVidC_EdidCapIsVmSupported(&Cap,
+					(XVidC_VideoMode)Index) == XST_SUCCESS,
+				    "%s: %s lost with the extension blocks",
+				    SinkPtr->Name,
+				    XVidC_VideoTimingModes[Index].Name);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* Sets the checksum byte of a 128 byte EDID block.
+*
+******************************************************************************/
+static void SetChecksum(u8 *Block)
+{
+	u8 Sum = 0;
+	u32 Index;
+
+	for (Index = 0; Index < XVIDC_EDID_CHECKSUM; Index++) {
+		Sum += Block[Index];
+	}
+	Block[XVIDC_EDID_CHECKSUM] = (u8)(0x100 - Sum);
+}
+
+/*****************************************************************************/
+/**
+* Builds a base EDID with the 1920x1080@60Hz preferred timing and one
+* established timing bit, or none with Mask 0.
+*
+******************************************************************************/
+static void BuildEdid(u8 *Edid, u8 Offset, u8 Mask)
+{
+	static const u8 Header[8] = {
+		0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00
+	};
+	u32 Index;
+
+	memset(Edid, 0, XVIDC_EDID_BLOCK_LEN);
+	memcpy(Edid, Header, sizeof(Header));
+	Edid[0x12] = 1;
+	Edid[0x13] = 4;
+	Edid[0x14] = 0xA5;
+	Edid[Offset] = Mask;
+	for (Index = 1; Index <= 8; Index++) {
+		Edid[XVIDC_EDID_STD_TIMINGS_H(Index)] = 0x01;
+		Edid[XVIDC_EDID_STD_TIMINGS_H(Index) + 1] = 0x01;
+	}
+	memcpy(&Edid[XVIDC_EDID_PTM], Dtd1080p60, sizeof(Dtd1080p60));
+	SetChecksum(Edid);
+}
+
+/*****************************************************************************/
+/**
+* Checks the capability table of a base EDID followed by a CTA-861 extension
+* block holding CtaDataBlocks, then with a wrong checksum of the extension.
+*
+******************************************************************************/
+static void CheckCta(void)
+{
+	u8 Edid[2 * XVIDC_EDID_BLOCK_LEN];
+	u8 *Block = &Edid[XVIDC_EDID_BLOCK_LEN];
+	XVidC_EdidCap Cap;
+
+	BuildEdid(Edid, XVIDC_EDID_EST_TIMINGS_I, 0);
+	Edid[XVIDC_EDID_EXT_BLK_COUNT] = 1;
+	SetChecksum(Edid);
+	memset(Block, 0, XVIDC_EDID_BLOCK_LEN);
+	Block[0] = 0x02;
+	Block[1] = 0x03;
+	Block[2] = 4 + sizeof(CtaDataBlocks);
+	Block[3] = 0x30;
+	memcpy(&Block[4], CtaDataBlocks, sizeof(CtaDataBlocks));
+	SetChecksum(Block);
+
+	XHOST_CHECK(XVidC_EdidCapParse(&Cap, Edid, sizeof(Edid)) ==
+		    XST_SUCCESS, "CTA: not parsed");
+	XHOST_CHECK((Cap.NumCtaBlocks == 1) && Cap.IsHdmi &&
+		    (Cap.MaxTmdsMhz == 340) && !Cap.IsScdcPresent &&
+		    (Cap.DeepColor == (XVIDC_EDID_CAP_DC_30BPP |
+		     XVIDC_EDID_CAP_DC_36BPP | XVIDC_EDID_CAP_DC_Y444)) &&
+		    Cap.IsYCbCr444Supp && Cap.IsYCbCr422Supp &&
+		    Cap.IsYCbCr420Supp,
+		    "CTA: %u blocks, HDMI %u, %u MHz, deep color 0x%X, "
+		    "YCbCr 444 %u 422 %u 420 %u", Cap.NumCtaBlocks,
+		    Cap.IsHdmi, Cap.MaxTmdsMhz, Cap.DeepColor,
+		    Cap.IsYCbCr444Supp, Cap.IsYCbCr422Supp,
+		    Cap.IsYCbCr420Supp);
+	XHOST_CHECK((Count(Cap.SuppVm, XVIDC_VM_NUM_SUPPORTED) == 5) &&
+		    (XVidC_EdidCapIsVmSupported(&Cap,
+			XVIDC_VM_1920x1080_60_P) == XST_SUCCESS) &&
+		    (XVidC_EdidCapIsVmSupported(&Cap,
+			XVIDC_VM_1920x1080_60_I) == XST_SUCCESS) &&
+		    (XVidC_EdidCapIsVmSupported(&Cap,
+			XVIDC_VM_1280x720_60_P) == XST_SUCCESS) &&
+		    (XVidC_EdidCapIsVmSupported(&Cap,
+			XVIDC_VM_3840x2160_60_P) == XST_SUCCESS) &&
+		    (XVidC_EdidCapIsVmSupported(&Cap,
+			XVIDC_VM_3840x2160_60_P_RB) == XST_SUCCESS),
+		    "CTA: %u video modes",
+		    (unsigned)Count(Cap.SuppVm, XVIDC_VM_NUM_SUPPORTED));
+	XHOST_CHECK((Count(Cap.Y420Vm, XVIDC_VM_NUM_SUPPORTED) == 3) &&
+		    (XVidC_EdidCapIsY420Supported(&Cap,
+			XVIDC_VM_3840x2160_60_P) == XST_SUCCESS) &&
+		    (XVidC_EdidCapIsY420Supported(&Cap,
+			XVIDC_VM_1280x720_60_P) == XST_SUCCESS) &&
+		    (XVidC_EdidCapIsY420Supported(&Cap,
+			XVIDC_VM_1920x1080_60_P) == XST_FAILURE),
+		    "CTA: %u YCbCr 4:2:0 video modes",
+		    (unsigned)Count(Cap.Y420Vm, XVIDC_VM_NUM_SUPPORTED));
+	XHOST_CHECK((Count(Cap.SuppVic, 256) == 4) &&
+		    (XVidC_EdidCapIsVicSupported(&Cap, 16) == XST_SUCCESS) &&
+		    (XVidC_EdidCapIsVicSupported(&Cap, 97) == XST_SUCCESS),
+		    "CTA: %u VICs", (unsigned)Count(Cap.SuppVic, 256));
+
+	Block[XVIDC_EDID_CHECKSUM]++;
+	XVidC_EdidCapParse(&Cap, Edid, sizeof(Edid));
+	XHOST_CHECK((Cap.NumCtaBlocks == 0) && !Cap.IsHdmi &&
+		    (Count(Cap.SuppVm, XVIDC_VM_NUM_SUPPORTED) == 1),
+		    "CTA: block with a wrong checksum parsed");
+}
+
+/*****************************************************************************/
+/**
+* Sets a custom video timing mode, not of the timing table.
+*
+******************************************************************************/
+static void SetMode(XVidC_VideoTimingMode *VtMode, u16 HActive, u16 VActive,
+		u8 FrameRate, u8 IsInterlaced)
+{
+	memset(VtMode, 0, sizeof(*VtMode));
+	VtMode->VmId = XVIDC_VM_CUSTOM;
+	VtMode->FrameRate = (XVidC_FrameRate)FrameRate;
+	VtMode->Timing.HActive = HActive;
+	VtMode->Timing.VActive = VActive;
+	VtMode->Timing.F0PVTotal = VActive + 50;
+	VtMode->Timing.F1VTotal = IsInterlaced ? (VActive + 51) : 0;
+}
+
+/*****************************************************************************/
+/**
+* Checks an established timing set alone in a base EDID, and not reported
+* once cleared. An interlaced timing is matched by the legacy check on the
+* lines of the frame and by the capability table on the lines of a field.
+*
+******************************************************************************/
+static void CheckEstTiming(const EstTiming *EstPtr)
+{
+	u8 Edid[XVIDC_EDID_BLOCK_LEN];
+	XVidC_VideoTimingMode Frame;
+	XVidC_VideoTimingMode Field;
+	XVidC_VideoTimingMode Progressive;
+	XVidC_EdidCap Cap;
+	const XVidC_EdidCapTiming *TimingPtr;
+	u16 VActive;
+
+	VActive = EstPtr->VActive >> EstPtr->IsInterlaced;
+	SetMode(&Frame, EstPtr->HActive, EstPtr->VActive, EstPtr->FrameRate,
+		EstPtr->IsInterlaced);
+	SetMode(&Field, EstPtr->HActive, VActive, EstPtr->FrameRate,
+		EstPtr->IsInterlaced);
+	SetMode(&Progressive, EstPtr->HActive, EstPtr->VActive,
+		EstPtr->FrameRate, 0);
+
+	BuildEdid(Edid, EstPtr->Offset, EstPtr->Mask);
+	XHOST_CHECK(XVidC_EdidIsVideoTimingSupported(Edid, &Frame) ==
+		    XST_SUCCESS, "%ux%u@%u not reported by the legacy check",
+		    EstPtr->HActive, EstPtr->VActive, EstPtr->FrameRate);
+	XHOST_CHECK(XVidC_EdidCapParse(&Cap, Edid, sizeof(Edid)) ==
+		    XST_SUCCESS, "%ux%u@%u: not parsed", EstPtr->HActive,
+		    EstPtr->VActive, EstPtr->FrameRate);
+	TimingPtr = &Cap.Timing[1];
+	XHOST_CHECK((Cap.NumTimings == 2) &&
+		    (TimingPtr->HActive == EstPtr->HActive) &&
+		    (TimingPtr->VActive == VActive) &&
+		    (TimingPtr->FrameRate == EstPtr->FrameRate) &&
+		    (TimingPtr->IsInterlaced == EstPtr->IsInterlaced),
+		    "%ux%u@%u: %u timings, %ux%u@%u interlaced %u",
+		    EstPtr->HActive, EstPtr->VActive, EstPtr->FrameRate,
+		    Cap.NumTimings, TimingPtr->HActive, TimingPtr->VActive,
+		    TimingPtr->FrameRate, TimingPtr->IsInterlaced);
+	XHOST_CHECK(XVidC_EdidCapIsVideoTimingSupported(&Cap, &Field) ==
+		    XST_SUCCESS, "%ux%u@%u not in the capability table",
+		    EstPtr->HActive, VActive, EstPtr->FrameRate);
+
+	if (EstPtr->IsInterlaced) {
+		XHOST_CHECK(XVidC_EdidIsVideoTimingSupported(Edid, &Field) ==
+			    XST_FAILURE, "%ux%u@%u field lines reported by "
+			    "the legacy check", EstPtr->HActive, VActive,
+			    EstPtr->FrameRate);
+		XHOST_CHECK((XVidC_EdidCapIsVideoTimingSupported(&Cap,
+				&Frame) == XST_FAILURE) &&
+			    (XVidC_EdidCapIsVideoTimingSupported(&Cap,
+				&Progressive) == XST_FAILURE),
+			    "%ux%u@%u frame lines or progressive in the "
+			    "capability table", EstPtr->HActive,
+			    EstPtr->VActive, EstPtr->FrameRate);
+	}
+
+	BuildEdid(Edid, EstPtr->Offset, 0);
+	XVidC_EdidCapParse(&Cap, Edid, sizeof(Edid));
+	XHOST_CHECK((XVidC_EdidIsVideoTimingSupported(Edid, &Frame) ==
+		     XST_FAILURE) &&
+		    (XVidC_EdidCapIsVideoTimingSupported(&Cap, &Field) ==
+		     XST_FAILURE) && (Cap.NumTimings == 1),
+		    "%ux%u@%u reported when cleared", EstPtr->HActive,
+		    EstPtr->VActive, EstPtr->FrameRate);
+}
+
+/*****************************************************************************/
+/**
+* Prints the time of a parse of an EDID and of a query of a video mode, with
+* the legacy check and with the capability table.
+*
+******************************************************************************/
+static void TimeSink(const Sink *SinkPtr)
+{
+	XVidC_EdidCap Cap;
+	volatile u32 Result = 0;
+	u64 ParseNs;
+	u64 LegacyNs;
+	u64 CapNs;
+	u64 Start;
+	u32 Round;
+	u32 Index;
+
+	Start = XHostModel_TimeNs();
+	for (Round = 0; Round < PARSE_ROUNDS; Round++) {
+		Result += XVidC_EdidCapParse(&Cap, SinkPtr->Edid, SinkPtr->Size);
+	}
+	ParseNs = (XHostModel_TimeNs() - Start) / PARSE_ROUNDS;
+
+	Start = XHostModel_TimeNs();
+	for (Round = 0; Round < QUERY_ROUNDS; Round++) {
+		for (Index = 0; Index < XVIDC_VM_NUM_SUPPORTED; Index++) {
+			Result += XVidC_EdidIsVideoTimingSupported(SinkPtr->Edid,
+					&XVidC_VideoTimingModes[Index]);
+		}
+	}
+	LegacyNs = XHostModel_TimeNs() - Start;
+
+	Start = XHostModel_TimeNs();
+	for (Round = 0; Round < QUERY_ROUNDS; Round++) {
+		for (Index = 0; Index < XVIDC_VM_NUM_SUPPORTED; Index++) {
+			Result += XVidC_EdidCapIsVmSupported(&Cap,
+					(XVidC_VideoMode)Index);
+		}
+	}
+	CapNs = XHostModel_TimeNs() - Start;
+
+	printf("%-28s %3u bytes: parse %5.1f us, query %5.1f ns legacy, "
+	       "%4.1f ns table\n", SinkPtr->Name, (unsigned)SinkPtr->Size,
+	       ParseNs / 1000.0,
+	       LegacyNs / (double)(QUERY_ROUNDS * XVIDC_VM_NUM_SUPPORTED),
+	       CapNs / (double)(QUERY_ROUNDS * XVIDC_VM_NUM_SUPPORTED));
+	XHOST_CHECK(ParseNs < FRAME_NS, "%s: %llu ns per parse",
+		    SinkPtr->Name, (unsigned long long)ParseNs);
+}
+
+int main(void)
+{
+	u32 Index;
+
+	for (Index = 0; Index < (sizeof(Sinks) / sizeof(Sinks[0])); Index++) {
+		CheckSink(&Sinks[Index]);
+	}
+	CheckCta();
+	for (Index = 0; Index < (sizeof(EstTimings) / sizeof(EstTimings[0]));
+	     Index++) {
+		CheckEstTiming(&EstTimings[Index]);
+	}
+	for (Index = 0; Index < (sizeof(Sinks) / sizeof(Sinks[0])); Index++) {
+		TimeSink(&Sinks[Index]);
+	}
+
+	return XHostModel_Report("xvidc_edid_model_test");
+}
@@ -0,0 +1,368 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xvidc_polyphase_model_test.c
+*
+* Host comparison of XVidC_PolyphaseDesign() with the fixed coefficient
+* tables of the H Scaler, V Scaler and Multi Scaler drivers. It is not a
+* target example: it is built and run with the other driver model tests by
+* make -C scripts/host_model.
+*
+* For each table the filter is designed for the number of taps and the
+* scaling ratio the table is selected for. The Multi Scaler tables are one
+* design per number of taps, for 1.08:1 with 6 taps, 2.8:1 with 8, 5:1 with
+* 10 and 6.5:1 with 12, used over ranges of ratios, and are compared at
+* that ratio. Its tables of 12 columns hold fewer taps in the middle columns. The test prints per ratio the
+* maximum and RMS difference of the coefficients, the DC gain range over
+* the phases of both filters and their mean gain past the output Nyquist
+* frequency, where the scaler aliases. It checks that every designed phase
+* has a DC gain of exactly 1.0, that the coefficients stay close to the
+* tables and that the stop band is not worse than with the tables.
+*
+* Then a zoom changes the output width of an H Scaler every frame and the
+* time of XV_HScalerSetup() per frame is printed with the tables and with
+* the designed coefficients.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.15  kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <math.h>
+#include <string.h>
+#include "xv_hscaler_l2.h"
+#include "xv_vscaler_l2.h"
+#include "xv_multi_scaler_l2.h"
+#include "xvidc.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define NUM_PHASES	XV_HSCALER_MAX_H_PHASES
+#define ONE		(1 << XVIDC_POLYPHASE_FRAC_BITS)
+#define MAX_ERROR	0.10	/* Largest coefficient difference, of 1.0 */
+#define MAX_RMS_ERROR	0.05	/* Largest RMS coefficient difference */
+#define STOP_MARGIN	0.02	/* Stop band gain allowed above the table */
+#define NUM_BINS	32	/* Frequencies of the stop band mean */
+#define CORE_BASE	0x8000U	/* Address of the H Scaler of the zoom */
+#define CORE_SPAN	0x8000U	/* Register space of the H Scaler */
+#define ZOOM_FRAMES	960U	/* Frames of the zoom, one ratio each */
+#define ZOOM_WIDTH	3840U	/* Input width of the zoom */
+#define FRAME_HEIGHT	2160U
+#define FRAME_NS	16666667U	/* Frame period at 60 Hz */
+
+/**************************** Type Definitions *******************************/
+
+typedef struct {
+	const char *Name;
+	const short *Table;
+	u16 Stride;	/* Columns of the table */
+	u16 Offset;	/* Column of the first tap */
+	u16 NumTaps;
+	u32 SizeIn;
+	u32 SizeOut;
+} Ratio;
+
+/************************** Function Prototypes ******************************/
+
+static double Gain(const short *Coeff, u16 Stride, u16 NumTaps, double Freq);
+static double StopBand(const short *Coeff, u16 Stride, u16 NumTaps,
+		       u32 SizeIn, u32 SizeOut);
+static void Compare(const Ratio *RatioPtr);
+static u64 Zoom(u32 NumTaps, u8 Design);
+
+/************************** Variable Definitions *****************************/
+
+extern const short XV_hscaler_Lanczos2_taps6[NUM_PHASES][XV_HSCALER_TAPS_6];
+extern const short XV_hscaler_fixedcoeff_taps6_ScalingRatio1p2[NUM_PHASES][XV_HSCALER_TAPS_6];
+extern const short XV_hscaler_fixedcoeff_taps6_ScalingRatio2[NUM_PHASES][XV_HSCALER_TAPS_6];
+extern const short XV_hscaler_fixedcoeff_taps6_ScalingRatio3[NUM_PHASES][XV_HSCALER_TAPS_6];
+extern const short XV_hscaler_fixedcoeff_taps6_ScalingRatio4[NUM_PHASES][XV_HSCALER_TAPS_6];
+extern const short XV_hscaler_fixedcoeff_taps8_ScalingRatio2[NUM_PHASES][XV_HSCALER_TAPS_8];
+extern const short XV_hscaler_fixedcoeff_taps8_ScalingRatio3[NUM_PHASES][XV_HSCALER_TAPS_8];
+extern const short XV_hscaler_fixedcoeff_taps8_ScalingRatio4[NUM_PHASES][XV_HSCALER_TAPS_8];
+extern const short XV_hscaler_fixedcoeff_taps10_ScalingRatio3[NUM_PHASES][XV_HSCALER_TAPS_10];
+extern const short XV_hscaler_fixedcoeff_taps10_ScalingRatio4[NUM_PHASES][XV_HSCALER_TAPS_10];
+extern const short XV_hscaler_fixedcoeff_taps12_ScalingRatio4[NUM_PHASES][XV_HSCALER_TAPS_12];
+extern const short XV_vscaler_Lanczos2_taps6[NUM_PHASES][XV_VSCALER_TAPS_6];
+extern const short XV_vscaler_fixedcoeff_taps6_ScalingRatio1p2[NUM_PHASES][XV_VSCALER_TAPS_6];
+extern const short XV_vscaler_fixedcoeff_taps6_ScalingRatio2[NUM_PHASES][XV_VSCALER_TAPS_6];
+extern const short XV_vscaler_fixedcoeff_taps6_ScalingRatio3[NUM_PHASES][XV_VSCALER_TAPS_6];
+extern const short XV_vscaler_fixedcoeff_taps6_ScalingRatio4[NUM_PHASES][XV_VSCALER_TAPS_6];
+extern const short XV_vscaler_fixedcoeff_taps8_ScalingRatio2[NUM_PHASES][XV_VSCALER_TAPS_8];
+extern const short XV_vscaler_fixedcoeff_taps8_ScalingRatio3[NUM_PHASES][XV_VSCALER_TAPS_8];
+extern const short XV_vscaler_fixedcoeff_taps8_ScalingRatio4[NUM_PHASES][XV_VSCALER_TAPS_8];
+extern const short XV_vscaler_fixedcoeff_taps10_ScalingRatio3[NUM_PHASES][XV_VSCALER_TAPS_10];
+extern const short XV_vscaler_fixedcoeff_taps10_ScalingRatio4[NUM_PHASES][XV_VSCALER_TAPS_10];
+extern const short XV_vscaler_fixedcoeff_taps12_ScalingRatio4[NUM_PHASES][XV_VSCALER_TAPS_12];
+
+static u32 Regs[CORE_SPAN / 4U];
+static XV_Hscaler_l2 Hsc;
+
+/* Configuration table of the SDT initialization, the zoom sets up its core by
+ * XV_hscaler_CfgInitialize() */
+XV_hscaler_Config XV_hscaler_ConfigTable[] = { { NULL } };
+
+/* Ratios the tables are selected for. The Multi Scaler has one design per
+ * number of taps, selected over ranges of ratios by
+ * XV_MultiScalerSelectCoeff(), which are compared at the ratio they match. */
+static const Ratio Ratios[] = {
+	{ "H 6 taps 1:1", &XV_hscaler_Lanczos2_taps6[0][0],
+	  6, 0, 6, 1920, 1920 },
+	{ "H 6 taps 1.2:1", &XV_hscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0],
+	  6, 0, 6, 3840, 3200 },
+	{ "H 6 taps 2:1", &XV_hscaler_fixedcoeff_taps6_ScalingRatio2[0][0],
+	  6, 0, 6, 3840, 1920 },
+	{ "H 6 taps 3:1", &XV_hscaler_fixedcoeff_taps6_ScalingRatio3[0][0],
+	  6, 0, 6, 3840, 1280 },
+	{ "H 6 taps 4:1", &XV_hscaler_fixedcoeff_taps6_ScalingRatio4[0][0],
+	  6, 0, 6, 3840, 960 },
+	{ "H 8 taps 2:1", &XV_hscaler_fixedcoeff_taps8_ScalingRatio2[0][0],
+	  8, 0, 8, 3840, 1920 },
+	{ "H 8 taps 3:1", &XV_hscaler_fixedcoeff_taps8_ScalingRatio3[0][0],
+	  8, 0, 8, 3840, 1280 },
+	{ "H 8 taps 4:1", &XV_hscaler_fixedcoeff_taps8_ScalingRatio4[0][0],
+	  8, 0, 8, 3840, 960 },
+	{ "H 10 taps 3:1", &XV_hscaler_fixedcoeff_taps10_ScalingRatio3[0][0],
+	  10, 0, 10, 3840, 1280 },
+	{ "H 10 taps 4:1", &XV_hscaler_fixedcoeff_taps10_ScalingRatio4[0][0],
+	  10, 0, 10, 3840, 960 },
+	{ "H 12 taps 4:1", &XV_hscaler_fixedcoeff_taps12_ScalingRatio4[0][0],
+	  12, 0, 12, 3840, 960 },
+	{ "V 6 taps 1:1", &XV_vscaler_Lanczos2_taps6[0][0],
+	  6, 0, 6, 1920, 1920 },
+	{ "V 6 taps 1.2:1", &XV_vscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0],
+	  6, 0, 6, 3840, 3200 },
+	{ "V 6 taps 2:1", &XV_vscaler_fixedcoeff_taps6_ScalingRatio2[0][0],
+	  6, 0, 6, 3840, 1920 },
+	{ "V 6 taps 3:1", &XV_vscaler_fixedcoeff_taps6_ScalingRatio3[0][0],
+	  6, 0, 6, 3840, 1280 },
+	{ "V 6 taps 4:1", &XV_vscaler_fixedcoeff_taps6_ScalingRatio4[0][0],
+	  6, 0, 6, 3840, 960 },
+	{ "V 8 taps 2:1", &XV_vscaler_fixedcoeff_taps8_ScalingRatio2[0][0],
+	  8, 0, 8, 3840, 1920 },
+	{ "V 8 taps 3:1", &XV_vscaler_fixedcoeff_taps8_ScalingRatio3[0][0],
+	  8, 0, 8, 3840, 1280 },
+	{ "V 8 taps 4:1", &XV_vscaler_fixedcoeff_taps8_ScalingRatio4[0][0],
+	  8, 0, 8, 3840, 960 },
+	{ "V 10 taps 3:1", &XV_vscaler_fixedcoeff_taps10_ScalingRatio3[0][0],
+	  10, 0, 10, 3840, 1280 },
+	{ "V 10 taps 4:1", &XV_vscaler_fixedcoeff_taps10_ScalingRatio4[0][0],
+	  10, 0, 10, 3840, 960 },
+	{ "V 12 taps 4:1", &XV_vscaler_fixedcoeff_taps12_ScalingRatio4[0][0],
+	  12, 0, 12, 3840, 960 },
+	{ "M 6 taps 1.08:1 12C", &XV_multiscaler_fixedcoeff_taps6_12C[0][0],
+	  12, 3, 6, 3840, 3568 },
+	{ "M 6 taps 1.08:1", &XV_multiscaler_fixedcoeff_taps6_6C[0][0],
+	  6, 0, 6, 3840, 3568 },
+	{ "M 8 taps 2.8:1 12C", &XV_multiscaler_fixedcoeff_taps8_12C[0][0],
+	  12, 2, 8, 3840, 1360 },
+	{ "M 8 taps 2.8:1", &XV_multiscaler_fixedcoeff_taps8_8C[0][0],
+	  8, 0, 8, 3840, 1360 },
+	{ "M 10 taps 5:1 12C", &XV_multiscaler_fixedcoeff_taps10_12C[0][0],
+	  12, 1, 10, 3840, 768 },
+	{ "M 10 taps 5:1", &XV_multiscaler_fixedcoeff_taps10_10C[0][0],
+	  10, 0, 10, 3840, 768 },
+	{ "M 12 taps 6.5:1", &XV_multiscaler_fixedcoeff_taps12_12C[0][0],
+	  12, 0, 12, 3840, 592 },
+};
+
+/*****************************************************************************/
+/*
+* Mean over the phases of the gain at Freq, in cycles per input sample. The
+* phases are Stride coefficients apart.
+*/
+static double Gain(const short *Coeff, u16 Stride, u16 NumTaps, double Freq)
+{
+	double Sum = 0.0;
+	double Re;
+	double Im;
+	u32 Phase;
+	u32 Tap;
+
+	for (Phase = 0; Phase < NUM_PHASES; Phase++) {
+		Re = 0.0;
+		Im = 0.0;
+		for (Tap = 0; Tap < NumTaps; Tap++) {
+			Re += Coeff[Phase * Stride + Tap] *
+			      cos(2.0 * M_PI * Freq * Tap);
+			Im += Coeff[Phase * Stride + Tap] *
+			      sin(2.0 * M_PI * Freq * Tap);
+		}
+		Sum += sqrt((Re * Re) + (Im * Im)) / ONE;
+	}
+
+	return Sum / NUM_PHASES;
+}
+
+/*****************************************************************************/
+/*
+* Mean gain from the output Nyquist frequency to the input Nyquist frequency.
+* Scaling up, the band is empty and 0 is returned.
+*/
+static double StopBand(const short *Coeff, u16 Stride, u16 NumTaps,
+		       u32 SizeIn, u32 SizeOut)
+{
+	double Nyquist = 0.5 * SizeOut / SizeIn;
+	double Sum = 0.0;
+	u32 Bin;
+
+	if (SizeOut >= SizeIn) {
+		return 0.0;
+	}
+	for (Bin = 0; Bin < NUM_BINS; Bin++) {
+		Sum += Gain(Coeff, Stride, NumTaps,
+			    Nyquist + ((0.5 - Nyquist) * (Bin + 0.5) /
+				       NUM_BINS));
+	}
+
+	return Sum / NUM_BINS;
+}
+
+static void Compare(const Ratio *RatioPtr)
+{
+	static s16 Designed[NUM_PHASES * XVIDC_POLYPHASE_MAX_TAPS];
+	const short *Table = RatioPtr->Table + RatioPtr->Offset;
+	u16 Stride = RatioPtr->Stride;
+	u16 NumTaps = RatioPtr->NumTaps;
+	double TableDc[2] = { 1e9, -1e9 };
+	double DesignDc[2] = { 1e9, -1e9 };
+	double MaxError = 0.0;
+	double SumSquares = 0.0;
+	double TableStop;
+	double DesignStop;
+	double Error;
+	s32 TableSum;
+	s32 DesignSum;
+	u32 Phase;
+	u32 Tap;
+
+	XHOST_CHECK(XVidC_PolyphaseDesign(Designed, NUM_PHASES, NumTaps,
+					  RatioPtr->SizeIn,
+					  RatioPtr->SizeOut) == XST_SUCCESS,
+		    "%s: design", RatioPtr->Name);
+
+	for (Phase = 0; Phase < NUM_PHASES; Phase++) {
+		TableSum = 0;
+		DesignSum = 0;
+		for (Tap = 0; Tap < NumTaps; Tap++) {
+			Error = (double)(Designed[Phase * NumTaps + Tap] -
+					 Table[Phase * Stride + Tap]) / ONE;
+			MaxError = fmax(MaxError, fabs(Error));
+			SumSquares += Error * Error;
+			TableSum += Table[Phase * Stride + Tap];
+			DesignSum += Designed[Phase * NumTaps + Tap];
+		}
+		TableDc[0] = fmin(TableDc[0], (double)TableSum / ONE);
+		TableDc[1] = fmax(TableDc[1], (double)TableSum / ONE);
+		DesignDc[0] = fmin(DesignDc[0], (double)DesignSum / ONE);
+		DesignDc[1] = fmax(DesignDc[1], (double)DesignSum / ONE);
+		XHOST_CHECK(DesignSum == ONE, "%s: phase %u DC gain %d/%d",
+			    RatioPtr->Name, (unsigned)Phase, (int)DesignSum,
+			    ONE);
+	}
+	Error = sqrt(SumSquares / (NUM_PHASES * NumTaps));
+	TableStop = StopBand(Table, Stride, NumTaps, RatioPtr->SizeIn,
+			     RatioPtr->SizeOut);
+	DesignStop = StopBand((const short *)Designed, NumTaps, NumTaps,
+			      RatioPtr->SizeIn, RatioPtr->SizeOut);
+
+	printf("%-17s max %.4f rms %.4f, DC table %.4f..%.4f design "
+	       "%.4f..%.4f, stop band table %.3f design %.3f\n",
+	       RatioPtr->Name, MaxError, Error, TableDc[0], TableDc[1],
+	       DesignDc[0], DesignDc[1], TableStop, DesignStop);
+	XHOST_CHECK(MaxError <= MAX_ERROR, "%s: max error %.4f",
+		    RatioPtr->Name, MaxError);
+	XHOST_CHECK(Error <= MAX_RMS_ERROR, "%s: rms error %.4f",
+		    RatioPtr->Name, Error);
+	XHOST_CHECK(DesignStop <= TableStop + STOP_MARGIN,
+		    "%s: stop band %.3f, table %.3f", RatioPtr->Name,
+		    DesignStop, TableStop);
+}
+
+/*****************************************************************************/
+/*
+* Register model of the H Scaler of the zoom: plain memory.
+*/
+u32 Xil_In32(UINTPTR Addr)
+{
+	return Regs[(Addr - CORE_BASE) / 4U];
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	Regs[(Addr - CORE_BASE) / 4U] = Value;
+}
+
+/*****************************************************************************/
+/*
+* Zoom out of ZOOM_WIDTH by one output pixel per frame, each frame set up
+* for its ratio. Returns the mean time per frame.
+*/
+static u64 Zoom(u32 NumTaps, u8 Design)
+{
+	XV_hscaler_Config Cfg;
+	u64 StartNs;
+	u32 Frame;
+	u32 WidthOut;
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	Cfg.Name = "hscaler";
+	Cfg.PixPerClk = XVIDC_PPC_2;
+	Cfg.MaxWidth = ZOOM_WIDTH;
+	Cfg.MaxHeight = FRAME_HEIGHT;
+	Cfg.PhaseShift = 6U;
+	Cfg.NumTaps = (u16)NumTaps;
+	Cfg.ScalerType = XV_HSCALER_POLYPHASE;
+	memset(&Hsc, 0, sizeof(Hsc));
+	(void)XV_hscaler_CfgInitialize(&Hsc.Hsc, &Cfg, CORE_BASE);
+	XV_HScalerSetCoeffDesign(&Hsc, Design);
+
+	StartNs = XHostModel_TimeNs();
+	for (Frame = 0U; Frame < ZOOM_FRAMES; Frame++) {
+		WidthOut = ZOOM_WIDTH - Frame;
+		XHOST_CHECK(XV_HScalerSetup(&Hsc, FRAME_HEIGHT, ZOOM_WIDTH,
+					    WidthOut, XVIDC_CSF_RGB,
+					    XVIDC_CSF_RGB) == XST_SUCCESS,
+			    "zoom setup %u->%u", (unsigned)ZOOM_WIDTH,
+			    (unsigned)WidthOut);
+	}
+
+	return (XHostModel_TimeNs() - StartNs) / ZOOM_FRAMES;
+}
+
+int main(void)
+{
+	u64 TableNs;
+	u64 DesignNs;
+	u32 Index;
+	u32 Taps;
+
+	for (Index = 0; Index < (sizeof(Ratios) / sizeof(Ratios[0])); Index++) {
+		Compare(&Ratios[Index]);
+	}
+
+	for (Taps = XV_HSCALER_TAPS_6; Taps <= XV_HSCALER_TAPS_12; Taps += 2U) {
+		TableNs = Zoom(Taps, 0U);
+		DesignNs = Zoom(Taps, 1U);
+		printf("zoom %2u taps: %.1f us per frame with the tables, "
+		       "%.1f us designed\n", (unsigned)Taps, TableNs / 1000.0,
+		       DesignNs / 1000.0);
+		XHOST_CHECK(DesignNs < FRAME_NS, "%u taps: %llu ns per frame",
+			    (unsigned)Taps, (unsigned long long)DesignNs);
+	}
+
+	return XHostModel_Report("xvidc_polyphase_model_test");
+}
@@ -0,0 +1,332 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xvidc_vmindex_model_test.c
+*
+* Host comparison of the video mode lookups, XVidC_GetVideoModeId() and
+* XVidC_GetVideoModeIdExtensive(), with a linear search of the tables. It is
+* not a target example: it is built and run with the other driver model
+* tests by make -C scripts/host_model.
+*
+* The keys are the timings of every mode of the tables, and the same timings
+* with a changed width, height, frame rate, total or field 1 timing. Each key
+* is looked up progressive and interlaced, with and without extensive
+* matching. The linear search returns the first mode of the custom table,
+* then of the range of the pre-defined table, which matches.
+*
+* The lookups are compared before the index is built, once built, with a
+* custom table small enough to be indexed, with a custom table too large for
+* it, and after each custom table is unregistered. The time per lookup is
+* printed with the table search and with the index.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.15  kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xstatus.h"
+#include "xvidc.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define NUM_SMALL	4U	/* Modes of the custom table indexed */
+#define NUM_LARGE	70U	/* Modes of the custom table not indexed */
+#define NUM_VARIANTS	7U	/* Keys per timing */
+#define MAX_KEYS	((XVIDC_VM_NUM_SUPPORTED + NUM_SMALL + NUM_LARGE) * \
+			 NUM_VARIANTS)
+
+/**************************** Type Definitions *******************************/
+
+typedef struct {
+	XVidC_VideoTiming Timing;
+	u32 FrameRate;
+} Key;
+
+/************************** Function Prototypes ******************************/
+
+static u8 Match(const XVidC_VideoTimingMode *VtmPtr, const Key *KeyPtr,
+		u8 IsInterlaced, u8 IsExtensive);
+static XVidC_VideoMode Linear(const Key *KeyPtr, u8 IsInterlaced,
+		u8 IsExtensive);
+static void AddKeys(const XVidC_VideoTimingMode *VtmPtr);
+static void Compare(const char *Phase);
+static u64 TimeLookups(void);
+
+/************************** Variable Definitions *****************************/
+
+extern const XVidC_VideoTimingMode XVidC_VideoTimingModes[XVIDC_VM_NUM_SUPPORTED];
+
+static XVidC_VideoTimingMode Small[NUM_SMALL];
+static XVidC_VideoTimingMode Large[NUM_LARGE];
+static const XVidC_VideoTimingMode *Custom;
+static u16 NumCustom;
+static Key Keys[MAX_KEYS];
+static u32 NumKeys;
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* Matches a mode as the lookups do: on active size and frame rate, and with
+* IsExtensive on the totals, front porches, sync widths and vertical sync
+* polarity, and on the field 1 timing when interlaced.
+*
+******************************************************************************/
+static u8 Match(const XVidC_VideoTimingMode *VtmPtr, const Key *KeyPtr,
+		u8 IsInterlaced, u8 IsExtensive)
+{
+	const XVidC_VideoTiming *T = &VtmPtr->Timing;
+	const XVidC_VideoTiming *K = &KeyPtr->Timing;
+
+	if ((T->HActive != K->HActive) || (T->VActive != K->VActive) ||
+	    ((u32)VtmPtr->FrameRate != KeyPtr->FrameRate)) {
+		return 0;
+	}
+	if (!IsExtensive) {
+		return 1;
+	}
+	if ((T->HTotal != K->HTotal) || (T->F0PVTotal != K->F0PVTotal) ||
+	    (T->HFrontPorch != K->HFrontPorch) ||
+	    (T->F0PVFrontPorch != K->F0PVFrontPorch) ||
+	    (T->HSyncWidth != K->HSyncWidth) ||
+	    (T->F0PVSyncWidth != K->F0PVSyncWidth) ||
+	    (T->VSyncPolarity != K->VSyncPolarity)) {
+		return 0;
+	}
+	if (IsInterlaced && ((T->F1VTotal != K->F1VTotal) ||
+			     (T->F1VFrontPorch != K->F1VFrontPorch) ||
+			     (T->F1VSyncWidth != K->F1VSyncWidth))) {
+		return 0;
+	}
+
+	return 1;
+}
+
+/*****************************************************************************/
+/**
+* Reference lookup: linear search of the custom table, where the interlaced
+* flag is not matched, then of the progressive or interlaced range of the
+* pre-defined table.
+*
+******************************************************************************/
+static XVidC_VideoMode Linear(const Key *KeyPtr, u8 IsInterlaced,
+		u8 IsExtensive)
+{
+	u32 Low = IsInterlaced ? XVIDC_VM_INTL_START : XVIDC_VM_PROG_START;
+	u32 High = IsInterlaced ? XVIDC_VM_INTL_END : XVIDC_VM_PROG_END;
+	u32 Index;
+
+	for (Index = 0; Index < NumCustom; Index++) {
+		if (Match(&Custom[Index], KeyPtr, IsInterlaced, IsExtensive)) {
+			return Custom[Index].VmId;
+		}
+	}
+	for (Index = Low; Index <= High; Index++) {
+		if (Match(&XVidC_VideoTimingModes[Index], KeyPtr, IsInterlaced,
+			  IsExtensive)) {
+			return (XVidC_VideoMode)Index;
+		}
+	}
+
+	return XVIDC_VM_NOT_SUPPORTED;
+}
+
+/*****************************************************************************/
+/**
+* Adds the keys of a mode: its timing, then the timing with one of the
+* matched fields changed.
+*
+******************************************************************************/
+static void AddKeys(const XVidC_VideoTimingMode *VtmPtr)
+{
+	Key *K = &Keys[NumKeys];
+	u32 Variant;
+
+	for (Variant = 0; Variant < NUM_VARIANTS; Variant++) {
+		K[Variant].Timing = VtmPtr->Timing;
+		K[Variant].FrameRate = VtmPtr->FrameRate;
+	}
+	K[1].Timing.HActive += 2;
+	K[2].Timing.VActive += 1;
+	K[3].FrameRate += 1;
+	K[4].Timing.HTotal += 1;
+	K[5].Timing.F1VTotal += 1;
+	K[6].Timing.VSyncPolarity ^= 1;
+	NumKeys += NUM_VARIANTS;
+}
+
+/*****************************************************************************/
+/**
+* Compares both lookups with the linear search for every key, progressive
+* and interlaced, with and without extensive matching.
+*
+******************************************************************************/
+static void Compare(const char *Phase)
+{
+	XVidC_VideoMode Expected;
+	XVidC_VideoMode Found;
+	XVidC_VideoTiming Timing;
+	u32 Mismatches = 0;
+	u32 Matches = 0;
+	u32 Index;
+	u8 Intl;
+	u8 Ext;
+
+	for (Index = 0; Index < NumKeys; Index++) {
+		for (Intl = 0; Intl <= 1; Intl++) {
+			Expected = Linear(&Keys[Index], Intl, 0);
+			Found = XVidC_GetVideoModeId(
+					Keys[Index].Timing.HActive,
+					Keys[Index].Timing.VActive,
+					Keys[Index].FrameRate, Intl);
+			Matches += (Expected != XVIDC_VM_NOT_SUPPORTED);
+			if ((Found != Expected) && (Mismatches++ == 0)) {
+				printf("%s: %ux%u@%u %c is %d, expected %d\n",
+				       Phase, Keys[Index].Timing.HActive,
+				       Keys[Index].Timing.VActive,
+				       (unsigned)Keys[Index].FrameRate,
+				       Intl ? 'I' : 'P', Found, Expected);
+			}
+
+			for (Ext = 0; Ext <= 1; Ext++) {
+				Expected = Linear(&Keys[Index], Intl, Ext);
+				Timing = Keys[Index].Timing;
+				Found = XVidC_GetVideoModeIdExtensive(&Timing,
+						Keys[Index].FrameRate, Intl,
+						Ext);
+				if ((Found != Expected) &&
+				    (Mismatches++ == 0)) {
+					printf("%s: %ux%u@%u %c extensive %u "
+					       "is %d, expected %d\n", Phase,
+					       Keys[Index].Timing.HActive,
+					       Keys[Index].Timing.VActive,
+					       (unsigned)Keys[Index].FrameRate,
+					       Intl ? 'I' : 'P', Ext, Found,
+					       Expected);
+				}
+			}
+		}
+	}
+
+	printf("%-28s %u keys, %u found, %u mismatches\n", Phase,
+	       (unsigned)NumKeys, (unsigned)Matches, (unsigned)Mismatches);
+	XHOST_CHECK(Mismatches == 0, "%s: %u lookups differ from the linear "
+		    "search", Phase, (unsigned)Mismatches);
+}
+
+/*****************************************************************************/
+/**
+* Returns the mean time of a lookup of XVidC_GetVideoModeIdExtensive() over
+* the keys, progressive and extensive.
+*
+******************************************************************************/
+static u64 TimeLookups(void)
+{
+	XVidC_VideoTiming Timing;
+	volatile u32 Sink = 0;
+	u64 Start;
+	u32 Round;
+	u32 Index;
+
+	Start = XHostModel_TimeNs();
+	for (Round = 0; Round < 20; Round++) {
+		for (Index = 0; Index < NumKeys; Index++) {
+			Timing = Keys[Index].Timing;
+			Sink += XVidC_GetVideoModeIdExtensive(&Timing,
+					Keys[Index].FrameRate, 0, 1);
+		}
+	}
+
+	return (XHostModel_TimeNs() - Start) / (20U * NumKeys);
+}
+
+int main(void)
+{
+	u64 TableNs;
+	u64 IndexNs;
+	u32 Index;
+
+	/* A custom mode sharing the key of a pre-defined one, which it takes
+	 * precedence over, one with a timing of its own and an interlaced one
+	 * also matched progressive */
+	Small[0] = XVidC_VideoTimingModes[XVIDC_VM_1920x1080_60_P];
+	Small[0].Timing.HTotal += 8;
+	Small[1] = XVidC_VideoTimingModes[XVIDC_VM_1920x1080_60_P];
+	Small[2] = XVidC_VideoTimingModes[XVIDC_VM_1920x1080_60_I];
+	Small[3] = XVidC_VideoTimingModes[XVIDC_VM_1280x720_60_P];
+	Small[3].Timing.HActive = 1234;
+	Small[3].Timing.VActive = 567;
+	for (Index = 0; Index < NUM_SMALL; Index++) {
+		Small[Index].VmId = (XVidC_VideoMode)(XVIDC_VM_CUSTOM + 1 +
+						      Index);
+	}
+	for (Index = 0; Index < NUM_LARGE; Index++) {
+		Large[Index] = XVidC_VideoTimingModes[XVIDC_VM_640x480_60_P];
+		Large[Index].VmId = (XVidC_VideoMode)(XVIDC_VM_CUSTOM + 1 +
+						      Index);
+		Large[Index].Timing.HActive = 100 + (Index / 2) * 2;
+		Large[Index].Timing.HTotal += Index % 2;
+	}
+
+	for (Index = 0; Index < XVIDC_VM_NUM_SUPPORTED; Index++) {
+		AddKeys(&XVidC_VideoTimingModes[Index]);
+	}
+	for (Index = 0; Index < NUM_SMALL; Index++) {
+		AddKeys(&Small[Index]);
+	}
+	for (Index = 0; Index < NUM_LARGE; Index++) {
+		AddKeys(&Large[Index]);
+	}
+
+	Compare("table search");
+	TableNs = TimeLookups();
+
+	XHOST_CHECK(XVidC_InitVideoModeIndex() == XST_SUCCESS,
+		    "index not built");
+	Compare("index");
+	IndexNs = TimeLookups();
+
+	Custom = Small;
+	NumCustom = NUM_SMALL;
+	XHOST_CHECK(XVidC_RegisterCustomTimingModes(Small, NUM_SMALL) ==
+		    XST_SUCCESS, "small custom table not registered");
+	Compare("index, small custom table");
+	XHOST_CHECK(XVidC_RegisterCustomTimingModes(Large, NUM_LARGE) ==
+		    XST_FAILURE, "second custom table registered");
+	Compare("index, small custom table");
+
+	XVidC_UnregisterCustomTimingModes();
+	Custom = NULL;
+	NumCustom = 0;
+	Compare("index, unregistered");
+
+	Custom = Large;
+	NumCustom = NUM_LARGE;
+	XHOST_CHECK(XVidC_RegisterCustomTimingModes(Large, NUM_LARGE) ==
+		    XST_SUCCESS, "large custom table not registered");
+	Compare("index, large custom table");
+
+	XVidC_UnregisterCustomTimingModes();
+	Custom = NULL;
+	NumCustom = 0;
+	Compare("index, unregistered");
+
+	printf("lookup: %llu ns with the table search, %llu ns with the "
+	       "index\n", (unsigned long long)TableNs,
+	       (unsigned long long)IndexNs);
+
+	return XHostModel_Report("xvidc_vmindex_model_test");
+}
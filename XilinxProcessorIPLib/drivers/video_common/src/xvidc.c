@@ -42,6 +42,10 @@
  * 4.3   eb   26/01/18 Added API XVidC_GetVideoModeIdExtensive
  *       jsr  02/22/18 Added XVIDC_CSF_YCBCR_420 color space format
  *       vyc  04/04/18 Added BGR8 memory format
+ * 4.15  kt   10/18/26 Added hash index of the video timing modes used by the
+ *                     XVidC_GetVideoModeId family
+ *       kt   10/18/26 Build the index outside the lookups, in a second bank
+ *                     while the lookups use the first one
  * </pre>
  *
 *******************************************************************************/
@@ -49,20 +53,69 @@
 /******************************* Include Files ********************************/
 
 #include "xil_assert.h"
+#include "xil_io.h"
 #include "xstatus.h"
 #include "xvidc.h"
 
+/************************** Constant Definitions ******************************/
+
+/* Number of slots of the video mode index, a power of 2 larger than the
+ * number of distinct width, height and frame rate keys. */
+#ifndef XVIDC_VM_INDEX_SLOTS
+#define XVIDC_VM_INDEX_SLOTS		512
+#endif
+
+/* Number of custom video modes held by the index. Larger custom tables are
+ * searched linearly. */
+#ifndef XVIDC_VM_INDEX_MAX_CUSTOM
+#define XVIDC_VM_INDEX_MAX_CUSTOM	64
+#endif
+
+#define XVIDC_VM_INDEX_NONE		0xFFFF
+
+/**************************** Type Definitions ********************************/
+
+/* Hash index of the video timing modes on width, height and frame rate. A
+ * slot holds the first mode of a key, the other modes of the key are chained
+ * in table order, custom modes first. Modes are referenced by their index in
+ * XVidC_VideoTimingModes, or by XVIDC_VM_NUM_SUPPORTED plus their index in
+ * the custom table the index was built with. */
+typedef struct {
+	u16 Slot[XVIDC_VM_INDEX_SLOTS];
+	u16 Next[XVIDC_VM_NUM_SUPPORTED + XVIDC_VM_INDEX_MAX_CUSTOM];
+	const XVidC_VideoTimingMode *CustomTable;
+	u8 HasCustom;
+} XVidC_VmIndex;
+
 /*************************** Variable Declarations ****************************/
 extern const XVidC_VideoTimingMode XVidC_VideoTimingModes[XVIDC_VM_NUM_SUPPORTED];
 
 const XVidC_VideoTimingMode *XVidC_CustomTimingModes = NULL;
 int XVidC_NumCustomModes = 0;
 
+/* The lookups, which may run in an interrupt handler, use the index of one
+ * bank while the other one is built. XVidC_VmIndexPtr is NULL when no index
+ * is built, the tables are searched then. */
+static XVidC_VmIndex XVidC_VmIndexBank[2];
+static XVidC_VmIndex *volatile XVidC_VmIndexPtr = NULL;
+
 /**************************** Function Prototypes *****************************/
 
 static const XVidC_VideoTimingMode *XVidC_GetCustomVideoModeData(
 		XVidC_VideoMode VmId);
 static u8 XVidC_IsVtmRb(const char *VideoModeStr, u8 RbN);
+static XVidC_VmIndex *XVidC_BuildVmIndex(
+		const XVidC_VideoTimingMode *CustomTable, u16 NumCustom);
+static u32 XVidC_AddVmIndex(XVidC_VmIndex *IndexPtr,
+		const XVidC_VideoTimingMode *CustomTable, u16 Ref);
+static u32 XVidC_FindVmIndexSlot(const XVidC_VmIndex *IndexPtr,
+		const XVidC_VideoTimingMode *CustomTable, u32 Width, u32 Height,
+		u32 FrameRate);
+static const XVidC_VideoTimingMode *XVidC_GetVmIndexEntry(
+		const XVidC_VideoTimingMode *CustomTable, u16 Ref);
+static XVidC_VideoMode XVidC_LookupVmIndex(const XVidC_VmIndex *IndexPtr,
+		const XVidC_VideoTiming *Timing, u32 FrameRate, u8 IsInterlaced,
+		u8 IsExtensive);
 
 /*************************** Function Definitions *****************************/
 
@@ -82,12 +135,15 @@ static u8 XVidC_IsVtmRb(const char *VideoModeStr, u8 RbN);
  *		- XST_FAILURE if an existing custom table is already present.
  *
  * @note	IDs in the custom table may not conflict with IDs reserved by
- *		the XVidC_VideoMode enum.
+ *		the XVidC_VideoMode enum. The video mode index is rebuilt with
+ *		the custom table, this function must not be called from an
+ *		interrupt handler.
  *
 *******************************************************************************/
 u32 XVidC_RegisterCustomTimingModes(const XVidC_VideoTimingMode *CustomTable,
 		                            u16 NumElems)
 {
+	XVidC_VmIndex *IndexPtr;
 	u16 Index;
 
 	/* Verify arguments. */
@@ -103,8 +159,15 @@ u32 XVidC_RegisterCustomTimingModes(const XVidC_VideoTimingMode *CustomTable,
 		return XST_FAILURE;
 	}
 
-	XVidC_CustomTimingModes = CustomTable;
+	IndexPtr = XVidC_BuildVmIndex(CustomTable, NumElems);
+
+	/* The table is searched linearly until the index which refers to it
+	 * is in use */
 	XVidC_NumCustomModes    = NumElems;
+	DATA_SYNC;
+	XVidC_CustomTimingModes = CustomTable;
+	DATA_SYNC;
+	XVidC_VmIndexPtr = IndexPtr;
 
 	return XST_SUCCESS;
 }
@@ -116,15 +179,42 @@ u32 XVidC_RegisterCustomTimingModes(const XVidC_VideoTimingMode *CustomTable,
  *
  * @return	None.
  *
- * @note	None.
+ * @note	The video mode index is rebuilt without the custom table, this
+ *		function must not be called from an interrupt handler.
  *
 *******************************************************************************/
 void XVidC_UnregisterCustomTimingModes(void)
 {
+	/* No index refers to the table when it is removed */
+	XVidC_VmIndexPtr = XVidC_BuildVmIndex(NULL, 0);
+	DATA_SYNC;
 	XVidC_CustomTimingModes = NULL;
 	XVidC_NumCustomModes    = 0;
 }
 
+/******************************************************************************/
+/**
+ * This function builds the hash index used by XVidC_GetVideoModeId() and
+ * XVidC_GetVideoModeIdExtensive(). Until it is called, or a custom table is
+ * registered, these functions search the tables.
+ *
+ * @return
+ *		- XST_SUCCESS if the index is built.
+ *		- XST_FAILURE if the index slots cannot hold all the modes, the
+ *		  tables are searched then.
+ *
+ * @note	Call it once at initialization, not from an interrupt handler.
+ *		The lookups are not held while it runs.
+ *
+*******************************************************************************/
+u32 XVidC_InitVideoModeIndex(void)
+{
+	XVidC_VmIndexPtr = XVidC_BuildVmIndex(XVidC_CustomTimingModes,
+					      (u16)XVidC_NumCustomModes);
+
+	return (XVidC_VmIndexPtr != NULL) ? XST_SUCCESS : XST_FAILURE;
+}
+
 /******************************************************************************/
 /**
  * This function calculates pixel clock based on the inputs.
@@ -312,7 +402,8 @@ XVidC_VideoMode XVidC_GetVideoModeIdWBlanking(const XVidC_VideoTiming *Timing,
  *
  * @return	Id of a supported video mode.
  *
- * @note	None.
+ * @note	The modes are looked up in the hash index once built, see
+ *		XVidC_InitVideoModeIndex(). The tables are searched otherwise.
  *
 *******************************************************************************/
 XVidC_VideoMode XVidC_GetVideoModeId(u32 Width, u32 Height, u32 FrameRate,
@@ -326,10 +417,13 @@ XVidC_VideoMode XVidC_GetVideoModeId(u32 Width, u32 Height, u32 FrameRate,
 	u32 Rate;
 	u32 ResFound = (FALSE);
 	XVidC_VideoMode Mode;
+	XVidC_VideoTiming Timing;
+	const XVidC_VmIndex *IndexPtr = XVidC_VmIndexPtr;
 	u16 Index;
 
-	/* First, attempt a linear search on the custom video timing table. */
-	if(XVidC_CustomTimingModes) {
+	/* First, attempt a linear search on the custom video timing table
+	 * when it is not indexed. */
+	if(XVidC_CustomTimingModes && (!IndexPtr || !IndexPtr->HasCustom)) {
 	  for (Index = 0; Index < XVidC_NumCustomModes; Index++) {
 		HActive = XVidC_CustomTimingModes[Index].Timing.HActive;
 		VActive = XVidC_CustomTimingModes[Index].Timing.VActive;
@@ -342,6 +436,13 @@ XVidC_VideoMode XVidC_GetVideoModeId(u32 Width, u32 Height, u32 FrameRate,
 	  }
 	}
 
+	if (IndexPtr != NULL) {
+		Timing.HActive = Width;
+		Timing.VActive = Height;
+		return XVidC_LookupVmIndex(IndexPtr, &Timing, FrameRate,
+					   IsInterlaced, FALSE);
+	}
+
 	if (IsInterlaced) {
 		Low = (XVIDC_VM_INTL_START);
 		High = (XVIDC_VM_INTL_END);
@@ -437,7 +538,8 @@ XVidC_VideoMode XVidC_GetVideoModeId(u32 Width, u32 Height, u32 FrameRate,
  * @return	Id of a supported video mode.
  *
  * @note	This function attempts to search for reduced blanking entries, if
- *          any.
+ *          any. The modes are looked up in the hash index once built, see
+ *          XVidC_InitVideoModeIndex(). The tables are searched otherwise.
  *
 *******************************************************************************/
 XVidC_VideoMode XVidC_GetVideoModeIdExtensive(XVidC_VideoTiming *Timing,
@@ -453,10 +555,12 @@ XVidC_VideoMode XVidC_GetVideoModeIdExtensive(XVidC_VideoTiming *Timing,
 	u32 Rate;
 	u32 ResFound = (FALSE);
 	XVidC_VideoMode Mode;
+	const XVidC_VmIndex *IndexPtr = XVidC_VmIndexPtr;
 	u16 Index;
 
-	/* First, attempt a linear search on the custom video timing table. */
-	if(XVidC_CustomTimingModes) {
+	/* First, attempt a linear search on the custom video timing table
+	 * when it is not indexed. */
+	if(XVidC_CustomTimingModes && (!IndexPtr || !IndexPtr->HasCustom)) {
 	  for (Index = 0; Index < XVidC_NumCustomModes; Index++) {
 		HActive = XVidC_CustomTimingModes[Index].Timing.HActive;
 		VActive = XVidC_CustomTimingModes[Index].Timing.VActive;
@@ -489,6 +593,11 @@ XVidC_VideoMode XVidC_GetVideoModeIdExtensive(XVidC_VideoTiming *Timing,
 	  }
 	}
 
+	if (IndexPtr != NULL) {
+		return XVidC_LookupVmIndex(IndexPtr, Timing, FrameRate,
+					   IsInterlaced, IsExtensive);
+	}
+
 	if (IsInterlaced) {
 		Low = (XVIDC_VM_INTL_START);
 		High = (XVIDC_VM_INTL_END);
@@ -1219,4 +1328,246 @@ static u8 XVidC_IsVtmRb(const char *VideoModeStr, u8 RbN)
 	}
 	return 0;
 }
+/******************************************************************************/
+/**
+ * This function builds the hash index of the video timing modes in the bank
+ * not in use. The custom video timing table is indexed if it holds at most
+ * XVIDC_VM_INDEX_MAX_CUSTOM modes.
+ *
+ * @param	CustomTable is a pointer to the custom video mode timing table,
+ *		NULL if none.
+ * @param	NumCustom is the number of video modes of CustomTable.
+ *
+ * @return	Pointer to the index, or NULL if the slots cannot hold all the
+ *		keys.
+ *
+ * @note	The index is not in use until XVidC_VmIndexPtr is set to it.
+ *
+*******************************************************************************/
+static XVidC_VmIndex *XVidC_BuildVmIndex(
+		const XVidC_VideoTimingMode *CustomTable, u16 NumCustom)
+{
+	XVidC_VmIndex *IndexPtr;
+	u32 Slot;
+	u16 Index;
+
+	IndexPtr = (XVidC_VmIndexPtr == &XVidC_VmIndexBank[0]) ?
+		   &XVidC_VmIndexBank[1] : &XVidC_VmIndexBank[0];
+
+	for (Slot = 0; Slot < XVIDC_VM_INDEX_SLOTS; Slot++) {
+		IndexPtr->Slot[Slot] = XVIDC_VM_INDEX_NONE;
+	}
+	IndexPtr->CustomTable = CustomTable;
+	IndexPtr->HasCustom = FALSE;
+
+	/* Insert in reverse order at the head of the chains, so that each
+	 * chain is in table order with the custom modes first. */
+	for (Index = XVIDC_VM_NUM_SUPPORTED; Index > 0; Index--) {
+		if (XVidC_AddVmIndex(IndexPtr, CustomTable, Index - 1) !=
+		    XST_SUCCESS) {
+			return NULL;
+		}
+	}
+
+	if ((CustomTable != NULL) && (NumCustom <= XVIDC_VM_INDEX_MAX_CUSTOM)) {
+		for (Index = NumCustom; Index > 0; Index--) {
+			if (XVidC_AddVmIndex(IndexPtr, CustomTable,
+					     XVIDC_VM_NUM_SUPPORTED + Index - 1)
+			    != XST_SUCCESS) {
+				return NULL;
+			}
+		}
+		IndexPtr->HasCustom = TRUE;
+	}
+
+	/* The index is complete before it is put in use */
+	DATA_SYNC;
+
+	return IndexPtr;
+}
+
+/******************************************************************************/
+/**
+ * This function inserts a video mode at the head of the chain of its key in
+ * a video mode index.
+ *
+ * @param	IndexPtr is a pointer to the index.
+ * @param	CustomTable is a pointer to the custom video mode timing table.
+ * @param	Ref is the reference of the video mode.
+ *
+ * @return
+ *		- XST_SUCCESS if the video mode is inserted.
+ *		- XST_FAILURE if no slot is empty.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XVidC_AddVmIndex(XVidC_VmIndex *IndexPtr,
+		const XVidC_VideoTimingMode *CustomTable, u16 Ref)
+{
+	const XVidC_VideoTimingMode *VtmPtr;
+	u32 Slot;
+
+	VtmPtr = XVidC_GetVmIndexEntry(CustomTable, Ref);
+	Slot = XVidC_FindVmIndexSlot(IndexPtr, CustomTable,
+			VtmPtr->Timing.HActive, VtmPtr->Timing.VActive,
+			VtmPtr->FrameRate);
+	if (Slot == XVIDC_VM_INDEX_SLOTS) {
+		return XST_FAILURE;
+	}
+
+	IndexPtr->Next[Ref] = IndexPtr->Slot[Slot];
+	IndexPtr->Slot[Slot] = Ref;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function returns the slot of a video mode index holding a key, or
+ * the empty slot where the key is to be inserted.
+ *
+ * @param	IndexPtr is a pointer to the index.
+ * @param	CustomTable is a pointer to the custom video mode timing table.
+ * @param	Width specifies the number pixels per scanline.
+ * @param	Height specifies the number of scanline's.
+ * @param	FrameRate specifies refresh rate in HZ
+ *
+ * @return	Slot number, or XVIDC_VM_INDEX_SLOTS if the key is not found
+ *		and no slot is empty.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XVidC_FindVmIndexSlot(const XVidC_VmIndex *IndexPtr,
+		const XVidC_VideoTimingMode *CustomTable, u32 Width, u32 Height,
+		u32 FrameRate)
+{
+	const XVidC_VideoTimingMode *VtmPtr;
+	u32 Slot;
+	u32 Count;
+
+	Slot = ((Width * 31 + Height) * 31 + FrameRate) * 2654435761U;
+	Slot = (Slot >> 16) & (XVIDC_VM_INDEX_SLOTS - 1);
+
+	for (Count = 0; Count < XVIDC_VM_INDEX_SLOTS; Count++) {
+		if (IndexPtr->Slot[Slot] == XVIDC_VM_INDEX_NONE) {
+			return Slot;
+		}
+		VtmPtr = XVidC_GetVmIndexEntry(CustomTable,
+					       IndexPtr->Slot[Slot]);
+		if ((VtmPtr->Timing.HActive == Width) &&
+		    (VtmPtr->Timing.VActive == Height) &&
+		    ((u32)VtmPtr->FrameRate == FrameRate)) {
+			return Slot;
+		}
+		Slot = (Slot + 1) & (XVIDC_VM_INDEX_SLOTS - 1);
+	}
+
+	return XVIDC_VM_INDEX_SLOTS;
+}
+
+/******************************************************************************/
+/**
+ * This function returns the video mode referenced by a video mode index.
+ *
+ * @param	CustomTable is a pointer to the custom video mode timing table.
+ * @param	Ref is the reference of the video mode.
+ *
+ * @return	Pointer to XVidC_VideoTimingMode structure.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static const XVidC_VideoTimingMode *XVidC_GetVmIndexEntry(
+		const XVidC_VideoTimingMode *CustomTable, u16 Ref)
+{
+	if (Ref < XVIDC_VM_NUM_SUPPORTED) {
+		return &XVidC_VideoTimingModes[Ref];
+	}
+
+	return &CustomTable[Ref - XVIDC_VM_NUM_SUPPORTED];
+}
+
+/******************************************************************************/
+/**
+ * This function looks up the video mode index. The first mode of the chain
+ * matching the interlaced flag, and with IsExtensive set the timing, is
+ * returned. As with the table search, the interlaced flag is not matched for
+ * custom modes.
+ *
+ * @param	IndexPtr is a pointer to the index in use.
+ * @param	Timing is the pointer to timing parameters to match
+ * @param	FrameRate specifies refresh rate in HZ
+ * @param	IsInterlaced is flag.
+ *		      - 0 = Progressive
+ *		      - 1 = Interlaced.
+ * @param	IsExtensive is flag.
+ *		      - 0 = Match active width and height only
+ *		      - 1 = Extensive matching of timing parameters
+ *
+ * @return	Id of a supported video mode.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static XVidC_VideoMode XVidC_LookupVmIndex(const XVidC_VmIndex *IndexPtr,
+		const XVidC_VideoTiming *Timing, u32 FrameRate, u8 IsInterlaced,
+		u8 IsExtensive)
+{
+	const XVidC_VideoTimingMode *VtmPtr;
+	u32 Low;
+	u32 High;
+	u32 Slot;
+	u16 Ref;
+
+	Slot = XVidC_FindVmIndexSlot(IndexPtr, IndexPtr->CustomTable,
+				     Timing->HActive, Timing->VActive, FrameRate);
+	if (Slot == XVIDC_VM_INDEX_SLOTS) {
+		return XVIDC_VM_NOT_SUPPORTED;
+	}
+
+	if (IsInterlaced) {
+		Low = (XVIDC_VM_INTL_START);
+		High = (XVIDC_VM_INTL_END);
+	}
+	else {
+		Low = (XVIDC_VM_PROG_START);
+		High = (XVIDC_VM_PROG_END);
+	}
+
+	for (Ref = IndexPtr->Slot[Slot]; Ref != XVIDC_VM_INDEX_NONE;
+	     Ref = IndexPtr->Next[Ref]) {
+		if ((Ref < XVIDC_VM_NUM_SUPPORTED) &&
+		    ((Ref < Low) || (Ref > High))) {
+			continue;
+		}
+
+		VtmPtr = XVidC_GetVmIndexEntry(IndexPtr->CustomTable, Ref);
+		if (IsExtensive &&
+		    ((VtmPtr->Timing.HTotal != Timing->HTotal) ||
+		     (VtmPtr->Timing.F0PVTotal != Timing->F0PVTotal) ||
+		     (VtmPtr->Timing.HFrontPorch != Timing->HFrontPorch) ||
+		     (VtmPtr->Timing.F0PVFrontPorch != Timing->F0PVFrontPorch) ||
+		     (VtmPtr->Timing.HSyncWidth != Timing->HSyncWidth) ||
+		     (VtmPtr->Timing.F0PVSyncWidth != Timing->F0PVSyncWidth) ||
+		     (VtmPtr->Timing.VSyncPolarity != Timing->VSyncPolarity))) {
+			continue;
+		}
+		if (IsExtensive && IsInterlaced &&
+		    ((VtmPtr->Timing.F1VTotal != Timing->F1VTotal) ||
+		     (VtmPtr->Timing.F1VFrontPorch != Timing->F1VFrontPorch) ||
+		     (VtmPtr->Timing.F1VSyncWidth != Timing->F1VSyncWidth))) {
+			continue;
+		}
+
+		/* The ID of a predefined mode is its index in the table */
+		if (Ref < XVIDC_VM_NUM_SUPPORTED) {
+			return (XVidC_VideoMode)Ref;
+		}
+		return VtmPtr->VmId;
+	}
+
+	return XVIDC_VM_NOT_SUPPORTED;
+}
 /** @} */
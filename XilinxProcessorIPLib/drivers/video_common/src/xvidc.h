@@ -55,6 +55,9 @@
  * 4.6   mmo  02/14/19 Added 5k, 8k, 10k and Low Resolution with 200Hz, 240Hz
  * 4.12  kp   15/07/21 Added new 3planar video formats and video timing modes
          kp   24/08/21 Added new video timing modes related to different VTotal
+ * 4.15  kt   10/18/26 Added polyphase filter designer XVidC_PolyphaseDesign
+ *       kt   10/18/26 Added frame buffer descriptor XVidC_FrameDesc
+ *       kt   10/18/26 Added XVidC_InitVideoModeIndex
  * </pre>
  *
 *******************************************************************************/
@@ -73,6 +76,15 @@ extern "C" {
 
 /************************** Constant Definitions ******************************/
 
+/** @name Polyphase filter design
+ * @{
+ * Coefficients of XVidC_PolyphaseDesign() have XVIDC_POLYPHASE_FRAC_BITS
+ * fractional bits. XVIDC_POLYPHASE_MAX_TAPS is the largest supported filter.
+ */
+#define XVIDC_POLYPHASE_FRAC_BITS	12
+#define XVIDC_POLYPHASE_MAX_TAPS	12
+/* @} */
+
 /**
  * This typedef enumerates the list of available standard display monitor
  * timings as specified in the xvidc_timings_table.c file. The naming format is:
@@ -621,6 +633,19 @@ typedef struct {
 	u32 Height;
 } XVidC_VideoWindow;
 
+/**
+ * Frame buffer descriptor, exchanged with the buffer queues of the frame
+ * buffer drivers.
+ */
+typedef struct {
+	UINTPTR	LumaAddr;	/**< Luma or packed buffer address */
+	UINTPTR	ChromaAddr;	/**< UV or U buffer address, 0 if not used */
+	UINTPTR	VChromaAddr;	/**< V buffer address, 0 if not used */
+	u32	Timestamp;	/**< Time the frame was written or read */
+	u32	Sequence;	/**< Frame number given by the driver */
+	u32	FieldId;	/**< Field of an interlaced frame */
+} XVidC_FrameDesc;
+
 /**
  * Video timing mode from the video timing table.
  */
@@ -650,6 +675,7 @@ typedef void (*XVidC_DelayHandler)(void *TimerPtr, u32 Delay);
 u32 XVidC_RegisterCustomTimingModes(const XVidC_VideoTimingMode *CustomTable,
 		                            u16 NumElems);
 void XVidC_UnregisterCustomTimingModes(void);
+u32 XVidC_InitVideoModeIndex(void);
 u64 XVidC_GetPixelClockHzByHVFr(u32 HTotal, u32 VTotal, u8 FrameRate);
 u64 XVidC_GetPixelClockHzByVmId(XVidC_VideoMode VmId);
 XVidC_VideoFormat XVidC_GetVideoFormat(XVidC_VideoMode VmId);
@@ -679,6 +705,8 @@ XVidC_VideoMode XVidC_GetVideoModeIdRb(u32 Width, u32 Height, u32 FrameRate,
 		                               u8 IsInterlaced, u8 RbN);
 XVidC_VideoMode XVidC_GetVideoModeIdWBlanking(const XVidC_VideoTiming *Timing,
 		                                      u32 FrameRate, u8 IsInterlaced);
+u32 XVidC_PolyphaseDesign(s16 *CoeffPtr, u16 NumPhases, u16 NumTaps,
+			  u32 SizeIn, u32 SizeOut);
 
 /******************* Macros (Inline Functions) Definitions ********************/
 
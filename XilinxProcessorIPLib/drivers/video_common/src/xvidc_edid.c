@@ -27,14 +27,237 @@
  *                     contents now const.
  * 4.0   aad  10/26/16 Added API for colormetry which returns fixed point
  *		       in Q0.10 format instead of float.
+ * 4.15  kt   10/18/26 Added capability table XVidC_EdidCap built in one pass
+ *                     over the base EDID and the CTA-861 extension blocks.
+ *                     Established timings are looked up in a table.
+ *                     Fixed the 800x600@56Hz established timing check.
  * </pre>
  *
 *******************************************************************************/
 
 /******************************* Include Files ********************************/
 
+#include <string.h>
 #include "xvidc_edid.h"
 
+/**************************** Type Definitions ********************************/
+
+/**
+ * Video timing of an established timing bit.
+ */
+typedef struct {
+	u8 Offset;		/**< Offset of the established timings byte. */
+	u8 Mask;		/**< Mask of the bit in the byte. */
+	XVidC_EdidCapTiming Timing;	/**< Video timing. */
+} XVidC_EdidEstTiming;
+
+/*************************** Variable Declarations ****************************/
+extern const XVidC_VideoTimingMode XVidC_VideoTimingModes[XVIDC_VM_NUM_SUPPORTED];
+
+/* Established timings I, II, and manufacturer's timings. */
+static const XVidC_EdidEstTiming XVidC_EdidEstTimings[] = {
+	{XVIDC_EDID_EST_TIMINGS_I, XVIDC_EDID_EST_TIMINGS_I_720x400_70_MASK,
+		{720, 400, XVIDC_FR_70HZ, 0, 0}},
+	{XVIDC_EDID_EST_TIMINGS_I, XVIDC_EDID_EST_TIMINGS_I_720x400_88_MASK,
+		{720, 400, XVIDC_FR_88HZ, 0, 0}},
+	{XVIDC_EDID_EST_TIMINGS_I, XVIDC_EDID_EST_TIMINGS_I_640x480_60_MASK,
+		{640, 480, XVIDC_FR_60HZ, 0, 0}},
+	{XVIDC_EDID_EST_TIMINGS_I, XVIDC_EDID_EST_TIMINGS_I_640x480_67_MASK,
+		{640, 480, XVIDC_FR_67HZ, 0, 0}},
+	{XVIDC_EDID_EST_TIMINGS_I, XVIDC_EDID_EST_TIMINGS_I_640x480_72_MASK,
+		{640, 480, XVIDC_FR_72HZ, 0, 0}},
+	{XVIDC_EDID_EST_TIMINGS_I, XVIDC_EDID_EST_TIMINGS_I_640x480_75_MASK,
+		{640, 480, XVIDC_FR_75HZ, 0, 0}},
+	{XVIDC_EDID_EST_TIMINGS_I, XVIDC_EDID_EST_TIMINGS_I_800x600_56_MASK,
+		{800, 600, XVIDC_FR_56HZ, 0, 0}},
+	{XVIDC_EDID_EST_TIMINGS_I, XVIDC_EDID_EST_TIMINGS_I_800x600_60_MASK,
+		{800, 600, XVIDC_FR_60HZ, 0, 0}},
+	{XVIDC_EDID_EST_TIMINGS_II, XVIDC_EDID_EST_TIMINGS_II_800x600_72_MASK,
+		{800, 600, XVIDC_FR_72HZ, 0, 0}},
+	{XVIDC_EDID_EST_TIMINGS_II, XVIDC_EDID_EST_TIMINGS_II_800x600_75_MASK,
+		{800, 600, XVIDC_FR_75HZ, 0, 0}},
+	{XVIDC_EDID_EST_TIMINGS_II, XVIDC_EDID_EST_TIMINGS_II_832x624_75_MASK,
+		{832, 624, XVIDC_FR_75HZ, 0, 0}},
+	{XVIDC_EDID_EST_TIMINGS_II, XVIDC_EDID_EST_TIMINGS_II_1024x768_87_MASK,
+		{1024, 384, XVIDC_FR_87HZ, 1, 0}},
+	{XVIDC_EDID_EST_TIMINGS_II, XVIDC_EDID_EST_TIMINGS_II_1024x768_60_MASK,
+		{1024, 768, XVIDC_FR_60HZ, 0, 0}},
+	{XVIDC_EDID_EST_TIMINGS_II, XVIDC_EDID_EST_TIMINGS_II_1024x768_70_MASK,
+		{1024, 768, XVIDC_FR_70HZ, 0, 0}},
+	{XVIDC_EDID_EST_TIMINGS_II, XVIDC_EDID_EST_TIMINGS_II_1024x768_75_MASK,
+		{1024, 768, XVIDC_FR_75HZ, 0, 0}},
+	{XVIDC_EDID_EST_TIMINGS_II, XVIDC_EDID_EST_TIMINGS_II_1280x1024_75_MASK,
+		{1280, 1024, XVIDC_FR_75HZ, 0, 0}},
+	{XVIDC_EDID_EST_TIMINGS_MAN, XVIDC_EDID_EST_TIMINGS_MAN_1152x870_75_MASK,
+		{1152, 870, XVIDC_FR_75HZ, 0, 0}},
+};
+
+/* Video timings of the CTA-861 VICs 0 to 127, then 193 to 219. The active
+ * width of the pixel repeated formats is the width before repetition. The
+ * interlaced formats give the active lines of a field. */
+static const struct {
+	u16 HActive;
+	u16 VActive;
+	u8 FrameRate;
+	u8 IsInterlaced;
+} XVidC_EdidCtaVics[] = {
+	{    0,    0,   0, 0 },	/* VIC 0: reserved */
+	{  640,  480,  60, 0 },	/* VIC 1 */
+	{  720,  480,  60, 0 },	/* VIC 2 */
+	{  720,  480,  60, 0 },	/* VIC 3 */
+	{ 1280,  720,  60, 0 },	/* VIC 4 */
+	{ 1920,  540,  60, 1 },	/* VIC 5 */
+	{  720,  240,  60, 1 },	/* VIC 6 */
+	{  720,  240,  60, 1 },	/* VIC 7 */
+	{  720,  240,  60, 0 },	/* VIC 8 */
+	{  720,  240,  60, 0 },	/* VIC 9 */
+	{ 2880,  240,  60, 1 },	/* VIC 10 */
+	{ 2880,  240,  60, 1 },	/* VIC 11 */
+	{ 2880,  240,  60, 0 },	/* VIC 12 */
+	{ 2880,  240,  60, 0 },	/* VIC 13 */
+	{ 1440,  480,  60, 0 },	/* VIC 14 */
+	{ 1440,  480,  60, 0 },	/* VIC 15 */
+	{ 1920, 1080,  60, 0 },	/* VIC 16 */
+	{  720,  576,  50, 0 },	/* VIC 17 */
+	{  720,  576,  50, 0 },	/* VIC 18 */
+	{ 1280,  720,  50, 0 },	/* VIC 19 */
+	{ 1920,  540,  50, 1 },	/* VIC 20 */
+	{  720,  288,  50, 1 },	/* VIC 21 */
+	{  720,  288,  50, 1 },	/* VIC 22 */
+	{  720,  288,  50, 0 },	/* VIC 23 */
+	{  720,  288,  50, 0 },	/* VIC 24 */
+	{ 2880,  288,  50, 1 },	/* VIC 25 */
+	{ 2880,  288,  50, 1 },	/* VIC 26 */
+	{ 2880,  288,  50, 0 },	/* VIC 27 */
+	{ 2880,  288,  50, 0 },	/* VIC 28 */
+	{ 1440,  576,  50, 0 },	/* VIC 29 */
+	{ 1440,  576,  50, 0 },	/* VIC 30 */
+	{ 1920, 1080,  50, 0 },	/* VIC 31 */
+	{ 1920, 1080,  24, 0 },	/* VIC 32 */
+	{ 1920, 1080,  25, 0 },	/* VIC 33 */
+	{ 1920, 1080,  30, 0 },	/* VIC 34 */
+	{ 2880,  480,  60, 0 },	/* VIC 35 */
+	{ 2880,  480,  60, 0 },	/* VIC 36 */
+	{ 2880,  576,  50, 0 },	/* VIC 37 */
+	{ 2880,  576,  50, 0 },	/* VIC 38 */
+	{ 1920,  540,  50, 1 },	/* VIC 39 */
+	{ 1920,  540, 100, 1 },	/* VIC 40 */
+	{ 1280,  720, 100, 0 },	/* VIC 41 */
+	{  720,  576, 100, 0 },	/* VIC 42 */
+	{  720,  576, 100, 0 },	/* VIC 43 */
+	{  720,  288, 100, 1 },	/* VIC 44 */
+	{  720,  288, 100, 1 },	/* VIC 45 */
+	{ 1920,  540, 120, 1 },	/* VIC 46 */
+	{ 1280,  720, 120, 0 },	/* VIC 47 */
+	{  720,  480, 120, 0 },	/* VIC 48 */
+	{  720,  480, 120, 0 },	/* VIC 49 */
+	{  720,  240, 120, 1 },	/* VIC 50 */
+	{  720,  240, 120, 1 },	/* VIC 51 */
+	{  720,  576, 200, 0 },	/* VIC 52 */
+	{  720,  576, 200, 0 },	/* VIC 53 */
+	{  720,  288, 200, 1 },	/* VIC 54 */
+	{  720,  288, 200, 1 },	/* VIC 55 */
+	{  720,  480, 240, 0 },	/* VIC 56 */
+	{  720,  480, 240, 0 },	/* VIC 57 */
+	{  720,  240, 240, 1 },	/* VIC 58 */
+	{  720,  240, 240, 1 },	/* VIC 59 */
+	{ 1280,  720,  24, 0 },	/* VIC 60 */
+	{ 1280,  720,  25, 0 },	/* VIC 61 */
+	{ 1280,  720,  30, 0 },	/* VIC 62 */
+	{ 1920, 1080, 120, 0 },	/* VIC 63 */
+	{ 1920, 1080, 100, 0 },	/* VIC 64 */
+	{ 1280,  720,  24, 0 },	/* VIC 65 */
+	{ 1280,  720,  25, 0 },	/* VIC 66 */
+	{ 1280,  720,  30, 0 },	/* VIC 67 */
+	{ 1280,  720,  50, 0 },	/* VIC 68 */
+	{ 1280,  720,  60, 0 },	/* VIC 69 */
+	{ 1280,  720, 100, 0 },	/* VIC 70 */
+	{ 1280,  720, 120, 0 },	/* VIC 71 */
+	{ 1920, 1080,  24, 0 },	/* VIC 72 */
+	{ 1920, 1080,  25, 0 },	/* VIC 73 */
+	{ 1920, 1080,  30, 0 },	/* VIC 74 */
+	{ 1920, 1080,  50, 0 },	/* VIC 75 */
+	{ 1920, 1080,  60, 0 },	/* VIC 76 */
+	{ 1920, 1080, 100, 0 },	/* VIC 77 */
+	{ 1920, 1080, 120, 0 },	/* VIC 78 */
+	{ 1680,  720,  24, 0 },	/* VIC 79 */
+	{ 1680,  720,  25, 0 },	/* VIC 80 */
+	{ 1680,  720,  30, 0 },	/* VIC 81 */
+	{ 1680,  720,  50, 0 },	/* VIC 82 */
+	{ 1680,  720,  60, 0 },	/* VIC 83 */
+	{ 1680,  720, 100, 0 },	/* VIC 84 */
+	{ 1680,  720, 120, 0 },	/* VIC 85 */
+	{ 2560, 1080,  24, 0 },	/* VIC 86 */
+	{ 2560, 1080,  25, 0 },	/* VIC 87 */
+	{ 2560, 1080,  30, 0 },	/* VIC 88 */
+	{ 2560, 1080,  50, 0 },	/* VIC 89 */
+	{ 2560, 1080,  60, 0 },	/* VIC 90 */
+	{ 2560, 1080, 100, 0 },	/* VIC 91 */
+	{ 2560, 1080, 120, 0 },	/* VIC 92 */
+	{ 3840, 2160,  24, 0 },	/* VIC 93 */
+	{ 3840, 2160,  25, 0 },	/* VIC 94 */
+	{ 3840, 2160,  30, 0 },	/* VIC 95 */
+	{ 3840, 2160,  50, 0 },	/* VIC 96 */
+	{ 3840, 2160,  60, 0 },	/* VIC 97 */
+	{ 4096, 2160,  24, 0 },	/* VIC 98 */
+	{ 4096, 2160,  25, 0 },	/* VIC 99 */
+	{ 4096, 2160,  30, 0 },	/* VIC 100 */
+	{ 4096, 2160,  50, 0 },	/* VIC 101 */
+	{ 4096, 2160,  60, 0 },	/* VIC 102 */
+	{ 3840, 2160,  24, 0 },	/* VIC 103 */
+	{ 3840, 2160,  25, 0 },	/* VIC 104 */
+	{ 3840, 2160,  30, 0 },	/* VIC 105 */
+	{ 3840, 2160,  50, 0 },	/* VIC 106 */
+	{ 3840, 2160,  60, 0 },	/* VIC 107 */
+	{ 1280,  720,  48, 0 },	/* VIC 108 */
+	{ 1280,  720,  48, 0 },	/* VIC 109 */
+	{ 1680,  720,  48, 0 },	/* VIC 110 */
+	{ 1920, 1080,  48, 0 },	/* VIC 111 */
+	{ 1920, 1080,  48, 0 },	/* VIC 112 */
+	{ 2560, 1080,  48, 0 },	/* VIC 113 */
+	{ 3840, 2160,  48, 0 },	/* VIC 114 */
+	{ 4096, 2160,  48, 0 },	/* VIC 115 */
+	{ 3840, 2160,  48, 0 },	/* VIC 116 */
+	{ 3840, 2160, 100, 0 },	/* VIC 117 */
+	{ 3840, 2160, 120, 0 },	/* VIC 118 */
+	{ 3840, 2160, 100, 0 },	/* VIC 119 */
+	{ 3840, 2160, 120, 0 },	/* VIC 120 */
+	{ 5120, 2160,  24, 0 },	/* VIC 121 */
+	{ 5120, 2160,  25, 0 },	/* VIC 122 */
+	{ 5120, 2160,  30, 0 },	/* VIC 123 */
+	{ 5120, 2160,  48, 0 },	/* VIC 124 */
+	{ 5120, 2160,  50, 0 },	/* VIC 125 */
+	{ 5120, 2160,  60, 0 },	/* VIC 126 */
+	{ 5120, 2160, 100, 0 },	/* VIC 127 */
+	{ 5120, 2160, 120, 0 },	/* VIC 193 */
+	{ 7680, 4320,  24, 0 },	/* VIC 194 */
+	{ 7680, 4320,  25, 0 },	/* VIC 195 */
+	{ 7680, 4320,  30, 0 },	/* VIC 196 */
+	{ 7680, 4320,  48, 0 },	/* VIC 197 */
+	{ 7680, 4320,  50, 0 },	/* VIC 198 */
+	{ 7680, 4320,  60, 0 },	/* VIC 199 */
+	{ 7680, 4320, 100, 0 },	/* VIC 200 */
+	{ 7680, 4320, 120, 0 },	/* VIC 201 */
+	{ 7680, 4320,  24, 0 },	/* VIC 202 */
+	{ 7680, 4320,  25, 0 },	/* VIC 203 */
+	{ 7680, 4320,  30, 0 },	/* VIC 204 */
+	{ 7680, 4320,  48, 0 },	/* VIC 205 */
+	{ 7680, 4320,  50, 0 },	/* VIC 206 */
+	{ 7680, 4320,  60, 0 },	/* VIC 207 */
+	{ 7680, 4320, 100, 0 },	/* VIC 208 */
+	{ 7680, 4320, 120, 0 },	/* VIC 209 */
+	{10240, 4320,  24, 0 },	/* VIC 210 */
+	{10240, 4320,  25, 0 },	/* VIC 211 */
+	{10240, 4320,  30, 0 },	/* VIC 212 */
+	{10240, 4320,  48, 0 },	/* VIC 213 */
+	{10240, 4320,  50, 0 },	/* VIC 214 */
+	{10240, 4320,  60, 0 },	/* VIC 215 */
+	{10240, 4320, 100, 0 },	/* VIC 216 */
+	{10240, 4320, 120, 0 },	/* VIC 217 */
+	{ 4096, 2160, 100, 0 },	/* VIC 218 */
+	{ 4096, 2160, 120, 0 },	/* VIC 219 */
+};
+
 /**************************** Function Prototypes *****************************/
 
 static u32 XVidC_EdidIsVideoTimingSupportedPreferredTiming(const u8 *EdidRaw,
@@ -45,6 +268,15 @@ static u32 XVidC_EdidIsVideoTimingSupportedStandardTimings(const u8 *EdidRaw,
 		const XVidC_VideoTimingMode *VtMode);
 static int XVidC_CalculatePower(u8 Base, u8 Power);
 static int XVidC_CalculateBinaryFraction_QFormat(u16 Val, u8 DecPtIndex);
+static u32 XVidC_EdidCapGetDtd(const u8 *Dtd, XVidC_EdidCapTiming *TimingPtr);
+static void XVidC_EdidCapAddTiming(XVidC_EdidCap *CapPtr,
+		const XVidC_EdidCapTiming *TimingPtr);
+static void XVidC_EdidCapAddVic(XVidC_EdidCap *CapPtr, u8 Svd, u8 IsY420);
+static u8 XVidC_EdidCapGetVic(u8 Svd);
+static void XVidC_EdidCapParseCta(XVidC_EdidCap *CapPtr, const u8 *Block);
+static void XVidC_EdidCapParseHf(XVidC_EdidCap *CapPtr, const u8 *Data,
+		u8 Len);
+static u32 XVidC_EdidIsBlockValid(const u8 *Block);
 
 /**************************** Function Definitions ****************************/
 
@@ -410,6 +642,240 @@ u32 XVidC_EdidIsVideoTimingSupported(const u8 *EdidRaw,
 	return Status;
 }
 
+/******************************************************************************/
+/**
+ * Builds the capability table of a sink in a single pass over the supplied
+ * base Extended Display Identification Data (EDID) and its CTA-861 extension
+ * blocks. The preferred timing, the detailed timings, the established timings,
+ * the standard timings, the short video descriptors and the YCbCr 4:2:0 data
+ * blocks are matched against the video timing table once, so that the queries
+ * on the table are bit tests.
+ *
+ * @param	CapPtr is a pointer to the capability table to build.
+ * @param	EdidRaw is the supplied EDID, base block first.
+ * @param	Size is the number of bytes of EdidRaw.
+ *
+ * @return
+ *		- XST_SUCCESS if the table is built.
+ *		- XST_FAILURE if the base EDID is not valid.
+ *
+ * @note	Extension blocks with a wrong checksum, or beyond Size, are
+ *		skipped. The custom video modes are matched at query time
+ *		against the first XVIDC_EDID_CAP_MAX_TIMINGS distinct timings.
+ *
+*******************************************************************************/
+u32 XVidC_EdidCapParse(XVidC_EdidCap *CapPtr, const u8 *EdidRaw, u32 Size)
+{
+	XVidC_EdidCapTiming Timing;
+	const u8 *Block;
+	u8 NumBlocks;
+	u8 Index;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(CapPtr != NULL);
+	Xil_AssertNonvoid(EdidRaw != NULL);
+
+	(void)memset((void *)CapPtr, 0, sizeof(XVidC_EdidCap));
+	CapPtr->PreferredVm = XVIDC_VM_NOT_SUPPORTED;
+	CapPtr->ColorDepth = XVIDC_BPC_UNKNOWN;
+
+	if ((Size < XVIDC_EDID_BLOCK_LEN) || !XVidC_EdidIsHeaderValid(EdidRaw) ||
+			(XVidC_EdidIsBlockValid(EdidRaw) != XST_SUCCESS)) {
+		return XST_FAILURE;
+	}
+
+	CapPtr->ColorDepth = XVidC_EdidGetColorDepth(EdidRaw);
+
+	/* Detailed timings, the first one is the preferred timing. */
+	for (Index = 1; Index <= 4; Index++) {
+		if (XVidC_EdidCapGetDtd(
+				&EdidRaw[XVIDC_EDID_18BYTE_DESCRIPTOR(Index)],
+				&Timing) != XST_SUCCESS) {
+			continue;
+		}
+		if (Index == 1) {
+			CapPtr->PreferredTiming = Timing;
+			CapPtr->PreferredVm = XVidC_GetVideoModeId(
+					Timing.HActive, Timing.VActive,
+					Timing.FrameRate, Timing.IsInterlaced);
+		}
+		XVidC_EdidCapAddTiming(CapPtr, &Timing);
+	}
+
+	/* Established timings I, II, and III. */
+	for (Index = 0; Index < sizeof(XVidC_EdidEstTimings) /
+			sizeof(XVidC_EdidEstTimings[0]); Index++) {
+		if (EdidRaw[XVidC_EdidEstTimings[Index].Offset] &
+				XVidC_EdidEstTimings[Index].Mask) {
+			XVidC_EdidCapAddTiming(CapPtr,
+					&XVidC_EdidEstTimings[Index].Timing);
+		}
+	}
+
+	/* Standard timings, unused entries are 0x0101. */
+	(void)memset((void *)&Timing, 0, sizeof(Timing));
+	for (Index = 1; Index <= 8; Index++) {
+		if ((EdidRaw[XVIDC_EDID_STD_TIMINGS_H(Index)] <= 0x01) &&
+			(EdidRaw[XVIDC_EDID_STD_TIMINGS_AR_FRR(Index)] <= 0x01)) {
+			continue;
+		}
+		Timing.HActive = XVidC_EdidGetStdTimingsH(EdidRaw, Index);
+		Timing.VActive = XVidC_EdidGetStdTimingsV(EdidRaw, Index);
+		Timing.FrameRate = XVidC_EdidGetStdTimingsFrr(EdidRaw, Index);
+		XVidC_EdidCapAddTiming(CapPtr, &Timing);
+	}
+
+	/* CTA-861 extension blocks. */
+	NumBlocks = XVidC_EdidGetExtBlkCount(EdidRaw);
+	for (Index = 1; (Index <= NumBlocks) &&
+			((u32)(Index + 1) * XVIDC_EDID_BLOCK_LEN <= Size); Index++) {
+		Block = &EdidRaw[Index * XVIDC_EDID_BLOCK_LEN];
+		if ((Block[XVIDC_EDID_CTA_TAG] == XVIDC_EDID_CTA_TAG_VALUE) &&
+			(XVidC_EdidIsBlockValid(Block) == XST_SUCCESS)) {
+			XVidC_EdidCapParseCta(CapPtr, Block);
+			CapPtr->NumCtaBlocks++;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether or not a video mode is supported by a sink.
+ *
+ * @param	CapPtr is a pointer to the capability table of the sink.
+ * @param	VmId specifies the video mode to check for support.
+ *
+ * @return
+ *		- XST_SUCCESS if the video mode is supported.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	The video modes of the timing table are checked in constant
+ *		time, the custom video modes against the timings of the sink.
+ *
+*******************************************************************************/
+u32 XVidC_EdidCapIsVmSupported(const XVidC_EdidCap *CapPtr,
+		XVidC_VideoMode VmId)
+{
+	const XVidC_VideoTimingMode *VtMode;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(CapPtr != NULL);
+
+	if (VmId < XVIDC_VM_NUM_SUPPORTED) {
+		return (CapPtr->SuppVm[VmId / 32] & (1U << (VmId % 32))) ?
+			XST_SUCCESS : XST_FAILURE;
+	}
+
+	VtMode = XVidC_GetVideoModeData(VmId);
+	if (!VtMode) {
+		return XST_FAILURE;
+	}
+
+	return XVidC_EdidCapIsVideoTimingSupported(CapPtr, VtMode);
+}
+
+/******************************************************************************/
+/**
+ * Checks whether or not a video timing mode is supported by a sink. The
+ * active width and height, the frame rate and the scan type are matched.
+ *
+ * @param	CapPtr is a pointer to the capability table of the sink.
+ * @param	VtMode is the video timing mode to check for support.
+ *
+ * @return
+ *		- XST_SUCCESS if the video timing mode is supported.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	This is the cached counterpart of
+ *		XVidC_EdidIsVideoTimingSupported(), which also covers the
+ *		detailed timings and the CTA-861 extension blocks.
+ *
+*******************************************************************************/
+u32 XVidC_EdidCapIsVideoTimingSupported(const XVidC_EdidCap *CapPtr,
+		const XVidC_VideoTimingMode *VtMode)
+{
+	const XVidC_EdidCapTiming *TimingPtr;
+	u8 IsInterlaced;
+	u8 Index;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(CapPtr != NULL);
+	Xil_AssertNonvoid(VtMode != NULL);
+
+	if (VtMode == &XVidC_VideoTimingModes[VtMode->VmId]) {
+		return XVidC_EdidCapIsVmSupported(CapPtr, VtMode->VmId);
+	}
+
+	IsInterlaced = (VtMode->Timing.F1VTotal != 0);
+	for (Index = 0; Index < CapPtr->NumTimings; Index++) {
+		TimingPtr = &CapPtr->Timing[Index];
+		if ((VtMode->Timing.HActive == TimingPtr->HActive) &&
+				(VtMode->Timing.VActive == TimingPtr->VActive) &&
+				(VtMode->FrameRate == TimingPtr->FrameRate) &&
+				(IsInterlaced == TimingPtr->IsInterlaced)) {
+			return XST_SUCCESS;
+		}
+	}
+
+	return XST_FAILURE;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether or not a video mode of the timing table is supported by a
+ * sink in YCbCr 4:2:0.
+ *
+ * @param	CapPtr is a pointer to the capability table of the sink.
+ * @param	VmId specifies the video mode to check for support.
+ *
+ * @return
+ *		- XST_SUCCESS if the video mode is supported in YCbCr 4:2:0.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XVidC_EdidCapIsY420Supported(const XVidC_EdidCap *CapPtr,
+		XVidC_VideoMode VmId)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(CapPtr != NULL);
+
+	if (VmId >= XVIDC_VM_NUM_SUPPORTED) {
+		return XST_FAILURE;
+	}
+
+	return (CapPtr->Y420Vm[VmId / 32] & (1U << (VmId % 32))) ?
+		XST_SUCCESS : XST_FAILURE;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether or not a CTA-861 video identification code (VIC) is listed
+ * by a sink.
+ *
+ * @param	CapPtr is a pointer to the capability table of the sink.
+ * @param	Vic is the video identification code.
+ *
+ * @return
+ *		- XST_SUCCESS if the VIC is listed in a video data block or in
+ *		  a YCbCr 4:2:0 video data block.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XVidC_EdidCapIsVicSupported(const XVidC_EdidCap *CapPtr, u8 Vic)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(CapPtr != NULL);
+
+	return (CapPtr->SuppVic[Vic / 32] & (1U << (Vic % 32))) ?
+		XST_SUCCESS : XST_FAILURE;
+}
+
 /******************************************************************************/
 /**
  * Checks whether or not a specified video timing mode is the preferred timing
@@ -474,113 +940,26 @@ static u32 XVidC_EdidIsVideoTimingSupportedPreferredTiming(const u8 *EdidRaw,
 static u32 XVidC_EdidIsVideoTimingSupportedEstablishedTimings(const u8 *EdidRaw,
 		const XVidC_VideoTimingMode *VtMode)
 {
-	u32 Status = XST_FAILURE;
+	const XVidC_EdidCapTiming *TimingPtr;
+	u8 Index;
 
-	/* Check established timings I, II, and III. */
-	if ((VtMode->Timing.HActive == 800) &&
-			(VtMode->Timing.VActive == 640) &&
-			(VtMode->FrameRate == XVIDC_FR_56HZ) &&
-			XVidC_EdidSuppEstTimings800x600_56(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 640) &&
-			(VtMode->Timing.VActive == 480) &&
-			(VtMode->FrameRate == XVIDC_FR_60HZ) &&
-			XVidC_EdidSuppEstTimings640x480_60(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 800) &&
-			(VtMode->Timing.VActive == 600) &&
-			(VtMode->FrameRate == XVIDC_FR_60HZ) &&
-			XVidC_EdidSuppEstTimings800x600_60(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 1024) &&
-			(VtMode->Timing.VActive == 768) &&
-			(VtMode->FrameRate == XVIDC_FR_60HZ) &&
-			XVidC_EdidSuppEstTimings1024x768_60(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 640) &&
-			(VtMode->Timing.VActive == 480) &&
-			(VtMode->FrameRate == XVIDC_FR_67HZ) &&
-			XVidC_EdidSuppEstTimings640x480_67(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 720) &&
-			(VtMode->Timing.VActive == 400) &&
-			(VtMode->FrameRate == XVIDC_FR_70HZ) &&
-			XVidC_EdidSuppEstTimings720x400_70(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 1024) &&
-			(VtMode->Timing.VActive == 768) &&
-			(VtMode->FrameRate == XVIDC_FR_70HZ) &&
-			XVidC_EdidSuppEstTimings1024x768_70(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 640) &&
-			(VtMode->Timing.VActive == 480) &&
-			(VtMode->FrameRate == XVIDC_FR_72HZ) &&
-			XVidC_EdidSuppEstTimings640x480_72(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 800) &&
-			(VtMode->Timing.VActive == 600) &&
-			(VtMode->FrameRate == XVIDC_FR_72HZ) &&
-			XVidC_EdidSuppEstTimings800x600_72(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 640) &&
-			(VtMode->Timing.VActive == 480) &&
-			(VtMode->FrameRate == XVIDC_FR_75HZ) &&
-			XVidC_EdidSuppEstTimings640x480_75(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 800) &&
-			(VtMode->Timing.VActive == 600) &&
-			(VtMode->FrameRate == XVIDC_FR_75HZ) &&
-			XVidC_EdidSuppEstTimings800x600_75(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 832) &&
-			(VtMode->Timing.VActive == 624) &&
-			(VtMode->FrameRate == XVIDC_FR_75HZ) &&
-			XVidC_EdidSuppEstTimings832x624_75(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 1024) &&
-			(VtMode->Timing.VActive == 768) &&
-			(VtMode->FrameRate == XVIDC_FR_75HZ) &&
-			XVidC_EdidSuppEstTimings1024x768_75(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 1152) &&
-			(VtMode->Timing.VActive == 870) &&
-			(VtMode->FrameRate == XVIDC_FR_75HZ) &&
-			XVidC_EdidSuppEstTimings1152x870_75(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 1280) &&
-			(VtMode->Timing.VActive == 1024) &&
-			(VtMode->FrameRate == XVIDC_FR_75HZ) &&
-			XVidC_EdidSuppEstTimings1280x1024_75(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 1024) &&
-			(VtMode->Timing.VActive == 768) &&
-			(VtMode->FrameRate == XVIDC_FR_87HZ) &&
-			XVidC_EdidSuppEstTimings1024x768_87(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 720) &&
-			(VtMode->Timing.VActive == 400) &&
-			(VtMode->FrameRate == XVIDC_FR_88HZ) &&
-			XVidC_EdidSuppEstTimings720x400_88(EdidRaw)) {
-		Status = XST_SUCCESS;
+	/* Check established timings I, II, and III. The table gives the
+	 * lines of a field, 1024x768@87Hz interlaced is matched on the 768
+	 * lines of the frame as before. */
+	for (Index = 0; Index < sizeof(XVidC_EdidEstTimings) /
+			sizeof(XVidC_EdidEstTimings[0]); Index++) {
+		TimingPtr = &XVidC_EdidEstTimings[Index].Timing;
+		if ((VtMode->Timing.HActive == TimingPtr->HActive) &&
+				(VtMode->Timing.VActive ==
+				 (TimingPtr->VActive << TimingPtr->IsInterlaced)) &&
+				(VtMode->FrameRate == TimingPtr->FrameRate) &&
+				(EdidRaw[XVidC_EdidEstTimings[Index].Offset] &
+				 XVidC_EdidEstTimings[Index].Mask)) {
+			return XST_SUCCESS;
+		}
 	}
 
-	return Status;
+	return XST_FAILURE;
 }
 
 /******************************************************************************/
@@ -679,4 +1058,382 @@ static int XVidC_CalculateBinaryFraction_QFormat(u16 Val, u8 DecPtIndex)
 
 	return Res;
 }
+
+/******************************************************************************/
+/**
+ * Gets the video timing of a detailed timing descriptor (DTD).
+ *
+ * @param	Dtd is a pointer to the 18 byte descriptor.
+ * @param	TimingPtr is a pointer to the video timing to fill.
+ *
+ * @return
+ *		- XST_SUCCESS if the descriptor is a detailed timing.
+ *		- XST_FAILURE if it is a display descriptor.
+ *
+ * @note	The frame rate is rounded to the nearest Hz, so that the 1/1.001
+ *		rates match the video timing table.
+ *
+*******************************************************************************/
+static u32 XVidC_EdidCapGetDtd(const u8 *Dtd, XVidC_EdidCapTiming *TimingPtr)
+{
+	u64 PixClkHz;
+	u32 HBlank;
+	u32 VBlank;
+	u32 Total;
+
+	PixClkHz = (u64)((Dtd[XVIDC_EDID_DTD_PTM_PIXEL_CLK_KHZ_MSB] << 8) |
+			Dtd[XVIDC_EDID_DTD_PTM_PIXEL_CLK_KHZ_LSB]) * 10000;
+	if (PixClkHz == 0) {
+		return XST_FAILURE;
+	}
+
+	TimingPtr->HActive = (((Dtd[XVIDC_EDID_DTD_PTM_HRES_HBLANK_U4] &
+			XVIDC_EDID_DTD_PTM_XRES_XBLANK_U4_XRES_MASK) >>
+			XVIDC_EDID_DTD_PTM_XRES_XBLANK_U4_XRES_SHIFT) << 8) |
+			Dtd[XVIDC_EDID_DTD_PTM_HRES_LSB];
+	HBlank = ((Dtd[XVIDC_EDID_DTD_PTM_HRES_HBLANK_U4] &
+			XVIDC_EDID_DTD_PTM_XRES_XBLANK_U4_XBLANK_MASK) << 8) |
+			Dtd[XVIDC_EDID_DTD_PTM_HBLANK_LSB];
+	TimingPtr->VActive = (((Dtd[XVIDC_EDID_DTD_PTM_VRES_VBLANK_U4] &
+			XVIDC_EDID_DTD_PTM_XRES_XBLANK_U4_XRES_MASK) >>
+			XVIDC_EDID_DTD_PTM_XRES_XBLANK_U4_XRES_SHIFT) << 8) |
+			Dtd[XVIDC_EDID_DTD_PTM_VRES_LSB];
+	VBlank = ((Dtd[XVIDC_EDID_DTD_PTM_VRES_VBLANK_U4] &
+			XVIDC_EDID_DTD_PTM_XRES_XBLANK_U4_XBLANK_MASK) << 8) |
+			Dtd[XVIDC_EDID_DTD_PTM_VBLANK_LSB];
+	TimingPtr->IsInterlaced = (Dtd[XVIDC_EDID_DTD_PTM_SIGNAL] &
+			XVIDC_EDID_DTD_PTM_SIGNAL_INTERLACED_MASK) >>
+			XVIDC_EDID_DTD_PTM_SIGNAL_INTERLACED_SHIFT;
+	TimingPtr->IsY420 = 0;
+
+	/* The vertical fields of an interlaced timing are those of a field. */
+	Total = (TimingPtr->HActive + HBlank) * (TimingPtr->VActive + VBlank);
+	if (Total == 0) {
+		return XST_FAILURE;
+	}
+	TimingPtr->FrameRate = (u8)((PixClkHz + Total / 2) / Total);
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * Adds a video timing of a sink to the capability table. The video modes of
+ * the timing table with the same active width and height, frame rate and
+ * scan type are marked as supported.
+ *
+ * @param	CapPtr is a pointer to the capability table.
+ * @param	TimingPtr is a pointer to the video timing.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XVidC_EdidCapAddTiming(XVidC_EdidCap *CapPtr,
+		const XVidC_EdidCapTiming *TimingPtr)
+{
+	const XVidC_VideoTimingMode *VtMode;
+	XVidC_EdidCapTiming *ListPtr;
+	u32 VmId;
+	u8 Index;
+
+	for (VmId = 0; VmId < XVIDC_VM_NUM_SUPPORTED; VmId++) {
+		VtMode = &XVidC_VideoTimingModes[VmId];
+		if ((VtMode->Timing.HActive == TimingPtr->HActive) &&
+				(VtMode->Timing.VActive == TimingPtr->VActive) &&
+				(VtMode->FrameRate == TimingPtr->FrameRate) &&
+				((VtMode->Timing.F1VTotal != 0) ==
+				 TimingPtr->IsInterlaced)) {
+			CapPtr->SuppVm[VmId / 32] |= 1U << (VmId % 32);
+			if (TimingPtr->IsY420) {
+				CapPtr->Y420Vm[VmId / 32] |= 1U << (VmId % 32);
+			}
+		}
+	}
+
+	/* Keep the distinct timings for the custom video modes. */
+	for (Index = 0; Index < CapPtr->NumTimings; Index++) {
+		ListPtr = &CapPtr->Timing[Index];
+		if ((ListPtr->HActive == TimingPtr->HActive) &&
+				(ListPtr->VActive == TimingPtr->VActive) &&
+				(ListPtr->FrameRate == TimingPtr->FrameRate) &&
+				(ListPtr->IsInterlaced == TimingPtr->IsInterlaced)) {
+			ListPtr->IsY420 |= TimingPtr->IsY420;
+			return;
+		}
+	}
+	if (CapPtr->NumTimings < XVIDC_EDID_CAP_MAX_TIMINGS) {
+		CapPtr->Timing[CapPtr->NumTimings++] = *TimingPtr;
+	}
+}
+
+/******************************************************************************/
+/**
+ * Adds the video timing of a short video descriptor (SVD) to the capability
+ * table.
+ *
+ * @param	CapPtr is a pointer to the capability table.
+ * @param	Svd is the short video descriptor.
+ * @param	IsY420 specifies whether the timing is supported in YCbCr 4:2:0.
+ *
+ * @return	None.
+ *
+ * @note	Reserved and unknown VICs are ignored.
+ *
+*******************************************************************************/
+static void XVidC_EdidCapAddVic(XVidC_EdidCap *CapPtr, u8 Svd, u8 IsY420)
+{
+	XVidC_EdidCapTiming Timing;
+	u8 Vic;
+	u8 Index;
+
+	Vic = XVidC_EdidCapGetVic(Svd);
+	if ((Vic == 0) || (Vic > 219) || ((Vic > 127) && (Vic < 193))) {
+		return;
+	}
+
+	Index = (Vic <= 127) ? Vic : (Vic - 193 + 128);
+	if (XVidC_EdidCtaVics[Index].HActive == 0) {
+		return;
+	}
+
+	CapPtr->SuppVic[Vic / 32] |= 1U << (Vic % 32);
+
+	Timing.HActive = XVidC_EdidCtaVics[Index].HActive;
+	Timing.VActive = XVidC_EdidCtaVics[Index].VActive;
+	Timing.FrameRate = XVidC_EdidCtaVics[Index].FrameRate;
+	Timing.IsInterlaced = XVidC_EdidCtaVics[Index].IsInterlaced;
+	Timing.IsY420 = IsY420;
+	XVidC_EdidCapAddTiming(CapPtr, &Timing);
+}
+
+/******************************************************************************/
+/**
+ * Gets the video identification code (VIC) of a short video descriptor.
+ *
+ * @param	Svd is the short video descriptor.
+ *
+ * @return	The VIC, or 0 if the descriptor is reserved.
+ *
+ * @note	SVDs 129 to 192 are VICs 1 to 64 with the native bit set.
+ *
+*******************************************************************************/
+static u8 XVidC_EdidCapGetVic(u8 Svd)
+{
+	if ((Svd >= 129) && (Svd <= 192)) {
+		return Svd & 0x7F;
+	}
+	if ((Svd == 128) || (Svd >= 254)) {
+		return 0;
+	}
+
+	return Svd;
+}
+
+/******************************************************************************/
+/**
+ * Parses a CTA-861 extension block into the capability table.
+ *
+ * @param	CapPtr is a pointer to the capability table.
+ * @param	Block is a pointer to the 128 byte extension block.
+ *
+ * @return	None.
+ *
+ * @note	The YCbCr 4:2:0 capability map refers to the short video
+ *		descriptors of the same block, in order.
+ *
+*******************************************************************************/
+static void XVidC_EdidCapParseCta(XVidC_EdidCap *CapPtr, const u8 *Block)
+{
+	XVidC_EdidCapTiming Timing;
+	const u8 *Data;
+	const u8 *CapMap = NULL;
+	u8 Svds[XVIDC_EDID_BLOCK_LEN];
+	u8 NumSvds = 0;
+	u8 CapMapLen = 0;
+	u8 DtdOffset;
+	u8 Offset;
+	u8 Tag;
+	u8 Len;
+	u8 Index;
+	u32 Oui;
+
+	DtdOffset = Block[XVIDC_EDID_CTA_DTD_OFFSET];
+	if ((DtdOffset < XVIDC_EDID_CTA_DATA_BLOCKS) ||
+			(DtdOffset >= XVIDC_EDID_BLOCK_LEN)) {
+		DtdOffset = XVIDC_EDID_CTA_DATA_BLOCKS;
+	}
+
+	if (Block[XVIDC_EDID_CTA_REV] >= 2) {
+		if (Block[XVIDC_EDID_CTA_FEATURES] &
+				XVIDC_EDID_CTA_FEATURES_YCBCR444_MASK) {
+			CapPtr->IsYCbCr444Supp = 1;
+		}
+		if (Block[XVIDC_EDID_CTA_FEATURES] &
+				XVIDC_EDID_CTA_FEATURES_YCBCR422_MASK) {
+			CapPtr->IsYCbCr422Supp = 1;
+		}
+	}
+
+	/* Data block collection. */
+	for (Offset = XVIDC_EDID_CTA_DATA_BLOCKS; Offset < DtdOffset;
+			Offset += Len + 1) {
+		Tag = Block[Offset] >> XVIDC_EDID_CTA_DB_TAG_SHIFT;
+		Len = Block[Offset] & XVIDC_EDID_CTA_DB_LEN_MASK;
+		if (Offset + 1 + Len > DtdOffset) {
+			break;
+		}
+		Data = &Block[Offset + 1];
+
+		switch (Tag) {
+		case XVIDC_EDID_CTA_DB_TAG_VIDEO:
+			for (Index = 0; Index < Len; Index++) {
+				Svds[NumSvds++] = Data[Index];
+				XVidC_EdidCapAddVic(CapPtr, Data[Index], 0);
+			}
+			break;
+
+		case XVIDC_EDID_CTA_DB_TAG_VENDOR:
+			if (Len < 3) {
+				break;
+			}
+			Oui = Data[0] | (Data[1] << 8) | (Data[2] << 16);
+			if (Oui == XVIDC_EDID_CTA_OUI_HDMI) {
+				CapPtr->IsHdmi = 1;
+				if (Len >= 6) {
+					CapPtr->DeepColor |= (Data[5] >> 4) &
+						(XVIDC_EDID_CAP_DC_30BPP |
+						 XVIDC_EDID_CAP_DC_36BPP |
+						 XVIDC_EDID_CAP_DC_48BPP);
+					if (Data[5] & (0x1 << 3)) {
+						CapPtr->DeepColor |=
+							XVIDC_EDID_CAP_DC_Y444;
+					}
+				}
+				if ((Len >= 7) &&
+					(Data[6] * 5 > CapPtr->MaxTmdsMhz)) {
+					CapPtr->MaxTmdsMhz = Data[6] * 5;
+				}
+			} else if (Oui == XVIDC_EDID_CTA_OUI_HDMI_FORUM) {
+				XVidC_EdidCapParseHf(CapPtr, &Data[3],
+						Len - 3);
+			}
+			break;
+
+		case XVIDC_EDID_CTA_DB_TAG_EXTENDED:
+			if (Len < 1) {
+				break;
+			}
+			switch (Data[0]) {
+			case XVIDC_EDID_CTA_EXT_TAG_YCBCR420_VIDEO:
+				CapPtr->IsYCbCr420Supp = 1;
+				for (Index = 1; Index < Len; Index++) {
+					XVidC_EdidCapAddVic(CapPtr,
+							Data[Index], 1);
+				}
+				break;
+
+			case XVIDC_EDID_CTA_EXT_TAG_YCBCR420_CAP_MAP:
+				CapPtr->IsYCbCr420Supp = 1;
+				CapMap = &Data[1];
+				CapMapLen = Len - 1;
+				break;
+
+			case XVIDC_EDID_CTA_EXT_TAG_HF_SINK_CAP:
+				/* Same layout as the HDMI Forum VSDB, with
+				 * the OUI replaced by the extended tag and
+				 * 2 reserved bytes. */
+				if (Len >= 3) {
+					XVidC_EdidCapParseHf(CapPtr, &Data[3],
+							Len - 3);
+				}
+				break;
+
+			default:
+				break;
+			}
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	/* An empty capability map means all the SVDs support 4:2:0. */
+	if (CapMap) {
+		for (Index = 0; Index < NumSvds; Index++) {
+			if ((CapMapLen == 0) || ((Index / 8 < CapMapLen) &&
+				(CapMap[Index / 8] & (1 << (Index % 8))))) {
+				XVidC_EdidCapAddVic(CapPtr, Svds[Index], 1);
+			}
+		}
+	}
+
+	/* Detailed timings. */
+	for (Offset = DtdOffset; Offset + XVIDC_EDID_DTD_LEN <
+			XVIDC_EDID_BLOCK_LEN; Offset += XVIDC_EDID_DTD_LEN) {
+		if (XVidC_EdidCapGetDtd(&Block[Offset], &Timing) !=
+				XST_SUCCESS) {
+			break;
+		}
+		XVidC_EdidCapAddTiming(CapPtr, &Timing);
+	}
+}
+
+/******************************************************************************/
+/**
+ * Parses the payload of an HDMI Forum vendor specific data block or sink
+ * capability data block into the capability table.
+ *
+ * @param	CapPtr is a pointer to the capability table.
+ * @param	Data is a pointer to the payload, starting at the version.
+ * @param	Len is the number of bytes of the payload.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XVidC_EdidCapParseHf(XVidC_EdidCap *CapPtr, const u8 *Data,
+		u8 Len)
+{
+	if ((Len >= 2) && (Data[1] * 5 > CapPtr->MaxTmdsMhz)) {
+		CapPtr->MaxTmdsMhz = Data[1] * 5;
+	}
+	if (Len >= 3) {
+		CapPtr->IsScdcPresent = (Data[2] >> 7) & 0x1;
+	}
+	if (Len >= 4) {
+		CapPtr->Y420DeepColor = Data[3] &
+			(XVIDC_EDID_CAP_DC_30BPP | XVIDC_EDID_CAP_DC_36BPP |
+			 XVIDC_EDID_CAP_DC_48BPP);
+		CapPtr->MaxFrlRate = Data[3] >> 4;
+	}
+}
+
+/******************************************************************************/
+/**
+ * Checks the checksum of a 128 byte EDID block.
+ *
+ * @param	Block is a pointer to the block.
+ *
+ * @return
+ *		- XST_SUCCESS if the bytes of the block sum to 0.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XVidC_EdidIsBlockValid(const u8 *Block)
+{
+	u8 Sum = 0;
+	u8 Index;
+
+	for (Index = 0; Index < XVIDC_EDID_BLOCK_LEN; Index++) {
+		Sum += Block[Index];
+	}
+
+	return (Sum == 0) ? XST_SUCCESS : XST_FAILURE;
+}
 /** @} */
@@ -28,6 +28,8 @@
  *                     contents now const.
  * 4.0   aad  10/26/16 Functions which return fixed point values instead of
  *		       float
+ * 4.15  kt   10/18/26 Added capability table XVidC_EdidCap built in one pass
+ *                     over the base EDID and the CTA-861 extension blocks
  * </pre>
  *
 *******************************************************************************/
@@ -243,6 +245,94 @@ extern "C" {
 #define XVIDC_EDID_DTD_PTM_SIGNAL_VPOLARITY_SHIFT		2
 /* @} */
 
+/******************************************************************************/
+
+/** @name CTA-861 extension block: Address mapping, masks, and values.
+ * @{
+ */
+#define XVIDC_EDID_BLOCK_LEN				128
+#define XVIDC_EDID_DTD_LEN				18
+#define XVIDC_EDID_CTA_TAG				0x00
+#define XVIDC_EDID_CTA_REV				0x01
+#define XVIDC_EDID_CTA_DTD_OFFSET			0x02
+#define XVIDC_EDID_CTA_FEATURES				0x03
+#define XVIDC_EDID_CTA_DATA_BLOCKS			0x04
+#define XVIDC_EDID_CTA_TAG_VALUE			0x02
+#define XVIDC_EDID_CTA_FEATURES_YCBCR444_MASK		(0x1 << 5)
+#define XVIDC_EDID_CTA_FEATURES_YCBCR422_MASK		(0x1 << 4)
+/* Data block header. */
+#define XVIDC_EDID_CTA_DB_TAG_SHIFT			5
+#define XVIDC_EDID_CTA_DB_LEN_MASK			0x1F
+#define XVIDC_EDID_CTA_DB_TAG_VIDEO			0x2
+#define XVIDC_EDID_CTA_DB_TAG_VENDOR			0x3
+#define XVIDC_EDID_CTA_DB_TAG_EXTENDED			0x7
+#define XVIDC_EDID_CTA_EXT_TAG_YCBCR420_VIDEO		14
+#define XVIDC_EDID_CTA_EXT_TAG_YCBCR420_CAP_MAP		15
+#define XVIDC_EDID_CTA_EXT_TAG_HF_SINK_CAP		0x79
+/* IEEE OUIs of the vendor specific data blocks. */
+#define XVIDC_EDID_CTA_OUI_HDMI				0x000C03
+#define XVIDC_EDID_CTA_OUI_HDMI_FORUM			0xC45DD8
+/* @} */
+
+/** @name Capability table: Limits and flags.
+ * @{
+ */
+#define XVIDC_EDID_CAP_MAX_TIMINGS			64
+#define XVIDC_EDID_CAP_DC_30BPP				(0x1 << 0)
+#define XVIDC_EDID_CAP_DC_36BPP				(0x1 << 1)
+#define XVIDC_EDID_CAP_DC_48BPP				(0x1 << 2)
+#define XVIDC_EDID_CAP_DC_Y444				(0x1 << 3)
+/* @} */
+
+/**************************** Type Definitions ********************************/
+
+/**
+ * Video timing declared by a sink, as found in its EDID.
+ */
+typedef struct {
+	u16 HActive;		/**< Active pixels per line. */
+	u16 VActive;		/**< Active lines, per field if interlaced. */
+	u8 FrameRate;		/**< Frame or field rate in Hz. */
+	u8 IsInterlaced;	/**< Interlaced timing. */
+	u8 IsY420;		/**< Timing supported in YCbCr 4:2:0. */
+} XVidC_EdidCapTiming;
+
+/**
+ * Capabilities of a sink, built by XVidC_EdidCapParse() in a single pass over
+ * the base EDID and its CTA-861 extension blocks. Video mode queries are bit
+ * tests.
+ */
+typedef struct {
+	u32 SuppVm[(XVIDC_VM_NUM_SUPPORTED + 31) / 32];
+				/**< Video modes of the timing table supported
+				  *  by the sink, one bit per XVidC_VideoMode. */
+	u32 Y420Vm[(XVIDC_VM_NUM_SUPPORTED + 31) / 32];
+				/**< Video modes supported in YCbCr 4:2:0. */
+	u32 SuppVic[8];		/**< CTA-861 VICs listed by the sink, one bit
+				  *  per VIC. */
+	XVidC_EdidCapTiming Timing[XVIDC_EDID_CAP_MAX_TIMINGS];
+				/**< Distinct timings declared by the sink, used
+				  *  for the custom video modes. */
+	u8 NumTimings;		/**< Number of timings held in Timing. */
+	XVidC_EdidCapTiming PreferredTiming;
+				/**< First detailed timing of the base EDID. */
+	XVidC_VideoMode PreferredVm;
+				/**< Video mode of the preferred timing, or
+				  *  XVIDC_VM_NOT_SUPPORTED. */
+	XVidC_ColorDepth ColorDepth;
+				/**< Color depth of the base EDID. */
+	u8 NumCtaBlocks;	/**< Number of CTA-861 blocks parsed. */
+	u8 IsHdmi;		/**< HDMI vendor specific data block found. */
+	u8 IsYCbCr444Supp;	/**< YCbCr 4:4:4 supported. */
+	u8 IsYCbCr422Supp;	/**< YCbCr 4:2:2 supported. */
+	u8 IsYCbCr420Supp;	/**< YCbCr 4:2:0 supported for some modes. */
+	u8 DeepColor;		/**< XVIDC_EDID_CAP_DC_* flags. */
+	u8 Y420DeepColor;	/**< XVIDC_EDID_CAP_DC_* flags for 4:2:0. */
+	u8 IsScdcPresent;	/**< SCDC present, from the HDMI Forum block. */
+	u8 MaxFrlRate;		/**< Max FRL rate, from the HDMI Forum block. */
+	u16 MaxTmdsMhz;		/**< Max TMDS character rate in MHz. */
+} XVidC_EdidCap;
+
 /******************* Macros (Inline Functions) Definitions ********************/
 
 #define XVidC_EdidIsHeaderValid(E) \
@@ -452,6 +542,16 @@ u16 XVidC_EdidGetStdTimingsV(const u8 *EdidRaw, u8 StdTimingsNum);
 u32 XVidC_EdidIsVideoTimingSupported(const u8 *EdidRaw,
 		const XVidC_VideoTimingMode *VtMode);
 
+/* Capability table. */
+u32 XVidC_EdidCapParse(XVidC_EdidCap *CapPtr, const u8 *EdidRaw, u32 Size);
+u32 XVidC_EdidCapIsVmSupported(const XVidC_EdidCap *CapPtr,
+		XVidC_VideoMode VmId);
+u32 XVidC_EdidCapIsVideoTimingSupported(const XVidC_EdidCap *CapPtr,
+		const XVidC_VideoTimingMode *VtMode);
+u32 XVidC_EdidCapIsY420Supported(const XVidC_EdidCap *CapPtr,
+		XVidC_VideoMode VmId);
+u32 XVidC_EdidCapIsVicSupported(const XVidC_EdidCap *CapPtr, u8 Vic);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,234 @@
+/*******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_polyphase.c
+ * @addtogroup video_common Overview
+ * @{
+ *
+ * Contains the polyphase filter designer shared by the video scaler drivers.
+ * The coefficients of a windowed sinc (Lanczos) filter are computed for the
+ * exact scaling ratio, number of phases and number of taps, using fixed point
+ * arithmetic only. The designs are compared with the fixed tables of the
+ * H Scaler driver by examples/xvidc_polyphase_model_test.c.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.15  kt   10/18/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include "xil_assert.h"
+#include "xstatus.h"
+#include "xvidc.h"
+
+/************************** Constant Definitions ******************************/
+
+/*
+ * Tap positions are in input samples with 16 fractional bits, the filter
+ * response is computed with 28 fractional bits.
+ */
+#define XVIDC_POLYPHASE_POS_SHIFT	16
+#define XVIDC_POLYPHASE_ONE		((s64)1 << 28)
+#define XVIDC_POLYPHASE_PI		((s64)843314857) /* pi, 28 frac bits */
+
+/**************************** Function Prototypes *****************************/
+
+static s64 XVidC_PolyphaseSinPi(s32 Pos);
+static s64 XVidC_PolyphaseSinc(s32 Pos);
+
+/**************************** Function Definitions ****************************/
+
+/******************************************************************************/
+/**
+ * This function designs the coefficients of a polyphase scaling filter. The
+ * filter is a sinc low pass, with its cutoff at the output Nyquist frequency
+ * when scaling down, windowed by a Lanczos window spanning all the taps.
+ *
+ * The coefficients are stored phase after phase, NumTaps per phase, as
+ * expected by the LoadExtCoeff functions of the scaler drivers. Phase 0 is
+ * centered on tap (NumTaps / 2 - 1). The coefficients of a phase have
+ * XVIDC_POLYPHASE_FRAC_BITS fractional bits and sum to exactly 1.0.
+ *
+ * @param	CoeffPtr is the array of NumPhases * NumTaps coefficients to
+ *		be written.
+ * @param	NumPhases is the number of phases of the filter.
+ * @param	NumTaps is the number of taps of the filter. It must be even
+ *		and at most XVIDC_POLYPHASE_MAX_TAPS.
+ * @param	SizeIn is the input width or height.
+ * @param	SizeOut is the output width or height.
+ *
+ * @return
+ *		- XST_SUCCESS if the coefficients were designed.
+ *		- XST_FAILURE if the arguments are out of range.
+ *
+ * @note	Only the first half of the phases is computed, the other
+ *		phases are their mirror image.
+ *
+*******************************************************************************/
+u32 XVidC_PolyphaseDesign(s16 *CoeffPtr, u16 NumPhases, u16 NumTaps,
+			  u32 SizeIn, u32 SizeOut)
+{
+	s64 Tap[XVIDC_POLYPHASE_MAX_TAPS];
+	s64 Sum;
+	s64 Num;
+	s32 Cutoff;
+	s32 Pos;
+	s32 Residual;
+	s16 *PhasePtr;
+	u16 Phase;
+	u16 Peak;
+	u16 Index;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(CoeffPtr != NULL);
+
+	if ((NumPhases == 0) || (NumTaps < 2) || (NumTaps & 1) ||
+	    (NumTaps > XVIDC_POLYPHASE_MAX_TAPS) ||
+	    (SizeIn == 0) || (SizeOut == 0)) {
+		return XST_FAILURE;
+	}
+
+	/* Cutoff relative to the input sample rate, 1.0 when scaling up. */
+	if (SizeOut >= SizeIn) {
+		Cutoff = 1 << XVIDC_POLYPHASE_POS_SHIFT;
+	}
+	else {
+		Cutoff = (s32)(((u64)SizeOut << XVIDC_POLYPHASE_POS_SHIFT) /
+			       SizeIn);
+	}
+
+	for (Phase = 0; Phase <= (NumPhases / 2); Phase++) {
+		PhasePtr = &CoeffPtr[Phase * NumTaps];
+
+		Sum = 0;
+		for (Index = 0; Index < NumTaps; Index++) {
+			/* Distance from the output sample to the tap. */
+			Pos = ((Index - (NumTaps / 2 - 1)) *
+			       (1 << XVIDC_POLYPHASE_POS_SHIFT)) -
+			      (s32)(((u32)Phase << XVIDC_POLYPHASE_POS_SHIFT) /
+				    NumPhases);
+
+			Tap[Index] = (XVidC_PolyphaseSinc((s32)(((s64)Pos *
+					Cutoff) >> XVIDC_POLYPHASE_POS_SHIFT)) *
+				      XVidC_PolyphaseSinc(Pos * 2 / NumTaps)) >>
+				     28;
+			Sum += Tap[Index];
+		}
+
+		if (Sum <= 0) {
+			return XST_FAILURE;
+		}
+
+		/* Normalize to unity gain, rounding to nearest. */
+		Residual = 1 << XVIDC_POLYPHASE_FRAC_BITS;
+		Peak = 0;
+		for (Index = 0; Index < NumTaps; Index++) {
+			Num = Tap[Index] * (1 << XVIDC_POLYPHASE_FRAC_BITS);
+			if (Num >= 0) {
+				PhasePtr[Index] = (s16)((Num + Sum / 2) / Sum);
+			}
+			else {
+				PhasePtr[Index] = (s16)-((-Num + Sum / 2) / Sum);
+			}
+			Residual -= PhasePtr[Index];
+
+			if (PhasePtr[Index] > PhasePtr[Peak]) {
+				Peak = Index;
+			}
+		}
+
+		/* The rounding error goes to the largest tap. */
+		PhasePtr[Peak] += (s16)Residual;
+	}
+
+	for (Phase = (NumPhases / 2) + 1; Phase < NumPhases; Phase++) {
+		PhasePtr = &CoeffPtr[Phase * NumTaps];
+		for (Index = 0; Index < NumTaps; Index++) {
+			PhasePtr[Index] = CoeffPtr[(NumPhases - Phase) *
+						   NumTaps +
+						   (NumTaps - 1 - Index)];
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function computes sin(pi * Pos).
+ *
+ * @param	Pos is the argument, with 16 fractional bits.
+ *
+ * @return	The sine with 28 fractional bits.
+ *
+ * @note	The argument is folded to [0, 0.5] and a Taylor series to
+ *		x^9 is evaluated, the error is below 2^-18.
+ *
+*******************************************************************************/
+static s64 XVidC_PolyphaseSinPi(s32 Pos)
+{
+	u32 Turn;
+	u8 IsNegative = 0;
+	s64 X;
+	s64 X2;
+	s64 Sum;
+
+	/* sin(pi * Pos) has a period of 2. */
+	Turn = (u32)Pos & ((2 << XVIDC_POLYPHASE_POS_SHIFT) - 1);
+	if (Turn >= (1 << XVIDC_POLYPHASE_POS_SHIFT)) {
+		Turn -= 1 << XVIDC_POLYPHASE_POS_SHIFT;
+		IsNegative = 1;
+	}
+	if (Turn > (1 << (XVIDC_POLYPHASE_POS_SHIFT - 1))) {
+		Turn = (1 << XVIDC_POLYPHASE_POS_SHIFT) - Turn;
+	}
+
+	X = ((s64)Turn * XVIDC_POLYPHASE_PI) >> XVIDC_POLYPHASE_POS_SHIFT;
+	X2 = (X * X) >> 28;
+
+	Sum = XVIDC_POLYPHASE_ONE - X2 / 72;
+	Sum = XVIDC_POLYPHASE_ONE - ((X2 * Sum) >> 28) / 42;
+	Sum = XVIDC_POLYPHASE_ONE - ((X2 * Sum) >> 28) / 20;
+	Sum = XVIDC_POLYPHASE_ONE - ((X2 * Sum) >> 28) / 6;
+	Sum = (X * Sum) >> 28;
+
+	return IsNegative ? -Sum : Sum;
+}
+
+/******************************************************************************/
+/**
+ * This function computes the normalized sinc, sin(pi * Pos) / (pi * Pos).
+ *
+ * @param	Pos is the argument, with 16 fractional bits.
+ *
+ * @return	The sinc with 28 fractional bits.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static s64 XVidC_PolyphaseSinc(s32 Pos)
+{
+	s64 Den;
+
+	if (Pos == 0) {
+		return XVIDC_POLYPHASE_ONE;
+	}
+
+	Den = ((s64)Pos * XVIDC_POLYPHASE_PI) >> XVIDC_POLYPHASE_POS_SHIFT;
+
+	return (XVidC_PolyphaseSinPi(Pos) * XVIDC_POLYPHASE_ONE) / Den;
+}
+/** @} */
@@ -0,0 +1,1640 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xvprocss_model.c
+* @addtogroup vprocss Overview
+* @{
+* @details
+*
+* Software model of the video processing pipe.
+* Each sub-core is modeled by a stage which reads the configuration of the
+* sub-core from its registers and processes a frame with the same fixed point
+* arithmetic as the hardware. The stages are run in the order of the routing
+* table, or of the sub-cores of the topology.
+*
+* The model is not part of the driver library: it is built on the host with
+* xvprocss_model_test.c by make -C scripts/host_model.
+*
+* The inner loops run over contiguous samples of a line with 32 bit
+* accumulators and no data dependent branches, so that they are vectorized
+* by the compiler on hosts with SIMD units.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 2.13  kt   10/18/26 Initial Release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xil_io.h"
+#include "xvprocss_model.h"
+
+/************************** Constant Definitions *****************************/
+/* AXIS Switch Port# connected to output stream, ends the routing table */
+#define XVPROCSS_MODEL_VIDOUT_M0       (0)
+
+/* Coefficients of all the sub-cores have 12 fractional bits */
+#define XVPROCSS_MODEL_COEFF_SHIFT     (12)
+#define XVPROCSS_MODEL_COEFF_ROUND     (1 << (XVPROCSS_MODEL_COEFF_SHIFT-1))
+
+/* Positions of the V scaler model have 17 fractional bits, one more than the
+ * rate register so that the chroma rates are exact */
+#define XVPROCSS_MODEL_RATE_SHIFT      (17)
+
+/* Number of taps of the built-in chroma resampler filters */
+#define XVPROCSS_MODEL_CR_TAPS         (4)
+
+/**************************** Local Global ***********************************/
+/*
+ * Built-in chroma resampler filters, indexed by resampling type, down (0)
+ * or up (1) sampling, and phase. Tap 2 is the center tap.
+ */
+static const s16 XVprocSs_ModelCrCoeff[2][2][2][XVPROCSS_MODEL_CR_TAPS] =
+{
+  { /* Nearest neighbor */
+    {{0, 0, 4096, 0},    {0, 0, 0, 0}},
+    {{0, 0, 4096, 0},    {0, 4096, 0, 0}}
+  },
+  { /* Fixed coefficient */
+    {{0, 1024, 2048, 1024}, {0, 0, 0, 0}},
+    {{0, 0, 4096, 0},       {0, 2048, 2048, 0}}
+  }
+};
+
+/************************** Function Prototypes ******************************/
+static u8 XVprocSs_ModelHSub(u32 ColorFormat);
+static u8 XVprocSs_ModelVSub(u32 ColorFormat);
+static void XVprocSs_ModelPlaneSize(const XVprocSs_ModelFrame *FramePtr,
+                                    u8 Plane,
+                                    u32 *WidthPtr,
+                                    u32 *HeightPtr);
+static int XVprocSs_ModelSetFrame(XVprocSs_Model *ModelPtr,
+                                  XVprocSs_ModelFrame *FramePtr,
+                                  u32 Width,
+                                  u32 Height,
+                                  XVidC_ColorFormat ColorFormat);
+static void XVprocSs_ModelReadCoeff(UINTPTR Addr,
+                                    u32 NumCoeff,
+                                    s16 *CoeffPtr);
+static void XVprocSs_ModelStoreLine(XVprocSs_Model *ModelPtr,
+                                    u16 *OutPtr,
+                                    u32 Width);
+static void XVprocSs_ModelFilterColumns(XVprocSs_Model *ModelPtr,
+                                        const u16 *InPtr,
+                                        u32 InStride,
+                                        u32 SizeIn,
+                                        u16 *OutPtr,
+                                        u32 OutStride,
+                                        u32 Width,
+                                        u32 Lines,
+                                        u16 NumTaps);
+static void XVprocSs_ModelFilterRows(XVprocSs_Model *ModelPtr,
+                                     const u16 *InPtr,
+                                     u32 InStride,
+                                     u32 Rows,
+                                     s32 First,
+                                     const s16 *CoeffPtr,
+                                     u16 NumTaps,
+                                     u16 *OutPtr,
+                                     u32 Width);
+static int XVprocSs_ModelHPhases(XVprocSs_Model *ModelPtr,
+                                 XV_hscaler *CorePtr,
+                                 u32 WidthOut);
+static void XVprocSs_ModelScalerTable(XVprocSs_Model *ModelPtr,
+                                      u32 SizeIn,
+                                      u32 SizeOut,
+                                      u8 InShift,
+                                      u8 OutShift,
+                                      const s16 *CoeffPtr,
+                                      u16 NumTaps,
+                                      u16 PhaseShift);
+static void XVprocSs_ModelResampleTable(XVprocSs_Model *ModelPtr,
+                                        u32 SizeIn,
+                                        u32 SizeOut,
+                                        const s16 *CoeffPtr,
+                                        u16 NumTaps);
+static void XVprocSs_ModelSetTaps(XVprocSs_Model *ModelPtr,
+                                  u32 Out,
+                                  u32 SizeIn,
+                                  s32 First,
+                                  const s16 *CoeffPtr,
+                                  u16 NumTaps);
+static int XVprocSs_ModelCopy(XVprocSs_Model *ModelPtr,
+                              const XVprocSs_ModelFrame *InPtr,
+                              XVprocSs_ModelFrame *OutPtr);
+static int XVprocSs_ModelVScaler(XVprocSs_Model *ModelPtr,
+                                 XV_Vscaler_l2 *VscPtr,
+                                 const XVprocSs_ModelFrame *InPtr,
+                                 XVprocSs_ModelFrame *OutPtr);
+static int XVprocSs_ModelHScaler(XVprocSs_Model *ModelPtr,
+                                 XV_Hscaler_l2 *HscPtr,
+                                 const XVprocSs_ModelFrame *InPtr,
+                                 XVprocSs_ModelFrame *OutPtr);
+static int XVprocSs_ModelHCresampler(XVprocSs_Model *ModelPtr,
+                                     XV_Hcresampler_l2 *HcrPtr,
+                                     const XVprocSs_ModelFrame *InPtr,
+                                     XVprocSs_ModelFrame *OutPtr);
+static int XVprocSs_ModelVCresampler(XVprocSs_Model *ModelPtr,
+                                     XV_Vcresampler_l2 *VcrPtr,
+                                     const XVprocSs_ModelFrame *InPtr,
+                                     XVprocSs_ModelFrame *OutPtr);
+static int XVprocSs_ModelCsc(XVprocSs_Model *ModelPtr,
+                             XV_Csc_l2 *CscPtr,
+                             const XVprocSs_ModelFrame *InPtr,
+                             XVprocSs_ModelFrame *OutPtr);
+static int XVprocSs_ModelLbox(XVprocSs_Model *ModelPtr,
+                              XV_Lbox_l2 *LboxPtr,
+                              const XVprocSs_ModelFrame *InPtr,
+                              XVprocSs_ModelFrame *OutPtr);
+static int XVprocSs_ModelDeint(XVprocSs_Model *ModelPtr,
+                               XV_Deint_l2 *DeintPtr,
+                               const XVprocSs_ModelFrame *InPtr,
+                               XVprocSs_ModelFrame *OutPtr);
+static int XVprocSs_ModelVdma(XVprocSs_Model *ModelPtr,
+                              XVprocSs *XVprocSsPtr,
+                              const XVprocSs_ModelFrame *InPtr,
+                              XVprocSs_ModelFrame *OutPtr);
+static int XVprocSs_ModelStage(XVprocSs_Model *ModelPtr,
+                               XVprocSs *XVprocSsPtr,
+                               u8 CoreId,
+                               const XVprocSs_ModelFrame *InPtr,
+                               XVprocSs_ModelFrame *OutPtr);
+
+/*****************************************************************************/
+/**
+* This function initializes the model and splits the user provided memory
+* between the intermediate frames and the filter tables
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  MemPtr is a pointer to 4 byte aligned memory of
+*         XVPROCSS_MODEL_MEM_SIZE(MaxWidth, MaxHeight) bytes
+* @param  MaxWidth is the largest width of a frame in the pipe
+* @param  MaxHeight is the largest height of a frame in the pipe
+*
+* @return XST_SUCCESS if the model is initialized
+*         XST_FAILURE if the maximum size is not valid
+*
+******************************************************************************/
+int XVprocSs_ModelInit(XVprocSs_Model *ModelPtr,
+                       void *MemPtr,
+                       u32 MaxWidth,
+                       u32 MaxHeight)
+{
+  u8 *BufPtr = (u8 *)MemPtr;
+  u8 Index, Plane;
+
+  Xil_AssertNonvoid(ModelPtr != NULL);
+  Xil_AssertNonvoid(MemPtr != NULL);
+  Xil_AssertNonvoid(((UINTPTR)MemPtr & 3) == 0);
+
+  if((MaxWidth == 0) || (MaxHeight == 0)) {
+    return(XST_FAILURE);
+  }
+
+  memset(ModelPtr, 0, sizeof(XVprocSs_Model));
+  ModelPtr->MaxWidth  = MaxWidth;
+  ModelPtr->MaxHeight = MaxHeight;
+
+  ModelPtr->Acc = (s32 *)BufPtr;
+  BufPtr += MaxWidth * sizeof(s32);
+  ModelPtr->TapStart = (u32 *)BufPtr;
+  BufPtr += MaxWidth * sizeof(u32);
+  ModelPtr->Position = (u32 *)BufPtr;
+  BufPtr += MaxWidth * sizeof(u32);
+  ModelPtr->TapCoeff = (s16 *)BufPtr;
+  BufPtr += MaxWidth * XVPROCSS_MODEL_MAX_TAPS * sizeof(s16);
+  ModelPtr->Line = (u16 *)BufPtr;
+  BufPtr += (MaxWidth + 2 * XVPROCSS_MODEL_MAX_TAPS) * sizeof(u16);
+
+  for(Index = 0; Index < 2; ++Index) {
+    for(Plane = 0; Plane < 3; ++Plane) {
+      ModelPtr->Frame[Index].Plane[Plane]  = (u16 *)BufPtr;
+      ModelPtr->Frame[Index].Stride[Plane] = MaxWidth;
+      BufPtr += MaxWidth * MaxHeight * sizeof(u16);
+    }
+  }
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function runs a frame through the model of the processing pipe, as
+* configured by the last XVprocSs_SetSubsystemConfig() call. The input frame
+* must have the size and color format of the subsystem input, and the output
+* frame planes must be large enough for the subsystem output.
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  XVprocSsPtr is a pointer to the subsystem instance
+* @param  InPtr is a pointer to the input frame, or field if interlaced
+* @param  OutPtr is a pointer to the output frame. Its size and color format
+*         are set by the model
+*
+* @return XST_SUCCESS if the frame was processed
+*         XST_FAILURE if the frame does not match the sub-core settings or a
+*         sub-core setting is not modeled
+*
+******************************************************************************/
+int XVprocSs_ModelRun(XVprocSs_Model *ModelPtr,
+                      XVprocSs *XVprocSsPtr,
+                      const XVprocSs_ModelFrame *InPtr,
+                      XVprocSs_ModelFrame *OutPtr)
+{
+  u8 Stages[XVPROCSS_SUBCORE_MAX];
+  u32 NumStages = 0;
+  u32 Index;
+  const XVprocSs_ModelFrame *SrcPtr;
+  XVprocSs_ModelFrame *DstPtr;
+  XVprocSs_ContextData *CtxtPtr;
+  int Status;
+
+  Xil_AssertNonvoid(ModelPtr != NULL);
+  Xil_AssertNonvoid(ModelPtr->Acc != NULL);
+  Xil_AssertNonvoid(XVprocSsPtr != NULL);
+  Xil_AssertNonvoid(InPtr != NULL);
+  Xil_AssertNonvoid(OutPtr != NULL);
+
+  CtxtPtr = &XVprocSsPtr->CtxtData;
+  ModelPtr->ColorDepth = (u8)XVprocSs_GetColorDepth(XVprocSsPtr);
+  ModelPtr->MaxValue = (u16)((1 << ModelPtr->ColorDepth) - 1);
+
+  switch(XVprocSs_GetSubsystemTopology(XVprocSsPtr))
+  {
+    case XVPROCSS_TOPOLOGY_FULL_FLEDGED:
+      for(Index = 0; Index < CtxtPtr->RtrNumCores; ++Index) {
+        if(CtxtPtr->RtngTable[Index] == XVPROCSS_MODEL_VIDOUT_M0) {
+          break;
+        }
+        Stages[NumStages++] = CtxtPtr->RtngTable[Index];
+      }
+      break;
+
+    case XVPROCSS_TOPOLOGY_SCALER_ONLY:
+      Stages[NumStages++] = XVPROCSS_SUBCORE_SCALER_V;
+      Stages[NumStages++] = XVPROCSS_SUBCORE_SCALER_H;
+      break;
+
+    case XVPROCSS_TOPOLOGY_DEINTERLACE_ONLY:
+      Stages[NumStages++] = XVPROCSS_SUBCORE_DEINT;
+      break;
+
+    case XVPROCSS_TOPOLOGY_CSC_ONLY:
+      Stages[NumStages++] = XVPROCSS_SUBCORE_CSC;
+      break;
+
+    case XVPROCSS_TOPOLOGY_VCRESAMPLE_ONLY:
+      Stages[NumStages++] = XVPROCSS_SUBCORE_CR_V_IN;
+      break;
+
+    case XVPROCSS_TOPOLOGY_HCRESAMPLE_ONLY:
+      Stages[NumStages++] = XVPROCSS_SUBCORE_CR_H;
+      break;
+
+    default:
+      break;
+  }
+
+  if(NumStages == 0) {
+    return(XST_FAILURE);
+  }
+
+  /* Stages write to the two model frames in turn, the last one to output */
+  SrcPtr = InPtr;
+  for(Index = 0; Index < NumStages; ++Index) {
+    DstPtr = ((Index == (NumStages-1)) ? OutPtr : &ModelPtr->Frame[Index & 1]);
+
+    Status = XVprocSs_ModelStage(ModelPtr, XVprocSsPtr, Stages[Index],
+                                 SrcPtr, DstPtr);
+    if(Status != XST_SUCCESS) {
+      return(Status);
+    }
+    SrcPtr = DstPtr;
+  }
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function runs the stage of one sub-core. A sub-core which is not
+* present in the design passes the frame through.
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  XVprocSsPtr is a pointer to the subsystem instance
+* @param  CoreId is the sub-core, XVPROCSS_SUBCORE_*
+* @param  InPtr is a pointer to the input frame
+* @param  OutPtr is a pointer to the output frame
+*
+* @return XST_SUCCESS or XST_FAILURE
+*
+******************************************************************************/
+static int XVprocSs_ModelStage(XVprocSs_Model *ModelPtr,
+                               XVprocSs *XVprocSsPtr,
+                               u8 CoreId,
+                               const XVprocSs_ModelFrame *InPtr,
+                               XVprocSs_ModelFrame *OutPtr)
+{
+  switch(CoreId)
+  {
+    case XVPROCSS_SUBCORE_SCALER_V:
+      if(XVprocSsPtr->VscalerPtr) {
+        return(XVprocSs_ModelVScaler(ModelPtr, XVprocSsPtr->VscalerPtr,
+                                     InPtr, OutPtr));
+      }
+      break;
+
+    case XVPROCSS_SUBCORE_SCALER_H:
+      if(XVprocSsPtr->HscalerPtr) {
+        return(XVprocSs_ModelHScaler(ModelPtr, XVprocSsPtr->HscalerPtr,
+                                     InPtr, OutPtr));
+      }
+      break;
+
+    case XVPROCSS_SUBCORE_VDMA:
+      return(XVprocSs_ModelVdma(ModelPtr, XVprocSsPtr, InPtr, OutPtr));
+
+    case XVPROCSS_SUBCORE_LBOX:
+      if(XVprocSsPtr->LboxPtr) {
+        return(XVprocSs_ModelLbox(ModelPtr, XVprocSsPtr->LboxPtr,
+                                  InPtr, OutPtr));
+      }
+      break;
+
+    case XVPROCSS_SUBCORE_CR_H:
+      if(XVprocSsPtr->HcrsmplrPtr) {
+        return(XVprocSs_ModelHCresampler(ModelPtr, XVprocSsPtr->HcrsmplrPtr,
+                                         InPtr, OutPtr));
+      }
+      break;
+
+    case XVPROCSS_SUBCORE_CR_V_IN:
+      if(XVprocSsPtr->VcrsmplrInPtr) {
+        return(XVprocSs_ModelVCresampler(ModelPtr,
+                                         XVprocSsPtr->VcrsmplrInPtr,
+                                         InPtr, OutPtr));
+      }
+      break;
+
+    case XVPROCSS_SUBCORE_CR_V_OUT:
+      if(XVprocSsPtr->VcrsmplrOutPtr) {
+        return(XVprocSs_ModelVCresampler(ModelPtr,
+                                         XVprocSsPtr->VcrsmplrOutPtr,
+                                         InPtr, OutPtr));
+      }
+      break;
+
+    case XVPROCSS_SUBCORE_CSC:
+      if(XVprocSsPtr->CscPtr) {
+        return(XVprocSs_ModelCsc(ModelPtr, XVprocSsPtr->CscPtr,
+                                 InPtr, OutPtr));
+      }
+      break;
+
+    case XVPROCSS_SUBCORE_DEINT:
+      if(XVprocSsPtr->DeintPtr) {
+        return(XVprocSs_ModelDeint(ModelPtr, XVprocSsPtr->DeintPtr,
+                                   InPtr, OutPtr));
+      }
+      break;
+
+    default:
+      return(XST_FAILURE);
+  }
+
+  return(XVprocSs_ModelCopy(ModelPtr, InPtr, OutPtr));
+}
+
+/*****************************************************************************/
+/**
+* This function returns the horizontal chroma subsampling of a color format
+*
+* @param  ColorFormat is the color format
+*
+* @return 1 if chroma has half the width, 0 otherwise
+*
+******************************************************************************/
+static u8 XVprocSs_ModelHSub(u32 ColorFormat)
+{
+  return(((ColorFormat == XVIDC_CSF_YCRCB_422) ||
+          (ColorFormat == XVIDC_CSF_YCRCB_420)) ? 1 : 0);
+}
+
+/*****************************************************************************/
+/**
+* This function returns the vertical chroma subsampling of a color format
+*
+* @param  ColorFormat is the color format
+*
+* @return 1 if chroma has half the height, 0 otherwise
+*
+******************************************************************************/
+static u8 XVprocSs_ModelVSub(u32 ColorFormat)
+{
+  return((ColorFormat == XVIDC_CSF_YCRCB_420) ? 1 : 0);
+}
+
+/*****************************************************************************/
+/**
+* This function returns the size of a plane of a frame
+*
+* @param  FramePtr is a pointer to the frame
+* @param  Plane is the plane, 0 to 2
+* @param  WidthPtr is set to the samples per line of the plane
+* @param  HeightPtr is set to the lines of the plane
+*
+* @return None
+*
+******************************************************************************/
+static void XVprocSs_ModelPlaneSize(const XVprocSs_ModelFrame *FramePtr,
+                                    u8 Plane,
+                                    u32 *WidthPtr,
+                                    u32 *HeightPtr)
+{
+  *WidthPtr  = FramePtr->Width;
+  *HeightPtr = FramePtr->Height;
+
+  if(Plane != 0) {
+    *WidthPtr  >>= XVprocSs_ModelHSub(FramePtr->ColorFormat);
+    *HeightPtr >>= XVprocSs_ModelVSub(FramePtr->ColorFormat);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function sets the size and color format of an output frame
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  FramePtr is a pointer to the frame
+* @param  Width is the width of the frame
+* @param  Height is the height of the frame
+* @param  ColorFormat is the color format of the frame
+*
+* @return XST_SUCCESS if the frame fits in the model
+*         XST_FAILURE otherwise
+*
+******************************************************************************/
+static int XVprocSs_ModelSetFrame(XVprocSs_Model *ModelPtr,
+                                  XVprocSs_ModelFrame *FramePtr,
+                                  u32 Width,
+                                  u32 Height,
+                                  XVidC_ColorFormat ColorFormat)
+{
+  if((Width == 0) || (Height == 0) ||
+     (Width > ModelPtr->MaxWidth) || (Height > ModelPtr->MaxHeight)) {
+    return(XST_FAILURE);
+  }
+
+  FramePtr->Width       = Width;
+  FramePtr->Height      = Height;
+  FramePtr->ColorFormat = ColorFormat;
+  FramePtr->FieldId     = 0;
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function reads the filter coefficients of a scaler. Each register
+* holds two coefficients, the lower numbered tap in the low half.
+*
+* @param  Addr is the address of the first coefficient register
+* @param  NumCoeff is the number of coefficients, phases times taps
+* @param  CoeffPtr is the array of coefficients to be written
+*
+* @return None
+*
+******************************************************************************/
+static void XVprocSs_ModelReadCoeff(UINTPTR Addr,
+                                    u32 NumCoeff,
+                                    s16 *CoeffPtr)
+{
+  u32 Index;
+  u32 Val;
+
+  for(Index = 0; Index < NumCoeff; Index += 2) {
+    Val = Xil_In32(Addr + (Index * 2));
+    CoeffPtr[Index]   = (s16)(Val & 0xFFFF);
+    CoeffPtr[Index+1] = (s16)(Val >> 16);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function rounds and clips the accumulators of a line to samples
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  OutPtr is a pointer to the output line
+* @param  Width is the number of samples
+*
+* @return None
+*
+******************************************************************************/
+static void XVprocSs_ModelStoreLine(XVprocSs_Model *ModelPtr,
+                                    u16 *OutPtr,
+                                    u32 Width)
+{
+  const s32 *AccPtr = ModelPtr->Acc;
+  s32 MaxValue = ModelPtr->MaxValue;
+  s32 Val;
+  u32 x;
+
+  for(x = 0; x < Width; ++x) {
+    Val = ((AccPtr[x] < 0) ? 0 : (AccPtr[x] >> XVPROCSS_MODEL_COEFF_SHIFT));
+    OutPtr[x] = (u16)((Val > MaxValue) ? MaxValue : Val);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function filters the lines of a plane horizontally. Each input line is
+* copied with XVPROCSS_MODEL_MAX_TAPS repeated edge samples on both sides,
+* then each output sample is the dot product of the taps of its table entry
+* with the input samples from its first sample on.
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  InPtr is a pointer to the first input line
+* @param  InStride is the number of samples between two input lines
+* @param  SizeIn is the number of input samples per line
+* @param  OutPtr is a pointer to the first output line
+* @param  OutStride is the number of samples between two output lines
+* @param  Width is the number of output samples per line
+* @param  Lines is the number of lines
+* @param  NumTaps is the number of taps
+*
+* @return None
+*
+******************************************************************************/
+static void XVprocSs_ModelFilterColumns(XVprocSs_Model *ModelPtr,
+                                        const u16 *InPtr,
+                                        u32 InStride,
+                                        u32 SizeIn,
+                                        u16 *OutPtr,
+                                        u32 OutStride,
+                                        u32 Width,
+                                        u32 Lines,
+                                        u16 NumTaps)
+{
+  u16 *LinePtr = ModelPtr->Line;
+  const s16 *CoeffPtr;
+  const u16 *SrcPtr;
+  s32 MaxValue = ModelPtr->MaxValue;
+  s32 Acc;
+  u32 Line, Tap, x;
+
+  for(Line = 0; Line < Lines; ++Line) {
+    SrcPtr = &InPtr[Line * InStride];
+
+    for(x = 0; x < XVPROCSS_MODEL_MAX_TAPS; ++x) {
+      LinePtr[x] = SrcPtr[0];
+      LinePtr[XVPROCSS_MODEL_MAX_TAPS + SizeIn + x] = SrcPtr[SizeIn-1];
+    }
+    memcpy(&LinePtr[XVPROCSS_MODEL_MAX_TAPS], SrcPtr, SizeIn * sizeof(u16));
+
+    for(x = 0; x < Width; ++x) {
+      SrcPtr   = &LinePtr[ModelPtr->TapStart[x]];
+      CoeffPtr = &ModelPtr->TapCoeff[x * NumTaps];
+
+      Acc = XVPROCSS_MODEL_COEFF_ROUND;
+      for(Tap = 0; Tap < NumTaps; ++Tap) {
+        Acc += CoeffPtr[Tap] * SrcPtr[Tap];
+      }
+
+      Acc = ((Acc < 0) ? 0 : (Acc >> XVPROCSS_MODEL_COEFF_SHIFT));
+      OutPtr[Line * OutStride + x] = (u16)((Acc > MaxValue) ? MaxValue : Acc);
+    }
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function computes one output line as a weighted sum of input lines.
+* Lines above or below the plane repeat the first or the last line.
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  InPtr is a pointer to the first line of the input plane
+* @param  InStride is the number of samples between two input lines
+* @param  Rows is the number of lines of the input plane
+* @param  First is the input line of the first tap, may be negative
+* @param  CoeffPtr is a pointer to the NumTaps coefficients
+* @param  NumTaps is the number of taps
+* @param  OutPtr is a pointer to the output line
+* @param  Width is the number of samples per line
+*
+* @return None
+*
+******************************************************************************/
+static void XVprocSs_ModelFilterRows(XVprocSs_Model *ModelPtr,
+                                     const u16 *InPtr,
+                                     u32 InStride,
+                                     u32 Rows,
+                                     s32 First,
+                                     const s16 *CoeffPtr,
+                                     u16 NumTaps,
+                                     u16 *OutPtr,
+                                     u32 Width)
+{
+  s32 *AccPtr = ModelPtr->Acc;
+  const u16 *SrcPtr;
+  s32 Row, Coeff;
+  u32 Tap, x;
+
+  for(x = 0; x < Width; ++x) {
+    AccPtr[x] = XVPROCSS_MODEL_COEFF_ROUND;
+  }
+
+  for(Tap = 0; Tap < NumTaps; ++Tap) {
+    Coeff = CoeffPtr[Tap];
+    if(Coeff == 0) {
+      continue;
+    }
+
+    Row = First + (s32)Tap;
+    Row = ((Row < 0) ? 0 : ((Row >= (s32)Rows) ? (s32)Rows-1 : Row));
+    SrcPtr = &InPtr[(u32)Row * InStride];
+    for(x = 0; x < Width; ++x) {
+      AccPtr[x] += Coeff * SrcPtr[x];
+    }
+  }
+
+  XVprocSs_ModelStoreLine(ModelPtr, OutPtr, Width);
+}
+
+/*****************************************************************************/
+/**
+* This function reads the input position of each output sample from the phase
+* registers of the H scaler. Each clock of the line has one entry of
+* PixPerClk samples, with the phase, the index of the input sample in the
+* clock and the output write enable of each sample. The index advances when
+* the sample reads a new input sample and wraps at the end of the clock.
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  CorePtr is a pointer to the H scaler core instance
+* @param  WidthOut is the number of output samples
+*
+* @return XST_SUCCESS, or XST_FAILURE if the registers do not hold WidthOut
+*         output samples
+*
+******************************************************************************/
+static int XVprocSs_ModelHPhases(XVprocSs_Model *ModelPtr,
+                                 XV_hscaler *CorePtr,
+                                 u32 WidthOut)
+{
+  UINTPTR Addr = XV_hscaler_Get_HwReg_phasesH_V_BaseAddress(CorePtr);
+  u32 PixPerClk = CorePtr->Config.PixPerClk;
+  u32 PhaseShift = CorePtr->Config.PhaseShift;
+  u32 Word[4];
+  u32 Clock, Sample, Shift, Bits, Entry, Index;
+  u32 Prev = 0, Reads = 0, Out = 0;
+
+  /* Bits of a sample: 6 bit phase, index, output write enable */
+  switch(PixPerClk) {
+    case XVIDC_PPC_1:
+    case XVIDC_PPC_2: Bits = 9;  break;
+    case XVIDC_PPC_4: Bits = 10; break;
+    case XVIDC_PPC_8: Bits = 11; break;
+    default: return(XST_FAILURE);
+  }
+
+  for(Clock = 0; (Clock < (CorePtr->Config.MaxWidth / PixPerClk)) &&
+                 (Out < WidthOut); ++Clock) {
+    memset(Word, 0, sizeof(Word));
+    if(PixPerClk == XVIDC_PPC_1) {
+      /* Two 16 bit entries per register */
+      Word[0] = (Xil_In32(Addr + (Clock >> 1) * 4) >> ((Clock & 1) * 16)) &
+                0xFFFF;
+    } else {
+      /* 1, 2 or 3 registers per entry, 8 samples use 4 */
+      for(Index = 0; Index < ((PixPerClk == XVIDC_PPC_8) ? 3 : PixPerClk/2);
+          ++Index) {
+        Word[Index] = Xil_In32(Addr +
+                               ((Clock * ((PixPerClk == XVIDC_PPC_8)
+                                          ? 4 : PixPerClk/2)) + Index) * 4);
+      }
+    }
+
+    Prev &= (PixPerClk - 1);
+    for(Sample = 0; Sample < PixPerClk; ++Sample) {
+      Shift = Sample * Bits;
+      Entry = Word[Shift / 32] >> (Shift % 32);
+      if((Shift % 32) != 0) {
+        Entry |= Word[(Shift / 32) + 1] << (32 - (Shift % 32));
+      }
+      Index = (Entry >> 6) & ((1 << (Bits - 7)) - 1);
+
+      /* At most one input sample is read per sample of the clock */
+      if((Index < Prev) || ((Index - Prev) > 1)) {
+        return(XST_FAILURE);
+      }
+      Reads += Index - Prev;
+      Prev = Index;
+
+      if(((Entry >> (Bits - 1)) & 1) && (Out < WidthOut)) {
+        ModelPtr->Position[Out++] = (Reads << PhaseShift) |
+                                    (Entry & ((1 << PhaseShift) - 1));
+      }
+    }
+  }
+
+  return((Out == WidthOut) ? XST_SUCCESS : XST_FAILURE);
+}
+
+/*****************************************************************************/
+/**
+* This function builds the tap tables of a polyphase scaler from the input
+* positions read by XVprocSs_ModelHPhases(). The integer part of a position
+* selects the input samples and the fractional part the phase. Phase 0 is
+* centered on tap (NumTaps/2 - 1), as programmed by the scaler drivers.
+* Chroma output sample n of a subsampled plane takes the position of luma
+* output sample (n << OutShift), divided by the input subsampling.
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  SizeIn is the number of input samples
+* @param  SizeOut is the number of output samples
+* @param  InShift is log2 of the subsampling of the input plane
+* @param  OutShift is log2 of the subsampling of the output plane
+* @param  CoeffPtr is a pointer to the coefficients, phase after phase
+* @param  NumTaps is the number of taps
+* @param  PhaseShift is log2 of the number of phases
+*
+* @return None
+*
+******************************************************************************/
+static void XVprocSs_ModelScalerTable(XVprocSs_Model *ModelPtr,
+                                      u32 SizeIn,
+                                      u32 SizeOut,
+                                      u8 InShift,
+                                      u8 OutShift,
+                                      const s16 *CoeffPtr,
+                                      u16 NumTaps,
+                                      u16 PhaseShift)
+{
+  u32 Position;
+  u32 Phase;
+  u32 Out;
+
+  for(Out = 0; Out < SizeOut; ++Out) {
+    Position = ModelPtr->Position[Out << OutShift] >> InShift;
+    Phase    = Position & ((1 << PhaseShift) - 1);
+
+    XVprocSs_ModelSetTaps(ModelPtr, Out, SizeIn,
+                          (s32)(Position >> PhaseShift) - (NumTaps/2 - 1),
+                          &CoeffPtr[Phase * NumTaps], NumTaps);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function builds the tap tables of a horizontal chroma resampler.
+* Down sampling uses phase 0 centered on the even input samples. Up sampling
+* uses phase 0 for the even output samples, centered on the input sample,
+* and phase 1 for the odd output samples, between two input samples.
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  SizeIn is the number of input samples
+* @param  SizeOut is the number of output samples
+* @param  CoeffPtr is a pointer to the coefficients of the two phases
+* @param  NumTaps is the number of taps
+*
+* @return None
+*
+******************************************************************************/
+static void XVprocSs_ModelResampleTable(XVprocSs_Model *ModelPtr,
+                                        u32 SizeIn,
+                                        u32 SizeOut,
+                                        const s16 *CoeffPtr,
+                                        u16 NumTaps)
+{
+  s32 First;
+  u32 Phase;
+  u32 Out;
+
+  for(Out = 0; Out < SizeOut; ++Out) {
+    if(SizeOut < SizeIn) {
+      Phase = 0;
+      First = (s32)(Out * 2) - (NumTaps/2);
+    } else {
+      Phase = Out & 1;
+      First = (s32)((Out >> 1) + Phase) - (NumTaps/2);
+    }
+
+    XVprocSs_ModelSetTaps(ModelPtr, Out, SizeIn, First,
+                          &CoeffPtr[Phase * NumTaps], NumTaps);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function sets the tap table entry of one output sample
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  Out is the output sample
+* @param  SizeIn is the number of input samples
+* @param  First is the input sample of the first tap, may be negative
+* @param  CoeffPtr is a pointer to the NumTaps coefficients
+* @param  NumTaps is the number of taps
+*
+* @return None
+*
+******************************************************************************/
+static void XVprocSs_ModelSetTaps(XVprocSs_Model *ModelPtr,
+                                  u32 Out,
+                                  u32 SizeIn,
+                                  s32 First,
+                                  const s16 *CoeffPtr,
+                                  u16 NumTaps)
+{
+  s32 Last = (s32)(SizeIn + 2 * XVPROCSS_MODEL_MAX_TAPS) - NumTaps;
+
+  /* Index in the line with repeated edges */
+  First += XVPROCSS_MODEL_MAX_TAPS;
+  ModelPtr->TapStart[Out] = (u32)((First < 0) ? 0 :
+                                  ((First > Last) ? Last : First));
+  memcpy(&ModelPtr->TapCoeff[Out * NumTaps], CoeffPtr,
+         NumTaps * sizeof(s16));
+}
+
+/*****************************************************************************/
+/**
+* This function passes a frame through, for sub-cores not in the design
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  InPtr is a pointer to the input frame
+* @param  OutPtr is a pointer to the output frame
+*
+* @return XST_SUCCESS or XST_FAILURE
+*
+******************************************************************************/
+static int XVprocSs_ModelCopy(XVprocSs_Model *ModelPtr,
+                              const XVprocSs_ModelFrame *InPtr,
+                              XVprocSs_ModelFrame *OutPtr)
+{
+  u32 Width, Height, Line;
+  u8 Plane;
+  int Status;
+
+  Status = XVprocSs_ModelSetFrame(ModelPtr, OutPtr, InPtr->Width,
+                                  InPtr->Height, InPtr->ColorFormat);
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+  OutPtr->FieldId = InPtr->FieldId;
+
+  for(Plane = 0; Plane < 3; ++Plane) {
+    XVprocSs_ModelPlaneSize(InPtr, Plane, &Width, &Height);
+    for(Line = 0; Line < Height; ++Line) {
+      memcpy(&OutPtr->Plane[Plane][Line * OutPtr->Stride[Plane]],
+             &InPtr->Plane[Plane][Line * InPtr->Stride[Plane]],
+             Width * sizeof(u16));
+    }
+  }
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function models the vertical scaler. A 4:2:0 input is converted to
+* 4:2:2 by scaling the chroma lines to the output height.
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  VscPtr is a pointer to the V scaler instance
+* @param  InPtr is a pointer to the input frame
+* @param  OutPtr is a pointer to the output frame
+*
+* @return XST_SUCCESS or XST_FAILURE
+*
+******************************************************************************/
+static int XVprocSs_ModelVScaler(XVprocSs_Model *ModelPtr,
+                                 XV_Vscaler_l2 *VscPtr,
+                                 const XVprocSs_ModelFrame *InPtr,
+                                 XVprocSs_ModelFrame *OutPtr)
+{
+  s16 Coeff[XV_VSCALER_MAX_V_PHASES * XV_VSCALER_MAX_V_TAPS];
+  XV_vscaler *CorePtr = &VscPtr->Vsc;
+  u32 HeightIn, HeightOut, Width, ColorMode;
+  u32 PlaneWidth, PlaneHeight, Row, Phase;
+  u16 NumTaps, PhaseShift;
+  u64 Rate, Offset;
+  u8 Plane;
+  int Status;
+
+  if(CorePtr->Config.ScalerType != XV_VSCALER_POLYPHASE) {
+    return(XST_FAILURE);
+  }
+
+  HeightIn  = XV_vscaler_Get_HwReg_HeightIn(CorePtr);
+  HeightOut = XV_vscaler_Get_HwReg_HeightOut(CorePtr);
+  Width     = XV_vscaler_Get_HwReg_Width(CorePtr);
+  ColorMode = XV_vscaler_Get_HwReg_ColorMode(CorePtr);
+  NumTaps    = CorePtr->Config.NumTaps;
+  PhaseShift = CorePtr->Config.PhaseShift;
+
+  if((InPtr->Width != Width) || (InPtr->Height != HeightIn) ||
+     ((u32)InPtr->ColorFormat != ColorMode) ||
+     (NumTaps > XVPROCSS_MODEL_MAX_TAPS)) {
+    return(XST_FAILURE);
+  }
+
+  Status = XVprocSs_ModelSetFrame(ModelPtr, OutPtr, Width, HeightOut,
+                                  ((ColorMode == XVIDC_CSF_YCRCB_420)
+                                   ? XVIDC_CSF_YCRCB_422
+                                   : InPtr->ColorFormat));
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  XVprocSs_ModelReadCoeff(XV_vscaler_Get_HwReg_vfltCoeff_BaseAddress(CorePtr),
+                          (1 << PhaseShift) * NumTaps, Coeff);
+
+  for(Plane = 0; Plane < 3; ++Plane) {
+    XVprocSs_ModelPlaneSize(InPtr, Plane, &PlaneWidth, &PlaneHeight);
+
+    /* Input lines per output line */
+    Rate = ((u64)XV_vscaler_Get_HwReg_LineRate(CorePtr) <<
+            (XVPROCSS_MODEL_RATE_SHIFT - 16)) >>
+           ((Plane != 0) ? XVprocSs_ModelVSub(ColorMode) : 0);
+
+    for(Row = 0; Row < HeightOut; ++Row) {
+      Offset = Row * Rate;
+      Phase  = (u32)(Offset >> (XVPROCSS_MODEL_RATE_SHIFT - PhaseShift)) &
+               ((1 << PhaseShift) - 1);
+
+      XVprocSs_ModelFilterRows(ModelPtr, InPtr->Plane[Plane],
+                               InPtr->Stride[Plane], PlaneHeight,
+                               (s32)(Offset >> XVPROCSS_MODEL_RATE_SHIFT) -
+                               (NumTaps/2 - 1),
+                               &Coeff[Phase * NumTaps], NumTaps,
+                               &OutPtr->Plane[Plane][Row * OutPtr->Stride[Plane]],
+                               PlaneWidth);
+    }
+  }
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function models the horizontal scaler. The input positions and
+* phases are replayed from the phase registers, so that the model follows
+* what the driver programmed rather than the rate register. Conversions
+* between YUV sampling formats scale the chroma samples directly to the
+* output width, 4:2:0 output keeps the even chroma lines.
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  HscPtr is a pointer to the H scaler instance
+* @param  InPtr is a pointer to the input frame
+* @param  OutPtr is a pointer to the output frame
+*
+* @return XST_SUCCESS or XST_FAILURE
+*
+******************************************************************************/
+static int XVprocSs_ModelHScaler(XVprocSs_Model *ModelPtr,
+                                 XV_Hscaler_l2 *HscPtr,
+                                 const XVprocSs_ModelFrame *InPtr,
+                                 XVprocSs_ModelFrame *OutPtr)
+{
+  s16 Coeff[XV_HSCALER_MAX_H_PHASES * XV_HSCALER_MAX_H_TAPS];
+  XV_hscaler *CorePtr = &HscPtr->Hsc;
+  u32 WidthIn, WidthOut, Height, ColorMode, ColorModeOut;
+  u32 InWidth, InHeight, OutWidth, OutHeight;
+  u16 NumTaps, PhaseShift;
+  u8 Plane, InShift, OutShift, VShift;
+  int Status;
+
+  if(CorePtr->Config.ScalerType != XV_HSCALER_POLYPHASE) {
+    return(XST_FAILURE);
+  }
+
+  Height       = XV_hscaler_Get_HwReg_Height(CorePtr);
+  WidthIn      = XV_hscaler_Get_HwReg_WidthIn(CorePtr);
+  WidthOut     = XV_hscaler_Get_HwReg_WidthOut(CorePtr);
+  ColorMode    = XV_hscaler_Get_HwReg_ColorMode(CorePtr);
+  ColorModeOut = XV_hscaler_Get_HwReg_ColorModeOut(CorePtr);
+  NumTaps    = CorePtr->Config.NumTaps;
+  PhaseShift = CorePtr->Config.PhaseShift;
+
+  if((InPtr->Width != WidthIn) || (InPtr->Height != Height) ||
+     ((u32)InPtr->ColorFormat != ColorMode) ||
+     (NumTaps > XVPROCSS_MODEL_MAX_TAPS)) {
+    return(XST_FAILURE);
+  }
+
+  /* Color space conversion and 4:2:0 input are not modeled */
+  if((ColorMode == XVIDC_CSF_YCRCB_420) ||
+     ((ColorMode == XVIDC_CSF_RGB) != (ColorModeOut == XVIDC_CSF_RGB))) {
+    return(XST_FAILURE);
+  }
+
+  Status = XVprocSs_ModelSetFrame(ModelPtr, OutPtr, WidthOut, Height,
+                                  (XVidC_ColorFormat)ColorModeOut);
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  XVprocSs_ModelReadCoeff(XV_hscaler_Get_HwReg_hfltCoeff_BaseAddress(CorePtr),
+                          (1 << PhaseShift) * NumTaps, Coeff);
+  Status = XVprocSs_ModelHPhases(ModelPtr, CorePtr, WidthOut);
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  for(Plane = 0; Plane < 3; ++Plane) {
+    XVprocSs_ModelPlaneSize(InPtr, Plane, &InWidth, &InHeight);
+    XVprocSs_ModelPlaneSize(OutPtr, Plane, &OutWidth, &OutHeight);
+
+    /* Luma positions, in the sampling of the plane */
+    InShift  = ((Plane != 0) ? XVprocSs_ModelHSub(ColorMode) : 0);
+    OutShift = ((Plane != 0) ? XVprocSs_ModelHSub(ColorModeOut) : 0);
+    VShift   = ((Plane != 0) ? XVprocSs_ModelVSub(ColorModeOut) : 0);
+
+    XVprocSs_ModelScalerTable(ModelPtr, InWidth, OutWidth, InShift, OutShift,
+                              Coeff, NumTaps, PhaseShift);
+    XVprocSs_ModelFilterColumns(ModelPtr, InPtr->Plane[Plane],
+                                InPtr->Stride[Plane] << VShift, InWidth,
+                                OutPtr->Plane[Plane], OutPtr->Stride[Plane],
+                                OutWidth, OutHeight, NumTaps);
+  }
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function models the horizontal chroma resampler, 4:4:4 to 4:2:2 or
+* 4:2:2 to 4:4:4
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  HcrPtr is a pointer to the H chroma resampler instance
+* @param  InPtr is a pointer to the input frame
+* @param  OutPtr is a pointer to the output frame
+*
+* @return XST_SUCCESS or XST_FAILURE
+*
+******************************************************************************/
+static int XVprocSs_ModelHCresampler(XVprocSs_Model *ModelPtr,
+                                     XV_Hcresampler_l2 *HcrPtr,
+                                     const XVprocSs_ModelFrame *InPtr,
+                                     XVprocSs_ModelFrame *OutPtr)
+{
+  s16 Coeff[XV_HCRSMPLR_MAX_PHASES * XV_HCRSMPLR_MAX_TAPS];
+  XV_hcresampler *CorePtr = &HcrPtr->Hcr;
+  u32 Width, Height, FormatIn, FormatOut;
+  u32 InWidth, OutWidth, PlaneHeight, Index;
+  u16 NumTaps;
+  u8 Plane;
+  int Status;
+
+  Width     = XV_hcresampler_Get_HwReg_width(CorePtr);
+  Height    = XV_hcresampler_Get_HwReg_height(CorePtr);
+  FormatIn  = XV_hcresampler_Get_HwReg_input_video_format(CorePtr);
+  FormatOut = XV_hcresampler_Get_HwReg_output_video_format(CorePtr);
+
+  if((InPtr->Width != Width) || (InPtr->Height != Height) ||
+     ((u32)InPtr->ColorFormat != FormatIn)) {
+    return(XST_FAILURE);
+  }
+
+  if(FormatIn == FormatOut) {
+    return(XVprocSs_ModelCopy(ModelPtr, InPtr, OutPtr));
+  }
+
+  if(!(((FormatIn == XVIDC_CSF_YCRCB_444) &&
+        (FormatOut == XVIDC_CSF_YCRCB_422)) ||
+       ((FormatIn == XVIDC_CSF_YCRCB_422) &&
+        (FormatOut == XVIDC_CSF_YCRCB_444)))) {
+    return(XST_FAILURE);
+  }
+
+  if(CorePtr->Config.ResamplingType == XV_HCRSMPLR_TYPE_FIR) {
+    NumTaps = CorePtr->Config.NumTaps;
+    for(Index = 0; Index < (u32)(XV_HCRSMPLR_MAX_PHASES * NumTaps); ++Index) {
+      Coeff[Index] = (s16)Xil_In32(CorePtr->Config.BaseAddress +
+                                   XV_HCRESAMPLER_CTRL_ADDR_HWREG_COEFS_0_0_DATA +
+                                   (Index * 8));
+    }
+  } else {
+    NumTaps = XVPROCSS_MODEL_CR_TAPS;
+    memcpy(Coeff,
+           XVprocSs_ModelCrCoeff[(CorePtr->Config.ResamplingType ==
+                                  XV_HCRSMPLR_TYPE_FIXED_COEFFICIENT)]
+                                [(FormatOut == XVIDC_CSF_YCRCB_444)],
+           sizeof(XVprocSs_ModelCrCoeff[0][0]));
+  }
+
+  Status = XVprocSs_ModelSetFrame(ModelPtr, OutPtr, Width, Height,
+                                  (XVidC_ColorFormat)FormatOut);
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  /* Luma passes through */
+  for(Index = 0; Index < Height; ++Index) {
+    memcpy(&OutPtr->Plane[0][Index * OutPtr->Stride[0]],
+           &InPtr->Plane[0][Index * InPtr->Stride[0]],
+           Width * sizeof(u16));
+  }
+
+  XVprocSs_ModelPlaneSize(InPtr, 1, &InWidth, &PlaneHeight);
+  XVprocSs_ModelPlaneSize(OutPtr, 1, &OutWidth, &PlaneHeight);
+  XVprocSs_ModelResampleTable(ModelPtr, InWidth, OutWidth, Coeff, NumTaps);
+
+  for(Plane = 1; Plane < 3; ++Plane) {
+    XVprocSs_ModelFilterColumns(ModelPtr, InPtr->Plane[Plane],
+                                InPtr->Stride[Plane], InWidth,
+                                OutPtr->Plane[Plane], OutPtr->Stride[Plane],
+                                OutWidth, PlaneHeight, NumTaps);
+  }
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function models the vertical chroma resampler, 4:2:2 to 4:2:0 or
+* 4:2:0 to 4:2:2
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  VcrPtr is a pointer to the V chroma resampler instance
+* @param  InPtr is a pointer to the input frame
+* @param  OutPtr is a pointer to the output frame
+*
+* @return XST_SUCCESS or XST_FAILURE
+*
+******************************************************************************/
+static int XVprocSs_ModelVCresampler(XVprocSs_Model *ModelPtr,
+                                     XV_Vcresampler_l2 *VcrPtr,
+                                     const XVprocSs_ModelFrame *InPtr,
+                                     XVprocSs_ModelFrame *OutPtr)
+{
+  s16 Coeff[XV_VCRSMPLR_MAX_PHASES * XV_VCRSMPLR_MAX_TAPS];
+  XV_vcresampler *CorePtr = &VcrPtr->Vcr;
+  u32 Width, Height, FormatIn, FormatOut;
+  u32 PlaneWidth, InHeight, OutHeight, Index, Phase;
+  s32 First;
+  u16 NumTaps;
+  u8 Plane;
+  int Status;
+
+  Width     = XV_vcresampler_Get_HwReg_width(CorePtr);
+  Height    = XV_vcresampler_Get_HwReg_height(CorePtr);
+  FormatIn  = XV_vcresampler_Get_HwReg_input_video_format(CorePtr);
+  FormatOut = XV_vcresampler_Get_HwReg_output_video_format(CorePtr);
+
+  if((InPtr->Width != Width) || (InPtr->Height != Height) ||
+     ((u32)InPtr->ColorFormat != FormatIn)) {
+    return(XST_FAILURE);
+  }
+
+  if(FormatIn == FormatOut) {
+    return(XVprocSs_ModelCopy(ModelPtr, InPtr, OutPtr));
+  }
+
+  if(!(((FormatIn == XVIDC_CSF_YCRCB_422) &&
+        (FormatOut == XVIDC_CSF_YCRCB_420)) ||
+       ((FormatIn == XVIDC_CSF_YCRCB_420) &&
+        (FormatOut == XVIDC_CSF_YCRCB_422)))) {
+    return(XST_FAILURE);
+  }
+
+  if(CorePtr->Config.ResamplingType == XV_VCRSMPLR_TYPE_FIR) {
+    NumTaps = CorePtr->Config.NumTaps;
+    for(Index = 0; Index < (u32)(XV_VCRSMPLR_MAX_PHASES * NumTaps); ++Index) {
+      Coeff[Index] = (s16)Xil_In32(CorePtr->Config.BaseAddress +
+                                   XV_VCRESAMPLER_CTRL_ADDR_HWREG_COEFS_0_0_DATA +
+                                   (Index * 8));
+    }
+  } else {
+    NumTaps = XVPROCSS_MODEL_CR_TAPS;
+    memcpy(Coeff,
+           XVprocSs_ModelCrCoeff[(CorePtr->Config.ResamplingType ==
+                                  XV_VCRSMPLR_TYPE_FIXED_COEFFICIENT)]
+                                [(FormatOut == XVIDC_CSF_YCRCB_422)],
+           sizeof(XVprocSs_ModelCrCoeff[0][0]));
+  }
+
+  Status = XVprocSs_ModelSetFrame(ModelPtr, OutPtr, Width, Height,
+                                  (XVidC_ColorFormat)FormatOut);
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  /* Luma passes through */
+  for(Index = 0; Index < Height; ++Index) {
+    memcpy(&OutPtr->Plane[0][Index * OutPtr->Stride[0]],
+           &InPtr->Plane[0][Index * InPtr->Stride[0]],
+           Width * sizeof(u16));
+  }
+
+  XVprocSs_ModelPlaneSize(InPtr, 1, &PlaneWidth, &InHeight);
+  XVprocSs_ModelPlaneSize(OutPtr, 1, &PlaneWidth, &OutHeight);
+
+  for(Plane = 1; Plane < 3; ++Plane) {
+    for(Index = 0; Index < OutHeight; ++Index) {
+      /* Same tap placement as the horizontal resampler */
+      if(OutHeight < InHeight) {
+        Phase = 0;
+        First = (s32)(Index * 2) - (NumTaps/2);
+      } else {
+        Phase = Index & 1;
+        First = (s32)((Index >> 1) + Phase) - (NumTaps/2);
+      }
+
+      XVprocSs_ModelFilterRows(ModelPtr, InPtr->Plane[Plane],
+                               InPtr->Stride[Plane], InHeight, First,
+                               &Coeff[Phase * NumTaps], NumTaps,
+                               &OutPtr->Plane[Plane][Index * OutPtr->Stride[Plane]],
+                               PlaneWidth);
+    }
+  }
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function models the color space converter. Each output component is
+* computed from the input components with the 3x3 matrix and the offset of
+* the registers, then clamped. With the demo window enabled, the second set
+* of registers applies inside the window.
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  CscPtr is a pointer to the CSC instance
+* @param  InPtr is a pointer to the input frame
+* @param  OutPtr is a pointer to the output frame
+*
+* @return XST_SUCCESS or XST_FAILURE
+*
+******************************************************************************/
+static int XVprocSs_ModelCsc(XVprocSs_Model *ModelPtr,
+                             XV_Csc_l2 *CscPtr,
+                             const XVprocSs_ModelFrame *InPtr,
+                             XVprocSs_ModelFrame *OutPtr)
+{
+  XV_csc *CorePtr = &CscPtr->Csc;
+  s32 K[2][3][4];
+  s32 Min[2], Max[2];
+  s32 Acc, Val;
+  u32 Width, Height, FormatIn, FormatOut;
+  u32 ColStart, ColEnd, RowStart, RowEnd;
+  u32 x, y, Row, OffsetBits;
+  u8 HSubIn, VSubIn, HSubOut, VSubOut;
+  u8 Set, Comp, Plane;
+  const u16 *In[3];
+  u16 *Out[3];
+  int Status;
+
+  Width     = XV_csc_Get_HwReg_width(CorePtr);
+  Height    = XV_csc_Get_HwReg_height(CorePtr);
+  FormatIn  = XV_csc_Get_HwReg_InVideoFormat(CorePtr);
+  FormatOut = XV_csc_Get_HwReg_OutVideoFormat(CorePtr);
+
+  if((InPtr->Width != Width) || (InPtr->Height != Height) ||
+     ((u32)InPtr->ColorFormat != FormatIn)) {
+    return(XST_FAILURE);
+  }
+
+  Status = XVprocSs_ModelSetFrame(ModelPtr, OutPtr, Width, Height,
+                                  (XVidC_ColorFormat)FormatOut);
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  /* Coefficients are 16 bit, offsets have 2 bits more than a sample */
+  K[0][0][0] = (s16)XV_csc_Get_HwReg_K11(CorePtr);
+  K[0][0][1] = (s16)XV_csc_Get_HwReg_K12(CorePtr);
+  K[0][0][2] = (s16)XV_csc_Get_HwReg_K13(CorePtr);
+  K[0][1][0] = (s16)XV_csc_Get_HwReg_K21(CorePtr);
+  K[0][1][1] = (s16)XV_csc_Get_HwReg_K22(CorePtr);
+  K[0][1][2] = (s16)XV_csc_Get_HwReg_K23(CorePtr);
+  K[0][2][0] = (s16)XV_csc_Get_HwReg_K31(CorePtr);
+  K[0][2][1] = (s16)XV_csc_Get_HwReg_K32(CorePtr);
+  K[0][2][2] = (s16)XV_csc_Get_HwReg_K33(CorePtr);
+  K[0][0][3] = (s32)XV_csc_Get_HwReg_ROffset_V(CorePtr);
+  K[0][1][3] = (s32)XV_csc_Get_HwReg_GOffset_V(CorePtr);
+  K[0][2][3] = (s32)XV_csc_Get_HwReg_BOffset_V(CorePtr);
+  Min[0] = (s32)XV_csc_Get_HwReg_ClampMin_V(CorePtr);
+  Max[0] = (s32)XV_csc_Get_HwReg_ClipMax_V(CorePtr);
+
+  if(XV_CscIsDemoWindowEnabled(CscPtr)) {
+    K[1][0][0] = (s16)XV_csc_Get_HwReg_K11_2(CorePtr);
+    K[1][0][1] = (s16)XV_csc_Get_HwReg_K12_2(CorePtr);
+    K[1][0][2] = (s16)XV_csc_Get_HwReg_K13_2(CorePtr);
+    K[1][1][0] = (s16)XV_csc_Get_HwReg_K21_2(CorePtr);
+    K[1][1][1] = (s16)XV_csc_Get_HwReg_K22_2(CorePtr);
+    K[1][1][2] = (s16)XV_csc_Get_HwReg_K23_2(CorePtr);
+    K[1][2][0] = (s16)XV_csc_Get_HwReg_K31_2(CorePtr);
+    K[1][2][1] = (s16)XV_csc_Get_HwReg_K32_2(CorePtr);
+    K[1][2][2] = (s16)XV_csc_Get_HwReg_K33_2(CorePtr);
+    K[1][0][3] = (s32)XV_csc_Get_HwReg_ROffset_2_V(CorePtr);
+    K[1][1][3] = (s32)XV_csc_Get_HwReg_GOffset_2_V(CorePtr);
+    K[1][2][3] = (s32)XV_csc_Get_HwReg_BOffset_2_V(CorePtr);
+    Min[1] = (s32)XV_csc_Get_HwReg_ClampMin_2_V(CorePtr);
+    Max[1] = (s32)XV_csc_Get_HwReg_ClipMax_2_V(CorePtr);
+
+    ColStart = XV_csc_Get_HwReg_ColStart(CorePtr);
+    ColEnd   = XV_csc_Get_HwReg_ColEnd(CorePtr);
+    RowStart = XV_csc_Get_HwReg_RowStart(CorePtr);
+    RowEnd   = XV_csc_Get_HwReg_RowEnd(CorePtr);
+  } else {
+    memcpy(K[1], K[0], sizeof(K[0]));
+    Min[1] = Min[0];
+    Max[1] = Max[0];
+    ColStart = Width;
+    ColEnd   = 0;
+    RowStart = Height;
+    RowEnd   = 0;
+  }
+
+  OffsetBits = ModelPtr->ColorDepth + 2;
+  for(Set = 0; Set < 2; ++Set) {
+    for(Comp = 0; Comp < 3; ++Comp) {
+      Val = K[Set][Comp][3] & ((1 << OffsetBits) - 1);
+      if(Val & (1 << (OffsetBits - 1))) {
+        Val -= (1 << OffsetBits);
+      }
+      K[Set][Comp][3] = Val * (1 << XVPROCSS_MODEL_COEFF_SHIFT) +
+                        XVPROCSS_MODEL_COEFF_ROUND;
+    }
+  }
+
+  HSubIn  = XVprocSs_ModelHSub(FormatIn);
+  VSubIn  = XVprocSs_ModelVSub(FormatIn);
+  HSubOut = XVprocSs_ModelHSub(FormatOut);
+  VSubOut = XVprocSs_ModelVSub(FormatOut);
+
+  for(y = 0; y < Height; ++y) {
+    for(Plane = 0; Plane < 3; ++Plane) {
+      Row = ((Plane != 0) ? (y >> VSubIn) : y);
+      In[Plane] = &InPtr->Plane[Plane][Row * InPtr->Stride[Plane]];
+      Row = ((Plane != 0) ? (y >> VSubOut) : y);
+      Out[Plane] = &OutPtr->Plane[Plane][Row * OutPtr->Stride[Plane]];
+    }
+
+    for(x = 0; x < Width; ++x) {
+      Set = ((x >= ColStart) && (x <= ColEnd) &&
+             (y >= RowStart) && (y <= RowEnd));
+
+      for(Comp = 0; Comp < 3; ++Comp) {
+        /* Subsampled chroma is written at the even luma samples only */
+        if((Comp != 0) &&
+           (((x & HSubOut) != 0) || ((y & VSubOut) != 0))) {
+          continue;
+        }
+
+        Acc = K[Set][Comp][0] * In[0][x] +
+              K[Set][Comp][1] * In[1][x >> HSubIn] +
+              K[Set][Comp][2] * In[2][x >> HSubIn] +
+              K[Set][Comp][3];
+        Val = ((Acc < 0) ? 0 : (Acc >> XVPROCSS_MODEL_COEFF_SHIFT));
+        Val = ((Val < Min[Set]) ? Min[Set] : ((Val > Max[Set]) ? Max[Set] : Val));
+        Out[Comp][(Comp != 0) ? (x >> HSubOut) : x] = (u16)Val;
+      }
+    }
+  }
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function models the letterbox. Samples outside the active window are
+* replaced by the background color.
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  LboxPtr is a pointer to the letterbox instance
+* @param  InPtr is a pointer to the input frame
+* @param  OutPtr is a pointer to the output frame
+*
+* @return XST_SUCCESS or XST_FAILURE
+*
+******************************************************************************/
+static int XVprocSs_ModelLbox(XVprocSs_Model *ModelPtr,
+                              XV_Lbox_l2 *LboxPtr,
+                              const XVprocSs_ModelFrame *InPtr,
+                              XVprocSs_ModelFrame *OutPtr)
+{
+  XV_letterbox *CorePtr = &LboxPtr->Lbox;
+  u32 Width, Height, ColStart, ColEnd, RowStart, RowEnd;
+  u32 PlaneWidth, PlaneHeight, x, y;
+  u16 Color[3];
+  u16 *RowPtr;
+  u8 Plane, HSub, VSub;
+  int Status;
+
+  Width  = XV_letterbox_Get_HwReg_width(CorePtr);
+  Height = XV_letterbox_Get_HwReg_height(CorePtr);
+
+  if((InPtr->Width != Width) || (InPtr->Height != Height) ||
+     ((u32)InPtr->ColorFormat != XV_letterbox_Get_HwReg_video_format(CorePtr))) {
+    return(XST_FAILURE);
+  }
+
+  Status = XVprocSs_ModelCopy(ModelPtr, InPtr, OutPtr);
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  ColStart = XV_letterbox_Get_HwReg_col_start(CorePtr);
+  ColEnd   = XV_letterbox_Get_HwReg_col_end(CorePtr);
+  RowStart = XV_letterbox_Get_HwReg_row_start(CorePtr);
+  RowEnd   = XV_letterbox_Get_HwReg_row_end(CorePtr);
+  Color[0] = (u16)XV_letterbox_Get_HwReg_Y_R_value(CorePtr);
+  Color[1] = (u16)XV_letterbox_Get_HwReg_Cb_G_value(CorePtr);
+  Color[2] = (u16)XV_letterbox_Get_HwReg_Cr_B_value(CorePtr);
+
+  for(Plane = 0; Plane < 3; ++Plane) {
+    XVprocSs_ModelPlaneSize(OutPtr, Plane, &PlaneWidth, &PlaneHeight);
+    HSub = ((Plane != 0) ? XVprocSs_ModelHSub(OutPtr->ColorFormat) : 0);
+    VSub = ((Plane != 0) ? XVprocSs_ModelVSub(OutPtr->ColorFormat) : 0);
+
+    for(y = 0; y < PlaneHeight; ++y) {
+      RowPtr = &OutPtr->Plane[Plane][y * OutPtr->Stride[Plane]];
+      for(x = 0; x < PlaneWidth; ++x) {
+        if(((x << HSub) < ColStart) || ((x << HSub) >= ColEnd) ||
+           ((y << VSub) < RowStart) || ((y << VSub) >= RowEnd)) {
+          RowPtr[x] = Color[Plane];
+        }
+      }
+    }
+  }
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function models the deinterlacer. The lines of the field are copied
+* to their place in the frame and the missing lines are interpolated from
+* the lines above and below.
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  DeintPtr is a pointer to the deinterlacer instance
+* @param  InPtr is a pointer to the input field
+* @param  OutPtr is a pointer to the output frame
+*
+* @return XST_SUCCESS or XST_FAILURE
+*
+* @note   Motion adaptive deinterlacing uses the previous fields stored in
+*         memory, which are not modeled. Static areas of the picture do not
+*         match the hardware.
+*
+******************************************************************************/
+static int XVprocSs_ModelDeint(XVprocSs_Model *ModelPtr,
+                               XV_Deint_l2 *DeintPtr,
+                               const XVprocSs_ModelFrame *InPtr,
+                               XVprocSs_ModelFrame *OutPtr)
+{
+  XV_deinterlacer *CorePtr = &DeintPtr->Deint;
+  const u16 *AbovePtr, *BelowPtr;
+  u16 *RowPtr;
+  u32 Width, Height, PlaneWidth, PlaneHeight;
+  u32 Line, x;
+  u8 Plane, Bottom;
+  int Status;
+
+  Width  = XV_deinterlacer_Get_width(CorePtr);
+  Height = XV_deinterlacer_Get_height(CorePtr);
+
+  if((InPtr->Width != Width) || (InPtr->Height != Height)) {
+    return(XST_FAILURE);
+  }
+
+  Status = XVprocSs_ModelSetFrame(ModelPtr, OutPtr, Width, Height * 2,
+                                  InPtr->ColorFormat);
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  Bottom = (InPtr->FieldId ^ XV_deinterlacer_Get_invert_field_id(CorePtr)) & 1;
+
+  for(Plane = 0; Plane < 3; ++Plane) {
+    XVprocSs_ModelPlaneSize(InPtr, Plane, &PlaneWidth, &PlaneHeight);
+
+    for(Line = 0; Line < PlaneHeight * 2; ++Line) {
+      RowPtr = &OutPtr->Plane[Plane][Line * OutPtr->Stride[Plane]];
+
+      if((Line & 1) == Bottom) {
+        memcpy(RowPtr, &InPtr->Plane[Plane][(Line >> 1) * InPtr->Stride[Plane]],
+               PlaneWidth * sizeof(u16));
+        continue;
+      }
+
+      /* Field lines above and below, repeated at the edges */
+      AbovePtr = &InPtr->Plane[Plane][((Line == 0) ? 0 :
+                   ((Line - 1) >> 1)) * InPtr->Stride[Plane]];
+      BelowPtr = &InPtr->Plane[Plane][((((Line + 1) >> 1) >= PlaneHeight) ?
+                   PlaneHeight - 1 : ((Line + 1) >> 1)) * InPtr->Stride[Plane]];
+      for(x = 0; x < PlaneWidth; ++x) {
+        RowPtr[x] = (u16)((AbovePtr[x] + BelowPtr[x] + 1) >> 1);
+      }
+    }
+  }
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function models the frame buffer. In zoom mode the read window is
+* cropped from the frame, in PIP mode the frame is written into the write
+* window of an output size frame. Otherwise the frame passes through.
+*
+* @param  ModelPtr is a pointer to the model instance
+* @param  XVprocSsPtr is a pointer to the subsystem instance
+* @param  InPtr is a pointer to the input frame
+* @param  OutPtr is a pointer to the output frame
+*
+* @return XST_SUCCESS or XST_FAILURE
+*
+* @note   The area outside the PIP window holds zeros, it is expected to be
+*         replaced by the letterbox.
+*
+******************************************************************************/
+static int XVprocSs_ModelVdma(XVprocSs_Model *ModelPtr,
+                              XVprocSs *XVprocSsPtr,
+                              const XVprocSs_ModelFrame *InPtr,
+                              XVprocSs_ModelFrame *OutPtr)
+{
+  const XVidC_VideoWindow *WinPtr;
+  u32 PlaneWidth, PlaneHeight, Line;
+  u32 StartX, StartY;
+  u8 Plane, HSub, VSub;
+  int Status;
+
+  if(!XVprocSsPtr->VdmaPtr ||
+     (!XVprocSs_IsZoomModeOn(XVprocSsPtr) &&
+      !XVprocSs_IsPipModeOn(XVprocSsPtr))) {
+    return(XVprocSs_ModelCopy(ModelPtr, InPtr, OutPtr));
+  }
+
+  if(XVprocSs_IsZoomModeOn(XVprocSsPtr)) {
+    WinPtr = &XVprocSsPtr->CtxtData.RdWindow;
+    if(((WinPtr->StartX + WinPtr->Width) > InPtr->Width) ||
+       ((WinPtr->StartY + WinPtr->Height) > InPtr->Height)) {
+      return(XST_FAILURE);
+    }
+    Status = XVprocSs_ModelSetFrame(ModelPtr, OutPtr, WinPtr->Width,
+                                    WinPtr->Height, InPtr->ColorFormat);
+  } else {
+    WinPtr = &XVprocSsPtr->CtxtData.WrWindow;
+    if((InPtr->Width != WinPtr->Width) || (InPtr->Height != WinPtr->Height)) {
+      return(XST_FAILURE);
+    }
+    Status = XVprocSs_ModelSetFrame(ModelPtr, OutPtr,
+                                    XVprocSsPtr->VidOut.Timing.HActive,
+                                    XVprocSsPtr->VidOut.Timing.VActive,
+                                    InPtr->ColorFormat);
+    if((Status == XST_SUCCESS) &&
+       (((WinPtr->StartX + WinPtr->Width) > OutPtr->Width) ||
+        ((WinPtr->StartY + WinPtr->Height) > OutPtr->Height))) {
+      Status = XST_FAILURE;
+    }
+  }
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  HSub = XVprocSs_ModelHSub(InPtr->ColorFormat);
+  VSub = XVprocSs_ModelVSub(InPtr->ColorFormat);
+
+  for(Plane = 0; Plane < 3; ++Plane) {
+    StartX = ((Plane != 0) ? (WinPtr->StartX >> HSub) : WinPtr->StartX);
+    StartY = ((Plane != 0) ? (WinPtr->StartY >> VSub) : WinPtr->StartY);
+
+    if(XVprocSs_IsZoomModeOn(XVprocSsPtr)) {
+      XVprocSs_ModelPlaneSize(OutPtr, Plane, &PlaneWidth, &PlaneHeight);
+      for(Line = 0; Line < PlaneHeight; ++Line) {
+        memcpy(&OutPtr->Plane[Plane][Line * OutPtr->Stride[Plane]],
+               &InPtr->Plane[Plane][(StartY + Line) * InPtr->Stride[Plane] +
+                                    StartX],
+               PlaneWidth * sizeof(u16));
+      }
+    } else {
+      XVprocSs_ModelPlaneSize(OutPtr, Plane, &PlaneWidth, &PlaneHeight);
+      for(Line = 0; Line < PlaneHeight; ++Line) {
+        memset(&OutPtr->Plane[Plane][Line * OutPtr->Stride[Plane]], 0,
+               PlaneWidth * sizeof(u16));
+      }
+      XVprocSs_ModelPlaneSize(InPtr, Plane, &PlaneWidth, &PlaneHeight);
+      for(Line = 0; Line < PlaneHeight; ++Line) {
+        memcpy(&OutPtr->Plane[Plane][(StartY + Line) * OutPtr->Stride[Plane] +
+                                     StartX],
+               &InPtr->Plane[Plane][Line * InPtr->Stride[Plane]],
+               PlaneWidth * sizeof(u16));
+      }
+    }
+  }
+
+  return(XST_SUCCESS);
+}
+/** @} */
@@ -0,0 +1,134 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xvprocss_model.h
+* @addtogroup vprocss Overview
+* @{
+* @details
+*
+* This header file contains the software model of the video processing
+* pipe. The model runs a frame through the sub-cores of the subsystem the
+* way the hardware would, using the values the drivers programmed in the
+* sub-core registers: sizes, color formats, scaling rates, filter
+* coefficients, color matrices and windows. It can be used as a golden
+* reference to check a configuration on the host, or to process frames in
+* software when the hardware is not available. The model is not part of the
+* driver library, it is built on the host only.
+*
+* <b>Frames</b>
+*
+* A frame holds one 16 bit plane per color component. The chroma planes of
+* a 4:2:2 frame have half the width, the chroma planes of a 4:2:0 frame have
+* half the width and half the height. Samples use the color depth of the
+* subsystem.
+*
+* <b>Memory</b>
+*
+* The model needs XVPROCSS_MODEL_MEM_SIZE() bytes of 4 byte aligned memory,
+* provided by the user to XVprocSs_ModelInit(), for the intermediate frames
+* and the filter tables.
+*
+* <b>Accuracy</b>
+*
+* The scalers, the chroma resamplers, the color space converter, the
+* letterbox and the frame buffer windows are modeled sample for sample. The
+* deinterlacer is modeled by line interpolation of the current field only,
+* motion adaptive deinterlacing is not modeled. Only polyphase scalers are
+* modeled, and the H scaler can only convert between YUV sampling formats.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 2.13  kt   10/18/26 Initial Release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XVPROCSS_MODEL_H__  /* prevent circular inclusions */
+#define XVPROCSS_MODEL_H__  /* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xvprocss.h"
+/************************** Constant Definitions *****************************/
+/** @name Model Limits
+ * @{
+ * Maximum number of filter taps of a modeled sub-core
+ */
+#define XVPROCSS_MODEL_MAX_TAPS    (12)
+/*@}*/
+
+/**************************** Type Definitions *******************************/
+/**
+ * This typedef contains a frame processed by the model
+ */
+typedef struct
+{
+  u32 Width;                     /**< Active pixels per line */
+  u32 Height;                    /**< Active lines, of one field if interlaced */
+  XVidC_ColorFormat ColorFormat; /**< RGB, YUV 4:4:4, 4:2:2 or 4:2:0 */
+  u8 FieldId;                    /**< Field of an interlaced frame, 0 = top */
+  u16 *Plane[3];                 /**< R/Y, G/U and B/V component planes */
+  u32 Stride[3];                 /**< Samples per line of each plane */
+}XVprocSs_ModelFrame;
+
+/**
+ * This typedef contains the model state. Its memory is provided by the user
+ */
+typedef struct
+{
+  u32 MaxWidth;                  /**< Maximum width of a frame */
+  u32 MaxHeight;                 /**< Maximum height of a frame */
+  u8 ColorDepth;                 /**< Bits per component */
+  u16 MaxValue;                  /**< Largest sample value */
+  s32 *Acc;                      /**< Accumulators of one line */
+  u32 *TapStart;                 /**< First input sample of each output */
+  u32 *Position;                 /**< H scaler input position of each output */
+  s16 *TapCoeff;                 /**< Coefficients of each output */
+  u16 *Line;                     /**< Input line with repeated edges */
+  XVprocSs_ModelFrame Frame[2];  /**< Frames between two stages */
+}XVprocSs_Model;
+
+/************************** Macros Definitions *******************************/
+
+/*****************************************************************************/
+/**
+ * This macro returns the number of bytes of memory needed by the model
+ *
+ * @param  MaxWidth is the largest width of a frame in the pipe
+ * @param  MaxHeight is the largest height of a frame in the pipe
+ *
+ * @return Number of bytes
+ *
+ *****************************************************************************/
+#define XVPROCSS_MODEL_MEM_SIZE(MaxWidth, MaxHeight) \
+  ((MaxWidth) * (sizeof(s32) + 2 * sizeof(u32) + \
+                 XVPROCSS_MODEL_MAX_TAPS * sizeof(s16)) + \
+   ((MaxWidth) + 2 * XVPROCSS_MODEL_MAX_TAPS) * sizeof(u16) + \
+   2 * 3 * (MaxWidth) * (MaxHeight) * sizeof(u16))
+
+/************************** Function Prototypes ******************************/
+int XVprocSs_ModelInit(XVprocSs_Model *ModelPtr,
+                       void *MemPtr,
+                       u32 MaxWidth,
+                       u32 MaxHeight);
+int XVprocSs_ModelRun(XVprocSs_Model *ModelPtr,
+                      XVprocSs *XVprocSsPtr,
+                      const XVprocSs_ModelFrame *InPtr,
+                      XVprocSs_ModelFrame *OutPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/** @} */
@@ -0,0 +1,1067 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xvprocss_model_test.c
+*
+* Host regression test of the software model of the processing pipe against
+* a software model of the sub-core registers. It is not a target example: it
+* is built and run with the other driver model tests by
+* make -C scripts/host_model.
+*
+* The scaler only pipe is set up by XV_VScalerSetup() and XV_HScalerSetup()
+* for all pixels per clock and numbers of taps, with scaling up and down and
+* conversions between 4:4:4 and 4:2:2. The model, which replays the phase
+* registers of the H scaler, must produce the same frame as a direct
+* reference filter that steps the rate registers the way the hardware does.
+* The model must also reject a frame that does not match the scaler sizes,
+* and phase registers that do not hold the output line.
+*
+* The other sub-cores are set up by their layer 2 drivers and run alone,
+* each against a direct reference that does not read the core registers:
+* - the CSC against the coefficient sets of the driver, from
+*   XV_CscSetColorspace() outside the demo window and from
+*   cscFwComputeCoeff() with the brightness inside, and against the BT.709
+*   equations for RGB to YCbCr,
+* - the chroma resamplers for every resampling type and number of taps,
+*   against the coefficient tables of the drivers,
+* - the letterbox against the window and the background color,
+* - the deinterlacer for both fields and both field id polarities.
+*
+* At last a 1080p frame is scaled and converted, and the time per frame of
+* the model is printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 2.13  kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xvprocss_model.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define CORE_SPAN	0x8000U		/* Register space of a core */
+#define NUM_CORES	7U		/* Sub-cores of the tests */
+#define MAX_WIDTH	512U		/* Largest frame of the tests */
+#define MAX_HEIGHT	128U
+#define COLOR_DEPTH	10U
+#define STEP_SHIFT	16U		/* Fractional bits of the rate registers */
+#define SUB_WIDTH	320U		/* Frame of the other sub-cores */
+#define SUB_HEIGHT	60U
+#define CSC_BASE	(3U * CORE_SPAN)
+#define HCR_BASE	(4U * CORE_SPAN)
+#define VCR_BASE	(5U * CORE_SPAN)
+#define LBOX_BASE	(6U * CORE_SPAN)
+#define DEINT_BASE	(7U * CORE_SPAN)
+#define BT709_ERROR	2	/* Largest difference to the BT.709 equations */
+#define TIMED_WIDTH	1920U		/* Frame of the timed run */
+#define TIMED_HEIGHT	1080U
+#define TIMED_FRAMES	4U
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define CORE(Addr)	((u32)((Addr) / CORE_SPAN) - 1U)
+#define NUM_MODES	(sizeof(Modes) / sizeof(Modes[0]))
+#define NUM_FORMATS	(sizeof(Formats) / sizeof(Formats[0]))
+#define NUM_CSC_MODES	(sizeof(CscModes) / sizeof(CscModes[0]))
+#define HSUB(Format)	((u32)((Format) == XVIDC_CSF_YCRCB_422) | \
+			 (u32)((Format) == XVIDC_CSF_YCRCB_420))
+#define VSUB(Format)	((u32)((Format) == XVIDC_CSF_YCRCB_420))
+#define CLAMP(Val, Min, Max) \
+	(((Val) < (Min)) ? (Min) : (((Val) > (Max)) ? (Max) : (Val)))
+
+/************************** Function Prototypes ******************************/
+
+static void CoreInit(u32 PixPerClk, u32 NumTaps);
+static void FrameAlloc(XVprocSs_ModelFrame *FramePtr);
+static void Reference(const u16 *InPtr, u32 InStep, u32 InStride, u32 SizeIn,
+		      u32 SizeOut, u32 Lines, u64 Rate, const short *CoeffPtr,
+		      u32 NumTaps, u16 *OutPtr, u32 OutStep, u32 OutStride);
+static u32 RunMode(u32 Mode, u32 Format);
+static void RunConfig(u32 PixPerClk, u32 NumTaps);
+static u32 CompareFrame(const char *What, const XVprocSs_ModelFrame *FramePtr);
+static void RunCsc(u32 Mode);
+static void RunHcr(u32 Type, u32 NumTaps, u32 Down);
+static void RunVcr(u32 Type, u32 NumTaps, u32 Down);
+static u16 Resample(const u16 *InPtr, u32 InStep, u32 SizeIn, u32 Out,
+		    u32 Down, u32 Type, const short *TablePtr, u32 NumTaps);
+static void RunLbox(XVidC_ColorFormat Format, XLboxColorId ColorId);
+static void RunDeint(u8 FieldId, u8 Invert);
+static void RunTimed(void);
+static void SubsystemInit(u8 Topology);
+static void CscInit(u32 Mode, u32 Width, u32 Height);
+static u16 InSample(const u16 *InPtr, u32 InStep, u32 SizeIn, s32 Index);
+
+/************************** Variable Definitions *****************************/
+
+static u32 Regs[NUM_CORES][CORE_SPAN / 4U];
+static XV_Hscaler_l2 Hsc;
+static XV_Vscaler_l2 Vsc;
+static XV_Csc_l2 Csc;
+static XV_Hcresampler_l2 Hcr;
+static XV_Vcresampler_l2 Vcr;
+static XV_Lbox_l2 Lbox;
+static XV_Deint_l2 Deint;
+static XVprocSs VprocSs;
+static XVprocSs_Model Model;
+static XVprocSs_ModelFrame In, Mid, Out, Ref;
+
+/* Configuration tables of the SDT initialization, the cores are set up by
+ * their CfgInitialize() for each configuration */
+XV_hscaler_Config XV_hscaler_ConfigTable[] = { { NULL } };
+XV_vscaler_Config XV_vscaler_ConfigTable[] = { { NULL } };
+XV_csc_Config XV_csc_ConfigTable[] = { { NULL } };
+XV_hcresampler_Config XV_hcresampler_ConfigTable[] = { { NULL } };
+XV_vcresampler_Config XV_vcresampler_ConfigTable[] = { { NULL } };
+XV_letterbox_Config XV_letterbox_ConfigTable[] = { { NULL } };
+
+extern const short XV_hcrsmplrcoeff_taps4[XV_HCRSMPLR_NUM_CONVERSIONS][XV_HCRSMPLR_MAX_PHASES][XV_HCRSMPLR_TAPS_4];
+extern const short XV_hcrsmplrcoeff_taps6[XV_HCRSMPLR_NUM_CONVERSIONS][XV_HCRSMPLR_MAX_PHASES][XV_HCRSMPLR_TAPS_6];
+extern const short XV_hcrsmplrcoeff_taps8[XV_HCRSMPLR_NUM_CONVERSIONS][XV_HCRSMPLR_MAX_PHASES][XV_HCRSMPLR_TAPS_8];
+extern const short XV_hcrsmplrcoeff_taps10[XV_HCRSMPLR_NUM_CONVERSIONS][XV_HCRSMPLR_MAX_PHASES][XV_HCRSMPLR_TAPS_10];
+extern const short XV_vcrsmplrcoeff_taps4[XV_VCRSMPLR_NUM_CONVERSIONS][XV_VCRSMPLR_MAX_PHASES][XV_VCRSMPLR_TAPS_4];
+extern const short XV_vcrsmplrcoeff_taps6[XV_VCRSMPLR_NUM_CONVERSIONS][XV_VCRSMPLR_MAX_PHASES][XV_VCRSMPLR_TAPS_6];
+extern const short XV_vcrsmplrcoeff_taps8[XV_VCRSMPLR_NUM_CONVERSIONS][XV_VCRSMPLR_MAX_PHASES][XV_VCRSMPLR_TAPS_8];
+extern const short XV_vcrsmplrcoeff_taps10[XV_VCRSMPLR_NUM_CONVERSIONS][XV_VCRSMPLR_MAX_PHASES][XV_VCRSMPLR_TAPS_10];
+
+/* Chroma resampler tables by number of taps, 4 to 10 */
+static const short *const HcrTables[] = {
+	&XV_hcrsmplrcoeff_taps4[0][0][0], &XV_hcrsmplrcoeff_taps6[0][0][0],
+	&XV_hcrsmplrcoeff_taps8[0][0][0], &XV_hcrsmplrcoeff_taps10[0][0][0],
+};
+static const short *const VcrTables[] = {
+	&XV_vcrsmplrcoeff_taps4[0][0][0], &XV_vcrsmplrcoeff_taps6[0][0][0],
+	&XV_vcrsmplrcoeff_taps8[0][0][0], &XV_vcrsmplrcoeff_taps10[0][0][0],
+};
+
+/* CSC conversions: input and output format and standard */
+static const struct {
+	XVidC_ColorFormat FormatIn;
+	XVidC_ColorFormat FormatOut;
+	XVidC_ColorStd StdIn;
+	XVidC_ColorStd StdOut;
+} CscModes[] = {
+	{ XVIDC_CSF_RGB, XVIDC_CSF_YCRCB_444, XVIDC_BT_709, XVIDC_BT_709 },
+	{ XVIDC_CSF_YCRCB_444, XVIDC_CSF_RGB, XVIDC_BT_601, XVIDC_BT_601 },
+	{ XVIDC_CSF_YCRCB_444, XVIDC_CSF_YCRCB_444, XVIDC_BT_601,
+	  XVIDC_BT_709 },
+	{ XVIDC_CSF_RGB, XVIDC_CSF_YCRCB_422, XVIDC_BT_709, XVIDC_BT_709 },
+	{ XVIDC_CSF_YCRCB_422, XVIDC_CSF_RGB, XVIDC_BT_2020, XVIDC_BT_2020 },
+	{ XVIDC_CSF_RGB, XVIDC_CSF_YCRCB_420, XVIDC_BT_601, XVIDC_BT_601 },
+};
+
+/* Demo window of the CSC, letterbox window */
+static XVidC_VideoWindow Window = { 40U, 10U, 200U, 36U };
+
+/* Input and output sizes, width and height, down and up scaling */
+static const u32 Modes[][4] = {
+	{ 256U,  64U, 192U,  48U }, { 128U,  32U, 400U,  80U },
+	{ 320U,  60U, 320U,  60U }, { 304U,  40U, 128U, 100U },
+	{ 512U, 128U,  64U,  16U },
+};
+
+/* Input and output color formats of the H scaler */
+static const XVidC_ColorFormat Formats[][2] = {
+	{ XVIDC_CSF_YCRCB_444, XVIDC_CSF_YCRCB_444 },
+	{ XVIDC_CSF_YCRCB_422, XVIDC_CSF_YCRCB_422 },
+	{ XVIDC_CSF_YCRCB_444, XVIDC_CSF_YCRCB_422 },
+	{ XVIDC_CSF_YCRCB_422, XVIDC_CSF_YCRCB_444 },
+};
+
+/*****************************************************************************/
+/*
+* Register model: plain memory for each core.
+*/
+u32 Xil_In32(UINTPTR Addr)
+{
+	return Regs[CORE(Addr)][(Addr % CORE_SPAN) / 4U];
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	Regs[CORE(Addr)][(Addr % CORE_SPAN) / 4U] = Value;
+}
+
+static void CoreInit(u32 PixPerClk, u32 NumTaps)
+{
+	XV_hscaler_Config HscCfg;
+	XV_vscaler_Config VscCfg;
+
+	memset(Regs, 0, sizeof(Regs));
+	memset(&HscCfg, 0, sizeof(HscCfg));
+	HscCfg.Name = "hscaler";
+	HscCfg.PixPerClk = (u16)PixPerClk;
+	HscCfg.MaxWidth = 4096U;
+	HscCfg.MaxHeight = 2160U;
+	HscCfg.PhaseShift = 6U;
+	HscCfg.NumTaps = (u16)NumTaps;
+	HscCfg.ScalerType = XV_HSCALER_POLYPHASE;
+	HscCfg.Is422Enabled = 1U;
+	HscCfg.Is420Enabled = 1U;
+	memset(&Hsc, 0, sizeof(Hsc));
+	(void)XV_hscaler_CfgInitialize(&Hsc.Hsc, &HscCfg, CORE_SPAN);
+
+	memset(&VscCfg, 0, sizeof(VscCfg));
+	VscCfg.Name = "vscaler";
+	VscCfg.PixPerClk = (u16)PixPerClk;
+	VscCfg.MaxWidth = 4096U;
+	VscCfg.MaxHeight = 2160U;
+	VscCfg.PhaseShift = 6U;
+	VscCfg.NumTaps = (u16)NumTaps;
+	VscCfg.ScalerType = XV_VSCALER_POLYPHASE;
+	VscCfg.Is420Enabled = 1U;
+	memset(&Vsc, 0, sizeof(Vsc));
+	(void)XV_vscaler_CfgInitialize(&Vsc.Vsc, &VscCfg, 2U * CORE_SPAN);
+
+	memset(&VprocSs, 0, sizeof(VprocSs));
+	VprocSs.Config.Topology = XVPROCSS_TOPOLOGY_SCALER_ONLY;
+	VprocSs.Config.ColorDepth = COLOR_DEPTH;
+	VprocSs.HscalerPtr = &Hsc;
+	VprocSs.VscalerPtr = &Vsc;
+}
+
+static void FrameAlloc(XVprocSs_ModelFrame *FramePtr)
+{
+	u32 Plane;
+
+	for (Plane = 0U; Plane < 3U; Plane++) {
+		FramePtr->Plane[Plane] = calloc(MAX_WIDTH * MAX_HEIGHT,
+						sizeof(u16));
+		FramePtr->Stride[Plane] = MAX_WIDTH;
+	}
+}
+
+/*****************************************************************************/
+/*
+* Direct polyphase filter of one plane, line after line. Output sample n is
+* centered on input sample (n * Rate), Rate with STEP_SHIFT + 1 fractional
+* bits. The coefficients are the driver tables of XV_HSCALER_MAX_H_TAPS
+* taps per phase, centered.
+*/
+static void Reference(const u16 *InPtr, u32 InStep, u32 InStride, u32 SizeIn,
+		      u32 SizeOut, u32 Lines, u64 Rate, const short *CoeffPtr,
+		      u32 NumTaps, u16 *OutPtr, u32 OutStep, u32 OutStride)
+{
+	u32 Skip = (XV_HSCALER_MAX_H_TAPS - NumTaps) / 2U;
+	u64 Offset;
+	u32 Line;
+	u32 Phase;
+	u32 Tap;
+	u32 Index;
+	s64 Sample;
+	s64 Acc;
+
+	for (Line = 0U; Line < Lines; Line++) {
+		for (Index = 0U; Index < SizeOut; Index++) {
+			Offset = Index * Rate;
+			Phase = (u32)(Offset >> (STEP_SHIFT + 1U - 6U)) & 63U;
+			Acc = 1 << 11;
+			for (Tap = 0U; Tap < NumTaps; Tap++) {
+				Sample = (s64)(Offset >> (STEP_SHIFT + 1U)) +
+					 Tap - (NumTaps / 2U - 1U);
+				Sample = (Sample < 0) ? 0 :
+					 ((Sample >= (s64)SizeIn) ?
+					  (s64)SizeIn - 1 : Sample);
+				Acc += (s64)CoeffPtr[(Phase *
+						      XV_HSCALER_MAX_H_TAPS) +
+						     Skip + Tap] *
+				       InPtr[(Line * InStride) +
+					     ((u32)Sample * InStep)];
+			}
+			Acc = (Acc < 0) ? 0 : (Acc >> 12);
+			OutPtr[(Line * OutStride) + (Index * OutStep)] =
+				(u16)((Acc > ((1 << COLOR_DEPTH) - 1)) ?
+				      ((1 << COLOR_DEPTH) - 1) : Acc);
+		}
+	}
+}
+
+/*****************************************************************************/
+/*
+* One size and color format: the model output must match the reference, and
+* the model must reject a wrong frame and cleared phase registers. Returns
+* the number of mismatching samples.
+*/
+static u32 RunMode(u32 Mode, u32 Format)
+{
+	u32 WidthIn = Modes[Mode][0];
+	u32 HeightIn = Modes[Mode][1];
+	u32 WidthOut = Modes[Mode][2];
+	u32 HeightOut = Modes[Mode][3];
+	u32 NumTaps = Hsc.Hsc.Config.NumTaps;
+	u32 Bad = 0U;
+	u32 InShift;
+	u32 OutShift;
+	u32 Plane;
+	u32 Line;
+	u32 Index;
+	u64 Rate;
+
+	In.Width = WidthIn;
+	In.Height = HeightIn;
+	In.ColorFormat = Formats[Format][0];
+	XHOST_CHECK(XV_VScalerSetup(&Vsc, WidthIn, HeightIn, HeightOut,
+				    Formats[Format][0]) == XST_SUCCESS,
+		    "V setup %u", (unsigned)Mode);
+	XHOST_CHECK(XV_HScalerSetup(&Hsc, HeightOut, WidthIn, WidthOut,
+				    Formats[Format][0], Formats[Format][1]) ==
+		    XST_SUCCESS, "H setup %u", (unsigned)Mode);
+	if (XVprocSs_ModelRun(&Model, &VprocSs, &In, &Out) != XST_SUCCESS) {
+		XHOST_CHECK(0, "mode %u format %u: model failed",
+			    (unsigned)Mode, (unsigned)Format);
+		return 1U;
+	}
+	XHOST_CHECK((Out.Width == WidthOut) && (Out.Height == HeightOut) &&
+		    (Out.ColorFormat == Formats[Format][1]),
+		    "mode %u format %u: output %ux%u", (unsigned)Mode,
+		    (unsigned)Format, (unsigned)Out.Width,
+		    (unsigned)Out.Height);
+
+	for (Plane = 0U; Plane < 3U; Plane++) {
+		InShift = ((Plane != 0U) &&
+			   (Formats[Format][0] == XVIDC_CSF_YCRCB_422)) ? 1U : 0U;
+		OutShift = ((Plane != 0U) &&
+			    (Formats[Format][1] == XVIDC_CSF_YCRCB_422)) ? 1U : 0U;
+
+		/* Columns, then lines of the plane */
+		Rate = (u64)XV_vscaler_Get_HwReg_LineRate(&Vsc.Vsc) << 1U;
+		Reference(In.Plane[Plane], MAX_WIDTH, 1U, HeightIn, HeightOut,
+			  WidthIn >> InShift, Rate, &Vsc.coeff[0][0], NumTaps,
+			  Mid.Plane[Plane], MAX_WIDTH, 1U);
+		Rate = (((u64)XV_hscaler_Get_HwReg_PixelRate(&Hsc.Hsc) << 1U) <<
+			OutShift) >> InShift;
+		Reference(Mid.Plane[Plane], 1U, MAX_WIDTH, WidthIn >> InShift,
+			  WidthOut >> OutShift, HeightOut, Rate,
+			  &Hsc.coeff[0][0], NumTaps, Ref.Plane[Plane], 1U,
+			  MAX_WIDTH);
+
+		for (Line = 0U; Line < HeightOut; Line++) {
+			for (Index = 0U; Index < (WidthOut >> OutShift);
+			     Index++) {
+				if (Out.Plane[Plane][(Line * MAX_WIDTH) + Index] !=
+				    Ref.Plane[Plane][(Line * MAX_WIDTH) + Index]) {
+					Bad++;
+				}
+			}
+		}
+	}
+	XHOST_CHECK(Bad == 0U, "mode %u format %u: %u samples differ",
+		    (unsigned)Mode, (unsigned)Format, (unsigned)Bad);
+
+	In.Width = WidthIn + 2U;
+	XHOST_CHECK(XVprocSs_ModelRun(&Model, &VprocSs, &In, &Out) ==
+		    XST_FAILURE, "mode %u: wrong width accepted",
+		    (unsigned)Mode);
+	In.Width = WidthIn;
+	memset(&Regs[0][XV_HSCALER_CTRL_ADDR_HWREG_PHASESH_V_BASE / 4U], 0,
+	       CORE_SPAN - XV_HSCALER_CTRL_ADDR_HWREG_PHASESH_V_BASE);
+	XHOST_CHECK(XVprocSs_ModelRun(&Model, &VprocSs, &In, &Out) ==
+		    XST_FAILURE, "mode %u: cleared phases accepted",
+		    (unsigned)Mode);
+
+	return Bad;
+}
+
+static void RunConfig(u32 PixPerClk, u32 NumTaps)
+{
+	u32 Bad = 0U;
+	u32 Mode;
+	u32 Format;
+
+	CoreInit(PixPerClk, NumTaps);
+	for (Mode = 0U; Mode < NUM_MODES; Mode++) {
+		for (Format = 0U; Format < NUM_FORMATS; Format++) {
+			Bad += RunMode(Mode, Format);
+		}
+	}
+	printf("%u ppc %2u taps: %u frames, %u samples differ\n",
+	       (unsigned)PixPerClk, (unsigned)NumTaps,
+	       (unsigned)(NUM_MODES * NUM_FORMATS), (unsigned)Bad);
+}
+
+/*****************************************************************************/
+/*
+* Subsystem of one topology, without sub-cores.
+*/
+static void SubsystemInit(u8 Topology)
+{
+	memset(&VprocSs, 0, sizeof(VprocSs));
+	VprocSs.Config.Topology = Topology;
+	VprocSs.Config.ColorDepth = COLOR_DEPTH;
+}
+
+/*****************************************************************************/
+/*
+* Compares the output frame with the reference frame Ref, of the size and
+* format of FramePtr. Returns the number of mismatching samples.
+*/
+static u32 CompareFrame(const char *What, const XVprocSs_ModelFrame *FramePtr)
+{
+	u32 Bad = 0U;
+	u32 Width;
+	u32 Height;
+	u32 Plane;
+	u32 Line;
+	u32 Index;
+
+	XHOST_CHECK((Out.Width == FramePtr->Width) &&
+		    (Out.Height == FramePtr->Height) &&
+		    (Out.ColorFormat == FramePtr->ColorFormat),
+		    "%s: output %ux%u format %u", What, (unsigned)Out.Width,
+		    (unsigned)Out.Height, (unsigned)Out.ColorFormat);
+	for (Plane = 0U; Plane < 3U; Plane++) {
+		Width = FramePtr->Width >>
+			((Plane != 0U) ? HSUB(FramePtr->ColorFormat) : 0U);
+		Height = FramePtr->Height >>
+			 ((Plane != 0U) ? VSUB(FramePtr->ColorFormat) : 0U);
+		for (Line = 0U; Line < Height; Line++) {
+			for (Index = 0U; Index < Width; Index++) {
+				if (Out.Plane[Plane][(Line * MAX_WIDTH) + Index] !=
+				    Ref.Plane[Plane][(Line * MAX_WIDTH) + Index]) {
+					Bad++;
+				}
+			}
+		}
+	}
+	XHOST_CHECK(Bad == 0U, "%s: %u samples differ", What, (unsigned)Bad);
+
+	return Bad;
+}
+
+/*****************************************************************************/
+/*
+* CSC of a conversion of CscModes, with the demo window at Window and the
+* brightness raised inside.
+*/
+static void CscInit(u32 Mode, u32 Width, u32 Height)
+{
+	XV_csc_Config Cfg;
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	Cfg.Name = "csc";
+	Cfg.PixPerClk = XVIDC_PPC_2;
+	Cfg.MaxWidth = 4096U;
+	Cfg.MaxHeight = 2160U;
+	Cfg.MaxDataWidth = COLOR_DEPTH;
+	Cfg.Is422Enabled = 1U;
+	Cfg.Is420Enabled = 1U;
+	Cfg.IsDemoWindowEnabled = 1U;
+	memset(&Csc, 0, sizeof(Csc));
+	(void)XV_csc_CfgInitialize(&Csc.Csc, &Cfg, CSC_BASE);
+	XV_CscSetPowerOnDefaultState(&Csc);
+	XV_CscSetColorDepth(&Csc, COLOR_DEPTH);
+	XV_CscSetActiveSize(&Csc, Width, Height);
+	XHOST_CHECK(XV_CscSetColorspace(&Csc, CscModes[Mode].FormatIn,
+					CscModes[Mode].FormatOut,
+					CscModes[Mode].StdIn,
+					CscModes[Mode].StdOut,
+					XVIDC_CR_0_255) == XST_SUCCESS,
+		    "CSC mode %u: color space", (unsigned)Mode);
+	XHOST_CHECK(XV_CscSetDemoWindow(&Csc, &Window) == XST_SUCCESS,
+		    "CSC mode %u: demo window", (unsigned)Mode);
+	XV_CscSetBrightness(&Csc, 70);
+
+	SubsystemInit(XVPROCSS_TOPOLOGY_CSC_ONLY);
+	VprocSs.CscPtr = &Csc;
+}
+
+/*****************************************************************************/
+/*
+* One CSC conversion. The reference applies the coefficient set the driver
+* computed for the area, from its layer 2 register bank. RGB to BT.709 is
+* also checked against the equations of the standard outside the window.
+*/
+static void RunCsc(u32 Mode)
+{
+	XVidC_ColorFormat FormatIn = CscModes[Mode].FormatIn;
+	XVidC_ColorFormat FormatOut = CscModes[Mode].FormatOut;
+	const s32 *RegPtr;
+	double Luma;
+	double Expect[3];
+	double MaxError = 0.0;
+	s32 Pixel[3];
+	s32 Acc;
+	s32 Val;
+	u32 Inside;
+	u32 Comp;
+	u32 x;
+	u32 y;
+	char What[32];
+
+	CscInit(Mode, SUB_WIDTH, SUB_HEIGHT);
+	In.Width = SUB_WIDTH;
+	In.Height = SUB_HEIGHT;
+	In.ColorFormat = FormatIn;
+	if (XVprocSs_ModelRun(&Model, &VprocSs, &In, &Out) != XST_SUCCESS) {
+		XHOST_CHECK(0, "CSC mode %u: model failed", (unsigned)Mode);
+		return;
+	}
+
+	Ref.Width = SUB_WIDTH;
+	Ref.Height = SUB_HEIGHT;
+	Ref.ColorFormat = FormatOut;
+	for (y = 0U; y < SUB_HEIGHT; y++) {
+		for (x = 0U; x < SUB_WIDTH; x++) {
+			Inside = (x >= Window.StartX) &&
+				 (x < (Window.StartX + Window.Width)) &&
+				 (y >= Window.StartY) &&
+				 (y < (Window.StartY + Window.Height));
+			RegPtr = &Csc.regMap[Inside ? CSC_FW_REG_K11_2 :
+					     CSC_FW_REG_K11];
+			Pixel[0] = In.Plane[0][(y * MAX_WIDTH) + x];
+			for (Comp = 1U; Comp < 3U; Comp++) {
+				Pixel[Comp] = In.Plane[Comp][((y >> VSUB(FormatIn)) *
+							      MAX_WIDTH) +
+							     (x >> HSUB(FormatIn))];
+			}
+
+			for (Comp = 0U; Comp < 3U; Comp++) {
+				Acc = (RegPtr[Comp * 3U] * Pixel[0]) +
+				      (RegPtr[(Comp * 3U) + 1U] * Pixel[1]) +
+				      (RegPtr[(Comp * 3U) + 2U] * Pixel[2]) +
+				      (RegPtr[9U + Comp] * 4096) + 2048;
+				Val = (Acc < 0) ? 0 : (Acc >> 12);
+				Val = CLAMP(Val, RegPtr[12], RegPtr[13]);
+				if (Comp == 0U) {
+					Ref.Plane[0][(y * MAX_WIDTH) + x] = (u16)Val;
+				} else if (((x & HSUB(FormatOut)) == 0U) &&
+					   ((y & VSUB(FormatOut)) == 0U)) {
+					Ref.Plane[Comp][((y >> VSUB(FormatOut)) *
+							 MAX_WIDTH) +
+							(x >> HSUB(FormatOut))] =
+						(u16)Val;
+				}
+			}
+
+			if ((Mode != 0U) || Inside) {
+				continue;
+			}
+			/* BT.709, the limited range of 10 bits */
+			Luma = (0.2126 * Pixel[0]) + (0.7152 * Pixel[1]) +
+			       (0.0722 * Pixel[2]);
+			Expect[0] = 64.0 + ((219.0 / 255.0) * Luma);
+			Expect[1] = 512.0 + ((224.0 / 255.0) *
+					     (Pixel[2] - Luma) / 1.8556);
+			Expect[2] = 512.0 + ((224.0 / 255.0) *
+					     (Pixel[0] - Luma) / 1.5748);
+			for (Comp = 0U; Comp < 3U; Comp++) {
+				Expect[Comp] = CLAMP(Expect[Comp],
+						     (double)RegPtr[12],
+						     (double)RegPtr[13]);
+				MaxError = fmax(MaxError,
+						fabs(Out.Plane[Comp][(y * MAX_WIDTH) +
+								     x] -
+						     Expect[Comp]));
+			}
+		}
+	}
+
+	snprintf(What, sizeof(What), "CSC mode %u", (unsigned)Mode);
+	(void)CompareFrame(What, &Ref);
+	if (Mode == 0U) {
+		printf("CSC RGB to BT.709: %.2f largest difference to the "
+		       "equations\n", MaxError);
+		XHOST_CHECK(MaxError <= BT709_ERROR, "CSC BT.709: %.2f",
+			    MaxError);
+	}
+}
+
+/*****************************************************************************/
+/*
+* Input sample Index of a line or column, repeated at the edges.
+*/
+static u16 InSample(const u16 *InPtr, u32 InStep, u32 SizeIn, s32 Index)
+{
+	return InPtr[(u32)CLAMP(Index, 0, (s32)SizeIn - 1) * InStep];
+}
+
+/*****************************************************************************/
+/*
+* Output chroma sample Out of a line or column. Down sampling keeps the even
+* input samples, up sampling puts the even outputs on the input samples and
+* the odd ones half way to the next. The filter taps of an output start at
+* its input position, rounded up, less half the taps.
+*/
+static u16 Resample(const u16 *InPtr, u32 InStep, u32 SizeIn, u32 Out,
+		    u32 Down, u32 Type, const short *TablePtr, u32 NumTaps)
+{
+	u32 Phase = Down ? 0U : (Out & 1U);
+	s32 Pos = Down ? (s32)(2U * Out) : (s32)((Out + 1U) >> 1);
+	s32 Acc = 1 << 11;
+	u32 Tap;
+
+	if (Type == XV_HCRSMPLR_TYPE_NEAREST_NEIGHBOR) {
+		return InSample(InPtr, InStep, SizeIn,
+				Down ? Pos : (s32)(Out >> 1));
+	}
+	if (Type == XV_HCRSMPLR_TYPE_FIXED_COEFFICIENT) {
+		if (Down) {
+			return (u16)((InSample(InPtr, InStep, SizeIn, Pos - 1) +
+				      (2 * InSample(InPtr, InStep, SizeIn,
+						    Pos)) +
+				      InSample(InPtr, InStep, SizeIn, Pos + 1) +
+				      2) >> 2);
+		}
+		if (Phase != 0U) {
+			return (u16)((InSample(InPtr, InStep, SizeIn, Pos - 1) +
+				      InSample(InPtr, InStep, SizeIn, Pos) +
+				      1) >> 1);
+		}
+		return InSample(InPtr, InStep, SizeIn, Pos);
+	}
+
+	for (Tap = 0U; Tap < NumTaps; Tap++) {
+		Acc += TablePtr[(Phase * NumTaps) + Tap] *
+		       InSample(InPtr, InStep, SizeIn,
+				Pos + (s32)Tap - (s32)(NumTaps / 2U));
+	}
+	Acc = (Acc < 0) ? 0 : (Acc >> 12);
+
+	return (u16)CLAMP(Acc, 0, (1 << COLOR_DEPTH) - 1);
+}
+
+/*****************************************************************************/
+/*
+* H chroma resampler, 4:4:4 to 4:2:2 or back.
+*/
+static void RunHcr(u32 Type, u32 NumTaps, u32 Down)
+{
+	XV_hcresampler_Config Cfg;
+	XVidC_ColorFormat FormatIn = Down ? XVIDC_CSF_YCRCB_444 :
+				     XVIDC_CSF_YCRCB_422;
+	XVidC_ColorFormat FormatOut = Down ? XVIDC_CSF_YCRCB_422 :
+				      XVIDC_CSF_YCRCB_444;
+	const short *TablePtr = HcrTables[(NumTaps - 4U) / 2U] +
+				(Down ? 0U : (XV_HCRSMPLR_MAX_PHASES * NumTaps));
+	u32 SizeIn = SUB_WIDTH >> HSUB(FormatIn);
+	u32 SizeOut = SUB_WIDTH >> HSUB(FormatOut);
+	u32 Plane;
+	u32 Line;
+	u32 Index;
+	char What[48];
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	Cfg.Name = "hcresampler";
+	Cfg.PixPerClk = XVIDC_PPC_2;
+	Cfg.MaxWidth = 4096U;
+	Cfg.MaxHeight = 2160U;
+	Cfg.MaxDataWidth = COLOR_DEPTH;
+	Cfg.ResamplingType = (int)Type;
+	Cfg.NumTaps = (u8)NumTaps;
+	memset(&Hcr, 0, sizeof(Hcr));
+	(void)XV_hcresampler_CfgInitialize(&Hcr.Hcr, &Cfg, HCR_BASE);
+	if (Type == XV_HCRSMPLR_TYPE_FIR) {
+		XV_HCrsmplLoadDefaultCoeff(&Hcr);
+	}
+	XV_HCrsmplSetActiveSize(&Hcr, SUB_WIDTH, SUB_HEIGHT);
+	XV_HCrsmplSetFormat(&Hcr, FormatIn, FormatOut);
+	SubsystemInit(XVPROCSS_TOPOLOGY_HCRESAMPLE_ONLY);
+	VprocSs.HcrsmplrPtr = &Hcr;
+
+	snprintf(What, sizeof(What), "H resampler type %u %u taps %s",
+		 (unsigned)Type, (unsigned)NumTaps, Down ? "down" : "up");
+	In.Width = SUB_WIDTH;
+	In.Height = SUB_HEIGHT;
+	In.ColorFormat = FormatIn;
+	if (XVprocSs_ModelRun(&Model, &VprocSs, &In, &Out) != XST_SUCCESS) {
+		XHOST_CHECK(0, "%s: model failed", What);
+		return;
+	}
+
+	Ref.Width = SUB_WIDTH;
+	Ref.Height = SUB_HEIGHT;
+	Ref.ColorFormat = FormatOut;
+	for (Line = 0U; Line < SUB_HEIGHT; Line++) {
+		memcpy(&Ref.Plane[0][Line * MAX_WIDTH],
+		       &In.Plane[0][Line * MAX_WIDTH], SUB_WIDTH * sizeof(u16));
+		for (Plane = 1U; Plane < 3U; Plane++) {
+			for (Index = 0U; Index < SizeOut; Index++) {
+				Ref.Plane[Plane][(Line * MAX_WIDTH) + Index] =
+					Resample(&In.Plane[Plane][Line * MAX_WIDTH],
+						 1U, SizeIn, Index, Down, Type,
+						 TablePtr, NumTaps);
+			}
+		}
+	}
+	(void)CompareFrame(What, &Ref);
+}
+
+/*****************************************************************************/
+/*
+* V chroma resampler, 4:2:2 to 4:2:0 or back.
+*/
+static void RunVcr(u32 Type, u32 NumTaps, u32 Down)
+{
+	XV_vcresampler_Config Cfg;
+	XVidC_ColorFormat FormatIn = Down ? XVIDC_CSF_YCRCB_422 :
+				     XVIDC_CSF_YCRCB_420;
+	XVidC_ColorFormat FormatOut = Down ? XVIDC_CSF_YCRCB_420 :
+				      XVIDC_CSF_YCRCB_422;
+	const short *TablePtr = VcrTables[(NumTaps - 4U) / 2U] +
+				(Down ? 0U : (XV_VCRSMPLR_MAX_PHASES * NumTaps));
+	u32 SizeIn = SUB_HEIGHT >> VSUB(FormatIn);
+	u32 SizeOut = SUB_HEIGHT >> VSUB(FormatOut);
+	u32 Plane;
+	u32 Line;
+	u32 Index;
+	char What[48];
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	Cfg.Name = "vcresampler";
+	Cfg.PixPerClk = XVIDC_PPC_2;
+	Cfg.MaxWidth = 4096U;
+	Cfg.MaxHeight = 2160U;
+	Cfg.MaxDataWidth = COLOR_DEPTH;
+	Cfg.ResamplingType = (int)Type;
+	Cfg.NumTaps = (u8)NumTaps;
+	memset(&Vcr, 0, sizeof(Vcr));
+	(void)XV_vcresampler_CfgInitialize(&Vcr.Vcr, &Cfg, VCR_BASE);
+	if (Type == XV_VCRSMPLR_TYPE_FIR) {
+		XV_VCrsmplLoadDefaultCoeff(&Vcr);
+	}
+	XV_VCrsmplSetActiveSize(&Vcr, SUB_WIDTH, SUB_HEIGHT);
+	XV_VCrsmplSetFormat(&Vcr, FormatIn, FormatOut);
+	SubsystemInit(XVPROCSS_TOPOLOGY_VCRESAMPLE_ONLY);
+	VprocSs.VcrsmplrInPtr = &Vcr;
+
+	snprintf(What, sizeof(What), "V resampler type %u %u taps %s",
+		 (unsigned)Type, (unsigned)NumTaps, Down ? "down" : "up");
+	In.Width = SUB_WIDTH;
+	In.Height = SUB_HEIGHT;
+	In.ColorFormat = FormatIn;
+	if (XVprocSs_ModelRun(&Model, &VprocSs, &In, &Out) != XST_SUCCESS) {
+		XHOST_CHECK(0, "%s: model failed", What);
+		return;
+	}
+
+	Ref.Width = SUB_WIDTH;
+	Ref.Height = SUB_HEIGHT;
+	Ref.ColorFormat = FormatOut;
+	for (Line = 0U; Line < SUB_HEIGHT; Line++) {
+		memcpy(&Ref.Plane[0][Line * MAX_WIDTH],
+		       &In.Plane[0][Line * MAX_WIDTH], SUB_WIDTH * sizeof(u16));
+	}
+	for (Plane = 1U; Plane < 3U; Plane++) {
+		for (Index = 0U; Index < (SUB_WIDTH / 2U); Index++) {
+			for (Line = 0U; Line < SizeOut; Line++) {
+				Ref.Plane[Plane][(Line * MAX_WIDTH) + Index] =
+					Resample(&In.Plane[Plane][Index],
+						 MAX_WIDTH, SizeIn, Line, Down,
+						 Type, TablePtr, NumTaps);
+			}
+		}
+	}
+	(void)CompareFrame(What, &Ref);
+}
+
+/*****************************************************************************/
+/*
+* Letterbox in the full topology, routed alone. Outside Window the samples
+* must have the background color, at 10 bits.
+*/
+static void RunLbox(XVidC_ColorFormat Format, XLboxColorId ColorId)
+{
+	static const u16 Colors[2][XLBOX_BKGND_LAST][3] = {
+		{ { 0U, 0U, 0U }, { 1023U, 1023U, 1023U }, { 1023U, 0U, 0U },
+		  { 0U, 1023U, 0U }, { 0U, 0U, 1023U } },
+		{ { 0U, 512U, 512U }, { 1020U, 512U, 512U },
+		  { 304U, 340U, 1020U }, { 596U, 172U, 84U },
+		  { 116U, 1020U, 428U } },
+	};
+	const u16 *ColorPtr = Colors[Format != XVIDC_CSF_RGB][ColorId];
+	XV_letterbox_Config Cfg;
+	u32 Plane;
+	u32 Line;
+	u32 Index;
+	u32 x;
+	u32 y;
+	char What[32];
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	Cfg.Name = "letterbox";
+	Cfg.PixPerClk = XVIDC_PPC_2;
+	Cfg.NumVidComponents = 3U;
+	Cfg.MaxWidth = 4096U;
+	Cfg.MaxHeight = 2160U;
+	Cfg.MaxDataWidth = COLOR_DEPTH;
+	memset(&Lbox, 0, sizeof(Lbox));
+	(void)XV_letterbox_CfgInitialize(&Lbox.Lbox, &Cfg, LBOX_BASE);
+	XV_LBoxSetActiveWin(&Lbox, &Window, SUB_WIDTH, SUB_HEIGHT);
+	XV_LboxSetBackgroundColor(&Lbox, ColorId, Format, COLOR_DEPTH);
+	SubsystemInit(XVPROCSS_TOPOLOGY_FULL_FLEDGED);
+	VprocSs.LboxPtr = &Lbox;
+	VprocSs.CtxtData.RtngTable[0] = XVPROCSS_SUBCORE_LBOX;
+	VprocSs.CtxtData.RtngTable[1] = 0U;
+	VprocSs.CtxtData.RtrNumCores = 2U;
+
+	snprintf(What, sizeof(What), "letterbox format %u color %u",
+		 (unsigned)Format, (unsigned)ColorId);
+	In.Width = SUB_WIDTH;
+	In.Height = SUB_HEIGHT;
+	In.ColorFormat = Format;
+	if (XVprocSs_ModelRun(&Model, &VprocSs, &In, &Out) != XST_SUCCESS) {
+		XHOST_CHECK(0, "%s: model failed", What);
+		return;
+	}
+
+	Ref.Width = SUB_WIDTH;
+	Ref.Height = SUB_HEIGHT;
+	Ref.ColorFormat = Format;
+	for (Plane = 0U; Plane < 3U; Plane++) {
+		for (Line = 0U; Line < (SUB_HEIGHT >> ((Plane != 0U) ?
+						       VSUB(Format) : 0U));
+		     Line++) {
+			for (Index = 0U;
+			     Index < (SUB_WIDTH >> ((Plane != 0U) ?
+						    HSUB(Format) : 0U));
+			     Index++) {
+				/* Luma position of the sample */
+				x = Index << ((Plane != 0U) ? HSUB(Format) : 0U);
+				y = Line << ((Plane != 0U) ? VSUB(Format) : 0U);
+				Ref.Plane[Plane][(Line * MAX_WIDTH) + Index] =
+					((x >= Window.StartX) &&
+					 (x < (Window.StartX + Window.Width)) &&
+					 (y >= Window.StartY) &&
+					 (y < (Window.StartY + Window.Height))) ?
+					In.Plane[Plane][(Line * MAX_WIDTH) +
+							Index] :
+					ColorPtr[Plane];
+			}
+		}
+	}
+	(void)CompareFrame(What, &Ref);
+}
+
+/*****************************************************************************/
+/*
+* Deinterlacer of one field. Field line n is frame line 2n, or 2n + 1 for
+* the bottom field. The other lines are the mean of the field lines next to
+* them, the first and last field lines are repeated.
+*/
+static void RunDeint(u8 FieldId, u8 Invert)
+{
+	XV_deinterlacer_Config Cfg;
+	u32 Bottom = (u32)(FieldId ^ Invert);
+	const u16 *AbovePtr;
+	const u16 *BelowPtr;
+	u32 Format;
+	u32 Plane;
+	u32 Line;
+	u32 Index;
+	u32 Width;
+	s32 Above;
+	s32 Below;
+	char What[48];
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	Cfg.Name = "deinterlacer";
+	Cfg.NumVidComponents = 3U;
+	Cfg.MaxDataWidth = COLOR_DEPTH;
+	memset(&Deint, 0, sizeof(Deint));
+	(void)XV_deinterlacer_CfgInitialize(&Deint.Deint, &Cfg, DEINT_BASE);
+	XV_deinterlacer_Set_width(&Deint.Deint, SUB_WIDTH);
+	XV_deinterlacer_Set_height(&Deint.Deint, SUB_HEIGHT);
+	XV_deinterlacer_Set_invert_field_id(&Deint.Deint, Invert);
+	SubsystemInit(XVPROCSS_TOPOLOGY_DEINTERLACE_ONLY);
+	VprocSs.DeintPtr = &Deint;
+
+	for (Format = 0U; Format < 2U; Format++) {
+		snprintf(What, sizeof(What), "deinterlacer field %u invert %u "
+			 "format %u", (unsigned)FieldId, (unsigned)Invert,
+			 (unsigned)Format);
+		In.Width = SUB_WIDTH;
+		In.Height = SUB_HEIGHT;
+		In.ColorFormat = (Format != 0U) ? XVIDC_CSF_YCRCB_422 :
+				 XVIDC_CSF_YCRCB_444;
+		In.FieldId = FieldId;
+		if (XVprocSs_ModelRun(&Model, &VprocSs, &In, &Out) !=
+		    XST_SUCCESS) {
+			XHOST_CHECK(0, "%s: model failed", What);
+			continue;
+		}
+
+		Ref.Width = SUB_WIDTH;
+		Ref.Height = 2U * SUB_HEIGHT;
+		Ref.ColorFormat = In.ColorFormat;
+		for (Plane = 0U; Plane < 3U; Plane++) {
+			Width = SUB_WIDTH >> ((Plane != 0U) ?
+					      HSUB(In.ColorFormat) : 0U);
+			for (Line = 0U; Line < (2U * SUB_HEIGHT); Line++) {
+				Above = ((s32)Line - 1 - (s32)Bottom) / 2;
+				Below = ((s32)Line + 1 - (s32)Bottom) / 2;
+				AbovePtr = &In.Plane[Plane][(u32)CLAMP(Above, 0,
+					(s32)SUB_HEIGHT - 1) * MAX_WIDTH];
+				BelowPtr = &In.Plane[Plane][(u32)CLAMP(Below, 0,
+					(s32)SUB_HEIGHT - 1) * MAX_WIDTH];
+				for (Index = 0U; Index < Width; Index++) {
+					Ref.Plane[Plane][(Line * MAX_WIDTH) +
+							 Index] =
+						((Line & 1U) == Bottom) ?
+						In.Plane[Plane][((Line >> 1) *
+								 MAX_WIDTH) +
+								Index] :
+						(u16)((AbovePtr[Index] +
+						       BelowPtr[Index] + 1U) >> 1);
+				}
+			}
+		}
+		(void)CompareFrame(What, &Ref);
+	}
+	In.FieldId = 0U;
+}
+
+/*****************************************************************************/
+/*
+* Time per frame of the model, on 1080p frames: scaled to 720p, and
+* converted from RGB to YCbCr.
+*/
+static void RunTimed(void)
+{
+	static XVprocSs_Model TimedModel;
+	XVprocSs_ModelFrame TimedIn;
+	XVprocSs_ModelFrame TimedOut;
+	u64 ScaleNs;
+	u64 CscNs;
+	u64 StartNs;
+	u32 Frame;
+	u32 Plane;
+	u32 Index;
+
+	XHOST_CHECK(XVprocSs_ModelInit(&TimedModel,
+				       malloc(XVPROCSS_MODEL_MEM_SIZE(
+					       TIMED_WIDTH, TIMED_HEIGHT)),
+				       TIMED_WIDTH, TIMED_HEIGHT) == XST_SUCCESS,
+		    "timed model init");
+	memset(&TimedIn, 0, sizeof(TimedIn));
+	memset(&TimedOut, 0, sizeof(TimedOut));
+	for (Plane = 0U; Plane < 3U; Plane++) {
+		TimedIn.Plane[Plane] = malloc(TIMED_WIDTH * TIMED_HEIGHT *
+					      sizeof(u16));
+		TimedOut.Plane[Plane] = malloc(TIMED_WIDTH * TIMED_HEIGHT *
+					       sizeof(u16));
+		TimedIn.Stride[Plane] = TIMED_WIDTH;
+		TimedOut.Stride[Plane] = TIMED_WIDTH;
+		for (Index = 0U; Index < (TIMED_WIDTH * TIMED_HEIGHT);
+		     Index++) {
+			TimedIn.Plane[Plane][Index] = (u16)((u32)rand() &
+						((1U << COLOR_DEPTH) - 1U));
+		}
+	}
+	TimedIn.Width = TIMED_WIDTH;
+	TimedIn.Height = TIMED_HEIGHT;
+
+	CoreInit(XVIDC_PPC_2, XV_HSCALER_TAPS_6);
+	TimedIn.ColorFormat = XVIDC_CSF_YCRCB_444;
+	XHOST_CHECK(XV_VScalerSetup(&Vsc, TIMED_WIDTH, TIMED_HEIGHT, 720U,
+				    XVIDC_CSF_YCRCB_444) == XST_SUCCESS,
+		    "timed V setup");
+	XHOST_CHECK(XV_HScalerSetup(&Hsc, 720U, TIMED_WIDTH, 1280U,
+				    XVIDC_CSF_YCRCB_444,
+				    XVIDC_CSF_YCRCB_444) == XST_SUCCESS,
+		    "timed H setup");
+	StartNs = XHostModel_TimeNs();
+	for (Frame = 0U; Frame < TIMED_FRAMES; Frame++) {
+		XHOST_CHECK(XVprocSs_ModelRun(&TimedModel, &VprocSs, &TimedIn,
+					      &TimedOut) == XST_SUCCESS,
+			    "timed scale %u", (unsigned)Frame);
+	}
+	ScaleNs = (XHostModel_TimeNs() - StartNs) / TIMED_FRAMES;
+
+	CscInit(0U, TIMED_WIDTH, TIMED_HEIGHT);
+	TimedIn.ColorFormat = XVIDC_CSF_RGB;
+	StartNs = XHostModel_TimeNs();
+	for (Frame = 0U; Frame < TIMED_FRAMES; Frame++) {
+		XHOST_CHECK(XVprocSs_ModelRun(&TimedModel, &VprocSs, &TimedIn,
+					      &TimedOut) == XST_SUCCESS,
+			    "timed CSC %u", (unsigned)Frame);
+	}
+	CscNs = (XHostModel_TimeNs() - StartNs) / TIMED_FRAMES;
+
+	printf("timed: 1080p to 720p scaling %.1f ms per frame, 1080p CSC "
+	       "%.1f ms per frame (%.1f Mpixel/s)\n", ScaleNs / 1e6,
+	       CscNs / 1e6, (TIMED_WIDTH * TIMED_HEIGHT * 1e3) / CscNs);
+
+	for (Plane = 0U; Plane < 3U; Plane++) {
+		free(TimedIn.Plane[Plane]);
+		free(TimedOut.Plane[Plane]);
+	}
+}
+
+int main(void)
+{
+	static const u32 PixPerClk[] = { XVIDC_PPC_1, XVIDC_PPC_2,
+					 XVIDC_PPC_4, XVIDC_PPC_8 };
+	u32 Index;
+	u32 Plane;
+	u32 Ppc;
+	u32 Taps;
+	u32 Type;
+	u32 Down;
+
+	XHOST_CHECK(XVprocSs_ModelInit(&Model,
+				       malloc(XVPROCSS_MODEL_MEM_SIZE(MAX_WIDTH,
+								      MAX_HEIGHT)),
+				       MAX_WIDTH, MAX_HEIGHT) == XST_SUCCESS,
+		    "model init");
+	FrameAlloc(&In);
+	FrameAlloc(&Mid);
+	FrameAlloc(&Out);
+	FrameAlloc(&Ref);
+	srand(1);
+	for (Plane = 0U; Plane < 3U; Plane++) {
+		for (Index = 0U; Index < (MAX_WIDTH * MAX_HEIGHT); Index++) {
+			In.Plane[Plane][Index] = (u16)((u32)rand() &
+						       ((1U << COLOR_DEPTH) - 1U));
+		}
+	}
+
+	for (Ppc = 0U; Ppc < sizeof(PixPerClk) / sizeof(PixPerClk[0]); Ppc++) {
+		for (Taps = XV_HSCALER_TAPS_6; Taps <= XV_HSCALER_TAPS_12;
+		     Taps += 2U) {
+			RunConfig(PixPerClk[Ppc], Taps);
+		}
+	}
+
+	for (Index = 0U; Index < NUM_CSC_MODES; Index++) {
+		RunCsc(Index);
+	}
+	for (Type = XV_HCRSMPLR_TYPE_NEAREST_NEIGHBOR;
+	     Type <= XV_HCRSMPLR_TYPE_FIR; Type++) {
+		for (Taps = XV_HCRSMPLR_TAPS_4; Taps <= XV_HCRSMPLR_TAPS_10;
+		     Taps += 2U) {
+			for (Down = 0U; Down < 2U; Down++) {
+				RunHcr(Type, Taps, Down);
+				RunVcr(Type, Taps, Down);
+			}
+		}
+	}
+	RunLbox(XVIDC_CSF_RGB, XLBOX_BKGND_BLUE);
+	RunLbox(XVIDC_CSF_YCRCB_444, XLBOX_BKGND_BLACK);
+	RunLbox(XVIDC_CSF_YCRCB_422, XLBOX_BKGND_WHITE);
+	RunLbox(XVIDC_CSF_YCRCB_420, XLBOX_BKGND_GREEN);
+	RunDeint(0U, 0U);
+	RunDeint(1U, 0U);
+	RunDeint(0U, 1U);
+	RunDeint(1U, 1U);
+	RunTimed();
+
+	XHOST_CHECK(XHostModel_AssertCount == 0U, "%u assertions",
+		    (unsigned)XHostModel_AssertCount);
+
+	return XHostModel_Report("xvprocss_model_test");
+}
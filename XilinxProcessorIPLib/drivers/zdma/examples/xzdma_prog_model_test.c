@@ -0,0 +1,434 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_prog_model_test.c
+*
+* Host test and benchmark of the ZDMA descriptor programs and striped copies
+* against a software model of the channels. It is not a target example: it
+* is built and run with the other driver model tests by
+* make -C scripts/host_model.
+*
+* The model runs a channel when it is enabled: in scatter gather mode it
+* walks the linear or linked list descriptors from the start registers
+* until a STOP descriptor, in simple mode it copies the descriptor held in
+* the registers. It then raises the done interrupt, which the test serves
+* with XZDma_IntrHandler().
+*
+* The test copies all the 32x32 tiles of a 512 byte wide frame, for both
+* descriptor types, once with XZDma_Start() and once with a program built
+* by XZDma_ProgramTile() and moved by XZDma_ProgramRebase(), and checks the
+* data. It prints the cache flushes and the host time to start one tile for
+* both paths. The striped copies are checked for sizes around the stripe
+* alignment, with the number of channels used and a busy channel.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 1.18  kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xzdma.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define NUM_CHANNELS	8U		/* Channels of one DMA */
+#define CHANNEL_SPAN	0x1000U		/* Register space of a channel */
+#define FRAME_WIDTH	512U		/* Source frame row, bytes */
+#define FRAME_ROWS	128U
+#define TILE_SIZE	32U		/* Tile width in bytes and rows */
+#define NUM_TILES	((FRAME_WIDTH / TILE_SIZE) * (FRAME_ROWS / TILE_SIZE))
+#define BENCH_ROUNDS	200U
+#define STRIPE_ALIGN	64U		/* Stripe alignment of the driver */
+#define DSCR_MEM_SIZE	(2U * 64U * sizeof(XZDma_LlDscr))
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define CHANNEL(Addr)	((u32)((Addr) / CHANNEL_SPAN) - 1U)
+#define REG(Ch, Off)	Regs[(Ch)][(Off) / 4U]
+#define REG64(Ch, Lsb, Msb) \
+	(((u64)REG((Ch), (Msb)) << 32U) | (u64)REG((Ch), (Lsb)))
+
+/************************** Function Prototypes ******************************/
+
+static void ModelRun(u32 Ch);
+static void DoneHandler(void *CallBackRef);
+static void Complete(XZDma *InstancePtr);
+static u32 TileOffset(u32 Tile);
+static u32 CheckTiles(u32 Round);
+static void RunTiles(XZDma_DscrType Type);
+static void RunStripes(void);
+
+/************************** Variable Definitions *****************************/
+
+static u32 Regs[NUM_CHANNELS][CHANNEL_SPAN / 4U];
+static u32 Pending[NUM_CHANNELS];
+static XZDma_DscrType ModelDscrType;
+static u32 DoneCount;
+
+static XZDma Dma[NUM_CHANNELS];
+static XZDma *DmaPtrs[NUM_CHANNELS];
+static u8 Src[2][FRAME_WIDTH * FRAME_ROWS];
+static u8 Dst[NUM_TILES * TILE_SIZE * TILE_SIZE];
+static u8 DscrMem[DSCR_MEM_SIZE] __attribute__((aligned(64)));
+
+/*****************************************************************************/
+/*
+* Register model. Enabling a channel only marks it pending, so that the
+* benchmark times the driver and not the model copy.
+*/
+u32 Xil_In32(UINTPTR Addr)
+{
+	u32 Ch = CHANNEL(Addr);
+	u32 Off = (u32)(Addr % CHANNEL_SPAN);
+
+	if (Off == XZDMA_CH_STS_OFFSET) {
+		return (Pending[Ch] != 0U) ? XZDMA_STS_BUSY_MASK :
+					     XZDMA_STS_DONE_MASK;
+	}
+
+	return REG(Ch, Off);
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	u32 Ch = CHANNEL(Addr);
+	u32 Off = (u32)(Addr % CHANNEL_SPAN);
+
+	if (Off == XZDMA_CH_ISR_OFFSET) {
+		REG(Ch, Off) &= ~Value;
+		return;
+	}
+	if (Off == XZDMA_CH_IDS_OFFSET) {
+		REG(Ch, XZDMA_CH_IMR_OFFSET) |= Value;
+		return;
+	}
+	if (Off == XZDMA_CH_IEN_OFFSET) {
+		REG(Ch, XZDMA_CH_IMR_OFFSET) &= ~Value;
+		return;
+	}
+	REG(Ch, Off) = Value;
+	if ((Off == XZDMA_CH_CTRL2_OFFSET) && (Value != 0U)) {
+		Pending[Ch] = 1U;
+	}
+}
+
+static void ModelRun(u32 Ch)
+{
+	XZDma_LiDscr *LiSrc;
+	XZDma_LiDscr *LiDst;
+	XZDma_LlDscr *LlSrc;
+	XZDma_LlDscr *LlDst;
+	u32 Count;
+
+	if (Pending[Ch] == 0U) {
+		return;
+	}
+	Pending[Ch] = 0U;
+
+	if ((REG(Ch, XZDMA_CH_CTRL0_OFFSET) &
+	     XZDMA_CTRL0_POINT_TYPE_MASK) == 0U) {
+		memcpy((void *)(UINTPTR)REG64(Ch, XZDMA_CH_DST_DSCR_WORD0_OFFSET,
+					      XZDMA_CH_DST_DSCR_WORD1_OFFSET),
+		       (void *)(UINTPTR)REG64(Ch, XZDMA_CH_SRC_DSCR_WORD0_OFFSET,
+					      XZDMA_CH_SRC_DSCR_WORD1_OFFSET),
+		       REG(Ch, XZDMA_CH_SRC_DSCR_WORD2_OFFSET));
+	} else if (ModelDscrType == XZDMA_LINEAR) {
+		LiSrc = (XZDma_LiDscr *)(UINTPTR)REG64(Ch,
+			XZDMA_CH_SRC_START_LSB_OFFSET,
+			XZDMA_CH_SRC_START_MSB_OFFSET);
+		LiDst = (XZDma_LiDscr *)(UINTPTR)REG64(Ch,
+			XZDMA_CH_DST_START_LSB_OFFSET,
+			XZDMA_CH_DST_START_MSB_OFFSET);
+		for (Count = 0U; Count < 64U; Count++, LiSrc++, LiDst++) {
+			XHOST_CHECK(LiSrc->Size == LiDst->Size,
+				    "linear sizes %u/%u", (unsigned)LiSrc->Size,
+				    (unsigned)LiDst->Size);
+			memcpy((void *)(UINTPTR)LiDst->Address,
+			       (void *)(UINTPTR)LiSrc->Address, LiSrc->Size);
+			if ((LiSrc->Cntl & XZDMA_WORD3_CMD_MASK) ==
+			    XZDMA_WORD3_CMD_STOP_MASK) {
+				break;
+			}
+		}
+		XHOST_CHECK(Count < 64U, "linear chain without STOP");
+	} else {
+		LlSrc = (XZDma_LlDscr *)(UINTPTR)REG64(Ch,
+			XZDMA_CH_SRC_START_LSB_OFFSET,
+			XZDMA_CH_SRC_START_MSB_OFFSET);
+		LlDst = (XZDma_LlDscr *)(UINTPTR)REG64(Ch,
+			XZDMA_CH_DST_START_LSB_OFFSET,
+			XZDMA_CH_DST_START_MSB_OFFSET);
+		for (Count = 0U; Count < 64U; Count++) {
+			XHOST_CHECK(LlSrc->Size == LlDst->Size,
+				    "linked list sizes %u/%u",
+				    (unsigned)LlSrc->Size,
+				    (unsigned)LlDst->Size);
+			memcpy((void *)(UINTPTR)LlDst->Address,
+			       (void *)(UINTPTR)LlSrc->Address, LlSrc->Size);
+			if ((LlSrc->Cntl & XZDMA_WORD3_CMD_MASK) ==
+			    XZDMA_WORD3_CMD_STOP_MASK) {
+				break;
+			}
+			LlSrc = (XZDma_LlDscr *)(UINTPTR)LlSrc->NextDscr;
+			LlDst = (XZDma_LlDscr *)(UINTPTR)LlDst->NextDscr;
+		}
+		XHOST_CHECK(Count < 64U, "linked list without STOP");
+	}
+
+	REG(Ch, XZDMA_CH_CTRL2_OFFSET) = 0U;
+	REG(Ch, XZDMA_CH_ISR_OFFSET) |= XZDMA_IXR_DMA_DONE_MASK;
+}
+
+static void DoneHandler(void *CallBackRef)
+{
+	(void)CallBackRef;
+	DoneCount++;
+}
+
+/* Runs the channel and serves its done interrupt */
+static void Complete(XZDma *InstancePtr)
+{
+	ModelRun(CHANNEL(InstancePtr->Config.BaseAddress));
+	XZDma_IntrHandler(InstancePtr);
+}
+
+/*****************************************************************************/
+/*
+* Tile t of the frame: tiles are taken in row order, odd tiles come from the
+* second frame so that the source base moves both ways.
+*/
+static u32 TileOffset(u32 Tile)
+{
+	return ((Tile / (FRAME_WIDTH / TILE_SIZE)) * TILE_SIZE * FRAME_WIDTH) +
+	       ((Tile % (FRAME_WIDTH / TILE_SIZE)) * TILE_SIZE);
+}
+
+static u32 CheckTiles(u32 Round)
+{
+	u32 Bad = 0U;
+	u32 Tile;
+	u32 Row;
+	const u8 *SrcPtr;
+
+	for (Tile = 0U; Tile < NUM_TILES; Tile++) {
+		SrcPtr = &Src[(Tile + Round) & 1U][TileOffset(Tile)];
+		for (Row = 0U; Row < TILE_SIZE; Row++) {
+			if (memcmp(&Dst[(Tile * TILE_SIZE * TILE_SIZE) +
+					(Row * TILE_SIZE)],
+				   &SrcPtr[Row * FRAME_WIDTH],
+				   TILE_SIZE) != 0) {
+				Bad++;
+			}
+		}
+	}
+
+	return Bad;
+}
+
+/*****************************************************************************/
+/*
+* Copies all the tiles with XZDma_Start() and with a program, and compares
+* the cost of starting one tile.
+*/
+static void RunTiles(XZDma_DscrType Type)
+{
+	XZDma_Transfer Rows[TILE_SIZE];
+	XZDma_Program Prog;
+	XZDma *InstancePtr = &Dma[0];
+	u64 StartNs;
+	u64 StartTime;
+	u64 ProgTime;
+	u32 StartFlush;
+	u32 ProgFlush;
+	u32 Round;
+	u32 Tile;
+	u32 Row;
+
+	ModelDscrType = Type;
+	DoneCount = 0U;
+	XHOST_CHECK(XZDma_SetMode(InstancePtr, TRUE, XZDMA_NORMAL_MODE) ==
+		    XST_SUCCESS, "scatter gather mode");
+
+	/* Descriptors rewritten for each tile */
+	(void)XZDma_CreateBDList(InstancePtr, Type, (UINTPTR)DscrMem,
+				 sizeof(DscrMem));
+	memset(Rows, 0, sizeof(Rows));
+	StartTime = 0U;
+	XHostModel_FlushCount = 0U;
+	for (Round = 0U; Round < BENCH_ROUNDS; Round++) {
+		memset(Dst, 0, sizeof(Dst));
+		for (Tile = 0U; Tile < NUM_TILES; Tile++) {
+			for (Row = 0U; Row < TILE_SIZE; Row++) {
+				Rows[Row].SrcAddr = (UINTPTR)
+					&Src[(Tile + Round) & 1U]
+					[TileOffset(Tile) + (Row * FRAME_WIDTH)];
+				Rows[Row].DstAddr = (UINTPTR)
+					&Dst[(Tile * TILE_SIZE * TILE_SIZE) +
+					     (Row * TILE_SIZE)];
+				Rows[Row].Size = TILE_SIZE;
+			}
+			StartNs = XHostModel_TimeNs();
+			XHOST_CHECK(XZDma_Start(InstancePtr, Rows, TILE_SIZE) ==
+				    XST_SUCCESS, "start tile %u", (unsigned)Tile);
+			StartTime += XHostModel_TimeNs() - StartNs;
+			Complete(InstancePtr);
+		}
+		XHOST_CHECK(CheckTiles(Round) == 0U, "XZDma_Start tiles");
+	}
+	StartFlush = XHostModel_FlushCount;
+
+	/* One program, moved for each tile */
+	XHOST_CHECK(XZDma_ProgramInitialize(&Prog, InstancePtr, Type,
+					    (UINTPTR)DscrMem,
+					    sizeof(DscrMem)) >= TILE_SIZE,
+		    "program size");
+	XHOST_CHECK(XZDma_ProgramTile(&Prog, (UINTPTR)Src[0], FRAME_WIDTH,
+				      (UINTPTR)Dst, TILE_SIZE, TILE_SIZE,
+				      Prog.DscrCount + 1U) == XST_FAILURE,
+		    "tile larger than the program");
+	XHOST_CHECK(XZDma_ProgramTile(&Prog, (UINTPTR)Src[0], FRAME_WIDTH,
+				      (UINTPTR)Dst, TILE_SIZE, TILE_SIZE,
+				      TILE_SIZE) == XST_SUCCESS, "build tile");
+	ProgTime = 0U;
+	XHostModel_FlushCount = 0U;
+	for (Round = 0U; Round < BENCH_ROUNDS; Round++) {
+		memset(Dst, 0, sizeof(Dst));
+		for (Tile = 0U; Tile < NUM_TILES; Tile++) {
+			StartNs = XHostModel_TimeNs();
+			XZDma_ProgramRebase(&Prog, (UINTPTR)
+					    &Src[(Tile + Round) & 1U]
+					    [TileOffset(Tile)],
+					    (UINTPTR)&Dst[Tile * TILE_SIZE *
+							  TILE_SIZE]);
+			XHOST_CHECK(XZDma_ProgramStart(InstancePtr, &Prog) ==
+				    XST_SUCCESS, "program tile %u",
+				    (unsigned)Tile);
+			ProgTime += XHostModel_TimeNs() - StartNs;
+			XHOST_CHECK(XZDma_ProgramStart(InstancePtr, &Prog) ==
+				    XST_FAILURE, "program on a busy channel");
+			Complete(InstancePtr);
+		}
+		XHOST_CHECK(CheckTiles(Round) == 0U, "program tiles");
+	}
+	ProgFlush = XHostModel_FlushCount;
+
+	XHOST_CHECK(DoneCount == (2U * BENCH_ROUNDS * NUM_TILES),
+		    "%u done interrupts", (unsigned)DoneCount);
+	XHOST_CHECK(ProgFlush < StartFlush, "program flushes %u, start %u",
+		    (unsigned)ProgFlush, (unsigned)StartFlush);
+	printf("%s tiles: XZDma_Start %.1f flushes %.0f ns, "
+	       "program %.1f flushes %.0f ns per tile\n",
+	       (Type == XZDMA_LINEAR) ? "linear" : "linked list",
+	       (double)StartFlush / (BENCH_ROUNDS * NUM_TILES),
+	       (double)StartTime / (BENCH_ROUNDS * NUM_TILES),
+	       (double)ProgFlush / (BENCH_ROUNDS * NUM_TILES),
+	       (double)ProgTime / (BENCH_ROUNDS * NUM_TILES));
+}
+
+/*****************************************************************************/
+/*
+* Striped copies: data, the bytes after the copy, the channels used.
+*/
+static void RunStripes(void)
+{
+	static const u32 Sizes[] = { 1U, 63U, 64U, 65U, 1000U, 4096U,
+				     50000U, sizeof(Dst) - 1U };
+	XZDma_Transfer Data;
+	u32 Stripe;
+	u32 Expected;
+	u32 Used;
+	u32 Index;
+	u32 Ch;
+
+	for (Ch = 0U; Ch < NUM_CHANNELS; Ch++) {
+		XHOST_CHECK(XZDma_SetMode(&Dma[Ch], FALSE, XZDMA_NORMAL_MODE) ==
+			    XST_SUCCESS, "simple mode %u", (unsigned)Ch);
+	}
+
+	memset(&Data, 0, sizeof(Data));
+	for (Index = 0U; Index < (sizeof(Sizes) / sizeof(Sizes[0])); Index++) {
+		memset(Dst, 0, sizeof(Dst));
+		Data.SrcAddr = (UINTPTR)Src[0];
+		Data.DstAddr = (UINTPTR)Dst;
+		Data.Size = Sizes[Index];
+		XHOST_CHECK(XZDma_StripeStart(DmaPtrs, NUM_CHANNELS, &Data) ==
+			    XST_SUCCESS, "stripe %u", (unsigned)Sizes[Index]);
+		XHOST_CHECK(XZDma_StripeIsDone(DmaPtrs, NUM_CHANNELS) == FALSE,
+			    "stripe %u done early", (unsigned)Sizes[Index]);
+
+		Used = 0U;
+		for (Ch = 0U; Ch < NUM_CHANNELS; Ch++) {
+			Used += Pending[Ch];
+			Complete(&Dma[Ch]);
+		}
+		XHOST_CHECK(XZDma_StripeIsDone(DmaPtrs, NUM_CHANNELS) == TRUE,
+			    "stripe %u not done", (unsigned)Sizes[Index]);
+
+		/* Aligned stripes of at least 1/NUM_CHANNELS of the copy */
+		Stripe = (Sizes[Index] + NUM_CHANNELS - 1U) / NUM_CHANNELS;
+		Stripe = (Stripe + STRIPE_ALIGN - 1U) & ~(STRIPE_ALIGN - 1U);
+		Expected = (Sizes[Index] + Stripe - 1U) / Stripe;
+		XHOST_CHECK(Used == Expected, "stripe %u on %u channels",
+			    (unsigned)Sizes[Index], (unsigned)Used);
+		XHOST_CHECK(memcmp(Dst, Src[0], Sizes[Index]) == 0,
+			    "stripe %u data", (unsigned)Sizes[Index]);
+		XHOST_CHECK(Dst[Sizes[Index]] == 0U, "stripe %u overrun",
+			    (unsigned)Sizes[Index]);
+	}
+
+	/* No stripe is started if a channel is busy */
+	Dma[3].ChannelState = XZDMA_BUSY;
+	Data.Size = 4096U;
+	XHOST_CHECK(XZDma_StripeStart(DmaPtrs, NUM_CHANNELS, &Data) ==
+		    XST_FAILURE, "stripe on a busy channel");
+	for (Ch = 0U; Ch < NUM_CHANNELS; Ch++) {
+		XHOST_CHECK(Pending[Ch] == 0U, "channel %u started",
+			    (unsigned)Ch);
+	}
+	Dma[3].ChannelState = XZDMA_IDLE;
+}
+
+int main(void)
+{
+	u32 Index;
+	u32 Ch;
+
+	for (Index = 0U; Index < sizeof(Src[0]); Index++) {
+		Src[0][Index] = (u8)(Index * 7U);
+		Src[1][Index] = (u8)((Index * 13U) + 1U);
+	}
+
+	memset(Dma, 0, sizeof(Dma));
+	for (Ch = 0U; Ch < NUM_CHANNELS; Ch++) {
+		/* Channel 0 is not at address 0 */
+		Dma[Ch].Config.BaseAddress = (Ch + 1U) * CHANNEL_SPAN;
+		Dma[Ch].IsReady = XIL_COMPONENT_IS_READY;
+		Dma[Ch].ChannelState = XZDMA_IDLE;
+		REG(Ch, XZDMA_CH_IMR_OFFSET) = XZDMA_IXR_ALL_INTR_MASK;
+		(void)XZDma_SetCallBack(&Dma[Ch], XZDMA_HANDLER_DONE,
+					(void *)DoneHandler, &Dma[Ch]);
+		XZDma_EnableIntr(&Dma[Ch], XZDMA_IXR_DMA_DONE_MASK);
+		DmaPtrs[Ch] = &Dma[Ch];
+	}
+
+	RunTiles(XZDMA_LINKEDLIST);
+	RunTiles(XZDMA_LINEAR);
+	RunStripes();
+
+	XHOST_CHECK(XHostModel_AssertCount == 0U, "asserts");
+
+	return XHostModel_Report("xzdma_prog_model_test");
+}
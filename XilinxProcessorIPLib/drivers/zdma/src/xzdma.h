@@ -116,6 +116,8 @@
 *                        in applications directly.
 * 1.14	adk	03/15/22 Fixed syntax errors in zdma_tapp.tcl file, when stdout
 * 			 is configured as none.
+* 1.18	kt	10/18/26 Added reusable descriptor programs and striped copy
+*			 over several channels in xzdma_prog.c.
 * </pre>
 *
 ******************************************************************************/
@@ -364,6 +366,25 @@ typedef struct {
 				  *  this transfer only for SG mode */
 } XZDma_Transfer;
 
+/******************************************************************************/
+/**
+* This typedef contains a descriptor program, a scatter gather descriptor chain
+* which is built once and started many times. Its addresses can be moved to
+* other buffers without rebuilding it.
+*/
+typedef struct {
+	void *SrcDscrPtr;	/**< Source Descriptor pointer */
+	void *DstDscrPtr;	/**< Destination Descriptor pointer */
+	u32 DscrCount;		/**< Count of descriptors available */
+	u32 Count;		/**< Count of descriptors in the chain */
+	XZDma_DscrType DscrType;/**< Type of descriptor either Linear or
+				  *  Linked list type */
+	UINTPTR SrcBase;	/**< Source address of the first descriptor */
+	UINTPTR DstBase;	/**< Destination address of the first
+				  *  descriptor */
+	u8 IsCacheCoherent;	/**< Descriptors are cache coherent */
+} XZDma_Program;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -708,6 +729,21 @@ void XZDma_ScatterGather(XZDma *InstancePtr, XZDma_Transfer *Data,
 			 u32 Num);
 void XZDma_Enable(XZDma *InstancePtr);
 
+u32 XZDma_ProgramInitialize(XZDma_Program *ProgPtr, XZDma *InstancePtr,
+			    XZDma_DscrType TypeOfDscr, UINTPTR Dscr_MemPtr,
+			    u32 NoOfBytes);
+s32 XZDma_ProgramBuild(XZDma_Program *ProgPtr, XZDma_Transfer *Data,
+		       u32 Num);
+s32 XZDma_ProgramTile(XZDma_Program *ProgPtr, UINTPTR SrcAddr,
+		      u32 SrcStride, UINTPTR DstAddr, u32 DstStride,
+		      u32 RowSize, u32 Rows);
+void XZDma_ProgramRebase(XZDma_Program *ProgPtr, UINTPTR SrcBase,
+			 UINTPTR DstBase);
+s32 XZDma_ProgramStart(XZDma *InstancePtr, XZDma_Program *ProgPtr);
+s32 XZDma_StripeStart(XZDma **InstancePtrs, u32 NumChannels,
+		      XZDma_Transfer *Data);
+u32 XZDma_StripeIsDone(XZDma **InstancePtrs, u32 NumChannels);
+
 /*@}*/
 
 #ifdef __cplusplus
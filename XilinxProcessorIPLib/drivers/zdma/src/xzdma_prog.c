@@ -0,0 +1,559 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_prog.c
+* @addtogroup zdma Overview
+* @{
+*
+* This file contains the descriptor program and striped copy functions of
+* Xilinx ZDMA core. Please see xzdma.h for more details of the driver.
+*
+* XZDma_Start() writes every field of every descriptor for each transfer. A
+* descriptor program is built once, for a copy pattern which recurs with
+* other buffers, like the tiles of a frame or the pieces of a packet:
+*
+* - XZDma_ProgramBuild() builds the chain from an array of XZDma_Transfer,
+*   XZDma_ProgramTile() builds it for a 2D tile, one descriptor per row.
+* - XZDma_ProgramRebase() moves the chain to other source and destination
+*   buffers by offsetting the descriptor addresses only.
+* - XZDma_ProgramStart() starts the chain as it is.
+*
+* XZDma_StripeStart() splits a large copy in simple mode over several
+* channels of the same DMA (e.g. the 8 channels of ADMA or GDMA) to use the
+* outstanding transactions of all of them.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.18  kt      10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xzdma.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XZDMA_STRIPE_ALIGN	(64U)	/**< Alignment of the stripes, a
+					  *  cache line */
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+
+/**************************** Type Definitions *******************************/
+
+
+/************************** Function Prototypes ******************************/
+
+static void XZDma_ProgramSetDscr(XZDma_Program *ProgPtr, u32 Index,
+				 XZDma_Transfer *Data, u8 IsLast);
+static void XZDma_ProgramFlush(XZDma_Program *ProgPtr);
+
+/************************** Variable Definitions *****************************/
+
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a descriptor program on the memory provided. As
+* for XZDma_CreateBDList(), the first half of the memory holds the source
+* descriptors and the second half the destination descriptors.
+*
+* @param	ProgPtr is a pointer to the XZDma_Program to be initialized.
+* @param	InstancePtr is a pointer to the XZDma instance the program is
+*		built for.
+* @param	TypeOfDscr is the type of the descriptors.
+*		- XZDMA_LINEAR - Linear type
+*		- XZDMA_LINKEDLIST - Linked list type
+* @param	Dscr_MemPtr is the address of the memory for the descriptors,
+*		64 byte aligned.
+* @param	NoOfBytes is the size of that memory in bytes.
+*
+* @return	The number of descriptors the program can hold.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XZDma_ProgramInitialize(XZDma_Program *ProgPtr, XZDma *InstancePtr,
+			    XZDma_DscrType TypeOfDscr, UINTPTR Dscr_MemPtr,
+			    u32 NoOfBytes)
+{
+	UINTPTR Size;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(ProgPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((TypeOfDscr == XZDMA_LINEAR) ||
+			  (TypeOfDscr == XZDMA_LINKEDLIST));
+	Xil_AssertNonvoid(Dscr_MemPtr != 0x00);
+	Xil_AssertNonvoid(NoOfBytes != 0x00U);
+
+	if (TypeOfDscr == XZDMA_LINEAR) {
+		Size = sizeof(XZDma_LiDscr);
+	} else {
+		Size = sizeof(XZDma_LlDscr);
+	}
+
+	ProgPtr->DscrType = TypeOfDscr;
+	ProgPtr->DscrCount = (NoOfBytes >> 1) / Size;
+	ProgPtr->Count = 0U;
+	ProgPtr->SrcDscrPtr = (void *)Dscr_MemPtr;
+	ProgPtr->DstDscrPtr = (void *)(Dscr_MemPtr +
+				       (Size * ProgPtr->DscrCount));
+	ProgPtr->SrcBase = 0U;
+	ProgPtr->DstBase = 0U;
+	ProgPtr->IsCacheCoherent = InstancePtr->Config.IsCacheCoherent;
+
+	if (!ProgPtr->IsCacheCoherent) {
+		Xil_DCacheInvalidateRange((INTPTR)Dscr_MemPtr, NoOfBytes);
+	}
+
+	return ProgPtr->DscrCount;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function builds the descriptor chain of a program from an array of
+* transfers. The addresses of the first transfer are the bases of the
+* program for XZDma_ProgramRebase().
+*
+* @param	ProgPtr is a pointer to the XZDma_Program.
+* @param	Data is a pointer of array to the XZDma_Transfer structure which
+*		has all the configuration fields for initiating data transfer.
+* @param	Num specifies number of array elements of Data pointer.
+*
+* @return
+*		- XST_SUCCESS - if the chain is built.
+*		- XST_FAILURE - if the program has less than Num descriptors.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_ProgramBuild(XZDma_Program *ProgPtr, XZDma_Transfer *Data,
+		       u32 Num)
+{
+	u32 Index;
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(ProgPtr != NULL);
+	Xil_AssertNonvoid(Data != NULL);
+	Xil_AssertNonvoid(Num != 0x00U);
+
+	if (Num > ProgPtr->DscrCount) {
+		Status = XST_FAILURE;
+	} else {
+		for (Index = 0U; Index < Num; Index++) {
+			XZDma_ProgramSetDscr(ProgPtr, Index, &Data[Index],
+					     (Index == (Num - 1U)) ? TRUE : FALSE);
+		}
+		ProgPtr->Count = Num;
+		ProgPtr->SrcBase = Data[0].SrcAddr;
+		ProgPtr->DstBase = Data[0].DstAddr;
+		XZDma_ProgramFlush(ProgPtr);
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function builds the descriptor chain of a program which copies a 2D
+* tile, one descriptor per row.
+*
+* @param	ProgPtr is a pointer to the XZDma_Program.
+* @param	SrcAddr is the address of the first row of the source.
+* @param	SrcStride is the distance between two source rows in bytes.
+* @param	DstAddr is the address of the first row of the destination.
+* @param	DstStride is the distance between two destination rows in
+*		bytes.
+* @param	RowSize is the size of a row in bytes.
+* @param	Rows is the number of rows.
+*
+* @return
+*		- XST_SUCCESS - if the chain is built.
+*		- XST_FAILURE - if the program has less than Rows descriptors.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_ProgramTile(XZDma_Program *ProgPtr, UINTPTR SrcAddr,
+		      u32 SrcStride, UINTPTR DstAddr, u32 DstStride,
+		      u32 RowSize, u32 Rows)
+{
+	XZDma_Transfer Data;
+	u32 Index;
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(ProgPtr != NULL);
+	Xil_AssertNonvoid(RowSize != 0x00U);
+	Xil_AssertNonvoid(Rows != 0x00U);
+
+	if (Rows > ProgPtr->DscrCount) {
+		Status = XST_FAILURE;
+	} else {
+		Data.Size = RowSize;
+		Data.SrcCoherent = ProgPtr->IsCacheCoherent;
+		Data.DstCoherent = ProgPtr->IsCacheCoherent;
+		Data.Pause = FALSE;
+		for (Index = 0U; Index < Rows; Index++) {
+			Data.SrcAddr = SrcAddr + ((UINTPTR)Index * SrcStride);
+			Data.DstAddr = DstAddr + ((UINTPTR)Index * DstStride);
+			XZDma_ProgramSetDscr(ProgPtr, Index, &Data,
+					     (Index == (Rows - 1U)) ? TRUE : FALSE);
+		}
+		ProgPtr->Count = Rows;
+		ProgPtr->SrcBase = SrcAddr;
+		ProgPtr->DstBase = DstAddr;
+		XZDma_ProgramFlush(ProgPtr);
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function moves the chain of a program to other buffers. All the
+* source addresses are moved by the distance from the current source base
+* to SrcBase, and all the destination addresses by the distance from the
+* current destination base to DstBase. Only the address words of the
+* descriptors are written.
+*
+* @param	ProgPtr is a pointer to the XZDma_Program.
+* @param	SrcBase is the new source address of the first descriptor.
+*		Pass ProgPtr->SrcBase to keep the source addresses.
+* @param	DstBase is the new destination address of the first descriptor.
+*		Pass ProgPtr->DstBase to keep the destination addresses.
+*
+* @return	None.
+*
+* @note		The program must not be running on a channel.
+*
+******************************************************************************/
+void XZDma_ProgramRebase(XZDma_Program *ProgPtr, UINTPTR SrcBase,
+			 UINTPTR DstBase)
+{
+	u64 SrcDelta;
+	u64 DstDelta;
+	u32 Index;
+	XZDma_LiDscr *LiSrcDscr;
+	XZDma_LiDscr *LiDstDscr;
+	XZDma_LlDscr *LlSrcDscr;
+	XZDma_LlDscr *LlDstDscr;
+
+	/* Verify arguments */
+	Xil_AssertVoid(ProgPtr != NULL);
+	Xil_AssertVoid(ProgPtr->Count != 0x00U);
+
+	/* Unsigned wrap around gives the negative distances */
+	SrcDelta = (u64)SrcBase - (u64)ProgPtr->SrcBase;
+	DstDelta = (u64)DstBase - (u64)ProgPtr->DstBase;
+
+	if (ProgPtr->DscrType == XZDMA_LINEAR) {
+		LiSrcDscr = (XZDma_LiDscr *)ProgPtr->SrcDscrPtr;
+		LiDstDscr = (XZDma_LiDscr *)ProgPtr->DstDscrPtr;
+		for (Index = 0U; Index < ProgPtr->Count; Index++) {
+			LiSrcDscr[Index].Address += SrcDelta;
+			LiDstDscr[Index].Address += DstDelta;
+		}
+	} else {
+		LlSrcDscr = (XZDma_LlDscr *)ProgPtr->SrcDscrPtr;
+		LlDstDscr = (XZDma_LlDscr *)ProgPtr->DstDscrPtr;
+		for (Index = 0U; Index < ProgPtr->Count; Index++) {
+			LlSrcDscr[Index].Address += SrcDelta;
+			LlDstDscr[Index].Address += DstDelta;
+		}
+	}
+
+	ProgPtr->SrcBase = SrcBase;
+	ProgPtr->DstBase = DstBase;
+	XZDma_ProgramFlush(ProgPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts the chain of a program on a channel. The channel must
+* be in scatter gather mode, see XZDma_SetMode().
+*
+* @param	InstancePtr is a pointer to the XZDma instance.
+* @param	ProgPtr is a pointer to the XZDma_Program.
+*
+* @return
+*		- XST_SUCCESS - if ZDMA initiated the transfer.
+*		- XST_FAILURE - if ZDMA is busy.
+*
+* @note		The program is the descriptor list of the channel until the
+*		transfer is done, e.g. for XZDma_Resume().
+*		No cache maintenance is done on the descriptors, which are
+*		flushed when they are built or rebased, nor on the data
+*		buffers, which the caller flushes and invalidates as for
+*		XZDma_Start().
+*
+******************************************************************************/
+s32 XZDma_ProgramStart(XZDma *InstancePtr, XZDma_Program *ProgPtr)
+{
+	s32 Status;
+	u64 LocalAddr;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ProgPtr != NULL);
+	Xil_AssertNonvoid(ProgPtr->Count != 0x00U);
+	Xil_AssertNonvoid(InstancePtr->IsSgDma == TRUE);
+
+	if (InstancePtr->ChannelState == XZDMA_BUSY) {
+		Status = XST_FAILURE;
+	} else {
+		InstancePtr->Descriptor.SrcDscrPtr = ProgPtr->SrcDscrPtr;
+		InstancePtr->Descriptor.DstDscrPtr = ProgPtr->DstDscrPtr;
+		InstancePtr->Descriptor.DscrCount = ProgPtr->DscrCount;
+		InstancePtr->Descriptor.DscrType = ProgPtr->DscrType;
+
+		XZDma_WriteReg(InstancePtr->Config.BaseAddress,
+			       XZDMA_CH_SRC_START_LSB_OFFSET,
+			       ((UINTPTR)(ProgPtr->SrcDscrPtr) &
+				XZDMA_WORD0_LSB_MASK));
+		LocalAddr = (u64)(UINTPTR)(ProgPtr->SrcDscrPtr);
+		XZDma_WriteReg(InstancePtr->Config.BaseAddress,
+			       XZDMA_CH_SRC_START_MSB_OFFSET,
+			       ((LocalAddr >>
+				 XZDMA_WORD1_MSB_SHIFT) & XZDMA_WORD1_MSB_MASK));
+		XZDma_WriteReg(InstancePtr->Config.BaseAddress,
+			       XZDMA_CH_DST_START_LSB_OFFSET,
+			       ((UINTPTR)(ProgPtr->DstDscrPtr) &
+				XZDMA_WORD0_LSB_MASK));
+		LocalAddr = (u64)(UINTPTR)(ProgPtr->DstDscrPtr);
+		XZDma_WriteReg(InstancePtr->Config.BaseAddress,
+			       XZDMA_CH_DST_START_MSB_OFFSET,
+			       ((LocalAddr >>
+				 XZDMA_WORD1_MSB_SHIFT) & XZDMA_WORD1_MSB_MASK));
+
+		XZDma_Enable(InstancePtr);
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function splits a copy in as many stripes as channels and starts one
+* stripe per channel. The stripes are XZDMA_STRIPE_ALIGN aligned, a small
+* copy uses less channels. The channels must be in simple normal mode, see
+* XZDma_SetMode(), and are best taken from the same DMA.
+*
+* @param	InstancePtrs is an array of pointers to the XZDma instances.
+* @param	NumChannels is the number of instances in InstancePtrs.
+* @param	Data is a pointer to the XZDma_Transfer structure of the copy.
+*
+* @return
+*		- XST_SUCCESS - if ZDMA initiated the transfer.
+*		- XST_FAILURE - if one of the channels is busy, then none is
+*		  started.
+*
+* @note		Use XZDma_StripeIsDone() to wait for the end of the copy.
+*
+******************************************************************************/
+s32 XZDma_StripeStart(XZDma **InstancePtrs, u32 NumChannels,
+		      XZDma_Transfer *Data)
+{
+	XZDma_Transfer Stripe;
+	u32 StripeSize;
+	u32 Offset;
+	u32 Index;
+	s32 Status = XST_SUCCESS;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtrs != NULL);
+	Xil_AssertNonvoid(NumChannels != 0x00U);
+	Xil_AssertNonvoid(Data != NULL);
+	Xil_AssertNonvoid(Data->Size != 0x00U);
+
+	for (Index = 0U; Index < NumChannels; Index++) {
+		Xil_AssertNonvoid(InstancePtrs[Index] != NULL);
+		Xil_AssertNonvoid(InstancePtrs[Index]->IsSgDma != TRUE);
+		if (InstancePtrs[Index]->ChannelState == XZDMA_BUSY) {
+			Status = XST_FAILURE;
+		}
+	}
+
+	if (Status == XST_SUCCESS) {
+		StripeSize = (Data->Size + (NumChannels - 1U)) / NumChannels;
+		StripeSize = (StripeSize + (XZDMA_STRIPE_ALIGN - 1U)) &
+			     ~(XZDMA_STRIPE_ALIGN - 1U);
+		Stripe = *Data;
+		Offset = 0U;
+		for (Index = 0U; (Index < NumChannels) &&
+		     (Offset < Data->Size); Index++) {
+			Stripe.SrcAddr = Data->SrcAddr + Offset;
+			Stripe.DstAddr = Data->DstAddr + Offset;
+			if ((Data->Size - Offset) > StripeSize) {
+				Stripe.Size = StripeSize;
+			} else {
+				Stripe.Size = Data->Size - Offset;
+			}
+			(void)XZDma_Start(InstancePtrs[Index], &Stripe, 1U);
+			Offset += Stripe.Size;
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks whether a copy started with XZDma_StripeStart() is
+* done on all channels.
+*
+* @param	InstancePtrs is an array of pointers to the XZDma instances.
+* @param	NumChannels is the number of instances in InstancePtrs.
+*
+* @return
+*		- TRUE - if all the channels are done.
+*		- FALSE - if a channel is still busy.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XZDma_StripeIsDone(XZDma **InstancePtrs, u32 NumChannels)
+{
+	u32 Index;
+	u32 IsDone = TRUE;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtrs != NULL);
+	Xil_AssertNonvoid(NumChannels != 0x00U);
+
+	for (Index = 0U; Index < NumChannels; Index++) {
+		if (XZDma_ChannelState(InstancePtrs[Index]) == XZDMA_BUSY) {
+			IsDone = FALSE;
+			break;
+		}
+	}
+
+	return IsDone;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function sets the source and destination descriptors of a
+* program for a transfer.
+*
+* @param	ProgPtr is a pointer to the XZDma_Program.
+* @param	Index is the index of the descriptors.
+* @param	Data is a pointer to the XZDma_Transfer structure.
+* @param	IsLast specifies whether the descriptors are the last ones.
+*
+* @return	None.
+*
+* @note		The descriptors are not flushed from the cache.
+*
+******************************************************************************/
+static void XZDma_ProgramSetDscr(XZDma_Program *ProgPtr, u32 Index,
+				 XZDma_Transfer *Data, u8 IsLast)
+{
+	u32 SrcCntl;
+	u32 DstCntl = 0U;
+	u64 NextSrcAdrs = 0x00U;
+	u64 NextDstAdrs = 0x00U;
+	XZDma_LiDscr *LiDscr;
+	XZDma_LlDscr *LlDscr;
+
+	if (Data->Pause == TRUE) {
+		SrcCntl = XZDMA_WORD3_CMD_PAUSE_MASK;
+	} else if (IsLast == TRUE) {
+		SrcCntl = XZDMA_WORD3_CMD_STOP_MASK;
+	} else {
+		SrcCntl = XZDMA_WORD3_CMD_NXTVALID_MASK;
+	}
+	if (Data->SrcCoherent == TRUE) {
+		SrcCntl |= XZDMA_WORD3_COHRNT_MASK;
+	}
+	if (Data->DstCoherent == TRUE) {
+		DstCntl |= XZDMA_WORD3_COHRNT_MASK;
+	}
+
+	if (ProgPtr->DscrType == XZDMA_LINEAR) {
+		LiDscr = &((XZDma_LiDscr *)ProgPtr->SrcDscrPtr)[Index];
+		LiDscr->Address = (u64)Data->SrcAddr;
+		LiDscr->Size = Data->Size & XZDMA_WORD2_SIZE_MASK;
+		LiDscr->Cntl = SrcCntl;
+
+		LiDscr = &((XZDma_LiDscr *)ProgPtr->DstDscrPtr)[Index];
+		LiDscr->Address = (u64)Data->DstAddr;
+		LiDscr->Size = Data->Size & XZDMA_WORD2_SIZE_MASK;
+		LiDscr->Cntl = DstCntl;
+	} else {
+		if (IsLast != TRUE) {
+			NextSrcAdrs = (u64)(UINTPTR)
+				&((XZDma_LlDscr *)ProgPtr->SrcDscrPtr)[Index + 1U];
+			NextDstAdrs = (u64)(UINTPTR)
+				&((XZDma_LlDscr *)ProgPtr->DstDscrPtr)[Index + 1U];
+		}
+
+		LlDscr = &((XZDma_LlDscr *)ProgPtr->SrcDscrPtr)[Index];
+		LlDscr->Address = (u64)Data->SrcAddr;
+		LlDscr->Size = Data->Size & XZDMA_WORD2_SIZE_MASK;
+		LlDscr->Cntl = SrcCntl;
+		LlDscr->NextDscr = NextSrcAdrs;
+		LlDscr->Reserved = 0U;
+
+		LlDscr = &((XZDma_LlDscr *)ProgPtr->DstDscrPtr)[Index];
+		LlDscr->Address = (u64)Data->DstAddr;
+		LlDscr->Size = Data->Size & XZDMA_WORD2_SIZE_MASK;
+		LlDscr->Cntl = DstCntl;
+		LlDscr->NextDscr = NextDstAdrs;
+		LlDscr->Reserved = 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function flushes the descriptors of a program from the cache,
+* with one call per descriptor list.
+*
+* @param	ProgPtr is a pointer to the XZDma_Program.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XZDma_ProgramFlush(XZDma_Program *ProgPtr)
+{
+	UINTPTR Size;
+
+	if (!ProgPtr->IsCacheCoherent) {
+		if (ProgPtr->DscrType == XZDMA_LINEAR) {
+			Size = sizeof(XZDma_LiDscr);
+		} else {
+			Size = sizeof(XZDma_LlDscr);
+		}
+		Size *= ProgPtr->Count;
+		Xil_DCacheFlushRange((UINTPTR)ProgPtr->SrcDscrPtr, Size);
+		Xil_DCacheFlushRange((UINTPTR)ProgPtr->DstDscrPtr, Size);
+	}
+}
+/** @} */
@@ -9,7 +9,12 @@
 * @file xil_mem.c
 *
 * This file contains xil mem copy function to use in case of word aligned
-* data copies.
+* data copies, and Xil_MemCpyNormal() for copies between buffers in Normal
+* memory. Xil_MemCpyNormal() aligns the destination with byte copies, then
+* moves the bulk of the data in native word sized, unrolled blocks (64-bit
+* LDP/STP pairs on AArch64, 32-bit words on Cortex-R5, Cortex-A9 and
+* MicroBlaze) and finishes the tail with byte copies. When XIL_MEM_USE_NEON
+* is defined large blocks are copied with NEON on AArch64.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -22,6 +27,9 @@
 * 			  violations.
 * 7.7	sk	 01/10/22 Include xil_mem.h header file to fix Xil_MemCpy
 * 			  prototype misra_c_2012_rule_8_4 violation.
+* 9.1   kt       10/18/26 Add Xil_MemCpyNormal, aligning the destination and
+* 			  copying in unrolled native word blocks, with an
+* 			  optional NEON path for AArch64.
 *
 * </pre>
 *
@@ -31,6 +39,28 @@
 
 #include "xil_types.h"
 #include "xil_mem.h"
+#if defined (__aarch64__) && defined (XIL_MEM_USE_NEON) && defined (__ARM_NEON)
+#include <arm_neon.h>
+#define XIL_MEM_NEON	/**< NEON block copy is available */
+#endif
+
+/************************** Constant Definitions ****************************/
+
+#if defined (__aarch64__) || defined (__arch64__)
+typedef u64 XMemWord;
+#else
+typedef u32 XMemWord;
+#endif
+
+#define XMEM_WORD_SIZE		((u32)sizeof(XMemWord))
+#define XMEM_WORD_MASK		((UINTPTR)XMEM_WORD_SIZE - 1U)
+#define XMEM_BLOCK_SIZE		(4U * XMEM_WORD_SIZE)
+#define XMEM_NEON_BLOCK_SIZE	64U
+#define XMEM_NEON_THRESHOLD	256U
+
+#if defined (__aarch64__) || defined (__ARM_FEATURE_UNALIGNED)
+#define XMEM_UNALIGNED_LOAD	/**< Unaligned word loads are supported */
+#endif
 
 /***************** Inline Functions Definitions ********************/
 /*****************************************************************************/
@@ -68,3 +98,137 @@ void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 		cnt -= 1U;
 	}
 }
+
+/*****************************************************************************/
+/**
+* @brief       This function copies memory from one location to another,
+*              both in Normal memory.
+*
+* @param       dst: pointer pointing to destination memory
+*
+* @param       src: pointer pointing to source memory
+*
+* @param       cnt: 32 bit length of bytes to be copied
+*
+* @note        The copy uses unaligned and 64-bit accesses, which take
+*              alignment faults on Device memory, such as the OSPI linear
+*              window on Versal. Use Xil_MemCpy() for Device memory.
+*
+* @note        When source and destination have a different alignment
+*              inside a word, the source is loaded with unaligned word
+*              accesses on processors that support them and copied with
+*              byte accesses on the others (MicroBlaze).
+*
+*****************************************************************************/
+void Xil_MemCpyNormal(void* dst, const void* src, u32 cnt)
+{
+	u8 *d = (u8 *)dst;
+	const u8 *s = (const u8 *)src;
+	XMemWord *dw;
+	const XMemWord *sw;
+	u32 Head;
+
+	if (cnt >= XMEM_BLOCK_SIZE) {
+		/* Align the destination */
+		Head = (u32)((XMEM_WORD_SIZE - ((UINTPTR)d & XMEM_WORD_MASK)) &
+			     XMEM_WORD_MASK);
+		cnt -= Head;
+		while (Head > 0U) {
+			*d = *s;
+			d += 1U;
+			s += 1U;
+			Head -= 1U;
+		}
+
+#ifdef XIL_MEM_NEON
+		if (cnt >= XMEM_NEON_THRESHOLD) {
+			while (cnt >= XMEM_NEON_BLOCK_SIZE) {
+				uint8x16x4_t Block = vld1q_u8_x4(s);
+				vst1q_u8_x4(d, Block);
+				d += XMEM_NEON_BLOCK_SIZE;
+				s += XMEM_NEON_BLOCK_SIZE;
+				cnt -= XMEM_NEON_BLOCK_SIZE;
+			}
+		}
+#endif
+		dw = (XMemWord *)(void *)d;
+		if (((UINTPTR)s & XMEM_WORD_MASK) == 0U) {
+			sw = (const XMemWord *)(const void *)s;
+			while (cnt >= XMEM_BLOCK_SIZE) {
+				XMemWord W0 = sw[0];
+				XMemWord W1 = sw[1];
+				XMemWord W2 = sw[2];
+				XMemWord W3 = sw[3];
+
+				dw[0] = W0;
+				dw[1] = W1;
+				dw[2] = W2;
+				dw[3] = W3;
+				dw += 4U;
+				sw += 4U;
+				cnt -= XMEM_BLOCK_SIZE;
+			}
+			while (cnt >= XMEM_WORD_SIZE) {
+				*dw = *sw;
+				dw += 1U;
+				sw += 1U;
+				cnt -= XMEM_WORD_SIZE;
+			}
+			s = (const u8 *)(const void *)sw;
+		} else {
+#ifdef XMEM_UNALIGNED_LOAD
+			/*
+			 * The processor supports unaligned loads from normal
+			 * memory, load the source words unaligned.
+			 */
+			while (cnt >= XMEM_BLOCK_SIZE) {
+				XMemWord W0, W1, W2, W3;
+
+				(void)__builtin_memcpy(&W0, s, XMEM_WORD_SIZE);
+				(void)__builtin_memcpy(&W1, &s[XMEM_WORD_SIZE], XMEM_WORD_SIZE);
+				(void)__builtin_memcpy(&W2, &s[2U * XMEM_WORD_SIZE], XMEM_WORD_SIZE);
+				(void)__builtin_memcpy(&W3, &s[3U * XMEM_WORD_SIZE], XMEM_WORD_SIZE);
+				dw[0] = W0;
+				dw[1] = W1;
+				dw[2] = W2;
+				dw[3] = W3;
+				dw += 4U;
+				s += XMEM_BLOCK_SIZE;
+				cnt -= XMEM_BLOCK_SIZE;
+			}
+#else
+			/* Copy unrolled bytes */
+			u8 *db = (u8 *)(void *)dw;
+
+			while (cnt >= 4U) {
+				db[0] = s[0];
+				db[1] = s[1];
+				db[2] = s[2];
+				db[3] = s[3];
+				db += 4U;
+				s += 4U;
+				cnt -= 4U;
+			}
+			dw = (XMemWord *)(void *)db;
+#endif
+		}
+		d = (u8 *)(void *)dw;
+	} else if ((((UINTPTR)d | (UINTPTR)s) & 3U) == 0U) {
+		/* Short copy of word aligned buffers */
+		while (cnt >= sizeof (u32)) {
+			*(u32 *)(void *)d = *(const u32 *)(const void *)s;
+			d += sizeof (u32);
+			s += sizeof (u32);
+			cnt -= sizeof (u32);
+		}
+	} else {
+		/* Short unaligned copy is done with the byte loop below */
+	}
+
+	while (cnt > 0U) {
+		*d = *s;
+		d += 1U;
+		s += 1U;
+		cnt -= 1U;
+	}
+}
@@ -90,6 +90,8 @@
 * 9.0   ml       09/13/23 Replaced numerical types (int) with proper typedefs(s32) to
 *                         fix MISRA-C violations for Rule 4.6
 * 9.1   kpt      02/21/24 Added Xil_SChangeEndiannessAndCpy function
+* 9.1   kt       10/18/26 Use Xil_MemCpyNormal in Xil_SecureMemCpy and
+*                         Xil_SMemCpy
 *
 * </pre>
 *
@@ -97,6 +99,7 @@
 
 /****************************** Include Files *********************************/
 #include "xil_util.h"
+#include "xil_mem.h"
 #include "sleep.h"
 
 /************************** Constant Definitions ****************************/
@@ -761,6 +764,8 @@ END:
  *
  * @return	XST_SUCCESS on success and error code on failure
  *
+ * @note	Both buffers must be in Normal memory, see Xil_MemCpyNormal().
+ *
  ******************************************************************************/
 s32 Xil_SecureMemCpy(void *DestPtr, u32 DestPtrLen, const void *SrcPtr, u32 Len)
 {
@@ -781,13 +786,7 @@ s32 Xil_SecureMemCpy(void *DestPtr, u32 DestPtrLen, const void *SrcPtr, u32 Len)
 		goto END;
 	}
 
-	/* Loop and copy.  */
-	while (Len != 0U) {
-		*Dest = *Src;
-		Dest++;
-		Src++;
-		Len--;
-	}
+	Xil_MemCpyNormal(Dest, Src, Len);
 	Status = XST_SUCCESS;
 
 END:
@@ -994,6 +993,8 @@ s32 Xil_SMemCmp_CT(const void *Src1, const u32 Src1Size,
  *		XST_SUCCESS - Copy is successful
  * 		XST_INVALID_PARAM - Invalid inputs
  *
+ * @note	Both buffers must be in Normal memory, see Xil_MemCpyNormal().
+ *
  *****************************************************************************/
 s32 Xil_SMemCpy(void *Dest, const u32 DestSize,
 		const void *Src, const u32 SrcSize, const u32 CopyLen)
@@ -1015,7 +1016,7 @@ s32 Xil_SMemCpy(void *Dest, const u32 DestSize,
 	} else if ((Dst8 < Src8) && (&Dst8[CopyLen - 1U] >= Src8)) {
 		Status =  XST_INVALID_PARAM;
 	} else {
-		(void)memcpy(DestTemp, SrcTemp, CopyLen);
+		Xil_MemCpyNormal(DestTemp, SrcTemp, CopyLen);
 		Status = XST_SUCCESS;
 	}
 
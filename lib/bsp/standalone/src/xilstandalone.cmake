@@ -15,6 +15,10 @@ if(("${CMAKE_SYSTEM_PROCESSOR}" STREQUAL "cortexa72")
     else()
         set(EL3 " ")
     endif()
+    option(standalone_memcpy_use_neon "Use NEON for large block copies in Xil_MemCpyNormal (AArch64 only)" OFF)
+    if(standalone_memcpy_use_neon)
+        ADD_DEFINITIONS(-DXIL_MEM_USE_NEON)
+    endif()
 endif()
 
 if("${CMAKE_MACHINE}" STREQUAL "Versal")
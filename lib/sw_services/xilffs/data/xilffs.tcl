@@ -96,6 +96,7 @@ proc xgen_opts_file {libhandle} {
 	set set_fs_rpath [common::get_property CONFIG.set_fs_rpath $libhandle]
 	set word_access [common::get_property CONFIG.word_access $libhandle]
 	set use_chmod [common::get_property CONFIG.use_chmod $libhandle]
+	set sd_async [common::get_property CONFIG.sd_async $libhandle]
 
 	# do processor specific checks
 	set proc  [hsi::get_sw_processor];
@@ -133,6 +134,9 @@ proc xgen_opts_file {libhandle} {
 		if {$periph == "ps7_sdio" || $periph == "psu_sd" || $periph == "psv_pmc_sd" || $periph == "psxl_pmc_sd" || $periph == "psxl_pmc_emmc" || $periph == "psx_pmc_sd" || $periph == "psx_pmc_emmc"} {
 			if {$fs_interface == 1} {
 				puts $file_handle "\#define FILE_SYSTEM_INTERFACE_SD"
+				if {$sd_async == true} {
+					puts $file_handle "\#define FILE_SYSTEM_SD_ASYNC"
+				}
 				break
 			}
 		}
@@ -70,6 +70,8 @@
 * 5.1   ro   06/12/23 Added support for system device-tree flow.
 * 5.2   ap   12/05/23 Add SDT check to fix bug in disk_initialize.
 *       ap   01/11/24 Fix Doxygen warnings.
+*       kt   10/18/26 Use the asynchronous SD transfer queue in disk_read and
+*                     disk_write when FILE_SYSTEM_SD_ASYNC is defined.
 *
 * </pre>
 *
@@ -125,6 +127,93 @@ static u32 SlotType[XSDPS_NUM_INSTANCES];
 static u8 HostCntrlrVer[XSDPS_NUM_INSTANCES];
 #endif
 
+#if defined(FILE_SYSTEM_INTERFACE_SD) && defined(FILE_SYSTEM_SD_ASYNC)
+#define SD_ASYNC_CHUNK_BLKCNT	2048U	/**< Sectors per asynchronous request */
+#define SD_ASYNC_DEPTH		2U	/**< Requests kept queued */
+
+/*****************************************************************************/
+/**
+*
+* Transfers sectors through the asynchronous SD transfer queue. The transfer
+* is split in requests of SD_ASYNC_CHUNK_BLKCNT sectors and SD_ASYNC_DEPTH of
+* them are kept queued, so the ADMA2 descriptors of the next request are
+* ready when the previous one completes and the transfer size is not limited
+* by a single descriptor table.
+*
+* @param	pdrv - Drive number
+* @param	buff - Pointer to the data buffer
+* @param	sector - Start sector, in bytes for standard capacity cards
+* @param	count - Sector count
+* @param	IsWrite - Write if non-zero, read otherwise
+*
+* @return	XST_SUCCESS if all the sectors are transferred, XST_FAILURE
+*		otherwise.
+*
+* @note		The controller data timeout ends a stalled request with an
+*		error, so the function always returns with no request left in
+*		the queue.
+*
+******************************************************************************/
+static s32 SdAsyncTransfer(BYTE pdrv, BYTE *buff, DWORD sector, UINT count,
+			   u8 IsWrite)
+{
+	XSdPs_SgEntry Sg[SD_ASYNC_DEPTH];
+	XSdPs_AsyncReq Req[SD_ASYNC_DEPTH];
+	XSdPs_AsyncReq *Done;
+	u32 Slot = 0U;
+	u32 Pending = 0U;
+	u32 BlkCnt;
+	s32 Status = XST_SUCCESS;
+	s32 Ret;
+
+	while ((count != 0U) || (Pending != 0U)) {
+		if ((count != 0U) && (Pending < SD_ASYNC_DEPTH)) {
+			BlkCnt = (count > SD_ASYNC_CHUNK_BLKCNT) ?
+				 SD_ASYNC_CHUNK_BLKCNT : (u32)count;
+			Sg[Slot].Buff = buff;
+			Sg[Slot].BlkCnt = BlkCnt;
+			Req[Slot].Arg = (u32)sector;
+			Req[Slot].SgList = &Sg[Slot];
+			Req[Slot].SgCount = 1U;
+			Req[Slot].IsWrite = IsWrite;
+
+			Ret = XSdPs_AsyncSubmit(&SdInstance[pdrv], &Req[Slot]);
+			if (Ret != XST_SUCCESS) {
+				/* Drain what is queued and stop */
+				Status = XST_FAILURE;
+				count = 0U;
+				continue;
+			}
+
+			buff += BlkCnt * XSDPS_BLK_SIZE_512_MASK;
+			if ((SdInstance[pdrv].HCS) == 0U) {
+				sector += (DWORD)BlkCnt * (DWORD)XSDPS_BLK_SIZE_512_MASK;
+			} else {
+				sector += (DWORD)BlkCnt;
+			}
+			count -= BlkCnt;
+			Slot = (Slot + 1U) % SD_ASYNC_DEPTH;
+			Pending++;
+		} else {
+			Ret = XSdPs_AsyncPoll(&SdInstance[pdrv], &Done);
+			if (Ret == XST_SUCCESS) {
+				Pending--;
+				if (Done->Status != XST_SUCCESS) {
+					Status = XST_FAILURE;
+					count = 0U;
+				}
+			} else if (Ret == XST_NO_DATA) {
+				Pending = 0U;
+			} else {
+				/* Request still in flight */
+			}
+		}
+	}
+
+	return Status;
+}
+#endif
+
 /*-----------------------------------------------------------------------*/
 /* Get Disk Status							*/
 /*-----------------------------------------------------------------------*/
@@ -394,7 +483,11 @@ DRESULT disk_read (
 		LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
 	}
 
+#ifdef FILE_SYSTEM_SD_ASYNC
+	Status  = SdAsyncTransfer(pdrv, buff, LocSector, count, 0U);
+#else
 	Status  = XSdPs_ReadPolled(&SdInstance[pdrv], (u32)LocSector, count, buff);
+#endif
 	if (Status != XST_SUCCESS) {
 		return RES_ERROR;
 	}
@@ -583,7 +676,11 @@ DRESULT disk_write (
 		LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
 	}
 
+#ifdef FILE_SYSTEM_SD_ASYNC
+	Status  = SdAsyncTransfer(pdrv, (BYTE *)buff, LocSector, count, 1U);
+#else
 	Status  = XSdPs_WritePolled(&SdInstance[pdrv], (u32)LocSector, count, buff);
+#endif
 	if (Status != XST_SUCCESS) {
 		return RES_ERROR;
 	}
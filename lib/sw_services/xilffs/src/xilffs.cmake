@@ -18,6 +18,7 @@ SET(XILFFS_set_fs_rpath	 0 CACHE STRING "Configures relative path feature (valid
 SET_PROPERTY(CACHE XILFFS_set_fs_rpath PROPERTY STRINGS 0 1 2)
 option(XILFFS_word_access "Enables word access for misaligned memory access platform" ON)
 option(XILFFS_use_chmod "Enables use of CHMOD functionality for changing attributes (valid only with read_only set to false)" OFF)
+option(XILFFS_sd_async "Use the asynchronous SD transfer queue in disk_read and disk_write" OFF)
 
 SET(XILFFS_ramfs_size 3145728 CACHE STRING "RAM FS size")
 SET(XILFFS_ramfs_start_addr CACHE STRING "RAM FS start address")
@@ -34,6 +35,9 @@ endif()
 
 if (${XILFFS_fs_interface} EQUAL 1)
 	set(FILE_SYSTEM_INTERFACE_SD " ")
+	if (${XILFFS_sd_async})
+		set(FILE_SYSTEM_SD_ASYNC " ")
+	endif()
 endif()
 
 if (${XILFFS_fs_interface})
@@ -0,0 +1,392 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file freertos_heap_model_test.c
+*
+* Host trace replay of the FreeRTOS heap memory managers. It is built and
+* run with the driver model tests by make -C scripts/host_model, once with
+* heap_tlsf.c (HEAP_TLSF defined) and once with heap_4.c, so that the two
+* can be compared on the same trace.
+*
+* The trace is read from the file given as argument, one event per line:
+* "a <id> <size>" allocates block <id> and "f <id>" frees it, ids below
+* MAX_LIVE. Without argument a trace of an RTOS application is generated:
+* long lived kernel objects and stacks, buffers living for a few thousand
+* events and short lived messages, in sizes from 4 bytes to 8 KB, filling
+* most of the heap.
+*
+* Each block is filled with its id when allocated and checked when freed,
+* and all blocks must be aligned. Once the trace is replayed all the blocks
+* are freed and the heap must be back to one free block of its initial
+* size, with as many allocations as frees in the statistics.
+*
+* The latency of pvPortMalloc() and vPortFree(), the allocations that
+* failed while the free space was large enough, the peak use and the
+* fragmentation (1 - largest free block / free space) sampled along the
+* trace are printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 1.0   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#ifdef HEAP_TLSF
+#define TEST_NAME	"freertos_heap_tlsf_model_test"
+#else
+#define TEST_NAME	"freertos_heap_4_model_test"
+#endif
+
+#define MAX_LIVE	4096U		/* Ids of a trace */
+#define NUM_ALLOCS	100000U		/* Allocations of the generated trace */
+#define MAX_EVENTS	(2U * NUM_ALLOCS)
+#define SAMPLE_PERIOD	1000U		/* Events between fragmentation samples */
+#define HEAP_OVERHEAD	32U		/* Header and alignment of a block */
+#define MAX_CLASSES	64U
+
+/**************************** Type Definitions *******************************/
+
+typedef struct {
+	u32 Time;		/* Event order of the generated trace */
+	u32 Id;
+	u32 Size;		/* 0 for a free */
+} Event;
+
+typedef struct {
+	u64 Ns;
+	u64 MaxNs;
+	u32 Count;
+} Latency;
+
+/************************** Function Prototypes ******************************/
+
+static u32 LoadTrace(const char *Path);
+static u32 GenerateTrace(void);
+static int CompareEvents(const void *A, const void *B);
+static void Allocate(u32 Id, u32 Size);
+static void Free(u32 Id);
+static void Sample(void);
+
+/************************** Variable Definitions *****************************/
+
+static Event Events[MAX_EVENTS];
+static u32 IdOf[NUM_ALLOCS];
+static u8 *Block[MAX_LIVE];
+static u32 BlockSize[MAX_LIVE];
+static Latency MallocTime;
+static Latency FreeTime;
+static u32 Allocations;
+static u32 Failures;
+static u32 FragFailures;
+static double FragSum;
+static double FragMax;
+static u32 Samples;
+
+/*****************************************************************************/
+/*
+* The heap is only used from the test thread, there is no scheduler to
+* suspend nor interrupt to mask.
+*/
+void vTaskSuspendAll(void)
+{
+}
+
+void vPortEnterCritical(void)
+{
+}
+
+void vPortExitCritical(void)
+{
+}
+
+BaseType_t xTaskResumeAll(void)
+{
+	return pdFALSE;
+}
+
+/*****************************************************************************/
+/*
+* Generated trace. Each allocation draws a kind, a size and a lifetime in
+* allocations, and its free is placed at the end of its lifetime: 60 %
+* messages of 4 to 256 bytes living up to 64 allocations, 35 % buffers of
+* 128 bytes to 4 KB living up to 2000, 5 % objects of 512 bytes to 8 KB
+* living up to 20000.
+*/
+static u32 GenerateTrace(void)
+{
+	u32 Pool[MAX_LIVE];
+	u32 NumFree = MAX_LIVE;
+	u32 NumEvents = 0U;
+	u32 Alloc;
+	u32 Index;
+	u32 Kind;
+	u32 Size;
+	u32 Life;
+
+	for (Alloc = 0U; Alloc < NUM_ALLOCS; Alloc++) {
+		Kind = (u32)rand() % 100U;
+		if (Kind < 60U) {
+			Size = 8U << ((u32)rand() % 6U);
+			Life = 1U + ((u32)rand() % 64U);
+		} else if (Kind < 95U) {
+			Size = 256U << ((u32)rand() % 5U);
+			Life = 1U + ((u32)rand() % 2000U);
+		} else {
+			Size = 1024U << ((u32)rand() % 4U);
+			Life = 1U + ((u32)rand() % 20000U);
+		}
+		Size = (Size + ((u32)rand() % Size)) / 2U;
+		/* Both events carry the allocation number until the ids are
+		   given, a free comes before an allocation at the same time */
+		Events[NumEvents].Time = (2U * Alloc) + 1U;
+		Events[NumEvents].Id = Alloc;
+		Events[NumEvents].Size = Size;
+		Events[NumEvents + 1U].Time = 2U * (Alloc + Life);
+		Events[NumEvents + 1U].Id = Alloc;
+		Events[NumEvents + 1U].Size = 0U;
+		NumEvents += 2U;
+	}
+	qsort(Events, NumEvents, sizeof(Events[0]), CompareEvents);
+
+	/* Ids are handed out in trace order and reused once freed */
+	for (Index = 0U; Index < MAX_LIVE; Index++) {
+		Pool[Index] = Index;
+	}
+	for (Index = 0U; Index < NumEvents; Index++) {
+		Alloc = Events[Index].Id;
+		if (Events[Index].Size != 0U) {
+			XHOST_CHECK(NumFree != 0U, "more than %u live blocks",
+				    (unsigned)MAX_LIVE);
+			if (NumFree == 0U) {
+				return Index;
+			}
+			NumFree--;
+			IdOf[Alloc] = Pool[NumFree];
+		} else {
+			Pool[NumFree] = IdOf[Alloc];
+			NumFree++;
+		}
+		Events[Index].Id = IdOf[Alloc];
+	}
+
+	return NumEvents;
+}
+
+static int CompareEvents(const void *A, const void *B)
+{
+	const Event *EventA = A;
+	const Event *EventB = B;
+
+	return (EventA->Time > EventB->Time) - (EventA->Time < EventB->Time);
+}
+
+static u32 LoadTrace(const char *Path)
+{
+	FILE *File = fopen(Path, "r");
+	u32 NumEvents = 0U;
+	char Op;
+	unsigned Id;
+	unsigned Size;
+
+	XHOST_CHECK(File != NULL, "cannot open %s", Path);
+	if (File == NULL) {
+		return 0U;
+	}
+	while ((NumEvents < MAX_EVENTS) &&
+	       (fscanf(File, " %c %u", &Op, &Id) == 2)) {
+		Size = 0U;
+		if ((Op == 'a') && (fscanf(File, "%u", &Size) != 1)) {
+			break;
+		}
+		if (Id >= MAX_LIVE) {
+			continue;
+		}
+		Events[NumEvents].Id = Id;
+		Events[NumEvents].Size = Size;
+		NumEvents++;
+	}
+	(void)fclose(File);
+
+	return NumEvents;
+}
+
+/*****************************************************************************/
+/*
+* Replay of one event, timed, with the block filled with its id or checked
+* against it.
+*/
+static void Allocate(u32 Id, u32 Size)
+{
+	size_t FreeSize = xPortGetFreeHeapSize();
+	u64 StartNs;
+	u64 Ns;
+	u8 *Ptr;
+
+	if (Block[Id] != NULL) {
+		return;
+	}
+	StartNs = XHostModel_TimeNs();
+	Ptr = pvPortMalloc(Size);
+	Ns = XHostModel_TimeNs() - StartNs;
+	MallocTime.Ns += Ns;
+	MallocTime.Count++;
+	if (Ns > MallocTime.MaxNs) {
+		MallocTime.MaxNs = Ns;
+	}
+	if (Ptr == NULL) {
+		Failures++;
+		if (FreeSize >= (Size + HEAP_OVERHEAD)) {
+			FragFailures++;
+		}
+		return;
+	}
+	XHOST_CHECK(((size_t)Ptr & portBYTE_ALIGNMENT_MASK) == 0U,
+		    "block %u at %p", (unsigned)Id, (void *)Ptr);
+	memset(Ptr, (int)(Id & 0xFFU), Size);
+	Block[Id] = Ptr;
+	BlockSize[Id] = Size;
+	Allocations++;
+}
+
+static void Free(u32 Id)
+{
+	u8 *Ptr = Block[Id];
+	u64 StartNs;
+	u64 Ns;
+	u32 Index;
+
+	if (Ptr == NULL) {
+		return;
+	}
+	for (Index = 0U; Index < BlockSize[Id]; Index++) {
+		if (Ptr[Index] != (u8)Id) {
+			XHOST_CHECK(0, "block %u overwritten at %u",
+				    (unsigned)Id, (unsigned)Index);
+			break;
+		}
+	}
+	StartNs = XHostModel_TimeNs();
+	vPortFree(Ptr);
+	Ns = XHostModel_TimeNs() - StartNs;
+	FreeTime.Ns += Ns;
+	FreeTime.Count++;
+	if (Ns > FreeTime.MaxNs) {
+		FreeTime.MaxNs = Ns;
+	}
+	Block[Id] = NULL;
+}
+
+static void Sample(void)
+{
+	HeapStats_t Stats;
+	double Frag;
+
+	vPortGetHeapStats(&Stats);
+	if (Stats.xAvailableHeapSpaceInBytes == 0U) {
+		return;
+	}
+	Frag = 1.0 - ((double)Stats.xSizeOfLargestFreeBlockInBytes /
+		      (double)Stats.xAvailableHeapSpaceInBytes);
+	FragSum += Frag;
+	if (Frag > FragMax) {
+		FragMax = Frag;
+	}
+	Samples++;
+}
+
+int main(int argc, char *argv[])
+{
+	HeapStats_t Stats;
+	size_t InitialFree;
+	u32 NumEvents;
+	u32 Index;
+	u8 *Ptr;
+#ifdef HEAP_TLSF
+	HeapClassStats_t Classes[MAX_CLASSES];
+	UBaseType_t NumClasses;
+	size_t ClassAllocs = 0U;
+	size_t ClassFrees = 0U;
+#endif
+
+	srand(1U);
+	NumEvents = (argc > 1) ? LoadTrace(argv[1]) : GenerateTrace();
+
+	/* The heap is set up on the first allocation */
+	Ptr = pvPortMalloc(1U);
+	vPortFree(Ptr);
+	InitialFree = xPortGetFreeHeapSize();
+
+	for (Index = 0U; Index < NumEvents; Index++) {
+		if (Events[Index].Size != 0U) {
+			Allocate(Events[Index].Id, Events[Index].Size);
+		} else {
+			Free(Events[Index].Id);
+		}
+		if ((Index % SAMPLE_PERIOD) == 0U) {
+			Sample();
+		}
+	}
+	for (Index = 0U; Index < MAX_LIVE; Index++) {
+		Free(Index);
+	}
+
+	vPortGetHeapStats(&Stats);
+	XHOST_CHECK((Stats.xAvailableHeapSpaceInBytes == InitialFree) &&
+		    (Stats.xNumberOfFreeBlocks == 1U),
+		    "%u bytes free in %u blocks after the trace, %u before",
+		    (unsigned)Stats.xAvailableHeapSpaceInBytes,
+		    (unsigned)Stats.xNumberOfFreeBlocks, (unsigned)InitialFree);
+	XHOST_CHECK((Stats.xNumberOfSuccessfulAllocations ==
+		     Stats.xNumberOfSuccessfulFrees) &&
+		    (Stats.xNumberOfSuccessfulAllocations == Allocations + 1U),
+		    "%u allocations, %u frees, %u in the trace",
+		    (unsigned)Stats.xNumberOfSuccessfulAllocations,
+		    (unsigned)Stats.xNumberOfSuccessfulFrees,
+		    (unsigned)Allocations);
+#ifdef HEAP_TLSF
+	NumClasses = uxPortGetHeapClassStats(Classes, MAX_CLASSES);
+	for (Index = 0U; Index < NumClasses; Index++) {
+		ClassAllocs += Classes[Index].xNumberOfSuccessfulAllocations;
+		ClassFrees += Classes[Index].xNumberOfSuccessfulFrees;
+	}
+	XHOST_CHECK((ClassAllocs == Stats.xNumberOfSuccessfulAllocations) &&
+		    (ClassFrees == Stats.xNumberOfSuccessfulFrees),
+		    "size classes count %u allocations and %u frees",
+		    (unsigned)ClassAllocs, (unsigned)ClassFrees);
+#endif
+
+	printf("%u events, %u KB heap, peak use %u KB\n", (unsigned)NumEvents,
+	       (unsigned)(configTOTAL_HEAP_SIZE / 1024),
+	       (unsigned)((configTOTAL_HEAP_SIZE -
+			   xPortGetMinimumEverFreeHeapSize()) / 1024U));
+	printf("malloc %.0f ns (max %u ns), free %.0f ns (max %u ns)\n",
+	       (double)MallocTime.Ns / (double)MallocTime.Count,
+	       (unsigned)MallocTime.MaxNs,
+	       (double)FreeTime.Ns / (double)FreeTime.Count,
+	       (unsigned)FreeTime.MaxNs);
+	printf("%u failed allocations, %u with enough free space, "
+	       "fragmentation %.1f %% (max %.1f %%)\n", (unsigned)Failures,
+	       (unsigned)FragFailures, 100.0 * FragSum / (double)Samples,
+	       100.0 * FragMax);
+
+	return XHostModel_Report(TEST_NAME);
+}
@@ -0,0 +1,124 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file host_metal.c
+*
+* Host implementation of the libmetal services used by the drivers under
+* test, linked with the tests of the libmetal based drivers. The I/O region
+* accessors are weak so that a test can model its device.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 1.0   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "metal/io.h"
+#include "metal/device.h"
+#include "metal/sys.h"
+#include "metal/sleep.h"
+
+#define MAX_DEVICES	8
+
+static struct metal_device *Devices[MAX_DEVICES];
+static enum metal_log_level LogLevel = METAL_LOG_ERROR;
+
+void metal_io_init(struct metal_io_region *io, void *virt,
+		   const metal_phys_addr_t *physmap, size_t size,
+		   unsigned int page_shift, unsigned int mem_flags,
+		   const void *ops)
+{
+	io->virt = virt;
+	io->physmap = physmap;
+	io->size = size;
+}
+
+__attribute__((weak)) uint64_t metal_io_read(struct metal_io_region *io,
+					     unsigned long offset, int width)
+{
+	uint64_t Value = 0;
+
+	memcpy(&Value, (char *)io->virt + offset, (size_t)width);
+	return Value;
+}
+
+__attribute__((weak)) void metal_io_write(struct metal_io_region *io,
+					  unsigned long offset, uint64_t value,
+					  int width)
+{
+	memcpy((char *)io->virt + offset, &value, (size_t)width);
+}
+
+int metal_register_generic_device(struct metal_device *device)
+{
+	unsigned int Index;
+
+	for (Index = 0U; Index < MAX_DEVICES; Index++) {
+		if ((Devices[Index] == NULL) || (Devices[Index] == device)) {
+			Devices[Index] = device;
+			return 0;
+		}
+	}
+
+	return -1;
+}
+
+int metal_device_open(const char *bus_name, const char *dev_name,
+		      struct metal_device **device)
+{
+	unsigned int Index;
+
+	for (Index = 0U; (Index < MAX_DEVICES) && (Devices[Index] != NULL);
+	     Index++) {
+		if (strcmp(Devices[Index]->name, dev_name) == 0) {
+			*device = Devices[Index];
+			return 0;
+		}
+	}
+
+	return -1;
+}
+
+void metal_device_close(struct metal_device *device)
+{
+}
+
+struct metal_io_region *metal_device_io_region(struct metal_device *device,
+					       unsigned int index)
+{
+	return (index < device->num_regions) ? &device->regions[index] : NULL;
+}
+
+void metal_set_log_level(enum metal_log_level level)
+{
+	LogLevel = level;
+}
+
+void metal_default_log_handler(enum metal_log_level level,
+			       const char *format, ...)
+{
+	va_list Args;
+
+	if (level <= LogLevel) {
+		va_start(Args, format);
+		vprintf(format, Args);
+		va_end(Args);
+	}
+}
+
+int metal_sleep_usec(unsigned int usec)
+{
+	return 0;
+}
@@ -0,0 +1,201 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file host_model.c
+*
+* Host implementation of the standalone services used by the drivers under
+* test. The register accessors, the platform query and the exception mask
+* are weak so that a test can model its device.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 1.0   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+#include <time.h>
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xil_io.h"
+#include "xil_cache.h"
+#include "xil_exception.h"
+#include "xil_util.h"
+#include "xplatform_info.h"
+#include "sleep.h"
+#include "xhost_model.h"
+
+u32 XHostModel_FlushCount;
+u32 XHostModel_InvalidateCount;
+u32 XHostModel_AssertCount;
+u32 XHostModel_Failures;
+
+u32 Xil_AssertStatus;
+s32 Xil_AssertWait;
+
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	printf("assert %s:%d\n", File, (int)Line);
+	XHostModel_AssertCount++;
+}
+
+void XNullHandler(void *NullParameter)
+{
+	(void)NullParameter;
+}
+
+__attribute__((weak)) u8 Xil_In8(UINTPTR Addr)
+{
+	return *(volatile u8 *)Addr;
+}
+
+__attribute__((weak)) u16 Xil_In16(UINTPTR Addr)
+{
+	return *(volatile u16 *)Addr;
+}
+
+__attribute__((weak)) u32 Xil_In32(UINTPTR Addr)
+{
+	return *(volatile u32 *)Addr;
+}
+
+__attribute__((weak)) u64 Xil_In64(UINTPTR Addr)
+{
+	return *(volatile u64 *)Addr;
+}
+
+__attribute__((weak)) void Xil_Out8(UINTPTR Addr, u8 Value)
+{
+	*(volatile u8 *)Addr = Value;
+}
+
+__attribute__((weak)) void Xil_Out16(UINTPTR Addr, u16 Value)
+{
+	*(volatile u16 *)Addr = Value;
+}
+
+__attribute__((weak)) void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	*(volatile u32 *)Addr = Value;
+}
+
+__attribute__((weak)) void Xil_Out64(UINTPTR Addr, u64 Value)
+{
+	*(volatile u64 *)Addr = Value;
+}
+
+__attribute__((weak)) u32 XGetPlatform_Info(void)
+{
+	return XPLAT_ZYNQ_ULTRA_MP;
+}
+
+__attribute__((weak)) void Xil_ExceptionEnable(void)
+{
+}
+
+__attribute__((weak)) void Xil_ExceptionDisable(void)
+{
+}
+
+void Xil_DCacheEnable(void)
+{
+}
+
+void Xil_DCacheDisable(void)
+{
+}
+
+void Xil_DCacheFlush(void)
+{
+	XHostModel_FlushCount++;
+}
+
+void Xil_DCacheInvalidate(void)
+{
+	XHostModel_InvalidateCount++;
+}
+
+/*
+ * The range operations end with a full barrier, like the dsb of the target
+ * ones, for the tests that share memory between threads.
+ */
+void Xil_DCacheFlushRange(INTPTR Addr, INTPTR Len)
+{
+	(void)Addr;
+	(void)Len;
+	(void)__atomic_add_fetch(&XHostModel_FlushCount, 1U, __ATOMIC_SEQ_CST);
+}
+
+void Xil_DCacheInvalidateRange(INTPTR Addr, INTPTR Len)
+{
+	(void)Addr;
+	(void)Len;
+	(void)__atomic_add_fetch(&XHostModel_InvalidateCount, 1U, __ATOMIC_SEQ_CST);
+}
+
+void usleep(ULONG useconds)
+{
+	(void)useconds;
+}
+
+void sleep(u32 seconds)
+{
+	(void)seconds;
+}
+
+u32 Xil_WaitForEvent(UINTPTR RegAddr, u32 EventMask, u32 Event, u32 Timeout)
+{
+	u32 Count;
+
+	for (Count = 0U; Count < Timeout; Count++) {
+		if ((Xil_In32(RegAddr) & EventMask) == Event) {
+			return XST_SUCCESS;
+		}
+	}
+
+	return XST_FAILURE;
+}
+
+u32 Xil_WaitForEvents(UINTPTR EventsRegAddr, u32 EventsMask, u32 WaitEvents,
+		      u32 Timeout, u32 *Events)
+{
+	u32 Count;
+
+	for (Count = 0U; Count < Timeout; Count++) {
+		*Events = Xil_In32(EventsRegAddr) & EventsMask;
+		if ((*Events & WaitEvents) != 0U) {
+			return XST_SUCCESS;
+		}
+	}
+
+	return XST_FAILURE;
+}
+
+u64 XHostModel_TimeNs(void)
+{
+	struct timespec Ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return ((u64)Ts.tv_sec * 1000000000U) + (u64)Ts.tv_nsec;
+}
+
+int XHostModel_Report(const char *Name)
+{
+	if ((XHostModel_Failures != 0U) || (XHostModel_AssertCount != 0U)) {
+		printf("%s: FAIL (%u checks, %u asserts)\n", Name,
+		       XHostModel_Failures, XHostModel_AssertCount);
+		return 1;
+	}
+
+	printf("%s: PASS\n", Name);
+	return 0;
+}
@@ -0,0 +1,42 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: the FreeRTOS configuration of the
+ * POSIX port for the tests of the kernel sources which do not start the
+ * scheduler. The assertions are counted by host_model.c, see xhost_model.h.
+ */
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+void Xil_Assert(const char *File, int32_t Line);
+
+#define configUSE_PREEMPTION			1
+#define configUSE_IDLE_HOOK			0
+#define configUSE_TICK_HOOK			0
+#define configUSE_16_BIT_TICKS			0
+#define configTICK_RATE_HZ			1000
+#define configMAX_PRIORITIES			8
+#define configMINIMAL_STACK_SIZE		1024
+#define configMAX_TASK_NAME_LEN			16
+#define configUSE_MALLOC_FAILED_HOOK		0
+#define configSUPPORT_DYNAMIC_ALLOCATION	1
+#define configSUPPORT_STATIC_ALLOCATION		0
+#ifndef configTOTAL_HEAP_SIZE
+#define configTOTAL_HEAP_SIZE			(2048 * 1024)
+#endif
+#define portPOINTER_SIZE_TYPE			size_t
+
+#define configASSERT(x)					\
+	do {						\
+		if (!(x)) {				\
+			Xil_Assert(__FILE__, __LINE__);	\
+		}					\
+	} while (0)
+
+#endif
@@ -0,0 +1,15 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: no processor specific settings.
+ */
+#ifndef BSPCONFIG_H
+#define BSPCONFIG_H
+
+#define EL1_NONSECURE	0
+#define EL3		1
+
+#endif
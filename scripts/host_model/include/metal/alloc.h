@@ -0,0 +1,24 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: libmetal allocations from the heap.
+ */
+#ifndef METAL_ALLOC_H
+#define METAL_ALLOC_H
+
+#include <stdlib.h>
+
+static inline void *metal_allocate_memory(unsigned int size)
+{
+	return malloc(size);
+}
+
+static inline void metal_free_memory(void *ptr)
+{
+	free(ptr);
+}
+
+#endif
@@ -0,0 +1,16 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: the host compiler is GCC or
+ * compatible.
+ */
+#ifndef METAL_COMPILER_H
+#define METAL_COMPILER_H
+
+#define metal_align(n)	__attribute__((aligned(n)))
+#define metal_weak	__attribute__((weak))
+
+#endif
@@ -0,0 +1,31 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: libmetal devices are a name and
+ * their I/O regions, registered and opened by host_metal.c.
+ */
+#ifndef METAL_DEVICE_H
+#define METAL_DEVICE_H
+
+#include "metal/io.h"
+
+#define METAL_MAX_DEVICE_REGIONS	32
+
+struct metal_device {
+	const char *name;
+	void *bus;
+	unsigned int num_regions;
+	struct metal_io_region regions[METAL_MAX_DEVICE_REGIONS];
+};
+
+int metal_register_generic_device(struct metal_device *device);
+int metal_device_open(const char *bus_name, const char *dev_name,
+		      struct metal_device **device);
+void metal_device_close(struct metal_device *device);
+struct metal_io_region *metal_device_io_region(struct metal_device *device,
+					       unsigned int index);
+
+#endif
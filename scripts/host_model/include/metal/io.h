@@ -0,0 +1,44 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: the libmetal I/O regions used by the
+ * drivers. The accesses go through metal_io_read() and metal_io_write(),
+ * which host_metal.c backs with the memory of the region. A test that models
+ * the behavior of a device provides its own definitions.
+ */
+#ifndef METAL_IO_H
+#define METAL_IO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef unsigned long metal_phys_addr_t;
+
+struct metal_io_region {
+	void *virt;
+	const metal_phys_addr_t *physmap;
+	size_t size;
+};
+
+void metal_io_init(struct metal_io_region *io, void *virt,
+		   const metal_phys_addr_t *physmap, size_t size,
+		   unsigned int page_shift, unsigned int mem_flags,
+		   const void *ops);
+uint64_t metal_io_read(struct metal_io_region *io, unsigned long offset,
+		       int width);
+void metal_io_write(struct metal_io_region *io, unsigned long offset,
+		    uint64_t value, int width);
+
+#define metal_io_read8(io, offset)	((uint8_t)metal_io_read(io, offset, 1))
+#define metal_io_read16(io, offset)	((uint16_t)metal_io_read(io, offset, 2))
+#define metal_io_read32(io, offset)	((uint32_t)metal_io_read(io, offset, 4))
+#define metal_io_read64(io, offset)	metal_io_read(io, offset, 8)
+#define metal_io_write8(io, offset, value)  metal_io_write(io, offset, value, 1)
+#define metal_io_write16(io, offset, value) metal_io_write(io, offset, value, 2)
+#define metal_io_write32(io, offset, value) metal_io_write(io, offset, value, 4)
+#define metal_io_write64(io, offset, value) metal_io_write(io, offset, value, 8)
+
+#endif
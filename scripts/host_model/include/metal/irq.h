@@ -0,0 +1,16 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: return values of the libmetal
+ * interrupt handlers, no interrupt is raised.
+ */
+#ifndef METAL_IRQ_H
+#define METAL_IRQ_H
+
+#define METAL_IRQ_NOT_HANDLED	0
+#define METAL_IRQ_HANDLED	1
+
+#endif
@@ -0,0 +1,17 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: the libmetal list node, which the
+ * OpenAMP structures embed.
+ */
+#ifndef METAL_LIST_H
+#define METAL_LIST_H
+
+struct metal_list {
+	struct metal_list *next, *prev;
+};
+
+#endif
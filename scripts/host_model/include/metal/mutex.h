@@ -0,0 +1,36 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: libmetal mutexes are POSIX mutexes.
+ */
+#ifndef METAL_MUTEX_H
+#define METAL_MUTEX_H
+
+#include <pthread.h>
+
+typedef pthread_mutex_t metal_mutex_t;
+
+static inline void metal_mutex_init(metal_mutex_t *mutex)
+{
+	(void)pthread_mutex_init(mutex, NULL);
+}
+
+static inline void metal_mutex_deinit(metal_mutex_t *mutex)
+{
+	(void)pthread_mutex_destroy(mutex);
+}
+
+static inline void metal_mutex_acquire(metal_mutex_t *mutex)
+{
+	(void)pthread_mutex_lock(mutex);
+}
+
+static inline void metal_mutex_release(metal_mutex_t *mutex)
+{
+	(void)pthread_mutex_unlock(mutex);
+}
+
+#endif
@@ -0,0 +1,15 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: the libmetal delays return at once,
+ * see host_metal.c.
+ */
+#ifndef METAL_SLEEP_H
+#define METAL_SLEEP_H
+
+int metal_sleep_usec(unsigned int usec);
+
+#endif
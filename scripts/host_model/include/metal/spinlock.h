@@ -0,0 +1,35 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: libmetal spinlocks on a C11 atomic
+ * flag.
+ */
+#ifndef METAL_SPINLOCK_H
+#define METAL_SPINLOCK_H
+
+#include <stdatomic.h>
+
+struct metal_spinlock {
+	atomic_flag v;
+};
+
+static inline void metal_spinlock_init(struct metal_spinlock *slock)
+{
+	atomic_flag_clear(&slock->v);
+}
+
+static inline void metal_spinlock_acquire(struct metal_spinlock *slock)
+{
+	while (atomic_flag_test_and_set(&slock->v)) {
+	}
+}
+
+static inline void metal_spinlock_release(struct metal_spinlock *slock)
+{
+	atomic_flag_clear(&slock->v);
+}
+
+#endif
@@ -0,0 +1,33 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: libmetal logging. Messages up to the
+ * level of metal_set_log_level() are printed, errors by default.
+ */
+#ifndef METAL_SYS_H
+#define METAL_SYS_H
+
+#include <stdlib.h>
+#include "metal/io.h"
+
+enum metal_log_level {
+	METAL_LOG_EMERGENCY,
+	METAL_LOG_ALERT,
+	METAL_LOG_CRITICAL,
+	METAL_LOG_ERROR,
+	METAL_LOG_WARNING,
+	METAL_LOG_NOTICE,
+	METAL_LOG_INFO,
+	METAL_LOG_DEBUG,
+};
+
+void metal_set_log_level(enum metal_log_level level);
+void metal_default_log_handler(enum metal_log_level level,
+			       const char *format, ...);
+
+#define metal_log(level, ...)	metal_default_log_handler(level, __VA_ARGS__)
+
+#endif
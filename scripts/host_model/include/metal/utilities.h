@@ -0,0 +1,30 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: the libmetal utility macros used by
+ * the OpenAMP headers and sources.
+ */
+#ifndef METAL_UTILITIES_H
+#define METAL_UTILITIES_H
+
+#include <limits.h>
+#include <stdint.h>
+
+#define metal_dim(x)	(sizeof(x) / sizeof(x[0]))
+
+#define metal_div_round_up(num, den)	(((num) + (den) - 1) / (den))
+
+#define metal_offset_of(structure, member)		\
+	((uintptr_t)&(((structure *)0)->member))
+
+#define metal_container_of(ptr, structure, member)	\
+	(void *)((uintptr_t)(ptr) - metal_offset_of(structure, member))
+
+#define METAL_BITS_PER_ULONG	(CHAR_BIT * sizeof(unsigned long))
+
+#define metal_bitmap_longs(x)	metal_div_round_up((x), METAL_BITS_PER_ULONG)
+
+#endif
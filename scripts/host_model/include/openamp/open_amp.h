@@ -0,0 +1,16 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: the RPMsg API only. The RPMsg device
+ * is modelled by the test, there is no virtio or remoteproc transport.
+ */
+#ifndef OPEN_AMP_H_
+#define OPEN_AMP_H_
+
+#include <metal/spinlock.h>
+#include <openamp/rpmsg.h>
+
+#endif
@@ -0,0 +1,18 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: the delays of the drivers return at
+ * once, see host_model.c.
+ */
+#ifndef SLEEP_H
+#define SLEEP_H
+
+#include "xil_types.h"
+
+void usleep(ULONG useconds);
+void sleep(u32 seconds);
+
+#endif
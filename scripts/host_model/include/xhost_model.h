@@ -0,0 +1,57 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xhost_model.h
+*
+* Common support of the driver model tests. The tests build a driver on the
+* host against a software model of its device, with the standalone headers
+* of lib/bsp/standalone/src/common and the overrides of this directory.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 1.0   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+#ifndef XHOST_MODEL_H
+#define XHOST_MODEL_H
+
+#include <stdio.h>
+#include "xil_types.h"
+
+/** Cache maintenance calls made by the driver under test */
+extern u32 XHostModel_FlushCount;
+extern u32 XHostModel_InvalidateCount;
+
+/** Assertions raised by the driver under test */
+extern u32 XHostModel_AssertCount;
+
+/** Number of failed checks of the test */
+extern u32 XHostModel_Failures;
+
+/** Records a failed check when Cond is false */
+#define XHOST_CHECK(Cond, ...)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s:%d: ", __FILE__, __LINE__);		\
+			printf(__VA_ARGS__);				\
+			printf("\n");					\
+			XHostModel_Failures++;				\
+		}							\
+	} while (0)
+
+/** Monotonic host time in nanoseconds, for the benchmarks */
+u64 XHostModel_TimeNs(void);
+
+/** Prints the result line of a test and returns its exit status */
+int XHostModel_Report(const char *Name);
+
+#endif
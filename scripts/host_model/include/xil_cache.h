@@ -0,0 +1,22 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: cache maintenance is counted by
+ * host_model.c, see xhost_model.h.
+ */
+#ifndef XIL_CACHE_H
+#define XIL_CACHE_H
+
+#include "xil_types.h"
+
+void Xil_DCacheEnable(void);
+void Xil_DCacheDisable(void);
+void Xil_DCacheFlush(void);
+void Xil_DCacheInvalidate(void);
+void Xil_DCacheFlushRange(INTPTR Addr, INTPTR Len);
+void Xil_DCacheInvalidateRange(INTPTR Addr, INTPTR Len);
+
+#endif
@@ -0,0 +1,19 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: the processor exceptions are
+ * enabled and disabled by weak functions of host_model.c that a test can
+ * replace.
+ */
+#ifndef XIL_EXCEPTION_H
+#define XIL_EXCEPTION_H
+
+#include "xil_types.h"
+
+void Xil_ExceptionEnable(void);
+void Xil_ExceptionDisable(void);
+
+#endif
@@ -0,0 +1,44 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: register accesses are functions.
+ * host_model.c backs them with plain memory, a test that models the
+ * behavior of a device provides its own definitions.
+ */
+#ifndef XIL_IO_H
+#define XIL_IO_H
+
+#include "xil_types.h"
+#include "xil_printf.h"
+#include "xstatus.h"
+
+#define INLINE inline
+
+/* Barriers of the memory shared with another processor */
+#define SYNCHRONIZE_IO	__sync_synchronize()
+#define DATA_SYNC	__sync_synchronize()
+#define dmb()		__sync_synchronize()
+
+u8 Xil_In8(UINTPTR Addr);
+u16 Xil_In16(UINTPTR Addr);
+u32 Xil_In32(UINTPTR Addr);
+u64 Xil_In64(UINTPTR Addr);
+void Xil_Out8(UINTPTR Addr, u8 Value);
+void Xil_Out16(UINTPTR Addr, u16 Value);
+void Xil_Out32(UINTPTR Addr, u32 Value);
+void Xil_Out64(UINTPTR Addr, u64 Value);
+
+static inline u16 Xil_EndianSwap16(u16 Data)
+{
+	return (u16)((Data << 8U) | (Data >> 8U));
+}
+
+static inline u32 Xil_EndianSwap32(u32 Data)
+{
+	return __builtin_bswap32(Data);
+}
+
+#endif
@@ -0,0 +1,18 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: console output goes to stdout.
+ */
+#ifndef XIL_PRINTF_H
+#define XIL_PRINTF_H
+
+#include <stdio.h>
+#include "xil_types.h"
+
+#define xil_printf	printf
+#define print(s)	(void)fputs((s), stdout)
+
+#endif
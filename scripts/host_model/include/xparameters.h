@@ -0,0 +1,13 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * Host build of the driver model tests: the tests are built with SDT and
+ * pass the few design parameters they need on the command line.
+ */
+#ifndef XPARAMETERS_H
+#define XPARAMETERS_H
+
+#endif
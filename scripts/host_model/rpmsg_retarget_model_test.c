@@ -0,0 +1,532 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file rpmsg_retarget_model_test.c
+*
+* Host test of the RPMsg retarget proxy of OpenAMP, in its copy and
+* zero-copy streaming modes, against a stand-in of the Linux proxy. It is
+* built and run with the driver model tests by make -C scripts/host_model.
+*
+* The test provides the RPMsg API: a pool of TX buffers of the virtio
+* payload size, a pool of RX buffers, and the proxy, which serves one
+* request at a time in order. A request is answered PROXY_LINK_NS after it
+* is sent, and no sooner than PROXY_SERVICE_NS after the previous answer.
+* The answers are delivered to the endpoint callback from the poll function
+* of the retarget, as the virtio notifications would be.
+*
+* The test writes and reads patterns of all sizes through _write() and
+* _read() in both modes and checks the proxy gets them in order, the null
+* termination of the standard output in streaming mode, the errors of the
+* proxy, the window of outstanding requests and that all the TX and RX
+* buffers are returned. Then the throughput of both modes is measured with
+* an immediate proxy and with a link latency.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 1.0   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <openamp/rpmsg_retarget.h>
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#define BUF_SIZE		496U	/* Payload of a virtio RPMsg buffer */
+#define NUM_TX_BUFS		16U
+#define NUM_RX_BUFS		16U
+#define FILE_FD			3
+#define STDOUT_FD		1
+#define FILE_SIZE		(256U * 1024U)
+#define COPY_MAX		479U	/* Largest write of the copy mode */
+#define STREAM_MAX		4096U
+#define PROXY_LINK_NS		20000U	/* Round trip of a request */
+#define PROXY_SERVICE_NS	2000U	/* Proxy time per request */
+#define NUM_BENCHES		2U
+
+/**************************** Type Definitions *******************************/
+
+typedef struct {
+	u8 *Buf;		/* TX buffer of the request */
+	u32 Len;
+	u64 ReadyNs;		/* Time the answer can be delivered */
+} Request;
+
+/************************** Function Prototypes ******************************/
+
+static void ProxyReset(u32 LinkNs, u32 ServiceNs);
+static int ProxyPoll(void *Arg);
+static void ProxyAnswer(const Request *Req);
+static u8 *TxAlloc(void);
+static void TxFree(const void *Buf);
+static u32 WriteAll(int Fd, u32 Size, u32 MaxLen);
+static u32 ReadAll(u32 Size, u32 MaxLen);
+static void CheckBuffers(const char *Mode);
+static void Bench(const char *Mode, u32 Window, u32 MaxLen, u32 LinkNs);
+
+/* System calls of the retarget, declared by the C library of the target */
+int _read(int fd, char *buffer, int buflen);
+int _write(int fd, const char *ptr, int len);
+
+/************************** Variable Definitions *****************************/
+
+static struct rpmsg_device Rdev;
+static struct rpmsg_rpc_data Rpc;
+static u8 TxBufs[NUM_TX_BUFS][BUF_SIZE];
+static u32 TxUsed;
+static u8 RxBufs[NUM_RX_BUFS][BUF_SIZE];
+static u32 RxHeld;
+static Request Queue[NUM_TX_BUFS];
+static u32 QueueHead;
+static u32 QueueCount;
+static u32 MaxQueued;
+static u64 LastReadyNs;
+static u32 LinkLatencyNs;
+static u32 ServiceNs;
+static u32 Requests;
+static u32 NocopySends;
+static u32 Unterminated;
+static s32 InjectError;
+static u8 Pattern[FILE_SIZE];
+static u8 Data[FILE_SIZE];
+static u8 Sink[2][FILE_SIZE];
+static u32 SinkLen[2];
+static u32 SourcePos;
+
+/*****************************************************************************/
+/*
+* RPMsg API of the model. The copy sends take a TX buffer and copy the data
+* into it, the zero-copy sends queue the buffer of the caller.
+*/
+int rpmsg_create_ept(struct rpmsg_endpoint *ept, struct rpmsg_device *rdev,
+		     const char *name, uint32_t src, uint32_t dest,
+		     rpmsg_ept_cb cb, rpmsg_ns_unbind_cb ns_unbind_cb)
+{
+	memset(ept, 0, sizeof(*ept));
+	(void)strncpy(ept->name, name, sizeof(ept->name) - 1U);
+	ept->rdev = rdev;
+	ept->addr = src;
+	ept->dest_addr = dest;
+	ept->cb = cb;
+	ept->ns_unbind_cb = ns_unbind_cb;
+
+	return RPMSG_SUCCESS;
+}
+
+void rpmsg_destroy_ept(struct rpmsg_endpoint *ept)
+{
+	ept->rdev = NULL;
+}
+
+static u8 *TxAlloc(void)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < NUM_TX_BUFS; Index++) {
+		if (((TxUsed >> Index) & 1U) == 0U) {
+			TxUsed |= 1U << Index;
+			return TxBufs[Index];
+		}
+	}
+
+	return NULL;
+}
+
+static void TxFree(const void *Buf)
+{
+	TxUsed &= ~(1U << (((const u8 *)Buf - TxBufs[0]) / BUF_SIZE));
+}
+
+static int Send(u8 *Buf, int len)
+{
+	u64 ReadyNs = XHostModel_TimeNs() + LinkLatencyNs;
+	Request *Req;
+
+	if (ReadyNs < (LastReadyNs + ServiceNs)) {
+		ReadyNs = LastReadyNs + ServiceNs;
+	}
+	LastReadyNs = ReadyNs;
+	Req = &Queue[(QueueHead + QueueCount) % NUM_TX_BUFS];
+	Req->Buf = Buf;
+	Req->Len = (u32)len;
+	Req->ReadyNs = ReadyNs;
+	QueueCount++;
+	if (QueueCount > MaxQueued) {
+		MaxQueued = QueueCount;
+	}
+	Requests++;
+
+	return len;
+}
+
+int rpmsg_send_offchannel_raw(struct rpmsg_endpoint *ept, uint32_t src,
+			      uint32_t dst, const void *data, int len,
+			      int wait)
+{
+	u8 *Buf;
+
+	XHOST_CHECK((len > 0) && ((u32)len <= BUF_SIZE), "copy send of %d",
+		    len);
+	Buf = TxAlloc();
+	if ((Buf == NULL) || (len <= 0) || ((u32)len > BUF_SIZE)) {
+		return RPMSG_ERR_NO_BUFF;
+	}
+	memcpy(Buf, data, (size_t)len);
+
+	return Send(Buf, len);
+}
+
+void *rpmsg_get_tx_payload_buffer(struct rpmsg_endpoint *ept,
+				  uint32_t *len, int wait)
+{
+	u8 *Buf = TxAlloc();
+
+	XHOST_CHECK(Buf != NULL, "no TX buffer with %u requests queued",
+		    (unsigned)QueueCount);
+	*len = BUF_SIZE;
+
+	return Buf;
+}
+
+int rpmsg_release_tx_buffer(struct rpmsg_endpoint *ept, void *txbuf)
+{
+	TxFree(txbuf);
+
+	return RPMSG_SUCCESS;
+}
+
+int rpmsg_send_offchannel_nocopy(struct rpmsg_endpoint *ept, uint32_t src,
+				 uint32_t dst, const void *data, int len)
+{
+	const struct rpmsg_rpc_syscall *Syscall = data;
+
+	XHOST_CHECK((len > 0) && ((u32)len <= BUF_SIZE), "nocopy send of %d",
+		    len);
+	NocopySends++;
+	if ((Syscall->args.int_field1 == STDOUT_FD) &&
+	    ((Syscall->args.data_len !=
+	      ((u32)Syscall->args.int_field2 + 1U)) ||
+	     (((const u8 *)data)[sizeof(*Syscall) +
+				 (u32)Syscall->args.int_field2] != 0U))) {
+		Unterminated++;
+	}
+
+	return Send((u8 *)data, len);
+}
+
+void rpmsg_hold_rx_buffer(struct rpmsg_endpoint *ept, void *rxbuf)
+{
+	RxHeld |= 1U << (((u8 *)rxbuf - RxBufs[0]) / BUF_SIZE);
+}
+
+void rpmsg_release_rx_buffer(struct rpmsg_endpoint *ept, void *rxbuf)
+{
+	u32 Bit = 1U << (((u8 *)rxbuf - RxBufs[0]) / BUF_SIZE);
+
+	XHOST_CHECK((RxHeld & Bit) != 0U, "release of a free RX buffer");
+	RxHeld &= ~Bit;
+}
+
+/*****************************************************************************/
+/*
+* The proxy: a WRITE request is appended to the file of its descriptor and
+* answered with its size or the injected error, a READ request is answered
+* with the next bytes of the pattern, at most one buffer.
+*/
+static void ProxyAnswer(const Request *Req)
+{
+	const struct rpmsg_rpc_syscall *Syscall =
+		(const struct rpmsg_rpc_syscall *)Req->Buf;
+	const u8 *Payload = Req->Buf + sizeof(*Syscall);
+	struct rpmsg_rpc_syscall *Resp;
+	u32 RxIndex;
+	u32 File;
+	u32 Len;
+	u32 Size = sizeof(*Resp);
+
+	for (RxIndex = 0U; RxIndex < NUM_RX_BUFS; RxIndex++) {
+		if (((RxHeld >> RxIndex) & 1U) == 0U) {
+			break;
+		}
+	}
+	XHOST_CHECK(RxIndex < NUM_RX_BUFS, "all RX buffers held");
+	if (RxIndex == NUM_RX_BUFS) {
+		return;
+	}
+	Resp = (struct rpmsg_rpc_syscall *)RxBufs[RxIndex];
+	Resp->id = Syscall->id;
+	Resp->args.int_field2 = 0;
+	Resp->args.data_len = 0U;
+
+	if (Syscall->id == WRITE_SYSCALL_ID) {
+		File = (Syscall->args.int_field1 == STDOUT_FD) ? 1U : 0U;
+		Len = (u32)Syscall->args.int_field2;
+		XHOST_CHECK((Len + sizeof(*Syscall) <= Req->Len) &&
+			    (SinkLen[File] + Len <= FILE_SIZE),
+			    "write of %u bytes in a %u byte request",
+			    (unsigned)Len, (unsigned)Req->Len);
+		if ((Len + sizeof(*Syscall) <= Req->Len) &&
+		    (SinkLen[File] + Len <= FILE_SIZE)) {
+			memcpy(&Sink[File][SinkLen[File]], Payload, Len);
+			SinkLen[File] += Len;
+		}
+		Resp->args.int_field1 = (InjectError != 0) ? InjectError :
+					(s32)Len;
+	} else {
+		Len = (u32)Syscall->args.int_field2;
+		if (Len > (BUF_SIZE - sizeof(*Resp))) {
+			Len = BUF_SIZE - sizeof(*Resp);
+		}
+		if (Len > (FILE_SIZE - SourcePos)) {
+			Len = FILE_SIZE - SourcePos;
+		}
+		memcpy(RxBufs[RxIndex] + sizeof(*Resp), &Pattern[SourcePos],
+		       Len);
+		SourcePos += Len;
+		Resp->args.int_field1 = (s32)Len;
+		Resp->args.data_len = Len;
+		Size += Len;
+	}
+	TxFree(Req->Buf);
+
+	/* The buffer goes back to the virtqueue unless the callback holds it */
+	(void)Rpc.ept.cb(&Rpc.ept, Resp, Size, Rpc.ept.dest_addr, NULL);
+}
+
+static int ProxyPoll(void *Arg)
+{
+	Request Req;
+
+	if ((QueueCount != 0U) &&
+	    (XHostModel_TimeNs() >= Queue[QueueHead].ReadyNs)) {
+		Req = Queue[QueueHead];
+		QueueHead = (QueueHead + 1U) % NUM_TX_BUFS;
+		QueueCount--;
+		ProxyAnswer(&Req);
+	}
+
+	return 0;
+}
+
+static void ProxyReset(u32 LinkNs, u32 ServiceTimeNs)
+{
+	LinkLatencyNs = LinkNs;
+	ServiceNs = ServiceTimeNs;
+	LastReadyNs = 0U;
+	MaxQueued = 0U;
+	Requests = 0U;
+	NocopySends = 0U;
+	Unterminated = 0U;
+	SinkLen[0] = 0U;
+	SinkLen[1] = 0U;
+	SourcePos = 0U;
+}
+
+/*****************************************************************************/
+/*
+* Writes Size bytes of the pattern to a descriptor, in writes of 1 to
+* MaxLen bytes. Returns the bytes the writes report.
+*/
+static u32 WriteAll(int Fd, u32 Size, u32 MaxLen)
+{
+	u32 Done = 0U;
+	u32 Len;
+	int Ret;
+
+	while (Done < Size) {
+		Len = 1U + ((u32)rand() % MaxLen);
+		if (Len > (Size - Done)) {
+			Len = Size - Done;
+		}
+		Ret = _write(Fd, (const char *)&Pattern[Done], (int)Len);
+		XHOST_CHECK(Ret == (int)Len, "write of %u bytes returned %d",
+			    (unsigned)Len, Ret);
+		if (Ret <= 0) {
+			break;
+		}
+		Done += (u32)Ret;
+	}
+
+	return Done;
+}
+
+/* Reads Size bytes in reads of 1 to MaxLen bytes, returns the bytes read */
+static u32 ReadAll(u32 Size, u32 MaxLen)
+{
+	u32 Done = 0U;
+	u32 Len;
+	int Ret;
+
+	while (Done < Size) {
+		Len = 1U + ((u32)rand() % MaxLen);
+		Ret = _read(FILE_FD, (char *)&Data[Done], (int)Len);
+		if (Ret <= 0) {
+			break;
+		}
+		XHOST_CHECK((u32)Ret <= Len, "read of %u bytes returned %d",
+			    (unsigned)Len, Ret);
+		Done += (u32)Ret;
+	}
+
+	return Done;
+}
+
+static void CheckBuffers(const char *Mode)
+{
+	XHOST_CHECK((TxUsed == 0U) && (RxHeld == 0U) && (QueueCount == 0U),
+		    "%s: TX buffers 0x%x, RX buffers 0x%x, %u requests left",
+		    Mode, (unsigned)TxUsed, (unsigned)RxHeld,
+		    (unsigned)QueueCount);
+}
+
+/*****************************************************************************/
+/*
+* Writes and reads the whole pattern in one mode and prints the
+* throughput.
+*/
+static void Bench(const char *Mode, u32 Window, u32 MaxLen, u32 LinkNs)
+{
+	u64 StartNs;
+	u64 WriteNs;
+	u64 ReadNs;
+	u32 Done;
+	u32 Len;
+	u32 WriteRequests;
+	int Ret;
+
+	ProxyReset(LinkNs, (LinkNs != 0U) ? PROXY_SERVICE_NS : 0U);
+	(void)rpmsg_rpc_set_stream_mode(&Rpc, Window);
+	StartNs = XHostModel_TimeNs();
+	for (Done = 0U; Done < FILE_SIZE; Done += Len) {
+		Len = FILE_SIZE - Done;
+		if (Len > MaxLen) {
+			Len = MaxLen;
+		}
+		Ret = _write(FILE_FD, (const char *)&Pattern[Done], (int)Len);
+		if (Ret != (int)Len) {
+			break;
+		}
+	}
+	WriteNs = XHostModel_TimeNs() - StartNs;
+	WriteRequests = Requests;
+	XHOST_CHECK((Done == FILE_SIZE) && (SinkLen[0] == FILE_SIZE),
+		    "%s: %u bytes written", Mode, (unsigned)SinkLen[0]);
+
+	StartNs = XHostModel_TimeNs();
+	for (Done = 0U; Done < FILE_SIZE; Done += (u32)Ret) {
+		Ret = _read(FILE_FD, (char *)&Data[Done], (int)MaxLen);
+		if (Ret <= 0) {
+			break;
+		}
+	}
+	ReadNs = XHostModel_TimeNs() - StartNs;
+	XHOST_CHECK(Done == FILE_SIZE, "%s: %u bytes read", Mode,
+		    (unsigned)Done);
+	CheckBuffers(Mode);
+
+	printf("%6u ns link, %-14s write %7.1f MB/s (%4u requests), "
+	       "read %7.1f MB/s (%4u requests)\n", (unsigned)LinkNs, Mode,
+	       (double)FILE_SIZE * 1000.0 / (double)WriteNs,
+	       (unsigned)WriteRequests,
+	       (double)FILE_SIZE * 1000.0 / (double)ReadNs,
+	       (unsigned)(Requests - WriteRequests));
+}
+
+int main(void)
+{
+	static const u32 Windows[] = { 0U, 1U, RPMSG_RPC_DEFAULT_WINDOW };
+	static const u32 LinkNs[NUM_BENCHES] = { 0U, PROXY_LINK_NS };
+	char Name[32];
+	u32 Index;
+	u32 Run;
+	u32 MaxLen;
+	u32 Done;
+	int Ret;
+
+	srand(1U);
+	for (Index = 0U; Index < FILE_SIZE; Index++) {
+		Pattern[Index] = (u8)rand();
+	}
+	XHOST_CHECK(rpmsg_rpc_init(&Rpc, &Rdev, "rpmsg-proxy",
+				   RPMSG_ADDR_ANY, DEFAULT_PROXY_ENDPOINT,
+				   NULL, ProxyPoll, NULL) == 0, "init");
+	rpmsg_set_default_rpc(&Rpc);
+
+	/* Writes and reads of all sizes, a file and the standard output */
+	for (Index = 0U; Index < (sizeof(Windows) / sizeof(Windows[0]));
+	     Index++) {
+		ProxyReset(0U, 0U);
+		(void)rpmsg_rpc_set_stream_mode(&Rpc, Windows[Index]);
+		MaxLen = (Windows[Index] == 0U) ? COPY_MAX : STREAM_MAX;
+		Done = WriteAll(FILE_FD, FILE_SIZE / 4U, MaxLen);
+		XHOST_CHECK((SinkLen[0] == Done) &&
+			    (memcmp(Sink[0], Pattern, Done) == 0),
+			    "window %u: file written wrong",
+			    (unsigned)Windows[Index]);
+		Done = WriteAll(STDOUT_FD, FILE_SIZE / 4U, MaxLen);
+		XHOST_CHECK((SinkLen[1] == Done) &&
+			    (memcmp(Sink[1], Pattern, Done) == 0),
+			    "window %u: standard output written wrong",
+			    (unsigned)Windows[Index]);
+		XHOST_CHECK((Windows[Index] == 0U) ?
+			    (NocopySends == 0U) && (MaxQueued == 1U) :
+			    (NocopySends == Requests) &&
+			    (MaxQueued == Windows[Index]),
+			    "window %u: %u of %u requests zero-copy, "
+			    "%u outstanding", (unsigned)Windows[Index],
+			    (unsigned)NocopySends, (unsigned)Requests,
+			    (unsigned)MaxQueued);
+		XHOST_CHECK(Unterminated == 0U,
+			    "window %u: %u standard output requests not null "
+			    "terminated", (unsigned)Windows[Index],
+			    (unsigned)Unterminated);
+		Done = ReadAll(FILE_SIZE / 4U, MaxLen);
+		XHOST_CHECK((Done == SourcePos) &&
+			    (memcmp(Data, Pattern, Done) == 0),
+			    "window %u: read wrong", (unsigned)Windows[Index]);
+		snprintf(Name, sizeof(Name), "window %u",
+			 (unsigned)Windows[Index]);
+		CheckBuffers(Name);
+	}
+
+	/* A proxy error is returned by both modes */
+	for (Index = 0U; Index < (sizeof(Windows) / sizeof(Windows[0]));
+	     Index++) {
+		ProxyReset(0U, 0U);
+		(void)rpmsg_rpc_set_stream_mode(&Rpc, Windows[Index]);
+		InjectError = -EIO;
+		Ret = _write(FILE_FD, (const char *)Pattern, 100);
+		InjectError = 0;
+		XHOST_CHECK(Ret == -EIO, "window %u: error %d",
+			    (unsigned)Windows[Index], Ret);
+		CheckBuffers("error");
+	}
+
+	printf("%u KB in writes and reads of at most %u bytes (copy mode) "
+	       "or %u bytes (streaming)\n", (unsigned)(FILE_SIZE / 1024U),
+	       (unsigned)COPY_MAX, (unsigned)STREAM_MAX);
+	for (Run = 0U; Run < NUM_BENCHES; Run++) {
+		Bench("copy", 0U, COPY_MAX, LinkNs[Run]);
+		Bench("stream, 1", 1U, STREAM_MAX, LinkNs[Run]);
+		Bench("stream, 4", RPMSG_RPC_DEFAULT_WINDOW, STREAM_MAX,
+		      LinkNs[Run]);
+	}
+
+	rpmsg_rpc_release(&Rpc);
+
+	return XHostModel_Report("rpmsg_retarget_model_test");
+}
@@ -0,0 +1,210 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_mem_model_test.c
+*
+* Host test of Xil_MemCpy() and Xil_MemCpyNormal() of the standalone BSP.
+* It is built and run with the driver model tests by make -C
+* scripts/host_model, once with the unaligned word loads of the Cortex-A
+* and Cortex-R processors (XMEM_UNALIGNED_LOAD) and once with the byte
+* copy of the MicroBlaze.
+*
+* Every size up to a few unrolled blocks is copied between all the source
+* and destination offsets inside two words, then a few large sizes, and
+* the destination is checked against memcpy() along with the guard bytes
+* around it. Xil_MemCpy() is only checked on word aligned buffers, which
+* it requires. The copies which move a buffer down over itself, as done
+* before by the secure copies of xil_util.c, must give the memmove()
+* result.
+*
+* The throughput of both copies and of the C library memcpy() is then
+* printed for aligned and unaligned buffers of several sizes.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 1.0   kt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xil_types.h"
+#include "xil_mem.h"
+#include "xhost_model.h"
+
+/************************** Constant Definitions *****************************/
+
+#ifdef __ARM_FEATURE_UNALIGNED
+#define TEST_NAME	"xil_mem_model_test"
+#else
+#define TEST_NAME	"xil_mem_byte_model_test"
+#endif
+
+#define MAX_OFFSET	16U		/* Two 64-bit words */
+#define MAX_EDGE_SIZE	160U		/* Five unrolled blocks */
+#define GUARD		64U
+#define BUF_SIZE	(128U * 1024U)
+#define GUARD_BYTE	0xA5U
+#define BENCH_BYTES	(64U * 1024U * 1024U)
+#define NUM_BENCH_SIZES	4U
+
+/**************************** Type Definitions *******************************/
+
+typedef void (*CopyFunc)(void *Dst, const void *Src, u32 Size);
+
+/************************** Function Prototypes ******************************/
+
+static void CheckCopy(const char *Name, CopyFunc Copy, u32 DstOffset,
+		      u32 SrcOffset, u32 Size);
+static void CheckOverlap(const char *Name, CopyFunc Copy, u32 Shift,
+			 u32 Size);
+static double Bench(CopyFunc Copy, u32 DstOffset, u32 SrcOffset, u32 Size);
+static void LibcCopy(void *Dst, const void *Src, u32 Size);
+
+/************************** Variable Definitions *****************************/
+
+static u8 Src[BUF_SIZE + (2U * GUARD)] __attribute__((aligned(64)));
+static u8 Dst[BUF_SIZE + (2U * GUARD)] __attribute__((aligned(64)));
+static u8 Expected[BUF_SIZE + (2U * GUARD)];
+
+static const u32 LargeSizes[] = {
+	1023U, 1024U, 4095U, 4096U, 65537U, BUF_SIZE - MAX_OFFSET
+};
+static const u32 BenchSizes[NUM_BENCH_SIZES] = {
+	16U, 256U, 4096U, 65536U
+};
+
+/*****************************************************************************/
+/*
+* One copy of Size bytes from Src + SrcOffset to Dst + DstOffset, both after
+* the leading guard, checked against memcpy() with the guards.
+*/
+static void CheckCopy(const char *Name, CopyFunc Copy, u32 DstOffset,
+		      u32 SrcOffset, u32 Size)
+{
+	u32 Total = Size + DstOffset + (2U * GUARD);
+
+	memset(Dst, GUARD_BYTE, Total);
+	memset(Expected, GUARD_BYTE, Total);
+	memcpy(&Expected[GUARD + DstOffset], &Src[GUARD + SrcOffset], Size);
+	Copy(&Dst[GUARD + DstOffset], &Src[GUARD + SrcOffset], Size);
+	XHOST_CHECK(memcmp(Dst, Expected, Total) == 0,
+		    "%s of %u bytes from offset %u to %u", Name,
+		    (unsigned)Size, (unsigned)SrcOffset, (unsigned)DstOffset);
+}
+
+/*****************************************************************************/
+/*
+* A copy of Size bytes Shift bytes down in the same buffer.
+*/
+static void CheckOverlap(const char *Name, CopyFunc Copy, u32 Shift,
+			 u32 Size)
+{
+	u32 Total = Size + Shift + (2U * GUARD);
+
+	memcpy(Dst, Src, Total);
+	memcpy(Expected, Src, Total);
+	memmove(&Expected[GUARD], &Expected[GUARD + Shift], Size);
+	Copy(&Dst[GUARD], &Dst[GUARD + Shift], Size);
+	XHOST_CHECK(memcmp(Dst, Expected, Total) == 0,
+		    "%s of %u bytes moved %u bytes down", Name,
+		    (unsigned)Size, (unsigned)Shift);
+}
+
+static void LibcCopy(void *Dst, const void *Src, u32 Size)
+{
+	(void)memcpy(Dst, Src, Size);
+}
+
+/*****************************************************************************/
+/*
+* Throughput in MB/s of BENCH_BYTES copied in Size byte copies.
+*/
+static double Bench(CopyFunc Copy, u32 DstOffset, u32 SrcOffset, u32 Size)
+{
+	u32 Count = BENCH_BYTES / Size;
+	u32 Index;
+	u64 StartNs;
+	u64 Ns;
+
+	StartNs = XHostModel_TimeNs();
+	for (Index = 0U; Index < Count; Index++) {
+		Copy(&Dst[GUARD + DstOffset], &Src[GUARD + SrcOffset], Size);
+		/* The copies must not be merged */
+		__asm__ volatile("" : : "r"(Dst) : "memory");
+	}
+	Ns = XHostModel_TimeNs() - StartNs;
+
+	return ((double)Count * (double)Size * 1000.0) / (double)Ns;
+}
+
+int main(void)
+{
+	u32 Index;
+	u32 Size;
+	u32 SrcOffset;
+	u32 DstOffset;
+
+	for (Index = 0U; Index < sizeof(Src); Index++) {
+		Src[Index] = (u8)((Index * 7U) + (Index >> 8));
+	}
+
+	for (Size = 0U; Size <= MAX_EDGE_SIZE; Size++) {
+		for (SrcOffset = 0U; SrcOffset < MAX_OFFSET; SrcOffset++) {
+			for (DstOffset = 0U; DstOffset < MAX_OFFSET;
+			     DstOffset++) {
+				CheckCopy("Xil_MemCpyNormal",
+					  Xil_MemCpyNormal, DstOffset,
+					  SrcOffset, Size);
+				if (((SrcOffset | DstOffset) & 3U) == 0U) {
+					CheckCopy("Xil_MemCpy", Xil_MemCpy,
+						  DstOffset, SrcOffset, Size);
+				}
+			}
+		}
+		for (SrcOffset = 1U; SrcOffset < MAX_OFFSET; SrcOffset++) {
+			CheckOverlap("Xil_MemCpyNormal", Xil_MemCpyNormal,
+				     SrcOffset, Size);
+			if ((SrcOffset & 3U) == 0U) {
+				CheckOverlap("Xil_MemCpy", Xil_MemCpy,
+					     SrcOffset, Size);
+			}
+		}
+	}
+	for (Index = 0U; Index < (sizeof(LargeSizes) / sizeof(LargeSizes[0]));
+	     Index++) {
+		Size = LargeSizes[Index];
+		CheckCopy("Xil_MemCpyNormal", Xil_MemCpyNormal, 0U, 0U, Size);
+		CheckCopy("Xil_MemCpyNormal", Xil_MemCpyNormal, 3U, 0U, Size);
+		CheckCopy("Xil_MemCpyNormal", Xil_MemCpyNormal, 0U, 5U, Size);
+		CheckCopy("Xil_MemCpyNormal", Xil_MemCpyNormal, 7U, 2U, Size);
+		CheckCopy("Xil_MemCpy", Xil_MemCpy, 0U, 0U, Size);
+		CheckCopy("Xil_MemCpy", Xil_MemCpy, 4U, 8U, Size);
+		CheckOverlap("Xil_MemCpyNormal", Xil_MemCpyNormal, 9U, Size);
+	}
+
+	printf("MB/s, unaligned with the source 3 bytes off\n");
+	printf("%8s %10s %10s %10s %17s %17s\n", "bytes", "memcpy",
+	       "unaligned", "Xil_MemCpy", "Xil_MemCpyNormal", "unaligned");
+	for (Index = 0U; Index < NUM_BENCH_SIZES; Index++) {
+		Size = BenchSizes[Index];
+		printf("%8u %10.0f %10.0f %10.0f %17.0f %17.0f\n",
+		       (unsigned)Size, Bench(LibcCopy, 0U, 0U, Size),
+		       Bench(LibcCopy, 0U, 3U, Size),
+		       Bench(Xil_MemCpy, 0U, 0U, Size),
+		       Bench(Xil_MemCpyNormal, 0U, 0U, Size),
+		       Bench(Xil_MemCpyNormal, 0U, 3U, Size));
+	}
+
+	return XHostModel_Report(TEST_NAME);
+}